@@ -105,7 +105,10 @@ def run_script_tests(
             PROJECT_ROOT / "tests/waf-tools/test_crc64_ti_impl.py",
             PROJECT_ROOT / "tests/waf-tools/test_create_app_build_cfg.py",
             PROJECT_ROOT / "tests/waf-tools/test_create_version.py",
+            PROJECT_ROOT / "tests/waf-tools/test_database_layout.py",
             PROJECT_ROOT / "tests/waf-tools/test_misc_helpers.py",
+            PROJECT_ROOT / "tests/waf-tools/test_ram_budget.py",
+            PROJECT_ROOT / "tests/waf-tools/test_stack_usage.py",
             PROJECT_ROOT / "tests/waf-tools/test_vcs_git.py",
             PROJECT_ROOT / "tests/waf-tools/test_vcs.py",
             PROJECT_ROOT / "tests/pkg/test_hatch_build.py",
@@ -40,7 +40,7 @@
 """Implements a CLI command to test the available foxCLI-COM functionalities."""
 
 import sys
-from json import loads
+from json import dumps, loads
 from json.decoder import JSONDecodeError
 from pathlib import Path
 from queue import Empty
@@ -54,7 +54,9 @@ from ..com.parameter import (
     FileParameter,
     ModbusParameter,
     MQTTParameter,
+    TelemetryParameter,
 )
+from ..com.telemetry_com import Telemetry
 from ..helpers.click_helpers import recho, secho
 from ..helpers.config import read_config
 from ..helpers.fcan import CanBusConfig
@@ -232,3 +234,52 @@ def mqtt_main(config: Path, input_file: Path | None, output_file: Path | None) -
     secho("End of communication.")
     client.shutdown(block=True, timeout=1)
     file_handler.shutdown(block=True, timeout=1)
+
+
+def telemetry_main(config: Path, output_file: Path) -> None:
+    """Receives the telemetry stream of the BMS and writes the decoded records
+    to the output file as line delimited json objects.
+
+    Args:
+        config (Path): Path to a configuration file containing the telemetry
+            parameters.
+        output_file (Path): Path to the output file.
+
+    Exits:
+        The process exits with code 1 if the configuration is invalid or a
+        child process cannot be started.
+    """
+    config_dict = read_config(config)
+    logger.debug(config_dict)
+    try:
+        telemetry_para = TelemetryParameter(**config_dict)
+    except (TypeError, ValueError) as e:
+        recho(f"Invalid telemetry configuration: {e}")
+        sys.exit(1)
+    client = Telemetry("Test telemetry stream", telemetry_para)
+    output_file.parent.mkdir(exist_ok=True, parents=True)
+    file_para = FileParameter(output_file=output_file)
+    file_handler = File("Write", file_para)
+    logger.info("Init communication processes.")
+    try:
+        client.start()
+        file_handler.start()
+    except ChildProcessError as e:
+        recho(str(e))
+        sys.exit(1)
+    secho("Receiving is stopped with Ctrl+C.")
+    while True:
+        try:
+            record = client.read(block=True, timeout=1)
+            if record is None:
+                # the telemetry process has stopped
+                break
+            logger.debug("Received telemetry record: %s", record)
+            file_handler.write(dumps(record))
+        except Empty:
+            continue
+        except KeyboardInterrupt:
+            break
+    secho("End of communication.")
+    client.shutdown(block=True, timeout=1)
+    file_handler.shutdown(block=True, timeout=1)
@@ -40,13 +40,20 @@
 """CAN decode subcommand implementation"""
 
 import sys
+from collections.abc import Iterator
 from io import TextIOWrapper
+from multiprocessing import Pool
 from pathlib import Path
 
+import pyarrow as pa
+from can import Message
 from cantools import database
 from cantools.database.can.database import Database
+from pyarrow.parquet import write_table
 
-from ...helpers.click_helpers import recho
+from ...helpers.can_log import FILE_SUFFIX, CANLogReader, has_can_log_suffix
+from ...helpers.click_helpers import recho, secho
+from ..etl.can_columnar import ColumnarDecoder
 from ..etl.can_decode import CANDecode
 
 
@@ -109,6 +116,48 @@ def validate_decode_config(config: dict) -> None:
     if data_pos is None or not isinstance(data_pos, int):
         recho("'data_pos' is not an integer.")
         sys.exit(1)
+    for key in ("start", "stop"):
+        if config.get(key) is not None and not isinstance(config[key], int | float):
+            recho(f"'{key}' is not a number.")
+            sys.exit(1)
+    if config.get("start") is not None or config.get("stop") is not None:
+        _input = config.get("_input")
+        if not has_can_log_suffix(_input) and not (
+            isinstance(_input, Path) and _input.is_dir()
+        ):
+            recho(
+                f"'start' and 'stop' are only supported for binary CAN logs "
+                f"('{FILE_SUFFIX}') and directories of CAN logs."
+            )
+            sys.exit(1)
+
+
+def read_messages(decode_obj: CANDecode) -> Iterator[str | Message]:
+    """Yields the CAN messages to be decoded
+
+    The messages are read from stdin, if no input file is provided. For
+    binary CAN logs only the messages defined in the DBC file and within the
+    time range are read, using the index of the log.
+
+    Args:
+        decode_obj: Object which handles the decoding
+
+    Yields:
+        CAN messages as text lines or message objects
+    """
+    if not isinstance(decode_obj.input, Path):
+        yield from sys.stdin
+    elif decode_obj.input.is_dir():
+        recho("Directories as input require the output format 'parquet'.")
+        sys.exit(1)
+    elif has_can_log_suffix(decode_obj.input):
+        with CANLogReader(decode_obj.input) as reader:
+            yield from reader.messages(
+                reader.select(decode_obj.frame_ids, decode_obj.start, decode_obj.stop)
+            )
+    else:
+        with open(decode_obj.input, encoding="utf-8") as f:
+            yield from f
 
 
 def run_decode2stdout(decode_obj: CANDecode) -> None:
@@ -119,7 +168,7 @@ def run_decode2stdout(decode_obj: CANDecode) -> None:
     """
     one_message_decoded = False
     try:
-        for msg in sys.stdin:
+        for msg in read_messages(decode_obj):
             msg_name, msg_decoded = decode_obj.decode_msg(msg)
             if msg_name and msg_decoded:
                 one_message_decoded = True
@@ -152,7 +201,7 @@ def run_decode2file(decode_obj: CANDecode) -> None:
     output_files: dict[str, TextIOWrapper] = {}
     one_message_decoded = False
     try:
-        for msg in sys.stdin:
+        for msg in read_messages(decode_obj):
             msg_name, msg_decoded = decode_obj.decode_msg(msg)
             if msg_name and msg_decoded:
                 one_message_decoded = True
@@ -174,3 +223,81 @@ def run_decode2file(decode_obj: CANDecode) -> None:
             recho("No CAN message was decoded. Check configuration file.")
         for f in output_files.values():
             f.close()
+
+
+def collect_can_logs(_input: Path) -> list[Path]:
+    """Returns the CAN logs to be decoded
+
+    Args:
+        _input: CAN log or directory containing CAN logs ('.fcl' or '.txt')
+
+    Returns:
+        List of CAN logs
+    """
+    if not _input.is_dir():
+        return [_input]
+    return sorted([*_input.glob(f"*{FILE_SUFFIX}"), *_input.glob("*.txt")])
+
+
+def _decode_shard(
+    task: tuple[ColumnarDecoder, Path, float | None, float | None],
+) -> tuple[dict[str, pa.Table], int]:
+    """Decodes one CAN log (worker function of the process pool)"""
+    decoder, file, start, stop = task
+    return decoder.decode_file(file, start, stop)
+
+
+def run_decode2parquet(decode_obj: CANDecode, jobs: int = 1) -> None:
+    """Executes the columnar can decode step
+
+    The CAN logs are decoded in up to 'jobs' processes (one CAN log per
+    process). The tables of all CAN logs are concatenated per message, sorted
+    by the timestamp and saved as '<message name>.parquet' in the output
+    directory.
+
+    Args:
+        decode_obj: Object which handles the decoding
+        jobs: Maximum number of processes
+    """
+    if not isinstance(decode_obj.output_directory, Path):
+        recho("Provided output directory is invalid.")
+        sys.exit(1)
+    if not isinstance(decode_obj.input, Path):
+        recho("The output format 'parquet' requires an input file or directory.")
+        sys.exit(1)
+    files = collect_can_logs(decode_obj.input)
+    if not files:
+        recho(f"No CAN logs found in '{decode_obj.input}'.")
+        sys.exit(1)
+    try:
+        decode_obj.output_directory.mkdir(parents=True, exist_ok=True)
+    except PermissionError:
+        err_msg = f"{decode_obj.output_directory}: Can not create directory (Permission denied)"
+        recho(err_msg)
+        sys.exit(1)
+    decoder = ColumnarDecoder.from_database(decode_obj.database)
+    tasks = [(decoder, i, decode_obj.start, decode_obj.stop) for i in files]
+    if jobs > 1 and len(tasks) > 1:
+        with Pool(min(jobs, len(tasks))) as pool:
+            results = pool.map(_decode_shard, tasks)
+    else:
+        results = [_decode_shard(i) for i in tasks]
+    shards: dict[str, list[pa.Table]] = {}
+    undecodable = 0
+    for tables, count in results:
+        undecodable += count
+        for msg_name, table in tables.items():
+            shards.setdefault(msg_name, []).append(table)
+    if not shards:
+        recho("No CAN message was decoded. Check configuration file.")
+        return
+    for msg_name, tables in shards.items():
+        file_name = decode_obj.output_directory / f"{msg_name}.parquet"
+        try:
+            write_table(pa.concat_tables(tables).sort_by("Timestamp"), file_name)
+        except PermissionError:
+            recho(f"{file_name}: Can not write file (Permission denied)")
+            sys.exit(1)
+    if undecodable:
+        recho(f"{undecodable} CAN messages could not be decoded.", fg="yellow")
+    secho(f"Decoded {len(files)} CAN log(s) to {len(shards)} table(s).")
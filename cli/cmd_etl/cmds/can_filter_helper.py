@@ -42,6 +42,12 @@
 import re
 import sys
 
+from ...helpers.can_log import (
+    FILE_SUFFIX,
+    CANLogReader,
+    CANLogWriter,
+    has_can_log_suffix,
+)
 from ...helpers.click_helpers import recho
 from ..etl.can_filter import CANFilter
 
@@ -80,6 +86,18 @@ def validate_filter_config(config: dict) -> None:
             recho("'ids' are not defined as hexadecimal values!")
             sys.exit(1)
 
+    for key in ("start", "stop"):
+        if config.get(key) is not None and not isinstance(config[key], int | float):
+            recho(f"'{key}' is not a number.")
+            sys.exit(1)
+    if config.get("start") is not None or config.get("stop") is not None:
+        if not has_can_log_suffix(config.get("_input")):
+            recho(
+                f"'start' and 'stop' are only supported for binary CAN logs "
+                f"('{FILE_SUFFIX}')."
+            )
+            sys.exit(1)
+
     if "sampling" not in config:
         return
     if not isinstance(config["sampling"], dict):
@@ -136,6 +154,10 @@ def run_filter(filter_obj: CANFilter) -> None:
 
     _sanitize_args(filter_obj)
 
+    if has_can_log_suffix(filter_obj.input):
+        run_filter_can_log(filter_obj)
+        return
+
     # input is valid
     # 1/4
     if filter_obj.input is None and filter_obj.output is None:
@@ -188,3 +210,35 @@ def run_filter(filter_obj: CANFilter) -> None:
     else:
         recho("Filter input and output are not properly defined.")
         sys.exit(1)
+
+
+def run_filter_can_log(filter_obj: CANFilter) -> None:
+    """Executes the filter step on a binary CAN log
+
+    The filtered CAN messages are written as binary CAN log if the output
+    file has the binary CAN log suffix; otherwise they are written in the
+    text format of 'fox log' (to the output file or stdout).
+
+    Args:
+        filter_obj: Object which handles the filtering
+    """
+    with CANLogReader(filter_obj.input) as reader:  # type: ignore[arg-type]
+        messages = reader.messages(filter_obj.filter_log(reader))
+        if has_can_log_suffix(filter_obj.output):
+            writer = CANLogWriter(filter_obj.output)  # type: ignore[arg-type]
+            try:
+                for msg in messages:
+                    writer(msg)
+            finally:
+                writer.stop()
+        elif filter_obj.output:
+            with open(filter_obj.output, mode="w", encoding="utf-8") as f:
+                for msg in messages:
+                    f.write(f"{msg}\n")
+        else:
+            try:
+                for msg in messages:
+                    sys.stdout.write(f"{msg}\n")
+            except (OSError, TypeError, ValueError, UnicodeEncodeError):
+                recho("Could not write to stdout.")
+                sys.exit(1)
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""CAN log conversion subcommand implementation"""
+
+import sys
+from pathlib import Path
+
+from ...helpers.can_log import binary_to_text, is_can_log, text_to_binary
+from ...helpers.click_helpers import recho, secho
+
+
+def run_can_log_convert(_input: Path, output: Path) -> None:
+    """Converts a CAN log between the text and the binary format
+
+    The direction is defined by the input: binary CAN logs are converted to
+    text, all other files are treated as text CAN logs and converted to
+    binary CAN logs.
+
+    Args:
+        _input: CAN log to be converted
+        output: File to write the converted CAN log to
+    """
+    try:
+        output.parent.mkdir(exist_ok=True, parents=True)
+        if is_can_log(_input):
+            count = binary_to_text(_input, output)
+        else:
+            count = text_to_binary(_input, output)
+    except ValueError as exc:
+        recho(f"Could not convert '{_input}': {exc}")
+        sys.exit(1)
+    except OSError as exc:
+        recho(f"Could not convert '{_input}': {exc.strerror}")
+        sys.exit(1)
+    if not count:
+        recho("No CAN message was converted.", fg="yellow")
+    else:
+        secho(f"Converted {count} CAN messages.")
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Log decode subcommand implementation"""
+
+import sys
+from pathlib import Path
+
+from ...helpers.click_helpers import echo, recho
+from ...helpers.misc import PROJECT_ROOT
+from ..etl.log_decode import LogDecoder, read_message_definitions
+
+DEFAULT_LOG_CFG_DIR = PROJECT_ROOT / "src/app/engine/config"
+
+
+def log_decode_setup(cfg_dir: Path | None = None) -> LogDecoder:
+    """Reads the log message definitions and creates the LogDecoder object
+
+    Args:
+        cfg_dir: Directory containing 'log_cfg.h' and 'log_cfg.c'
+
+    Returns:
+        LogDecoder object
+    """
+    if cfg_dir is None:
+        cfg_dir = DEFAULT_LOG_CFG_DIR
+    try:
+        definitions = read_message_definitions(
+            cfg_dir / "log_cfg.h", cfg_dir / "log_cfg.c"
+        )
+    except (OSError, ValueError) as exc:
+        recho(f"Could not read the log message definitions: {exc}")
+        sys.exit(1)
+    return LogDecoder(definitions)
+
+
+def run_log_decode(
+    decoder: LogDecoder, _input: Path, output: Path | None = None
+) -> None:
+    """Decodes a file with serialized log records
+
+    Args:
+        decoder: Object which handles the decoding
+        _input: File with the binary log records
+        output: File to write the decoded records to; otherwise stdout is used
+    """
+    records = decoder.decode(_input.read_bytes())
+    lines = [f"{i.timestamp:>10} {i.sequence:>5} {i.text}\n" for i in records]
+    if output:
+        try:
+            output.parent.mkdir(exist_ok=True, parents=True)
+            output.write_text("".join(lines), encoding="utf-8")
+        except OSError:
+            recho(f"'{output.resolve()}' is not writeable.")
+            sys.exit(1)
+    else:
+        echo("".join(lines), nl=False)
+    if decoder.dropped_records or decoder.lost_records or decoder.invalid_bytes:
+        recho(str(decoder), fg="yellow")
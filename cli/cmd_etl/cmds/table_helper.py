@@ -166,14 +166,14 @@ def run_table(table: Table, data: Path, output: Path) -> None:
             )
             sys.exit(1)
     else:
-        data_files = list(data.glob("**/*.json"))
-        tables = [table.can_to_table(data=data_file) for data_file in data_files]
+        data_files = [*data.glob("**/*.json"), *data.glob("**/*.parquet")]
         if output.suffix:
-            # Combines multiple tables with respect to join_on date column
-            tb = table.join(tables=tables)
-            table.save_data({output: tb})
+            # Combines multiple tables with respect to join_on date column,
+            # the files are streamed to keep the memory usage bounded
+            table.join_files(data_files=data_files, output=output)
         else:
             # Save each table in a separate file
+            tables = [table.can_to_table(data=data_file) for data_file in data_files]
             output.mkdir(parents=True, exist_ok=True)
             new_data_files = [output / data_file.name for data_file in data_files]
             table.save_data(dict(zip(new_data_files, tables, strict=True)))
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+"""Trace decode subcommand implementation"""
+
+import sys
+from pathlib import Path
+
+from ...helpers.click_helpers import echo, recho
+from ..etl.trace_decode import FREEZE_REASONS, TraceDecoder, TraceSnapshot
+
+
+def format_snapshot(snapshot: TraceSnapshot) -> str:
+    """Formats the timeline and the CPU load of a snapshot
+
+    Args:
+        snapshot: decoded snapshot
+
+    Returns:
+        Formatted text
+    """
+    reason = FREEZE_REASONS[snapshot.freeze_reason % len(FREEZE_REASONS)]
+    lines = [
+        f"Snapshot ({reason}, argument {snapshot.freeze_argument}, "
+        f"{len(snapshot.events)} events)\n"
+    ]
+    start = snapshot.events[0].timestamp if snapshot.events else 0
+    for event in snapshot.events:
+        time_us = snapshot.to_microseconds((event.timestamp - start) & 0xFFFFFFFF)
+        lines.append(f"{time_us:>12.2f} us  {snapshot.describe(event)}\n")
+    lines.append("CPU load:\n")
+    for name, load in sorted(snapshot.cpu_load().items(), key=lambda i: -i[1]):
+        lines.append(f"  {name:<16} {load:>6.2f} %\n")
+    return "".join(lines)
+
+
+def run_trace_decode(_input: Path, output: Path | None = None) -> None:
+    """Decodes the trace snapshots in a captured UART stream
+
+    Args:
+        _input: File with the captured UART stream
+        output: File to write the decoded snapshots to; otherwise stdout is
+            used
+    """
+    decoder = TraceDecoder()
+    snapshots = decoder.decode(_input.read_bytes())
+    if not snapshots:
+        recho("No complete trace snapshot found.")
+        sys.exit(1)
+    text = "\n".join(format_snapshot(i) for i in snapshots)
+    if output:
+        try:
+            output.parent.mkdir(exist_ok=True, parents=True)
+            output.write_text(text, encoding="utf-8")
+        except OSError:
+            recho(f"'{output.resolve()}' is not writeable.")
+            sys.exit(1)
+    else:
+        echo(text, nl=False)
+    if decoder.incomplete_snapshots:
+        recho(str(decoder), fg="yellow")
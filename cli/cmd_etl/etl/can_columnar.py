@@ -0,0 +1,349 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Columnar decoding of CAN messages
+
+Instead of decoding frame by frame, the frames are grouped by CAN id and each
+signal is extracted for the whole group at once with vectorized bit
+operations on the 8 data bytes, driven by the signal layout of the DBC file.
+The result is one pyarrow table per message (and multiplexer value) with a
+'Timestamp' column and one column per signal, named like the keys of the
+JSON output of the decode subcommand.
+"""
+
+from dataclasses import dataclass, field
+from pathlib import Path
+
+import numpy as np
+import numpy.typing as npt
+import pyarrow as pa
+from cantools.database.can.database import Database
+
+from ...helpers.can_log import (
+    RECORD_DTYPE,
+    CANLogReader,
+    FrameFlags,
+    has_can_log_suffix,
+    parse_text_line,
+)
+
+
+@dataclass(frozen=True, slots=True)
+class SignalLayout:
+    """Position and conversion of one signal within the 8 data bytes
+
+    Attributes:
+        name: column name of the signal
+        start: start bit as defined in the DBC file
+        length: length in bits
+        big_endian: True for Motorola byte order
+        signed: True for signed integer signals
+        is_float: True for IEEE float signals
+        scale: scaling factor
+        offset: offset
+    """
+
+    name: str
+    start: int
+    length: int
+    big_endian: bool
+    signed: bool
+    is_float: bool
+    scale: float
+    offset: float
+
+    @property
+    def shift(self) -> int:
+        """Position of the least significant bit in the data word
+
+        Little endian signals are extracted from the data interpreted as
+        little endian 64 bit word, big endian signals from the data
+        interpreted as big endian 64 bit word.
+        """
+        if not self.big_endian:
+            return self.start
+        msb = 63 - (self.start // 8) * 8 - 7 + self.start % 8
+        return msb - self.length + 1
+
+    def extract(
+        self, le_words: npt.NDArray[np.uint64], be_words: npt.NDArray[np.uint64]
+    ) -> npt.NDArray[np.float64]:
+        """Extracts the physical values of the signal for all frames
+
+        Args:
+            le_words: data of the frames as little endian 64 bit words
+            be_words: data of the frames as big endian 64 bit words
+
+        Returns:
+            physical values of the signal
+        """
+        words = be_words if self.big_endian else le_words
+        mask = np.uint64((1 << self.length) - 1)
+        raw = (words >> np.uint64(self.shift)) & mask
+        if self.is_float:
+            if self.length == 32:
+                values = raw.astype(np.uint32).view(np.float32).astype(np.float64)
+            else:
+                values = raw.view(np.float64)
+        elif self.signed:
+            # sign extension: move the sign bit to bit 63 and shift back
+            unused = 64 - self.length
+            values = (
+                (raw << np.uint64(unused)).view(np.int64) >> np.int64(unused)
+            ).astype(np.float64)
+        else:
+            values = raw.astype(np.float64)
+        return values * self.scale + self.offset
+
+
+@dataclass(slots=True)
+class MessageLayout:
+    """Signal layout of one CAN message
+
+    Attributes:
+        name: message name
+        length: message length in bytes
+        signals: signals that are always present
+        multiplexer: multiplexer signal, if the message is multiplexed
+        multiplexed: signals per multiplexer value
+    """
+
+    name: str
+    length: int
+    signals: list[SignalLayout] = field(default_factory=list)
+    multiplexer: SignalLayout | None = None
+    multiplexed: dict[int, list[SignalLayout]] = field(default_factory=dict)
+
+
+def layouts_from_database(dbc: Database) -> dict[int, MessageLayout]:
+    """Creates the signal layouts of all messages of a DBC file
+
+    Only one multiplexer level is supported; the columns are named like the
+    keys of the JSON output of the decode subcommand.
+
+    Args:
+        dbc: cantools database
+
+    Returns:
+        Message layouts by CAN id
+    """
+    layouts = {}
+    for message in dbc.messages:
+        if message.is_extended_frame:
+            msg_id_hex = f"{message.frame_id:08x}"
+        else:
+            msg_id_hex = f"{message.frame_id:03x}"
+        layout = MessageLayout(message.name, message.length)
+        for signal in message.signals:
+            signal_layout = SignalLayout(
+                name=f"0x{msg_id_hex}_{signal.name}_{signal.unit}",
+                start=signal.start,
+                length=signal.length,
+                big_endian=signal.byte_order == "big_endian",
+                signed=signal.is_signed,
+                is_float=signal.is_float,
+                scale=float(signal.scale),
+                offset=float(signal.offset),
+            )
+            if signal.is_multiplexer:
+                layout.multiplexer = signal_layout
+            elif signal.multiplexer_ids:
+                for mux in signal.multiplexer_ids:
+                    layout.multiplexed.setdefault(mux, []).append(signal_layout)
+            else:
+                layout.signals.append(signal_layout)
+        layouts[message.frame_id] = layout
+    return layouts
+
+
+def read_records(
+    file: Path,
+    ids: list[int] | None = None,
+    start: float | None = None,
+    stop: float | None = None,
+) -> npt.NDArray[np.void]:
+    """Reads the CAN messages of a binary or text CAN log as records
+
+    Args:
+        file: binary CAN log or text CAN log as written by 'fox log'
+        ids: CAN ids to be read; for text CAN logs all messages are read
+        start: first timestamp to be read
+        stop: timestamp up to which messages are read, exclusive
+
+    Returns:
+        Records in the layout of binary CAN logs
+    """
+    if has_can_log_suffix(file):
+        with CANLogReader(file) as reader:
+            return reader.records(reader.select(ids, start, stop))
+    return _read_text_records(file, start, stop)
+
+
+def _read_text_records(
+    file: Path, start: float | None = None, stop: float | None = None
+) -> npt.NDArray[np.void]:
+    """Reads the CAN messages of a text CAN log as records"""
+    rows = []
+    with open(file, encoding="utf-8") as f:
+        for line in f:
+            if msg := parse_text_line(line):
+                flags = FrameFlags(0)
+                if msg.is_extended_id:
+                    flags |= FrameFlags.EXTENDED
+                if msg.is_remote_frame:
+                    flags |= FrameFlags.REMOTE
+                if msg.is_error_frame:
+                    flags |= FrameFlags.ERROR
+                rows.append(
+                    (
+                        msg.timestamp,
+                        msg.arbitration_id,
+                        msg.dlc,
+                        flags,
+                        0,
+                        tuple(bytes(msg.data).ljust(8, b"\x00")),
+                    )
+                )
+    records = np.array(rows, dtype=RECORD_DTYPE)
+    if start is not None:
+        records = records[records["timestamp"] >= start]
+    if stop is not None:
+        records = records[records["timestamp"] < stop]
+    return records
+
+
+class ColumnarDecoder:
+    """Decodes CAN messages to one pyarrow table per message
+
+    Args:
+        layouts: message layouts by CAN id, see 'layouts_from_database'
+    """
+
+    def __init__(self, layouts: dict[int, MessageLayout]) -> None:
+        self.layouts = layouts
+        self.undecodable = 0
+
+    @classmethod
+    def from_database(cls, dbc: Database) -> "ColumnarDecoder":
+        """Creates the decoder from a cantools database"""
+        return cls(layouts_from_database(dbc))
+
+    def decode(self, records: npt.NDArray[np.void]) -> dict[str, pa.Table]:
+        """Decodes the records of a CAN log
+
+        Frames that are not defined in the DBC file are ignored; remote
+        frames, error frames and frames that are shorter than their
+        definition are counted as undecodable.
+
+        Args:
+            records: records in the layout of binary CAN logs
+
+        Returns:
+            Tables by message name (with '_Mux_<value>' for multiplexed
+            messages)
+        """
+        tables: dict[str, pa.Table] = {}
+        if not records.size:
+            return tables
+        ids = records["arbitration_id"]
+        order = np.argsort(ids, kind="stable")
+        unique, starts = np.unique(ids[order], return_index=True)
+        bounds = [*starts[1:].tolist(), len(order)]
+        for can_id, first, last in zip(unique, starts, bounds, strict=True):
+            if (layout := self.layouts.get(int(can_id))) is None:
+                continue
+            group = records[order[first:last]]
+            invalid_flags = int(FrameFlags.REMOTE | FrameFlags.ERROR)
+            valid = (group["dlc"] >= layout.length) & (
+                (group["flags"] & invalid_flags) == 0
+            )
+            self.undecodable += int(np.count_nonzero(~valid))
+            group = group[valid]
+            if not group.size:
+                continue
+            data = np.ascontiguousarray(group["data"])
+            le_words = data.view("<u8").ravel()
+            be_words = data.view(">u8").ravel().astype(np.uint64)
+            if layout.multiplexer is None:
+                tables[layout.name] = self._table(
+                    group["timestamp"], layout.signals, le_words, be_words
+                )
+                continue
+            mux_values = layout.multiplexer.extract(le_words, be_words)
+            for mux, signals in layout.multiplexed.items():
+                rows = mux_values == mux
+                if not rows.any():
+                    continue
+                tables[f"{layout.name}_Mux_{mux}"] = self._table(
+                    group["timestamp"][rows],
+                    layout.signals + signals,
+                    le_words[rows],
+                    be_words[rows],
+                )
+        return tables
+
+    @staticmethod
+    def _table(
+        timestamps: npt.NDArray[np.float64],
+        signals: list[SignalLayout],
+        le_words: npt.NDArray[np.uint64],
+        be_words: npt.NDArray[np.uint64],
+    ) -> pa.Table:
+        """Creates the table of one message"""
+        columns = {"Timestamp": pa.array(timestamps, type=pa.float64())}
+        for signal in signals:
+            columns[signal.name] = pa.array(signal.extract(le_words, be_words))
+        return pa.table(columns)
+
+    def decode_file(
+        self, file: Path, start: float | None = None, stop: float | None = None
+    ) -> tuple[dict[str, pa.Table], int]:
+        """Decodes one CAN log
+
+        Args:
+            file: binary CAN log or text CAN log as written by 'fox log'
+            start: first timestamp to be decoded
+            stop: timestamp up to which messages are decoded, exclusive
+
+        Returns:
+            Tables by message name and the number of undecodable frames
+        """
+        self.undecodable = 0
+        records = read_records(file, list(self.layouts), start, stop)
+        return self.decode(records), self.undecodable
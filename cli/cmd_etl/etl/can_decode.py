@@ -42,8 +42,10 @@
 from pathlib import Path
 from typing import Any
 
+from can import Message
 from cantools import database
 from cantools.database.can.database import Database
+from cantools.database.can.message import Message as DbcMessage
 from cantools.database.can.signal import Signal
 
 from ...helpers.logger import logger
@@ -58,6 +60,10 @@ class CANDecode:  # pylint: disable=too-few-public-methods
         id_pos: Position of the CAN id in a CAN message
         data_pos: Position of the data in a CAN message
         output: Path to the output directory
+        _input: Path to the input file; None represents stdin
+        start: First timestamp to be decoded (binary CAN logs only)
+        stop: Timestamp up to which messages are decoded, exclusive
+            (binary CAN logs only)
     """
 
     # pylint: disable-next=R0913:too-many-arguments,too-many-positional-arguments
@@ -68,18 +74,35 @@ class CANDecode:  # pylint: disable=too-few-public-methods
         id_pos: int,
         data_pos: int,
         output: Path,
+        _input: Path | None = None,
+        start: float | None = None,
+        stop: float | None = None,
     ) -> None:
         self._database = dbc
         self._timestamp_pos = timestamp_pos
         self._id_pos = id_pos
         self._data_pos = data_pos
         self.output_directory = output
+        self.input = _input
+        self.start = start
+        self.stop = stop
 
-    def decode_msg(self, msg: str) -> tuple[str, str] | tuple[None, None]:
+    @property
+    def database(self) -> Database:
+        """The cantools database of the DBC file"""
+        return self._database
+
+    @property
+    def frame_ids(self) -> list[int]:
+        """CAN ids of all messages defined in the DBC file"""
+        return [i.frame_id for i in self._database.messages]
+
+    def decode_msg(self, msg: str | Message) -> tuple[str, str] | tuple[None, None]:
         """Method to the decoded passed CAN messages.
 
         Args:
-            msg: CAN message as string
+            msg: CAN message as string (text log) or as message object
+                (binary CAN log)
 
         Returns:
             Either a tuple with the message name and the decoded message
@@ -87,6 +110,8 @@ class CANDecode:  # pylint: disable=too-few-public-methods
         """
         logger.debug("received message %s", msg)
         try:
+            if isinstance(msg, Message):
+                return self._handle_message(msg)
             return self._handle_decoding(msg)
         except IndexError:
             logger.info("Index error at msg: %s", msg)
@@ -123,8 +148,49 @@ class CANDecode:  # pylint: disable=too-few-public-methods
         data = bytes.fromhex(
             " ".join(msg_parts[self._data_pos : can_message.length + self._data_pos])
         )
-        decoded_data: Any = self._database.decode_message(msg_id, data)
-        timestamp_format = f'"Timestamp": {msg_parts[self._timestamp_pos]}'
+        return self._format_decoded(
+            msg_parts[self._timestamp_pos], msg_id_hex, can_message, data
+        )
+
+    def _handle_message(self, msg: Message) -> tuple[str, str]:
+        """Handles the decoding of a CAN message read from a binary CAN log
+        without exception handling
+
+        Args:
+            msg: CAN message
+
+        Returns:
+            A tuple with the message name and the decoded message
+        """
+        can_message = self._database.get_message_by_frame_id(msg.arbitration_id)
+        # same id notation as in the text log
+        if msg.is_extended_id:
+            msg_id_hex = f"{msg.arbitration_id:08x}"
+        else:
+            msg_id_hex = f"{msg.arbitration_id:03x}"
+        return self._format_decoded(
+            f"{msg.timestamp:.6f}",
+            msg_id_hex,
+            can_message,
+            bytes(msg.data[: can_message.length]),
+        )
+
+    def _format_decoded(
+        self, timestamp: str, msg_id_hex: str, can_message: DbcMessage, data: bytes
+    ) -> tuple[str, str]:
+        """Decodes the CAN data and formats the decoded signals
+
+        Args:
+            timestamp: Timestamp of the CAN message
+            msg_id_hex: CAN id as written in the log
+            can_message: Message definition from the DBC file
+            data: CAN data
+
+        Returns:
+            A tuple with the message name and the decoded message
+        """
+        decoded_data: Any = self._database.decode_message(can_message.frame_id, data)
+        timestamp_format = f'"Timestamp": {timestamp}'
         if can_message.is_multiplexed():
             decoded_signals = list(decoded_data.keys())
             # remove multiplexer from msg signals
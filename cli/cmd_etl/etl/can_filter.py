@@ -41,6 +41,10 @@
 
 from pathlib import Path
 
+import numpy as np
+import numpy.typing as npt
+
+from ...helpers.can_log import CANLogReader
 from ...helpers.logger import logger
 
 
@@ -52,6 +56,9 @@ class CANFilter:
         _id_pos: Position of the CAN ids in the log file
         _sampling: Number of specific CAN messages that
             should be stored
+        start: First timestamp to be stored (binary CAN logs only)
+        stop: Timestamp up to which messages are stored, exclusive
+            (binary CAN logs only)
     """
 
     def __init__(
@@ -61,6 +68,8 @@ class CANFilter:
         sampling: dict[str, int] | None = None,
         _input: Path | None = None,  # None represents stdin
         output: Path | None = None,  # None represents stdout
+        start: float | None = None,
+        stop: float | None = None,
     ) -> None:
         self._ids = self.extend_ids(ids)
         self._id_pos = id_pos
@@ -69,6 +78,8 @@ class CANFilter:
             self._occurrence = dict.fromkeys(sampling, 0)
         self.input = _input
         self.output = output
+        self.start = start
+        self.stop = stop
 
     def filter_msg(self, msg: str) -> str | None:
         """Filters the incoming CAN message with
@@ -100,6 +111,31 @@ class CANFilter:
             return None
         return msg
 
+    def filter_log(self, reader: CANLogReader) -> npt.NDArray[np.int64]:
+        """Selects the CAN messages of a binary CAN log with respect to the
+        _ids, _sampling and the time range. The ids and the time range are
+        looked up in the index of the log instead of parsing every message.
+
+        Args:
+            reader: The binary CAN log
+
+        Returns:
+            Ascending record numbers of the CAN messages that fulfill the
+            filter conditions
+        """
+        selection = reader.select(
+            [int(i, 16) for i in self._ids], self.start, self.stop
+        )
+        if not self._sampling:
+            return selection
+        msg_ids = reader.records(selection)["arbitration_id"]
+        keep = np.ones(len(selection), dtype=bool)
+        for msg_id, sampling in self._sampling.items():
+            occurrences = np.flatnonzero(msg_ids == int(msg_id, 16))
+            keep[occurrences] = False
+            keep[occurrences[sampling - 1 :: sampling]] = True
+        return selection[keep]
+
     @staticmethod
     def extend_ids(ids: list[str]) -> list[str]:
         """Extends the list with CAN ids with
@@ -130,6 +166,8 @@ class CANFilter:
     def __str__(self) -> str:
         """Returns a proper string representation of a CANFilter object"""
         val = f"ID pos: {self._id_pos}, IDs: {self._ids}, sampling: {self._sampling}"
+        if self.start is not None or self.stop is not None:
+            val += f", time range: [{self.start}, {self.stop})"
         if self._sampling:
             val += f", occurrence: {self._occurrence}"
         return val
@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Decodes the binary records of the deferred-format log module"""
+
+import re
+import struct
+from dataclasses import dataclass
+from pathlib import Path
+
+from ...helpers.logger import logger
+
+#: first byte of each serialized record (see 'LOG_RECORD_SYNC_BYTE')
+RECORD_SYNC_BYTE = 0xA5
+#: number of raw arguments per record (see 'LOG_MAXIMUM_NUMBER_OF_ARGUMENTS')
+MAXIMUM_NUMBER_OF_ARGUMENTS = 4
+#: big-endian layout of a serialized record: sync byte, number of arguments,
+#: message id, sequence number, number of dropped records, timestamp and the
+#: raw arguments
+RECORD_FORMAT = f">BBHHHI{MAXIMUM_NUMBER_OF_ARGUMENTS}I"
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+
+DEFINITION_PATTERN = re.compile(
+    r'^\s*\{\s*(LOG_MESSAGE_ID_\w+)\s*,\s*(\d+)u\s*,\s*"((?:[^"\\]|\\.)*)"\s*\}\s*,'
+)
+ENUM_PATTERN = re.compile(r"^\s*(LOG_MESSAGE_ID_\w+)\s*,")
+CONVERSION_PATTERN = re.compile(r"%([udxf])")
+
+
+@dataclass
+class LogMessageDefinition:
+    """Definition of a log message as found in the configuration file"""
+
+    name: str
+    number_of_arguments: int
+    format_string: str
+
+
+@dataclass
+class LogRecord:
+    """A decoded log record"""
+
+    message_id: int
+    sequence: int
+    dropped_records: int
+    timestamp: int
+    text: str
+
+
+def read_message_definitions(
+    cfg_header: Path, cfg_source: Path
+) -> list[LogMessageDefinition]:
+    """Reads the log message definitions from the embedded configuration.
+
+    The order of the message identifiers is taken from the enumeration in the
+    configuration header, the formats are taken from the definition table in
+    the configuration source.
+
+    Args:
+        cfg_header: path to 'log_cfg.h'
+        cfg_source: path to 'log_cfg.c'
+
+    Returns:
+        List of message definitions, indexed by the message id
+    """
+    names = []
+    for line in cfg_header.read_text(encoding="utf-8").splitlines():
+        if match := ENUM_PATTERN.match(line):
+            if match.group(1) != "LOG_MESSAGE_ID_E_MAX":
+                names.append(match.group(1))
+
+    definitions = {}
+    for line in cfg_source.read_text(encoding="utf-8").splitlines():
+        if match := DEFINITION_PATTERN.match(line):
+            definitions[match.group(1)] = LogMessageDefinition(
+                name=match.group(1),
+                number_of_arguments=int(match.group(2)),
+                format_string=match.group(3),
+            )
+
+    missing = [i for i in names if i not in definitions]
+    if missing:
+        raise ValueError(f"No format defined for: {', '.join(missing)}")
+    return [definitions[i] for i in names]
+
+
+def format_arguments(format_string: str, arguments: tuple[int, ...]) -> str:
+    """Formats the raw 32-bit arguments according to the format string.
+
+    Args:
+        format_string: printf-like format string using 'u', 'd', 'x' and 'f'
+        arguments: raw 32-bit arguments
+
+    Returns:
+        Formatted text
+    """
+    remaining = list(arguments)
+
+    def _replace(match: re.Match) -> str:
+        if not remaining:
+            return match.group(0)
+        raw = remaining.pop(0)
+        conversion = match.group(1)
+        if conversion == "d":
+            return str(struct.unpack(">i", struct.pack(">I", raw))[0])
+        if conversion == "x":
+            return f"{raw:x}"
+        if conversion == "f":
+            return f"{struct.unpack('>f', struct.pack('>I', raw))[0]:f}"
+        return str(raw)
+
+    return CONVERSION_PATTERN.sub(_replace, format_string)
+
+
+class LogDecoder:
+    """Decodes a stream of serialized log records
+
+    Args:
+        definitions: log message definitions, indexed by the message id
+    """
+
+    def __init__(self, definitions: list[LogMessageDefinition]) -> None:
+        self.definitions = definitions
+        self.dropped_records = 0
+        self.lost_records = 0
+        self.invalid_bytes = 0
+        self._expected_sequence: int | None = None
+
+    def decode(self, data: bytes) -> list[LogRecord]:
+        """Decodes all complete records in the data.
+
+        Bytes that do not belong to a valid record are skipped until the next
+        sync byte is found.
+
+        Args:
+            data: serialized log records
+
+        Returns:
+            List of decoded records
+        """
+        records = []
+        position = 0
+        while position + RECORD_SIZE <= len(data):
+            fields = struct.unpack_from(RECORD_FORMAT, data, position)
+            sync, number_of_arguments, message_id = fields[0:3]
+            if (
+                sync != RECORD_SYNC_BYTE
+                or message_id >= len(self.definitions)
+                or number_of_arguments
+                != self.definitions[message_id].number_of_arguments
+            ):
+                self.invalid_bytes += 1
+                position += 1
+                continue
+            records.append(self._decode_record(fields))
+            position += RECORD_SIZE
+        self.invalid_bytes += len(data) - position
+        return records
+
+    def _decode_record(self, fields: tuple[int, ...]) -> LogRecord:
+        """Creates a record from the unpacked fields and updates the counters"""
+        number_of_arguments, message_id, sequence, dropped, timestamp = fields[1:6]
+        if self._expected_sequence is not None and sequence != self._expected_sequence:
+            # sequence numbers of dropped records are not consumed on the
+            # target, therefore a gap means that records got lost in transfer
+            lost = (sequence - self._expected_sequence) & 0xFFFF
+            logger.warning("Lost %s log record(s) before sequence %s", lost, sequence)
+            self.lost_records += lost
+        self._expected_sequence = (sequence + 1) & 0xFFFF
+        if dropped:
+            logger.warning("Target dropped %s log record(s)", dropped)
+            self.dropped_records += dropped
+        definition = self.definitions[message_id]
+        text = format_arguments(
+            definition.format_string, fields[6 : 6 + number_of_arguments]
+        )
+        return LogRecord(message_id, sequence, dropped, timestamp, text)
+
+    def __str__(self) -> str:
+        """Returns a summary of the decoded stream"""
+        return (
+            f"dropped on target: {self.dropped_records}, "
+            f"lost in transfer: {self.lost_records}, "
+            f"invalid bytes: {self.invalid_bytes}"
+        )
@@ -39,15 +39,20 @@
 
 """Combine decoded CAN messages to a table"""
 
+import json
 import sys
+from collections.abc import Iterator
 from pathlib import Path
 from typing import TypedDict, Unpack
 
+import click
+import numpy as np
+import numpy.typing as npt
 import pyarrow as pa
 import pyarrow.compute as pc
-from pyarrow.json import read_json
+from pyarrow.json import open_json, read_json
 from pyarrow.lib import ArrowInvalid  # pylint: disable=no-name-in-module
-from pyarrow.parquet import write_table
+from pyarrow.parquet import ParquetFile, ParquetWriter, read_table, write_table
 
 from ...helpers.click_helpers import echo, recho
 from ...helpers.logger import logger
@@ -62,6 +67,111 @@ class TableKwargs(TypedDict, total=False):
     separator: str
 
 
+def _dates(table: pa.Table) -> npt.NDArray[np.int64]:
+    """Returns the Date column of a table in microseconds"""
+    return table.column("Date").cast(pa.int64()).to_numpy()
+
+
+class _TableStream:
+    """Buffers the time-sorted chunks of one table for the streaming join
+
+    Only the rows that are needed for the next join steps are kept in the
+    buffer: the rows that have not been joined yet and, for the asof lookup,
+    the rows from the last joined date on (the previous value or the rows
+    within the lookahead of the tolerance).
+
+    Args:
+        chunks: Chunks of the table, sorted by the Date column
+    """
+
+    def __init__(self, chunks: Iterator[pa.Table]) -> None:
+        self._chunks = chunks
+        self.buffer: pa.Table | None = None
+        self.dates: npt.NDArray[np.int64] = np.empty(0, dtype=np.int64)
+        self.consumed = 0
+        self.exhausted = False
+        self.fill()
+
+    @property
+    def last(self) -> int | None:
+        """Date (in microseconds) of the last buffered row"""
+        return int(self.dates[-1]) if len(self.dates) else None
+
+    def fill(self) -> None:
+        """Appends the next chunk to the buffer"""
+        chunk = next(self._chunks, None)
+        if chunk is None:
+            self.exhausted = True
+            return
+        if self.buffer is None:
+            self.buffer = chunk
+        else:
+            self.buffer = pa.concat_tables([self.buffer, chunk])
+        self.dates = np.concatenate([self.dates, _dates(chunk)])
+
+    def consume(self, watermark: float) -> pa.Table:
+        """Returns the rows up to the watermark that have not been joined yet"""
+        end = int(np.searchsorted(self.dates, watermark, side="right"))
+        rows = self.buffer.slice(self.consumed, end - self.consumed)
+        self.consumed = end
+        return rows
+
+    def lookup(
+        self, dates: npt.NDArray[np.int64], tolerance: int | None
+    ) -> pa.Table:
+        """Asof lookup of the buffered rows for the passed dates
+
+        Args:
+            dates: Dates (in microseconds) to look up
+            tolerance: Same as for 'pyarrow.Table.join_asof'; 'None' for
+                previous values without time limit (forward fill)
+
+        Returns:
+            One row per date without the Date column; rows without a match
+            are null
+        """
+        values = self.buffer.drop(["Date"])
+        if tolerance is None or tolerance <= 0:
+            index = np.searchsorted(self.dates, dates, side="right") - 1
+            valid = index >= 0
+            if tolerance is not None:
+                valid &= dates - self.dates[index.clip(0)] <= -tolerance
+        else:
+            index = np.searchsorted(self.dates, dates, side="left")
+            valid = index < len(self.dates)
+            last = len(self.dates) - 1
+            valid &= self.dates[index.clip(0, last)] - dates <= tolerance
+        return values.take(pa.array(index.clip(0), mask=~valid))
+
+    def trim(self, date: int, tolerance: int | None) -> None:
+        """Drops the rows that are not needed for lookups of dates after 'date'
+
+        Args:
+            date: Last date (in microseconds) that has been joined
+            tolerance: Same as for the method lookup
+        """
+        if tolerance is None or tolerance <= 0:
+            # the last row at or before the date is the previous value
+            start = max(int(np.searchsorted(self.dates, date, side="right")) - 1, 0)
+        else:
+            # only rows at or after the date can be within the lookahead; the
+            # last row is kept, so that the buffer never runs empty
+            start = int(np.searchsorted(self.dates, date, side="left"))
+            start = min(start, len(self.dates) - 1)
+        self._drop(start)
+
+    def release(self) -> None:
+        """Drops the rows that have already been joined"""
+        self._drop(self.consumed)
+
+    def _drop(self, start: int) -> None:
+        """Drops the buffered rows before the index 'start'"""
+        self.buffer = self.buffer.slice(start)
+        self.dates = self.dates[start:]
+        # streams that are only looked up never consume rows
+        self.consumed = max(self.consumed - start, 0)
+
+
 class Table:
     """Implements the functionalities to create tables out of the
     decoded CAN messages.
@@ -128,18 +238,211 @@ class Table:
         recho("Combining several tables without 'join_on' parameter is not possible.")
         sys.exit(1)
 
+    def join_files(self, data_files: list[Path], output: Path) -> None:
+        """The method join_files joins the tables of the passed files like the
+        method join, but streams the files in time-sorted chunks and writes
+        the joined table chunk by chunk.
+
+        The tables are merged on their Date columns: a chunk of the joined
+        table is created as soon as all tables have been read up to its last
+        date, therefore only a few chunks per table are in memory at the same
+        time, independent of the size of the files.
+        Each file must be sorted by the timestamp.
+
+        Args:
+            data_files: Files with decoded CAN messages (.json or .parquet)
+            output: Path of the joined table
+        """
+        if self._join_on is None:
+            recho(
+                "Combining several tables without 'join_on' parameter is not possible."
+            )
+            sys.exit(1)
+        streams = [_TableStream(self.read_chunks(i)) for i in data_files]
+        streams = [i for i in streams if i.buffer is not None]
+        if not streams:
+            recho("No decoded CAN messages found.")
+            sys.exit(1)
+        if self._join_on == "ALL":
+            left = None
+        else:
+            left = next(
+                (i for i in streams if self._join_on in i.buffer.column_names), None
+            )
+            if left is None:
+                recho(f"Column '{self._join_on}' not found in any table.")
+                sys.exit(1)
+        fields = {}
+        for stream in streams:
+            fields.update({i.name: i for i in stream.buffer.schema if i.name != "Date"})
+        schema = pa.schema(
+            [streams[0].buffer.schema.field("Date")]
+            + [fields[i] for i in sorted(fields)]
+        )
+        begin = min(i.dates[0] for i in streams)
+        ends = [self._last_date(i) for i in data_files]
+        end = max([begin + 1, *[i for i in ends if i is not None]])
+        if self._output_format:
+            suffix = f".{self._output_format.name.lower()}"
+            output = output.parent / (output.stem + suffix)
+            echo(
+                f"Converted files to table {output} with output format "
+                f"{self._output_format.name}."
+            )
+        output_format = OutputFormats[output.suffix[1:].upper()]
+        output.parent.mkdir(parents=True, exist_ok=True)
+        chunks = self._stream_join(streams, left, schema)
+        try:
+            with click.progressbar(length=end - begin, label="Joining tables") as bar:
+                if output_format == OutputFormats.CSV:
+                    mode = "w"
+                    for chunk, date in chunks:
+                        chunk.to_pandas().to_csv(
+                            output,
+                            mode=mode,
+                            header=mode == "w",
+                            sep=self._separator,
+                            index=False,
+                            date_format="%Y-%m-%d %H:%M:%S.%f%z",
+                        )
+                        mode = "a"
+                        bar.update(min(date, end) - begin - bar.pos)
+                else:  # parquet format as default
+                    with ParquetWriter(output, schema) as writer:
+                        for chunk, date in chunks:
+                            writer.write_table(chunk)
+                            bar.update(min(date, end) - begin - bar.pos)
+                bar.update(bar.length - bar.pos)
+        except PermissionError:
+            recho("Could not write output file, because permission is denied.")
+            sys.exit(1)
+
+    def _stream_join(
+        self,
+        streams: list[_TableStream],
+        left: _TableStream | None,
+        schema: pa.Schema,
+    ) -> Iterator[tuple[pa.Table, int]]:
+        """Joins the streams chunk by chunk (k-way merge on the Date columns)
+
+        Args:
+            streams: Streams of all tables
+            left: Stream of the table with the join_on column; 'None' for an
+                outer join of all tables
+            schema: Schema of the joined table
+
+        Yields:
+            Chunks of the joined table and their last date
+        """
+        lookahead = max(self._tolerance, 0) if left is not None else 0
+        watermark = -np.inf
+        while True:
+            # read until every stream is ahead of the last watermark, so that
+            # the watermark advances in each step
+            for stream in streams:
+                offset = 0 if stream is left else lookahead
+                while not stream.exhausted and (
+                    stream.last is None or stream.last - offset <= watermark
+                ):
+                    stream.fill()
+            # all dates up to the new watermark can be joined
+            watermark = min(
+                (
+                    i.last - (0 if i is left else lookahead)
+                    for i in streams
+                    if not i.exhausted
+                ),
+                default=np.inf,
+            )
+            if left is None:
+                rows = [i.consume(watermark) for i in streams]
+                dates = np.unique(np.concatenate([_dates(i) for i in rows]))
+                joined = {"Date": pa.array(dates).cast(schema.field("Date").type)}
+                tolerance = None
+            else:
+                rows = left.consume(watermark)
+                dates = _dates(rows)
+                joined = {i: rows.column(i) for i in rows.column_names}
+                tolerance = self._tolerance
+            for stream in streams:
+                if stream is not left:
+                    lookup = stream.lookup(dates, tolerance)
+                    joined.update({i: lookup.column(i) for i in lookup.column_names})
+            if len(dates):
+                for stream in streams:
+                    if stream is left:
+                        stream.release()
+                    else:
+                        stream.trim(int(dates[-1]), tolerance)
+                chunk = pa.Table.from_arrays(
+                    [joined[i] for i in schema.names], schema=schema
+                )
+                yield chunk, int(dates[-1])
+            if watermark == np.inf:
+                return
+
+    def read_chunks(self, data: Path) -> Iterator[pa.Table]:
+        """The read_chunks method reads the CAN messages of a .json or .parquet
+        file in chunks and converts each chunk like the can_to_table method
+
+        Args:
+            data: Path to the .json or .parquet file with the CAN messages.
+
+        Yields:
+            Pyarrow tables created from the chunks of CAN messages.
+        """
+        try:
+            if data.suffix == ".parquet":
+                batches = ParquetFile(data).iter_batches()
+            else:
+                batches = open_json(data)
+            for batch in batches:
+                tb = self._add_date(pa.Table.from_batches([batch]))
+                yield Table._cast_columns(tb.drop("Timestamp"))
+        except ArrowInvalid as e:
+            recho(f"Input data are not valid, because of '{e}'")
+            sys.exit(1)
+
+    def _last_date(self, data: Path) -> int | None:
+        """Returns the date (in microseconds) of the last CAN message of a
+        file, which is used to show the progress of the join
+
+        Args:
+            data: Path to the .json or .parquet file with the CAN messages.
+
+        Returns:
+            Date of the last CAN message or None if it can not be determined
+        """
+        try:
+            if data.suffix == ".parquet":
+                metadata = ParquetFile(data).metadata
+                index = metadata.schema.names.index("Timestamp")
+                statistics = metadata.row_group(
+                    metadata.num_row_groups - 1
+                ).column(index).statistics
+                timestamp = statistics.max
+            else:
+                with open(data, "rb") as f:
+                    f.seek(max(data.stat().st_size - 4096, 0))
+                    line = f.read().strip().splitlines()[-1]
+                timestamp = json.loads(line)["Timestamp"]
+            start = self._start_date.cast(pa.int64()).as_py()
+            return start + int(timestamp * self._timestamp_factor)
+        except (AttributeError, IndexError, KeyError, TypeError, ValueError):
+            return None
+
     def can_to_table(self, data: Path) -> pa.Table:
         """The can_to_table method converts CAN messages stored as json object
-        to a pyarrow table
+        (or as parquet file by the columnar decoding) to a pyarrow table
 
         Args:
-            data: Path to the .json file with the CAN messages.
+            data: Path to the .json or .parquet file with the CAN messages.
 
         Returns:
             Pyarrow table created from the CAN messages.
         """
         try:
-            tb = read_json(data)
+            tb = read_table(data) if data.suffix == ".parquet" else read_json(data)
             tb = self._add_date(tb)
             # Column Timestamp has to be dropped otherwise asof_join will raise
             # an exception that both tables contain a Timestamp column
@@ -0,0 +1,282 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+"""Decodes the kernel trace snapshots of the trace module"""
+
+import struct
+from dataclasses import dataclass, field
+from enum import IntEnum
+
+from ...helpers.logger import logger
+
+#: first four bytes of a serialized snapshot (see 'TRC_SNAPSHOT_MAGIC')
+SNAPSHOT_MAGIC = b"FTRC"
+#: supported version of the serialization format
+#: (see 'TRC_SNAPSHOT_FORMAT_VERSION')
+SNAPSHOT_FORMAT_VERSION = 1
+#: number of characters of a task name (see 'TRC_TASK_NAME_LENGTH')
+TASK_NAME_LENGTH = 14
+#: big-endian layout of the snapshot header: magic, format version, freeze
+#: reason, number of tasks, number of events, timestamp frequency and freeze
+#: argument
+HEADER_FORMAT = ">4sBBHIII"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+#: layout of a task table entry: task number, priority and name
+TASK_FORMAT = f">BB{TASK_NAME_LENGTH}s"
+TASK_SIZE = struct.calcsize(TASK_FORMAT)
+#: layout of an event: timestamp, type, object and argument
+EVENT_FORMAT = ">IBBH"
+EVENT_SIZE = struct.calcsize(EVENT_FORMAT)
+#: object identifier of a queue that is not known to the recorder
+UNKNOWN_OBJECT = 0xFF
+#: label of the time that is spent in interrupt service routines
+ISR_LABEL = "ISRs"
+
+
+class EventType(IntEnum):
+    """Event types (see 'TRC_EVENT_TYPE_e')"""
+
+    TASK_SWITCHED_IN = 0
+    TASK_DELAY_UNTIL = 1
+    QUEUE_BLOCK_RECEIVE = 2
+    QUEUE_BLOCK_SEND = 3
+    NOTIFY_BLOCK = 4
+    ISR_ENTER = 5
+    ISR_EXIT = 6
+    OS_CALL = 7
+    FREEZE = 8
+
+
+#: names of the recorded OS wrapper functions (see 'TRC_OS_CALL_e')
+OS_CALLS = (
+    "OS_NotifyFromIsr",
+    "OS_NotifyIndexedFromIsr",
+    "OS_NotifyGive",
+    "OS_NotifyGiveFromIsr",
+    "OS_SendToBackOfQueueFromIsr",
+    "OS_SemaphoreGive",
+    "OS_SemaphoreGiveFromIsr",
+)
+
+#: freeze reasons (see 'TRC_FREEZE_REASON_e')
+FREEZE_REASONS = ("none", "request", "fatal error")
+
+
+@dataclass
+class TraceTask:
+    """A task of the task table"""
+
+    number: int
+    priority: int
+    name: str
+
+
+@dataclass
+class TraceEvent:
+    """A recorded event"""
+
+    timestamp: int
+    type: int
+    object: int
+    argument: int
+
+
+@dataclass
+class TraceSnapshot:
+    """A decoded snapshot"""
+
+    freeze_reason: int
+    freeze_argument: int
+    timestamp_frequency: int
+    tasks: dict[int, TraceTask] = field(default_factory=dict)
+    events: list[TraceEvent] = field(default_factory=list)
+
+    def task_name(self, number: int) -> str:
+        """Returns the name of the task with the given task number"""
+        if number in self.tasks:
+            return self.tasks[number].name
+        return f"task {number}"
+
+    def to_microseconds(self, ticks: int) -> float:
+        """Converts a difference of cycle counter values to microseconds"""
+        return ticks * 1e6 / self.timestamp_frequency
+
+    def describe(self, event: TraceEvent) -> str:
+        """Returns a human-readable description of the event"""
+        name = self.task_name(event.object)
+        queue = f"queue {event.argument}"
+        if event.argument == UNKNOWN_OBJECT:
+            queue = "unknown queue"
+        if event.type == EventType.TASK_SWITCHED_IN:
+            return f"switched in: {name}"
+        if event.type == EventType.TASK_DELAY_UNTIL:
+            return f"{name} delays until tick {event.argument} (lower 16 bit)"
+        if event.type == EventType.QUEUE_BLOCK_RECEIVE:
+            return f"{name} blocks on receive from {queue}"
+        if event.type == EventType.QUEUE_BLOCK_SEND:
+            return f"{name} blocks on send to {queue}"
+        if event.type == EventType.NOTIFY_BLOCK:
+            return f"{name} waits for notification {event.argument}"
+        if event.type == EventType.ISR_ENTER:
+            return f"enter ISR {event.object}"
+        if event.type == EventType.ISR_EXIT:
+            return f"exit ISR {event.object}"
+        if event.type == EventType.OS_CALL:
+            return f"{_lookup(OS_CALLS, event.object)} returned {event.argument}"
+        if event.type == EventType.FREEZE:
+            reason = _lookup(FREEZE_REASONS, event.object)
+            return f"frozen ({reason}, argument {event.argument})"
+        return f"unknown event {event.type} ({event.object}, {event.argument})"
+
+    def cpu_load(self) -> dict[str, float]:
+        """Calculates the share of the recorded time spent in each task.
+
+        The time between two task switches is accounted to the task that has
+        been switched in, except for the time spent in interrupt service
+        routines, which is accounted separately. The time before the first
+        task switch is not accounted, as the running task is not known.
+
+        Returns:
+            Share of the recorded time in percent, by task name
+        """
+        durations: dict[str, int] = {}
+        running: str | None = None
+        in_isr = False
+        last = 0
+        for event in self.events:
+            if running is not None:
+                owner = ISR_LABEL if in_isr else running
+                # the cycle counter wraps around after 2^32 cycles
+                elapsed = (event.timestamp - last) & 0xFFFFFFFF
+                durations[owner] = durations.get(owner, 0) + elapsed
+            if event.type == EventType.TASK_SWITCHED_IN:
+                running = self.task_name(event.object)
+            elif event.type == EventType.ISR_ENTER:
+                in_isr = True
+            elif event.type == EventType.ISR_EXIT:
+                in_isr = False
+            last = event.timestamp
+        total = sum(durations.values())
+        if not total:
+            return {}
+        return {k: 100.0 * v / total for k, v in durations.items()}
+
+
+def _lookup(names: tuple[str, ...], index: int) -> str:
+    """Returns the name at the index or the index if it is unknown"""
+    return names[index] if index < len(names) else str(index)
+
+
+class TraceDecoder:
+    """Finds and decodes the snapshots in a captured UART stream
+
+    Snapshots are sent on the same UART as the log records, therefore all
+    bytes that do not belong to a snapshot are skipped.
+    """
+
+    def __init__(self) -> None:
+        self.skipped_bytes = 0
+        self.incomplete_snapshots = 0
+
+    def decode(self, data: bytes) -> list[TraceSnapshot]:
+        """Decodes all complete snapshots in the data.
+
+        Args:
+            data: captured UART stream
+
+        Returns:
+            List of decoded snapshots
+        """
+        snapshots = []
+        position = 0
+        while (start := data.find(SNAPSHOT_MAGIC, position)) >= 0:
+            self.skipped_bytes += start - position
+            snapshot, size = self._decode_snapshot(data, start)
+            if snapshot is None:
+                self.skipped_bytes += len(SNAPSHOT_MAGIC)
+                position = start + len(SNAPSHOT_MAGIC)
+                continue
+            snapshots.append(snapshot)
+            position = start + size
+        self.skipped_bytes += len(data) - position
+        return snapshots
+
+    def _decode_snapshot(
+        self, data: bytes, start: int
+    ) -> tuple[TraceSnapshot | None, int]:
+        """Decodes the snapshot starting at the given position"""
+        if start + HEADER_SIZE > len(data):
+            self.incomplete_snapshots += 1
+            return None, 0
+        (
+            _,
+            version,
+            reason,
+            number_of_tasks,
+            number_of_events,
+            frequency,
+            argument,
+        ) = struct.unpack_from(HEADER_FORMAT, data, start)
+        if version != SNAPSHOT_FORMAT_VERSION or not frequency:
+            logger.warning("Skipping snapshot with unsupported header at %s", start)
+            return None, 0
+        size = HEADER_SIZE + number_of_tasks * TASK_SIZE + number_of_events * EVENT_SIZE
+        if start + size > len(data):
+            logger.warning("Snapshot at %s is incomplete", start)
+            self.incomplete_snapshots += 1
+            return None, 0
+        snapshot = TraceSnapshot(reason, argument, frequency)
+        position = start + HEADER_SIZE
+        for _ in range(number_of_tasks):
+            number, priority, name = struct.unpack_from(TASK_FORMAT, data, position)
+            name = name.split(b"\0", 1)[0].decode("ascii", errors="replace")
+            snapshot.tasks[number] = TraceTask(number, priority, name)
+            position += TASK_SIZE
+        for _ in range(number_of_events):
+            snapshot.events.append(
+                TraceEvent(*struct.unpack_from(EVENT_FORMAT, data, position))
+            )
+            position += EVENT_SIZE
+        return snapshot, size
+
+    def __str__(self) -> str:
+        """Returns a summary of the decoded stream"""
+        return (
+            f"skipped bytes: {self.skipped_bytes}, "
+            f"incomplete snapshots: {self.incomplete_snapshots}"
+        )
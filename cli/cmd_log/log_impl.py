@@ -53,6 +53,7 @@ from time import sleep, time
 from can import Bus, CanInitializationError, CanOperationError, Message
 from can.io import SizedRotatingLogger
 
+from ..helpers.can_log import FILE_SUFFIX, SizedRotatingCANLogWriter
 from ..helpers.click_helpers import recho, secho
 from ..helpers.fcan import CanBusConfig
 
@@ -117,7 +118,7 @@ def receive_can_message(
 def log_can_message(
     data_q: Queue[Message],  # pylint: disable=unsubscriptable-object
     network_ok: synchronize.Event,
-    logger: SizedRotatingLogger,
+    logger: SizedRotatingLogger | SizedRotatingCANLogWriter,
 ) -> None:
     """Logs the CAN message to a file."""
     first_timestamp: float = 0
@@ -143,8 +144,17 @@ def log_can_message(
         logger.stop()
 
 
-def log(bus_cfg: CanBusConfig, output: Path, log_file_size: int = 200000) -> int:
-    """Logs received CAN messages to file(s)."""
+def log(
+    bus_cfg: CanBusConfig,
+    output: Path,
+    log_file_size: int = 200000,
+    file_format: str = "text",
+) -> int:
+    """Logs received CAN messages to file(s).
+
+    The log files are either text files ('file_format="text"') or binary,
+    indexed CAN logs ('file_format="binary"').
+    """
     network_ok = Event()
     # pylint is not correct
     # pylint: disable-next=unsubscriptable-object
@@ -166,13 +176,20 @@ def log(bus_cfg: CanBusConfig, output: Path, log_file_size: int = 200000) -> int
 
     output.mkdir(parents=True, exist_ok=True)
 
+    logger: SizedRotatingLogger | SizedRotatingCANLogWriter
     try:
-        logger = SizedRotatingLogger(
-            base_filename=output / Path("foxBMS_CAN_log.txt"),
-            max_bytes=log_file_size,
-            encoding="utf-8",
-            rollover_count=0,
-        )
+        if file_format == "binary":
+            logger = SizedRotatingCANLogWriter(
+                base_filename=output / Path(f"foxBMS_CAN_log{FILE_SUFFIX}"),
+                max_bytes=log_file_size,
+            )
+        else:
+            logger = SizedRotatingLogger(
+                base_filename=output / Path("foxBMS_CAN_log.txt"),
+                max_bytes=log_file_size,
+                encoding="utf-8",
+                rollover_count=0,
+            )
     except ValueError:
         recho("Could not create logger object.")
         network_ok.clear()
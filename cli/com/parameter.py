@@ -110,6 +110,36 @@ class MQTTParameter:
     password: str | None = None
 
 
+@dataclass(slots=True, frozen=True)
+class TelemetryParameter:
+    """Data class for the UDP telemetry stream of the BMS.
+
+    Attributes:
+        host (str): IP address of the BMS.
+        port (int): UDP port of the telemetry server. Defaults to 5005.
+        subscriptions (dict[str, int]): Streams to subscribe to, mapped to the
+            transmission period in ms (0: transmit on every update).
+        keep_alive (float): Interval in seconds in which the subscriptions are
+            renewed. Must be shorter than the subscription timeout of the BMS.
+    """
+
+    host: str
+    port: int = 5005
+    subscriptions: dict[str, int] = field(default_factory=lambda: {"pack_values": 100})
+    keep_alive: float = 1.0
+
+    def __post_init__(self) -> None:
+        """Ensures that only known streams and valid periods are requested."""
+        streams = ("cell_voltage", "cell_temperature", "pack_values")
+        for stream, period_ms in self.subscriptions.items():
+            if stream not in streams:
+                err_msg = f"Unknown telemetry stream '{stream}'."
+                raise ValueError(err_msg)
+            if not 0 <= period_ms <= 0xFFFF:
+                err_msg = f"Invalid period {period_ms} ms for stream '{stream}'."
+                raise ValueError(err_msg)
+
+
 @dataclass
 class CANLoggerParameter:
     """Data class for CAN logger configuration parameters.
@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Implements a receiver for the UDP telemetry stream of the BMS.
+
+The BMS streams snapshots of database entries to one subscribed client. A
+client subscribes to a stream with a four byte request (command, stream,
+period in ms) and has to renew the subscription periodically, otherwise the
+BMS stops streaming. See 'src/app/application/ethernet/ethernet_telemetry.h'
+for the description of the protocol.
+"""
+
+import signal
+import socket
+import struct
+from time import monotonic
+
+from ..helpers.logger import add_queue_handler, logger
+from .com_interface import ComInterface, ProcessInterface
+from .parameter import ComControl, TelemetryParameter
+
+SYNC_BYTE = 0x5A
+PROTOCOL_VERSION = 1
+COMMAND_SUBSCRIBE = 1
+COMMAND_UNSUBSCRIBE = 2
+STREAMS = {"cell_voltage": 0, "cell_temperature": 1, "pack_values": 2}
+PACK_VALUE_NAMES = (
+    "pack_current_mA",
+    "battery_voltage_mV",
+    "high_voltage_bus_voltage_mV",
+    "pack_power_W",
+)
+REQUEST_FORMAT = ">BBH"
+RECORD_HEADER_FORMAT = ">BBBBHHI"
+RECORD_HEADER_LENGTH = struct.calcsize(RECORD_HEADER_FORMAT)
+VALUE_FORMATS = {2: "h", 4: "i"}
+# maximum size of an UDP datagram
+RECEIVE_BUFFER_SIZE = 65535
+
+
+def encode_request(command: int, stream: str, period_ms: int) -> bytes:
+    """Encodes a telemetry request.
+
+    Args:
+        command: COMMAND_SUBSCRIBE or COMMAND_UNSUBSCRIBE
+        stream: name of the stream (see STREAMS)
+        period_ms: transmission period in ms, 0 transmits on every update
+
+    Returns:
+        The request as it is sent to the BMS.
+    """
+    return struct.pack(REQUEST_FORMAT, command, STREAMS[stream], period_ms)
+
+
+def decode_record(data: bytes) -> dict:
+    """Decodes a telemetry record.
+
+    Invalid values are transmitted as minimum value of the respective type
+    and are decoded as None.
+
+    Args:
+        data: the received datagram
+
+    Returns:
+        The record with the keys 'stream', 'sequence', 'timestamp' and
+        'values'. Pack values are returned as dictionary with the value names
+        as keys.
+
+    Raises:
+        ValueError: If the datagram is no valid telemetry record.
+    """
+    if len(data) < RECORD_HEADER_LENGTH:
+        err_msg = f"Record is too short ({len(data)} bytes)."
+        raise ValueError(err_msg)
+    sync, version, stream_id, value_size, sequence, count, timestamp = (
+        struct.unpack_from(RECORD_HEADER_FORMAT, data)
+    )
+    if sync != SYNC_BYTE or version != PROTOCOL_VERSION:
+        err_msg = f"Unknown record (sync: 0x{sync:02X}, version: {version})."
+        raise ValueError(err_msg)
+    streams = {v: k for k, v in STREAMS.items()}
+    if stream_id not in streams or value_size not in VALUE_FORMATS:
+        err_msg = f"Unknown stream {stream_id} with value size {value_size}."
+        raise ValueError(err_msg)
+    if len(data) != RECORD_HEADER_LENGTH + count * value_size:
+        err_msg = f"Record length {len(data)} does not match {count} values."
+        raise ValueError(err_msg)
+    invalid = -(1 << (8 * value_size - 1))
+    values: list[int | None] = [
+        None if x == invalid else x
+        for x in struct.unpack_from(
+            f">{count}{VALUE_FORMATS[value_size]}", data, RECORD_HEADER_LENGTH
+        )
+    ]
+    record: dict = {
+        "stream": streams[stream_id],
+        "sequence": sequence,
+        "timestamp": timestamp,
+        "values": values,
+    }
+    if record["stream"] == "pack_values":
+        record["values"] = dict(zip(PACK_VALUE_NAMES, values, strict=False))
+    return record
+
+
+class Telemetry(ComInterface):
+    """Communication interface for receiving the telemetry stream of the BMS.
+    Initializes and manages a background process for the UDP communication.
+    """
+
+    def __init__(self, name: str, parameter: TelemetryParameter) -> None:
+        """Initializes the telemetry communication interface.
+
+        Args:
+            name (str): The name of the interface.
+            parameter (TelemetryParameter): Configuration parameters for the
+                telemetry stream.
+        """
+        super().__init__(name=name)
+        self._processes[TelemetryProcess.__name__] = TelemetryProcess(
+            name, self.control, parameter
+        )
+
+    def read(self, block: bool = False, timeout: float | None = None) -> dict | None:
+        """Reads a decoded telemetry record from the output queue.
+
+        Args:
+            block (bool): Whether to block if the queue is empty.
+            timeout (float | None): Timeout for blocking (in seconds).
+
+        Returns:
+            dict | None: The decoded record if available, otherwise None.
+        """
+        # If the related process is not alive and the queue is empty, reading would block.
+        if self.control.output.empty() and not self.is_alive():
+            debug_text = (
+                "Input queue can not be read, because related process is not running."
+            )
+            logger.debug(debug_text)
+            return None
+        return self.control.output.get(block=block, timeout=timeout)
+
+
+class TelemetryProcess(ProcessInterface):
+    """Background process that subscribes to the telemetry streams, renews the
+    subscriptions and decodes the received records.
+    """
+
+    def __init__(
+        self, name: str, control: ComControl, parameter: TelemetryParameter
+    ) -> None:
+        """Initializes the telemetry process.
+
+        Args:
+            name (str): Process name.
+            control (ComControl): Communication control object.
+            parameter (TelemetryParameter): Telemetry configuration parameters.
+        """
+        super().__init__(name=name, daemon=True)
+        self.name = name
+        self.control = control
+        self.parameter = parameter
+        self._socket: socket.socket | None = None
+        self._last_sequence: dict[str, int] = {}
+
+    def run(self) -> None:
+        """Opens the UDP socket and starts receiving records."""
+        signal.signal(signal.SIGINT, signal.SIG_IGN)
+        add_queue_handler(self.control.logger)
+        logger.setLevel(self.control.log_level)
+        # The socket must be created here (not in __init__), as sockets can
+        # not be pickled.
+        self._socket = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self._socket.settimeout(0.1)
+        self.control.ready.set()
+        try:
+            self._receive()
+        except OSError as e:
+            logger.error("Telemetry connection failed: %s", e)
+        finally:
+            self._unsubscribe()
+            self._socket.close()
+        self.shutdown()
+
+    def _send_requests(self, command: int) -> None:
+        """Sends a request for every configured stream.
+
+        Args:
+            command: COMMAND_SUBSCRIBE or COMMAND_UNSUBSCRIBE
+        """
+        if self._socket is None:
+            error_text = "Socket has not yet been created."
+            raise TypeError(error_text)
+        for stream, period_ms in self.parameter.subscriptions.items():
+            self._socket.sendto(
+                encode_request(command, stream, period_ms),
+                (self.parameter.host, self.parameter.port),
+            )
+
+    def _unsubscribe(self) -> None:
+        """Unsubscribes from all streams, errors are ignored at this point."""
+        try:
+            self._send_requests(COMMAND_UNSUBSCRIBE)
+        except (OSError, TypeError):
+            logger.debug("Streams could not be unsubscribed.")
+
+    def _receive(self) -> None:
+        """Renews the subscriptions and puts the decoded records on the output
+        queue until the process is shut down.
+        """
+        if self._socket is None:
+            error_text = "Socket has not yet been created."
+            raise TypeError(error_text)
+        next_request = monotonic()
+        while not self.control.shutdown.is_set():
+            if monotonic() >= next_request:
+                self._send_requests(COMMAND_SUBSCRIBE)
+                next_request = monotonic() + self.parameter.keep_alive
+            try:
+                data, address = self._socket.recvfrom(RECEIVE_BUFFER_SIZE)
+            except TimeoutError:
+                continue
+            if address[0] != self.parameter.host:
+                logger.debug("Ignored datagram from %s.", address[0])
+                continue
+            try:
+                record = decode_record(data)
+            except ValueError as e:
+                logger.warning("Invalid telemetry record: %s", e)
+                continue
+            self._check_sequence(record)
+            self.control.output.put(record)
+
+    def _check_sequence(self, record: dict) -> None:
+        """Logs records that have been lost in transmission.
+
+        Args:
+            record: the decoded record
+        """
+        stream = record["stream"]
+        if stream in self._last_sequence:
+            lost = (record["sequence"] - self._last_sequence[stream] - 1) & 0xFFFF
+            if lost:
+                logger.warning("Lost %s record(s) of stream '%s'.", lost, stream)
+        self._last_sequence[stream] = record["sequence"]
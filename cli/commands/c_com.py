@@ -37,7 +37,7 @@
 # - "This product includes parts of foxBMS®"
 # - "This product is derived from foxBMS®"
 
-"""Click commands for communication test utilities (CAN, Modbus, MQTT)."""
+"""Click commands for communication test utilities (CAN, Modbus, MQTT, telemetry)."""
 
 from pathlib import Path
 
@@ -49,7 +49,7 @@ from pymodbus.datastore import (
 )
 from pymodbus.server import StartTcpServer
 
-from ..cmd_com.com_impl import can_main, modbus_main, mqtt_main
+from ..cmd_com.com_impl import can_main, modbus_main, mqtt_main, telemetry_main
 from ..helpers import TOOL
 from ..helpers.click_helpers import HELP_NAMES, secho, verbosity_option
 
@@ -313,6 +313,53 @@ def mqtt(
     ctx.exit(0)
 
 
+@click.command(
+    context_settings=HELP_NAMES,
+    epilog="""
+    Examples:
+
+    As config should be passed a yaml file defining the address of the BMS and
+    the streams to subscribe to with their transmission period in ms (0:
+    transmit on every database update) as the example below:
+
+        \b
+        host: "169.254.107.24"
+        port: 5005
+        subscriptions:
+          cell_voltage: 0
+          pack_values: 100
+
+    The output file will contain the received records in a line deliminated
+    json object format.""",
+)
+@click.option(
+    "-c",
+    "--config",
+    type=click.Path(exists=True, file_okay=True, dir_okay=False, path_type=Path),
+    required=True,
+    help="Path to configuration yaml file",
+)
+@click.option(
+    "-o",
+    "--output",
+    "output_file",
+    type=click.Path(exists=False, file_okay=True, dir_okay=False, path_type=Path),
+    required=True,
+    help="Path to the output file",
+)
+@verbosity_option
+@click.pass_context
+def telemetry(
+    ctx: click.Context,
+    config: Path,
+    output_file: Path,
+    verbose: int,
+) -> None:
+    """Receive the UDP telemetry stream of the BMS."""
+    telemetry_main(config, output_file)
+    ctx.exit(0)
+
+
 @click.group(context_settings=HELP_NAMES)
 def com_test() -> None:
     """Communication command group entry point.
@@ -324,3 +371,4 @@ def com_test() -> None:
 com_test.add_command(can)
 com_test.add_command(modbus)
 com_test.add_command(mqtt)
+com_test.add_command(telemetry)
@@ -47,11 +47,15 @@ from ..cmd_etl.cmds import get_config_file_options
 from ..cmd_etl.cmds.can_decode_helper import (
     can_decode_setup,
     run_decode2file,
+    run_decode2parquet,
     run_decode2stdout,
 )
 from ..cmd_etl.cmds.can_filter_helper import can_filter_setup, run_filter
+from ..cmd_etl.cmds.can_log_convert_helper import run_can_log_convert
 from ..cmd_etl.cmds.convert_helper import converter_setup, run_converter
+from ..cmd_etl.cmds.log_decode_helper import log_decode_setup, run_log_decode
 from ..cmd_etl.cmds.table_helper import run_table, table_setup
+from ..cmd_etl.cmds.trace_decode_helper import run_trace_decode
 from ..cmd_etl.etl.convert import InputFormats, OutputFormats
 from ..helpers.click_helpers import HELP_NAMES, echo, verbosity_option
 
@@ -207,6 +211,18 @@ cmd_convert.add_command(cmd_convert_graphtec)
     type=click.Tuple([str, int]),
     multiple=True,
 )
+@click.option(
+    "--start",
+    type=float,
+    default=None,
+    help="First timestamp to be kept (binary CAN logs only)",
+)
+@click.option(
+    "--stop",
+    type=float,
+    default=None,
+    help="Timestamp up to which messages are kept, exclusive (binary CAN logs only)",
+)
 @verbosity_option
 @click.pass_context
 def cmd_filter(  # pylint: disable=too-many-arguments,too-many-positional-arguments
@@ -217,12 +233,16 @@ def cmd_filter(  # pylint: disable=too-many-arguments,too-many-positional-argume
     id_pos: int = -1,
     ids: list[str] | None = None,
     sampling: list[tuple[str, int]] | None = None,
+    start: float | None = None,
+    stop: float | None = None,
     verbose: int = 0,
 ) -> None:
     """Filter out unwanted CAN messages from input stream or file.
 
     The subcommand writes the filtered CAN messages to standard output or to a
-    file.
+    file. Binary CAN logs ('.fcl') are filtered through their index; the
+    output is written as binary CAN log if the output file has the '.fcl'
+    suffix and as text otherwise.
     """
     if not ids:
         ids = []
@@ -234,6 +254,8 @@ def cmd_filter(  # pylint: disable=too-many-arguments,too-many-positional-argume
         "id_pos": id_pos,
         "ids": list(ids),
         "sampling": dict(sampling),
+        "start": start,
+        "stop": stop,
     }
     # we need to catch th case that no argument has been provided, i.e., there
     # is no configuration file and no options have been provided on the
@@ -244,6 +266,8 @@ def cmd_filter(  # pylint: disable=too-many-arguments,too-many-positional-argume
         "sampling": {},
         "_input": None,
         "output": None,
+        "start": None,
+        "stop": None,
     }:
         echo(ctx.get_help())
         ctx.exit(0)
@@ -297,6 +321,44 @@ def cmd_filter(  # pylint: disable=too-many-arguments,too-many-positional-argume
     required=False,
     help="Directory in which the files with decoded CAN messages are saved",
 )
+@click.option(
+    "-i",
+    "--input",
+    "_input",
+    type=click.Path(exists=True, file_okay=True, dir_okay=True, path_type=Path),
+    default=None,
+    help="CAN log (text or binary '.fcl') to be decoded; otherwise stdin is used. "
+    "Directories of CAN logs require the output format 'parquet'",
+)
+@click.option(
+    "--start",
+    type=float,
+    default=None,
+    help="First timestamp to be decoded (binary CAN logs only)",
+)
+@click.option(
+    "--stop",
+    type=float,
+    default=None,
+    help="Timestamp up to which messages are decoded, exclusive (binary CAN logs "
+    "only)",
+)
+@click.option(
+    "-f",
+    "--output-format",
+    type=click.Choice(["json", "parquet"], case_sensitive=False),
+    default="json",
+    help="json: one JSON object per message; parquet: columnar decoding to one "
+    "parquet file per message",
+)
+@click.option(
+    "-j",
+    "--jobs",
+    type=click.IntRange(min=1),
+    default=1,
+    help="Number of processes for the parquet output format (one CAN log per "
+    "process)",
+)
 @verbosity_option
 @click.pass_context
 # pylint: disable-next=too-many-arguments,too-many-positional-arguments
@@ -308,12 +370,21 @@ def cmd_decode(
     id_pos: int = -1,
     data_pos: int = -1,
     output: Path | None = None,
+    _input: Path | None = None,
+    start: float | None = None,
+    stop: float | None = None,
+    output_format: str = "json",
+    jobs: int = 1,
     verbose: int = 0,
 ) -> None:
-    """Decode CAN messages from standard input.
+    """Decode CAN messages from standard input or a CAN log.
 
     Decoded CAN messages are saved in separate files (JSON) in the output
-    directory.
+    directory. For binary CAN logs ('.fcl') only the messages defined in the
+    DBC file are read, using the index of the log.
+
+    With the output format 'parquet' the CAN logs are decoded column-wise per
+    CAN ID and each message is saved as parquet file in the output directory.
     """
     config = {
         "dbc": dbc,
@@ -321,6 +392,9 @@ def cmd_decode(
         "id_pos": id_pos,
         "data_pos": data_pos,
         "output": output,
+        "_input": _input,
+        "start": start,
+        "stop": stop,
     }
     # we need to catch th case that no argument has been provided, i.e., there
     # is not configuration file and no options have been provided on the
@@ -334,13 +408,108 @@ def cmd_decode(
         echo(ctx.get_help())
         ctx.exit(0)
     decode_obj = can_decode_setup(config)
-    if output:
+    if output_format.lower() == "parquet":
+        run_decode2parquet(decode_obj, jobs)
+    elif output:
         run_decode2file(decode_obj)
     else:
         run_decode2stdout(decode_obj)
     ctx.exit(0)
 
 
+@click.command("decode-log")
+@click.argument(
+    "_input",
+    metavar="INPUT",
+    type=click.Path(exists=True, file_okay=True, dir_okay=False, path_type=Path),
+)
+@click.option(
+    "-c",
+    "--cfg-dir",
+    type=click.Path(exists=True, file_okay=False, dir_okay=True, path_type=Path),
+    default=None,
+    help="Directory containing 'log_cfg.h' and 'log_cfg.c' of the firmware",
+)
+@click.option(
+    "-o",
+    "--output",
+    required=False,
+    type=click.Path(file_okay=True, dir_okay=False, path_type=Path, exists=False),
+    default=None,
+    help="Stores the decoded log to a file; otherwise stdout is used",
+)
+@verbosity_option
+@click.pass_context
+def cmd_decode_log(
+    ctx: click.Context,
+    _input: Path,
+    cfg_dir: Path | None = None,
+    output: Path | None = None,
+    verbose: int = 0,
+) -> None:
+    """Decode binary log records received from the BMS via UART.
+
+    The message formats are read from the log configuration of the firmware.
+    """
+    decoder = log_decode_setup(cfg_dir)
+    run_log_decode(decoder, _input, output)
+    ctx.exit(0)
+
+
+@click.command("decode-trace")
+@click.argument(
+    "_input",
+    metavar="INPUT",
+    type=click.Path(exists=True, file_okay=True, dir_okay=False, path_type=Path),
+)
+@click.option(
+    "-o",
+    "--output",
+    required=False,
+    type=click.Path(file_okay=True, dir_okay=False, path_type=Path, exists=False),
+    default=None,
+    help="Stores the decoded trace to a file; otherwise stdout is used",
+)
+@verbosity_option
+@click.pass_context
+def cmd_decode_trace(
+    ctx: click.Context,
+    _input: Path,
+    output: Path | None = None,
+    verbose: int = 0,
+) -> None:
+    """Decode kernel trace snapshots received from the BMS via UART.
+
+    Prints the timeline of each snapshot and the CPU load per task.
+    """
+    run_trace_decode(_input, output)
+    ctx.exit(0)
+
+
+@click.command("convert-can-log")
+@click.argument(
+    "_input",
+    metavar="INPUT",
+    type=click.Path(exists=True, file_okay=True, dir_okay=False, path_type=Path),
+)
+@click.argument(
+    "output",
+    type=click.Path(exists=False, file_okay=True, dir_okay=False, path_type=Path),
+)
+@verbosity_option
+@click.pass_context
+def cmd_convert_can_log(
+    ctx: click.Context, _input: Path, output: Path, verbose: int = 0
+) -> None:
+    """Convert CAN logs between the text and the binary ('.fcl') format.
+
+    Binary CAN logs are converted to text and text CAN logs (as written by
+    'fox log') are converted to binary CAN logs.
+    """
+    run_can_log_convert(_input, output)
+    ctx.exit(0)
+
+
 @click.command("table")
 @click.argument(
     "data",
@@ -396,5 +565,8 @@ def etl() -> None:
 
 etl.add_command(cmd_filter)
 etl.add_command(cmd_decode)
+etl.add_command(cmd_decode_log)
+etl.add_command(cmd_decode_trace)
+etl.add_command(cmd_convert_can_log)
 etl.add_command(cmd_table)
 etl.add_command(cmd_convert)
@@ -60,6 +60,13 @@ from ..helpers.misc import PROJECT_BUILD_ROOT
 @click.option(
     "-s", "--log-file-size", type=int, default=200000, help="Size of a log file."
 )
+@click.option(
+    "-f",
+    "--file-format",
+    type=click.Choice(["text", "binary"], case_sensitive=False),
+    default="text",
+    help="Format of the log files (binary: indexed '.fcl' files).",
+)
 @common_can_options
 @verbosity_option
 @click.pass_context
@@ -67,6 +74,7 @@ def log(
     ctx: click.Context,
     output: Path,
     log_file_size: int,
+    file_format: str,
     interface: str,
     channel: str,
     bitrate: str,
@@ -75,4 +83,4 @@ def log(
     """Log CAN traffic to rolling output files."""
     bitrate_int = int(bitrate)  # this is guaranteed to work due to the choice list
     bus_cfg = CanBusConfig(interface=interface, channel=channel, bitrate=bitrate_int)
-    ctx.exit(log_impl.log(bus_cfg, output, log_file_size))
+    ctx.exit(log_impl.log(bus_cfg, output, log_file_size, file_format.lower()))
@@ -0,0 +1,517 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Binary, indexed CAN log format ('.fcl') written by 'fox log' and read by
+'fox etl'.
+
+File layout (all values little endian):
+
+- header (32 bytes): magic ``FOXCANLG``, format version, record size, flags,
+  reserved, number of records and the offset of the index section.
+- records (24 bytes each): timestamp (float64), arbitration id (uint32),
+  DLC (uint8), frame flags (uint8), reserved (uint16) and 8 data bytes.
+- index section: number of ids and time index stride, an id table
+  (id, number of records, offset of the posting list), the posting lists
+  (record numbers per id, ascending) and a coarse time index (the timestamp
+  of every stride-th record).
+
+The index is written when the writer is stopped. Files without an index
+(e.g., the logger was killed) are still readable; the reader then builds the
+index in memory.
+"""
+
+import mmap
+import re
+import struct
+from collections.abc import Iterator
+from datetime import UTC, datetime
+from enum import IntFlag
+from pathlib import Path
+from types import TracebackType
+
+import numpy as np
+import numpy.typing as npt
+from can import Listener, Message
+
+MAGIC = b"FOXCANLG"
+VERSION = 1
+FILE_SUFFIX = ".fcl"
+TIME_INDEX_STRIDE = 1024
+HEADER_FLAG_TIME_SORTED = 0x1
+
+HEADER = struct.Struct("<8sHHHHQQ")
+RECORD = struct.Struct("<dIBBH8s")
+INDEX_HEADER = struct.Struct("<II")
+
+RECORD_DTYPE = np.dtype(
+    [
+        ("timestamp", "<f8"),
+        ("arbitration_id", "<u4"),
+        ("dlc", "u1"),
+        ("flags", "u1"),
+        ("reserved", "<u2"),
+        ("data", "u1", (8,)),
+    ]
+)
+ID_TABLE_DTYPE = np.dtype(
+    [("arbitration_id", "<u4"), ("count", "<u4"), ("offset", "<u8")]
+)
+
+# one line of the text log as written by 'can.Printer', i.e., 'str(Message)'
+TEXT_LINE = re.compile(
+    r"^\s*Timestamp:\s*(?P<timestamp>\S+)\s+ID:\s*(?P<id>[0-9a-fA-F]+)\s+"
+    r"(?P<flags>.*?)\s*DL:\s*(?P<dlc>\d+)(?P<data>.*)$"
+)
+HEX_BYTE = re.compile(r"^[0-9a-fA-F]{2}$")
+
+
+class FrameFlags(IntFlag):
+    """Frame flags stored per record"""
+
+    EXTENDED = 0x1
+    REMOTE = 0x2
+    ERROR = 0x4
+    RX = 0x8
+
+
+def is_can_log(file: Path) -> bool:
+    """Checks whether a file is a binary CAN log.
+
+    Args:
+        file: file to be checked
+
+    Returns:
+        True if the file starts with the binary CAN log magic
+    """
+    try:
+        with open(file, "rb") as f:
+            return f.read(len(MAGIC)) == MAGIC
+    except OSError:
+        return False
+
+
+def has_can_log_suffix(file: Path | None) -> bool:
+    """Checks whether a path names a binary CAN log, i.e., whether it has the
+    binary CAN log suffix."""
+    return isinstance(file, Path) and file.suffix == FILE_SUFFIX
+
+
+class CANLogWriter(Listener):
+    """Writes CAN messages to a binary CAN log.
+
+    Only classic CAN frames are supported; data beyond 8 bytes is truncated.
+
+    Args:
+        file: path of the log file
+    """
+
+    def __init__(self, file: Path) -> None:
+        self.file = file
+        # handle is closed in 'stop'
+        # pylint: disable-next=consider-using-with
+        self._f = open(file, "wb")  # noqa: SIM115
+        self._f.write(HEADER.pack(MAGIC, VERSION, RECORD.size, 0, 0, 0, 0))
+        self._postings: dict[int, list[int]] = {}
+        self._time_index: list[float] = []
+        self._count = 0
+        self._last_timestamp = float("-inf")
+        self._time_sorted = True
+
+    def on_message_received(self, msg: Message) -> None:
+        """Appends one CAN message to the log."""
+        flags = FrameFlags(0)
+        if msg.is_extended_id:
+            flags |= FrameFlags.EXTENDED
+        if msg.is_remote_frame:
+            flags |= FrameFlags.REMOTE
+        if msg.is_error_frame:
+            flags |= FrameFlags.ERROR
+        if msg.is_rx:
+            flags |= FrameFlags.RX
+        data = bytes(msg.data[:8]) if msg.data is not None else b""
+        self._f.write(
+            RECORD.pack(
+                msg.timestamp, msg.arbitration_id, min(msg.dlc, 8), flags, 0, data
+            )
+        )
+        self._postings.setdefault(msg.arbitration_id, []).append(self._count)
+        if not self._count % TIME_INDEX_STRIDE:
+            self._time_index.append(msg.timestamp)
+        if msg.timestamp < self._last_timestamp:
+            self._time_sorted = False
+        self._last_timestamp = msg.timestamp
+        self._count += 1
+
+    def file_size(self) -> int:
+        """Returns the number of bytes written so far."""
+        return self._f.tell()
+
+    def stop(self) -> None:
+        """Writes the index section, updates the header and closes the file."""
+        if self._f.closed:
+            return
+        index_offset = self._f.tell()
+        ids = sorted(self._postings)
+        table = np.zeros(len(ids), dtype=ID_TABLE_DTYPE)
+        offset = index_offset + INDEX_HEADER.size + table.nbytes
+        for i, can_id in enumerate(ids):
+            table[i] = (can_id, len(self._postings[can_id]), offset)
+            offset += len(self._postings[can_id]) * np.dtype("<u4").itemsize
+        self._f.write(INDEX_HEADER.pack(len(ids), TIME_INDEX_STRIDE))
+        self._f.write(table.tobytes())
+        for can_id in ids:
+            self._f.write(np.array(self._postings[can_id], dtype="<u4").tobytes())
+        self._f.write(np.array(self._time_index, dtype="<f8").tobytes())
+        flags = HEADER_FLAG_TIME_SORTED if self._time_sorted else 0
+        self._f.seek(0)
+        self._f.write(
+            HEADER.pack(
+                MAGIC, VERSION, RECORD.size, flags, 0, self._count, index_offset
+            )
+        )
+        self._f.close()
+
+
+class SizedRotatingCANLogWriter(Listener):
+    """Writes CAN messages to binary CAN logs and starts a new file when the
+    current one exceeds a size threshold.
+
+    The naming of the rotated files follows 'can.io.SizedRotatingLogger'.
+
+    Args:
+        base_filename: path of the log file that is currently written
+        max_bytes: size threshold; 0 disables the rollover
+    """
+
+    def __init__(self, base_filename: Path, max_bytes: int = 0) -> None:
+        if max_bytes < 0:
+            msg = "'max_bytes' must not be negative."
+            raise ValueError(msg)
+        self.base_filename = base_filename.absolute()
+        self.max_bytes = max_bytes
+        self.rollover_count = 0
+        self._writer = CANLogWriter(self.base_filename)
+
+    def on_message_received(self, msg: Message) -> None:
+        """Writes one CAN message and rolls over if required."""
+        if self.max_bytes and self._writer.file_size() >= self.max_bytes:
+            self.do_rollover()
+        self._writer(msg)
+
+    def do_rollover(self) -> None:
+        """Closes the current file, renames it and starts a new one."""
+        self._writer.stop()
+        timestamp = datetime.now(tz=UTC).strftime("%Y-%m-%dT%H%M%S")
+        self.base_filename.rename(
+            self.base_filename.parent
+            / f"{self.base_filename.stem}_{timestamp}_#{self.rollover_count:03}"
+            f"{self.base_filename.suffix}"
+        )
+        self.rollover_count += 1
+        self._writer = CANLogWriter(self.base_filename)
+
+    def stop(self) -> None:
+        """Closes the current file."""
+        self._writer.stop()
+
+
+class CANLogReader:
+    """Memory-maps a binary CAN log and selects records by id and time
+    through the index of the file.
+
+    Args:
+        file: path of the log file
+    """
+
+    def __init__(self, file: Path) -> None:
+        self.file = file
+        with open(file, "rb") as f:
+            size = f.seek(0, 2)
+            if size < HEADER.size:
+                msg = f"'{file}' is not a binary CAN log."
+                raise ValueError(msg)
+            self._mmap = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        magic, version, record_size, flags, _, count, index_offset = (
+            HEADER.unpack_from(self._mmap)
+        )
+        if magic != MAGIC:
+            self._mmap.close()
+            msg = f"'{file}' is not a binary CAN log."
+            raise ValueError(msg)
+        if version != VERSION or record_size != RECORD_DTYPE.itemsize:
+            self._mmap.close()
+            msg = f"'{file}' uses an unsupported CAN log version ({version})."
+            raise ValueError(msg)
+        if not index_offset:
+            # the writer was not stopped, recover the records that are complete
+            count = (size - HEADER.size) // RECORD_DTYPE.itemsize
+        self._records = np.frombuffer(
+            self._mmap, dtype=RECORD_DTYPE, count=count, offset=HEADER.size
+        )
+        self._postings: dict[int, npt.NDArray[np.uint32]] = {}
+        if index_offset:
+            self._time_sorted = bool(flags & HEADER_FLAG_TIME_SORTED)
+            self._read_index(index_offset)
+        else:
+            self._build_index()
+
+    def _read_index(self, index_offset: int) -> None:
+        """Maps the index section of the file."""
+        n_ids, self._stride = INDEX_HEADER.unpack_from(self._mmap, index_offset)
+        table = np.frombuffer(
+            self._mmap,
+            dtype=ID_TABLE_DTYPE,
+            count=n_ids,
+            offset=index_offset + INDEX_HEADER.size,
+        )
+        for can_id, count, offset in table:
+            self._postings[int(can_id)] = np.frombuffer(
+                self._mmap, dtype="<u4", count=int(count), offset=int(offset)
+            )
+        end = index_offset + INDEX_HEADER.size + table.nbytes + len(self) * 4
+        self._time_index = np.frombuffer(
+            self._mmap,
+            dtype="<f8",
+            count=-(-len(self) // self._stride),
+            offset=end,
+        )
+
+    def _build_index(self) -> None:
+        """Builds the index in memory for files without an index section."""
+        self._stride = TIME_INDEX_STRIDE
+        ids = self._records["arbitration_id"]
+        order = np.argsort(ids, kind="stable").astype("<u4")
+        unique, starts, counts = np.unique(
+            ids[order], return_index=True, return_counts=True
+        )
+        for can_id, start, count in zip(unique, starts, counts, strict=True):
+            self._postings[int(can_id)] = order[start : start + count]
+        timestamps = self._records["timestamp"]
+        self._time_sorted = bool(np.all(timestamps[1:] >= timestamps[:-1]))
+        self._time_index = timestamps[:: self._stride].copy()
+
+    def __len__(self) -> int:
+        return len(self._records)
+
+    def __enter__(self) -> "CANLogReader":
+        return self
+
+    def __exit__(
+        self,
+        exc_type: type[BaseException] | None,
+        exc_value: BaseException | None,
+        traceback: TracebackType | None,
+    ) -> None:
+        self.close()
+
+    def close(self) -> None:
+        """Releases the memory map."""
+        self._records = np.empty(0, dtype=RECORD_DTYPE)
+        self._postings = {}
+        self._time_index = np.empty(0, dtype="<f8")
+        self._mmap.close()
+
+    @property
+    def ids(self) -> list[int]:
+        """CAN ids contained in the log"""
+        return sorted(self._postings)
+
+    @property
+    def time_sorted(self) -> bool:
+        """True if the timestamps of the records are non-decreasing"""
+        return self._time_sorted
+
+    def _first_at_or_after(self, timestamp: float) -> int:
+        """Returns the number of the first record with a timestamp not less
+        than 'timestamp' (the records must be time sorted)."""
+        block = int(np.searchsorted(self._time_index, timestamp, side="left"))
+        if not block:
+            return 0
+        low = (block - 1) * self._stride
+        high = min(block * self._stride, len(self))
+        timestamps = self._records["timestamp"][low:high]
+        return low + int(np.searchsorted(timestamps, timestamp, side="left"))
+
+    def select(
+        self,
+        ids: list[int] | None = None,
+        start: float | None = None,
+        stop: float | None = None,
+    ) -> npt.NDArray[np.int64]:
+        """Selects records by CAN id and time range.
+
+        Args:
+            ids: CAN ids to be selected; None selects all ids
+            start: first timestamp to be selected (inclusive)
+            stop: last timestamp to be selected (exclusive)
+
+        Returns:
+            Ascending record numbers of the selected records
+        """
+        low, high = 0, len(self)
+        if self._time_sorted:
+            if start is not None:
+                low = self._first_at_or_after(start)
+            if stop is not None:
+                high = self._first_at_or_after(stop)
+        if ids is None:
+            selection = np.arange(low, max(low, high), dtype=np.int64)
+        else:
+            parts = []
+            for can_id in set(ids):
+                if (postings := self._postings.get(can_id)) is None:
+                    continue
+                first, last = np.searchsorted(postings, [low, high], side="left")
+                parts.append(postings[first:last].astype(np.int64))
+            selection = (
+                np.sort(np.concatenate(parts)) if parts else np.empty(0, np.int64)
+            )
+        if not self._time_sorted and (start is not None or stop is not None):
+            timestamps = self._records["timestamp"][selection]
+            mask = np.ones(len(selection), dtype=bool)
+            if start is not None:
+                mask &= timestamps >= start
+            if stop is not None:
+                mask &= timestamps < stop
+            selection = selection[mask]
+        return selection
+
+    def records(
+        self, selection: npt.NDArray[np.int64] | None = None
+    ) -> npt.NDArray[np.void]:
+        """Returns a copy of the (selected) records as structured array."""
+        if selection is None:
+            return self._records.copy()
+        return self._records[selection]
+
+    def messages(
+        self, selection: npt.NDArray[np.int64] | None = None
+    ) -> Iterator[Message]:
+        """Yields the (selected) records as CAN messages."""
+        for record in self.records(selection):
+            yield record_to_message(record)
+
+
+def record_to_message(record: np.void) -> Message:
+    """Converts one record of a binary CAN log to a CAN message."""
+    flags = FrameFlags(int(record["flags"]))
+    dlc = int(record["dlc"])
+    return Message(
+        timestamp=float(record["timestamp"]),
+        arbitration_id=int(record["arbitration_id"]),
+        is_extended_id=FrameFlags.EXTENDED in flags,
+        is_remote_frame=FrameFlags.REMOTE in flags,
+        is_error_frame=FrameFlags.ERROR in flags,
+        is_rx=FrameFlags.RX in flags,
+        dlc=dlc,
+        data=None if FrameFlags.REMOTE in flags else bytes(record["data"][:dlc]),
+    )
+
+
+def parse_text_line(line: str) -> Message | None:
+    """Parses one line of a text CAN log as written by 'fox log'.
+
+    The channel is not part of the binary format and therefore dropped.
+
+    Args:
+        line: one line of the text log
+
+    Returns:
+        The CAN message or None if the line is not a CAN message
+    """
+    if not (match := TEXT_LINE.match(line)):
+        return None
+    flags = match.group("flags").split()
+    dlc = int(match.group("dlc"))
+    data = [
+        i for i in match.group("data").split("Channel:")[0].split() if HEX_BYTE.match(i)
+    ]
+    try:
+        timestamp = float(match.group("timestamp"))
+    except ValueError:
+        return None
+    return Message(
+        timestamp=timestamp,
+        arbitration_id=int(match.group("id"), 16),
+        is_extended_id="X" in flags,
+        is_remote_frame="R" in flags,
+        is_error_frame="E" in flags,
+        is_rx="Rx" in flags,
+        dlc=dlc,
+        data=None if "R" in flags else bytes.fromhex("".join(data[: min(dlc, 8)])),
+    )
+
+
+def text_to_binary(_input: Path, output: Path) -> int:
+    """Converts a text CAN log into a binary CAN log.
+
+    Args:
+        _input: text CAN log
+        output: binary CAN log
+
+    Returns:
+        Number of converted CAN messages
+    """
+    writer = CANLogWriter(output)
+    count = 0
+    try:
+        with open(_input, encoding="utf-8") as f:
+            for line in f:
+                if msg := parse_text_line(line):
+                    writer(msg)
+                    count += 1
+    finally:
+        writer.stop()
+    return count
+
+
+def binary_to_text(_input: Path, output: Path) -> int:
+    """Converts a binary CAN log into a text CAN log as written by 'fox log'.
+
+    Args:
+        _input: binary CAN log
+        output: text CAN log
+
+    Returns:
+        Number of converted CAN messages
+    """
+    with CANLogReader(_input) as reader, open(output, "w", encoding="utf-8") as f:
+        for msg in reader.messages():
+            f.write(f"{msg}\n")
+        return len(reader)
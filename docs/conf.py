@@ -401,6 +401,11 @@ def gen_fox_com_mqtt_help() -> int:
     return _runner("com-test mqtt")
 
 
+def gen_fox_com_telemetry_help() -> int:
+    """Create com-test telemetry usage file."""
+    return _runner("com-test telemetry")
+
+
 def gen_fox_etl_help() -> int:
     """Create etl usage file."""
     return _runner("etl")
@@ -416,6 +421,21 @@ def gen_fox_etl_decode_help() -> int:
     return _runner("etl decode")
 
 
+def gen_fox_etl_decode_log_help() -> int:
+    """Create etl decode-log usage file."""
+    return _runner("etl decode-log")
+
+
+def gen_fox_etl_decode_trace_help() -> int:
+    """Create etl decode-trace usage file."""
+    return _runner("etl decode-trace")
+
+
+def gen_fox_etl_convert_can_log_help() -> int:
+    """Create etl convert-can-log usage file."""
+    return _runner("etl convert-can-log")
+
+
 def gen_fox_etl_table_help() -> int:
     """Create etl table usage file."""
     return _runner("etl table")
@@ -783,9 +803,13 @@ def create_doc_sources(_app: Sphinx, _cfg: Config) -> None:
         gen_fox_cli_embedded_ut_help,
         gen_fox_com_can_help,
         gen_fox_com_mqtt_help,
+        gen_fox_com_telemetry_help,
         gen_fox_etl_help,
         gen_fox_etl_filter_help,
         gen_fox_etl_decode_help,
+        gen_fox_etl_decode_log_help,
+        gen_fox_etl_decode_trace_help,
+        gen_fox_etl_convert_can_log_help,
         gen_fox_etl_table_help,
         gen_fox_etl_convert_help,
         gen_fox_etl_convert_gamry_help,
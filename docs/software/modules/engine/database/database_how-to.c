@@ -43,7 +43,7 @@
  * @file    database_how-to.c
  * @author  foxBMS Team
  * @date    2021-04-12 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup SOME_GROUP
  * @prefix  DATA
@@ -87,9 +87,10 @@ typedef enum {
 
 /** typedef for data block header as defined in database_cfg.h */
 typedef struct {
-    DATA_BLOCK_ID_e uniqueId;   /*!< uniqueId of database entry */
-    uint32_t timestamp;         /*!< timestamp of last database update */
-    uint32_t previousTimestamp; /*!< timestamp of previous database update */
+    DATA_BLOCK_ID_e uniqueId;      /*!< uniqueId of database entry */
+    uint32_t timestamp;            /*!< timestamp of last database update */
+    uint32_t previousTimestamp;    /*!< timestamp of previous database update */
+    uint32_t acquisitionTimestamp; /*!< free running counter value at acquisition start */
 } DATA_BLOCK_HEADER_s;
 
 /* example-data-block-typedef-start */
@@ -162,7 +163,7 @@ static DATA_BLOCK_EXAMPLE_s data_blockExample = {.header.uniqueId = DATA_BLOCK_I
  *          consistency type)
  */
 DATA_BASE_s data_database[] = {
-    {(void *)(&data_blockExample), sizeof(DATA_BLOCK_EXAMPLE_s)},
+    [DATA_BLOCK_ID_EXAMPLE] = {(void *)(&data_blockExample), sizeof(DATA_BLOCK_EXAMPLE_s)},
     /* ...
      * ...
      * ...
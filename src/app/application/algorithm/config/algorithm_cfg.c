@@ -43,7 +43,7 @@
  * @file    algorithm_cfg.c
  * @author  foxBMS Team
  * @date    2017-12-18 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup ALGORITHMS_CONFIGURATION
  * @prefix  ALGO
@@ -55,6 +55,7 @@
 /*========== Includes =======================================================*/
 #include "algorithm_cfg.h"
 
+#include "current_integration.h"
 #include "fassert.h"
 #include "moving_average.h"
 #include "os.h"
@@ -69,6 +70,7 @@
 /** array of algorithms that should be executed */
 ALGO_TASKS_s algo_algorithms[] = {
     {ALGO_UNINITIALIZED, 100, 1000, 0, NULL_PTR, &ALGO_MovingAverage},
+    {ALGO_UNINITIALIZED, 100, 100, 0, &CINT_Initialize, &CINT_Trigger},
 };
 
 const uint16_t algo_length = sizeof(algo_algorithms) / sizeof(algo_algorithms[0]);
@@ -0,0 +1,283 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    current_integration.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ALGORITHMS
+ * @prefix  CINT
+ *
+ * @brief   Software charge and energy integration at current sensor rate
+ * @details The sample buffer is written by exactly one producer (the CAN
+ *          receive path) and read by exactly one consumer (the algorithm
+ *          module). The producer only advances the write index after the
+ *          sample has been completely written and the consumer only advances
+ *          the read index after the sample has been processed, therefore no
+ *          critical section is needed.
+ *          Charge and energy are accumulated in nA.s and nW.s in 64-bit
+ *          integers, so that no resolution is lost when many short intervals
+ *          with small currents are integrated.
+ */
+
+/*========== Includes =======================================================*/
+#include "current_integration.h"
+
+#include "battery_system_cfg.h"
+
+#include "database.h"
+#include "fassert.h"
+#include "fstd_types.h"
+#include "mcu.h"
+#include "os.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+FAS_STATIC_ASSERT(
+    (CINT_SAMPLE_BUFFER_LENGTH & (CINT_SAMPLE_BUFFER_LENGTH - 1u)) == 0u,
+    "CINT_SAMPLE_BUFFER_LENGTH must be a power of two");
+FAS_STATIC_ASSERT(
+    (BS_NR_OF_STRINGS * CINT_SAMPLES_PER_STRING_AND_CYCLE) <= CINT_SAMPLE_BUFFER_LENGTH,
+    "CINT_SAMPLE_BUFFER_LENGTH is too small for the samples of all strings in one cycle");
+
+/** conversion factor from nA.s to mA.s and from nW.s to mW.s */
+#define CINT_NANO_TO_MILLI_FACTOR (1000000)
+
+/** one current sample */
+typedef struct {
+    uint8_t stringNumber; /*!< string of the sample */
+    int32_t current_mA;   /*!< measured current */
+    int32_t voltage_mV;   /*!< latest system voltage at the time of the sample */
+    uint32_t counter;     /*!< free running counter value at the time of the sample */
+    uint32_t timestamp;   /*!< OS tick at the time of the sample */
+} CINT_SAMPLE_s;
+
+/** integration state of one string */
+typedef struct {
+    bool hasPreviousSample; /*!< true if the values of the previous sample are valid */
+    bool hasNewSamples;     /*!< true if samples have been integrated since the last publication */
+    int32_t current_mA;     /*!< current of the previous sample */
+    int32_t voltage_mV;     /*!< voltage of the previous sample */
+    uint32_t counter;       /*!< free running counter value of the previous sample */
+    uint32_t timestamp;     /*!< OS tick of the previous sample */
+    int64_t charge_nAs;     /*!< accumulated charge */
+    int64_t energy_nWs;     /*!< accumulated energy */
+} CINT_STRING_STATE_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/** buffer of the current samples */
+static CINT_SAMPLE_s cint_sampleBuffer[CINT_SAMPLE_BUFFER_LENGTH] = {0};
+
+/** index of the next sample to be written (free running, producer only) */
+static volatile uint32_t cint_writeIndex = 0u;
+
+/** index of the next sample to be read (free running, consumer only) */
+static volatile uint32_t cint_readIndex = 0u;
+
+/** number of dropped samples (producer only) */
+static volatile uint32_t cint_droppedSamples = 0u;
+
+/** latest system voltage per string */
+static volatile int32_t cint_voltage_mV[BS_NR_OF_STRINGS] = {0};
+
+/** integration state per string (consumer only) */
+static CINT_STRING_STATE_s cint_state[BS_NR_OF_STRINGS] = {0};
+
+/** local copy of the database table */
+static DATA_BLOCK_CURRENT_INTEGRATION_s cint_tableCurrentIntegration = {
+    .header.uniqueId = DATA_BLOCK_ID_CURRENT_INTEGRATION};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/**
+ * @brief   Integrates the interval between the previous sample of a string
+ *          and the passed sample.
+ * @details The interval is integrated with the trapezoidal rule. If the
+ *          interval is longer than #CINT_MAXIMUM_SAMPLE_INTERVAL_us, it is
+ *          skipped and counted as gap.
+ * @param   pSample sample to be integrated
+ */
+static void CINT_IntegrateSample(const CINT_SAMPLE_s *const pSample);
+
+/**
+ * @brief   Resets the sample buffer and the integration state.
+ */
+static void CINT_ResetState(void);
+
+/*========== Static Function Implementations ================================*/
+
+static void CINT_IntegrateSample(const CINT_SAMPLE_s *const pSample) {
+    FAS_ASSERT(pSample != NULL_PTR);
+    FAS_ASSERT(pSample->stringNumber < BS_NR_OF_STRINGS);
+    CINT_STRING_STATE_s *const pState = &cint_state[pSample->stringNumber];
+
+    if (pState->hasPreviousSample == true) {
+        /* the OS tick difference detects intervals in which the free running counter has overflowed */
+        const uint32_t interval_ms = pSample->timestamp - pState->timestamp;
+        const uint32_t interval_us = MCU_ConvertFrcDifferenceToTimespan_us(pSample->counter - pState->counter);
+        if ((interval_ms <= (CINT_MAXIMUM_SAMPLE_INTERVAL_us / 1000u)) &&
+            (interval_us <= CINT_MAXIMUM_SAMPLE_INTERVAL_us)) {
+            /* mA * us = nA.s */
+            const int64_t currentSum_mA = (int64_t)pState->current_mA + (int64_t)pSample->current_mA;
+            pState->charge_nAs += (currentSum_mA * (int64_t)interval_us) / 2;
+            /* mA * mV = uW; uW * us = pW.s; divided by 1000 for nW.s and by 2 for the trapezoid */
+            const int64_t powerSum_uW = ((int64_t)pState->current_mA * (int64_t)pState->voltage_mV) +
+                                        ((int64_t)pSample->current_mA * (int64_t)pSample->voltage_mV);
+            pState->energy_nWs += (powerSum_uW * (int64_t)interval_us) / 2000;
+        } else {
+            cint_tableCurrentIntegration.numberOfGaps[pSample->stringNumber]++;
+        }
+    }
+
+    pState->hasPreviousSample = true;
+    pState->hasNewSamples     = true;
+    pState->current_mA        = pSample->current_mA;
+    pState->voltage_mV        = pSample->voltage_mV;
+    pState->counter           = pSample->counter;
+    pState->timestamp         = pSample->timestamp;
+    cint_tableCurrentIntegration.numberOfSamples[pSample->stringNumber]++;
+}
+
+static void CINT_ResetState(void) {
+    cint_readIndex = cint_writeIndex;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        cint_state[s].hasPreviousSample                   = false;
+        cint_state[s].hasNewSamples                       = false;
+        cint_state[s].charge_nAs                          = 0;
+        cint_state[s].energy_nWs                          = 0;
+        cint_tableCurrentIntegration.charge_mAs[s]        = 0;
+        cint_tableCurrentIntegration.energy_mWs[s]        = 0;
+        cint_tableCurrentIntegration.numberOfSamples[s]   = 0u;
+        cint_tableCurrentIntegration.numberOfGaps[s]      = 0u;
+        cint_tableCurrentIntegration.previousTimestamp[s] = 0u;
+        cint_tableCurrentIntegration.timestamp[s]         = 0u;
+    }
+    cint_tableCurrentIntegration.maximumFillLevel = 0u;
+}
+
+/*========== Extern Function Implementations ================================*/
+
+extern void CINT_SetVoltage(uint8_t stringNumber, int32_t voltage_mV) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    /* AXIVION Routine Generic-MissingParameterAssert: voltage_mV: parameter accepts whole range */
+    cint_voltage_mV[stringNumber] = voltage_mV;
+}
+
+extern STD_RETURN_TYPE_e CINT_AddCurrentSample(uint8_t stringNumber, int32_t current_mA) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    /* AXIVION Routine Generic-MissingParameterAssert: current_mA: parameter accepts whole range */
+    STD_RETURN_TYPE_e retval = STD_NOT_OK;
+
+    const uint32_t writeIndex = cint_writeIndex;
+    if ((writeIndex - cint_readIndex) < CINT_SAMPLE_BUFFER_LENGTH) {
+        CINT_SAMPLE_s *const pSample = &cint_sampleBuffer[writeIndex % CINT_SAMPLE_BUFFER_LENGTH];
+        pSample->stringNumber        = stringNumber;
+        pSample->current_mA          = current_mA;
+        pSample->voltage_mV          = cint_voltage_mV[stringNumber];
+        pSample->counter             = MCU_GetFreeRunningCount();
+        pSample->timestamp           = OS_GetTickCount();
+        /* publish the sample only after it has been completely written */
+        cint_writeIndex = writeIndex + 1u;
+        retval          = STD_OK;
+    } else {
+        cint_droppedSamples++;
+    }
+    return retval;
+}
+
+extern STD_RETURN_TYPE_e CINT_Initialize(void) {
+    CINT_ResetState();
+    return STD_OK;
+}
+
+extern void CINT_Trigger(void) {
+    uint32_t readIndex        = cint_readIndex;
+    const uint32_t writeIndex = cint_writeIndex;
+    const uint32_t fillLevel  = writeIndex - readIndex;
+    if (fillLevel > cint_tableCurrentIntegration.maximumFillLevel) {
+        cint_tableCurrentIntegration.maximumFillLevel = fillLevel;
+    }
+
+    while (readIndex != writeIndex) {
+        CINT_IntegrateSample(&cint_sampleBuffer[readIndex % CINT_SAMPLE_BUFFER_LENGTH]);
+        readIndex++;
+        /* release the slot for the producer */
+        cint_readIndex = readIndex;
+    }
+
+    if (fillLevel > 0u) {
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            if (cint_state[s].hasNewSamples == true) {
+                cint_state[s].hasNewSamples                = false;
+                cint_tableCurrentIntegration.charge_mAs[s] = cint_state[s].charge_nAs / CINT_NANO_TO_MILLI_FACTOR;
+                cint_tableCurrentIntegration.energy_mWs[s] = cint_state[s].energy_nWs / CINT_NANO_TO_MILLI_FACTOR;
+
+                cint_tableCurrentIntegration.previousTimestamp[s] = cint_tableCurrentIntegration.timestamp[s];
+                cint_tableCurrentIntegration.timestamp[s]         = cint_state[s].timestamp;
+            }
+        }
+        cint_tableCurrentIntegration.droppedSamples = cint_droppedSamples;
+        DATA_WRITE_DATA(&cint_tableCurrentIntegration);
+    }
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_CINT_Reset(void) {
+    cint_writeIndex     = 0u;
+    cint_readIndex      = 0u;
+    cint_droppedSamples = 0u;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        cint_voltage_mV[s] = 0;
+    }
+    CINT_ResetState();
+    cint_tableCurrentIntegration.droppedSamples = 0u;
+}
+#endif
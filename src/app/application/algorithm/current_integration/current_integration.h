@@ -0,0 +1,150 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    current_integration.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ALGORITHMS
+ * @prefix  CINT
+ *
+ * @brief   Software charge and energy integration at current sensor rate
+ * @details Current sensors without built-in coulomb and energy counting only
+ *          provide the instantaneous current. The CAN receive path appends
+ *          every current measurement together with a free running counter
+ *          timestamp to a sample buffer (#CINT_AddCurrentSample()). The
+ *          algorithm module periodically drains the buffer, integrates each
+ *          sample interval with the trapezoidal rule and publishes the
+ *          accumulated charge and energy per string in the database entry
+ *          #DATA_BLOCK_CURRENT_INTEGRATION_s (#CINT_Trigger()).
+ *          The integration therefore uses every sample, independent of the
+ *          (lower) rate at which the state estimation is executed.
+ */
+
+#ifndef FOXBMS__CURRENT_INTEGRATION_H_
+#define FOXBMS__CURRENT_INTEGRATION_H_
+
+/*========== Includes =======================================================*/
+
+#include "fstd_types.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/**
+ * @brief   number of current samples of one string between two calls of
+ *          #CINT_Trigger()
+ * @details A current measurement every 1ms and the algorithm cycle time of
+ *          100ms.
+ */
+#define CINT_SAMPLES_PER_STRING_AND_CYCLE (100u)
+
+/**
+ * @brief   number of current samples that can be buffered between two calls
+ *          of #CINT_Trigger()
+ * @details Must be a power of two and has to hold
+ *          #CINT_SAMPLES_PER_STRING_AND_CYCLE samples of every string. The
+ *          default is sufficient for up to two strings; it has to be
+ *          increased for larger battery systems.
+ */
+#define CINT_SAMPLE_BUFFER_LENGTH (256u)
+
+/**
+ * @brief   maximum time between two current samples of a string that is
+ *          integrated
+ * @details Longer intervals (e.g., after a communication loss) are not
+ *          integrated, but counted in
+ *          #DATA_BLOCK_CURRENT_INTEGRATION_s::numberOfGaps.
+ */
+#define CINT_MAXIMUM_SAMPLE_INTERVAL_us (500000u)
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/**
+ * @brief   Stores the latest system voltage of a string.
+ * @details The voltage is used for the energy integration of all following
+ *          current samples of that string (sample and hold).
+ * @param   stringNumber    addressed string
+ * @param   voltage_mV      system voltage in mV
+ */
+extern void CINT_SetVoltage(uint8_t stringNumber, int32_t voltage_mV);
+
+/**
+ * @brief   Appends a current sample to the sample buffer.
+ * @details The function has constant execution time and never blocks. It
+ *          shall only be called from one context (the CAN receive path). If
+ *          the sample buffer is full, the sample is dropped and counted.
+ * @param   stringNumber    addressed string
+ * @param   current_mA      measured current in mA
+ * @return  #STD_OK if the sample has been stored, #STD_NOT_OK if it has been
+ *          dropped
+ */
+extern STD_RETURN_TYPE_e CINT_AddCurrentSample(uint8_t stringNumber, int32_t current_mA);
+
+/**
+ * @brief   Initializes the integration state.
+ * @details Discards all buffered samples and resets the accumulated charge
+ *          and energy. Used as initialization function of the algorithm
+ *          module.
+ * @return  #STD_OK
+ */
+extern STD_RETURN_TYPE_e CINT_Initialize(void);
+
+/**
+ * @brief   Integrates all buffered current samples and publishes the result.
+ * @details Shall only be called from one context (the algorithm module). The
+ *          database entry is only written if at least one sample has been
+ *          integrated.
+ */
+extern void CINT_Trigger(void);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_CINT_Reset(void);
+#endif
+
+#endif /* FOXBMS__CURRENT_INTEGRATION_H_ */
@@ -43,7 +43,7 @@
  * @file    soc_counting.c
  * @author  foxBMS Team
  * @date    2020-10-07 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup APPLICATION
  * @prefix  SOC
@@ -80,6 +80,7 @@ typedef struct {
     float_t chargeThroughput_As[BS_NR_OF_STRINGS];    /*!< Charge throughput */
     float_t dischargeThroughput_As[BS_NR_OF_STRINGS]; /*!< Discharge throughput */
     float_t previousCurrentCountingValue_As[BS_NR_OF_STRINGS]; /*!< Charge throughput */
+    int64_t previousIntegratedCharge_mAs[BS_NR_OF_STRINGS];    /*!< last used value of the software integration */
     uint32_t previousTimestamp[BS_NR_OF_STRINGS]; /*!< timestamp buffer to check if current/CC data has been updated */
 } SOC_STATE_s;
 
@@ -99,6 +100,7 @@ static SOC_STATE_s soc_state = {
     .chargeThroughput_As             = {GEN_REPEAT_U(0.0f, GEN_STRIP(BS_NR_OF_STRINGS))},
     .dischargeThroughput_As          = {GEN_REPEAT_U(0.0f, GEN_STRIP(BS_NR_OF_STRINGS))},
     .previousCurrentCountingValue_As = {GEN_REPEAT_U(0u, GEN_STRIP(BS_NR_OF_STRINGS))},
+    .previousIntegratedCharge_mAs    = {GEN_REPEAT_U(0, GEN_STRIP(BS_NR_OF_STRINGS))},
     .previousTimestamp               = {GEN_REPEAT_U(0u, GEN_STRIP(BS_NR_OF_STRINGS))},
 };
 
@@ -106,6 +108,8 @@ static SOC_STATE_s soc_state = {
 /**@{*/
 static DATA_BLOCK_CURRENT_s soc_tableCurrent                = {.header.uniqueId = DATA_BLOCK_ID_CURRENT};
 static DATA_BLOCK_CURRENT_COUNTER_s soc_tableCurrentCounter = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_COUNTER};
+static DATA_BLOCK_CURRENT_INTEGRATION_s soc_tableCurrentIntegration = {
+    .header.uniqueId = DATA_BLOCK_ID_CURRENT_INTEGRATION};
 /**@}*/
 
 /*========== Extern Constant and Variable Definitions =======================*/
@@ -255,7 +259,7 @@ static void SOC_UpdateNvmValues(DATA_BLOCK_SOC_s *pTableSoc, uint8_t stringNumbe
 void SE_InitializeStateOfCharge(DATA_BLOCK_SOC_s *pSocValues, bool ccPresent, uint8_t stringNumber) {
     FAS_ASSERT(pSocValues != NULL_PTR);
     FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
-    DATA_READ_DATA(&soc_tableCurrent, &soc_tableCurrentCounter);
+    DATA_READ_DATA(&soc_tableCurrent, &soc_tableCurrentCounter, &soc_tableCurrentIntegration);
 
     FRAM_ReadData(FRAM_BLOCK_ID_SOC);
 
@@ -277,8 +281,9 @@ void SE_InitializeStateOfCharge(DATA_BLOCK_SOC_s *pSocValues, bool ccPresent, ui
         soc_state.ccScalingMinimum[stringNumber] = fram_soc.minimumSoc_perc[stringNumber] + scalingOffset_perc;
         soc_state.ccScalingMaximum[stringNumber] = fram_soc.maximumSoc_perc[stringNumber] + scalingOffset_perc;
     } else {
-        soc_state.previousTimestamp[stringNumber] = soc_tableCurrent.timestamp[stringNumber];
-        soc_state.sensorCcUsed[stringNumber]      = false;
+        soc_state.previousTimestamp[stringNumber]            = soc_tableCurrentIntegration.timestamp[stringNumber];
+        soc_state.previousIntegratedCharge_mAs[stringNumber] = soc_tableCurrentIntegration.charge_mAs[stringNumber];
+        soc_state.sensorCcUsed[stringNumber]                 = false;
     }
 
     pSocValues->averageSoc_perc[stringNumber]        = fram_soc.averageSoc_perc[stringNumber];
@@ -312,44 +317,41 @@ void SE_CalculateStateOfCharge(DATA_BLOCK_SOC_s *pSocValues) {
             SOC_RecalibrateViaLookupTable(pSocValues);
         } else {
             /* Read current sensor entry for coulomb/current counting or CC recalibration */
-            DATA_READ_DATA(&soc_tableCurrent, &soc_tableCurrentCounter);
+            DATA_READ_DATA(&soc_tableCurrent, &soc_tableCurrentCounter, &soc_tableCurrentIntegration);
             for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
                 if (soc_state.sensorCcUsed[s] == false) {
-                    /* check if current measurement has been updated */
-                    if (soc_state.previousTimestamp[s] != soc_tableCurrent.timestamp[s]) {
-                        float_t timeStep_s =
-                            ((float_t)(soc_tableCurrent.timestamp[s] - soc_state.previousTimestamp[s])) / 1000.0f;
-
-                        if (timeStep_s > 0.0f) {
-                            /* Current in charge direction negative means SOC increasing --> BAT naming, not ROB */
-
-                            float_t deltaSOC_perc =
-                                (((float_t)soc_tableCurrent.current_mA[s] * timeStep_s) / SOC_STRING_CAPACITY_mAs) *
-                                100.0f; /* ((mA) * 1s) / 1As) * 100% */
-
-                            float_t charge_As = fabs((float_t)soc_tableCurrent.current_mA[s] * timeStep_s / 1000.0f);
-
-                            deltaSOC_perc *= BS_CURRENT_DIRECTION_FLOAT;
-
-                            pSocValues->averageSoc_perc[s] = pSocValues->averageSoc_perc[s] - deltaSOC_perc;
-                            pSocValues->minimumSoc_perc[s] = pSocValues->minimumSoc_perc[s] - deltaSOC_perc;
-                            pSocValues->maximumSoc_perc[s] = pSocValues->maximumSoc_perc[s] - deltaSOC_perc;
-                            if (BMS_GetCurrentFlowDirection(soc_tableCurrent.current_mA[s]) == BMS_CHARGING) {
-                                pSocValues->chargeThroughput_As[s] = pSocValues->chargeThroughput_As[s] + charge_As;
-                            } else {
-                                /* When BMS_DISCHARGING and BMS_AT_REST add charge to dischargeThroughput*/
-                                pSocValues->dischargeThroughput_As[s] = pSocValues->dischargeThroughput_As[s] +
-                                                                        charge_As;
-                            }
-                            /* Limit SOC calculation to 0% respectively 100% */
-                            SOC_CheckDatabaseSocPercentageLimits(pSocValues, s);
-
-                            /* Update values in non-volatile memory */
-                            SOC_UpdateNvmValues(pSocValues, s);
+                    /* check if the software integration has been updated; it integrates every current sample */
+                    if (soc_state.previousTimestamp[s] != soc_tableCurrentIntegration.timestamp[s]) {
+                        const int64_t deltaCharge_mAs = soc_tableCurrentIntegration.charge_mAs[s] -
+                                                        soc_state.previousIntegratedCharge_mAs[s];
+
+                        /* Current in charge direction negative means SOC increasing --> BAT naming, not ROB */
+                        float_t deltaSOC_perc = (((float_t)deltaCharge_mAs) / SOC_STRING_CAPACITY_mAs) *
+                                                100.0f; /* ((mA * s) / 1As) * 100% */
+
+                        float_t charge_As = fabs((float_t)deltaCharge_mAs / 1000.0f);
+
+                        deltaSOC_perc *= BS_CURRENT_DIRECTION_FLOAT;
+
+                        pSocValues->averageSoc_perc[s] = pSocValues->averageSoc_perc[s] - deltaSOC_perc;
+                        pSocValues->minimumSoc_perc[s] = pSocValues->minimumSoc_perc[s] - deltaSOC_perc;
+                        pSocValues->maximumSoc_perc[s] = pSocValues->maximumSoc_perc[s] - deltaSOC_perc;
+                        if (BMS_GetCurrentFlowDirection(soc_tableCurrent.current_mA[s]) == BMS_CHARGING) {
+                            pSocValues->chargeThroughput_As[s] = pSocValues->chargeThroughput_As[s] + charge_As;
+                        } else {
+                            /* When BMS_DISCHARGING and BMS_AT_REST add charge to dischargeThroughput*/
+                            pSocValues->dischargeThroughput_As[s] = pSocValues->dischargeThroughput_As[s] + charge_As;
                         }
-                        soc_state.previousTimestamp[s] = soc_tableCurrent.timestamp[s];
-                    } /* end check if current measurement has been updated */
-                    /* update the variable for the next check */
+                        /* Limit SOC calculation to 0% respectively 100% */
+                        SOC_CheckDatabaseSocPercentageLimits(pSocValues, s);
+
+                        /* Update values in non-volatile memory */
+                        SOC_UpdateNvmValues(pSocValues, s);
+
+                        /* update the variables for the next check */
+                        soc_state.previousIntegratedCharge_mAs[s] = soc_tableCurrentIntegration.charge_mAs[s];
+                        soc_state.previousTimestamp[s]            = soc_tableCurrentIntegration.timestamp[s];
+                    } /* end check if the software integration has been updated */
                 } else {
                     /* check if cc measurement has been updated */
                     if (soc_state.previousTimestamp[s] != soc_tableCurrentCounter.timestamp[s]) {
@@ -385,7 +387,7 @@ void SE_CalculateStateOfCharge(DATA_BLOCK_SOC_s *pSocValues) {
                 }
             }
             /* Update database and FRAM value */
-            FRAM_WriteData(FRAM_BLOCK_ID_SOC);
+            FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
         }
     }
 }
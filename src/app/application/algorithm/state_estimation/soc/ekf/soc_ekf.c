@@ -0,0 +1,571 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    soc_ekf.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup APPLICATION
+ * @prefix  SOC
+ *
+ * @brief   SOC module responsible for the per-cell calculation of the
+ *          state-of-charge (SOC) with an extended Kalman filter
+ * @details Every cell block has its own filter with the states SOC and
+ *          polarization voltage. The filter states are stored as
+ *          structure-of-arrays with a fixed size, so that all cell blocks of
+ *          a string are updated in one loop without any allocation.
+ *          The minimum, maximum and average SOC per string are derived from
+ *          the cell block SOCs.
+ */
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+#include "soc_ekf_cfg.h"
+
+#include "bms.h"
+#include "database.h"
+#include "fbitset.h"
+#include "foxmath.h"
+#include "fram.h"
+#include "state_estimation.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** This structure contains all the variables relevant for the SOC */
+typedef struct {
+    bool socInitialized;                          /*!< true if the initialization has passed, false otherwise */
+    uint32_t previousTimestamp[BS_NR_OF_STRINGS]; /*!< timestamp buffer to check if current data has been updated */
+    uint32_t previousCellVoltageTimestamp; /*!< timestamp buffer to check if cell voltages have been updated */
+} SOC_STATE_s;
+
+/** Maximum SOC in percentage */
+#define SOC_MAXIMUM_SOC_perc (100.0f)
+/** Minimum SOC in percentage */
+#define SOC_MINIMUM_SOC_perc (0.0f)
+
+FAS_STATIC_ASSERT(
+    (BS_NR_OF_CELL_BLOCKS <= SOC_EKF_MAXIMUM_NUMBER_OF_CELL_BLOCKS),
+    "The SOC estimation has not been dimensioned for this number of cell blocks");
+FAS_STATIC_ASSERT(
+    (BS_NR_OF_CELL_BLOCKS_PER_STRING <= (uint16_t)UINT16_MAX),
+    "This code assumes BS_NR_OF_CELL_BLOCKS_PER_STRING fits into uint16_t");
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** state variable for SOC module */
+static SOC_STATE_s soc_state = {
+    .socInitialized               = false,
+    .previousTimestamp            = {GEN_REPEAT_U(0u, GEN_STRIP(BS_NR_OF_STRINGS))},
+    .previousCellVoltageTimestamp = 0u,
+};
+
+/** filter states of all cell blocks */
+/**@{*/
+static float_t soc_cellSoc_perc[BS_NR_OF_CELL_BLOCKS]               = {0.0f};
+static float_t soc_cellPolarizationVoltage_mV[BS_NR_OF_CELL_BLOCKS] = {0.0f};
+static float_t soc_cellCovarianceSoc[BS_NR_OF_CELL_BLOCKS]          = {0.0f};
+static float_t soc_cellCovarianceCross[BS_NR_OF_CELL_BLOCKS]        = {0.0f};
+static float_t soc_cellCovariancePolarization[BS_NR_OF_CELL_BLOCKS] = {0.0f};
+/**@}*/
+
+/** open-circuit voltage in mV from 0% to 100% SOC in 1% steps */
+static float_t soc_openCircuitVoltage_mV[SOC_EKF_OCV_TABLE_LENGTH] = {0.0f};
+
+/** local copies of database tables */
+/**@{*/
+static DATA_BLOCK_CURRENT_s soc_tableCurrent          = {.header.uniqueId = DATA_BLOCK_ID_CURRENT};
+static DATA_BLOCK_CELL_VOLTAGE_s soc_tableCellVoltage = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+/**@}*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   limits a SOC value to [0.0, 100.0]
+ * @param[in]   soc_perc    SOC in percentage
+ * @return  limited SOC in percentage
+ */
+static float_t SOC_LimitStateOfCharge(float_t soc_perc);
+
+/**
+ * @brief   builds the open-circuit voltage table with equidistant SOC steps
+ *          from the cell SOC lookup table
+ * @details The cell lookup table is indexed by voltage. Inverting it once at
+ *          startup allows the filter to look up the open-circuit voltage and
+ *          its slope in constant time.
+ */
+static void SOC_BuildOpenCircuitVoltageTable(void);
+
+/**
+ * @brief   returns the open-circuit voltage for a SOC
+ * @param[in]   soc_perc    SOC in percentage, limited to [0.0, 100.0]
+ * @param[out]  pSlope_mV   slope of the open-circuit voltage in mV per %
+ * @return  open-circuit voltage in mV
+ */
+static float_t SOC_GetOpenCircuitVoltage(float_t soc_perc, float_t *pSlope_mV);
+
+/**
+ * @brief   calculates the filter input that is identical for all cell blocks
+ *          of a string
+ * @param[out]  pStep       filter input
+ * @param[in]   current_mA  string current
+ * @param[in]   timeStep_s  time since the last filter step
+ */
+static void SOC_GetStep(SOC_EKF_STEP_s *pStep, int32_t current_mA, float_t timeStep_s);
+
+/**
+ * @brief   executes one prediction and correction step of the filter for
+ *          consecutive cell blocks
+ * @details The correction is skipped for cell blocks with an invalid voltage
+ *          measurement.
+ * @param[in]     pStep               filter input
+ * @param[in,out] pCells              filter states of the cell blocks
+ * @param[in]     pCellVoltage_mV     measured cell block voltages
+ * @param[in]     invalidCellVoltage  invalid flags of the cell block voltages,
+ *                                    bit c: cell block c
+ * @param[in]     numberOfCellBlocks  number of cell blocks to be updated
+ *                                    (at most #BITSET_BITS_PER_WORD)
+ */
+static void SOC_UpdateCells(
+    const SOC_EKF_STEP_s *pStep,
+    const SOC_EKF_CELLS_s *pCells,
+    const int16_t *pCellVoltage_mV,
+    BITSET_WORD_t invalidCellVoltage,
+    uint16_t numberOfCellBlocks);
+
+/**
+ * @brief   executes one prediction step of the filter for consecutive cell
+ *          blocks without a voltage measurement
+ * @param[in]     pStep               filter input
+ * @param[in,out] pCells              filter states of the cell blocks
+ * @param[in]     numberOfCellBlocks  number of cell blocks to be updated
+ */
+static void SOC_PredictCells(const SOC_EKF_STEP_s *pStep, const SOC_EKF_CELLS_s *pCells, uint16_t numberOfCellBlocks);
+
+/**
+ * @brief   returns the filter states of the cell blocks of a string
+ * @param[out]  pCells          filter states
+ * @param[in]   stringNumber    addressed string
+ */
+static void SOC_GetStringCells(SOC_EKF_CELLS_s *pCells, uint8_t stringNumber);
+
+/**
+ * @brief   gets the filter states of the cell blocks of a module
+ * @param[out]  pCells          filter states of the cell blocks of the module
+ * @param[in]   stringNumber    addressed string
+ * @param[in]   moduleNumber    addressed module
+ */
+static void SOC_GetModuleCells(SOC_EKF_CELLS_s *pCells, uint8_t stringNumber, uint8_t moduleNumber);
+
+/**
+ * @brief   sets the minimum, maximum and average SOC of a string from the
+ *          cell block SOCs
+ * @param[out]  pTableSoc       pointer to database struct with SOC values
+ * @param[in]   stringNumber    addressed string
+ */
+static void SOC_SetStringValues(DATA_BLOCK_SOC_s *pTableSoc, uint8_t stringNumber);
+
+/**
+ * @brief   Set SOC-related values in non-volatile memory
+ * @param[in] pTableSoc      pointer to database struct with SOC values
+ * @param[in] stringNumber   addressed string
+ */
+static void SOC_UpdateNvmValues(DATA_BLOCK_SOC_s *pTableSoc, uint8_t stringNumber);
+
+/*========== Static Function Implementations ================================*/
+static float_t SOC_LimitStateOfCharge(float_t soc_perc) {
+    float_t limited_perc = soc_perc;
+    if (limited_perc > SOC_MAXIMUM_SOC_perc) {
+        limited_perc = SOC_MAXIMUM_SOC_perc;
+    }
+    if (limited_perc < SOC_MINIMUM_SOC_perc) {
+        limited_perc = SOC_MINIMUM_SOC_perc;
+    }
+    return limited_perc;
+}
+
+static void SOC_BuildOpenCircuitVoltageTable(void) {
+    FAS_ASSERT(bc_stateOfChargeLookupTableLength > 1u);
+    for (uint16_t k = 0u; k < SOC_EKF_OCV_TABLE_LENGTH; k++) {
+        const float_t soc_perc = (float_t)k;
+        /* The lookup table is in descending order: search the first segment
+         * that contains the SOC, use the last segment for extrapolation */
+        uint16_t i = 0u;
+        while (((i + 2u) < bc_stateOfChargeLookupTableLength) &&
+               (bc_stateOfChargeLookupTable[i + 1u].value > soc_perc)) {
+            i++;
+        }
+        soc_openCircuitVoltage_mV[k] = MATH_LinearInterpolation(
+            bc_stateOfChargeLookupTable[i].value,
+            (float_t)bc_stateOfChargeLookupTable[i].voltage_mV,
+            bc_stateOfChargeLookupTable[i + 1u].value,
+            (float_t)bc_stateOfChargeLookupTable[i + 1u].voltage_mV,
+            soc_perc);
+    }
+}
+
+static float_t SOC_GetOpenCircuitVoltage(float_t soc_perc, float_t *pSlope_mV) {
+    FAS_ASSERT(pSlope_mV != NULL_PTR);
+    uint16_t index = (uint16_t)soc_perc;
+    if (index >= (SOC_EKF_OCV_TABLE_LENGTH - 1u)) {
+        index = SOC_EKF_OCV_TABLE_LENGTH - 2u;
+    }
+    *pSlope_mV = soc_openCircuitVoltage_mV[index + 1u] - soc_openCircuitVoltage_mV[index];
+    return soc_openCircuitVoltage_mV[index] + (*pSlope_mV * (soc_perc - (float_t)index));
+}
+
+static void SOC_GetStep(SOC_EKF_STEP_s *pStep, int32_t current_mA, float_t timeStep_s) {
+    FAS_ASSERT(pStep != NULL_PTR);
+    /* positive in discharge direction, i.e., decreasing SOC */
+    const float_t dischargeCurrent_mA = (float_t)current_mA * BS_CURRENT_DIRECTION_FLOAT;
+    const float_t decay               = expf(-timeStep_s / SOC_EKF_POLARIZATION_TIME_CONSTANT_s);
+
+    /* (mA * s) / mAs * 100% */
+    pStep->deltaSoc_perc = ((dischargeCurrent_mA * timeStep_s) / SOC_CELL_BLOCK_CAPACITY_mAs) * 100.0f;
+    /* mA * mOhm = uV */
+    pStep->seriesVoltageDrop_mV = (dischargeCurrent_mA * SOC_EKF_SERIES_RESISTANCE_mOhm) /
+                                  UNIT_CONVERSION_FACTOR_1000_FLOAT;
+    pStep->polarizationDecay    = decay;
+    pStep->polarizationInput_mV = ((1.0f - decay) * dischargeCurrent_mA * SOC_EKF_POLARIZATION_RESISTANCE_mOhm) /
+                                  UNIT_CONVERSION_FACTOR_1000_FLOAT;
+    pStep->processNoiseSoc_perc2        = SOC_EKF_PROCESS_NOISE_SOC_perc2 * timeStep_s;
+    pStep->processNoisePolarization_mV2 = SOC_EKF_PROCESS_NOISE_POLARIZATION_mV2 * timeStep_s;
+}
+
+/* INCLUDE MARKER FOR THE DOCUMENTATION; DO NOT MOVE ekf-documentation-start-include */
+static void SOC_UpdateCells(
+    const SOC_EKF_STEP_s *pStep,
+    const SOC_EKF_CELLS_s *pCells,
+    const int16_t *pCellVoltage_mV,
+    BITSET_WORD_t invalidCellVoltage,
+    uint16_t numberOfCellBlocks) {
+    /* INCLUDE MARKER FOR THE DOCUMENTATION; DO NOT MOVE ekf-documentation-stop-include */
+    FAS_ASSERT(pStep != NULL_PTR);
+    FAS_ASSERT(pCells != NULL_PTR);
+    FAS_ASSERT(pCellVoltage_mV != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: invalidCellVoltage: parameter accepts whole range */
+    FAS_ASSERT(numberOfCellBlocks <= BITSET_BITS_PER_WORD);
+
+    /* load the step input once, it is the same for all cell blocks */
+    const float_t deltaSoc_perc        = pStep->deltaSoc_perc;
+    const float_t seriesVoltageDrop_mV = pStep->seriesVoltageDrop_mV;
+    const float_t decay                = pStep->polarizationDecay;
+    const float_t decaySquared         = decay * decay;
+    const float_t polarizationInput_mV = pStep->polarizationInput_mV;
+    const float_t noiseSoc             = pStep->processNoiseSoc_perc2;
+    const float_t noisePolarization    = pStep->processNoisePolarization_mV2;
+
+    for (uint16_t c = 0u; c < numberOfCellBlocks; c++) {
+        /* prediction: x = F * x + B * u, P = F * P * F^T + Q with F = diag(1, decay) */
+        float_t soc_perc = SOC_LimitStateOfCharge(pCells->pSoc_perc[c] - deltaSoc_perc);
+        float_t vrc_mV   = (decay * pCells->pPolarizationVoltage_mV[c]) + polarizationInput_mV;
+        float_t covSoc   = pCells->pCovarianceSoc[c] + noiseSoc;
+        float_t covCross = decay * pCells->pCovarianceCross[c];
+        float_t covPolar = (decaySquared * pCells->pCovariancePolarization[c]) + noisePolarization;
+
+        if (BITSET_IsBitSet(invalidCellVoltage, (uint8_t)c) == false) {
+            /* correction with V = OCV(SOC) - Vrc - R0 * I, i.e., H = [dOCV/dSOC, -1] */
+            float_t slope_mV         = 0.0f;
+            const float_t ocv_mV     = SOC_GetOpenCircuitVoltage(soc_perc, &slope_mV);
+            const float_t residual   = (float_t)pCellVoltage_mV[c] - (ocv_mV - vrc_mV - seriesVoltageDrop_mV);
+            const float_t phtSoc     = (slope_mV * covSoc) - covCross;
+            const float_t phtPolar   = (slope_mV * covCross) - covPolar;
+            const float_t innovation = ((slope_mV * phtSoc) - phtPolar) + SOC_EKF_MEASUREMENT_NOISE_mV2;
+            const float_t gainSoc    = phtSoc / innovation;
+            const float_t gainPolar  = phtPolar / innovation;
+
+            soc_perc = SOC_LimitStateOfCharge(soc_perc + (gainSoc * residual));
+            vrc_mV += gainPolar * residual;
+            covSoc -= gainSoc * phtSoc;
+            covCross -= gainSoc * phtPolar;
+            covPolar -= gainPolar * phtPolar;
+        }
+
+        pCells->pSoc_perc[c]               = soc_perc;
+        pCells->pPolarizationVoltage_mV[c] = vrc_mV;
+        pCells->pCovarianceSoc[c]          = covSoc;
+        pCells->pCovarianceCross[c]        = covCross;
+        pCells->pCovariancePolarization[c] = covPolar;
+    }
+}
+
+static void SOC_PredictCells(const SOC_EKF_STEP_s *pStep, const SOC_EKF_CELLS_s *pCells, uint16_t numberOfCellBlocks) {
+    FAS_ASSERT(pStep != NULL_PTR);
+    FAS_ASSERT(pCells != NULL_PTR);
+    const float_t decay        = pStep->polarizationDecay;
+    const float_t decaySquared = decay * decay;
+
+    for (uint16_t c = 0u; c < numberOfCellBlocks; c++) {
+        pCells->pSoc_perc[c] = SOC_LimitStateOfCharge(pCells->pSoc_perc[c] - pStep->deltaSoc_perc);
+        pCells->pPolarizationVoltage_mV[c] = (decay * pCells->pPolarizationVoltage_mV[c]) +
+                                             pStep->polarizationInput_mV;
+        pCells->pCovarianceSoc[c]   = pCells->pCovarianceSoc[c] + pStep->processNoiseSoc_perc2;
+        pCells->pCovarianceCross[c] = decay * pCells->pCovarianceCross[c];
+        pCells->pCovariancePolarization[c] = (decaySquared * pCells->pCovariancePolarization[c]) +
+                                             pStep->processNoisePolarization_mV2;
+    }
+}
+
+static void SOC_GetStringCells(SOC_EKF_CELLS_s *pCells, uint8_t stringNumber) {
+    FAS_ASSERT(pCells != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    const uint32_t offset           = (uint32_t)stringNumber * BS_NR_OF_CELL_BLOCKS_PER_STRING;
+    pCells->pSoc_perc               = &soc_cellSoc_perc[offset];
+    pCells->pPolarizationVoltage_mV = &soc_cellPolarizationVoltage_mV[offset];
+    pCells->pCovarianceSoc          = &soc_cellCovarianceSoc[offset];
+    pCells->pCovarianceCross        = &soc_cellCovarianceCross[offset];
+    pCells->pCovariancePolarization = &soc_cellCovariancePolarization[offset];
+}
+
+static void SOC_GetModuleCells(SOC_EKF_CELLS_s *pCells, uint8_t stringNumber, uint8_t moduleNumber) {
+    FAS_ASSERT(pCells != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    FAS_ASSERT(moduleNumber < BS_NR_OF_MODULES_PER_STRING);
+    const uint32_t offset = ((uint32_t)stringNumber * BS_NR_OF_CELL_BLOCKS_PER_STRING) +
+                            ((uint32_t)moduleNumber * BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+    pCells->pSoc_perc               = &soc_cellSoc_perc[offset];
+    pCells->pPolarizationVoltage_mV = &soc_cellPolarizationVoltage_mV[offset];
+    pCells->pCovarianceSoc          = &soc_cellCovarianceSoc[offset];
+    pCells->pCovarianceCross        = &soc_cellCovarianceCross[offset];
+    pCells->pCovariancePolarization = &soc_cellCovariancePolarization[offset];
+}
+
+static void SOC_SetStringValues(DATA_BLOCK_SOC_s *pTableSoc, uint8_t stringNumber) {
+    FAS_ASSERT(pTableSoc != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    const float_t *pSoc_perc = &soc_cellSoc_perc[(uint32_t)stringNumber * BS_NR_OF_CELL_BLOCKS_PER_STRING];
+
+    float_t minimum_perc = SOC_MAXIMUM_SOC_perc;
+    float_t maximum_perc = SOC_MINIMUM_SOC_perc;
+    float_t sum_perc     = 0.0f;
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        if (pSoc_perc[c] < minimum_perc) {
+            minimum_perc = pSoc_perc[c];
+        }
+        if (pSoc_perc[c] > maximum_perc) {
+            maximum_perc = pSoc_perc[c];
+        }
+        sum_perc += pSoc_perc[c];
+    }
+    pTableSoc->minimumSoc_perc[stringNumber] = minimum_perc;
+    pTableSoc->maximumSoc_perc[stringNumber] = maximum_perc;
+    pTableSoc->averageSoc_perc[stringNumber] = sum_perc / (float_t)BS_NR_OF_CELL_BLOCKS_PER_STRING;
+}
+
+static void SOC_UpdateNvmValues(DATA_BLOCK_SOC_s *pTableSoc, uint8_t stringNumber) {
+    FAS_ASSERT(pTableSoc != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    fram_soc.averageSoc_perc[stringNumber]        = pTableSoc->averageSoc_perc[stringNumber];
+    fram_soc.minimumSoc_perc[stringNumber]        = pTableSoc->minimumSoc_perc[stringNumber];
+    fram_soc.maximumSoc_perc[stringNumber]        = pTableSoc->maximumSoc_perc[stringNumber];
+    fram_soc.chargeThroughput_As[stringNumber]    = pTableSoc->chargeThroughput_As[stringNumber];
+    fram_soc.dischargeThroughput_As[stringNumber] = pTableSoc->dischargeThroughput_As[stringNumber];
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void SE_InitializeStateOfCharge(DATA_BLOCK_SOC_s *pSocValues, bool ccPresent, uint8_t stringNumber) {
+    FAS_ASSERT(pSocValues != NULL_PTR);
+    FAS_ASSERT((ccPresent == true) || (ccPresent == false)); /* LCOV_EXCL_LINE */
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+
+    SOC_BuildOpenCircuitVoltageTable();
+    DATA_READ_DATA(&soc_tableCurrent, &soc_tableCellVoltage);
+    FRAM_ReadData(FRAM_BLOCK_ID_SOC);
+
+    /* start from the voltage based SOC if a cell voltage measurement is
+     * available, otherwise from the last stored average SOC */
+    const bool isCellVoltageMeasured = (soc_tableCellVoltage.header.timestamp != 0u);
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        const int16_t *pCellVoltage_mV         = soc_tableCellVoltage.cellVoltage_mV[stringNumber][m];
+        const BITSET_WORD_t invalidCellVoltage = soc_tableCellVoltage.invalidCellVoltage[stringNumber][m];
+        SOC_EKF_CELLS_s cells                  = {0};
+        SOC_GetModuleCells(&cells, stringNumber, m);
+        for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+            if ((isCellVoltageMeasured == true) && (BITSET_IsBitSet(invalidCellVoltage, cb) == false)) {
+                cells.pSoc_perc[cb] = SE_GetStateOfChargeFromVoltage(pCellVoltage_mV[cb]);
+            } else {
+                cells.pSoc_perc[cb] = SOC_LimitStateOfCharge(fram_soc.averageSoc_perc[stringNumber]);
+            }
+            cells.pPolarizationVoltage_mV[cb] = 0.0f;
+            cells.pCovarianceSoc[cb]          = SOC_EKF_INITIAL_COVARIANCE_SOC_perc2;
+            cells.pCovarianceCross[cb]        = 0.0f;
+            cells.pCovariancePolarization[cb] = SOC_EKF_INITIAL_COVARIANCE_POLARIZATION_mV2;
+        }
+    }
+
+    soc_state.previousTimestamp[stringNumber] = soc_tableCurrent.timestamp[stringNumber];
+    soc_state.previousCellVoltageTimestamp    = soc_tableCellVoltage.header.timestamp;
+
+    pSocValues->chargeThroughput_As[stringNumber]    = fram_soc.chargeThroughput_As[stringNumber];
+    pSocValues->dischargeThroughput_As[stringNumber] = fram_soc.dischargeThroughput_As[stringNumber];
+    SOC_SetStringValues(pSocValues, stringNumber);
+
+    soc_state.socInitialized = true;
+}
+
+extern void SE_CalculateStateOfCharge(DATA_BLOCK_SOC_s *pSocValues) {
+    FAS_ASSERT(pSocValues != NULL_PTR);
+
+    if (soc_state.socInitialized == true) {
+        DATA_READ_DATA(&soc_tableCurrent, &soc_tableCellVoltage);
+        const bool isCellVoltageUpdated =
+            (soc_state.previousCellVoltageTimestamp != soc_tableCellVoltage.header.timestamp);
+        soc_state.previousCellVoltageTimestamp = soc_tableCellVoltage.header.timestamp;
+
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            /* check if current measurement has been updated */
+            if ((soc_state.previousTimestamp[s] != soc_tableCurrent.timestamp[s]) &&
+                (soc_tableCurrent.invalidMeasurement[s] == 0u)) {
+                const float_t timeStep_s =
+                    ((float_t)(soc_tableCurrent.timestamp[s] - soc_state.previousTimestamp[s])) / 1000.0f;
+                soc_state.previousTimestamp[s] = soc_tableCurrent.timestamp[s];
+
+                SOC_EKF_STEP_s step   = {0};
+                SOC_EKF_CELLS_s cells = {0};
+                SOC_GetStep(&step, soc_tableCurrent.current_mA[s], timeStep_s);
+                if (isCellVoltageUpdated == true) {
+                    /* one invalid flag word per module */
+                    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+                        SOC_GetModuleCells(&cells, s, m);
+                        SOC_UpdateCells(
+                            &step,
+                            &cells,
+                            soc_tableCellVoltage.cellVoltage_mV[s][m],
+                            soc_tableCellVoltage.invalidCellVoltage[s][m],
+                            BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+                    }
+                } else {
+                    SOC_GetStringCells(&cells, s);
+                    SOC_PredictCells(&step, &cells, BS_NR_OF_CELL_BLOCKS_PER_STRING);
+                }
+
+                const float_t charge_As = fabsf((float_t)soc_tableCurrent.current_mA[s] * timeStep_s / 1000.0f);
+                if (BMS_GetCurrentFlowDirection(soc_tableCurrent.current_mA[s]) == BMS_CHARGING) {
+                    pSocValues->chargeThroughput_As[s] = pSocValues->chargeThroughput_As[s] + charge_As;
+                } else {
+                    /* When BMS_DISCHARGING and BMS_AT_REST add charge to dischargeThroughput*/
+                    pSocValues->dischargeThroughput_As[s] = pSocValues->dischargeThroughput_As[s] + charge_As;
+                }
+
+                SOC_SetStringValues(pSocValues, s);
+                /* Update values in non-volatile memory */
+                SOC_UpdateNvmValues(pSocValues, s);
+            }
+        }
+        FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+    }
+}
+
+extern float_t SE_GetStateOfChargeFromVoltage(int16_t voltage_mV) {
+    float_t soc_perc = 0.50f;
+
+    /* Variables for interpolating LUT value */
+    uint16_t between_high = 0;
+    uint16_t between_low  = 0;
+
+    /* Cell voltages are inserted in LUT in descending order -> start with 1 as we do not want to extrapolate. */
+    for (uint16_t i = 1u; i < bc_stateOfChargeLookupTableLength; i++) {
+        if (voltage_mV < bc_stateOfChargeLookupTable[i].voltage_mV) {
+            between_low  = i + 1u;
+            between_high = i;
+        }
+    }
+
+    /* Interpolate between LUT values, but do not extrapolate LUT! */
+    if (!(((between_high == 0u) && (between_low == 0u)) ||       /* cell voltage > maximum LUT voltage */
+          (between_low >= bc_stateOfChargeLookupTableLength))) { /* cell voltage < minimum LUT voltage */
+        soc_perc = MATH_LinearInterpolation(
+            (float_t)bc_stateOfChargeLookupTable[between_low].voltage_mV,
+            bc_stateOfChargeLookupTable[between_low].value,
+            (float_t)bc_stateOfChargeLookupTable[between_high].voltage_mV,
+            bc_stateOfChargeLookupTable[between_high].value,
+            (float_t)voltage_mV);
+    } else if ((between_low >= bc_stateOfChargeLookupTableLength)) {
+        /* LUT SOC values are in descending order: cell voltage < minimum LUT voltage */
+        soc_perc = SOC_MINIMUM_SOC_perc;
+    } else {
+        /* cell voltage > maximum LUT voltage */
+        soc_perc = SOC_MAXIMUM_SOC_perc;
+    }
+    return soc_perc;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern bool TEST_SOC_GetSocStateInitialized(void) {
+    return soc_state.socInitialized;
+}
+extern float_t TEST_SOC_GetCellStateOfCharge(uint16_t cellIndex) {
+    FAS_ASSERT(cellIndex < BS_NR_OF_CELL_BLOCKS);
+    return soc_cellSoc_perc[cellIndex];
+}
+extern float_t TEST_SOC_GetOpenCircuitVoltage(float_t soc_perc, float_t *pSlope_mV) {
+    return SOC_GetOpenCircuitVoltage(soc_perc, pSlope_mV);
+}
+extern void TEST_SOC_BuildOpenCircuitVoltageTable(void) {
+    SOC_BuildOpenCircuitVoltageTable();
+}
+extern void TEST_SOC_GetStep(SOC_EKF_STEP_s *pStep, int32_t current_mA, float_t timeStep_s) {
+    SOC_GetStep(pStep, current_mA, timeStep_s);
+}
+extern void TEST_SOC_UpdateCells(
+    const SOC_EKF_STEP_s *pStep,
+    const SOC_EKF_CELLS_s *pCells,
+    const int16_t *pCellVoltage_mV,
+    BITSET_WORD_t invalidCellVoltage,
+    uint16_t numberOfCellBlocks) {
+    SOC_UpdateCells(pStep, pCells, pCellVoltage_mV, invalidCellVoltage, numberOfCellBlocks);
+}
+extern void TEST_SOC_PredictCells(
+    const SOC_EKF_STEP_s *pStep,
+    const SOC_EKF_CELLS_s *pCells,
+    uint16_t numberOfCellBlocks) {
+    SOC_PredictCells(pStep, pCells, numberOfCellBlocks);
+}
+extern void TEST_SOC_UpdateNvmValues(DATA_BLOCK_SOC_s *pTableSoc, uint8_t stringNumber) {
+    SOC_UpdateNvmValues(pTableSoc, stringNumber);
+}
+#endif
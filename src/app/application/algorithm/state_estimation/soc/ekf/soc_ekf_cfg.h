@@ -0,0 +1,160 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    soc_ekf_cfg.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup APPLICATION
+ * @prefix  SOC
+ *
+ * @brief   Header for the configuration of the per-cell Kalman filter SOC
+ *          estimation
+ * @details The cell is modeled as an equivalent circuit consisting of the
+ *          open-circuit voltage, a series resistance and one RC element.
+ *          The model parameters and the noise parameters of the filter are
+ *          configured in this file.
+ */
+
+#ifndef FOXBMS__SOC_EKF_CFG_H_
+#define FOXBMS__SOC_EKF_CFG_H_
+
+/*========== Includes =======================================================*/
+
+#include "battery_cell_cfg.h"
+#include "battery_system_cfg.h"
+
+#include "database.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** Capacity of one cell block in mAs */
+#define SOC_CELL_BLOCK_CAPACITY_mAs ((float_t)(BS_NR_OF_PARALLEL_CELLS_PER_CELL_BLOCK * BC_CAPACITY_mAh) * 3600.0f)
+
+/**
+ * @brief   Maximum number of cell blocks the estimation has been dimensioned
+ *          for
+ * @details The execution time of #SE_CalculateStateOfCharge() at this number
+ *          of cell blocks is verified against
+ *          #SOC_EKF_MAXIMUM_EXECUTION_TIME_us by the host benchmark
+ *          (test_soc_ekf_benchmark.c).
+ */
+#define SOC_EKF_MAXIMUM_NUMBER_OF_CELL_BLOCKS (1024u)
+
+/** Execution time budget of one estimation step of all cell blocks in us */
+#define SOC_EKF_MAXIMUM_EXECUTION_TIME_us (2000u)
+
+/** Series resistance of one cell block in mOhm */
+#define SOC_EKF_SERIES_RESISTANCE_mOhm (20.0f)
+/** Resistance of the RC element of one cell block in mOhm */
+#define SOC_EKF_POLARIZATION_RESISTANCE_mOhm (15.0f)
+/** Time constant of the RC element in s */
+#define SOC_EKF_POLARIZATION_TIME_CONSTANT_s (30.0f)
+
+/** Process noise variance of the SOC per second in %^2/s */
+#define SOC_EKF_PROCESS_NOISE_SOC_perc2 (1.0e-4f)
+/** Process noise variance of the polarization voltage per second in mV^2/s */
+#define SOC_EKF_PROCESS_NOISE_POLARIZATION_mV2 (1.0f)
+/** Measurement noise variance of the cell voltage measurement in mV^2 */
+#define SOC_EKF_MEASUREMENT_NOISE_mV2 (25.0f)
+/** Initial variance of the SOC in %^2 */
+#define SOC_EKF_INITIAL_COVARIANCE_SOC_perc2 (25.0f)
+/** Initial variance of the polarization voltage in mV^2 */
+#define SOC_EKF_INITIAL_COVARIANCE_POLARIZATION_mV2 (100.0f)
+
+/** Number of entries of the open-circuit voltage table (0% to 100% in 1% steps) */
+#define SOC_EKF_OCV_TABLE_LENGTH (101u)
+
+/**
+ * @brief   Cell states of the filter as structure-of-arrays
+ * @details Every member points to an array with one entry per cell block.
+ *          The covariance matrix is symmetric, therefore only three entries
+ *          are stored.
+ */
+typedef struct {
+    float_t *pSoc_perc;               /*!< state-of-charge */
+    float_t *pPolarizationVoltage_mV; /*!< voltage over the RC element */
+    float_t *pCovarianceSoc;          /*!< variance of the SOC */
+    float_t *pCovarianceCross;        /*!< covariance of SOC and polarization voltage */
+    float_t *pCovariancePolarization; /*!< variance of the polarization voltage */
+} SOC_EKF_CELLS_s;
+
+/** Input of one filter step that is identical for all cell blocks of a string */
+typedef struct {
+    float_t deltaSoc_perc;                /*!< SOC change caused by the current in this step */
+    float_t seriesVoltageDrop_mV;         /*!< voltage drop over the series resistance */
+    float_t polarizationDecay;            /*!< decay of the polarization voltage in this step */
+    float_t polarizationInput_mV;         /*!< polarization voltage added by the current in this step */
+    float_t processNoiseSoc_perc2;        /*!< SOC process noise of this step */
+    float_t processNoisePolarization_mV2; /*!< polarization voltage process noise of this step */
+} SOC_EKF_STEP_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern bool TEST_SOC_GetSocStateInitialized(void);
+extern float_t TEST_SOC_GetCellStateOfCharge(uint16_t cellIndex);
+extern float_t TEST_SOC_GetOpenCircuitVoltage(float_t soc_perc, float_t *pSlope_mV);
+extern void TEST_SOC_BuildOpenCircuitVoltageTable(void);
+extern void TEST_SOC_GetStep(SOC_EKF_STEP_s *pStep, int32_t current_mA, float_t timeStep_s);
+extern void TEST_SOC_UpdateCells(
+    const SOC_EKF_STEP_s *pStep,
+    const SOC_EKF_CELLS_s *pCells,
+    const int16_t *pCellVoltage_mV,
+    BITSET_WORD_t invalidCellVoltage,
+    uint16_t numberOfCellBlocks);
+extern void TEST_SOC_PredictCells(
+    const SOC_EKF_STEP_s *pStep,
+    const SOC_EKF_CELLS_s *pCells,
+    uint16_t numberOfCellBlocks);
+extern void TEST_SOC_UpdateNvmValues(DATA_BLOCK_SOC_s *pTableSoc, uint8_t stringNumber);
+#endif
+
+#endif /* FOXBMS__SOC_EKF_CFG_H_ */
@@ -43,7 +43,7 @@
  * @file    soc_lookup-table.c
  * @author  foxBMS Team
  * @date    2025-06-02 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup APPLICATION
  * @prefix  SOC
@@ -193,7 +193,7 @@ extern void SE_CalculateStateOfCharge(DATA_BLOCK_SOC_s *pSocValues) {
                 SOC_UpdateNvmValues(pSocValues, s);
             }
         }
-        FRAM_WriteData(FRAM_BLOCK_ID_SOC);
+        FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
     }
 }
 
@@ -43,7 +43,7 @@
  * @file    soe_counting.c
  * @author  foxBMS Team
  * @date    2020-10-07 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup APPLICATION
  * @prefix  SOE
@@ -80,6 +80,7 @@ typedef struct {
     float_t chargeEnergyThroughput_Wh[BS_NR_OF_STRINGS];    /*!< inflow of energy */
     float_t dischargeEnergyThroughput_Wh[BS_NR_OF_STRINGS]; /*!< outflow of energy */
     float_t previousEnergyCount_Wh[BS_NR_OF_STRINGS];
+    int64_t previousIntegratedEnergy_mWs[BS_NR_OF_STRINGS]; /*!< last used value of the software integration */
     uint32_t previousTimestamp[BS_NR_OF_STRINGS]; /*!< last used timestamp of current or energy counting value for SOE
                                                      estimation */
 } SOE_STATE_s;
@@ -102,14 +103,16 @@ static SOE_STATE_s soe_state = {
     .chargeEnergyThroughput_Wh    = {GEN_REPEAT_U(0.0f, GEN_STRIP(BS_NR_OF_STRINGS))},
     .dischargeEnergyThroughput_Wh = {GEN_REPEAT_U(0.0f, GEN_STRIP(BS_NR_OF_STRINGS))},
     .previousEnergyCount_Wh       = {GEN_REPEAT_U(0.0f, GEN_STRIP(BS_NR_OF_STRINGS))},
+    .previousIntegratedEnergy_mWs = {GEN_REPEAT_U(0, GEN_STRIP(BS_NR_OF_STRINGS))},
     .previousTimestamp            = {GEN_REPEAT_U(0u, GEN_STRIP(BS_NR_OF_STRINGS))},
 };
 
 /** local copies of database tables */
 /**@{*/
-static DATA_BLOCK_CURRENT_s soe_tableCurrent                 = {.header.uniqueId = DATA_BLOCK_ID_CURRENT};
-static DATA_BLOCK_ENERGY_COUNTER_s soe_tableEnergyCounter    = {.header.uniqueId = DATA_BLOCK_ID_ENERGY_COUNTER};
-static DATA_BLOCK_SYSTEM_VOLTAGE_1_s soe_tableSystemVoltage1 = {.header.uniqueId = DATA_BLOCK_ID_SYSTEM_VOLTAGE_1};
+static DATA_BLOCK_CURRENT_s soe_tableCurrent              = {.header.uniqueId = DATA_BLOCK_ID_CURRENT};
+static DATA_BLOCK_ENERGY_COUNTER_s soe_tableEnergyCounter = {.header.uniqueId = DATA_BLOCK_ID_ENERGY_COUNTER};
+static DATA_BLOCK_CURRENT_INTEGRATION_s soe_tableCurrentIntegration = {
+    .header.uniqueId = DATA_BLOCK_ID_CURRENT_INTEGRATION};
 /**@}*/
 
 /*========== Extern Constant and Variable Definitions =======================*/
@@ -356,6 +359,10 @@ extern void SE_InitializeStateOfEnergy(DATA_BLOCK_SOE_s *pSoeValues, bool ec_pre
         soe_state.ecScalingMinimum[stringNumber] = fram_soe.minimumSoe_perc[stringNumber] + ecOffset;
         soe_state.ecScalingMaximum[stringNumber] = fram_soe.maximumSoe_perc[stringNumber] + ecOffset;
         soe_state.ecScalingAverage[stringNumber] = fram_soe.averageSoe_perc[stringNumber] + ecOffset;
+    } else {
+        DATA_READ_DATA(&soe_tableCurrentIntegration);
+        soe_state.previousTimestamp[stringNumber]            = soe_tableCurrentIntegration.timestamp[stringNumber];
+        soe_state.previousIntegratedEnergy_mWs[stringNumber] = soe_tableCurrentIntegration.energy_mWs[stringNumber];
     }
     soe_state.soeInitialized = true;
 }
@@ -370,7 +377,7 @@ void SE_CalculateStateOfEnergy(DATA_BLOCK_SOE_s *pSoeValues) {
 
     if (continueFunction == true) {
         /* Use energy counting/integrate */
-        DATA_READ_DATA(&soe_tableCurrent, &soe_tableSystemVoltage1, &soe_tableEnergyCounter);
+        DATA_READ_DATA(&soe_tableCurrent, &soe_tableEnergyCounter, &soe_tableCurrentIntegration);
 
         if (BMS_GetBatterySystemState() == BMS_AT_REST) {
             /* Recalibrate SOE via LUT */
@@ -378,47 +385,45 @@ void SE_CalculateStateOfEnergy(DATA_BLOCK_SOE_s *pSoeValues) {
         } else {
             for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
                 if (soe_state.sensorEcUsed[s] == false) {
-                    /* no energy counting activated -> manually integrate energy */
-                    uint32_t timestamp          = soe_tableCurrent.timestamp[s];
-                    uint32_t previous_timestamp = soe_tableCurrent.previousTimestamp[s];
-
-                    /* check if current measurement has been updated */
-                    if (soe_state.previousTimestamp[s] != timestamp) {
-                        float_t time_step_s = (((float_t)timestamp - (float_t)previous_timestamp)) / 1000.0f;
-                        if (time_step_s > 0.0f) {
-                            /* Current in charge direction negative means SOE increasing --> BAT naming, not ROB */
-                            float_t deltaSOE_Wh =
-                                ((((float_t)soe_tableCurrent.current_mA[s] / 1000.0f) *             /* convert to A */
-                                  ((float_t)soe_tableSystemVoltage1.highVoltage_mV[s] / 1000.0f)) / /* convert to V */
-                                 time_step_s) /                                                     /* unit: s */
-                                3600.0f; /* convert Ws -> Wh */
-
-                            deltaSOE_Wh *= BS_CURRENT_DIRECTION_FLOAT;
-
-                            pSoeValues->averageSoe_Wh[s] -= (uint32_t)deltaSOE_Wh;
-                            pSoeValues->minimumSoe_Wh[s] -= (uint32_t)deltaSOE_Wh;
-                            pSoeValues->maximumSoe_Wh[s] -= (uint32_t)deltaSOE_Wh;
-
-                            if (BMS_GetCurrentFlowDirection(soe_tableCurrent.current_mA[s]) == BMS_CHARGING) {
-                                pSoeValues->chargeEnergyThroughput_Wh[s] = pSoeValues->chargeEnergyThroughput_Wh[s] +
-                                                                           fabs(deltaSOE_Wh);
-                            } else {
-                                /* When BMS_DISCHARGING and BMS_AT_REST add charge to dischargeThroughput*/
-                                pSoeValues->dischargeEnergyThroughput_Wh[s] =
-                                    pSoeValues->dischargeEnergyThroughput_Wh[s] + fabs(deltaSOE_Wh);
-                            }
-
-                            pSoeValues->averageSoe_perc[s] =
-                                SOE_GetStringSoePercentageFromEnergy(pSoeValues->averageSoe_Wh[s]);
-                            pSoeValues->minimumSoe_perc[s] =
-                                SOE_GetStringSoePercentageFromEnergy(pSoeValues->minimumSoe_Wh[s]);
-                            pSoeValues->maximumSoe_perc[s] =
-                                SOE_GetStringSoePercentageFromEnergy(pSoeValues->maximumSoe_Wh[s]);
-
-                            /* update timestamp SOE state variable for next iteration */
-                            soe_state.previousTimestamp[s] = timestamp;
+                    /* no energy counting activated -> use the software integration of every current sample */
+                    if (soe_state.previousTimestamp[s] != soe_tableCurrentIntegration.timestamp[s]) {
+                        const int64_t deltaEnergy_mWs = soe_tableCurrentIntegration.energy_mWs[s] -
+                                                        soe_state.previousIntegratedEnergy_mWs[s];
+                        /* convert mWs -> Wh */
+                        const float_t deltaEnergy_Wh = ((float_t)deltaEnergy_mWs / 1000.0f) / 3600.0f;
+
+                        /* Current in charge direction negative means SOE increasing --> BAT naming, not ROB */
+                        float_t deltaSoe_perc = (deltaEnergy_Wh / SOE_STRING_ENERGY_Wh) *
+                                                UNIT_CONVERSION_FACTOR_100_FLOAT;
+                        deltaSoe_perc *= BS_CURRENT_DIRECTION_FLOAT;
+
+                        pSoeValues->averageSoe_perc[s] -= deltaSoe_perc;
+                        pSoeValues->minimumSoe_perc[s] -= deltaSoe_perc;
+                        pSoeValues->maximumSoe_perc[s] -= deltaSoe_perc;
+
+                        if (BMS_GetCurrentFlowDirection(soe_tableCurrent.current_mA[s]) == BMS_CHARGING) {
+                            pSoeValues->chargeEnergyThroughput_Wh[s] = pSoeValues->chargeEnergyThroughput_Wh[s] +
+                                                                       fabs(deltaEnergy_Wh);
+                        } else {
+                            /* When BMS_DISCHARGING and BMS_AT_REST add charge to dischargeThroughput*/
+                            pSoeValues->dischargeEnergyThroughput_Wh[s] = pSoeValues->dischargeEnergyThroughput_Wh[s] +
+                                                                          fabs(deltaEnergy_Wh);
                         }
-                    } /* end check if current measurement has been updated */
+                        /* Limit SOE values to [0.0, 100.0] */
+                        SOE_CheckDatabaseSoePercentageLimits(pSoeValues, s);
+
+                        /* Calculate new Wh values */
+                        pSoeValues->maximumSoe_Wh[s] =
+                            SOE_GetStringEnergyFromSoePercentage(pSoeValues->maximumSoe_perc[s]);
+                        pSoeValues->averageSoe_Wh[s] =
+                            SOE_GetStringEnergyFromSoePercentage(pSoeValues->averageSoe_perc[s]);
+                        pSoeValues->minimumSoe_Wh[s] =
+                            SOE_GetStringEnergyFromSoePercentage(pSoeValues->minimumSoe_perc[s]);
+
+                        /* update the SOE state variables for the next iteration */
+                        soe_state.previousIntegratedEnergy_mWs[s] = soe_tableCurrentIntegration.energy_mWs[s];
+                        soe_state.previousTimestamp[s]            = soe_tableCurrentIntegration.timestamp[s];
+                    } /* end check if the software integration has been updated */
                 } else {
                     /* check if ec measurement has been updated */
                     if (soe_state.previousTimestamp[s] != soe_tableEnergyCounter.timestamp[s]) {
@@ -469,7 +474,7 @@ void SE_CalculateStateOfEnergy(DATA_BLOCK_SOE_s *pSoeValues) {
             }
 
             /* Update database and FRAM value */
-            FRAM_WriteData(FRAM_BLOCK_ID_SOE);
+            FRAM_RequestWrite(FRAM_BLOCK_ID_SOE);
         }
     }
 }
@@ -0,0 +1,613 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    sof_prediction.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup APPLICATION
+ * @prefix  SOF
+ *
+ * @brief   Per-cell SOF prediction for pulses of 2s, 10s and 30s
+ * @details All derating curves and pulse resistances are converted into
+ *          integer tables over the cell temperature in #SOF_Init(). The
+ *          cyclic calculation evaluates all cell blocks in one pass with
+ *          integer arithmetic only.
+ */
+
+/*========== Includes =======================================================*/
+#include "sof_prediction.h"
+
+#include "battery_system_cfg.h"
+
+#include "bms.h"
+#include "database.h"
+#include "fbitset.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+FAS_STATIC_ASSERT(
+    (SOF_PREDICTION_TEMPERATURE_TABLE_LENGTH ==
+     (((SOF_PREDICTION_TEMPERATURE_MAXIMUM_ddegC - SOF_PREDICTION_TEMPERATURE_MINIMUM_ddegC) /
+       SOF_PREDICTION_TEMPERATURE_STEP_ddegC) +
+      1)),
+    "The length of the temperature tables does not match the temperature range.");
+
+/** the cell blocks are indexed per string with a uint16_t */
+FAS_STATIC_ASSERT((BS_NR_OF_CELL_BLOCKS_PER_STRING <= UINT16_MAX), "Too many cell blocks per string.");
+
+/** the sum of the open-circuit voltages of a string has to fit into an int32_t */
+FAS_STATIC_ASSERT(
+    (BS_NR_OF_CELL_BLOCKS_PER_STRING <= (INT32_MAX / INT16_MAX)),
+    "Too many cell blocks per string.");
+
+/** scaling of the conductance tables, i.e., the conductance is stored in 1/256 S (= mA/mV) */
+#define SOF_CONDUCTANCE_SHIFT   (8u)
+#define SOF_CONDUCTANCE_SCALING (1u << SOF_CONDUCTANCE_SHIFT)
+
+/** sign of the measured current in discharge direction */
+#if BS_POSITIVE_DISCHARGE_CURRENT == true
+#define SOF_DISCHARGE_CURRENT_SIGN (1)
+#else
+#define SOF_DISCHARGE_CURRENT_SIGN (-1)
+#endif
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** @{
+ * module-local tables that are calculated at startup and used later to avoid
+ * floating point operations and divisions at runtime
+ */
+static int32_t sof_temperatureLimitCharge_mA[SOF_PREDICTION_TEMPERATURE_TABLE_LENGTH]                = {0};
+static int32_t sof_temperatureLimitDischarge_mA[SOF_PREDICTION_TEMPERATURE_TABLE_LENGTH]             = {0};
+static int32_t sof_conductance[SOF_NUMBER_OF_HORIZONS][SOF_PREDICTION_TEMPERATURE_TABLE_LENGTH]      = {0};
+static int32_t sof_resistance_uOhm[SOF_NUMBER_OF_HORIZONS][SOF_PREDICTION_TEMPERATURE_TABLE_LENGTH] = {0};
+static uint8_t sof_temperatureSensorOfCellBlock[BS_NR_OF_CELL_BLOCKS_PER_MODULE]                     = {0};
+/** @} */
+
+/** maximum voltage difference between the open-circuit voltage and a voltage limit */
+static int32_t sof_maximumVoltageDifference_mV = 0;
+
+/** prediction of each string of the last calculation */
+static SOF_STRING_PREDICTION_s sof_stringPrediction[BS_NR_OF_STRINGS] = {0};
+
+/** local copies of database tables */
+/**@{*/
+static DATA_BLOCK_CELL_VOLTAGE_s sof_tableCellVoltage         = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+static DATA_BLOCK_CELL_TEMPERATURE_s sof_tableCellTemperature = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+static DATA_BLOCK_CURRENT_s sof_tableCurrent                  = {.header.uniqueId = DATA_BLOCK_ID_CURRENT};
+static DATA_BLOCK_SOF_s sof_tableSofValues                    = {.header.uniqueId = DATA_BLOCK_ID_SOF};
+/**@}*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   calculates the temperature derated current
+ * @details The current is limited to lowTemperatureCurrent_mA below the low
+ *          temperature limit, rises linearly to maximumCurrent_mA at the low
+ *          temperature cutoff and falls linearly from the high temperature
+ *          cutoff to zero at the high temperature limit.
+ * @param   temperature_ddegC           cell temperature
+ * @param   limitLowTemperature_ddegC   low temperature limit
+ * @param   cutoffLowTemperature_ddegC  low temperature where the derating starts
+ * @param   cutoffHighTemperature_ddegC high temperature where the derating starts
+ * @param   limitHighTemperature_ddegC  high temperature limit
+ * @param   lowTemperatureCurrent_mA    current below the low temperature limit
+ * @param   maximumCurrent_mA           current without derating
+ * @return  derated current in mA
+ */
+static int32_t SOF_GetTemperatureDeratedCurrent(
+    int16_t temperature_ddegC,
+    int16_t limitLowTemperature_ddegC,
+    int16_t cutoffLowTemperature_ddegC,
+    int16_t cutoffHighTemperature_ddegC,
+    int16_t limitHighTemperature_ddegC,
+    int32_t lowTemperatureCurrent_mA,
+    int32_t maximumCurrent_mA);
+
+/**
+ * @brief   interpolates the temperature dependency of the cell resistance
+ * @param   temperature_ddegC   cell temperature
+ * @return  resistance relative to the resistance at 25&deg;C (1.0 at 25&deg;C)
+ */
+static float_t SOF_GetResistanceFactor(int16_t temperature_ddegC);
+
+/**
+ * @brief   calculates the index of a temperature in the temperature tables
+ * @param   temperature_ddegC   cell temperature
+ * @return  index of the table entry that is closest to the temperature
+ */
+static uint16_t SOF_GetTemperatureIndex(int16_t temperature_ddegC);
+
+/** @brief calculates the derating, conductance and resistance tables */
+static void SOF_CalculateTables(void);
+
+/**
+ * @brief   limits the voltage difference between the open-circuit voltage and
+ *          a voltage limit
+ * @details The difference is limited to the range between zero and the
+ *          difference of the voltage limits, which guarantees that the
+ *          current calculation with the conductance tables cannot overflow.
+ * @param   voltageDifference_mV    voltage difference
+ * @return  limited voltage difference in mV
+ */
+static int32_t SOF_LimitVoltageDifference(int32_t voltageDifference_mV);
+
+/**
+ * @brief   predicts the maximum charge and discharge currents of a string
+ * @details Every cell block with a valid voltage and temperature measurement
+ *          is evaluated. The open-circuit voltage is estimated from the
+ *          measured voltage and the string current. The maximum current of
+ *          each horizon is the voltage difference to the voltage limit
+ *          multiplied by the conductance of the cell block, limited by the
+ *          temperature derating. As the conductance and the derating only
+ *          depend on the temperature sensor, the currents are calculated once
+ *          per sensor for the cell block with the smallest voltage difference.
+ * @param   stringNumber    string to be evaluated
+ * @param   pPrediction     prediction of the string
+ */
+static void SOF_PredictString(uint8_t stringNumber, SOF_STRING_PREDICTION_s *pPrediction);
+
+/**
+ * @brief   predicts the string voltage at the end of a pulse
+ * @param   pPrediction         prediction of the string
+ * @param   horizon             prediction horizon
+ * @param   dischargeCurrent_mA string current, positive in discharge direction
+ * @return  predicted string voltage in mV
+ */
+static float_t SOF_GetPredictedStringVoltage_mV(
+    const SOF_STRING_PREDICTION_s *pPrediction,
+    SOF_HORIZON_e horizon,
+    int32_t dischargeCurrent_mA);
+
+/*========== Static Function Implementations ================================*/
+static int32_t SOF_GetTemperatureDeratedCurrent(
+    int16_t temperature_ddegC,
+    int16_t limitLowTemperature_ddegC,
+    int16_t cutoffLowTemperature_ddegC,
+    int16_t cutoffHighTemperature_ddegC,
+    int16_t limitHighTemperature_ddegC,
+    int32_t lowTemperatureCurrent_mA,
+    int32_t maximumCurrent_mA) {
+    FAS_ASSERT(limitLowTemperature_ddegC < cutoffLowTemperature_ddegC);
+    FAS_ASSERT(cutoffLowTemperature_ddegC <= cutoffHighTemperature_ddegC);
+    FAS_ASSERT(cutoffHighTemperature_ddegC < limitHighTemperature_ddegC);
+    /* AXIVION Routine Generic-MissingParameterAssert: temperature_ddegC: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: lowTemperatureCurrent_mA: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: maximumCurrent_mA: parameter accepts whole range */
+
+    float_t current_mA = (float_t)maximumCurrent_mA;
+    if (temperature_ddegC <= limitLowTemperature_ddegC) {
+        current_mA = (float_t)lowTemperatureCurrent_mA;
+    } else if (temperature_ddegC < cutoffLowTemperature_ddegC) {
+        const float_t ratio = (float_t)(temperature_ddegC - limitLowTemperature_ddegC) /
+                              (float_t)(cutoffLowTemperature_ddegC - limitLowTemperature_ddegC);
+        current_mA = (float_t)lowTemperatureCurrent_mA +
+                     (ratio * (float_t)(maximumCurrent_mA - lowTemperatureCurrent_mA));
+    } else if (temperature_ddegC >= limitHighTemperature_ddegC) {
+        current_mA = 0.0f;
+    } else if (temperature_ddegC > cutoffHighTemperature_ddegC) {
+        const float_t ratio = (float_t)(limitHighTemperature_ddegC - temperature_ddegC) /
+                              (float_t)(limitHighTemperature_ddegC - cutoffHighTemperature_ddegC);
+        current_mA = ratio * (float_t)maximumCurrent_mA;
+    } else {
+        /* no derating */
+    }
+    return (int32_t)current_mA;
+}
+
+static float_t SOF_GetResistanceFactor(int16_t temperature_ddegC) {
+    /* AXIVION Routine Generic-MissingParameterAssert: temperature_ddegC: parameter accepts whole range */
+    const SOF_RESISTANCE_TEMPERATURE_POINT_s *pPoints = sof_resistanceTemperatureDependency;
+
+    float_t factor_perc = (float_t)pPoints[SOF_RESISTANCE_TEMPERATURE_POINTS - 1u].resistanceFactor_perc;
+    if (temperature_ddegC <= pPoints[0u].temperature_ddegC) {
+        factor_perc = (float_t)pPoints[0u].resistanceFactor_perc;
+    } else {
+        uint8_t i = 1u;
+        while ((i < SOF_RESISTANCE_TEMPERATURE_POINTS) && (temperature_ddegC > pPoints[i].temperature_ddegC)) {
+            i++;
+        }
+        if (i < SOF_RESISTANCE_TEMPERATURE_POINTS) {
+            const float_t ratio = (float_t)(temperature_ddegC - pPoints[i - 1u].temperature_ddegC) /
+                                  (float_t)(pPoints[i].temperature_ddegC - pPoints[i - 1u].temperature_ddegC);
+            factor_perc = (float_t)pPoints[i - 1u].resistanceFactor_perc +
+                          (ratio * ((float_t)pPoints[i].resistanceFactor_perc -
+                                    (float_t)pPoints[i - 1u].resistanceFactor_perc));
+        }
+    }
+    return factor_perc / 100.0f;
+}
+
+static uint16_t SOF_GetTemperatureIndex(int16_t temperature_ddegC) {
+    /* AXIVION Routine Generic-MissingParameterAssert: temperature_ddegC: parameter accepts whole range */
+    int32_t index = ((int32_t)temperature_ddegC - SOF_PREDICTION_TEMPERATURE_MINIMUM_ddegC +
+                     (SOF_PREDICTION_TEMPERATURE_STEP_ddegC / 2)) /
+                    SOF_PREDICTION_TEMPERATURE_STEP_ddegC;
+    if (index < 0) {
+        index = 0;
+    }
+    if (index >= (int32_t)SOF_PREDICTION_TEMPERATURE_TABLE_LENGTH) {
+        index = (int32_t)SOF_PREDICTION_TEMPERATURE_TABLE_LENGTH - 1;
+    }
+    return (uint16_t)index;
+}
+
+static void SOF_CalculateTables(void) {
+    const SOF_PREDICTION_CONFIG_s *pConfig = &sof_predictionConfiguration;
+
+    sof_maximumVoltageDifference_mV = (int32_t)pConfig->limitChargeVoltage_mV - pConfig->limitDischargeVoltage_mV;
+    FAS_ASSERT(sof_maximumVoltageDifference_mV > 0);
+    /* the conductance is limited so that the current calculation cannot overflow */
+    const float_t maximumConductance = (float_t)(INT32_MAX / sof_maximumVoltageDifference_mV);
+
+    for (uint16_t i = 0u; i < SOF_PREDICTION_TEMPERATURE_TABLE_LENGTH; i++) {
+        const int16_t temperature_ddegC =
+            (int16_t)(SOF_PREDICTION_TEMPERATURE_MINIMUM_ddegC + ((int32_t)i * SOF_PREDICTION_TEMPERATURE_STEP_ddegC));
+
+        sof_temperatureLimitCharge_mA[i] = SOF_GetTemperatureDeratedCurrent(
+            temperature_ddegC,
+            pConfig->limitLowTemperatureCharge_ddegC,
+            pConfig->cutoffLowTemperatureCharge_ddegC,
+            pConfig->cutoffHighTemperatureCharge_ddegC,
+            pConfig->limitHighTemperatureCharge_ddegC,
+            0,
+            pConfig->maximumChargeCurrent_mA);
+        sof_temperatureLimitDischarge_mA[i] = SOF_GetTemperatureDeratedCurrent(
+            temperature_ddegC,
+            pConfig->limitLowTemperatureDischarge_ddegC,
+            pConfig->cutoffLowTemperatureDischarge_ddegC,
+            pConfig->cutoffHighTemperatureDischarge_ddegC,
+            pConfig->limitHighTemperatureDischarge_ddegC,
+            pConfig->limpHomeCurrent_mA,
+            pConfig->maximumDischargeCurrent_mA);
+
+        /* the parallel cells of a cell block share the current */
+        const float_t factor = SOF_GetResistanceFactor(temperature_ddegC) /
+                               (float_t)BS_NR_OF_PARALLEL_CELLS_PER_CELL_BLOCK;
+        for (uint8_t h = 0u; h < (uint8_t)SOF_NUMBER_OF_HORIZONS; h++) {
+            const float_t resistance_mOhm = sof_cellPulseResistance_mOhm[h] * factor;
+            FAS_ASSERT(resistance_mOhm > 0.0f);
+            /* 1 / (R / 1000) [S = mA/mV] */
+            const float_t conductance = fminf(
+                (1000.0f * (float_t)SOF_CONDUCTANCE_SCALING) / resistance_mOhm, maximumConductance);
+
+            sof_conductance[h][i]     = (int32_t)conductance;
+            sof_resistance_uOhm[h][i] = (int32_t)lroundf(resistance_mOhm * 1000.0f);
+        }
+    }
+
+    /* the temperature sensors are assumed to be distributed evenly over the cell blocks of a module */
+    for (uint8_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_MODULE; c++) {
+        sof_temperatureSensorOfCellBlock[c] =
+            (uint8_t)(((uint32_t)c * BS_NR_OF_TEMP_SENSORS_PER_MODULE) / BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+    }
+}
+
+static int32_t SOF_LimitVoltageDifference(int32_t voltageDifference_mV) {
+    /* AXIVION Routine Generic-MissingParameterAssert: voltageDifference_mV: parameter accepts whole range */
+    int32_t limitedVoltageDifference_mV = voltageDifference_mV;
+    if (limitedVoltageDifference_mV < 0) {
+        limitedVoltageDifference_mV = 0;
+    }
+    if (limitedVoltageDifference_mV > sof_maximumVoltageDifference_mV) {
+        limitedVoltageDifference_mV = sof_maximumVoltageDifference_mV;
+    }
+    return limitedVoltageDifference_mV;
+}
+
+/* INCLUDE MARKER FOR THE DOCUMENTATION; DO NOT MOVE prediction-documentation-start-include */
+static void SOF_PredictString(uint8_t stringNumber, SOF_STRING_PREDICTION_s *pPrediction) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    FAS_ASSERT(pPrediction != NULL_PTR);
+
+    const int32_t limitCharge_mV    = sof_predictionConfiguration.limitChargeVoltage_mV;
+    const int32_t limitDischarge_mV = sof_predictionConfiguration.limitDischargeVoltage_mV;
+
+    int32_t dischargeCurrent_mA = 0;
+    if (sof_tableCurrent.invalidMeasurement[stringNumber] == 0u) {
+        dischargeCurrent_mA = sof_tableCurrent.current_mA[stringNumber] * SOF_DISCHARGE_CURRENT_SIGN;
+    }
+
+    for (uint8_t h = 0u; h < (uint8_t)SOF_NUMBER_OF_HORIZONS; h++) {
+        pPrediction->chargeCurrent_mA[h]           = INT32_MAX;
+        pPrediction->dischargeCurrent_mA[h]        = INT32_MAX;
+        pPrediction->limitingCellBlockCharge[h]    = 0u;
+        pPrediction->limitingCellBlockDischarge[h] = 0u;
+        pPrediction->resistance_uOhm[h]            = 0;
+    }
+    pPrediction->openCircuitVoltage_mV = 0;
+    pPrediction->numberOfCellBlocks    = 0u;
+
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        /* The conductance and the temperature limit only depend on the temperature sensor and the current increases
+         * with the voltage difference. It is therefore sufficient to find the minimum voltage difference of the
+         * cell blocks of each sensor and to evaluate the horizons once per sensor. */
+        int32_t minimumCharge_mV[BS_NR_OF_TEMP_SENSORS_PER_MODULE]    = {0};
+        int32_t minimumDischarge_mV[BS_NR_OF_TEMP_SENSORS_PER_MODULE] = {0};
+        uint16_t limitingCharge[BS_NR_OF_TEMP_SENSORS_PER_MODULE]     = {0u};
+        uint16_t limitingDischarge[BS_NR_OF_TEMP_SENSORS_PER_MODULE]  = {0u};
+        uint16_t numberOfCellBlocks[BS_NR_OF_TEMP_SENSORS_PER_MODULE] = {0u};
+        uint16_t temperatureIndex[BS_NR_OF_TEMP_SENSORS_PER_MODULE]   = {0u};
+        int32_t ohmicVoltage_mV[BS_NR_OF_TEMP_SENSORS_PER_MODULE]     = {0};
+        bool isTemperatureValid[BS_NR_OF_TEMP_SENSORS_PER_MODULE]     = {false};
+
+        const uint16_t cellBlockOffset             = (uint16_t)((uint16_t)m * BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+        const BITSET_WORD_t invalidCellTemperature = sof_tableCellTemperature.invalidCellTemperature[stringNumber][m];
+        for (uint8_t t = 0u; t < BS_NR_OF_TEMP_SENSORS_PER_MODULE; t++) {
+            const int16_t temperature_ddegC = sof_tableCellTemperature.cellTemperature_ddegC[stringNumber][m][t];
+            const uint16_t i                = SOF_GetTemperatureIndex(temperature_ddegC);
+            const int64_t voltage_nV        = (int64_t)dischargeCurrent_mA * sof_resistance_uOhm[SOF_HORIZON_2s][i];
+
+            minimumCharge_mV[t]    = INT32_MAX;
+            minimumDischarge_mV[t] = INT32_MAX;
+            temperatureIndex[t]    = i;
+            ohmicVoltage_mV[t]     = (int32_t)(voltage_nV / 1000000);
+            isTemperatureValid[t]  = (BITSET_IsBitSet(invalidCellTemperature, t) == false);
+        }
+
+        const int16_t *pCellVoltage_mV         = sof_tableCellVoltage.cellVoltage_mV[stringNumber][m];
+        const BITSET_WORD_t invalidCellVoltage = sof_tableCellVoltage.invalidCellVoltage[stringNumber][m];
+        for (uint8_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_MODULE; c++) {
+            const uint8_t t = sof_temperatureSensorOfCellBlock[c];
+            if ((BITSET_IsBitSet(invalidCellVoltage, c) == false) && (isTemperatureValid[t] == true)) {
+                const int32_t openCircuitVoltage_mV = (int32_t)pCellVoltage_mV[c] + ohmicVoltage_mV[t];
+
+                /* voltage difference to the limits, limited once per sensor */
+                const int32_t charge_mV    = limitCharge_mV - openCircuitVoltage_mV;
+                const int32_t discharge_mV = openCircuitVoltage_mV - limitDischarge_mV;
+                if (charge_mV < minimumCharge_mV[t]) {
+                    minimumCharge_mV[t] = charge_mV;
+                    limitingCharge[t]   = (uint16_t)(cellBlockOffset + c);
+                }
+                if (discharge_mV < minimumDischarge_mV[t]) {
+                    minimumDischarge_mV[t] = discharge_mV;
+                    limitingDischarge[t]   = (uint16_t)(cellBlockOffset + c);
+                }
+                numberOfCellBlocks[t]++;
+                pPrediction->openCircuitVoltage_mV += openCircuitVoltage_mV;
+            }
+        }
+
+        for (uint8_t t = 0u; t < BS_NR_OF_TEMP_SENSORS_PER_MODULE; t++) {
+            if (numberOfCellBlocks[t] > 0u) {
+                const uint16_t i           = temperatureIndex[t];
+                const int32_t charge_mV    = SOF_LimitVoltageDifference(minimumCharge_mV[t]);
+                const int32_t discharge_mV = SOF_LimitVoltageDifference(minimumDischarge_mV[t]);
+                for (uint8_t h = 0u; h < (uint8_t)SOF_NUMBER_OF_HORIZONS; h++) {
+                    /* both factors are positive and the product cannot overflow (see SOF_CalculateTables) */
+                    const uint32_t conductance = (uint32_t)sof_conductance[h][i];
+
+                    int32_t charge_mA    = (int32_t)(((uint32_t)charge_mV * conductance) >> SOF_CONDUCTANCE_SHIFT);
+                    int32_t discharge_mA = (int32_t)(((uint32_t)discharge_mV * conductance) >> SOF_CONDUCTANCE_SHIFT);
+                    if (charge_mA > sof_temperatureLimitCharge_mA[i]) {
+                        charge_mA = sof_temperatureLimitCharge_mA[i];
+                    }
+                    if (discharge_mA > sof_temperatureLimitDischarge_mA[i]) {
+                        discharge_mA = sof_temperatureLimitDischarge_mA[i];
+                    }
+                    if (charge_mA < pPrediction->chargeCurrent_mA[h]) {
+                        pPrediction->chargeCurrent_mA[h]        = charge_mA;
+                        pPrediction->limitingCellBlockCharge[h] = limitingCharge[t];
+                    }
+                    if (discharge_mA < pPrediction->dischargeCurrent_mA[h]) {
+                        pPrediction->dischargeCurrent_mA[h]        = discharge_mA;
+                        pPrediction->limitingCellBlockDischarge[h] = limitingDischarge[t];
+                    }
+                    pPrediction->resistance_uOhm[h] += (int32_t)numberOfCellBlocks[t] * sof_resistance_uOhm[h][i];
+                }
+                pPrediction->numberOfCellBlocks += numberOfCellBlocks[t];
+            }
+        }
+    }
+
+    /* no current is allowed without any valid measurement */
+    if (pPrediction->numberOfCellBlocks == 0u) {
+        for (uint8_t h = 0u; h < (uint8_t)SOF_NUMBER_OF_HORIZONS; h++) {
+            pPrediction->chargeCurrent_mA[h]    = 0;
+            pPrediction->dischargeCurrent_mA[h] = 0;
+        }
+    }
+}
+/* INCLUDE MARKER FOR THE DOCUMENTATION; DO NOT MOVE prediction-documentation-stop-include */
+
+static float_t SOF_GetPredictedStringVoltage_mV(
+    const SOF_STRING_PREDICTION_s *pPrediction,
+    SOF_HORIZON_e horizon,
+    int32_t dischargeCurrent_mA) {
+    FAS_ASSERT(pPrediction != NULL_PTR);
+    FAS_ASSERT(horizon < SOF_NUMBER_OF_HORIZONS);
+    /* AXIVION Routine Generic-MissingParameterAssert: dischargeCurrent_mA: parameter accepts whole range */
+    return (float_t)pPrediction->openCircuitVoltage_mV -
+           (((float_t)dischargeCurrent_mA * (float_t)pPrediction->resistance_uOhm[horizon]) / 1000000.0f);
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void SOF_Init(void) {
+    SOF_CalculateTables();
+}
+
+extern void SOF_Calculation(void) {
+    DATA_READ_DATA(&sof_tableCellVoltage, &sof_tableCellTemperature, &sof_tableCurrent);
+
+    uint8_t nrClosedStrings                             = 0u;
+    int32_t minimumCharge_mA[SOF_NUMBER_OF_HORIZONS]    = {0};
+    int32_t minimumDischarge_mA[SOF_NUMBER_OF_HORIZONS] = {0};
+    for (uint8_t h = 0u; h < (uint8_t)SOF_NUMBER_OF_HORIZONS; h++) {
+        minimumCharge_mA[h]    = (int32_t)BS_MAXIMUM_STRING_CURRENT_mA;
+        minimumDischarge_mA[h] = (int32_t)BS_MAXIMUM_STRING_CURRENT_mA;
+    }
+
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        SOF_STRING_PREDICTION_s *pPrediction = &sof_stringPrediction[s];
+        if (BMS_IsStringClosed(s) == true) {
+            SOF_PredictString(s, pPrediction);
+            nrClosedStrings++;
+            for (uint8_t h = 0u; h < (uint8_t)SOF_NUMBER_OF_HORIZONS; h++) {
+                if (pPrediction->chargeCurrent_mA[h] < minimumCharge_mA[h]) {
+                    minimumCharge_mA[h] = pPrediction->chargeCurrent_mA[h];
+                }
+                if (pPrediction->dischargeCurrent_mA[h] < minimumDischarge_mA[h]) {
+                    minimumDischarge_mA[h] = pPrediction->dischargeCurrent_mA[h];
+                }
+            }
+        } else {
+            for (uint8_t h = 0u; h < (uint8_t)SOF_NUMBER_OF_HORIZONS; h++) {
+                pPrediction->chargeCurrent_mA[h]           = 0;
+                pPrediction->dischargeCurrent_mA[h]        = 0;
+                pPrediction->limitingCellBlockCharge[h]    = 0u;
+                pPrediction->limitingCellBlockDischarge[h] = 0u;
+            }
+            pPrediction->numberOfCellBlocks = 0u;
+        }
+
+        sof_tableSofValues.recommendedContinuousChargeCurrent_mA[s] =
+            (float_t)pPrediction->chargeCurrent_mA[SOF_HORIZON_30s];
+        sof_tableSofValues.recommendedContinuousDischargeCurrent_mA[s] =
+            (float_t)pPrediction->dischargeCurrent_mA[SOF_HORIZON_30s];
+        sof_tableSofValues.recommendedPeakChargeCurrent_mA[s] = (float_t)pPrediction->chargeCurrent_mA[SOF_HORIZON_2s];
+        sof_tableSofValues.recommendedPeakDischargeCurrent_mA[s] =
+            (float_t)pPrediction->dischargeCurrent_mA[SOF_HORIZON_2s];
+        sof_tableSofValues.limitingCellBlockCharge[s] = pPrediction->limitingCellBlockCharge[SOF_HORIZON_30s];
+        sof_tableSofValues.limitingCellBlockDischarge[s] =
+            pPrediction->limitingCellBlockDischarge[SOF_HORIZON_30s];
+    }
+
+    /* Compute recommended pack values: all closed strings carry the current of the weakest string */
+    float_t packCharge_mA[SOF_NUMBER_OF_HORIZONS]    = {0.0f};
+    float_t packDischarge_mA[SOF_NUMBER_OF_HORIZONS] = {0.0f};
+    float_t chargePower_W[SOF_NUMBER_OF_HORIZONS]    = {0.0f};
+    float_t dischargePower_W[SOF_NUMBER_OF_HORIZONS] = {0.0f};
+    for (uint8_t h = 0u; h < (uint8_t)SOF_NUMBER_OF_HORIZONS; h++) {
+        float_t chargeVoltage_mV    = 0.0f;
+        float_t dischargeVoltage_mV = 0.0f;
+        bool isFirstString          = true;
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            const SOF_STRING_PREDICTION_s *pPrediction = &sof_stringPrediction[s];
+            if (pPrediction->numberOfCellBlocks > 0u) {
+                const float_t charge_mV =
+                    SOF_GetPredictedStringVoltage_mV(pPrediction, (SOF_HORIZON_e)h, -minimumCharge_mA[h]);
+                const float_t discharge_mV =
+                    SOF_GetPredictedStringVoltage_mV(pPrediction, (SOF_HORIZON_e)h, minimumDischarge_mA[h]);
+                if ((isFirstString == true) || (charge_mV < chargeVoltage_mV)) {
+                    chargeVoltage_mV = charge_mV;
+                }
+                if ((isFirstString == true) || (discharge_mV < dischargeVoltage_mV)) {
+                    dischargeVoltage_mV = discharge_mV;
+                }
+                isFirstString = false;
+            }
+        }
+        packCharge_mA[h]    = (float_t)nrClosedStrings * (float_t)minimumCharge_mA[h];
+        packDischarge_mA[h] = (float_t)nrClosedStrings * (float_t)minimumDischarge_mA[h];
+        chargePower_W[h]    = (packCharge_mA[h] * chargeVoltage_mV) / 1000000.0f;
+        dischargePower_W[h] = (packDischarge_mA[h] * dischargeVoltage_mV) / 1000000.0f;
+    }
+
+    /* Check if currently a transition into ERROR state in the BMS state
+     * machine is ongoing. Set allowed current to 0 if this is the case.
+     */
+    if (BMS_IsTransitionToErrorStateActive() == true) {
+        for (uint8_t h = 0u; h < (uint8_t)SOF_NUMBER_OF_HORIZONS; h++) {
+            packCharge_mA[h]    = 0.0f;
+            packDischarge_mA[h] = 0.0f;
+            chargePower_W[h]    = 0.0f;
+            dischargePower_W[h] = 0.0f;
+        }
+    }
+
+    sof_tableSofValues.recommendedContinuousPackChargeCurrent_mA    = packCharge_mA[SOF_HORIZON_30s];
+    sof_tableSofValues.recommendedContinuousPackDischargeCurrent_mA = packDischarge_mA[SOF_HORIZON_30s];
+    sof_tableSofValues.recommendedPeakPackChargeCurrent_mA          = packCharge_mA[SOF_HORIZON_2s];
+    sof_tableSofValues.recommendedPeakPackDischargeCurrent_mA       = packDischarge_mA[SOF_HORIZON_2s];
+    sof_tableSofValues.predictedPackChargePower2s_W                 = chargePower_W[SOF_HORIZON_2s];
+    sof_tableSofValues.predictedPackChargePower10s_W                = chargePower_W[SOF_HORIZON_10s];
+    sof_tableSofValues.predictedPackChargePower30s_W                = chargePower_W[SOF_HORIZON_30s];
+    sof_tableSofValues.predictedPackDischargePower2s_W              = dischargePower_W[SOF_HORIZON_2s];
+    sof_tableSofValues.predictedPackDischargePower10s_W             = dischargePower_W[SOF_HORIZON_10s];
+    sof_tableSofValues.predictedPackDischargePower30s_W             = dischargePower_W[SOF_HORIZON_30s];
+
+    DATA_WRITE_DATA(&sof_tableSofValues);
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern int32_t TEST_SOF_GetTemperatureDeratedCurrent(
+    int16_t temperature_ddegC,
+    int16_t limitLowTemperature_ddegC,
+    int16_t cutoffLowTemperature_ddegC,
+    int16_t cutoffHighTemperature_ddegC,
+    int16_t limitHighTemperature_ddegC,
+    int32_t lowTemperatureCurrent_mA,
+    int32_t maximumCurrent_mA) {
+    return SOF_GetTemperatureDeratedCurrent(
+        temperature_ddegC,
+        limitLowTemperature_ddegC,
+        cutoffLowTemperature_ddegC,
+        cutoffHighTemperature_ddegC,
+        limitHighTemperature_ddegC,
+        lowTemperatureCurrent_mA,
+        maximumCurrent_mA);
+}
+extern float_t TEST_SOF_GetResistanceFactor(int16_t temperature_ddegC) {
+    return SOF_GetResistanceFactor(temperature_ddegC);
+}
+extern uint16_t TEST_SOF_GetTemperatureIndex(int16_t temperature_ddegC) {
+    return SOF_GetTemperatureIndex(temperature_ddegC);
+}
+extern void TEST_SOF_PredictString(uint8_t stringNumber, SOF_STRING_PREDICTION_s *pPrediction) {
+    SOF_PredictString(stringNumber, pPrediction);
+}
+extern int32_t TEST_SOF_GetConductance(SOF_HORIZON_e horizon, uint16_t temperatureIndex) {
+    return sof_conductance[horizon][temperatureIndex];
+}
+extern int32_t TEST_SOF_GetTemperatureLimitCharge_mA(uint16_t temperatureIndex) {
+    return sof_temperatureLimitCharge_mA[temperatureIndex];
+}
+extern int32_t TEST_SOF_GetTemperatureLimitDischarge_mA(uint16_t temperatureIndex) {
+    return sof_temperatureLimitDischarge_mA[temperatureIndex];
+}
+#endif
@@ -0,0 +1,101 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    sof_prediction.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup APPLICATION
+ * @prefix  SOF
+ *
+ * @brief   Header for the per-cell SOF prediction
+ * @details The maximum charge and discharge current is predicted for every
+ *          cell block for pulses of 2s, 10s and 30s from its voltage,
+ *          temperature and pulse resistance.
+ */
+
+#ifndef FOXBMS__SOF_PREDICTION_H_
+#define FOXBMS__SOF_PREDICTION_H_
+
+/*========== Includes =======================================================*/
+#include "sof_prediction_cfg.h"
+
+#include "sof.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** result of the prediction of one string */
+typedef struct {
+    int32_t chargeCurrent_mA[SOF_NUMBER_OF_HORIZONS];            /*!< maximum charge current of the string */
+    int32_t dischargeCurrent_mA[SOF_NUMBER_OF_HORIZONS];         /*!< maximum discharge current of the string */
+    uint16_t limitingCellBlockCharge[SOF_NUMBER_OF_HORIZONS];    /*!< cell block limiting the charge current */
+    uint16_t limitingCellBlockDischarge[SOF_NUMBER_OF_HORIZONS]; /*!< cell block limiting the discharge current */
+    int32_t openCircuitVoltage_mV;                               /*!< sum of the open-circuit voltages */
+    int32_t resistance_uOhm[SOF_NUMBER_OF_HORIZONS];             /*!< sum of the pulse resistances */
+    uint16_t numberOfCellBlocks;                                 /*!< number of cell blocks with valid measurements */
+} SOF_STRING_PREDICTION_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern int32_t TEST_SOF_GetTemperatureDeratedCurrent(
+    int16_t temperature_ddegC,
+    int16_t limitLowTemperature_ddegC,
+    int16_t cutoffLowTemperature_ddegC,
+    int16_t cutoffHighTemperature_ddegC,
+    int16_t limitHighTemperature_ddegC,
+    int32_t lowTemperatureCurrent_mA,
+    int32_t maximumCurrent_mA);
+extern float_t TEST_SOF_GetResistanceFactor(int16_t temperature_ddegC);
+extern uint16_t TEST_SOF_GetTemperatureIndex(int16_t temperature_ddegC);
+extern void TEST_SOF_PredictString(uint8_t stringNumber, SOF_STRING_PREDICTION_s *pPrediction);
+extern int32_t TEST_SOF_GetConductance(SOF_HORIZON_e horizon, uint16_t temperatureIndex);
+extern int32_t TEST_SOF_GetTemperatureLimitCharge_mA(uint16_t temperatureIndex);
+extern int32_t TEST_SOF_GetTemperatureLimitDischarge_mA(uint16_t temperatureIndex);
+#endif
+
+#endif /* FOXBMS__SOF_PREDICTION_H_ */
@@ -0,0 +1,105 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    sof_prediction_cfg.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup APPLICATION_CONFIGURATION
+ * @prefix  SOF
+ *
+ * @brief   Configuration of the per-cell SOF prediction
+ * @details TODO
+ */
+
+/*========== Includes =======================================================*/
+#include "sof_prediction_cfg.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+const SOF_PREDICTION_CONFIG_s sof_predictionConfiguration = {
+    .maximumChargeCurrent_mA              = SOF_CELL_BLOCK_CURRENT_CHARGE_mA,
+    .maximumDischargeCurrent_mA           = SOF_CELL_BLOCK_CURRENT_DISCHARGE_mA,
+    .limpHomeCurrent_mA                   = SOF_CELL_BLOCK_CURRENT_LIMP_HOME_mA,
+    .cutoffLowTemperatureDischarge_ddegC  = BC_TEMPERATURE_MIN_DISCHARGE_MOL_ddegC,
+    .limitLowTemperatureDischarge_ddegC   = BC_TEMPERATURE_MIN_DISCHARGE_MSL_ddegC,
+    .cutoffLowTemperatureCharge_ddegC     = BC_TEMPERATURE_MIN_CHARGE_MOL_ddegC,
+    .limitLowTemperatureCharge_ddegC      = BC_TEMPERATURE_MIN_CHARGE_MSL_ddegC,
+    .cutoffHighTemperatureDischarge_ddegC = BC_TEMPERATURE_MAX_DISCHARGE_MOL_ddegC,
+    .limitHighTemperatureDischarge_ddegC  = BC_TEMPERATURE_MAX_DISCHARGE_MSL_ddegC,
+    .cutoffHighTemperatureCharge_ddegC    = BC_TEMPERATURE_MAX_CHARGE_MOL_ddegC,
+    .limitHighTemperatureCharge_ddegC     = BC_TEMPERATURE_MAX_CHARGE_MSL_ddegC,
+    .limitChargeVoltage_mV                = SOF_PREDICTION_VOLTAGE_LIMIT_CHARGE_mV,
+    .limitDischargeVoltage_mV             = SOF_PREDICTION_VOLTAGE_LIMIT_DISCHARGE_mV,
+};
+
+const float_t sof_cellPulseResistance_mOhm[SOF_NUMBER_OF_HORIZONS] = {
+    SOF_CELL_RESISTANCE_2s_mOhm,
+    SOF_CELL_RESISTANCE_10s_mOhm,
+    SOF_CELL_RESISTANCE_30s_mOhm,
+};
+
+const SOF_RESISTANCE_TEMPERATURE_POINT_s sof_resistanceTemperatureDependency[SOF_RESISTANCE_TEMPERATURE_POINTS] = {
+    {.temperature_ddegC = -200, .resistanceFactor_perc = 400u},
+    {.temperature_ddegC = -100, .resistanceFactor_perc = 250u},
+    {.temperature_ddegC = 0, .resistanceFactor_perc = 170u},
+    {.temperature_ddegC = 100, .resistanceFactor_perc = 125u},
+    {.temperature_ddegC = 250, .resistanceFactor_perc = 100u},
+    {.temperature_ddegC = 450, .resistanceFactor_perc = 90u},
+    {.temperature_ddegC = 550, .resistanceFactor_perc = 90u},
+};
+
+/*========== Static Function Prototypes =====================================*/
+
+/*========== Static Function Implementations ================================*/
+
+/*========== Extern Function Implementations ================================*/
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
@@ -0,0 +1,189 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    sof_prediction_cfg.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup APPLICATION_CONFIGURATION
+ * @prefix  SOF
+ *
+ * @brief   Configuration of the per-cell SOF prediction
+ * @details The derating limits are the same as for the trapezoid SOF. In
+ *          addition, the pulse resistance of a cell for the prediction
+ *          horizons and its dependency on the temperature are configured.
+ */
+
+#ifndef FOXBMS__SOF_PREDICTION_CFG_H_
+#define FOXBMS__SOF_PREDICTION_CFG_H_
+
+/*========== Includes =======================================================*/
+
+#include "battery_cell_cfg.h"
+#include "battery_system_cfg.h"
+
+#include <math.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/**
+ * @brief   Maximum number of cell blocks the SOF prediction is designed for
+ * @details One call of #SOF_Calculation() has to finish within
+ *          #SOF_PREDICTION_MAXIMUM_EXECUTION_TIME_us for this number of cell
+ *          blocks. This is verified by the host benchmark
+ *          (test_sof_prediction_benchmark.c).
+ */
+#define SOF_PREDICTION_MAXIMUM_NUMBER_OF_CELL_BLOCKS (1024u)
+/** Execution time budget of one call of #SOF_Calculation() in us (10% of the 10ms task) */
+#define SOF_PREDICTION_MAXIMUM_EXECUTION_TIME_us (1000u)
+
+/** Maximum continuous charge current of a cell block in mA */
+#define SOF_CELL_BLOCK_CURRENT_CHARGE_mA \
+    ((int32_t)BC_CURRENT_MAX_CHARGE_MOL_mA * BS_NR_OF_PARALLEL_CELLS_PER_CELL_BLOCK)
+/** Maximum continuous discharge current of a cell block in mA */
+#define SOF_CELL_BLOCK_CURRENT_DISCHARGE_mA \
+    ((int32_t)BC_CURRENT_MAX_DISCHARGE_MOL_mA * BS_NR_OF_PARALLEL_CELLS_PER_CELL_BLOCK)
+/**
+ * Current in mA that a cell block should be able to discharge when in limp
+ * home mode, i.e., at low temperatures.
+ */
+#define SOF_CELL_BLOCK_CURRENT_LIMP_HOME_mA (20000)
+
+/**
+ * @brief   Voltage limits for the prediction
+ * @details The predicted cell voltage at the end of a charge (discharge)
+ *          pulse must not exceed (fall below) these limits.
+ */
+/**@{*/
+#define SOF_PREDICTION_VOLTAGE_LIMIT_CHARGE_mV    (BC_VOLTAGE_MAX_MOL_mV)
+#define SOF_PREDICTION_VOLTAGE_LIMIT_DISCHARGE_mV (BC_VOLTAGE_MIN_MOL_mV)
+/**@}*/
+
+/**
+ * @brief   Pulse resistance of one cell at 25&deg;C in mOhm
+ * @details Resistance that describes the voltage change at the end of a
+ *          constant current pulse of the respective duration, i.e., the
+ *          ohmic and the polarization part. The resistance of the shortest
+ *          horizon is also used to estimate the open-circuit voltage from
+ *          the measured cell voltage.
+ */
+/**@{*/
+#define SOF_CELL_RESISTANCE_2s_mOhm  (1.5f)
+#define SOF_CELL_RESISTANCE_10s_mOhm (1.9f)
+#define SOF_CELL_RESISTANCE_30s_mOhm (2.4f)
+/**@}*/
+
+/**
+ * @brief   Range and resolution of the temperature tables
+ * @details Temperatures outside of the range use the first or last entry.
+ */
+/**@{*/
+#define SOF_PREDICTION_TEMPERATURE_MINIMUM_ddegC (-200)
+#define SOF_PREDICTION_TEMPERATURE_MAXIMUM_ddegC (550)
+#define SOF_PREDICTION_TEMPERATURE_STEP_ddegC    (10)
+#define SOF_PREDICTION_TEMPERATURE_TABLE_LENGTH  (76u)
+/**@}*/
+
+/** Number of points of the temperature dependency of the cell resistance */
+#define SOF_RESISTANCE_TEMPERATURE_POINTS (7u)
+
+/** prediction horizons */
+typedef enum {
+    SOF_HORIZON_2s,  /*!< 2s pulse, reported as peak current */
+    SOF_HORIZON_10s, /*!< 10s pulse */
+    SOF_HORIZON_30s, /*!< 30s pulse, reported as continuous current */
+    SOF_NUMBER_OF_HORIZONS,
+} SOF_HORIZON_e;
+
+/** point of the temperature dependency of the cell resistance */
+typedef struct {
+    int16_t temperature_ddegC;      /*!< cell temperature */
+    uint16_t resistanceFactor_perc; /*!< resistance relative to the resistance at 25&deg;C */
+} SOF_RESISTANCE_TEMPERATURE_POINT_s;
+
+/** configuration of the SOF prediction */
+typedef struct {
+    /** Current limits of a cell block @{ */
+    int32_t maximumChargeCurrent_mA;
+    int32_t maximumDischargeCurrent_mA;
+    int32_t limpHomeCurrent_mA;
+    /**@}*/
+
+    /** Temperature derating limits @{ */
+    int16_t cutoffLowTemperatureDischarge_ddegC;
+    int16_t limitLowTemperatureDischarge_ddegC;
+    int16_t cutoffLowTemperatureCharge_ddegC;
+    int16_t limitLowTemperatureCharge_ddegC;
+    int16_t cutoffHighTemperatureDischarge_ddegC;
+    int16_t limitHighTemperatureDischarge_ddegC;
+    int16_t cutoffHighTemperatureCharge_ddegC;
+    int16_t limitHighTemperatureCharge_ddegC;
+    /**@}*/
+
+    /** Voltage limits of the prediction @{ */
+    int16_t limitChargeVoltage_mV;
+    int16_t limitDischargeVoltage_mV;
+    /**@}*/
+
+} SOF_PREDICTION_CONFIG_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+/** Configuration values of the SOF prediction */
+extern const SOF_PREDICTION_CONFIG_s sof_predictionConfiguration;
+
+/** Pulse resistance of a cell at 25&deg;C for each prediction horizon */
+extern const float_t sof_cellPulseResistance_mOhm[SOF_NUMBER_OF_HORIZONS];
+
+/**
+ * Temperature dependency of the cell resistance, sorted by ascending
+ * temperature. The factor is interpolated linearly between the points.
+ */
+extern const SOF_RESISTANCE_TEMPERATURE_POINT_s sof_resistanceTemperatureDependency[SOF_RESISTANCE_TEMPERATURE_POINTS];
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+#endif
+
+#endif /* FOXBMS__SOF_PREDICTION_CFG_H_ */
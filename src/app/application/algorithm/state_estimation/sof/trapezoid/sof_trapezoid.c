@@ -43,7 +43,7 @@
  * @file    sof_trapezoid.c
  * @author  foxBMS Team
  * @date    2020-10-07 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup APPLICATION_CONFIGURATION
  * @prefix  SOF
@@ -347,6 +347,10 @@ static SOF_CURRENT_LIMITS_s SOF_MinimumOfTwoSofValues(
 }
 
 /*========== Extern Function Implementations ================================*/
+/* Pseudocode for linear function parameter extraction with 2 points:
+ * - slope = (y2 - y1) / (x2-x1)
+ * - offset = y1 - (slope) * x1
+ * - function y= slope * x + offset */
 extern void SOF_Init(void) {
     /* Calculating SOF curve for the recommended operating current */
     SOF_CalculateCurves(&sof_recommendedCurrent, &sof_curveRecommendedOperatingCurrent);
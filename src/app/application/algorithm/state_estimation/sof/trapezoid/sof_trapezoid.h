@@ -43,7 +43,7 @@
  * @file    sof_trapezoid.h
  * @author  foxBMS Team
  * @date    2020-10-07 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup APPLICATION
  * @prefix  SOF
@@ -58,6 +58,8 @@
 /*========== Includes =======================================================*/
 #include "sof_trapezoid_cfg.h"
 
+#include "sof.h"
+
 #include <math.h>
 #include <stdint.h>
 
@@ -97,22 +99,6 @@ typedef struct {
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
-/**
- * @brief   initializes the area for SOF (where derating starts and is fully
- *          active).
- * @details Pseudocode for linear function parameter extraction with 2 points:
- *          - slope = (y2 - y1) / (x2-x1)
- *          - offset = y1 - (slope) * x1
- *          - function y= slope * x + offset
- */
-extern void SOF_Init(void);
-
-/**
- * @brief   triggers SOF calculation
- * @details TODO
- */
-extern void SOF_Calculation(void);
-
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
 extern void TEST_SOF_CalculateVoltageBasedCurrentLimit(
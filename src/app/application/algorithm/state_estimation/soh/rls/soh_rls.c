@@ -0,0 +1,588 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    soh_rls.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup APPLICATION
+ * @prefix  SOH
+ *
+ * @brief   SOH module responsible for the per-cell calculation of the
+ *          state-of-health (SOH) with recursive least-squares estimators
+ * @details The internal resistance of every cell block is estimated from the
+ *          change of the cell voltage at a change of the string current.
+ *          The capacity of every cell block is estimated from the charge
+ *          that has been moved between two rest points and the difference of
+ *          the SOC that is determined from the open-circuit voltage at these
+ *          rest points.
+ *          Both estimators are scalar, i.e., the memory and the execution
+ *          time per cell block and update are constant.
+ */
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+#include "soh_rls_cfg.h"
+
+#include "bms.h"
+#include "database.h"
+#include "fbitset.h"
+#include "foxmath.h"
+#include "fram.h"
+#include "state_estimation.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** This structure contains all the variables relevant for the SOH */
+typedef struct {
+    bool sohInitialized;                                  /*!< true if the initialization has passed */
+    uint32_t previousCellVoltageTimestamp;                /*!< timestamp of the last cell voltage update */
+    uint32_t previousNvmWriteTimestamp;                   /*!< timestamp of the last write to the FRAM */
+    uint32_t previousCurrentTimestamp[BS_NR_OF_STRINGS];  /*!< timestamp of the last current update */
+    float_t previousCurrent_mA[BS_NR_OF_STRINGS];         /*!< discharge current at the last voltage update */
+    bool isPreviousCurrentValid[BS_NR_OF_STRINGS];        /*!< true if the previous current is usable */
+    bool isRestPointSet[BS_NR_OF_STRINGS];                /*!< true if the SOC at a rest point is known */
+    bool isCurrentCounterUsed[BS_NR_OF_STRINGS];          /*!< true if the current counter is used */
+    int32_t restPointCurrentCounter_As[BS_NR_OF_STRINGS]; /*!< current counter at the last rest point */
+    float_t chargeSinceRestPoint_mAs[BS_NR_OF_STRINGS];   /*!< integrated discharge since the rest point */
+} SOH_STATE_s;
+
+/** Maximum SOH in percentage */
+#define SOH_MAXIMUM_SOH_perc (100.0f)
+/** Minimum SOH in percentage */
+#define SOH_MINIMUM_SOH_perc (0.0f)
+
+/** Marker for a cell block without a valid SOC at the last rest point */
+#define SOH_INVALID_SOC_perc (-1.0f)
+/** Marker for a cell block without a valid previous voltage measurement */
+#define SOH_INVALID_VOLTAGE_mV (INT16_MIN)
+
+/** Seconds per hour to convert mAs to mAh */
+#define SOH_SECONDS_PER_HOUR (3600.0f)
+
+FAS_STATIC_ASSERT(
+    (BS_NR_OF_CELL_BLOCKS <= (uint16_t)UINT16_MAX),
+    "This code assumes BS_NR_OF_CELL_BLOCKS fits into uint16_t");
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** state variable for SOH module */
+static SOH_STATE_s soh_state = {
+    .sohInitialized               = false,
+    .previousCellVoltageTimestamp = 0u,
+    .previousNvmWriteTimestamp    = 0u,
+    .previousCurrentTimestamp     = {GEN_REPEAT_U(0u, GEN_STRIP(BS_NR_OF_STRINGS))},
+    .previousCurrent_mA           = {GEN_REPEAT_U(0.0f, GEN_STRIP(BS_NR_OF_STRINGS))},
+    .isPreviousCurrentValid       = {GEN_REPEAT_U(false, GEN_STRIP(BS_NR_OF_STRINGS))},
+    .isRestPointSet               = {GEN_REPEAT_U(false, GEN_STRIP(BS_NR_OF_STRINGS))},
+    .isCurrentCounterUsed         = {GEN_REPEAT_U(false, GEN_STRIP(BS_NR_OF_STRINGS))},
+    .restPointCurrentCounter_As   = {GEN_REPEAT_U(0, GEN_STRIP(BS_NR_OF_STRINGS))},
+    .chargeSinceRestPoint_mAs     = {GEN_REPEAT_U(0.0f, GEN_STRIP(BS_NR_OF_STRINGS))},
+};
+
+/** estimator states of all cell blocks */
+/**@{*/
+static float_t soh_cellCapacity_mAh[BS_NR_OF_CELL_BLOCKS]         = {0.0f};
+static float_t soh_cellCapacityCovariance[BS_NR_OF_CELL_BLOCKS]   = {0.0f};
+static float_t soh_cellResistance_mOhm[BS_NR_OF_CELL_BLOCKS]      = {0.0f};
+static float_t soh_cellResistanceCovariance[BS_NR_OF_CELL_BLOCKS] = {0.0f};
+static float_t soh_cellRestPointSoc_perc[BS_NR_OF_CELL_BLOCKS]    = {0.0f};
+static int16_t soh_previousCellVoltage_mV[BS_NR_OF_CELL_BLOCKS]   = {0};
+/**@}*/
+
+/** estimators that are handled by this module */
+/**@{*/
+static const SOH_RLS_ESTIMATOR_s soh_capacityEstimator = {
+    .pParameter  = soh_cellCapacity_mAh,
+    .pCovariance = soh_cellCapacityCovariance,
+};
+static const SOH_RLS_ESTIMATOR_s soh_resistanceEstimator = {
+    .pParameter  = soh_cellResistance_mOhm,
+    .pCovariance = soh_cellResistanceCovariance,
+};
+/**@}*/
+
+/** configuration of the estimators */
+/**@{*/
+static const SOH_RLS_CONFIGURATION_s soh_capacityConfiguration = {
+    .forgettingFactor  = SOH_RLS_FORGETTING_FACTOR_CAPACITY,
+    .measurementNoise  = SOH_RLS_MEASUREMENT_NOISE_CAPACITY_mAh2,
+    .maximumCovariance = SOH_RLS_INITIAL_COVARIANCE_CAPACITY_mAh2,
+};
+static const SOH_RLS_CONFIGURATION_s soh_resistanceConfiguration = {
+    .forgettingFactor  = SOH_RLS_FORGETTING_FACTOR_RESISTANCE,
+    .measurementNoise  = SOH_RLS_MEASUREMENT_NOISE_RESISTANCE_mV2,
+    .maximumCovariance = SOH_RLS_INITIAL_COVARIANCE_RESISTANCE_mOhm2,
+};
+/**@}*/
+
+/** local copies of database tables */
+/**@{*/
+static DATA_BLOCK_CURRENT_s soh_tableCurrent                = {.header.uniqueId = DATA_BLOCK_ID_CURRENT};
+static DATA_BLOCK_CURRENT_COUNTER_s soh_tableCurrentCounter = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_COUNTER};
+static DATA_BLOCK_CELL_VOLTAGE_s soh_tableCellVoltage       = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+/**@}*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   updates one scalar recursive least-squares estimator with the
+ *          measurement y = phi * theta
+ * @param[in]  pConfiguration  configuration of the estimator
+ * @param[in]  pEstimator      estimator states of all cell blocks
+ * @param[in]  cellIndex       index of the cell block to be updated
+ * @param[in]  regressor       regressor phi
+ * @param[in]  measurement     measurement y
+ */
+static void SOH_UpdateEstimator(
+    const SOH_RLS_CONFIGURATION_s *pConfiguration,
+    const SOH_RLS_ESTIMATOR_s *pEstimator,
+    uint16_t cellIndex,
+    float_t regressor,
+    float_t measurement);
+
+/**
+ * @brief   calculates the SOH of a cell block from its capacity and internal
+ *          resistance
+ * @details The SOH is the lower of the capacity based SOH and the resistance
+ *          based SOH.
+ * @param[in]  capacity_mAh     capacity of the cell block
+ * @param[in]  resistance_mOhm  internal resistance of the cell block
+ * @return  SOH in percentage from 0.0% to 100.0%
+ */
+static float_t SOH_GetCellStateOfHealth(float_t capacity_mAh, float_t resistance_mOhm);
+
+/**
+ * @brief   updates the internal resistance of all cell blocks of a string
+ * @param[in]  stringNumber     addressed string
+ * @param[in]  deltaCurrent_A   change of the current in discharge direction
+ *                              since the previous cell voltage measurement
+ */
+static void SOH_UpdateResistance(uint8_t stringNumber, float_t deltaCurrent_A);
+
+/**
+ * @brief   returns the charge in discharge direction since the last rest
+ *          point of a string
+ * @param[in]  stringNumber     addressed string
+ * @return  charge in mAh
+ */
+static float_t SOH_GetChargeSinceRestPoint_mAh(uint8_t stringNumber);
+
+/**
+ * @brief   determines the SOC of all cell blocks of a string at a rest point
+ *          and updates the capacity with the SOC difference to the previous
+ *          rest point
+ * @param[in]  stringNumber     addressed string
+ */
+static void SOH_SetRestPoint(uint8_t stringNumber);
+
+/**
+ * @brief   stores the cell voltages of a string for the next resistance
+ *          update
+ * @param[in]  stringNumber     addressed string
+ */
+static void SOH_StoreCellVoltages(uint8_t stringNumber);
+
+/**
+ * @brief   sets the minimum, maximum and average SOH of a string
+ * @param[out] pTableSoh        pointer to database struct with SOH values
+ * @param[in]  stringNumber     addressed string
+ */
+static void SOH_SetStringValues(DATA_BLOCK_SOH_s *pTableSoh, uint8_t stringNumber);
+
+/**
+ * @brief   checks if the estimated parameters of a string differ
+ *          significantly from the values in the non-volatile memory
+ * @param[in]  stringNumber     addressed string
+ * @return  true if the values in the non-volatile memory should be updated
+ */
+static bool SOH_IsNvmUpdateRequired(uint8_t stringNumber);
+
+/**
+ * @brief   updates the estimated parameters in the non-volatile memory
+ */
+static void SOH_UpdateNvmValues(void);
+
+/*========== Static Function Implementations ================================*/
+/* INCLUDE MARKER FOR THE DOCUMENTATION; DO NOT MOVE rls-documentation-start-include */
+static void SOH_UpdateEstimator(
+    const SOH_RLS_CONFIGURATION_s *pConfiguration,
+    const SOH_RLS_ESTIMATOR_s *pEstimator,
+    uint16_t cellIndex,
+    float_t regressor,
+    float_t measurement) {
+    FAS_ASSERT(pConfiguration != NULL_PTR);
+    FAS_ASSERT(pEstimator != NULL_PTR);
+    FAS_ASSERT(cellIndex < BS_NR_OF_CELL_BLOCKS);
+    /* AXIVION Routine Generic-MissingParameterAssert: regressor: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: measurement: parameter accepts whole range */
+
+    const float_t lambda     = pConfiguration->forgettingFactor;
+    const float_t covariance = pEstimator->pCovariance[cellIndex];
+    const float_t parameter  = pEstimator->pParameter[cellIndex];
+
+    /* K = P * phi / (lambda * r + phi * P * phi) */
+    const float_t gain = (covariance * regressor) /
+                         ((lambda * pConfiguration->measurementNoise) + (regressor * regressor * covariance));
+    /* theta = theta + K * (y - phi * theta) */
+    pEstimator->pParameter[cellIndex] = parameter + (gain * (measurement - (regressor * parameter)));
+    /* P = (1 - K * phi) * P / lambda, limited to avoid wind-up */
+    float_t updatedCovariance = ((1.0f - (gain * regressor)) * covariance) / lambda;
+    if (updatedCovariance > pConfiguration->maximumCovariance) {
+        updatedCovariance = pConfiguration->maximumCovariance;
+    }
+    pEstimator->pCovariance[cellIndex] = updatedCovariance;
+}
+/* INCLUDE MARKER FOR THE DOCUMENTATION; DO NOT MOVE rls-documentation-stop-include */
+
+static float_t SOH_GetCellStateOfHealth(float_t capacity_mAh, float_t resistance_mOhm) {
+    /* AXIVION Routine Generic-MissingParameterAssert: capacity_mAh: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: resistance_mOhm: parameter accepts whole range */
+    const float_t capacitySoh_perc = (capacity_mAh / SOH_CELL_BLOCK_CAPACITY_mAh) * 100.0f;
+    const float_t resistanceSoh_perc =
+        ((SOH_RLS_RESISTANCE_END_OF_LIFE_mOhm - resistance_mOhm) /
+         (SOH_RLS_RESISTANCE_END_OF_LIFE_mOhm - SOH_RLS_RESISTANCE_BEGIN_OF_LIFE_mOhm)) *
+        100.0f;
+
+    float_t soh_perc = capacitySoh_perc;
+    if (resistanceSoh_perc < soh_perc) {
+        soh_perc = resistanceSoh_perc;
+    }
+    if (soh_perc > SOH_MAXIMUM_SOH_perc) {
+        soh_perc = SOH_MAXIMUM_SOH_perc;
+    }
+    if (soh_perc < SOH_MINIMUM_SOH_perc) {
+        soh_perc = SOH_MINIMUM_SOH_perc;
+    }
+    return soh_perc;
+}
+
+static void SOH_UpdateResistance(uint8_t stringNumber, float_t deltaCurrent_A) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    /* AXIVION Routine Generic-MissingParameterAssert: deltaCurrent_A: parameter accepts whole range */
+    const uint32_t offset = (uint32_t)stringNumber * BS_NR_OF_CELL_BLOCKS_PER_STRING;
+
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        const int16_t *pCellVoltage_mV         = soh_tableCellVoltage.cellVoltage_mV[stringNumber][m];
+        const BITSET_WORD_t invalidCellVoltage = soh_tableCellVoltage.invalidCellVoltage[stringNumber][m];
+        for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+            const uint16_t cellIndex = (uint16_t)(offset + ((uint32_t)m * BS_NR_OF_CELL_BLOCKS_PER_MODULE) + cb);
+            if ((BITSET_IsBitSet(invalidCellVoltage, cb) == false) &&
+                (soh_previousCellVoltage_mV[cellIndex] != SOH_INVALID_VOLTAGE_mV)) {
+                /* an increase of the discharge current decreases the cell voltage: R * dI = -dV */
+                const float_t voltageDrop_mV =
+                    (float_t)soh_previousCellVoltage_mV[cellIndex] - (float_t)pCellVoltage_mV[cb];
+                SOH_UpdateEstimator(
+                    &soh_resistanceConfiguration, &soh_resistanceEstimator, cellIndex, deltaCurrent_A, voltageDrop_mV);
+            }
+        }
+    }
+}
+
+static float_t SOH_GetChargeSinceRestPoint_mAh(uint8_t stringNumber) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    float_t charge_mAh = soh_state.chargeSinceRestPoint_mAs[stringNumber] / SOH_SECONDS_PER_HOUR;
+    if (soh_state.isCurrentCounterUsed[stringNumber] == true) {
+        /* As * 1000 / 3600 = mAh */
+        const float_t counterDifference_As = (float_t)soh_tableCurrentCounter.currentCounter_As[stringNumber] -
+                                             (float_t)soh_state.restPointCurrentCounter_As[stringNumber];
+        charge_mAh = ((counterDifference_As * BS_CURRENT_DIRECTION_FLOAT) * UNIT_CONVERSION_FACTOR_1000_FLOAT) /
+                     SOH_SECONDS_PER_HOUR;
+    }
+    return charge_mAh;
+}
+
+static void SOH_SetRestPoint(uint8_t stringNumber) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    const uint32_t offset    = (uint32_t)stringNumber * BS_NR_OF_CELL_BLOCKS_PER_STRING;
+    const float_t charge_mAh = SOH_GetChargeSinceRestPoint_mAh(stringNumber);
+
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        const int16_t *pCellVoltage_mV         = soh_tableCellVoltage.cellVoltage_mV[stringNumber][m];
+        const BITSET_WORD_t invalidCellVoltage = soh_tableCellVoltage.invalidCellVoltage[stringNumber][m];
+        for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+            const uint16_t cellIndex = (uint16_t)(offset + ((uint32_t)m * BS_NR_OF_CELL_BLOCKS_PER_MODULE) + cb);
+            float_t soc_perc         = SOH_INVALID_SOC_perc;
+            if (BITSET_IsBitSet(invalidCellVoltage, cb) == false) {
+                soc_perc = SE_GetStateOfChargeFromVoltage(pCellVoltage_mV[cb]);
+                /* the discharged charge equals the capacity times the SOC difference: Q = C * dSOC */
+                const float_t deltaSoc_perc = soh_cellRestPointSoc_perc[cellIndex] - soc_perc;
+                if ((soh_state.isRestPointSet[stringNumber] == true) &&
+                    (soh_cellRestPointSoc_perc[cellIndex] != SOH_INVALID_SOC_perc) &&
+                    (fabsf(deltaSoc_perc) >= SOH_RLS_MINIMUM_SOC_DIFFERENCE_perc)) {
+                    SOH_UpdateEstimator(
+                        &soh_capacityConfiguration,
+                        &soh_capacityEstimator,
+                        cellIndex,
+                        deltaSoc_perc / 100.0f,
+                        charge_mAh);
+                }
+            }
+            soh_cellRestPointSoc_perc[cellIndex] = soc_perc;
+        }
+    }
+
+    const bool isCurrentCounterValid = (soh_tableCurrentCounter.timestamp[stringNumber] != 0u) &&
+                                       (soh_tableCurrentCounter.invalidMeasurement[stringNumber] == 0u);
+
+    soh_state.isRestPointSet[stringNumber]             = true;
+    soh_state.isCurrentCounterUsed[stringNumber]       = isCurrentCounterValid;
+    soh_state.restPointCurrentCounter_As[stringNumber] = soh_tableCurrentCounter.currentCounter_As[stringNumber];
+    soh_state.chargeSinceRestPoint_mAs[stringNumber]   = 0.0f;
+}
+
+static void SOH_StoreCellVoltages(uint8_t stringNumber) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    const uint32_t offset = (uint32_t)stringNumber * BS_NR_OF_CELL_BLOCKS_PER_STRING;
+    const bool isMeasured = (soh_tableCellVoltage.header.timestamp != 0u);
+
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        const int16_t *pCellVoltage_mV         = soh_tableCellVoltage.cellVoltage_mV[stringNumber][m];
+        const BITSET_WORD_t invalidCellVoltage = soh_tableCellVoltage.invalidCellVoltage[stringNumber][m];
+        int16_t *pPreviousCellVoltage_mV =
+            &soh_previousCellVoltage_mV[offset + ((uint32_t)m * BS_NR_OF_CELL_BLOCKS_PER_MODULE)];
+        for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+            if ((isMeasured == true) && (BITSET_IsBitSet(invalidCellVoltage, cb) == false)) {
+                pPreviousCellVoltage_mV[cb] = pCellVoltage_mV[cb];
+            } else {
+                pPreviousCellVoltage_mV[cb] = SOH_INVALID_VOLTAGE_mV;
+            }
+        }
+    }
+}
+
+static void SOH_SetStringValues(DATA_BLOCK_SOH_s *pTableSoh, uint8_t stringNumber) {
+    FAS_ASSERT(pTableSoh != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    const uint32_t offset = (uint32_t)stringNumber * BS_NR_OF_CELL_BLOCKS_PER_STRING;
+
+    float_t minimum_perc = SOH_MAXIMUM_SOH_perc;
+    float_t maximum_perc = SOH_MINIMUM_SOH_perc;
+    float_t sum_perc     = 0.0f;
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        const float_t soh_perc =
+            SOH_GetCellStateOfHealth(soh_cellCapacity_mAh[offset + c], soh_cellResistance_mOhm[offset + c]);
+        if (soh_perc < minimum_perc) {
+            minimum_perc = soh_perc;
+        }
+        if (soh_perc > maximum_perc) {
+            maximum_perc = soh_perc;
+        }
+        sum_perc += soh_perc;
+    }
+    pTableSoh->minimumSoh_perc[stringNumber] = minimum_perc;
+    pTableSoh->maximumSoh_perc[stringNumber] = maximum_perc;
+    pTableSoh->averageSoh_perc[stringNumber] = sum_perc / (float_t)BS_NR_OF_CELL_BLOCKS_PER_STRING;
+}
+
+static bool SOH_IsNvmUpdateRequired(uint8_t stringNumber) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    const uint32_t offset = (uint32_t)stringNumber * BS_NR_OF_CELL_BLOCKS_PER_STRING;
+    const float_t capacityThreshold_mAh =
+        (SOH_CELL_BLOCK_CAPACITY_mAh * SOH_RLS_NVM_UPDATE_THRESHOLD_perc) / 100.0f;
+    const float_t resistanceThreshold_mOhm =
+        (SOH_RLS_RESISTANCE_BEGIN_OF_LIFE_mOhm * SOH_RLS_NVM_UPDATE_THRESHOLD_perc) / 100.0f;
+
+    bool isUpdateRequired = false;
+    for (uint16_t c = 0u; (c < BS_NR_OF_CELL_BLOCKS_PER_STRING) && (isUpdateRequired == false); c++) {
+        const uint32_t cellIndex = offset + c;
+        if ((fabsf(soh_cellCapacity_mAh[cellIndex] - fram_soh.cellCapacity_mAh[cellIndex]) >=
+             capacityThreshold_mAh) ||
+            (fabsf(soh_cellResistance_mOhm[cellIndex] - fram_soh.cellResistance_mOhm[cellIndex]) >=
+             resistanceThreshold_mOhm)) {
+            isUpdateRequired = true;
+        }
+    }
+    return isUpdateRequired;
+}
+
+static void SOH_UpdateNvmValues(void) {
+    for (uint32_t c = 0u; c < BS_NR_OF_CELL_BLOCKS; c++) {
+        fram_soh.cellCapacity_mAh[c]         = soh_cellCapacity_mAh[c];
+        fram_soh.cellCapacityCovariance[c]   = soh_cellCapacityCovariance[c];
+        fram_soh.cellResistance_mOhm[c]      = soh_cellResistance_mOhm[c];
+        fram_soh.cellResistanceCovariance[c] = soh_cellResistanceCovariance[c];
+    }
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void SE_InitializeStateOfHealth(DATA_BLOCK_SOH_s *pSohValues, uint8_t stringNumber) {
+    FAS_ASSERT(pSohValues != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+
+    DATA_READ_DATA(&soh_tableCurrent, &soh_tableCurrentCounter, &soh_tableCellVoltage);
+    const bool isNvmValid = (FRAM_ReadData(FRAM_BLOCK_ID_SOH) == FRAM_ACCESS_OK);
+
+    /* continue with the stored parameters if they are plausible, otherwise
+     * start with the begin-of-life parameters */
+    const uint32_t offset = (uint32_t)stringNumber * BS_NR_OF_CELL_BLOCKS_PER_STRING;
+    for (uint32_t c = offset; c < (offset + BS_NR_OF_CELL_BLOCKS_PER_STRING); c++) {
+        if ((isNvmValid == false) || !(fram_soh.cellCapacity_mAh[c] > 0.0f) ||
+            !(fram_soh.cellResistance_mOhm[c] > 0.0f) || !(fram_soh.cellCapacityCovariance[c] > 0.0f) ||
+            !(fram_soh.cellCapacityCovariance[c] <= SOH_RLS_INITIAL_COVARIANCE_CAPACITY_mAh2) ||
+            !(fram_soh.cellResistanceCovariance[c] > 0.0f) ||
+            !(fram_soh.cellResistanceCovariance[c] <= SOH_RLS_INITIAL_COVARIANCE_RESISTANCE_mOhm2)) {
+            fram_soh.cellCapacity_mAh[c]         = SOH_CELL_BLOCK_CAPACITY_mAh;
+            fram_soh.cellCapacityCovariance[c]   = SOH_RLS_INITIAL_COVARIANCE_CAPACITY_mAh2;
+            fram_soh.cellResistance_mOhm[c]      = SOH_RLS_RESISTANCE_BEGIN_OF_LIFE_mOhm;
+            fram_soh.cellResistanceCovariance[c] = SOH_RLS_INITIAL_COVARIANCE_RESISTANCE_mOhm2;
+        }
+        soh_cellCapacity_mAh[c]         = fram_soh.cellCapacity_mAh[c];
+        soh_cellCapacityCovariance[c]   = fram_soh.cellCapacityCovariance[c];
+        soh_cellResistance_mOhm[c]      = fram_soh.cellResistance_mOhm[c];
+        soh_cellResistanceCovariance[c] = fram_soh.cellResistanceCovariance[c];
+        soh_cellRestPointSoc_perc[c]    = SOH_INVALID_SOC_perc;
+    }
+    SOH_StoreCellVoltages(stringNumber);
+
+    const float_t current_mA = (float_t)soh_tableCurrent.current_mA[stringNumber] * BS_CURRENT_DIRECTION_FLOAT;
+
+    soh_state.previousCurrentTimestamp[stringNumber] = soh_tableCurrent.timestamp[stringNumber];
+    soh_state.previousCurrent_mA[stringNumber]       = current_mA;
+    soh_state.isPreviousCurrentValid[stringNumber]   = false;
+    soh_state.isRestPointSet[stringNumber]           = false;
+    soh_state.chargeSinceRestPoint_mAs[stringNumber] = 0.0f;
+    soh_state.previousCellVoltageTimestamp           = soh_tableCellVoltage.header.timestamp;
+    soh_state.previousNvmWriteTimestamp              = soh_tableCellVoltage.header.timestamp;
+
+    SOH_SetStringValues(pSohValues, stringNumber);
+
+    soh_state.sohInitialized = true;
+}
+
+extern void SE_CalculateStateOfHealth(DATA_BLOCK_SOH_s *pSohValues) {
+    FAS_ASSERT(pSohValues != NULL_PTR);
+
+    if (soh_state.sohInitialized == true) {
+        DATA_READ_DATA(&soh_tableCurrent, &soh_tableCurrentCounter, &soh_tableCellVoltage);
+        const uint32_t cellVoltageTimestamp = soh_tableCellVoltage.header.timestamp;
+        const bool isCellVoltageUpdated     = (soh_state.previousCellVoltageTimestamp != cellVoltageTimestamp);
+        const bool isAtRest                 = (BMS_GetBatterySystemState() == BMS_AT_REST);
+
+        soh_state.previousCellVoltageTimestamp = cellVoltageTimestamp;
+
+        bool isNvmUpdateRequired = false;
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            const bool isCurrentValid = (soh_tableCurrent.invalidMeasurement[s] == 0u);
+            const float_t current_mA  = (float_t)soh_tableCurrent.current_mA[s] * BS_CURRENT_DIRECTION_FLOAT;
+
+            /* integrate the current in case no current counter is available */
+            if ((soh_state.previousCurrentTimestamp[s] != soh_tableCurrent.timestamp[s]) && (isCurrentValid == true)) {
+                const float_t timeStep_s =
+                    ((float_t)(soh_tableCurrent.timestamp[s] - soh_state.previousCurrentTimestamp[s])) / 1000.0f;
+                const float_t charge_mAs = current_mA * timeStep_s;
+
+                soh_state.chargeSinceRestPoint_mAs[s] = soh_state.chargeSinceRestPoint_mAs[s] + charge_mAs;
+                soh_state.previousCurrentTimestamp[s] = soh_tableCurrent.timestamp[s];
+            }
+
+            if (isCellVoltageUpdated == true) {
+                /* current and cell voltages have to be measured at nearly the same time */
+                uint32_t skew_ms = cellVoltageTimestamp - soh_tableCurrent.timestamp[s];
+                if (soh_tableCurrent.timestamp[s] > cellVoltageTimestamp) {
+                    skew_ms = soh_tableCurrent.timestamp[s] - cellVoltageTimestamp;
+                }
+                const bool isSkewValid        = (skew_ms <= SOH_RLS_MAXIMUM_MEASUREMENT_SKEW_ms);
+                const bool isCurrentUsable    = (isCurrentValid == true) && (isSkewValid == true);
+                const float_t deltaCurrent_mA = current_mA - soh_state.previousCurrent_mA[s];
+                if ((isCurrentUsable == true) && (soh_state.isPreviousCurrentValid[s] == true) &&
+                    (fabsf(deltaCurrent_mA) >= SOH_RLS_MINIMUM_CURRENT_STEP_mA)) {
+                    SOH_UpdateResistance(s, deltaCurrent_mA / UNIT_CONVERSION_FACTOR_1000_FLOAT);
+                }
+                SOH_StoreCellVoltages(s);
+                soh_state.previousCurrent_mA[s]     = current_mA;
+                soh_state.isPreviousCurrentValid[s] = isCurrentUsable;
+
+                if (isAtRest == true) {
+                    SOH_SetRestPoint(s);
+                }
+
+                SOH_SetStringValues(pSohValues, s);
+                if (SOH_IsNvmUpdateRequired(s) == true) {
+                    isNvmUpdateRequired = true;
+                }
+            }
+        }
+
+        /* Update values in non-volatile memory only on significant changes */
+        if ((isNvmUpdateRequired == true) &&
+            ((cellVoltageTimestamp - soh_state.previousNvmWriteTimestamp) >= SOH_RLS_NVM_MINIMUM_WRITE_PERIOD_ms)) {
+            SOH_UpdateNvmValues();
+            FRAM_RequestWrite(FRAM_BLOCK_ID_SOH);
+            soh_state.previousNvmWriteTimestamp = cellVoltageTimestamp;
+        }
+    }
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern bool TEST_SOH_GetSohStateInitialized(void) {
+    return soh_state.sohInitialized;
+}
+extern float_t TEST_SOH_GetCellCapacity_mAh(uint16_t cellIndex) {
+    FAS_ASSERT(cellIndex < BS_NR_OF_CELL_BLOCKS);
+    return soh_cellCapacity_mAh[cellIndex];
+}
+extern float_t TEST_SOH_GetCellResistance_mOhm(uint16_t cellIndex) {
+    FAS_ASSERT(cellIndex < BS_NR_OF_CELL_BLOCKS);
+    return soh_cellResistance_mOhm[cellIndex];
+}
+extern void TEST_SOH_UpdateEstimator(
+    const SOH_RLS_CONFIGURATION_s *pConfiguration,
+    const SOH_RLS_ESTIMATOR_s *pEstimator,
+    uint16_t cellIndex,
+    float_t regressor,
+    float_t measurement) {
+    SOH_UpdateEstimator(pConfiguration, pEstimator, cellIndex, regressor, measurement);
+}
+extern float_t TEST_SOH_GetCellStateOfHealth(float_t capacity_mAh, float_t resistance_mOhm) {
+    return SOH_GetCellStateOfHealth(capacity_mAh, resistance_mOhm);
+}
+extern bool TEST_SOH_IsNvmUpdateRequired(uint8_t stringNumber) {
+    return SOH_IsNvmUpdateRequired(stringNumber);
+}
+#endif
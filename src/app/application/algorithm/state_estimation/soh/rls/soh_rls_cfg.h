@@ -0,0 +1,174 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    soh_rls_cfg.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup APPLICATION
+ * @prefix  SOH
+ *
+ * @brief   Header for the configuration of the recursive least-squares SOH
+ *          estimation
+ * @details The capacity and the internal resistance of every cell block are
+ *          estimated with a scalar recursive least-squares estimator each.
+ *          The parameters of the estimators, the excitation thresholds and
+ *          the rules for the persistence in the FRAM are configured in this
+ *          file.
+ */
+
+#ifndef FOXBMS__SOH_RLS_CFG_H_
+#define FOXBMS__SOH_RLS_CFG_H_
+
+/*========== Includes =======================================================*/
+
+#include "battery_cell_cfg.h"
+#include "battery_system_cfg.h"
+
+#include "database.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** Nominal capacity of one cell block in mAh */
+#define SOH_CELL_BLOCK_CAPACITY_mAh ((float_t)(BS_NR_OF_PARALLEL_CELLS_PER_CELL_BLOCK * BC_CAPACITY_mAh))
+
+/**
+ * @brief   Execution time budget of one call of #SE_CalculateStateOfHealth()
+ *          in us
+ * @details The execution time and the convergence of the estimation are
+ *          verified by the host replay of a load profile
+ *          (test_soh_rls_replay.c).
+ */
+#define SOH_RLS_MAXIMUM_EXECUTION_TIME_us (500u)
+
+/** Internal resistance of one cell block at begin of life (100% SOH) in mOhm */
+#define SOH_RLS_RESISTANCE_BEGIN_OF_LIFE_mOhm (20.0f)
+/** Internal resistance of one cell block at end of life (0% SOH) in mOhm */
+#define SOH_RLS_RESISTANCE_END_OF_LIFE_mOhm (40.0f)
+
+/**
+ * @brief   Forgetting factors of the estimators
+ * @details A factor of 1.0 weights all updates equally, smaller factors
+ *          track changes faster at the cost of a higher variance.
+ */
+/**@{*/
+#define SOH_RLS_FORGETTING_FACTOR_CAPACITY   (0.98f)
+#define SOH_RLS_FORGETTING_FACTOR_RESISTANCE (0.999f)
+/**@}*/
+
+/** Variance of the charge difference between two rest points in mAh^2 */
+#define SOH_RLS_MEASUREMENT_NOISE_CAPACITY_mAh2 (2500.0f)
+/** Variance of the cell voltage difference between two measurements in mV^2 */
+#define SOH_RLS_MEASUREMENT_NOISE_RESISTANCE_mV2 (8.0f)
+
+/**
+ * @brief   Initial and maximum variances of the estimated parameters
+ * @details The variances are limited to these values to avoid a wind-up
+ *          of the estimators during long periods without excitation.
+ */
+/**@{*/
+#define SOH_RLS_INITIAL_COVARIANCE_CAPACITY_mAh2    (250000.0f)
+#define SOH_RLS_INITIAL_COVARIANCE_RESISTANCE_mOhm2 (100.0f)
+/**@}*/
+
+/** Minimum change of the string current between two cell voltage measurements for a resistance update in mA */
+#define SOH_RLS_MINIMUM_CURRENT_STEP_mA (10000.0f)
+/** Maximum time between the current and the cell voltage measurement for a resistance update in ms */
+#define SOH_RLS_MAXIMUM_MEASUREMENT_SKEW_ms (100u)
+/** Minimum SOC difference of a cell block between two rest points for a capacity update in % */
+#define SOH_RLS_MINIMUM_SOC_DIFFERENCE_perc (20.0f)
+
+/**
+ * @brief   Persistence of the estimated parameters
+ * @details The parameters are written to the FRAM if one of them differs by
+ *          more than #SOH_RLS_NVM_UPDATE_THRESHOLD_perc of its begin-of-life
+ *          value from the last written value, but at most once every
+ *          #SOH_RLS_NVM_MINIMUM_WRITE_PERIOD_ms.
+ */
+/**@{*/
+#define SOH_RLS_NVM_UPDATE_THRESHOLD_perc   (0.5f)
+#define SOH_RLS_NVM_MINIMUM_WRITE_PERIOD_ms (600000u)
+/**@}*/
+
+/**
+ * @brief   State of one scalar recursive least-squares estimator per cell
+ *          block as structure-of-arrays
+ * @details The estimator solves y = phi * theta for the parameter theta.
+ *          Every member points to an array with one entry per cell block.
+ */
+typedef struct {
+    float_t *pParameter;  /*!< estimated parameter theta */
+    float_t *pCovariance; /*!< variance of the estimated parameter */
+} SOH_RLS_ESTIMATOR_s;
+
+/** Constant configuration of a recursive least-squares estimator */
+typedef struct {
+    float_t forgettingFactor;  /*!< forgetting factor lambda, 0 < lambda <= 1 */
+    float_t measurementNoise;  /*!< variance of the measurement y */
+    float_t maximumCovariance; /*!< upper limit of the parameter variance */
+} SOH_RLS_CONFIGURATION_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern bool TEST_SOH_GetSohStateInitialized(void);
+extern float_t TEST_SOH_GetCellCapacity_mAh(uint16_t cellIndex);
+extern float_t TEST_SOH_GetCellResistance_mOhm(uint16_t cellIndex);
+extern void TEST_SOH_UpdateEstimator(
+    const SOH_RLS_CONFIGURATION_s *pConfiguration,
+    const SOH_RLS_ESTIMATOR_s *pEstimator,
+    uint16_t cellIndex,
+    float_t regressor,
+    float_t measurement);
+extern float_t TEST_SOH_GetCellStateOfHealth(float_t capacity_mAh, float_t resistance_mOhm);
+extern bool TEST_SOH_IsNvmUpdateRequired(uint8_t stringNumber);
+#endif
+
+#endif /* FOXBMS__SOH_RLS_CFG_H_ */
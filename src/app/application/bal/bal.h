@@ -43,7 +43,7 @@
  * @file    bal.h
  * @author  foxBMS Team
  * @date    2020-02-24 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup APPLICATION
  * @prefix  BAL
@@ -234,11 +234,20 @@ extern void BAL_Trigger(void);
 #ifdef UNITY_UNIT_TEST
 extern DATA_BLOCK_BALANCING_CONTROL_s *TEST_BAL_GetBalancingControl(void);
 extern BAL_STATE_s *TEST_BAL_GetBalancingState(void);
+/* history based balancing strategy only */
+extern DATA_BLOCK_CELL_VOLTAGE_s *TEST_BAL_GetCellVoltage(void);
 #endif
 
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
 extern BAL_FSM_e BAL_GetState(void);
+/* history based balancing strategy only */
+extern void TEST_BAL_CalculateChargeTable(void);
+extern uint32_t TEST_BAL_GetCharge_mAs(int16_t voltage_mV);
+extern uint32_t TEST_BAL_GetBleedCurrent_mA(int16_t voltage_mV);
+extern uint32_t TEST_BAL_PlanModule(uint8_t stringNumber, uint8_t moduleNumber);
+extern void TEST_BAL_ActivateBalancing(void);
+extern void TEST_BAL_ComputeImbalances(void);
 #endif
 
 #endif /* FOXBMS__BAL_H_ */
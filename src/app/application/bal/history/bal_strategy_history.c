@@ -43,7 +43,7 @@
  * @file    bal_strategy_history.c
  * @author  foxBMS Team
  * @date    2020-05-29 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup APPLICATION
  * @prefix  BAL
@@ -59,6 +59,7 @@
 #include "bal.h"
 #include "bms.h"
 #include "database.h"
+#include "fbitset.h"
 #include "os.h"
 #include "state_estimation.h"
 
@@ -67,6 +68,20 @@
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
+/** voltage step of the charge lookup table as power of two, i.e., 16mV */
+#define BAL_CHARGE_TABLE_STEP_SHIFT (4u)
+/** voltage step of the charge lookup table in mV */
+#define BAL_CHARGE_TABLE_STEP_mV (1u << BAL_CHARGE_TABLE_STEP_SHIFT)
+/** number of entries of the charge lookup table */
+#define BAL_CHARGE_TABLE_LENGTH (128u)
+/**
+ * largest voltage offset to the first table entry that is interpolated, the
+ * last table entry is only used as upper interpolation point
+ */
+#define BAL_CHARGE_TABLE_MAXIMUM_OFFSET_mV ((int32_t)((BAL_CHARGE_TABLE_LENGTH - 1u) * BAL_CHARGE_TABLE_STEP_mV) - 1)
+
+/** bleed current is calculated with a conductance in 1/65536 S, i.e., current = voltage * conductance >> 16 */
+#define BAL_BLEED_CONDUCTANCE_SHIFT (16u)
 
 /*========== Static Constant and Variable Definitions =======================*/
 /** local storage of the #DATA_BLOCK_BALANCING_CONTROL_s table */
@@ -74,6 +89,16 @@ static DATA_BLOCK_BALANCING_CONTROL_s bal_balancing = {.header.uniqueId = DATA_B
 /** local storage of the #DATA_BLOCK_CELL_VOLTAGE_s table */
 static DATA_BLOCK_CELL_VOLTAGE_s bal_cellVoltage = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
 
+/**
+ * charge of a cell block in mAs at the voltage of each table entry, starting
+ * at #bal_chargeTableMinimumVoltage_mV in steps of #BAL_CHARGE_TABLE_STEP_mV
+ */
+static uint32_t bal_chargeTable_mAs[BAL_CHARGE_TABLE_LENGTH] = {0u};
+/** voltage of the first entry of the charge lookup table */
+static int16_t bal_chargeTableMinimumVoltage_mV = 0;
+/** conductance of the balancing resistor in 1/65536 S */
+static uint32_t bal_bleedConductance = 0u;
+
 /** contains the state of the contactor state machine */
 static BAL_STATE_s bal_state = {
     .timer                  = 0,
@@ -94,7 +119,50 @@ static BAL_STATE_s bal_state = {
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
-/** Activates history based balancing */
+/**
+ * @brief   Calculates the charge lookup table and the bleed conductance
+ * @details The charge of a cell block is calculated for equidistant voltages
+ *          from the SOC-voltage lookup table of the battery cell, so that no
+ *          floating point operation and no table search is needed at runtime.
+ */
+static void BAL_CalculateChargeTable(void);
+
+/**
+ * @brief   Returns the charge of a cell block at a cell voltage
+ * @details Linear interpolation between the entries of the charge lookup
+ *          table, integer arithmetic only.
+ * @param   voltage_mV  cell voltage
+ * @return  charge of the cell block in mAs
+ */
+static uint32_t BAL_GetCharge_mAs(int16_t voltage_mV);
+
+/**
+ * @brief   Returns the bleed current of a cell block
+ * @param   voltage_mV  cell voltage
+ * @return  current through the balancing resistor in mA
+ */
+static uint32_t BAL_GetBleedCurrent_mA(int16_t voltage_mV);
+
+/**
+ * @brief   Plans the balancing channels of a module for the next balancing
+ *          period
+ * @details The cell blocks with the largest remaining charge are balanced
+ *          first (longest remaining time first), which minimizes the total
+ *          balancing time. At most #BAL_MAXIMUM_ACTIVE_CHANNELS_PER_MODULE
+ *          channels are active and the dissipated power of the module does
+ *          not exceed #BAL_MAXIMUM_POWER_PER_MODULE_mW.
+ * @param   stringNumber    string of the module
+ * @param   moduleNumber    module in the string
+ * @return  balancing plan of the module, bit cb set: balance cell block cb
+ */
+static uint32_t BAL_PlanModule(uint8_t stringNumber, uint8_t moduleNumber);
+
+/**
+ * @brief   Activates history based balancing
+ * @details Plans the balancing channels of every module and reduces the
+ *          remaining charge of the balanced cell blocks by the charge that
+ *          is bled during one balancing period.
+ */
 static void BAL_ActivateBalancing(void);
 
 /**
@@ -122,40 +190,119 @@ static bool BAL_CheckImbalances(void);
 static void BAL_ComputeImbalances(void);
 
 /*========== Static Function Implementations ================================*/
+static void BAL_CalculateChargeTable(void) {
+    const uint16_t lastEntry = bc_stateOfChargeLookupTableLength - 1u;
+    /* the lookup table is sorted by descending voltage */
+    const int16_t minimumVoltage_mV = bc_stateOfChargeLookupTable[lastEntry].voltage_mV;
+    const int16_t maximumVoltage_mV = bc_stateOfChargeLookupTable[0u].voltage_mV;
+    FAS_ASSERT((maximumVoltage_mV - minimumVoltage_mV) <= BAL_CHARGE_TABLE_MAXIMUM_OFFSET_mV);
+
+    /* capacity of a cell block in mAs per percent SOC */
+    const float_t capacity_mAsPerPercent =
+        ((float_t)BC_CAPACITY_mAh * (float_t)BS_NR_OF_PARALLEL_CELLS_PER_CELL_BLOCK * 3600.0f) / 100.0f;
+
+    bal_chargeTableMinimumVoltage_mV = minimumVoltage_mV;
+    for (uint16_t i = 0u; i < BAL_CHARGE_TABLE_LENGTH; i++) {
+        const int16_t voltage_mV = (int16_t)(minimumVoltage_mV + (int16_t)(i * BAL_CHARGE_TABLE_STEP_mV));
+        const float_t soc_perc   = SE_GetStateOfChargeFromVoltage(voltage_mV);
+        bal_chargeTable_mAs[i]   = (uint32_t)(soc_perc * capacity_mAsPerPercent);
+    }
 
-static void BAL_ActivateBalancing(void) {
-    float_t cellBalancingCurrent = 0.0f;
-    uint32_t difference          = 0;
+    bal_bleedConductance = (uint32_t)((float_t)(1uL << BAL_BLEED_CONDUCTANCE_SHIFT) / SLV_BALANCING_RESISTANCE_ohm);
+}
+
+static uint32_t BAL_GetCharge_mAs(int16_t voltage_mV) {
+    /* AXIVION Routine Generic-MissingParameterAssert: voltage_mV: parameter accepts whole range */
+    int32_t offset_mV = (int32_t)voltage_mV - bal_chargeTableMinimumVoltage_mV;
+    if (offset_mV < 0) {
+        offset_mV = 0;
+    }
+    if (offset_mV > BAL_CHARGE_TABLE_MAXIMUM_OFFSET_mV) {
+        offset_mV = BAL_CHARGE_TABLE_MAXIMUM_OFFSET_mV;
+    }
+    const uint32_t index     = (uint32_t)offset_mV >> BAL_CHARGE_TABLE_STEP_SHIFT;
+    const uint32_t remainder = (uint32_t)offset_mV & (BAL_CHARGE_TABLE_STEP_mV - 1u);
+    /* the charge increases with the voltage */
+    const uint32_t difference_mAs = bal_chargeTable_mAs[index + 1u] - bal_chargeTable_mAs[index];
+    return bal_chargeTable_mAs[index] + ((difference_mAs * remainder) >> BAL_CHARGE_TABLE_STEP_SHIFT);
+}
 
+static uint32_t BAL_GetBleedCurrent_mA(int16_t voltage_mV) {
+    /* AXIVION Routine Generic-MissingParameterAssert: voltage_mV: parameter accepts whole range */
+    uint32_t current_mA = 0u;
+    if (voltage_mV > 0) {
+        current_mA = ((uint32_t)voltage_mV * bal_bleedConductance) >> BAL_BLEED_CONDUCTANCE_SHIFT;
+    }
+    return current_mA;
+}
+
+static uint32_t BAL_PlanModule(uint8_t stringNumber, uint8_t moduleNumber) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    FAS_ASSERT(moduleNumber < BS_NR_OF_MODULES_PER_STRING);
+
+    const uint32_t *pDeltaCharge_mAs = bal_balancing.deltaCharge_mAs[stringNumber][moduleNumber];
+    const int16_t *pCellVoltage_mV   = bal_cellVoltage.cellVoltage_mV[stringNumber][moduleNumber];
+
+    uint32_t power_mW[BS_NR_OF_CELL_BLOCKS_PER_MODULE] = {0u};
+    for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+        power_mW[cb] = ((uint32_t)pCellVoltage_mV[cb] * BAL_GetBleedCurrent_mA(pCellVoltage_mV[cb])) / 1000u;
+    }
+
+    uint32_t plan            = 0u;
+    uint32_t modulePower_mW  = 0u;
+    uint8_t nrActiveChannels = 0u;
+    bool isChannelSelected   = true;
+    while ((nrActiveChannels < BAL_MAXIMUM_ACTIVE_CHANNELS_PER_MODULE) && (isChannelSelected == true)) {
+        /* select the cell block with the largest remaining charge that fits into the power budget */
+        uint32_t maximumCharge_mAs = 0u;
+        uint8_t selectedCellBlock  = 0u;
+        for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+            if (((plan & (1u << cb)) == 0u) && (pDeltaCharge_mAs[cb] > maximumCharge_mAs) &&
+                ((modulePower_mW + power_mW[cb]) <= BAL_MAXIMUM_POWER_PER_MODULE_mW)) {
+                maximumCharge_mAs = pDeltaCharge_mAs[cb];
+                selectedCellBlock = cb;
+            }
+        }
+        isChannelSelected = (maximumCharge_mAs > 0u);
+        if (isChannelSelected == true) {
+            plan |= (1u << selectedCellBlock);
+            modulePower_mW += power_mW[selectedCellBlock];
+            nrActiveChannels++;
+        }
+    }
+    return plan;
+}
+
+static void BAL_ActivateBalancing(void) {
     DATA_READ_DATA(&bal_balancing, &bal_cellVoltage);
 
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         uint16_t nrBalancedCells = 0u;
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
-            for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                if (bal_state.balancingAllowed == false) {
-                    bal_balancing.activateBalancing[s][m][cb] = false;
-                } else {
-                    if (bal_balancing.deltaCharge_mAs[s][m][cb] > 0u) {
-                        bal_balancing.activateBalancing[s][m][cb] = true;
-                        nrBalancedCells++;
-                        cellBalancingCurrent = ((float_t)(bal_cellVoltage.cellVoltage_mV[s][m][cb])) /
-                                               SLV_BALANCING_RESISTANCE_ohm;
-                        difference       = (BAL_FSM_BALANCING_TIME_100ms / 10u) * (uint32_t)(cellBalancingCurrent);
-                        bal_state.active = true;
-                        bal_balancing.enableBalancing = true;
-                        /* we are working with unsigned integers */
-                        if (difference > bal_balancing.deltaCharge_mAs[s][m][cb]) {
-                            bal_balancing.deltaCharge_mAs[s][m][cb] = 0u;
-                        } else {
-                            bal_balancing.deltaCharge_mAs[s][m][cb] -= difference;
-                        }
+            uint32_t plan = 0u;
+            if (bal_state.balancingAllowed == true) {
+                plan = BAL_PlanModule(s, m);
+            }
+            bal_balancing.balancingPlan[s][m] = plan;
+
+            for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                if ((plan & (1u << cb)) != 0u) {
+                    const uint32_t bleedCurrent_mA = BAL_GetBleedCurrent_mA(bal_cellVoltage.cellVoltage_mV[s][m][cb]);
+                    const uint32_t bleedCharge_mAs = (bleedCurrent_mA * BAL_FSM_BALANCING_TIME_100ms) / 10u;
+                    /* we are working with unsigned integers */
+                    if (bleedCharge_mAs > bal_balancing.deltaCharge_mAs[s][m][cb]) {
+                        bal_balancing.deltaCharge_mAs[s][m][cb] = 0u;
                     } else {
-                        bal_balancing.activateBalancing[s][m][cb] = false;
+                        bal_balancing.deltaCharge_mAs[s][m][cb] -= bleedCharge_mAs;
                     }
+                    nrBalancedCells++;
                 }
             }
         }
+        if (nrBalancedCells > 0u) {
+            bal_state.active              = true;
+            bal_balancing.enableBalancing = true;
+        }
         bal_balancing.nrBalancedCells[s] = nrBalancedCells;
     }
 
@@ -165,9 +312,9 @@ static void BAL_ActivateBalancing(void) {
 static void BAL_Deactivate(void) {
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            bal_balancing.balancingPlan[s][m] = 0u;
             for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                bal_balancing.activateBalancing[s][m][cb] = false;
-                bal_balancing.deltaCharge_mAs[s][m][cb]   = 0u;
+                bal_balancing.deltaCharge_mAs[s][m][cb] = 0u;
             }
         }
         bal_balancing.nrBalancedCells[s] = 0u;
@@ -273,49 +420,26 @@ static bool BAL_CheckImbalances(void) {
 }
 
 static void BAL_ComputeImbalances(void) {
-    int16_t voltageMin_mV                   = 0;
-    uint16_t minVoltageModuleIndex          = 0u;
-    uint16_t minVoltageModuleCellBlockIndex = 0u;
-    float_t SOC                             = 0.0f;
-    uint32_t DOD                            = 0u;
-    uint32_t maxDOD                         = 0u;
+    DATA_BLOCK_MIN_MAX_s minMax = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+    DATA_READ_DATA(&bal_balancing, &bal_cellVoltage, &minMax);
 
-    DATA_READ_DATA(&bal_balancing, &bal_cellVoltage);
+    /* update balancing threshold */
+    bal_state.balancingThreshold = BAL_GetBalancingThreshold_mV() + BAL_HYSTERESIS_mV;
 
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
-        /* Assign first cell voltage to*/
-        voltageMin_mV                  = INT16_MAX;
-        minVoltageModuleIndex          = 0u;
-        minVoltageModuleCellBlockIndex = 0u;
-        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
-            for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                if (bal_cellVoltage.cellVoltage_mV[s][m][cb] <= voltageMin_mV) {
-                    voltageMin_mV                  = bal_cellVoltage.cellVoltage_mV[s][m][cb];
-                    minVoltageModuleIndex          = m;
-                    minVoltageModuleCellBlockIndex = cb;
-                }
-            }
-        }
-
-        SOC = SE_GetStateOfChargeFromVoltage(
-            ((float_t)(bal_cellVoltage.cellVoltage_mV[s][minVoltageModuleIndex][minVoltageModuleCellBlockIndex])) /
-            1000.0f);
-        maxDOD = BC_CAPACITY_mAh * (uint32_t)((1.0f - SOC) * 3600.0f);
-        bal_balancing.deltaCharge_mAs[s][minVoltageModuleIndex][minVoltageModuleCellBlockIndex] = 0u;
-
-        /* update balancing threshold */
-        bal_state.balancingThreshold = BAL_GetBalancingThreshold_mV() + BAL_HYSTERESIS_mV;
-
+        /* the cell block with the minimum voltage is the reference, all other cell blocks above the threshold
+         * are discharged by their charge difference to the reference */
+        const int32_t threshold_mV       = (int32_t)minMax.minimumCellVoltage_mV[s] + bal_state.balancingThreshold;
+        const uint32_t minimumCharge_mAs = BAL_GetCharge_mAs(minMax.minimumCellVoltage_mV[s]);
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
-            for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                if ((m != minVoltageModuleIndex) || (cb != minVoltageModuleCellBlockIndex)) {
-                    if (bal_cellVoltage.cellVoltage_mV[s][m][cb] >= (voltageMin_mV + bal_state.balancingThreshold)) {
-                        SOC = SE_GetStateOfChargeFromVoltage(
-                            ((float_t)(bal_cellVoltage.cellVoltage_mV[s][m][cb])) / 1000.0f);
-                        DOD                                     = BC_CAPACITY_mAh * (uint32_t)((1.0f - SOC) * 3600.0f);
-                        bal_balancing.deltaCharge_mAs[s][m][cb] = (maxDOD - DOD);
-                    }
+            const BITSET_WORD_t invalidCellVoltage = bal_cellVoltage.invalidCellVoltage[s][m];
+            for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                const int16_t voltage_mV = bal_cellVoltage.cellVoltage_mV[s][m][cb];
+                uint32_t deltaCharge_mAs = 0u;
+                if ((BITSET_IsBitSet(invalidCellVoltage, cb) == false) && ((int32_t)voltage_mV >= threshold_mV)) {
+                    deltaCharge_mAs = BAL_GetCharge_mAs(voltage_mV) - minimumCharge_mAs;
                 }
+                bal_balancing.deltaCharge_mAs[s][m][cb] = deltaCharge_mAs;
             }
         }
     }
@@ -366,6 +490,7 @@ extern void BAL_Trigger(void) {
         case BAL_FSM_INITIALIZATION:
             BAL_SaveLastStates(&bal_state);
             BAL_Init(&bal_balancing);
+            BAL_CalculateChargeTable();
             BAL_ProcessStateInitialization(&bal_state);
             break;
         case BAL_FSM_INITIALIZED:
@@ -401,4 +526,32 @@ extern DATA_BLOCK_BALANCING_CONTROL_s *TEST_BAL_GetBalancingControl(void) {
 extern BAL_STATE_s *TEST_BAL_GetBalancingState(void) {
     return &bal_state;
 }
+
+extern DATA_BLOCK_CELL_VOLTAGE_s *TEST_BAL_GetCellVoltage(void) {
+    return &bal_cellVoltage;
+}
+
+extern void TEST_BAL_CalculateChargeTable(void) {
+    BAL_CalculateChargeTable();
+}
+
+extern uint32_t TEST_BAL_GetCharge_mAs(int16_t voltage_mV) {
+    return BAL_GetCharge_mAs(voltage_mV);
+}
+
+extern uint32_t TEST_BAL_GetBleedCurrent_mA(int16_t voltage_mV) {
+    return BAL_GetBleedCurrent_mA(voltage_mV);
+}
+
+extern uint32_t TEST_BAL_PlanModule(uint8_t stringNumber, uint8_t moduleNumber) {
+    return BAL_PlanModule(stringNumber, moduleNumber);
+}
+
+extern void TEST_BAL_ActivateBalancing(void) {
+    BAL_ActivateBalancing();
+}
+
+extern void TEST_BAL_ComputeImbalances(void) {
+    BAL_ComputeImbalances();
+}
 #endif
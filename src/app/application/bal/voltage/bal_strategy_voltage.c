@@ -43,7 +43,7 @@
  * @file    bal_strategy_voltage.c
  * @author  foxBMS Team
  * @date    2020-05-29 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup APPLICATION
  * @prefix  BAL
@@ -131,19 +131,19 @@ static bool BAL_ActivateBalancing(void) {
         int16_t min              = minMax.minimumCellVoltage_mV[s];
         uint16_t nrBalancedCells = 0u;
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            uint32_t balancingPlan = 0u;
             for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
                 if (cellVoltage.cellVoltage_mV[s][m][cb] > (min + bal_state.balancingThreshold)) {
-                    bal_tableBalancingControl.activateBalancing[s][m][cb] = true;
-                    finished                                              = false;
+                    finished = false;
                     /* set without hysteresis so that we now balance all cells that are below the initial threshold */
                     bal_state.balancingThreshold              = BAL_GetBalancingThreshold_mV();
                     bal_state.active                          = true;
                     bal_tableBalancingControl.enableBalancing = true;
                     nrBalancedCells++;
-                } else {
-                    bal_tableBalancingControl.activateBalancing[s][m][cb] = false;
+                    balancingPlan |= (1u << cb);
                 }
             }
+            bal_tableBalancingControl.balancingPlan[s][m] = balancingPlan;
         }
         bal_tableBalancingControl.nrBalancedCells[s] = nrBalancedCells;
     }
@@ -155,9 +155,9 @@ static bool BAL_ActivateBalancing(void) {
 static void BAL_Deactivate(void) {
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            bal_tableBalancingControl.balancingPlan[s][m] = 0u;
             for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                bal_tableBalancingControl.activateBalancing[s][m][cb] = false;
-                bal_tableBalancingControl.deltaCharge_mAs[s][m][cb]   = 0u;
+                bal_tableBalancingControl.deltaCharge_mAs[s][m][cb] = 0u;
             }
         }
         bal_tableBalancingControl.nrBalancedCells[s] = 0u;
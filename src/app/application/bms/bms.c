@@ -43,7 +43,7 @@
  * @file    bms.c
  * @author  foxBMS Team
  * @date    2020-02-24 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup ENGINE
  * @prefix  BMS
@@ -63,9 +63,11 @@
 #include "can_cbs_tx_cyclic.h"
 #include "database.h"
 #include "diag.h"
+#include "fbitset.h"
 #include "foxmath.h"
 #include "imd.h"
 #include "led.h"
+#include "log.h"
 #include "meas.h"
 #include "os.h"
 #include "soa.h"
@@ -413,23 +415,13 @@ static uint8_t BMS_CheckCanRequests(void) {
 }
 
 static void BMS_CheckOpenSenseWire(void) {
-    uint8_t openWireDetected = 0;
-
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
-        /* Iterate over all modules */
-        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
-            /* Iterate over all voltage sense wires: cells per module + 1 */
-            for (uint8_t wire = 0u; wire < (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1); wire++) {
-                /* open wire detected */
-                if (bms_tableOpenWire.openWire[s][(wire + (m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1))) == 1] > 0u) {
-                    openWireDetected++;
-
-                    /* Add additional error handling here */
-                }
-            }
-        }
+        /* Check all voltage sense wires of all modules: one bitset word per module */
+        const bool openWireDetected = BITSET_IsAnyBitSet(bms_tableOpenWire.openWire[s], BS_NR_OF_MODULES_PER_STRING);
+        /* Add additional error handling here */
+
         /* Set error if open wire detected */
-        if (openWireDetected == 0u) {
+        if (openWireDetected == false) {
             DIAG_Handler(DIAG_ID_AFE_OPEN_WIRE, DIAG_EVENT_OK, DIAG_STRING, s);
         } else {
             DIAG_Handler(DIAG_ID_AFE_OPEN_WIRE, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
@@ -1684,6 +1676,8 @@ void BMS_Trigger(void) {
     /* Send an asynchronous bms state message if the state or substate changed*/
     if ((bms_state.state != bms_state.lastState) || (bms_state.substate != bms_state.lastSubstate)) {
         CANTX_TransmitBmsState();
+        (void)LOG_Write(
+            LOG_MESSAGE_ID_BMS_STATE, (uint32_t)bms_state.state, (uint32_t)bms_state.substate, 0u, 0u);
     }
 
     bms_state.triggerentry--;
@@ -43,7 +43,7 @@
  * @file    bal_cfg.h
  * @author  foxBMS Team
  * @date    2020-02-24 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS_CONFIGURATION
  * @prefix  BAL
@@ -89,6 +89,12 @@
 /** BAL upper temperature limit in deci &deg;C */
 #define BAL_UPPER_TEMPERATURE_LIMIT_ddegC (700)
 
+/** maximum number of balancing channels of a module that are active at the same time */
+#define BAL_MAXIMUM_ACTIVE_CHANNELS_PER_MODULE (8u)
+
+/** maximum power the balancing resistors of a module may dissipate in mW (thermal limit of the module) */
+#define BAL_MAXIMUM_POWER_PER_MODULE_mW (1000u)
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
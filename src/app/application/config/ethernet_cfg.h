@@ -96,11 +96,23 @@ extern const uint8_t eth_dnsServerAddress[4u];
 #define ETH_ECHO_SERVER_SHUTDOWN_DELAY (pdMS_TO_TICKS(5000))
 /** @} */
 
+/** @{
+ * Telemetry server configuration
+ */
+/* UDP port on which subscription requests are received */
+#define ETH_TELEMETRY_PORT_NUMBER (5005u)
+/* Cycle time in which the telemetry server checks for due streams */
+#define ETH_TELEMETRY_CYCLE_TIME_ms (10u)
+/* Subscriptions are cleared if the client does not renew them within this time */
+#define ETH_TELEMETRY_SUBSCRIPTION_TIMEOUT_ms (5000u)
+/** @} */
+
 /** @{
  * Task configuration
  */
 #define ETH_ECHO_SERVER_TASK_STACK_SIZE_B (4096u)
 #define ETH_LISTENING_TASK_STACK_SIZE_B   (2048u)
+#define ETH_TELEMETRY_TASK_STACK_SIZE_B   (2048u)
 /** @} */
 
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
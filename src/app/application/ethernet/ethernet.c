@@ -43,7 +43,7 @@
  * @file    ethernet.c
  * @author  foxBMS Team
  * @date    2025-05-30 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup APPLICATION
  * @prefix  ETH
@@ -66,9 +66,11 @@
 #include "NetworkInterface.h"
 #include "NetworkInterface_custom.h"
 #include "ethernet_freertos.h"
+#include "ethernet_telemetry.h"
 #include "fassert.h"
 #include "fstd_types.h"
 #include "infinite-loop-helper.h"
+#include "mem_pool.h"
 #include "os.h"
 #include "stdbool.h"
 #include "utils.h"
@@ -387,6 +389,9 @@ extern void vApplicationIPNetworkEventHook_Multi(
         if (ETH_CreateEchoServerTask(&ETH_EchoServerInstance) != ETH_OK) {
             FreeRTOS_debug_printf(("Failed to create Echo Server Task\n"));
         }
+        if (ETH_CreateTelemetryTask(&ETH_RunTelemetryServer) != ETH_OK) {
+            FreeRTOS_debug_printf(("Failed to create Telemetry Task\n"));
+        }
     }
 }
 
@@ -413,6 +418,27 @@ extern BaseType_t xApplicationDNSQueryHook_Multi(struct xNetworkEndPoint *pxEndP
     return pdTRUE;
 }
 
+/* Memory hooks of FreeRTOS+TCP, declared in FreeRTOSIPConfig.h */
+extern void *ETH_AllocateSocket(size_t size) {
+    /* AXIVION Routine Generic-MissingParameterAssert: size: too large requests fail in the memory pool */
+    return MPOOL_Allocate(MPOOL_ID_SOCKET, (uint32_t)size);
+}
+
+extern void ETH_FreeSocket(void *pSocket) {
+    /* AXIVION Routine Generic-MissingParameterAssert: pSocket: checked by the memory pool */
+    MPOOL_Free(MPOOL_ID_SOCKET, pSocket);
+}
+
+extern void *ETH_AllocateTcpBuffer(size_t size) {
+    /* AXIVION Routine Generic-MissingParameterAssert: size: too large requests fail in the memory pool */
+    return MPOOL_Allocate(MPOOL_ID_TCP_BUFFER, (uint32_t)size);
+}
+
+extern void ETH_FreeTcpBuffer(void *pBuffer) {
+    /* AXIVION Routine Generic-MissingParameterAssert: pBuffer: checked by the memory pool */
+    MPOOL_Free(MPOOL_ID_TCP_BUFFER, pBuffer);
+}
+
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
 void TEST_ETH_EchoServerInstance(void *pParameters) {
@@ -71,6 +71,7 @@
 
 OS_TASK_HANDLE eth_taskHandleListening;
 OS_TASK_HANDLE eth_taskHandleEchoServer;
+OS_TASK_HANDLE eth_taskHandleTelemetry;
 
 /*========== Extern Constant and Variable Definitions =======================*/
 
@@ -140,6 +141,35 @@ extern ETH_RETURN_TYPE_e ETH_CreateEchoServerTask(TaskFunction_t taskFunction) {
     return ETH_OK;
 }
 
+extern ETH_RETURN_TYPE_e ETH_CreateTelemetryTask(TaskFunction_t taskFunction) {
+    FAS_ASSERT(taskFunction != NULL_PTR);
+
+    static bool taskAlreadyCreated                                         = false;
+    static StackType_t eth_stackTelemetry[ETH_TELEMETRY_TASK_STACK_SIZE_B] = {0};
+    static StaticTask_t eth_taskTelemetry                                  = {0};
+
+    OS_EnterTaskCritical();
+    if (taskAlreadyCreated == true) {
+        OS_ExitTaskCritical();
+        return ETH_TASK_ALREADY_CREATED;
+    }
+    taskAlreadyCreated = true;
+    OS_ExitTaskCritical();
+
+    /* Spawn the telemetry server task */
+    eth_taskHandleTelemetry = xTaskCreateStatic(
+        taskFunction,
+        "Telemetry-Task",
+        ETH_BYTES_TO_WORDS(ETH_TELEMETRY_TASK_STACK_SIZE_B),
+        NULL_PTR,
+        (uint32_t)PRIORITY_BELOW_NORMAL,
+        &eth_stackTelemetry[0],
+        &eth_taskTelemetry);
+    FAS_ASSERT(eth_taskHandleTelemetry != NULL); /* Trap if initialization failed */
+
+    return ETH_OK;
+}
+
 extern void ETH_DeleteCurrentTask(void) {
     vTaskDelete(NULL);
 }
@@ -96,6 +96,18 @@ extern ETH_RETURN_TYPE_e ETH_CreateListeningTask(TaskFunction_t taskFunction, Ne
  *         ETH_TASK_ALREADY_CREATED if the task already exists.
  */
 extern ETH_RETURN_TYPE_e ETH_CreateEchoServerTask(TaskFunction_t taskFunction);
+/**
+ * @brief Creates the telemetry server task.
+ *
+ * @details This function creates the task that streams database snapshots
+ * via UDP using FreeRTOS's xTaskCreateStatic.
+ *
+ * @param[in] taskFunction   Pointer to the task function to be executed.
+ *
+ * @return ETH_OK on successful creation,
+ *         ETH_TASK_ALREADY_CREATED if the task already exists.
+ */
+extern ETH_RETURN_TYPE_e ETH_CreateTelemetryTask(TaskFunction_t taskFunction);
 /**
  * @brief Deletes the currently running task.
  *
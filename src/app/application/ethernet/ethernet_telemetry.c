@@ -0,0 +1,547 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    ethernet_telemetry.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup APPLICATION
+ * @prefix  ETH
+ *
+ * @brief   Implementation of the ethernet telemetry server
+ * @details Streams snapshots of database entries to one subscribed client via
+ *          UDP. The record format is described in ethernet_telemetry.h.
+ */
+
+/*========== Includes =======================================================*/
+#include "foxbms_config.h"
+
+#include "ethernet_telemetry.h"
+
+#include "battery_system_cfg.h"
+#include "database_cfg.h"
+#include "ethernet_cfg.h"
+
+#include "FreeRTOS_IP.h"
+#include "FreeRTOS_Sockets.h"
+
+#include "database.h"
+#include "fassert.h"
+#include "fbitset.h"
+#include "fstd_types.h"
+#include "infinite-loop-helper.h"
+#include "os.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** number of values transmitted in the pack values stream */
+#define ETH_TELEMETRY_NUMBER_OF_PACK_VALUES (4u)
+
+/** maximum payload of a UDP datagram that is not fragmented */
+#define ETH_TELEMETRY_MAXIMUM_RECORD_LENGTH (ipconfigNETWORK_MTU - 28u)
+
+/** layout of the values of a telemetry stream */
+typedef struct {
+    uint8_t valueSize;       /*!< size of one value in bytes */
+    uint16_t numberOfValues; /*!< number of values per record */
+} ETH_TELEMETRY_STREAM_LAYOUT_s;
+
+/** subscription state of a telemetry stream */
+typedef struct {
+    bool isSubscribed;            /*!< true if the client subscribed to the stream */
+    uint16_t period_ms;           /*!< transmission period; 0: on every database update */
+    uint16_t sequence;            /*!< sequence number of the next record */
+    uint32_t lastTransmission_ms; /*!< time of the last transmission */
+    uint32_t lastDataTimestamp;   /*!< database timestamp of the last transmitted record */
+} ETH_TELEMETRY_SUBSCRIPTION_s;
+
+/** state of the telemetry server */
+typedef struct {
+    bool hasClient;                         /*!< true if a client has sent a valid request */
+    struct freertos_sockaddr clientAddress; /*!< address of the client */
+    uint32_t lastRequest_ms;                /*!< time of the last valid request */
+    uint32_t droppedRecords;                /*!< records that could not be handed to the stack */
+    /** subscription state per stream, indexed by #ETH_TELEMETRY_STREAM_e */
+    ETH_TELEMETRY_SUBSCRIPTION_s subscriptions[ETH_TELEMETRY_STREAM_E_MAX];
+} ETH_TELEMETRY_STATE_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/** value layout of each stream, indexed by #ETH_TELEMETRY_STREAM_e */
+static const ETH_TELEMETRY_STREAM_LAYOUT_s eth_telemetryStreamLayout[ETH_TELEMETRY_STREAM_E_MAX] = {
+    {(uint8_t)sizeof(int16_t), (uint16_t)(BS_NR_OF_STRINGS * BS_NR_OF_CELL_BLOCKS_PER_STRING)},
+    {(uint8_t)sizeof(int16_t), (uint16_t)(BS_NR_OF_STRINGS * BS_NR_OF_TEMP_SENSORS_PER_STRING)},
+    {(uint8_t)sizeof(int32_t), (uint16_t)ETH_TELEMETRY_NUMBER_OF_PACK_VALUES},
+};
+
+FAS_STATIC_ASSERT(
+    (ETH_TELEMETRY_RECORD_HEADER_LENGTH + (sizeof(int16_t) * BS_NR_OF_STRINGS * BS_NR_OF_CELL_BLOCKS_PER_STRING)) <=
+        ETH_TELEMETRY_MAXIMUM_RECORD_LENGTH,
+    "Cell voltage telemetry record does not fit into one UDP datagram");
+FAS_STATIC_ASSERT(
+    (ETH_TELEMETRY_RECORD_HEADER_LENGTH + (sizeof(int16_t) * BS_NR_OF_STRINGS * BS_NR_OF_TEMP_SENSORS_PER_STRING)) <=
+        ETH_TELEMETRY_MAXIMUM_RECORD_LENGTH,
+    "Cell temperature telemetry record does not fit into one UDP datagram");
+
+/** state of the telemetry server */
+static ETH_TELEMETRY_STATE_s eth_telemetry = {0};
+
+/** @{
+ * local copies of the database entries that are streamed
+ */
+static DATA_BLOCK_CELL_VOLTAGE_s eth_telemetryCellVoltage         = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+static DATA_BLOCK_CELL_TEMPERATURE_s eth_telemetryCellTemperature = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+static DATA_BLOCK_PACK_VALUES_s eth_telemetryPackValues           = {.header.uniqueId = DATA_BLOCK_ID_PACK_VALUES};
+/** @} */
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/** writes a 16-bit value in big-endian byte order */
+static void ETH_WriteTelemetryUint16(uint8_t *const pBuffer, uint16_t value);
+
+/** writes a 32-bit value in big-endian byte order */
+static void ETH_WriteTelemetryUint32(uint8_t *const pBuffer, uint32_t value);
+
+/**
+ * @brief   Clears the client and all subscriptions.
+ */
+static void ETH_ResetTelemetrySubscriptions(void);
+
+/**
+ * @brief   Handles a subscription request of a client.
+ * @details Only one client is served. Requests of other clients are
+ *          rejected until the current client has not sent a request for
+ *          #ETH_TELEMETRY_SUBSCRIPTION_TIMEOUT_ms or has cancelled all of its
+ *          subscriptions; the next client then replaces it. Every valid
+ *          request renews the subscriptions of the client.
+ * @param   pRequest  received request
+ * @param   length    length of the received request in bytes
+ * @param   pClient   address of the client that sent the request
+ * @param   timestamp current time in ms
+ * @return  #STD_OK if the request was valid, otherwise #STD_NOT_OK
+ */
+static STD_RETURN_TYPE_e ETH_ProcessTelemetryRequest(
+    const uint8_t *const pRequest,
+    int32_t length,
+    const struct freertos_sockaddr *const pClient,
+    uint32_t timestamp);
+
+/**
+ * @brief   Returns the length of a record of a stream in bytes.
+ * @param   stream  telemetry stream
+ * @return  length of the record including the header
+ */
+static uint32_t ETH_GetTelemetryRecordLength(ETH_TELEMETRY_STREAM_e stream);
+
+/**
+ * @brief   Returns the header of the local copy of the database entry of a
+ *          stream.
+ * @param   stream  telemetry stream
+ * @return  pointer to the database header
+ */
+static const DATA_BLOCK_HEADER_s *ETH_GetTelemetryDataHeader(ETH_TELEMETRY_STREAM_e stream);
+
+/**
+ * @brief   Updates the local copy of the database entry of a stream.
+ * @param   stream  telemetry stream
+ */
+static void ETH_ReadTelemetryData(ETH_TELEMETRY_STREAM_e stream);
+
+/**
+ * @brief   Checks whether a subscribed stream has to be transmitted.
+ * @details Streams with a period of 0 are due whenever the database entry
+ *          has been updated since the last transmission, all other streams
+ *          are due once their period has elapsed.
+ * @param   stream    telemetry stream
+ * @param   timestamp current time in ms
+ * @return  true if the stream has to be transmitted
+ */
+static bool ETH_IsTelemetryStreamDue(ETH_TELEMETRY_STREAM_e stream, uint32_t timestamp);
+
+/**
+ * @brief   Serializes the local copy of the database entry of a stream.
+ * @param   pBuffer buffer with at least #ETH_GetTelemetryRecordLength bytes
+ * @param   stream  telemetry stream
+ */
+static void ETH_SerializeTelemetryRecord(uint8_t *const pBuffer, ETH_TELEMETRY_STREAM_e stream);
+
+/**
+ * @brief   Transmits all subscribed streams that are due.
+ * @details The records are serialized into a network buffer of the TCP/IP
+ *          stack and handed over without copying. If no network buffer is
+ *          available, the record is skipped and the stream stays due.
+ *          Subscriptions that have not been renewed within
+ *          #ETH_TELEMETRY_SUBSCRIPTION_TIMEOUT_ms are cleared.
+ * @param   socket    UDP socket of the telemetry server
+ * @param   timestamp current time in ms
+ */
+static void ETH_TransmitTelemetryStreams(Socket_t socket, uint32_t timestamp);
+
+/*========== Static Function Implementations ================================*/
+static void ETH_WriteTelemetryUint16(uint8_t *const pBuffer, uint16_t value) {
+    FAS_ASSERT(pBuffer != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: value: accepts whole range */
+    pBuffer[0u] = (uint8_t)(value >> 8u);
+    pBuffer[1u] = (uint8_t)value;
+}
+
+static void ETH_WriteTelemetryUint32(uint8_t *const pBuffer, uint32_t value) {
+    FAS_ASSERT(pBuffer != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: value: accepts whole range */
+    pBuffer[0u] = (uint8_t)(value >> 24u);
+    pBuffer[1u] = (uint8_t)(value >> 16u);
+    pBuffer[2u] = (uint8_t)(value >> 8u);
+    pBuffer[3u] = (uint8_t)value;
+}
+
+static void ETH_ResetTelemetrySubscriptions(void) {
+    eth_telemetry.hasClient = false;
+    for (uint8_t stream = 0u; stream < (uint8_t)ETH_TELEMETRY_STREAM_E_MAX; stream++) {
+        eth_telemetry.subscriptions[stream].isSubscribed = false;
+    }
+}
+
+static STD_RETURN_TYPE_e ETH_ProcessTelemetryRequest(
+    const uint8_t *const pRequest,
+    int32_t length,
+    const struct freertos_sockaddr *const pClient,
+    uint32_t timestamp) {
+    FAS_ASSERT(pRequest != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: length: checked below */
+    FAS_ASSERT(pClient != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp: accepts whole range */
+
+    STD_RETURN_TYPE_e retval = STD_NOT_OK;
+    if (length == (int32_t)ETH_TELEMETRY_REQUEST_LENGTH) {
+        const uint8_t command   = pRequest[0u];
+        const uint8_t stream    = pRequest[1u];
+        const uint16_t period_ms = (uint16_t)(((uint16_t)pRequest[2u] << 8u) | (uint16_t)pRequest[3u]);
+
+        const bool isValidCommand = (command == (uint8_t)ETH_TELEMETRY_COMMAND_SUBSCRIBE) ||
+                                    (command == (uint8_t)ETH_TELEMETRY_COMMAND_UNSUBSCRIBE);
+
+        const bool isSameClient = (eth_telemetry.hasClient == true) &&
+                                  (eth_telemetry.clientAddress.sin_address.ulIP_IPv4 ==
+                                   pClient->sin_address.ulIP_IPv4) &&
+                                  (eth_telemetry.clientAddress.sin_port == pClient->sin_port);
+
+        /* a client that has timed out does not block other clients */
+        const bool isClientActive =
+            (eth_telemetry.hasClient == true) &&
+            ((timestamp - eth_telemetry.lastRequest_ms) < ETH_TELEMETRY_SUBSCRIPTION_TIMEOUT_ms);
+
+        const bool isAcceptedClient = (isSameClient == true) || (isClientActive == false);
+        if ((isValidCommand == true) && (stream < (uint8_t)ETH_TELEMETRY_STREAM_E_MAX) && (isAcceptedClient == true)) {
+            if (isSameClient == false) {
+                ETH_ResetTelemetrySubscriptions();
+                eth_telemetry.clientAddress = *pClient;
+                eth_telemetry.hasClient     = true;
+            }
+            eth_telemetry.lastRequest_ms = timestamp;
+
+            ETH_TELEMETRY_SUBSCRIPTION_s *const pSubscription = &eth_telemetry.subscriptions[stream];
+            if (command == (uint8_t)ETH_TELEMETRY_COMMAND_SUBSCRIBE) {
+                /* periods below the cycle time of the server can not be met */
+                if ((period_ms > 0u) && (period_ms < ETH_TELEMETRY_CYCLE_TIME_ms)) {
+                    pSubscription->period_ms = ETH_TELEMETRY_CYCLE_TIME_ms;
+                } else {
+                    pSubscription->period_ms = period_ms;
+                }
+                if (pSubscription->isSubscribed == false) {
+                    /* transmit a new subscription in the next cycle */
+                    pSubscription->isSubscribed        = true;
+                    pSubscription->lastTransmission_ms = timestamp - pSubscription->period_ms;
+                    pSubscription->lastDataTimestamp   = 0u;
+                }
+            } else {
+                pSubscription->isSubscribed = false;
+                /* release the server for other clients once nothing is subscribed */
+                bool hasSubscriptions = false;
+                for (uint8_t s = 0u; s < (uint8_t)ETH_TELEMETRY_STREAM_E_MAX; s++) {
+                    if (eth_telemetry.subscriptions[s].isSubscribed == true) {
+                        hasSubscriptions = true;
+                    }
+                }
+                eth_telemetry.hasClient = hasSubscriptions;
+            }
+            retval = STD_OK;
+        }
+    }
+    return retval;
+}
+
+static uint32_t ETH_GetTelemetryRecordLength(ETH_TELEMETRY_STREAM_e stream) {
+    FAS_ASSERT(stream < ETH_TELEMETRY_STREAM_E_MAX);
+    return ETH_TELEMETRY_RECORD_HEADER_LENGTH + ((uint32_t)eth_telemetryStreamLayout[stream].valueSize *
+                                                 (uint32_t)eth_telemetryStreamLayout[stream].numberOfValues);
+}
+
+static const DATA_BLOCK_HEADER_s *ETH_GetTelemetryDataHeader(ETH_TELEMETRY_STREAM_e stream) {
+    FAS_ASSERT(stream < ETH_TELEMETRY_STREAM_E_MAX);
+    const DATA_BLOCK_HEADER_s *pHeader = NULL_PTR;
+    switch (stream) {
+        case ETH_TELEMETRY_STREAM_CELL_VOLTAGE:
+            pHeader = &eth_telemetryCellVoltage.header;
+            break;
+        case ETH_TELEMETRY_STREAM_CELL_TEMPERATURE:
+            pHeader = &eth_telemetryCellTemperature.header;
+            break;
+        default:
+            pHeader = &eth_telemetryPackValues.header;
+            break;
+    }
+    return pHeader;
+}
+
+static void ETH_ReadTelemetryData(ETH_TELEMETRY_STREAM_e stream) {
+    FAS_ASSERT(stream < ETH_TELEMETRY_STREAM_E_MAX);
+    switch (stream) {
+        case ETH_TELEMETRY_STREAM_CELL_VOLTAGE:
+            DATA_READ_DATA(&eth_telemetryCellVoltage);
+            break;
+        case ETH_TELEMETRY_STREAM_CELL_TEMPERATURE:
+            DATA_READ_DATA(&eth_telemetryCellTemperature);
+            break;
+        default:
+            DATA_READ_DATA(&eth_telemetryPackValues);
+            break;
+    }
+}
+
+static bool ETH_IsTelemetryStreamDue(ETH_TELEMETRY_STREAM_e stream, uint32_t timestamp) {
+    FAS_ASSERT(stream < ETH_TELEMETRY_STREAM_E_MAX);
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp: accepts whole range */
+
+    bool isDue                                              = false;
+    const ETH_TELEMETRY_SUBSCRIPTION_s *const pSubscription = &eth_telemetry.subscriptions[stream];
+    if (pSubscription->isSubscribed == true) {
+        if (pSubscription->period_ms == 0u) {
+            isDue = (ETH_GetTelemetryDataHeader(stream)->timestamp != pSubscription->lastDataTimestamp);
+        } else {
+            isDue = ((timestamp - pSubscription->lastTransmission_ms) >= pSubscription->period_ms);
+        }
+    }
+    return isDue;
+}
+
+static void ETH_SerializeTelemetryRecord(uint8_t *const pBuffer, ETH_TELEMETRY_STREAM_e stream) {
+    FAS_ASSERT(pBuffer != NULL_PTR);
+    FAS_ASSERT(stream < ETH_TELEMETRY_STREAM_E_MAX);
+
+    const ETH_TELEMETRY_STREAM_LAYOUT_s *const pLayout = &eth_telemetryStreamLayout[stream];
+
+    pBuffer[0u] = ETH_TELEMETRY_SYNC_BYTE;
+    pBuffer[1u] = ETH_TELEMETRY_PROTOCOL_VERSION;
+    pBuffer[2u] = (uint8_t)stream;
+    pBuffer[3u] = pLayout->valueSize;
+    ETH_WriteTelemetryUint16(&pBuffer[4u], eth_telemetry.subscriptions[stream].sequence);
+    ETH_WriteTelemetryUint16(&pBuffer[6u], pLayout->numberOfValues);
+    ETH_WriteTelemetryUint32(&pBuffer[8u], ETH_GetTelemetryDataHeader(stream)->timestamp);
+
+    uint8_t *const pValues = &pBuffer[ETH_TELEMETRY_RECORD_HEADER_LENGTH];
+    uint16_t index         = 0u;
+    switch (stream) {
+        case ETH_TELEMETRY_STREAM_CELL_VOLTAGE:
+            for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+                for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+                    for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                        int16_t value = eth_telemetryCellVoltage.cellVoltage_mV[s][m][cb];
+                        if (BITSET_IsBitSet(eth_telemetryCellVoltage.invalidCellVoltage[s][m], cb) == true) {
+                            value = INT16_MIN;
+                        }
+                        ETH_WriteTelemetryUint16(&pValues[sizeof(int16_t) * index], (uint16_t)value);
+                        index++;
+                    }
+                }
+            }
+            break;
+        case ETH_TELEMETRY_STREAM_CELL_TEMPERATURE:
+            for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+                for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+                    for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
+                        int16_t value = eth_telemetryCellTemperature.cellTemperature_ddegC[s][m][ts];
+                        if (BITSET_IsBitSet(eth_telemetryCellTemperature.invalidCellTemperature[s][m], ts) == true) {
+                            value = INT16_MIN;
+                        }
+                        ETH_WriteTelemetryUint16(&pValues[sizeof(int16_t) * index], (uint16_t)value);
+                        index++;
+                    }
+                }
+            }
+            break;
+        default: {
+            const int32_t values[ETH_TELEMETRY_NUMBER_OF_PACK_VALUES] = {
+                (eth_telemetryPackValues.invalidPackCurrent == 0u) ? eth_telemetryPackValues.packCurrent_mA
+                                                                   : INT32_MIN,
+                (eth_telemetryPackValues.invalidBatteryVoltage == 0u) ? eth_telemetryPackValues.batteryVoltage_mV
+                                                                      : INT32_MIN,
+                (eth_telemetryPackValues.invalidHvBusVoltage == 0u) ? eth_telemetryPackValues.highVoltageBusVoltage_mV
+                                                                    : INT32_MIN,
+                (eth_telemetryPackValues.invalidPackPower == 0u) ? eth_telemetryPackValues.packPower_W : INT32_MIN,
+            };
+            for (index = 0u; index < ETH_TELEMETRY_NUMBER_OF_PACK_VALUES; index++) {
+                ETH_WriteTelemetryUint32(&pValues[sizeof(int32_t) * index], (uint32_t)values[index]);
+            }
+            break;
+        }
+    }
+}
+
+static void ETH_TransmitTelemetryStreams(Socket_t socket, uint32_t timestamp) {
+    FAS_ASSERT(socket != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp: accepts whole range */
+
+    if ((eth_telemetry.hasClient == true) &&
+        ((timestamp - eth_telemetry.lastRequest_ms) >= ETH_TELEMETRY_SUBSCRIPTION_TIMEOUT_ms)) {
+        ETH_ResetTelemetrySubscriptions();
+    }
+
+    for (uint8_t s = 0u; s < (uint8_t)ETH_TELEMETRY_STREAM_E_MAX; s++) {
+        const ETH_TELEMETRY_STREAM_e stream = (ETH_TELEMETRY_STREAM_e)s;
+        if (eth_telemetry.subscriptions[stream].isSubscribed == true) {
+            ETH_ReadTelemetryData(stream);
+        }
+        if (ETH_IsTelemetryStreamDue(stream, timestamp) == true) {
+            const uint32_t length = ETH_GetTelemetryRecordLength(stream);
+            /* do not block, the record is retried in the next cycle */
+            uint8_t *pPayload = (uint8_t *)FreeRTOS_GetUDPPayloadBuffer_Multi(length, 0u, ipTYPE_IPv4);
+            if (pPayload != NULL_PTR) {
+                ETH_SerializeTelemetryRecord(pPayload, stream);
+                const int32_t sentBytes = FreeRTOS_sendto(
+                    socket,
+                    pPayload,
+                    length,
+                    FREERTOS_ZERO_COPY,
+                    &eth_telemetry.clientAddress,
+                    sizeof(eth_telemetry.clientAddress));
+                if (sentBytes == 0) {
+                    /* the stack did not take over the buffer */
+                    FreeRTOS_ReleaseUDPPayloadBuffer(pPayload);
+                    eth_telemetry.droppedRecords++;
+                } else {
+                    ETH_TELEMETRY_SUBSCRIPTION_s *const pSubscription = &eth_telemetry.subscriptions[stream];
+                    pSubscription->lastTransmission_ms                = timestamp;
+                    pSubscription->lastDataTimestamp                  = ETH_GetTelemetryDataHeader(stream)->timestamp;
+                    pSubscription->sequence++;
+                }
+            } else {
+                eth_telemetry.droppedRecords++;
+            }
+        }
+    }
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void ETH_RunTelemetryServer(void *pParameters) {
+    FAS_ASSERT(pParameters == NULL_PTR);
+
+    Socket_t telemetrySocket = FreeRTOS_socket(FREERTOS_AF_INET, FREERTOS_SOCK_DGRAM, FREERTOS_IPPROTO_UDP);
+    /* AXIVION Next Codeline IISB-LiteralSuffixesCheck:Content from FreeRTOS file */
+    FAS_ASSERT(telemetrySocket != FREERTOS_INVALID_SOCKET);
+
+    /* Wait at most one cycle for requests, so that due streams are
+     * transmitted in time */
+    static const TickType_t receiveTimeOut = pdMS_TO_TICKS(ETH_TELEMETRY_CYCLE_TIME_ms);
+    BaseType_t success =
+        FreeRTOS_setsockopt(telemetrySocket, 0, FREERTOS_SO_RCVTIMEO, &receiveTimeOut, sizeof(receiveTimeOut));
+    FAS_ASSERT(success == pdFREERTOS_ERRNO_NONE);
+
+    struct freertos_sockaddr bindAddress = {
+        .sin_port   = FreeRTOS_htons(ETH_TELEMETRY_PORT_NUMBER),
+        .sin_family = FREERTOS_AF_INET,
+    };
+    success = FreeRTOS_bind(telemetrySocket, &bindAddress, sizeof(bindAddress));
+    FAS_ASSERT(success == pdFREERTOS_ERRNO_NONE);
+
+    while (FOREVER()) {
+        /* one byte more than a valid request to detect oversized requests */
+        uint8_t request[ETH_TELEMETRY_REQUEST_LENGTH + 1u] = {0u};
+        struct freertos_sockaddr clientAddress             = {0};
+        socklen_t clientAddressSize                        = sizeof(clientAddress);
+
+        const int32_t receivedBytes =
+            FreeRTOS_recvfrom(telemetrySocket, request, sizeof(request), 0, &clientAddress, &clientAddressSize);
+        if (receivedBytes > 0) {
+            (void)ETH_ProcessTelemetryRequest(request, receivedBytes, &clientAddress, OS_GetTickCount());
+        }
+        ETH_TransmitTelemetryStreams(telemetrySocket, OS_GetTickCount());
+    }
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern STD_RETURN_TYPE_e TEST_ETH_ProcessTelemetryRequest(
+    const uint8_t *const pRequest,
+    int32_t length,
+    const struct freertos_sockaddr *const pClient,
+    uint32_t timestamp) {
+    return ETH_ProcessTelemetryRequest(pRequest, length, pClient, timestamp);
+}
+extern uint32_t TEST_ETH_GetTelemetryRecordLength(ETH_TELEMETRY_STREAM_e stream) {
+    return ETH_GetTelemetryRecordLength(stream);
+}
+extern bool TEST_ETH_IsTelemetryStreamDue(ETH_TELEMETRY_STREAM_e stream, uint32_t timestamp) {
+    return ETH_IsTelemetryStreamDue(stream, timestamp);
+}
+extern void TEST_ETH_SerializeTelemetryRecord(uint8_t *const pBuffer, ETH_TELEMETRY_STREAM_e stream) {
+    ETH_SerializeTelemetryRecord(pBuffer, stream);
+}
+extern void TEST_ETH_TransmitTelemetryStreams(Socket_t socket, uint32_t timestamp) {
+    ETH_TransmitTelemetryStreams(socket, timestamp);
+}
+extern void TEST_ETH_ResetTelemetry(void) {
+    ETH_ResetTelemetrySubscriptions();
+    for (uint8_t stream = 0u; stream < (uint8_t)ETH_TELEMETRY_STREAM_E_MAX; stream++) {
+        eth_telemetry.subscriptions[stream].sequence = 0u;
+    }
+    eth_telemetry.droppedRecords = 0u;
+}
+extern bool TEST_ETH_IsTelemetryStreamSubscribed(ETH_TELEMETRY_STREAM_e stream) {
+    return eth_telemetry.subscriptions[stream].isSubscribed;
+}
+#endif
@@ -0,0 +1,146 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    ethernet_telemetry.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup APPLICATION
+ * @prefix  ETH
+ *
+ * @brief   Header of the ethernet telemetry server
+ * @details The telemetry server streams snapshots of selected database
+ *          entries as compact binary records via UDP. A client subscribes to
+ *          the streams it is interested in and selects the transmission
+ *          period per stream.
+ *
+ *          Subscription request (client to BMS, 4 bytes):
+ *          - command (#ETH_TELEMETRY_COMMAND_e)
+ *          - stream (#ETH_TELEMETRY_STREAM_e)
+ *          - period in ms (uint16_t, big-endian); 0 means that the stream is
+ *            transmitted on every update of the database entry
+ *
+ *          Telemetry record (BMS to client):
+ *          - sync byte #ETH_TELEMETRY_SYNC_BYTE
+ *          - protocol version #ETH_TELEMETRY_PROTOCOL_VERSION
+ *          - stream (#ETH_TELEMETRY_STREAM_e)
+ *          - size of one value in bytes
+ *          - sequence number (uint16_t)
+ *          - number of values (uint16_t)
+ *          - timestamp of the database entry (uint32_t)
+ *          - values (signed, big-endian); invalid values are transmitted as
+ *            the minimum value of the respective type
+ */
+
+#ifndef FOXBMS__ETHERNET_TELEMETRY_H_
+#define FOXBMS__ETHERNET_TELEMETRY_H_
+
+/*========== Includes =======================================================*/
+
+#include "FreeRTOS_Sockets.h"
+
+#include "fstd_types.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** first byte of each telemetry record */
+#define ETH_TELEMETRY_SYNC_BYTE (0x5Au)
+
+/** version of the telemetry record format */
+#define ETH_TELEMETRY_PROTOCOL_VERSION (1u)
+
+/** length of a subscription request in bytes */
+#define ETH_TELEMETRY_REQUEST_LENGTH (4u)
+
+/** length of the header of a telemetry record in bytes */
+#define ETH_TELEMETRY_RECORD_HEADER_LENGTH (12u)
+
+/** commands that can be sent by the telemetry client */
+typedef enum {
+    ETH_TELEMETRY_COMMAND_SUBSCRIBE   = 1u, /*!< subscribe to a stream or renew the subscription */
+    ETH_TELEMETRY_COMMAND_UNSUBSCRIBE = 2u, /*!< cancel the subscription of a stream */
+} ETH_TELEMETRY_COMMAND_e;
+
+/** streams that are provided by the telemetry server */
+typedef enum {
+    ETH_TELEMETRY_STREAM_CELL_VOLTAGE,     /*!< all cell voltages, int16_t in mV */
+    ETH_TELEMETRY_STREAM_CELL_TEMPERATURE, /*!< all cell temperatures, int16_t in deci &deg;C */
+    ETH_TELEMETRY_STREAM_PACK_VALUES,      /*!< pack current, battery voltage, HV bus voltage and power, int32_t */
+    ETH_TELEMETRY_STREAM_E_MAX,            /*!< number of streams */
+} ETH_TELEMETRY_STREAM_e;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/**
+ * @brief   Runs the telemetry server.
+ * @details Opens the UDP socket on #ETH_TELEMETRY_PORT_NUMBER, handles
+ *          subscription requests and transmits the subscribed streams when
+ *          they are due. The records are written directly into the network
+ *          buffers of the TCP/IP stack (zero copy).
+ *          This function is the task function of the telemetry task and does
+ *          not return.
+ * @param   pParameters task parameters (not used)
+ */
+extern void ETH_RunTelemetryServer(void *pParameters);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern STD_RETURN_TYPE_e TEST_ETH_ProcessTelemetryRequest(
+    const uint8_t *const pRequest,
+    int32_t length,
+    const struct freertos_sockaddr *const pClient,
+    uint32_t timestamp);
+extern uint32_t TEST_ETH_GetTelemetryRecordLength(ETH_TELEMETRY_STREAM_e stream);
+extern bool TEST_ETH_IsTelemetryStreamDue(ETH_TELEMETRY_STREAM_e stream, uint32_t timestamp);
+extern void TEST_ETH_SerializeTelemetryRecord(uint8_t *const pBuffer, ETH_TELEMETRY_STREAM_e stream);
+extern void TEST_ETH_TransmitTelemetryStreams(Socket_t socket, uint32_t timestamp);
+extern void TEST_ETH_ResetTelemetry(void);
+extern bool TEST_ETH_IsTelemetryStreamSubscribed(ETH_TELEMETRY_STREAM_e stream);
+#endif
+
+#endif /* FOXBMS__ETHERNET_TELEMETRY_H_ */
@@ -43,7 +43,7 @@
  * @file    plausibility.c
  * @author  foxBMS Team
  * @date    2020-02-24 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup APPLICATION
  * @prefix  PL
@@ -59,6 +59,7 @@
 #include "battery_system_cfg.h"
 
 #include "diag.h"
+#include "fbitset.h"
 #include "foxmath.h"
 
 #include <stdint.h>
@@ -138,14 +139,14 @@ extern STD_RETURN_TYPE_e PL_CheckVoltageSpread(
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
             for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
                 /* Only do check for valid voltages */
-                if (pCellVoltages->invalidCellVoltage[s][m][cb] == false) {
+                if (BITSET_IsBitSet(pCellVoltages->invalidCellVoltage[s][m], cb) == false) {
                     if (abs(pCellVoltages->cellVoltage_mV[s][m][cb] - pMinMaxAverageValues->averageCellVoltage_mV[s]) >
                         PL_CELL_VOLTAGE_SPREAD_TOLERANCE_mV) {
                         /* Voltage difference too large */
                         plausibilityIssueDetected = STD_NOT_OK;
                         retval                    = STD_NOT_OK;
                         /* Set this cell voltage invalid */
-                        pCellVoltages->invalidCellVoltage[s][m][cb] = true;
+                        BITSET_WriteBit(&pCellVoltages->invalidCellVoltage[s][m], cb, true);
                     }
                 }
             }
@@ -170,7 +171,7 @@ extern STD_RETURN_TYPE_e PL_CheckTemperatureSpread(
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
             for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
                 /* Only do check for valid temperatures */
-                if (pCellTemperatures->invalidCellTemperature[s][m][ts] == false) {
+                if (BITSET_IsBitSet(pCellTemperatures->invalidCellTemperature[s][m], ts) == false) {
                     if (abs(pCellTemperatures->cellTemperature_ddegC[s][m][ts] -
                             (int16_t)pMinMaxAverageValues->averageTemperature_ddegC[s]) >
                         PL_CELL_TEMPERATURE_SPREAD_TOLERANCE_dK) {
@@ -178,7 +179,7 @@ extern STD_RETURN_TYPE_e PL_CheckTemperatureSpread(
                         plausibilityIssueDetected = STD_NOT_OK;
                         retval                    = STD_NOT_OK;
                         /* Set this cell temperature invalid */
-                        pCellTemperatures->invalidCellTemperature[s][m][ts] = true;
+                        BITSET_WriteBit(&pCellTemperatures->invalidCellTemperature[s][m], ts, true);
                     } else {
                         pCellTemperatures->nrValidTemperatures[s]++;
                     }
@@ -43,7 +43,7 @@
  * @file    redundancy.c
  * @author  foxBMS Team
  * @date    2020-07-31 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup APPLICATION
  * @prefix  MRC
@@ -59,15 +59,31 @@
 #include "bms.h"
 #include "database.h"
 #include "diag.h"
+#include "fbitset.h"
 #include "foxmath.h"
 #include "os.h"
 #include "plausibility.h"
+#include "sys_mon_latency.h"
 
 #include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
+/** number of database entries that trigger the validation of the AFE measurement */
+#define MRC_NUMBER_OF_AFE_VALIDATION_INPUTS \
+    ((uint8_t)(sizeof(mrc_afeValidationInputs) / sizeof(mrc_afeValidationInputs[0])))
+/** number of database entries that trigger the validation of the pack measurement */
+#define MRC_NUMBER_OF_PACK_VALIDATION_INPUTS \
+    ((uint8_t)(sizeof(mrc_packValidationInputs) / sizeof(mrc_packValidationInputs[0])))
+
+/* the fallback validation needs to run before the measurement timeouts elapse */
+FAS_STATIC_ASSERT(
+    MRC_VALIDATION_FALLBACK_PERIOD_ms < MRC_AFE_MEASUREMENT_PERIOD_TIMEOUT_ms,
+    "Fallback period of the validation has to be shorter than the AFE measurement timeout");
+FAS_STATIC_ASSERT(
+    MRC_VALIDATION_FALLBACK_PERIOD_ms < MRC_CURRENT_MEASUREMENT_PERIOD_TIMEOUT_ms,
+    "Fallback period of the validation has to be shorter than the current measurement timeout");
 
 /*========== Static Constant and Variable Definitions =======================*/
 /** local copies of database tables */
@@ -85,11 +101,59 @@ static MRC_STATE_s mrc_state = {
     .lastBaseCellTemperatureTimestamp        = 0u,
     .lastRedundancy0CellTemperatureTimestamp = 0u,
     .lastStringCurrentTimestamp              = {0u},
+    .afeValidation                           = {.numberOfInputUpdates = 0u, .lastValidationTimestamp = 0u},
+    .packValidation                          = {.numberOfInputUpdates = 0u, .lastValidationTimestamp = 0u},
+};
+
+/** database entries whose update triggers the validation of the AFE measurement */
+static const DATA_BLOCK_ID_e mrc_afeValidationInputs[] = {
+    DATA_BLOCK_ID_CELL_VOLTAGE_BASE,
+    DATA_BLOCK_ID_CELL_VOLTAGE_REDUNDANCY0,
+    DATA_BLOCK_ID_CELL_TEMPERATURE_BASE,
+    DATA_BLOCK_ID_CELL_TEMPERATURE_REDUNDANCY0,
+};
+
+/**
+ * database entries whose update triggers the validation of the pack
+ * measurement (the validated cell voltages are used as fallback for the
+ * string voltage)
+ */
+static const DATA_BLOCK_ID_e mrc_packValidationInputs[] = {
+    DATA_BLOCK_ID_CURRENT,
+    DATA_BLOCK_ID_SYSTEM_VOLTAGE_1,
+    DATA_BLOCK_ID_SYSTEM_VOLTAGE_3,
+    DATA_BLOCK_ID_POWER,
+    DATA_BLOCK_ID_CELL_VOLTAGE,
 };
 
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   Returns the summed up number of writes to the passed database
+ *          entries
+ * @details The sum changes whenever one of the entries is written.
+ * @param[in]  pkInputs        database entries
+ * @param[in]  numberOfInputs  number of database entries
+ * @return summed up number of writes
+ */
+static uint32_t MRC_GetNumberOfInputUpdates(const DATA_BLOCK_ID_e *pkInputs, uint8_t numberOfInputs);
+
+/**
+ * @brief   Checks if a measurement path needs to be validated
+ * @details A validation is due if new input data arrived or if the last
+ *          validation is at least #MRC_VALIDATION_FALLBACK_PERIOD_ms ago. If
+ *          the validation is due, the trigger state is updated.
+ * @param[in,out]  pTrigger              trigger state of the measurement path
+ * @param[in]      numberOfInputUpdates  current number of input updates
+ * @param[in]      timestamp             current timestamp
+ * @return true if the measurement path needs to be validated, otherwise false
+ */
+static bool MRC_IsValidationDue(
+    MRC_VALIDATION_TRIGGER_s *pTrigger,
+    uint32_t numberOfInputUpdates,
+    uint32_t timestamp);
+
 /**
  * @brief   Check timestamp if measurement has been updated at least once.
  * @param[in]  timestamp          timestamp of last measurement update
@@ -244,6 +308,42 @@ static STD_RETURN_TYPE_e MRC_UpdateCellTemperatureValidation(
     DATA_BLOCK_CELL_TEMPERATURE_s *pValidatedTemperature);
 
 /*========== Static Function Implementations ================================*/
+static uint32_t MRC_GetNumberOfInputUpdates(const DATA_BLOCK_ID_e *pkInputs, uint8_t numberOfInputs) {
+    FAS_ASSERT(pkInputs != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: numberOfInputs: parameter accepts whole range */
+    uint32_t numberOfInputUpdates = 0u;
+    for (uint8_t input = 0u; input < numberOfInputs; input++) {
+        /* unsigned overflow is intended, only changes of the sum are of interest */
+        numberOfInputUpdates += DATA_GetNumberOfWrites(pkInputs[input]);
+    }
+    return numberOfInputUpdates;
+}
+
+static bool MRC_IsValidationDue(
+    MRC_VALIDATION_TRIGGER_s *pTrigger,
+    uint32_t numberOfInputUpdates,
+    uint32_t timestamp) {
+    FAS_ASSERT(pTrigger != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: numberOfInputUpdates: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp: parameter accepts whole range */
+    bool isDue = false;
+    if (numberOfInputUpdates != pTrigger->numberOfInputUpdates) {
+        /* new input data arrived */
+        isDue = true;
+    } else if ((timestamp - pTrigger->lastValidationTimestamp) >= MRC_VALIDATION_FALLBACK_PERIOD_ms) {
+        /* no new input data: validate anyway to detect stale measurements;
+           unsigned integer arithmetic also handles the timer overflow */
+        isDue = true;
+    } else {
+        /* nothing to do */
+    }
+    if (isDue == true) {
+        pTrigger->numberOfInputUpdates    = numberOfInputUpdates;
+        pTrigger->lastValidationTimestamp = timestamp;
+    }
+    return isDue;
+}
+
 static bool MRC_MeasurementUpdatedAtLeastOnce(uint32_t timestamp, uint32_t previousTimestamp) {
     bool retval = false;
     if (!((timestamp == 0u) && (previousTimestamp == 0u))) {
@@ -799,8 +899,9 @@ static STD_RETURN_TYPE_e MRC_CalculateCellVoltageMinMaxAverage(
         uint16_t cellNumberMaximum   = 0u;
         /* Iterate over all cells in each string */
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            const BITSET_WORD_t invalidCellVoltage = pValidatedVoltages->invalidCellVoltage[s][m];
             for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                if (pValidatedVoltages->invalidCellVoltage[s][m][cb] == false) {
+                if (BITSET_IsBitSet(invalidCellVoltage, cb) == false) {
                     /* Cell voltage is valid -> use this voltage for subsequent calculations */
                     nrValidCellVoltages++;
                     sum += pValidatedVoltages->cellVoltage_mV[s][m][cb];
@@ -857,8 +958,9 @@ static STD_RETURN_TYPE_e MRC_CalculateCellTemperatureMinMaxAverage(
         float_t sum_ddegC                = 0.0f;
 
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            const BITSET_WORD_t invalidCellTemperature = pValidatedTemperatures->invalidCellTemperature[s][m];
             for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
-                if (pValidatedTemperatures->invalidCellTemperature[s][m][ts] == false) {
+                if (BITSET_IsBitSet(invalidCellTemperature, ts) == false) {
                     /* Cell temperature is valid -> use this voltage for subsequent calculations */
                     nrValidCellTemperatures++;
                     sum_ddegC += (float_t)pValidatedTemperatures->cellTemperature_ddegC[s][m][ts];
@@ -908,42 +1010,43 @@ static STD_RETURN_TYPE_e MRC_ValidateCellVoltage(
     STD_RETURN_TYPE_e noPlausibilityIssueDetected = STD_OK; /* Flag if implausible value detected */
     STD_RETURN_TYPE_e retval                      = STD_OK;
 
+    /* The base measurement determines the provenance of the validated values */
+    pValidatedVoltages->header.acquisitionTimestamp = pCellVoltageBase->header.acquisitionTimestamp;
+
     /* Iterate over all cell measurements */
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         int32_t sum = 0;
         for (uint8_t m = 0; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            const BITSET_WORD_t invalidBase        = pCellVoltageBase->invalidCellVoltage[s][m];
+            const BITSET_WORD_t invalidRedundancy0 = pCellVoltageRedundancy0->invalidCellVoltage[s][m];
+            BITSET_WORD_t invalidValidated         = 0u;
             for (uint8_t cb = 0; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                if ((pCellVoltageBase->invalidCellVoltage[s][m][cb] == false) &&
-                    (pCellVoltageRedundancy0->invalidCellVoltage[s][m][cb] == false)) {
+                const bool isBaseValid        = (BITSET_IsBitSet(invalidBase, cb) == false);
+                const bool isRedundancy0Valid = (BITSET_IsBitSet(invalidRedundancy0, cb) == false);
+                if ((isBaseValid == true) && (isRedundancy0Valid == true)) {
                     /* Check if cell voltage of base AND redundant measurement is valid -> do plausibility check */
                     if (STD_OK == PL_CheckCellVoltage(
                                       pCellVoltageBase->cellVoltage_mV[s][m][cb],
                                       pCellVoltageRedundancy0->cellVoltage_mV[s][m][cb],
                                       &pValidatedVoltages->cellVoltage_mV[s][m][cb])) {
-                        /* Clear valid flag */
-                        pValidatedVoltages->invalidCellVoltage[s][m][cb] = false;
                         numberValidMeasurements++;
                         sum += pValidatedVoltages->cellVoltage_mV[s][m][cb];
                     } else {
                         /* Set invalid flag */
-                        noPlausibilityIssueDetected                      = STD_NOT_OK;
-                        pValidatedVoltages->invalidCellVoltage[s][m][cb] = true;
+                        noPlausibilityIssueDetected = STD_NOT_OK;
+                        BITSET_WriteBit(&invalidValidated, cb, true);
                         /* Set return value to #STD_NOT_OK as not all cell voltages have a valid measurement value */
                         retval = STD_NOT_OK;
                     }
-                } else if (pCellVoltageBase->invalidCellVoltage[s][m][cb] == false) {
+                } else if (isBaseValid == true) {
                     /* Only base measurement value is valid -> use this voltage without further plausibility checks */
                     pValidatedVoltages->cellVoltage_mV[s][m][cb] = pCellVoltageBase->cellVoltage_mV[s][m][cb];
-                    /* Reset valid flag */
-                    pValidatedVoltages->invalidCellVoltage[s][m][cb] = false;
                     numberValidMeasurements++;
                     sum += pValidatedVoltages->cellVoltage_mV[s][m][cb];
-                } else if (pCellVoltageRedundancy0->invalidCellVoltage[s][m][cb] == false) {
+                } else if (isRedundancy0Valid == true) {
                     /* Only redundant measurement value is valid -> use this voltage without further plausibility checks
                      */
                     pValidatedVoltages->cellVoltage_mV[s][m][cb] = pCellVoltageRedundancy0->cellVoltage_mV[s][m][cb];
-                    /* Reset valid flag */
-                    pValidatedVoltages->invalidCellVoltage[s][m][cb] = false;
                     numberValidMeasurements++;
                     sum += pValidatedVoltages->cellVoltage_mV[s][m][cb];
                 } else {
@@ -953,11 +1056,12 @@ static STD_RETURN_TYPE_e MRC_ValidateCellVoltage(
                                                                     pCellVoltageRedundancy0->cellVoltage_mV[s][m][cb]) /
                                                                    2;
                     /* Set invalid flag */
-                    pValidatedVoltages->invalidCellVoltage[s][m][cb] = true;
+                    BITSET_WriteBit(&invalidValidated, cb, true);
                     /* Set return value to #STD_NOT_OK as not all cell voltages have a valid measurement value */
                     retval = STD_NOT_OK;
                 }
             }
+            pValidatedVoltages->invalidCellVoltage[s][m] = invalidValidated;
         }
         pValidatedVoltages->nrValidCellVoltages[s] = numberValidMeasurements;
         pValidatedVoltages->stringVoltage_mV[s]    = sum;
@@ -982,6 +1086,8 @@ static STD_RETURN_TYPE_e MRC_UpdateCellVoltageValidation(
     *pValidatedVoltages = *pCellVoltage;
     /* Restore previous header */
     pValidatedVoltages->header = tmpHeader;
+    /* Keep the provenance of the measurement the values are taken from */
+    pValidatedVoltages->header.acquisitionTimestamp = pCellVoltage->header.acquisitionTimestamp;
 
     return STD_OK;
 }
@@ -1002,40 +1108,38 @@ static STD_RETURN_TYPE_e MRC_ValidateCellTemperature(
     /* Iterate over all cell measurements */
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            const BITSET_WORD_t invalidBase        = pCellTemperatureBase->invalidCellTemperature[s][m];
+            const BITSET_WORD_t invalidRedundancy0 = pCellTemperatureRedundancy0->invalidCellTemperature[s][m];
+            BITSET_WORD_t invalidValidated         = 0u;
             for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
-                if ((pCellTemperatureBase->invalidCellTemperature[s][m][ts] == false) &&
-                    (pCellTemperatureRedundancy0->invalidCellTemperature[s][m][ts] == false)) {
+                const bool isBaseValid        = (BITSET_IsBitSet(invalidBase, ts) == false);
+                const bool isRedundancy0Valid = (BITSET_IsBitSet(invalidRedundancy0, ts) == false);
+                if ((isBaseValid == true) && (isRedundancy0Valid == true)) {
                     /* Check if cell voltage of base AND redundant measurement is valid -> do plausibility check */
                     if (STD_OK == PL_CheckCellTemperature(
                                       pCellTemperatureBase->cellTemperature_ddegC[s][m][ts],
                                       pCellTemperatureRedundancy0->cellTemperature_ddegC[s][m][ts],
                                       &pValidatedTemperatures->cellTemperature_ddegC[s][m][ts])) {
-                        /* Reset invalid flag */
-                        pValidatedTemperatures->invalidCellTemperature[s][m][ts] = false;
                         numberValidMeasurements++;
                     } else {
                         /* Set invalid flag */
-                        noPlausibilityIssueDetected                              = STD_NOT_OK;
-                        pValidatedTemperatures->invalidCellTemperature[s][m][ts] = true;
+                        noPlausibilityIssueDetected = STD_NOT_OK;
+                        BITSET_WriteBit(&invalidValidated, ts, true);
                         /* Set return value to #STD_NOT_OK as not all cell temperatures have a valid measurement value
                          */
                         retval = STD_NOT_OK;
                     }
-                } else if (pCellTemperatureBase->invalidCellTemperature[s][m][ts] == false) {
+                } else if (isBaseValid == true) {
                     /* Only base measurement value is valid -> use this temperature without further plausibility checks
                      */
                     pValidatedTemperatures->cellTemperature_ddegC[s][m][ts] =
                         pCellTemperatureBase->cellTemperature_ddegC[s][m][ts];
-                    /* Reset invalid flag */
-                    pValidatedTemperatures->invalidCellTemperature[s][m][ts] = false;
                     numberValidMeasurements++;
-                } else if (pCellTemperatureRedundancy0->invalidCellTemperature[s][m][ts] == false) {
+                } else if (isRedundancy0Valid == true) {
                     /* Only redundant measurement value is valid -> use this temperature without further plausibility
                      * checks */
                     pValidatedTemperatures->cellTemperature_ddegC[s][m][ts] =
                         pCellTemperatureRedundancy0->cellTemperature_ddegC[s][m][ts];
-                    /* Reset invalid flag */
-                    pValidatedTemperatures->invalidCellTemperature[s][m][ts] = false;
                     numberValidMeasurements++;
                 } else {
                     /* Both, base and redundant measurement value are invalid */
@@ -1045,11 +1149,12 @@ static STD_RETURN_TYPE_e MRC_ValidateCellTemperature(
                          pCellTemperatureRedundancy0->cellTemperature_ddegC[s][m][ts]) /
                         2u;
                     /* Set invalid flag */
-                    pValidatedTemperatures->invalidCellTemperature[s][m][ts] = true;
+                    BITSET_WriteBit(&invalidValidated, ts, true);
                     /* Set return value to #STD_NOT_OK as not all cell temperatures have a valid measurement value */
                     retval = STD_NOT_OK;
                 }
             }
+            pValidatedTemperatures->invalidCellTemperature[s][m] = invalidValidated;
         }
         pValidatedTemperatures->nrValidTemperatures[s] = numberValidMeasurements;
         numberValidMeasurements                        = 0u; /* Reset counter for next string */
@@ -1084,14 +1189,10 @@ extern STD_RETURN_TYPE_e MRC_Initialize(void) {
         mrc_tableCellVoltages.invalidStringVoltage[s] = true;
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
             /* Invalidate cell voltage values */
-            for (uint8_t cb = 0; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                mrc_tableCellVoltages.invalidCellVoltage[s][m][cb] = true;
-            }
+            mrc_tableCellVoltages.invalidCellVoltage[s][m]   = BITSET_GetMask(BS_NR_OF_CELL_BLOCKS_PER_MODULE);
             mrc_tableCellVoltages.invalidModuleVoltage[s][m] = true;
             /* Invalidate cell temperature values */
-            for (uint8_t ts = 0; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
-                mrc_tableCellTemperatures.invalidCellTemperature[s][m][ts] = true;
-            }
+            mrc_tableCellTemperatures.invalidCellTemperature[s][m] = BITSET_GetMask(BS_NR_OF_TEMP_SENSORS_PER_MODULE);
         }
         /* Invalidate string values */
         mrc_tablePackValues.invalidStringVoltage[s] = 0x01;
@@ -1136,6 +1237,10 @@ extern STD_RETURN_TYPE_e MRC_ValidateAfeMeasurement(void) {
     bool updateCellTemperatures =
         MRC_ValidateCellTemperatureMeasurement(&mrc_tableCellTemperatureBase, &mrc_tableCellTemperatureRedundancy0);
 
+    if (updateCellVoltages == true) {
+        SYSM_RecordLatency(SYSM_LATENCY_STAGE_REDUNDANCY, mrc_tableCellVoltages.header.acquisitionTimestamp);
+    }
+
     /* Update database entries if necessary */
     if ((updateCellVoltages == true) && (updateCellTemperatures == true)) {
         DATA_WRITE_DATA(&mrc_tableCellVoltages, &mrc_tableCellTemperatures, &mrc_tableMinimumMaximumValues);
@@ -1169,8 +1274,39 @@ extern STD_RETURN_TYPE_e MRC_ValidatePackMeasurement(void) {
     return packMeasurementValidity;
 }
 
+extern void MRC_Trigger(void) {
+    const uint32_t timestamp = OS_GetTickCount();
+
+    if (MRC_IsValidationDue(
+            &mrc_state.afeValidation,
+            MRC_GetNumberOfInputUpdates(mrc_afeValidationInputs, MRC_NUMBER_OF_AFE_VALIDATION_INPUTS),
+            timestamp) == true) {
+        (void)MRC_ValidateAfeMeasurement();
+    }
+    /* The pack inputs are checked after the AFE validation, so that newly
+       validated cell voltages are taken into account in the same call */
+    if (MRC_IsValidationDue(
+            &mrc_state.packValidation,
+            MRC_GetNumberOfInputUpdates(mrc_packValidationInputs, MRC_NUMBER_OF_PACK_VALIDATION_INPUTS),
+            timestamp) == true) {
+        (void)MRC_ValidatePackMeasurement();
+    }
+}
+
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
+extern uint32_t TEST_MRC_GetNumberOfInputUpdates(const DATA_BLOCK_ID_e *pkInputs, uint8_t numberOfInputs) {
+    return MRC_GetNumberOfInputUpdates(pkInputs, numberOfInputs);
+}
+extern bool TEST_MRC_IsValidationDue(
+    MRC_VALIDATION_TRIGGER_s *pTrigger,
+    uint32_t numberOfInputUpdates,
+    uint32_t timestamp) {
+    return MRC_IsValidationDue(pTrigger, numberOfInputUpdates, timestamp);
+}
+extern MRC_STATE_s *TEST_MRC_GetState(void) {
+    return &mrc_state;
+}
 extern bool TEST_MRC_MeasurementUpdatedAtLeastOnce(uint32_t timestamp, uint32_t previousTimestamp) {
     return MRC_MeasurementUpdatedAtLeastOnce(timestamp, previousTimestamp);
 }
@@ -43,7 +43,7 @@
  * @file    redundancy.h
  * @author  foxBMS Team
  * @date    2020-07-31 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup APPLICATION
  * @prefix  MRC
@@ -112,7 +112,25 @@
  */
 #define MRC_ALLOWED_NUMBER_OF_INVALID_CELL_VOLTAGES (5u)
 
+/**
+ * Maximum time between two validations of a measurement path if no new
+ * input data arrived.
+ *
+ * The validation of the AFE and pack measurements is triggered by updates of
+ * their input database entries. If the inputs are not updated anymore, the
+ * validation is still executed after this time, so that the redundancy module
+ * detects stale measurements (see #MRC_AFE_MEASUREMENT_PERIOD_TIMEOUT_ms and
+ * #MRC_CURRENT_MEASUREMENT_PERIOD_TIMEOUT_ms).
+ */
+#define MRC_VALIDATION_FALLBACK_PERIOD_ms (100u)
+
 /*========== Extern Constant and Variable Declarations ======================*/
+/** state of the event-triggered validation of one measurement path */
+typedef struct {
+    uint32_t numberOfInputUpdates;    /*!< number of writes to the input entries at the last validation */
+    uint32_t lastValidationTimestamp; /*!< timestamp of the last validation */
+} MRC_VALIDATION_TRIGGER_s;
+
 /**
  * This structure contains all the variables relevant for the redundancy state machine.
  */
@@ -123,6 +141,8 @@ typedef struct {
     uint32_t lastRedundancy0CellTemperatureTimestamp;
     uint32_t lastStringCurrentTimestamp[BS_NR_OF_STRINGS];
     uint32_t lastStringPowerTimestamp[BS_NR_OF_STRINGS];
+    MRC_VALIDATION_TRIGGER_s afeValidation;
+    MRC_VALIDATION_TRIGGER_s packValidation;
 } MRC_STATE_s;
 
 /*========== Extern Function Prototypes =====================================*/
@@ -151,8 +171,27 @@ extern STD_RETURN_TYPE_e MRC_ValidateAfeMeasurement(void);
  */
 extern STD_RETURN_TYPE_e MRC_ValidatePackMeasurement(void);
 
+/**
+ * @brief   Trigger function of the redundancy module
+ * @details Validates the AFE measurement if the base or redundant cell voltage
+ *          or cell temperature entries have been written since the last
+ *          validation, and the pack measurement if the current sensor entries
+ *          or the validated cell voltages have been written. If no new input
+ *          arrived, the validation is executed after
+ *          #MRC_VALIDATION_FALLBACK_PERIOD_ms so that stale measurements are
+ *          detected. This function is intended to be called cyclically by the
+ *          10ms task.
+ */
+extern void MRC_Trigger(void);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
+extern uint32_t TEST_MRC_GetNumberOfInputUpdates(const DATA_BLOCK_ID_e *pkInputs, uint8_t numberOfInputs);
+extern bool TEST_MRC_IsValidationDue(
+    MRC_VALIDATION_TRIGGER_s *pTrigger,
+    uint32_t numberOfInputUpdates,
+    uint32_t timestamp);
+extern MRC_STATE_s *TEST_MRC_GetState(void);
 extern bool TEST_MRC_MeasurementUpdatedAtLeastOnce(uint32_t timestamp, uint32_t previousTimestamp);
 extern STD_RETURN_TYPE_e TEST_MRC_MeasurementUpdatedRecently(
     uint32_t timestamp,
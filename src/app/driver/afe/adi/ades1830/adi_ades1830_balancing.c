@@ -43,7 +43,7 @@
  * @file    adi_ades1830_balancing.c
  * @author  foxBMS Team
  * @date    2019-08-27 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  ADI
@@ -109,11 +109,12 @@ extern void ADI_DetermineBalancingRegisterConfiguration(ADI_STATE_s *pAdiState)
         const uint16_t reverseModuleNumber = BS_NR_OF_MODULES_PER_STRING - m - 1u;
         uint8_t dccRegisterLow             = 0u;
         uint8_t dccRegisterHigh            = 0u;
+
+        const uint32_t balancingPlan = pAdiState->data.balancingControl->balancingPlan[pAdiState->currentString][m];
         for (uint8_t c = 0u; c < ADI_MAX_SUPPORTED_CELLS; c++) {
             if (adi_voltageInputsUsed[c] == 1u) {
                 storedVoltageIndex = ADI_GetStoredVoltageIndex(c);
-                if (pAdiState->data.balancingControl
-                        ->activateBalancing[pAdiState->currentString][m][storedVoltageIndex] == true) {
+                if ((balancingPlan & (1u << storedVoltageIndex)) != 0u) {
                     if (c < ADI_CFGRB_NUMBER_OF_DCC_BITS_PER_BYTE) { /* 0 - 7 cells */
                         dccRegisterLow |= (uint8_t)(1u << c);
                     } else { /* 8 - 15 cells */
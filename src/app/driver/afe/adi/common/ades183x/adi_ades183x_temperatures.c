@@ -43,7 +43,7 @@
  * @file    adi_ades183x_temperatures.c
  * @author  foxBMS Team
  * @date    2019-08-27 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  ADI
@@ -60,6 +60,7 @@
 #include "adi_ades183x_cfg.h"
 
 #include "fassert.h"
+#include "fbitset.h"
 
 #include <stdint.h>
 
@@ -118,11 +119,13 @@ extern void ADI_GetTemperatures(ADI_STATE_s *pAdiState) {
                     pAdiState->data.allGpioVoltages->gpioVoltages_mV[pAdiState->currentString][gpioIndex]);
                 pAdiState->data.cellTemperature->cellTemperature_ddegC[pAdiState->currentString][m][ts] =
                     temperature_ddegC;
-                pAdiState->data.cellTemperature->invalidCellTemperature[pAdiState->currentString][m][ts] = false;
+                BITSET_WriteBit(
+                    &pAdiState->data.cellTemperature->invalidCellTemperature[pAdiState->currentString][m], ts, false);
             } else {
                 /* Invalidate cell temperature */
-                pAdiState->data.cellTemperature->cellTemperature_ddegC[pAdiState->currentString][m][ts]  = 0;
-                pAdiState->data.cellTemperature->invalidCellTemperature[pAdiState->currentString][m][ts] = true;
+                pAdiState->data.cellTemperature->cellTemperature_ddegC[pAdiState->currentString][m][ts] = 0;
+                BITSET_WriteBit(
+                    &pAdiState->data.cellTemperature->invalidCellTemperature[pAdiState->currentString][m], ts, true);
             }
         }
     }
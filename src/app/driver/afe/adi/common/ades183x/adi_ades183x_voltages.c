@@ -43,7 +43,7 @@
  * @file    adi_ades183x_voltages.c
  * @author  foxBMS Team
  * @date    2019-08-27 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  ADI
@@ -63,6 +63,7 @@
 #include "adi_ades183x_diagnostic.h"
 #include "adi_ades183x_helpers.h"
 #include "fassert.h"
+#include "fbitset.h"
 
 #include <math.h>
 #include <stdbool.h>
@@ -329,11 +330,15 @@ static void ADI_SaveRxToCellVoltageBuffer(
 
                         if (storeLocation == ADI_CELL_VOLTAGE) {
                             if (ADI_EvaluateDiagnosticCellVoltages(adiState, m) == false) {
-                                adiState->data.cellVoltage
-                                    ->invalidCellVoltage[adiState->currentString][m][storedVoltageIndex] = true;
+                                BITSET_WriteBit(
+                                    &adiState->data.cellVoltage->invalidCellVoltage[adiState->currentString][m],
+                                    (uint8_t)storedVoltageIndex,
+                                    true);
                             } else {
-                                adiState->data.cellVoltage
-                                    ->invalidCellVoltage[adiState->currentString][m][storedVoltageIndex] = false;
+                                BITSET_WriteBit(
+                                    &adiState->data.cellVoltage->invalidCellVoltage[adiState->currentString][m],
+                                    (uint8_t)storedVoltageIndex,
+                                    false);
                                 numberValidMeasurements++;
                             }
                         }
@@ -43,7 +43,7 @@
  * @file    debug_can.c
  * @author  foxBMS Team
  * @date    2024-04-08 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  DECAN
@@ -59,9 +59,11 @@
 
 #include "can_helper.h"
 #include "database.h"
+#include "fbitset.h"
 #include "ftask.h"
 #include "os.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
@@ -259,11 +261,8 @@ static STD_RETURN_TYPE_e DECAN_ReceiveCanCellVoltages(void) {
 
             /* Write the received data */
             decan_cellVoltage.cellVoltage_mV[s][m][cb] = (int16_t)decan_canCellVoltagesFromQueue.cellVoltage[i];
-            if (decan_canCellVoltagesFromQueue.invalidFlag[i] == DECAN_DATA_IS_VALID) {
-                decan_cellVoltage.invalidCellVoltage[s][m][cb] = false;
-            } else {
-                decan_cellVoltage.invalidCellVoltage[s][m][cb] = true;
-            }
+            const bool isInvalid = (decan_canCellVoltagesFromQueue.invalidFlag[i] != DECAN_DATA_IS_VALID);
+            BITSET_WriteBit(&decan_cellVoltage.invalidCellVoltage[s][m], (uint8_t)cb, isInvalid);
 
             /* Update one number index of the cell voltage */
             oneNumIdxOfVoltage++;
@@ -281,10 +280,10 @@ static STD_RETURN_TYPE_e DECAN_ReceiveCanCellVoltages(void) {
                 stringVoltage_mV             = 0;
                 for (uint16_t idxModule = 0u; idxModule < BS_NR_OF_MODULES_PER_STRING; idxModule++) {
                     moduleVoltage_mV = 0;
-                    for (uint16_t idxCellBlocks = 0u; idxCellBlocks < BS_NR_OF_CELL_BLOCKS_PER_MODULE;
-                         idxCellBlocks++) {
-                        if (decan_cellVoltageFromRead.invalidCellVoltage[idxString][idxModule][idxCellBlocks] ==
-                            false) {
+                    const BITSET_WORD_t invalidCellVoltage =
+                        decan_cellVoltageFromRead.invalidCellVoltage[idxString][idxModule];
+                    for (uint8_t idxCellBlocks = 0u; idxCellBlocks < BS_NR_OF_CELL_BLOCKS_PER_MODULE; idxCellBlocks++) {
+                        if (BITSET_IsBitSet(invalidCellVoltage, idxCellBlocks) == false) {
                             nrValidCellVoltagesPerString++;
                             moduleVoltage_mV +=
                                 (int32_t)decan_cellVoltageFromRead.cellVoltage_mV[idxString][idxModule][idxCellBlocks];
@@ -335,11 +334,8 @@ static STD_RETURN_TYPE_e DECAN_ReceiveCanCellTemperatures(void) {
             /* Write the received data */
             decan_cellTemperature.cellTemperature_ddegC[s][m][ts] =
                 decan_canCellTemperaturesFromQueue.cellTemperature[i] * 10;
-            if (decan_canCellTemperaturesFromQueue.invalidFlag[i] == DECAN_DATA_IS_VALID) {
-                decan_cellTemperature.invalidCellTemperature[s][m][ts] = false;
-            } else {
-                decan_cellTemperature.invalidCellTemperature[s][m][ts] = true;
-            }
+            const bool isInvalid = (decan_canCellTemperaturesFromQueue.invalidFlag[i] != DECAN_DATA_IS_VALID);
+            BITSET_WriteBit(&decan_cellTemperature.invalidCellTemperature[s][m], (uint8_t)ts, isInvalid);
 
             /* Update one number index */
             oneNumIdxOfTemperature++;
@@ -353,13 +349,12 @@ static STD_RETURN_TYPE_e DECAN_ReceiveCanCellTemperatures(void) {
             for (uint16_t idxString = 0u; idxString < BS_NR_OF_STRINGS; idxString++) {
                 uint16_t nrValidCellTemperaturesPerString = 0u;
                 for (uint16_t idxModule = 0u; idxModule < BS_NR_OF_MODULES_PER_STRING; idxModule++) {
-                    for (uint16_t idxTemperatureSensor = 0u; idxTemperatureSensor < BS_NR_OF_TEMP_SENSORS_PER_MODULE;
-                         idxTemperatureSensor++) {
-                        if (decan_cellTemperatureFromRead
-                                .invalidCellTemperature[idxString][idxModule][idxTemperatureSensor] == false) {
-                            nrValidCellTemperaturesPerString++;
-                        }
-                    }
+                    /* count the cleared bits of the used temperature sensors of this module at once */
+                    const BITSET_WORD_t invalidCellTemperature =
+                        decan_cellTemperatureFromRead.invalidCellTemperature[idxString][idxModule] &
+                        BITSET_GetMask(BS_NR_OF_TEMP_SENSORS_PER_MODULE);
+                    nrValidCellTemperaturesPerString += (uint16_t)(BS_NR_OF_TEMP_SENSORS_PER_MODULE -
+                                                                   BITSET_CountSetBitsOfWord(invalidCellTemperature));
                 }
                 decan_cellTemperatureFromRead.nrValidTemperatures[idxString] = nrValidCellTemperaturesPerString;
             }
@@ -376,17 +371,17 @@ extern STD_RETURN_TYPE_e DECAN_Initialize(void) {
     for (uint16_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         for (uint16_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
             for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                decan_cellVoltage.cellVoltage_mV[s][m][cb]     = 0;
-                decan_cellVoltage.invalidCellVoltage[s][m][cb] = true;
+                decan_cellVoltage.cellVoltage_mV[s][m][cb] = 0;
             }
+            decan_cellVoltage.invalidCellVoltage[s][m] = BITSET_GetMask(BS_NR_OF_CELL_BLOCKS_PER_MODULE);
         }
     }
     for (uint16_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         for (uint16_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
             for (uint16_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
-                decan_cellTemperature.cellTemperature_ddegC[s][m][ts]  = 0;
-                decan_cellTemperature.invalidCellTemperature[s][m][ts] = true;
+                decan_cellTemperature.cellTemperature_ddegC[s][m][ts] = 0;
             }
+            decan_cellTemperature.invalidCellTemperature[s][m] = BITSET_GetMask(BS_NR_OF_TEMP_SENSORS_PER_MODULE);
         }
     }
     /* Give other tasks time to execute */
@@ -43,7 +43,7 @@
  * @file    debug_default.c
  * @author  foxBMS Team
  * @date    2020-09-17 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  FAKE
@@ -297,9 +297,7 @@ static void FAKE_SetFirstMeasurementCycleFinished(FAKE_STATE_s *pFakeState) {
 
         pFakeState->data.balancingFeedback->state = 0;
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
-            for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                pFakeState->data.balancingControl->activateBalancing[s][m][cb] = false;
-            }
+            pFakeState->data.balancingControl->balancingPlan[s][m] = 0u;
         }
         pFakeState->data.balancingControl->nrBalancedCells[s] = 0u;
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
@@ -324,8 +322,8 @@ static void FAKE_SetFirstMeasurementCycleFinished(FAKE_STATE_s *pFakeState) {
             pFakeState->data.allGpioVoltages->gpioVoltages_mV[s][gpio] = 0;
         }
 
-        for (uint16_t ow = 0u; ow < (BS_NR_OF_MODULES_PER_STRING * (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1u)); ow++) {
-            pFakeState->data.openWire->openWire[s][ow] = 0u;
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            pFakeState->data.openWire->openWire[s][m] = 0u;
         }
         pFakeState->data.openWire->state = 0;
     }
@@ -43,7 +43,7 @@
  * @file    ltc_6806.c
  * @author  foxBMS Team
  * @date    2019-09-01 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  LTC
@@ -64,6 +64,7 @@
 #include "afe_plausibility.h"
 #include "database.h"
 #include "diag.h"
+#include "fbitset.h"
 #include "io.h"
 #include "ltc_pec.h"
 #include "os.h"
@@ -331,8 +332,8 @@ static void LTC_InitializeDatabase(LTC_STATE_s *ltc_state) {
             ltc_state->ltcData.allGpioVoltages->gpioVoltages_mV[s][gpio] = 0;
         }
 
-        for (uint16_t ow = 0u; ow < (BS_NR_OF_MODULES_PER_STRING * (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1)); ow++) {
-            ltc_state->ltcData.openWire->openWire[s][ow] = 0u;
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            ltc_state->ltcData.openWire->openWire[s][m] = 0u;
         }
         ltc_state->ltcData.openWire->state = 0u;
     }
@@ -427,11 +428,9 @@ extern void LTC_SaveVoltages(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
              * Is cell voltage valid because of previous PEC error
              * If so, everything okay, else set cell voltage measurement to invalid.
              */
-            if ((ltc_state->ltcData.openWire
-                     ->openWire[stringNumber][(m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1u)) + cb] == 0u) &&
-                (ltc_state->ltcData.openWire
-                     ->openWire[stringNumber][(m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1u)) + cb + 1u] == 0u) &&
-                (ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m][cb] == false)) {
+            if ((BITSET_IsBitSet(ltc_state->ltcData.openWire->openWire[stringNumber][m], cb) == false) &&
+                (BITSET_IsBitSet(ltc_state->ltcData.openWire->openWire[stringNumber][m], cb + 1u) == false) &&
+                (BITSET_IsBitSet(ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m], cb) == false)) {
                 /* Cell voltage is valid -> perform minimum/maximum plausibility check */
 
                 /* ------- 2. Perform minimum/maximum measurement range check ---------- */
@@ -444,13 +443,13 @@ extern void LTC_SaveVoltages(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
                     numberValidMeasurements++;
                 } else {
                     /* Invalidate cell voltage measurement */
-                    ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m][cb] = true;
-                    cellVoltageMeasurementValid                                             = STD_NOT_OK;
+                    BITSET_WriteBit(&ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m], cb, true);
+                    cellVoltageMeasurementValid = STD_NOT_OK;
                 }
             } else {
                 /* Set cell voltage measurement value invalid, if not already invalid because of PEC Error */
-                ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m][cb] = true;
-                cellVoltageMeasurementValid                                             = STD_NOT_OK;
+                BITSET_WriteBit(&ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m], cb, true);
+                cellVoltageMeasurementValid = STD_NOT_OK;
             }
         }
     }
@@ -473,7 +472,8 @@ extern void LTC_SaveTemperatures(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
              * Is cell temperature valid because of previous PEC error
              * If so, everything okay, else set cell temperature measurement to invalid.
              */
-            if (ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][m][ts] == false) {
+            if (BITSET_IsBitSet(ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][m], ts) ==
+                false) {
                 /* Cell temperature is valid -> perform minimum/maximum plausibility check */
 
                 /* ------- 2. Perform minimum/maximum measurement range check ---------- */
@@ -482,8 +482,9 @@ extern void LTC_SaveTemperatures(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
                     numberValidMeasurements++;
                 } else {
                     /* Invalidate cell temperature measurement */
-                    ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][m][ts] = true;
-                    cellTemperatureMeasurementValid                                                 = STD_NOT_OK;
+                    BITSET_WriteBit(
+                        &ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][m], ts, true);
+                    cellTemperatureMeasurementValid = STD_NOT_OK;
                 }
             } else {
                 /* Already invalid because of PEC Error */
@@ -1226,11 +1227,12 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                                      ->openWirePup[ltc_state->requestedString]
                                                   [p + (m * BS_NR_OF_CELL_BLOCKS_PER_MODULE)] ==
                                  LTC_FUELCELL_NEGATIVE_FULL_SCALE_RANGE_mV)) {
-                                ltc_state->ltcData.openWire->openWire[ltc_state->requestedString]
-                                                                     [p + (m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE))] = 1;
-                                ltc_state->ltcData.openWire
-                                    ->openWire[ltc_state->requestedString]
-                                              [(p + 1u) + (m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE))] = 1;
+                                BITSET_WriteBit(
+                                    &ltc_state->ltcData.openWire->openWire[ltc_state->requestedString][m], p, true);
+                                BITSET_WriteBit(
+                                    &ltc_state->ltcData.openWire->openWire[ltc_state->requestedString][m],
+                                    p + 1u,
+                                    true);
                             }
                             if ((ltc_state->ltcData.openWireDetection
                                      ->openWirePdown[ltc_state->requestedString]
@@ -1240,11 +1242,12 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                                      ->openWirePdown[ltc_state->requestedString]
                                                     [p + (m * BS_NR_OF_CELL_BLOCKS_PER_MODULE)] ==
                                  LTC_FUELCELL_NEGATIVE_FULL_SCALE_RANGE_mV)) {
-                                ltc_state->ltcData.openWire->openWire[ltc_state->requestedString]
-                                                                     [p + (m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE))] = 1;
-                                ltc_state->ltcData.openWire
-                                    ->openWire[ltc_state->requestedString]
-                                              [(p + 1u) + (m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE))] = 1;
+                                BITSET_WriteBit(
+                                    &ltc_state->ltcData.openWire->openWire[ltc_state->requestedString][m], p, true);
+                                BITSET_WriteBit(
+                                    &ltc_state->ltcData.openWire->openWire[ltc_state->requestedString][m],
+                                    p + 1u,
+                                    true);
                             }
                         }
                     }
@@ -1258,19 +1261,14 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                             if (ltc_state->ltcData.openWireDetection
                                     ->openWireDelta[ltc_state->requestedString]
                                                    [c + (m * BS_NR_OF_CELL_BLOCKS_PER_MODULE)] < LTC_ADOW_THRESHOLD) {
-                                ltc_state->ltcData.openWire->openWire[ltc_state->requestedString]
-                                                                     [c + (m * BS_NR_OF_CELL_BLOCKS_PER_MODULE)] = 1;
+                                BITSET_WriteBit(
+                                    &ltc_state->ltcData.openWire->openWire[ltc_state->requestedString][m], c, true);
                             }
                         }
                     }
 
-                    ltc_state->ltcData.openWire->nrOpenWires[ltc_state->requestedString] = 0;
-                    for (uint16_t c = 0u; c < (BS_NR_OF_MODULES_PER_STRING * (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1));
-                         c++) {
-                        if (ltc_state->ltcData.openWire->openWire[ltc_state->requestedString][c] == 1) {
-                            ltc_state->ltcData.openWire->nrOpenWires[ltc_state->requestedString]++;
-                        }
-                    }
+                    ltc_state->ltcData.openWire->nrOpenWires[ltc_state->requestedString] = BITSET_CountSetBits(
+                        ltc_state->ltcData.openWire->openWire[ltc_state->requestedString], BS_NR_OF_MODULES_PER_STRING);
 
                     /* Write database entry */
                     DATA_WRITE_DATA(ltc_state->ltcData.openWire);
@@ -1365,14 +1363,20 @@ static void LTC_SaveRXToVoltageBuffer_Fuelcell(
                 ltc_state->ltcData.cellVoltage
                     ->cellVoltage_mV[stringNumber][m][ltc_state->ltcData.usedCellIndex[stringNumber]] = voltage_mV;
                 for (uint8_t i = 0u; i < LTC_NUMBER_OF_CELL_VOLTAGES_PER_REGISTER; i++) {
-                    ltc_state->ltcData.cellVoltage
-                        ->invalidCellVoltage[stringNumber][(m / LTC_NUMBER_OF_LTC_PER_MODULE)][cellOffset + i] = false;
+                    BITSET_WriteBit(
+                        &ltc_state->ltcData.cellVoltage
+                             ->invalidCellVoltage[stringNumber][(m / LTC_NUMBER_OF_LTC_PER_MODULE)],
+                        (uint8_t)(cellOffset + i),
+                        false);
                 }
             } else {
                 /* PEC_valid == false: Invalidate only flags of this voltage register */
                 for (uint8_t i = 0u; i < LTC_NUMBER_OF_CELL_VOLTAGES_PER_REGISTER; i++) {
-                    ltc_state->ltcData.cellVoltage
-                        ->invalidCellVoltage[stringNumber][(m / LTC_NUMBER_OF_LTC_PER_MODULE)][cellOffset + i] = true;
+                    BITSET_WriteBit(
+                        &ltc_state->ltcData.cellVoltage
+                             ->invalidCellVoltage[stringNumber][(m / LTC_NUMBER_OF_LTC_PER_MODULE)],
+                        (uint8_t)(cellOffset + i),
+                        true);
                 }
             }
 
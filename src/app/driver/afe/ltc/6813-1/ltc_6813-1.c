@@ -43,7 +43,7 @@
  * @file    ltc_6813-1.c
  * @author  foxBMS Team
  * @date    2019-09-01 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  LTC
@@ -64,10 +64,12 @@
 #include "afe_plausibility.h"
 #include "database.h"
 #include "diag.h"
+#include "fbitset.h"
 #include "io.h"
 #include "ltc_pec.h"
 #include "os.h"
 #include "pex.h"
+#include "sys_mon_latency.h"
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -158,6 +160,7 @@ LTC_STATE_s ltc_stateBase = {
     .ErrRetryCounter           = 0,
     .ErrRequestCounter         = 0,
     .VoltageSampleTime         = 0,
+    .voltageAcquisitionStart   = 0,
     .muxSampleTime             = 0,
     .commandDataTransferTime   = 3,
     .commandTransferTime       = 3,
@@ -487,9 +490,7 @@ static void LTC_InitializeDatabase(LTC_STATE_s *ltc_state) {
 
         ltc_state->ltcData.balancingFeedback->state = 0;
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
-            for (uint16_t cb = 0; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                ltc_state->ltcData.balancingControl->activateBalancing[s][m][cb] = false;
-            }
+            ltc_state->ltcData.balancingControl->balancingPlan[s][m] = 0u;
         }
         ltc_state->ltcData.balancingControl->nrBalancedCells[s] = 0u;
         for (uint16_t i = 0; i < BS_NR_OF_MODULES_PER_STRING; i++) {
@@ -514,8 +515,8 @@ static void LTC_InitializeDatabase(LTC_STATE_s *ltc_state) {
             ltc_state->ltcData.allGpioVoltages->gpioVoltages_mV[s][i] = 0;
         }
 
-        for (uint16_t i = 0; i < (BS_NR_OF_MODULES_PER_STRING * (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1)); i++) {
-            ltc_state->ltcData.openWire->openWire[s][i] = 0;
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            ltc_state->ltcData.openWire->openWire[s][m] = 0u;
         }
         ltc_state->ltcData.openWire->state = 0;
     }
@@ -616,11 +617,9 @@ extern void LTC_SaveVoltages(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
              * Is cell voltage valid because of previous PEC error
              * If so, everything okay, else set cell voltage measurement to invalid.
              */
-            if ((ltc_state->ltcData.openWire
-                     ->openWire[stringNumber][(m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1u)) + cb] == 0u) &&
-                (ltc_state->ltcData.openWire
-                     ->openWire[stringNumber][(m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1u)) + cb + 1u] == 0u) &&
-                ((ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m][cb] == false))) {
+            if ((BITSET_IsBitSet(ltc_state->ltcData.openWire->openWire[stringNumber][m], cb) == false) &&
+                (BITSET_IsBitSet(ltc_state->ltcData.openWire->openWire[stringNumber][m], cb + 1u) == false) &&
+                (BITSET_IsBitSet(ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m], cb) == false)) {
                 /* Cell voltage is valid -> perform minimum/maximum plausibility check */
 
                 /* ------- 2. Perform minimum/maximum measurement range check ---------- */
@@ -633,13 +632,13 @@ extern void LTC_SaveVoltages(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
                     numberValidMeasurements++;
                 } else {
                     /* Invalidate cell voltage measurement */
-                    ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m][cb] = true;
-                    cellVoltageMeasurementValid                                             = STD_NOT_OK;
+                    BITSET_WriteBit(&ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m], cb, true);
+                    cellVoltageMeasurementValid = STD_NOT_OK;
                 }
             } else {
                 /* Set cell voltage measurement value invalid, if not already invalid because of PEC Error */
-                ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m][cb] = true;
-                cellVoltageMeasurementValid                                             = STD_NOT_OK;
+                BITSET_WriteBit(&ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m], cb, true);
+                cellVoltageMeasurementValid = STD_NOT_OK;
             }
         }
     }
@@ -650,6 +649,9 @@ extern void LTC_SaveVoltages(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
     /* Increment state variable each time new values are written into database */
     ltc_state->ltcData.cellVoltage->state++;
 
+    ltc_state->ltcData.cellVoltage->header.acquisitionTimestamp = ltc_state->voltageAcquisitionStart;
+    SYSM_RecordLatency(SYSM_LATENCY_STAGE_AFE, ltc_state->voltageAcquisitionStart);
+
     DATA_WRITE_DATA(ltc_state->ltcData.cellVoltage);
 }
 
@@ -665,7 +667,8 @@ extern void LTC_SaveTemperatures(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
              * Is cell temperature valid because of previous PEC error
              * If so, everything okay, else set cell temperature measurement to invalid.
              */
-            if (ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][m][ts] == false) {
+            if (BITSET_IsBitSet(ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][m], ts) ==
+                false) {
                 /* Cell temperature is valid -> perform minimum/maximum plausibility check */
 
                 /* ------- 2. Perform minimum/maximum measurement range check ---------- */
@@ -674,8 +677,9 @@ extern void LTC_SaveTemperatures(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
                     numberValidMeasurements++;
                 } else {
                     /* Invalidate cell temperature measurement */
-                    ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][m][ts] = true;
-                    cellTemperatureMeasurementValid                                                 = STD_NOT_OK;
+                    BITSET_WriteBit(
+                        &ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][m], ts, true);
+                    cellTemperatureMeasurementValid = STD_NOT_OK;
                 }
             } else {
                 /* Already invalid because of PEC Error */
@@ -1000,7 +1004,10 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                 ltc_state->spiSeqEndPtr        = ltc_state->ltcData.pSpiInterface + BS_NR_OF_STRINGS;
                 ltc_state->currentString       = 0u;
 
-                ltc_state->check_spi_flag = STD_NOT_OK;
+                /* the cell voltage table covers all strings, therefore the
+                   start of the conversion of the first string is recorded */
+                ltc_state->voltageAcquisitionStart = SYSM_GetAcquisitionTimestamp();
+                ltc_state->check_spi_flag          = STD_NOT_OK;
                 retVal = LTC_StartVoltageMeasurement(ltc_state->spiSeqPtr, ltc_state->adcMode, ltc_state->adcMeasCh);
 
                 LTC_CondBasedStateTransition(
@@ -2913,16 +2920,16 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                         if (ltc_state->ltcData.openWireDetection
                                 ->openWirePup[ltc_state->requestedString][0 + (m * BS_NR_OF_CELL_BLOCKS_PER_MODULE)] ==
                             0u) {
-                            ltc_state->ltcData.openWire->openWire[ltc_state->requestedString]
-                                                                 [0 + (m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE))] = 1u;
+                            BITSET_WriteBit(
+                                &ltc_state->ltcData.openWire->openWire[ltc_state->requestedString][m], 0u, true);
                         }
                         /* Open-wire at Cmax: cell_pdown(BS_NR_OF_CELL_BLOCKS_PER_MODULE-1) == 0 */
                         if (ltc_state->ltcData.openWireDetection->openWirePdown[ltc_state->requestedString][(
                                 (BS_NR_OF_CELL_BLOCKS_PER_MODULE - 1) + (m * BS_NR_OF_CELL_BLOCKS_PER_MODULE))] == 0u) {
-                            ltc_state->ltcData.openWire
-                                ->openWire[ltc_state->requestedString]
-                                          [BS_NR_OF_CELL_BLOCKS_PER_MODULE + (m * BS_NR_OF_CELL_BLOCKS_PER_MODULE)] =
-                                1u;
+                            BITSET_WriteBit(
+                                &ltc_state->ltcData.openWire->openWire[ltc_state->requestedString][m],
+                                BS_NR_OF_CELL_BLOCKS_PER_MODULE,
+                                true);
                         }
                     }
 
@@ -2939,8 +2946,8 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                             if (ltc_state->ltcData.openWireDetection
                                     ->openWireDelta[ltc_state->requestedString]
                                                    [c + (m * BS_NR_OF_CELL_BLOCKS_PER_MODULE)] < LTC_ADOW_THRESHOLD) {
-                                ltc_state->ltcData.openWire->openWire[ltc_state->requestedString]
-                                                                     [c + (m * BS_NR_OF_CELL_BLOCKS_PER_MODULE)] = 1;
+                                BITSET_WriteBit(
+                                    &ltc_state->ltcData.openWire->openWire[ltc_state->requestedString][m], c, true);
                             }
                         }
                     }
@@ -3033,13 +3040,17 @@ static void LTC_SaveMuxMeasurement(
                 /* Check LTC PEC error */
                 if (ltc_state->ltcData.errorTable->PEC_valid[stringNumber][i] == true) {
                     /* Reset invalid flag */
-                    ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][i][sensor_idx] = false;
+                    BITSET_WriteBit(
+                        &ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][i],
+                        sensor_idx,
+                        false);
 
                     ltc_state->ltcData.cellTemperature->cellTemperature_ddegC[stringNumber][i][sensor_idx] =
                         temperature_ddegC;
                 } else {
                     /* Set invalid flag */
-                    ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][i][sensor_idx] = true;
+                    BITSET_WriteBit(
+                        &ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][i], sensor_idx, true);
                 }
             }
         }
@@ -3117,16 +3128,20 @@ static void LTC_SaveRxToVoltageBuffer(
 
                         /* Set the register relevant invalidCellVoltage to valid (false) */
                         for (uint8_t i = 0u; i < LTC_NUMBER_OF_CELL_VOLTAGES_PER_REGISTER; i++) {
-                            ltc_state->ltcData.cellVoltage
-                                ->invalidCellVoltage[stringNumber][(m / LTC_NUMBER_OF_LTC_PER_MODULE)][cellOffset + i] =
-                                false;
+                            BITSET_WriteBit(
+                                &ltc_state->ltcData.cellVoltage
+                                     ->invalidCellVoltage[stringNumber][(m / LTC_NUMBER_OF_LTC_PER_MODULE)],
+                                (uint8_t)(cellOffset + i),
+                                false);
                         }
                     } else {
                         /* PEC_valid == false: Invalidate only flags of this voltage register */
                         for (uint8_t i = 0u; i < LTC_NUMBER_OF_CELL_VOLTAGES_PER_REGISTER; i++) {
-                            ltc_state->ltcData.cellVoltage
-                                ->invalidCellVoltage[stringNumber][(m / LTC_NUMBER_OF_LTC_PER_MODULE)][cellOffset + i] =
-                                true;
+                            BITSET_WriteBit(
+                                &ltc_state->ltcData.cellVoltage
+                                     ->invalidCellVoltage[stringNumber][(m / LTC_NUMBER_OF_LTC_PER_MODULE)],
+                                (uint8_t)(cellOffset + i),
+                                true);
                         }
                     }
 
@@ -3490,7 +3505,7 @@ static STD_RETURN_TYPE_e LTC_BalanceControl(
 
             /* Iterate over all cell block to check if any of first 12 balancing inputs shall be activated */
             for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                if (ltc_state->ltcData.balancingControl->activateBalancing[stringNumber][m][cb] == true) {
+                if ((ltc_state->ltcData.balancingControl->balancingPlan[stringNumber][m] & (1u << cb)) != 0u) {
                     /* Activate balancing for the cell block */
                     const uint8_t voltageInputIndex = LTC_GetVoltageInputIndexFromCellBlockIndex(cb);
                     /* Check if index is within the possible balancing inputs for WRCFG register */
@@ -3542,7 +3557,7 @@ static STD_RETURN_TYPE_e LTC_BalanceControl(
 
             /* Iterate over all cell block to check if any of first 12 balancing inputs shall be activated */
             for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                if (ltc_state->ltcData.balancingControl->activateBalancing[stringNumber][m][cb] == true) {
+                if ((ltc_state->ltcData.balancingControl->balancingPlan[stringNumber][m] & (1u << cb)) != 0u) {
                     /* Activate balancing for the cell block */
                     const uint8_t voltageInputIndex = LTC_GetVoltageInputIndexFromCellBlockIndex(cb);
                     /* Check if index is within the possible balancing inputs for WRCFG register */
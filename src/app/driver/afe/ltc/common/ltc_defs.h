@@ -531,8 +531,9 @@ typedef struct {
     uint32_t commandTransferTime;     /*!< time needed for sending an instruction to the LTC */
     uint32_t
         gpioClocksTransferTime; /*!< time needed for sending 72 clock signal to the LTC, used for I2C communication */
-    uint32_t VoltageSampleTime; /*!< time stamp at which the cell voltage were measured */
-    uint32_t muxSampleTime;     /*!< time stamp at which a multiplexer input was measured */
+    uint32_t VoltageSampleTime;       /*!< time stamp at which the cell voltage were measured */
+    uint32_t voltageAcquisitionStart; /*!< free running counter value at the start of the cell voltage conversion */
+    uint32_t muxSampleTime;           /*!< time stamp at which a multiplexer input was measured */
     LTC_REUSE_MODE_e
         reusageMeasurementMode;  /*!< flag that indicates if currently any state is reused i.e. cell voltage
                                                 measurement */
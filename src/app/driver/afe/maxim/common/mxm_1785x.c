@@ -43,7 +43,7 @@
  * @file    mxm_1785x.c
  * @author  foxBMS Team
  * @date    2019-01-15 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  MXM
@@ -61,6 +61,7 @@
 #include "afe_plausibility.h"
 #include "database.h"
 #include "diag.h"
+#include "fbitset.h"
 #include "fassert.h"
 #include "fstd_types.h"
 #include "mxm_1785x_tools.h"
@@ -1004,28 +1005,13 @@ extern STD_RETURN_TYPE_e MXM_ProcessOpenWire(const MXM_MONITORING_INSTANCE_s *co
         uint8_t stringNumber                             = 0u;
         uint16_t moduleNumber                            = 0u;
         MXM_ConvertModuleToString(calculatedModuleNumberInDaisyChain, &stringNumber, &moduleNumber);
-        const uint16_t calculatedModulePosition = moduleNumber * MXM_MAXIMUM_NR_OF_CELLS_PER_MODULE;
-
-        /* step over every cell in the module and update the openWire struct accordingly */
-        for (uint8_t c = 0u; c < MXM_MAXIMUM_NR_OF_CELLS_PER_MODULE; c++) {
-            if (c < MXM_CELLS_IN_LSB) {
-                /* cell numbers under 8 can be found in the LSB */
-                const uint8_t mask = 1u << c;
-                if ((uint8_t)(mask & kpkInstance->rxBuffer[i]) > 0u) {
-                    kpkInstance->pOpenWire_table->openWire[stringNumber][calculatedModulePosition + c] = 1;
-                } else {
-                    kpkInstance->pOpenWire_table->openWire[stringNumber][calculatedModulePosition + c] = 0;
-                }
-            } else {
-                /* cell numbers over or equal 8 can be found in the MSB */
-                const uint8_t mask = 1u << (c - MXM_CELLS_IN_LSB);
-                if ((uint8_t)(mask & kpkInstance->rxBuffer[i + 1u]) > 0u) {
-                    kpkInstance->pOpenWire_table->openWire[stringNumber][calculatedModulePosition + c] = 1;
-                } else {
-                    kpkInstance->pOpenWire_table->openWire[stringNumber][calculatedModulePosition + c] = 0;
-                }
-            }
-        }
+
+        /* the LSB holds the open-wire bits of the cells 0 to 7 and the MSB the bits of the cells 8 and above, i.e.,
+         * both bytes are already laid out like the open-wire bitset of the module */
+        const BITSET_WORD_t openWire = (BITSET_WORD_t)kpkInstance->rxBuffer[i] |
+                                       ((BITSET_WORD_t)kpkInstance->rxBuffer[i + 1u] << MXM_CELLS_IN_LSB);
+        kpkInstance->pOpenWire_table->openWire[stringNumber][moduleNumber] =
+            openWire & BITSET_GetMask(MXM_MAXIMUM_NR_OF_CELLS_PER_MODULE);
     }
 
     /* write database block */
@@ -1057,8 +1043,9 @@ extern STD_RETURN_TYPE_e MXM_ConstructBalancingBuffer(MXM_BALANCING_STATE_s *pBa
             uint8_t stringNumber  = 0u;
             uint16_t moduleNumber = 0u;
             MXM_ConvertModuleToString(pBalancingInstance->moduleBalancingIndex, &stringNumber, &moduleNumber);
-            if (pBalancingInstance->pBalancingControl_table->activateBalancing[stringNumber][moduleNumber][cb] ==
-                true) {
+            const uint32_t balancingPlan =
+                pBalancingInstance->pBalancingControl_table->balancingPlan[stringNumber][moduleNumber];
+            if ((balancingPlan & (1u << cb)) != 0u) {
                 /* Cell 'c' of module '::moduleBalancingIndex' needs to be balanced.
                        Need to determine the balancing order --> even or odd cells?
                        If the balancing order has not been determined before, need to do it. */
@@ -1132,7 +1119,8 @@ extern STD_RETURN_TYPE_e MXM_ParseVoltagesIntoDB(const MXM_MONITORING_INSTANCE_s
                 numberValidVoltageMeasurements[stringNumber]++;
             } else {
                 /* Invalidate cell voltage measurement */
-                kpkInstance->pCellVoltages_table->invalidCellVoltage[stringNumber][moduleNumber][cb] = true;
+                BITSET_WriteBit(
+                    &kpkInstance->pCellVoltages_table->invalidCellVoltage[stringNumber][moduleNumber], cb, true);
             }
         }
     }
@@ -1161,8 +1149,10 @@ extern STD_RETURN_TYPE_e MXM_ParseVoltagesIntoDB(const MXM_MONITORING_INSTANCE_s
                 numberValidTemperatureMeasurements[stringNumber]++;
             } else {
                 /* Invalidate temperature measurement */
-                kpkInstance->pCellTemperatures_table
-                    ->invalidCellTemperature[stringNumber][moduleNumber][kpkInstance->muxCounter] = true;
+                BITSET_WriteBit(
+                    &kpkInstance->pCellTemperatures_table->invalidCellTemperature[stringNumber][moduleNumber],
+                    kpkInstance->muxCounter,
+                    true);
             }
         }
     }
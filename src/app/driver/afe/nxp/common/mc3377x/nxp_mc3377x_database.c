@@ -43,7 +43,7 @@
  * @file    nxp_mc3377x_database.c
  * @author  foxBMS Team
  * @date    2025-03-21 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  N77X
@@ -56,6 +56,7 @@
 #include "nxp_mc3377x_database.h"
 
 #include "database.h"
+#include "fbitset.h"
 
 /*========== Macros and Definitions =========================================*/
 
@@ -82,9 +83,9 @@ extern void N77x_InitializeDatabase(N77X_STATE_s *pState) {
         pState->n77xData.minMax->nrCellMaximumCellVoltage[s]   = 0u;
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
             for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                pState->n77xData.cellVoltage->cellVoltage_mV[s][m][cb]     = 0;
-                pState->n77xData.cellVoltage->invalidCellVoltage[s][m][cb] = true;
+                pState->n77xData.cellVoltage->cellVoltage_mV[s][m][cb] = 0;
             }
+            pState->n77xData.cellVoltage->invalidCellVoltage[s][m] = BITSET_GetMask(BS_NR_OF_CELL_BLOCKS_PER_MODULE);
         }
 
         pState->n77xData.cellTemperature->state                = 0u;
@@ -97,15 +98,14 @@ extern void N77x_InitializeDatabase(N77X_STATE_s *pState) {
 
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
             for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
-                pState->n77xData.cellTemperature->cellTemperature_ddegC[s][m][ts]  = 0;
-                pState->n77xData.cellTemperature->invalidCellTemperature[s][m][ts] = true;
+                pState->n77xData.cellTemperature->cellTemperature_ddegC[s][m][ts] = 0;
             }
+            pState->n77xData.cellTemperature->invalidCellTemperature[s][m] =
+                BITSET_GetMask(BS_NR_OF_TEMP_SENSORS_PER_MODULE);
         }
 
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
-            for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                pState->n77xData.balancingControl->activateBalancing[s][m][cb] = false;
-            }
+            pState->n77xData.balancingControl->balancingPlan[s][m] = 0u;
         }
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
             pState->n77xData.errorTable->communicationOk[s][m]        = false;
@@ -43,7 +43,7 @@
  * @file    nxp_mc33775a_balancing.c
  * @author  foxBMS Team
  * @date    2025-02-03 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  N77X
@@ -80,15 +80,13 @@ extern void N77x_BalanceControl(N77X_STATE_s *pState) {
     DATA_READ_DATA(pState->n77xData.balancingControl);
 
     for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
-        uint8_t deviceAddress   = m + 1u;
-        uint16_t balancingState = 0u;
-        for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-            if (pState->n77xData.balancingControl->activateBalancing[pState->currentString][m][cb] == true) {
-                balancingState |= 1u << cb;
-            }
-        }
+        uint8_t deviceAddress = m + 1u;
+
+        /* the bits of the balancing plan map directly to the balancing channels */
+        const uint32_t balancingPlan = pState->n77xData.balancingControl->balancingPlan[pState->currentString][m];
         /* All channels active --> 14 bits set to 1 --> 0x3FFF */
-        FAS_ASSERT(balancingState <= 0x3FFFu);
+        FAS_ASSERT(balancingPlan <= 0x3FFFu);
+        const uint16_t balancingState = (uint16_t)balancingPlan;
         /* Enable channels, one written to a channels means balancing active */
         N77x_CommunicationWrite(deviceAddress, MC3377X_BAL_CH_CFG_OFFSET, balancingState, pState->pSpiTxSequence);
     }
@@ -43,7 +43,7 @@
  * @file    nxp_mc33775a_measurement.c
  * @author  foxBMS Team
  * @date    2025-04-01 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  N77X
@@ -62,6 +62,7 @@
 /* clang-format on */
 #include "afe.h"
 #include "database.h"
+#include "fbitset.h"
 #include "foxmath.h"
 #include "nxp_mc3377x.h"
 #include "nxp_mc3377x_helpers.h"
@@ -142,12 +143,12 @@ static void N775_RetrieveVoltages(N77X_STATE_s *pState, uint8_t m, uint16_t *pri
             /* String voltage measurement is calculated as sum of individual cell voltage measurement */
             pState->n77xData.cellVoltage->stringVoltage_mV[pState->currentString] +=
                 pState->n77xData.cellVoltage->cellVoltage_mV[pState->currentString][m][cb];
-            pState->n77xData.cellVoltage->invalidCellVoltage[pState->currentString][m][cb] = false;
+            BITSET_WriteBit(&pState->n77xData.cellVoltage->invalidCellVoltage[pState->currentString][m], cb, false);
             pState->n77xData.cellVoltage->nrValidCellVoltages[pState->currentString]++;
         } else {
             pState->n77xData.cellVoltage->cellVoltage_mV[pState->currentString][m][cb] =
                 AFE_DEFAULT_CELL_VOLTAGE_INVALID_VALUE;
-            pState->n77xData.cellVoltage->invalidCellVoltage[pState->currentString][m][cb] = true;
+            BITSET_WriteBit(&pState->n77xData.cellVoltage->invalidCellVoltage[pState->currentString][m], cb, true);
         }
     }
     for (uint8_t g = 0u; g < 4u; g++) {
@@ -207,10 +208,16 @@ static void N775_RetrieveTemperatures(N77X_STATE_s *pState, uint8_t m, bool *gpi
             if ((gpioVoltage_mV < N77X_INVALID_mV_VALUE) && (*gpio03Error == false)) {
                 pState->n77xData.cellTemperature->cellTemperature_ddegC[pState->currentString][m][sensorIdx] =
                     N77x_ConvertVoltagesToTemperatures(gpioVoltage_mV);
-                pState->n77xData.cellTemperature->invalidCellTemperature[pState->currentString][m][sensorIdx] = false;
+                BITSET_WriteBit(
+                    &pState->n77xData.cellTemperature->invalidCellTemperature[pState->currentString][m],
+                    sensorIdx,
+                    false);
             } else {
-                pState->n77xData.cellTemperature->cellTemperature_ddegC[pState->currentString][m][sensorIdx]  = 0;
-                pState->n77xData.cellTemperature->invalidCellTemperature[pState->currentString][m][sensorIdx] = true;
+                pState->n77xData.cellTemperature->cellTemperature_ddegC[pState->currentString][m][sensorIdx] = 0;
+                BITSET_WriteBit(
+                    &pState->n77xData.cellTemperature->invalidCellTemperature[pState->currentString][m],
+                    sensorIdx,
+                    true);
             }
         } else {
             /* Current mux is disabled or at a temp pin unused in the active configuration */
@@ -223,13 +230,14 @@ static void N775_RetrieveTemperatures(N77X_STATE_s *pState, uint8_t m, bool *gpi
                     N77x_ConvertVoltagesToTemperatures(
                         pState->n77xData.allGpioVoltage
                             ->gpioVoltages_mV[pState->currentString][ts + (m * SLV_NR_OF_GPIOS_PER_MODULE)]);
-                pState->n77xData.cellTemperature->invalidCellTemperature[pState->currentString][m][ts] = false;
             }
+            pState->n77xData.cellTemperature->invalidCellTemperature[pState->currentString][m] = 0u;
         } else {
             for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
-                pState->n77xData.cellTemperature->cellTemperature_ddegC[pState->currentString][m][ts]  = 0;
-                pState->n77xData.cellTemperature->invalidCellTemperature[pState->currentString][m][ts] = true;
+                pState->n77xData.cellTemperature->cellTemperature_ddegC[pState->currentString][m][ts] = 0;
             }
+            pState->n77xData.cellTemperature->invalidCellTemperature[pState->currentString][m] =
+                BITSET_GetMask(BS_NR_OF_TEMP_SENSORS_PER_MODULE);
         }
     } else {
         /* Invalid value for switch case */
@@ -276,9 +284,10 @@ static void N775_RetrieveMeasurement(N77X_STATE_s *pState) {
         } else {
             /* Reset voltage values and the relevant invalid flag if the communication is not ok */
             for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                pState->n77xData.cellVoltage->cellVoltage_mV[pState->currentString][m][cb]     = 0;
-                pState->n77xData.cellVoltage->invalidCellVoltage[pState->currentString][m][cb] = true;
+                pState->n77xData.cellVoltage->cellVoltage_mV[pState->currentString][m][cb] = 0;
             }
+            pState->n77xData.cellVoltage->invalidCellVoltage[pState->currentString][m] =
+                BITSET_GetMask(BS_NR_OF_CELL_BLOCKS_PER_MODULE);
         }
 
         N77x_ErrorHandling(pState, retValSecondary, m);
@@ -301,9 +310,10 @@ static void N775_RetrieveMeasurement(N77X_STATE_s *pState) {
         } else {
             /* Reset temperature values the relevant invalid flag if the communication is not ok */
             for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
-                pState->n77xData.cellTemperature->cellTemperature_ddegC[pState->currentString][m][ts]  = 0;
-                pState->n77xData.cellTemperature->invalidCellTemperature[pState->currentString][m][ts] = true;
+                pState->n77xData.cellTemperature->cellTemperature_ddegC[pState->currentString][m][ts] = 0;
             }
+            pState->n77xData.cellTemperature->invalidCellTemperature[pState->currentString][m] =
+                BITSET_GetMask(BS_NR_OF_TEMP_SENSORS_PER_MODULE);
         }
 
         if (N77X_CHECK_SUPPLY_CURRENT == true) {
@@ -43,7 +43,7 @@
  * @file    can.c
  * @author  foxBMS Team
  * @date    2019-12-04 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  CAN
@@ -64,6 +64,7 @@
 #include "HL_het.h"
 #include "HL_reg_can.h"
 #include "HL_reg_system.h"
+#include "HL_system.h"
 
 #include "can_helper.h"
 #include "database.h"
@@ -129,6 +130,36 @@ FAS_STATIC_ASSERT(
     (CAN_HIGHEST_MAILBOX_FOR_EXTENDED_IDENTIFIERS <= CAN_TOTAL_NUMBER_OF_MESSAGE_BOXES),
     "Highest mailbox number must not be larger than total number of mailboxes");
 
+/** TX bus-load budget in bits that becomes available every #CAN_TICK_ms */
+#define CAN_TX_BUS_LOAD_BUDGET_PER_TICK_bit \
+    ((int32_t)((CAN_BITRATE_kbps * CAN_TICK_ms * CAN_TX_BUS_LOAD_BUDGET_perc) / 100u))
+
+/** time window over which unused TX bus-load budget is accumulated */
+#define CAN_TX_BUS_LOAD_WINDOW_ms (100u)
+
+/** upper (and negated lower) limit of the accumulated TX bus-load budget */
+#define CAN_TX_BUS_LOAD_BUDGET_LIMIT_bit \
+    (CAN_TX_BUS_LOAD_BUDGET_PER_TICK_bit * (int32_t)(CAN_TX_BUS_LOAD_WINDOW_ms / CAN_TICK_ms))
+
+/** bit rate in kbit/s that results from a HALCoGen bit timing register
+ *  configuration value (BRP and BRPE form the prescaler, a bit consists of
+ *  the sync segment, TSEG1 + 1 and TSEG2 + 1 time quanta) */
+#define CAN_GET_BITRATE_kbps(btr)                                                      \
+    (((uint32_t)VCLK1_FREQ * 1000u) /                                                  \
+     (((((uint32_t)(btr) & 0x3Fu) | ((((uint32_t)(btr) >> 16u) & 0xFu) << 6u)) + 1u) * \
+      (3u + (((uint32_t)(btr) >> 8u) & 0xFu) + (((uint32_t)(btr) >> 12u) & 0x7u))))
+
+FAS_STATIC_ASSERT(
+    (CAN_GET_BITRATE_kbps(CAN1_BTR_CONFIGVALUE) == CAN_BITRATE_kbps),
+    "CAN_BITRATE_kbps does not match the bit rate of CAN1 in the HALCoGen configuration");
+FAS_STATIC_ASSERT(
+    (CAN_GET_BITRATE_kbps(CAN2_BTR_CONFIGVALUE) == CAN_BITRATE_kbps),
+    "CAN_BITRATE_kbps does not match the bit rate of CAN2 in the HALCoGen configuration");
+FAS_STATIC_ASSERT((CAN_TX_BUS_LOAD_BUDGET_perc <= 100u), "Bus-load budget must not exceed 100%");
+FAS_STATIC_ASSERT(
+    (CAN_TX_BURST_MAILBOX_RESERVE < CAN_NR_OF_TX_MESSAGE_BOX),
+    "Mailbox reserve must leave at least one TX mailbox for bursts");
+
 /*========== Static Constant and Variable Definitions =======================*/
 
 /** tracks the local state of the can module */
@@ -137,6 +168,7 @@ static CAN_STATE_s can_state = {
     .currentSensorPresent   = {GEN_REPEAT_U(false, GEN_STRIP(BS_NR_OF_STRINGS))},
     .currentSensorCCPresent = {GEN_REPEAT_U(false, GEN_STRIP(BS_NR_OF_STRINGS))},
     .currentSensorECPresent = {GEN_REPEAT_U(false, GEN_STRIP(BS_NR_OF_STRINGS))},
+    .txBusLoadBudget_bit    = 0,
 };
 
 /** stores the number of CAN_periodicTransmit calls at which the internal
@@ -170,12 +202,73 @@ static void CAN_RxInterrupt(canBASE_t *pNode, uint32 messageBox);
  *          often this function has been called) states that a transmit is
  *          pending, the message is composed by call of CANS_ComposeMessage
  *          and transferred to the buffer of the CAN module.
+ *          The local database tables that the due messages need are read
+ *          once before the first callback is called, so that all messages
+ *          of one tick are composed from the same database snapshot.
  *          If a callback function is declared in configuration, this callback
  *          is called after successful transmission.
+ *          A callback that returns a value greater than zero requests to
+ *          compose further frames in the same tick (burst). The callback is
+ *          called again as long as it requests frames and
+ *          #CAN_IsBurstFrameAllowed allows it.
  * @return  #STD_OK if a CAN transfer was made, #STD_NOT_OK otherwise
  */
 static STD_RETURN_TYPE_e CAN_PeriodicTransmit(void);
 
+/**
+ * @brief   Transmits a composed periodic message or stores it in the queue
+ *          of unsent messages if no TX mailbox is free.
+ * @details The frame is charged to the TX bus-load budget.
+ * @param   messageIndex    index of the message in the tx message array
+ * @param   pData           payload of the CAN frame
+ */
+static void CAN_TransmitOrStoreMessage(uint16_t messageIndex, uint8_t *pData);
+
+/**
+ * @brief   Counts the TX mailboxes of a node that are not pending
+ * @param   pNode   CAN node to check
+ * @return  number of free TX mailboxes
+ */
+static uint8_t CAN_GetNumberOfFreeTxMessageBoxes(CAN_NODE_s *pNode);
+
+/**
+ * @brief   Adds the budget of one #CAN_TICK_ms to the TX bus-load budget
+ * @details Unused budget is accumulated over #CAN_TX_BUS_LOAD_WINDOW_ms, so
+ *          that a burst can use the budget that has not been used by the
+ *          regularly scheduled messages in this window.
+ */
+static void CAN_RefillBusLoadBudget(void);
+
+/**
+ * @brief   Checks if a TX callback may compose another frame in this tick
+ * @details A burst frame is allowed if the TX bus-load budget covers one more
+ *          frame and if more than #CAN_TX_BURST_MAILBOX_RESERVE TX mailboxes
+ *          of the node are free.
+ * @param   pNode   CAN node on which the burst is transmitted
+ * @return  true if another frame may be sent, false otherwise
+ */
+static bool CAN_IsBurstFrameAllowed(CAN_NODE_s *pNode);
+
+/**
+ * @brief   Returns the local database table of #can_kShim that belongs to a
+ *          CAN_SHIM_TABLE_* bit
+ * @param   table   one of the CAN_SHIM_TABLE_* bits
+ * @return  pointer to the local database table
+ */
+static void *CAN_GetShimTable(uint16_t table);
+
+/**
+ * @brief   Reads the local database tables that are needed by the periodic
+ *          TX messages of the current tick
+ * @details The tables are read with as few database accesses as possible
+ *          (#DATA_MAX_ENTRIES_PER_ACCESS tables per access), so that all
+ *          callbacks of one tick compose their messages from the same
+ *          database snapshot.
+ * @param   databaseTables  bit mask (CAN_SHIM_TABLE_*) of the tables to read
+ * @return  number of database accesses that were made
+ */
+static uint8_t CAN_ReadDatabaseSnapshot(uint16_t databaseTables);
+
 /**
  * @brief   Checks if a configured period CAN message should be transmitted depending
  *          on the configured message period and message phase.
@@ -697,37 +790,34 @@ static STD_RETURN_TYPE_e CAN_PeriodicTransmit(void) {
     uint8_t data[CAN_MAX_DLC]    = {0};
 
     CAN_SendMessagesFromQueue();
+    CAN_RefillBusLoadBudget();
+
+    /* read the database tables of all messages that are due in this tick at once */
+    uint16_t databaseTables = CAN_SHIM_TABLE_NONE;
+    for (uint16_t i = 0u; i < can_txMessagesLength; i++) {
+        if ((CAN_IsMessagePeriodElapsed(counterTicks, i) == true) &&
+            (can_txMessages[i].callbackFunction != NULL_PTR)) {
+            databaseTables |= can_txMessages[i].databaseTables;
+        }
+    }
+    (void)CAN_ReadDatabaseSnapshot(databaseTables);
 
     for (uint16_t i = 0u; i < can_txMessagesLength; i++) {
         if (CAN_IsMessagePeriodElapsed(counterTicks, i) == true) {
             if (can_txMessages[i].callbackFunction != NULL_PTR) {
-                can_txMessages[i].callbackFunction(
+                /* the return value of the callback is the number of further
+                   frames the callback wants to send in this tick */
+                uint32_t framesRequested = can_txMessages[i].callbackFunction(
                     can_txMessages[i].message, data, can_txMessages[i].pMuxId, &can_kShim);
-                if (CAN_DataSend(
-                        can_txMessages[i].canNode,
-                        can_txMessages[i].message.id,
-                        can_txMessages[i].message.idType,
-                        data) != STD_OK) {
-                    /* message was not sent */
-                    /* store the message */
-                    CAN_BUFFER_ELEMENT_s unsentMessage = {
-                        .canNode = can_txMessages[i].canNode,
-                        .id      = can_txMessages[i].message.id,
-                        .idType  = can_txMessages[i].message.idType,
-                        .data    = {0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u}};
-
-                    for (uint8_t j = 0; j < can_txMessages[i].message.dlc; j++) {
-                        unsentMessage.data[j] = data[j];
-                    }
-
-                    /* add message to queue */
-                    if (OS_SendToBackOfQueue(ftsk_canTxUnsentMessagesQueue, (void *)&unsentMessage, 0u) == OS_SUCCESS) {
-                        /* Queue is not full */
-                        (void)DIAG_Handler(DIAG_ID_CAN_TX_QUEUE_FULL, DIAG_EVENT_OK, DIAG_SYSTEM, 0u);
-                    } else {
-                        /* Queue is full */
-                        (void)DIAG_Handler(DIAG_ID_CAN_TX_QUEUE_FULL, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u);
-                    }
+                CAN_TransmitOrStoreMessage(i, data);
+
+                uint8_t burstFrames = 0u;
+                while ((framesRequested > 0u) && (burstFrames < CAN_NR_OF_TX_MESSAGE_BOX) &&
+                       (CAN_IsBurstFrameAllowed(can_txMessages[i].canNode) == true)) {
+                    framesRequested = can_txMessages[i].callbackFunction(
+                        can_txMessages[i].message, data, can_txMessages[i].pMuxId, &can_kShim);
+                    CAN_TransmitOrStoreMessage(i, data);
+                    burstFrames++;
                 }
                 retVal = STD_OK;
             }
@@ -743,6 +833,158 @@ static STD_RETURN_TYPE_e CAN_PeriodicTransmit(void) {
     return retVal;
 }
 
+static void *CAN_GetShimTable(uint16_t table) {
+    void *pTable = NULL_PTR;
+    switch (table) {
+        case CAN_SHIM_TABLE_BALANCING_CONTROL:
+            pTable = (void *)can_kShim.pTableBalancingControl;
+            break;
+        case CAN_SHIM_TABLE_ENERGY_COUNTER:
+            pTable = (void *)can_kShim.pTableEnergyCounter;
+            break;
+        case CAN_SHIM_TABLE_ERROR_STATE:
+            pTable = (void *)can_kShim.pTableErrorState;
+            break;
+        case CAN_SHIM_TABLE_INSULATION:
+            pTable = (void *)can_kShim.pTableInsulation;
+            break;
+        case CAN_SHIM_TABLE_MIN_MAX:
+            pTable = (void *)can_kShim.pTableMinMax;
+            break;
+        case CAN_SHIM_TABLE_MOL:
+            pTable = (void *)can_kShim.pTableMol;
+            break;
+        case CAN_SHIM_TABLE_MSL:
+            pTable = (void *)can_kShim.pTableMsl;
+            break;
+        case CAN_SHIM_TABLE_PACK_VALUES:
+            pTable = (void *)can_kShim.pTablePackValues;
+            break;
+        case CAN_SHIM_TABLE_PHY:
+            pTable = (void *)can_kShim.pTablePhy;
+            break;
+        case CAN_SHIM_TABLE_RSL:
+            pTable = (void *)can_kShim.pTableRsl;
+            break;
+        case CAN_SHIM_TABLE_SOC:
+            pTable = (void *)can_kShim.pTableSoc;
+            break;
+        case CAN_SHIM_TABLE_SOE:
+            pTable = (void *)can_kShim.pTableSoe;
+            break;
+        case CAN_SHIM_TABLE_SOF:
+            pTable = (void *)can_kShim.pTableSof;
+            break;
+        default:
+            FAS_ASSERT(FAS_TRAP);
+            break;
+    }
+    return pTable;
+}
+
+static uint8_t CAN_ReadDatabaseSnapshot(uint16_t databaseTables) {
+    FAS_ASSERT((databaseTables >> CAN_SHIM_NR_OF_TABLES) == 0u);
+    void *pTables[CAN_SHIM_NR_OF_TABLES] = {NULL_PTR};
+    uint8_t numberOfTables               = 0u;
+    uint8_t numberOfAccesses             = 0u;
+
+    for (uint8_t bit = 0u; bit < CAN_SHIM_NR_OF_TABLES; bit++) {
+        const uint16_t table = (uint16_t)(1u << bit);
+        if ((databaseTables & table) != 0u) {
+            pTables[numberOfTables] = CAN_GetShimTable(table);
+            numberOfTables++;
+        }
+    }
+
+    for (uint8_t i = 0u; i < numberOfTables; i += DATA_MAX_ENTRIES_PER_ACCESS) {
+        switch (numberOfTables - i) {
+            case 1u:
+                (void)DATA_READ_DATA(pTables[i]);
+                break;
+            case 2u:
+                (void)DATA_READ_DATA(pTables[i], pTables[i + 1u]);
+                break;
+            case 3u:
+                (void)DATA_READ_DATA(pTables[i], pTables[i + 1u], pTables[i + 2u]);
+                break;
+            default:
+                (void)DATA_READ_DATA(pTables[i], pTables[i + 1u], pTables[i + 2u], pTables[i + 3u]);
+                break;
+        }
+        numberOfAccesses++;
+    }
+    return numberOfAccesses;
+}
+
+static void CAN_TransmitOrStoreMessage(uint16_t messageIndex, uint8_t *pData) {
+    FAS_ASSERT(messageIndex < can_txMessagesLength);
+    FAS_ASSERT(pData != NULL_PTR);
+
+    if (CAN_DataSend(
+            can_txMessages[messageIndex].canNode,
+            can_txMessages[messageIndex].message.id,
+            can_txMessages[messageIndex].message.idType,
+            pData) != STD_OK) {
+        /* message was not sent */
+        /* store the message */
+        CAN_BUFFER_ELEMENT_s unsentMessage = {
+            .canNode = can_txMessages[messageIndex].canNode,
+            .id      = can_txMessages[messageIndex].message.id,
+            .idType  = can_txMessages[messageIndex].message.idType,
+            .data    = {0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u}};
+
+        for (uint8_t j = 0; j < can_txMessages[messageIndex].message.dlc; j++) {
+            unsentMessage.data[j] = pData[j];
+        }
+
+        /* add message to queue */
+        if (OS_SendToBackOfQueue(ftsk_canTxUnsentMessagesQueue, (void *)&unsentMessage, 0u) == OS_SUCCESS) {
+            /* Queue is not full */
+            (void)DIAG_Handler(DIAG_ID_CAN_TX_QUEUE_FULL, DIAG_EVENT_OK, DIAG_SYSTEM, 0u);
+        } else {
+            /* Queue is full */
+            (void)DIAG_Handler(DIAG_ID_CAN_TX_QUEUE_FULL, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u);
+        }
+    }
+
+    /* the frame uses the bus either now or when it is sent from the queue */
+    can_state.txBusLoadBudget_bit -= (int32_t)CAN_TX_FRAME_LENGTH_bit;
+    if (can_state.txBusLoadBudget_bit < -CAN_TX_BUS_LOAD_BUDGET_LIMIT_bit) {
+        can_state.txBusLoadBudget_bit = -CAN_TX_BUS_LOAD_BUDGET_LIMIT_bit;
+    }
+}
+
+static uint8_t CAN_GetNumberOfFreeTxMessageBoxes(CAN_NODE_s *pNode) {
+    FAS_ASSERT(pNode != NULL_PTR);
+    uint8_t freeMessageBoxes = 0u;
+    /* In the HAL, message box numbers start from 1, not 0. */
+    for (uint8_t messageBox = 1u; messageBox <= CAN_NR_OF_TX_MESSAGE_BOX; messageBox++) {
+        if (canIsTxMessagePending(pNode->canNodeRegister, messageBox) == 0u) {
+            freeMessageBoxes++;
+        }
+    }
+    return freeMessageBoxes;
+}
+
+static void CAN_RefillBusLoadBudget(void) {
+    can_state.txBusLoadBudget_bit += CAN_TX_BUS_LOAD_BUDGET_PER_TICK_bit;
+    if (can_state.txBusLoadBudget_bit > CAN_TX_BUS_LOAD_BUDGET_LIMIT_bit) {
+        can_state.txBusLoadBudget_bit = CAN_TX_BUS_LOAD_BUDGET_LIMIT_bit;
+    }
+}
+
+static bool CAN_IsBurstFrameAllowed(CAN_NODE_s *pNode) {
+    FAS_ASSERT(pNode != NULL_PTR);
+    bool isAllowed = false;
+    /* check the budget first, it does not need to access the hardware */
+    if (can_state.txBusLoadBudget_bit >= (int32_t)CAN_TX_FRAME_LENGTH_bit) {
+        if (CAN_GetNumberOfFreeTxMessageBoxes(pNode) > CAN_TX_BURST_MAILBOX_RESERVE) {
+            isAllowed = true;
+        }
+    }
+    return isAllowed;
+}
+
 static uint32_t CAN_CalculateCounterResetValue(void) {
     /* initialize with first array entry for first iteration */
     uint32_t resetValue = can_txMessages[0].timing.period;
@@ -1076,6 +1318,24 @@ extern void TEST_CAN_RxInterrupt(canBASE_t *pNode, uint32 messageBox) {
 extern STD_RETURN_TYPE_e TEST_CAN_PeriodicTransmit(void) {
     return CAN_PeriodicTransmit();
 }
+extern void TEST_CAN_TransmitOrStoreMessage(uint16_t messageIndex, uint8_t *pData) {
+    CAN_TransmitOrStoreMessage(messageIndex, pData);
+}
+extern uint8_t TEST_CAN_GetNumberOfFreeTxMessageBoxes(CAN_NODE_s *pNode) {
+    return CAN_GetNumberOfFreeTxMessageBoxes(pNode);
+}
+extern void TEST_CAN_RefillBusLoadBudget(void) {
+    CAN_RefillBusLoadBudget();
+}
+extern bool TEST_CAN_IsBurstFrameAllowed(CAN_NODE_s *pNode) {
+    return CAN_IsBurstFrameAllowed(pNode);
+}
+extern void *TEST_CAN_GetShimTable(uint16_t table) {
+    return CAN_GetShimTable(table);
+}
+extern uint8_t TEST_CAN_ReadDatabaseSnapshot(uint16_t databaseTables) {
+    return CAN_ReadDatabaseSnapshot(databaseTables);
+}
 extern uint32_t TEST_CAN_CalculateCounterResetValue(void) {
     return CAN_CalculateCounterResetValue();
 }
@@ -82,6 +82,7 @@ typedef struct {
     bool currentSensorPresent[BS_NR_OF_STRINGS];   /*!< defines if a current sensor is detected */
     bool currentSensorCCPresent[BS_NR_OF_STRINGS]; /*!< defines if a CC info is being sent */
     bool currentSensorECPresent[BS_NR_OF_STRINGS]; /*!< defines if a EC info is being sent */
+    int32_t txBusLoadBudget_bit;                   /*!< remaining TX bus-load budget in bits */
 } CAN_STATE_s;
 
 /*========== Extern Constant and Variable Declarations ======================*/
@@ -164,6 +165,12 @@ extern void TEST_CAN_CheckDatabaseNullPointer(CAN_SHIM_s canShim);
 extern void TEST_CAN_TxInterrupt(canBASE_t *pNode, uint32 messageBox);
 extern void TEST_CAN_RxInterrupt(canBASE_t *pNode, uint32 messageBox);
 extern STD_RETURN_TYPE_e TEST_CAN_PeriodicTransmit(void);
+extern void TEST_CAN_TransmitOrStoreMessage(uint16_t messageIndex, uint8_t *pData);
+extern uint8_t TEST_CAN_GetNumberOfFreeTxMessageBoxes(CAN_NODE_s *pNode);
+extern void TEST_CAN_RefillBusLoadBudget(void);
+extern bool TEST_CAN_IsBurstFrameAllowed(CAN_NODE_s *pNode);
+extern void *TEST_CAN_GetShimTable(uint16_t table);
+extern uint8_t TEST_CAN_ReadDatabaseSnapshot(uint16_t databaseTables);
 extern uint32_t TEST_CAN_CalculateCounterResetValue(void);
 extern void TEST_CAN_CheckCanTiming(void);
 extern bool TEST_CAN_IsMessagePeriodElapsed(uint32_t ticksSinceStart, uint16_t messageIndex);
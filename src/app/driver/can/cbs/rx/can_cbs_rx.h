@@ -43,7 +43,7 @@
  * @file    can_cbs_rx.h
  * @author  foxBMS Team
  * @date    2021-04-20 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  CANRX
@@ -278,6 +278,8 @@ extern void TEST_CANRX_TriggerBootTimestampMessage(void);
 extern void TEST_CANRX_TriggerCommitHashMessage(void);
 extern void TEST_CANRX_TriggerBuildConfigurationMessage(void);
 extern void TEST_CANRX_TriggerIdentifyHardwareMessage(void);
+extern void TEST_CANRX_TriggerLatencyStatisticsMessage(void);
+extern void TEST_CANRX_TriggerMemoryPoolStatisticsMessage(void);
 
 extern bool TEST_CANRX_CheckIfBmsSoftwareVersionIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
 extern bool TEST_CANRX_CheckIfMcuUniqueDieIdIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
@@ -291,6 +293,17 @@ extern bool TEST_CANRX_CheckIfBootTimestampIsRequested(uint64_t messageData, CAN
 extern bool TEST_CANRX_CheckIfCommitHashIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
 extern bool TEST_CANRX_CheckIfBuildConfigurationIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
 extern bool TEST_CANRX_CheckIfIdentifyHardwareIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern bool TEST_CANRX_CheckIfLatencyStatisticsIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern bool TEST_CANRX_CheckIfLatencyStatisticsResetIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern bool TEST_CANRX_CheckIfKernelTraceSnapshotIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern bool TEST_CANRX_CheckIfKernelTraceResumeIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern bool TEST_CANRX_CheckIfMemoryPoolStatisticsIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern bool TEST_CANRX_CheckIfMemoryPoolStatisticsResetIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern bool TEST_CANRX_CheckIfBusStatisticsIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern bool TEST_CANRX_CheckIfBusStatisticsResetIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern uint8_t TEST_CANRX_GetRequestedBus(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern bool TEST_CANRX_CheckIfStackUsageIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern uint8_t TEST_CANRX_GetRequestedTask(uint64_t messageData, CAN_ENDIANNESS_e endianness);
 
 extern void TEST_CANRX_ProcessVersionInformationMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
 extern void TEST_CANRX_ProcessRtcMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
@@ -299,6 +312,11 @@ extern void TEST_CANRX_ProcessFramInitializationMux(uint64_t messageData, CAN_EN
 extern void TEST_CANRX_ProcessTimeInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
 extern void TEST_CANRX_ProcessUptimeInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
 extern void TEST_CANRX_ProcessIdentifyHardwareMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern void TEST_CANRX_ProcessLatencyInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern void TEST_CANRX_ProcessKernelTraceMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern void TEST_CANRX_ProcessMemoryPoolInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern void TEST_CANRX_ProcessBusInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+extern void TEST_CANRX_ProcessStackInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
 
 extern void TEST_CANRX_HandleAerosolSensorErrors(const CAN_SHIM_s *const kpkCanShim, uint16_t signalData);
 extern void TEST_CANRX_HandleAerosolSensorStatus(const CAN_SHIM_s *const kpkCanShim, uint16_t signalData);
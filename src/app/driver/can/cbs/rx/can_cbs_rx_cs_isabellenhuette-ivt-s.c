@@ -43,7 +43,7 @@
  * @file    can_cbs_rx_cs_isabellenhuette-ivt-s.c
  * @author  foxBMS Team
  * @date    2021-04-20 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  CANRX
@@ -59,6 +59,7 @@
 #include "can_cbs_rx.h"
 #include "can_cfg_rx-message-definitions.h"
 #include "can_helper.h"
+#include "current_integration.h"
 
 #include <stdint.h>
 
@@ -339,6 +340,8 @@ static void CANRX_SetCurrent(const CAN_SHIM_s *const kpkCanShim, uint8_t stringN
     kpkCanShim->pTableCurrent->previousTimestamp[stringNumber] = kpkCanShim->pTableCurrent->timestamp[stringNumber];
     kpkCanShim->pTableCurrent->timestamp[stringNumber]         = OS_GetTickCount();
     DATA_WRITE_DATA(kpkCanShim->pTableCurrent);
+    /* integrate charge and energy at the sensor rate */
+    (void)CINT_AddCurrentSample(stringNumber, signalData);
 }
 
 static void CANRX_SetVoltageU1(const CAN_SHIM_s *const kpkCanShim, uint8_t stringNumber, int32_t signalData) {
@@ -350,6 +353,7 @@ static void CANRX_SetVoltageU1(const CAN_SHIM_s *const kpkCanShim, uint8_t strin
         kpkCanShim->pTableSystemVoltage1->timestamp[stringNumber];
     kpkCanShim->pTableSystemVoltage1->timestamp[stringNumber] = OS_GetTickCount();
     DATA_WRITE_DATA(kpkCanShim->pTableSystemVoltage1);
+    CINT_SetVoltage(stringNumber, signalData);
 }
 
 static void CANRX_SetVoltageU2(const CAN_SHIM_s *const kpkCanShim, uint8_t stringNumber, int32_t signalData) {
@@ -43,7 +43,7 @@
  * @file    can_cbs_rx_cs_lem-cab500.c
  * @author  foxBMS Team
  * @date    2025-04-28 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  CANRX
@@ -58,6 +58,7 @@
 #include "can_cbs_rx.h"
 #include "can_cfg_rx-message-definitions.h"
 #include "can_helper.h"
+#include "current_integration.h"
 
 #include <stdint.h>
 
@@ -181,6 +182,8 @@ static void CANRX_LemSetCurrent(const CAN_SHIM_s *const kpkCanShim, uint8_t stri
     kpkCanShim->pTableCurrent->newCurrent++;
     kpkCanShim->pTableCurrent->previousTimestamp[stringNumber] = kpkCanShim->pTableCurrent->timestamp[stringNumber];
     kpkCanShim->pTableCurrent->timestamp[stringNumber]         = OS_GetTickCount();
+    /* integrate the charge at the sensor rate */
+    (void)CINT_AddCurrentSample(stringNumber, current_mA);
 }
 
 static uint8_t CANRX_LemSetStringNumberBasedOnCanMessageId(uint32_t messageId) {
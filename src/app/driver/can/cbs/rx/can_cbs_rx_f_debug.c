@@ -43,7 +43,7 @@
  * @file    can_cbs_rx_f_debug.c
  * @author  foxBMS Team
  * @date    2021-04-20 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  CANRX
@@ -64,9 +64,14 @@
 #include "can_helper.h"
 #include "fram.h"
 #include "ftask.h"
+#include "mem_pool.h"
 #include "reset.h"
 #include "rtc.h"
 #include "sys.h"
+#include "sys_mon_bus.h"
+#include "sys_mon_latency.h"
+#include "sys_mon_stack.h"
+#include "trace.h"
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -90,6 +95,11 @@
 #define CANRX_DEBUG_MESSAGE_MUX_VALUE_UPTIME_INFO             (0x05u)
 #define CANRX_DEBUG_MESSAGE_MUX_VALUE_BOOT_TIMESTAMP          (0x06u)
 #define CANRX_DEBUG_MESSAGE_MUX_VALUE_HARDWARE_IDENTIFICATION (0x07u)
+#define CANRX_DEBUG_MESSAGE_MUX_VALUE_LATENCY_INFO            (0x08u)
+#define CANRX_DEBUG_MESSAGE_MUX_VALUE_KERNEL_TRACE            (0x09u)
+#define CANRX_DEBUG_MESSAGE_MUX_VALUE_MEMORY_POOL_INFO        (0x0Au)
+#define CANRX_DEBUG_MESSAGE_MUX_VALUE_BUS_INFO                (0x0Bu)
+#define CANRX_DEBUG_MESSAGE_MUX_VALUE_STACK_INFO              (0x0Cu)
 /** @} */
 
 /** @{
@@ -195,6 +205,58 @@
 #define CANRX_MUX_HARDWARE_IDENTIFICATION_SIGNAL_TRIGGER_REQUEST_UPTIME_LENGTH    (CAN_BIT)
 /** @} */
 
+/** @{
+ * configuration of the latency info signals for multiplexer 'LatencyInfo'
+ * in the 'Debug' message
+ */
+#define CANRX_MUX_LATENCY_INFO_SIGNAL_TRIGGER_REQUEST_STATISTICS_START_BIT (15u)
+#define CANRX_MUX_LATENCY_INFO_SIGNAL_TRIGGER_REQUEST_STATISTICS_LENGTH    (CAN_BIT)
+#define CANRX_MUX_LATENCY_INFO_SIGNAL_TRIGGER_RESET_STATISTICS_START_BIT   (14u)
+#define CANRX_MUX_LATENCY_INFO_SIGNAL_TRIGGER_RESET_STATISTICS_LENGTH      (CAN_BIT)
+/** @} */
+
+/** @{
+ * configuration of the kernel trace signals for multiplexer 'KernelTrace'
+ * in the 'Debug' message
+ */
+#define CANRX_MUX_KERNEL_TRACE_SIGNAL_TRIGGER_REQUEST_SNAPSHOT_START_BIT (15u)
+#define CANRX_MUX_KERNEL_TRACE_SIGNAL_TRIGGER_REQUEST_SNAPSHOT_LENGTH    (CAN_BIT)
+#define CANRX_MUX_KERNEL_TRACE_SIGNAL_TRIGGER_RESUME_START_BIT           (14u)
+#define CANRX_MUX_KERNEL_TRACE_SIGNAL_TRIGGER_RESUME_LENGTH              (CAN_BIT)
+/** @} */
+
+/** @{
+ * configuration of the memory pool info signals for multiplexer
+ * 'MemoryPoolInfo' in the 'Debug' message
+ */
+#define CANRX_MUX_MEMORY_POOL_INFO_SIGNAL_TRIGGER_REQUEST_STATISTICS_START_BIT (15u)
+#define CANRX_MUX_MEMORY_POOL_INFO_SIGNAL_TRIGGER_REQUEST_STATISTICS_LENGTH    (CAN_BIT)
+#define CANRX_MUX_MEMORY_POOL_INFO_SIGNAL_TRIGGER_RESET_STATISTICS_START_BIT   (14u)
+#define CANRX_MUX_MEMORY_POOL_INFO_SIGNAL_TRIGGER_RESET_STATISTICS_LENGTH      (CAN_BIT)
+/** @} */
+
+/** @{
+ * configuration of the bus info signals for multiplexer 'BusInfo' in the
+ * 'Debug' message
+ */
+#define CANRX_MUX_BUS_INFO_SIGNAL_TRIGGER_REQUEST_STATISTICS_START_BIT (15u)
+#define CANRX_MUX_BUS_INFO_SIGNAL_TRIGGER_REQUEST_STATISTICS_LENGTH    (CAN_BIT)
+#define CANRX_MUX_BUS_INFO_SIGNAL_TRIGGER_RESET_STATISTICS_START_BIT   (14u)
+#define CANRX_MUX_BUS_INFO_SIGNAL_TRIGGER_RESET_STATISTICS_LENGTH      (CAN_BIT)
+#define CANRX_MUX_BUS_INFO_SIGNAL_BUS_START_BIT                        (11u)
+#define CANRX_MUX_BUS_INFO_SIGNAL_BUS_LENGTH                           (4u)
+/** @} */
+
+/** @{
+ * configuration of the stack info signals for multiplexer 'StackInfo' in the
+ * 'Debug' message
+ */
+#define CANRX_MUX_STACK_INFO_SIGNAL_TRIGGER_REQUEST_USAGE_START_BIT (15u)
+#define CANRX_MUX_STACK_INFO_SIGNAL_TRIGGER_REQUEST_USAGE_LENGTH    (CAN_BIT)
+#define CANRX_MUX_STACK_INFO_SIGNAL_TASK_START_BIT                  (11u)
+#define CANRX_MUX_STACK_INFO_SIGNAL_TASK_LENGTH                     (4u)
+/** @} */
+
 /*========== Static Constant and Variable Definitions =======================*/
 
 /*========== Extern Constant and Variable Definitions =======================*/
@@ -251,6 +313,42 @@ static void CANRX_ProcessUptimeInfoMux(uint64_t messageData, CAN_ENDIANNESS_e en
  */
 static void CANRX_ProcessIdentifyHardwareMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
 
+/**
+ * @brief   Parses CAN message to handle latency statistics related messages
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ */
+static void CANRX_ProcessLatencyInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Parses CAN message to handle kernel trace related messages
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ */
+static void CANRX_ProcessKernelTraceMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Parses CAN message to handle memory pool statistics related
+ *          messages
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ */
+static void CANRX_ProcessMemoryPoolInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Parses CAN message to handle bus statistics related messages
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ */
+static void CANRX_ProcessBusInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Parses CAN message to handle stack usage related messages
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ */
+static void CANRX_ProcessStackInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
 /**
  * @brief   Parses the CAN message to retrieve the hundredth of seconds
  *          information
@@ -462,6 +560,116 @@ static bool CANRX_CheckIfIdentifyHardwareIsRequested(uint64_t messageData, CAN_E
  */
 static void CANRX_TriggerIdentifyHardwareMessage(void);
 
+/**
+ * @brief   Check if the latency statistics are requested
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ * @return  true if the information is requested, false otherwise
+ */
+static bool CANRX_CheckIfLatencyStatisticsIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Check if a reset of the latency statistics is requested
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ * @return  true if the reset is requested, false otherwise
+ */
+static bool CANRX_CheckIfLatencyStatisticsResetIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Triggers sending of the latency statistics messages
+ */
+static void CANRX_TriggerLatencyStatisticsMessage(void);
+
+/**
+ * @brief   Check if a kernel trace snapshot is requested
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ * @return  true if the snapshot is requested, false otherwise
+ */
+static bool CANRX_CheckIfKernelTraceSnapshotIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Check if resuming the kernel trace recording is requested
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ * @return  true if resuming is requested, false otherwise
+ */
+static bool CANRX_CheckIfKernelTraceResumeIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Check if the memory pool statistics are requested
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ * @return  true if the information is requested, false otherwise
+ */
+static bool CANRX_CheckIfMemoryPoolStatisticsIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Check if a reset of the memory pool statistics is requested
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ * @return  true if the reset is requested, false otherwise
+ */
+static bool CANRX_CheckIfMemoryPoolStatisticsResetIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Triggers sending of the memory pool statistics messages
+ */
+static void CANRX_TriggerMemoryPoolStatisticsMessage(void);
+
+/**
+ * @brief   Check if the statistics of a bus are requested
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ * @return  true if the information is requested, false otherwise
+ */
+static bool CANRX_CheckIfBusStatisticsIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Check if a reset of the bus statistics is requested
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ * @return  true if the reset is requested, false otherwise
+ */
+static bool CANRX_CheckIfBusStatisticsResetIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Gets the bus of which the statistics are requested
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ * @return  requested bus as transmitted, it is not validated
+ */
+static uint8_t CANRX_GetRequestedBus(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Triggers sending of the statistics messages of a bus
+ * @param   bus bus of which the statistics are sent
+ */
+static void CANRX_TriggerBusStatisticsMessage(SYSM_BUS_e bus);
+
+/**
+ * @brief   Check if the stack usage of a task is requested
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ * @return  true if the information is requested, false otherwise
+ */
+static bool CANRX_CheckIfStackUsageIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Gets the task of which the stack usage is requested
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ * @return  requested task as transmitted, it is not validated
+ */
+static uint8_t CANRX_GetRequestedTask(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Triggers sending of the stack usage message of a task
+ * @param   task task of which the stack usage is sent
+ */
+static void CANRX_TriggerStackUsageMessage(SYSM_STACK_TASK_e task);
+
 /*========== Static Function Implementations ================================*/
 
 static uint8_t CANRX_GetHundredthOfSeconds(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
@@ -1002,6 +1210,319 @@ static bool CANRX_CheckIfIdentifyHardwareIsRequested(uint64_t messageData, CAN_E
     return isRequested;
 }
 
+static void CANRX_ProcessLatencyInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    /* trigger latency statistics message, if requested */
+    if (CANRX_CheckIfLatencyStatisticsIsRequested(messageData, endianness) == true) {
+        CANRX_TriggerLatencyStatisticsMessage();
+    }
+    /* reset after the transmission, so that both can be requested at once */
+    if (CANRX_CheckIfLatencyStatisticsResetIsRequested(messageData, endianness) == true) {
+        SYSM_ResetLatencyStatistics();
+    }
+}
+
+static bool CANRX_CheckIfLatencyStatisticsIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    bool isRequested    = false;
+    uint64_t signalData = 0u;
+
+    /* get latency statistics request bit from the CAN message */
+    CAN_RxGetSignalDataFromMessageData(
+        messageData,
+        CANRX_MUX_LATENCY_INFO_SIGNAL_TRIGGER_REQUEST_STATISTICS_START_BIT,
+        CANRX_MUX_LATENCY_INFO_SIGNAL_TRIGGER_REQUEST_STATISTICS_LENGTH,
+        &signalData,
+        endianness);
+    if (signalData == 1u) {
+        isRequested = true;
+    }
+    return isRequested;
+}
+
+static bool CANRX_CheckIfLatencyStatisticsResetIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    bool isRequested    = false;
+    uint64_t signalData = 0u;
+
+    /* get latency statistics reset bit from the CAN message */
+    CAN_RxGetSignalDataFromMessageData(
+        messageData,
+        CANRX_MUX_LATENCY_INFO_SIGNAL_TRIGGER_RESET_STATISTICS_START_BIT,
+        CANRX_MUX_LATENCY_INFO_SIGNAL_TRIGGER_RESET_STATISTICS_LENGTH,
+        &signalData,
+        endianness);
+    if (signalData == 1u) {
+        isRequested = true;
+    }
+    return isRequested;
+}
+
+static void CANRX_TriggerLatencyStatisticsMessage(void) {
+    /* send the debug messages containing the latency statistics and trap if this does not work */
+    if (CANTX_DebugResponse(CANTX_DEBUG_RESPONSE_TRANSMIT_LATENCY_STATISTICS) != STD_OK) {
+        FAS_ASSERT(FAS_TRAP);
+    }
+}
+
+static void CANRX_ProcessKernelTraceMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    /* resume first, so that both at once discard the old and freeze a new snapshot */
+    if (CANRX_CheckIfKernelTraceResumeIsRequested(messageData, endianness) == true) {
+        TRC_Resume();
+    }
+    if (CANRX_CheckIfKernelTraceSnapshotIsRequested(messageData, endianness) == true) {
+        TRC_Freeze(TRC_FREEZE_REASON_REQUEST, 0u);
+    }
+}
+
+static bool CANRX_CheckIfKernelTraceSnapshotIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    bool isRequested    = false;
+    uint64_t signalData = 0u;
+
+    /* get kernel trace snapshot request bit from the CAN message */
+    CAN_RxGetSignalDataFromMessageData(
+        messageData,
+        CANRX_MUX_KERNEL_TRACE_SIGNAL_TRIGGER_REQUEST_SNAPSHOT_START_BIT,
+        CANRX_MUX_KERNEL_TRACE_SIGNAL_TRIGGER_REQUEST_SNAPSHOT_LENGTH,
+        &signalData,
+        endianness);
+    if (signalData == 1u) {
+        isRequested = true;
+    }
+    return isRequested;
+}
+
+static bool CANRX_CheckIfKernelTraceResumeIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    bool isRequested    = false;
+    uint64_t signalData = 0u;
+
+    /* get kernel trace resume bit from the CAN message */
+    CAN_RxGetSignalDataFromMessageData(
+        messageData,
+        CANRX_MUX_KERNEL_TRACE_SIGNAL_TRIGGER_RESUME_START_BIT,
+        CANRX_MUX_KERNEL_TRACE_SIGNAL_TRIGGER_RESUME_LENGTH,
+        &signalData,
+        endianness);
+    if (signalData == 1u) {
+        isRequested = true;
+    }
+    return isRequested;
+}
+
+static void CANRX_ProcessMemoryPoolInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    /* trigger memory pool statistics message, if requested */
+    if (CANRX_CheckIfMemoryPoolStatisticsIsRequested(messageData, endianness) == true) {
+        CANRX_TriggerMemoryPoolStatisticsMessage();
+    }
+    /* reset after the transmission, so that both can be requested at once */
+    if (CANRX_CheckIfMemoryPoolStatisticsResetIsRequested(messageData, endianness) == true) {
+        MPOOL_ResetStatistics();
+    }
+}
+
+static bool CANRX_CheckIfMemoryPoolStatisticsIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    bool isRequested    = false;
+    uint64_t signalData = 0u;
+
+    /* get memory pool statistics request bit from the CAN message */
+    CAN_RxGetSignalDataFromMessageData(
+        messageData,
+        CANRX_MUX_MEMORY_POOL_INFO_SIGNAL_TRIGGER_REQUEST_STATISTICS_START_BIT,
+        CANRX_MUX_MEMORY_POOL_INFO_SIGNAL_TRIGGER_REQUEST_STATISTICS_LENGTH,
+        &signalData,
+        endianness);
+    if (signalData == 1u) {
+        isRequested = true;
+    }
+    return isRequested;
+}
+
+static bool CANRX_CheckIfMemoryPoolStatisticsResetIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    bool isRequested    = false;
+    uint64_t signalData = 0u;
+
+    /* get memory pool statistics reset bit from the CAN message */
+    CAN_RxGetSignalDataFromMessageData(
+        messageData,
+        CANRX_MUX_MEMORY_POOL_INFO_SIGNAL_TRIGGER_RESET_STATISTICS_START_BIT,
+        CANRX_MUX_MEMORY_POOL_INFO_SIGNAL_TRIGGER_RESET_STATISTICS_LENGTH,
+        &signalData,
+        endianness);
+    if (signalData == 1u) {
+        isRequested = true;
+    }
+    return isRequested;
+}
+
+static void CANRX_TriggerMemoryPoolStatisticsMessage(void) {
+    /* send the debug messages containing the memory pool statistics and trap if this does not work */
+    if (CANTX_DebugResponse(CANTX_DEBUG_RESPONSE_TRANSMIT_MEMORY_POOL_STATISTICS) != STD_OK) {
+        FAS_ASSERT(FAS_TRAP);
+    }
+}
+
+static void CANRX_ProcessBusInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    /* trigger bus statistics messages, if requested; requests for unknown buses are ignored */
+    if (CANRX_CheckIfBusStatisticsIsRequested(messageData, endianness) == true) {
+        const uint8_t bus = CANRX_GetRequestedBus(messageData, endianness);
+        if (bus < (uint8_t)SYSM_BUS_E_MAX) {
+            CANRX_TriggerBusStatisticsMessage((SYSM_BUS_e)bus);
+        }
+    }
+    /* reset after the transmission, so that both can be requested at once */
+    if (CANRX_CheckIfBusStatisticsResetIsRequested(messageData, endianness) == true) {
+        SYSM_ResetBusStatistics();
+    }
+}
+
+static bool CANRX_CheckIfBusStatisticsIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    bool isRequested    = false;
+    uint64_t signalData = 0u;
+
+    /* get bus statistics request bit from the CAN message */
+    CAN_RxGetSignalDataFromMessageData(
+        messageData,
+        CANRX_MUX_BUS_INFO_SIGNAL_TRIGGER_REQUEST_STATISTICS_START_BIT,
+        CANRX_MUX_BUS_INFO_SIGNAL_TRIGGER_REQUEST_STATISTICS_LENGTH,
+        &signalData,
+        endianness);
+    if (signalData == 1u) {
+        isRequested = true;
+    }
+    return isRequested;
+}
+
+static bool CANRX_CheckIfBusStatisticsResetIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    bool isRequested    = false;
+    uint64_t signalData = 0u;
+
+    /* get bus statistics reset bit from the CAN message */
+    CAN_RxGetSignalDataFromMessageData(
+        messageData,
+        CANRX_MUX_BUS_INFO_SIGNAL_TRIGGER_RESET_STATISTICS_START_BIT,
+        CANRX_MUX_BUS_INFO_SIGNAL_TRIGGER_RESET_STATISTICS_LENGTH,
+        &signalData,
+        endianness);
+    if (signalData == 1u) {
+        isRequested = true;
+    }
+    return isRequested;
+}
+
+static uint8_t CANRX_GetRequestedBus(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    uint64_t signalData = 0u;
+
+    /* get the requested bus from the CAN message */
+    CAN_RxGetSignalDataFromMessageData(
+        messageData,
+        CANRX_MUX_BUS_INFO_SIGNAL_BUS_START_BIT,
+        CANRX_MUX_BUS_INFO_SIGNAL_BUS_LENGTH,
+        &signalData,
+        endianness);
+    return (uint8_t)signalData;
+}
+
+static void CANRX_TriggerBusStatisticsMessage(SYSM_BUS_e bus) {
+    FAS_ASSERT(bus < SYSM_BUS_E_MAX);
+    /* send the debug messages containing the bus statistics and trap if this does not work */
+    if (CANTX_DebugResponseBusStatistics(bus) != STD_OK) {
+        FAS_ASSERT(FAS_TRAP);
+    }
+}
+
+static void CANRX_ProcessStackInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    /* trigger the stack usage message, if requested; requests for unknown tasks are ignored */
+    if (CANRX_CheckIfStackUsageIsRequested(messageData, endianness) == true) {
+        const uint8_t task = CANRX_GetRequestedTask(messageData, endianness);
+        if (task < (uint8_t)SYSM_STACK_TASK_E_MAX) {
+            CANRX_TriggerStackUsageMessage((SYSM_STACK_TASK_e)task);
+        }
+    }
+}
+
+static bool CANRX_CheckIfStackUsageIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    bool isRequested    = false;
+    uint64_t signalData = 0u;
+
+    /* get stack usage request bit from the CAN message */
+    CAN_RxGetSignalDataFromMessageData(
+        messageData,
+        CANRX_MUX_STACK_INFO_SIGNAL_TRIGGER_REQUEST_USAGE_START_BIT,
+        CANRX_MUX_STACK_INFO_SIGNAL_TRIGGER_REQUEST_USAGE_LENGTH,
+        &signalData,
+        endianness);
+    if (signalData == 1u) {
+        isRequested = true;
+    }
+    return isRequested;
+}
+
+static uint8_t CANRX_GetRequestedTask(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accepts whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    uint64_t signalData = 0u;
+
+    /* get the requested task from the CAN message */
+    CAN_RxGetSignalDataFromMessageData(
+        messageData,
+        CANRX_MUX_STACK_INFO_SIGNAL_TASK_START_BIT,
+        CANRX_MUX_STACK_INFO_SIGNAL_TASK_LENGTH,
+        &signalData,
+        endianness);
+    return (uint8_t)signalData;
+}
+
+static void CANRX_TriggerStackUsageMessage(SYSM_STACK_TASK_e task) {
+    FAS_ASSERT(task < SYSM_STACK_TASK_E_MAX);
+    /* send the debug message containing the stack usage and trap if this does not work */
+    if (CANTX_DebugResponseStackUsage(task) != STD_OK) {
+        FAS_ASSERT(FAS_TRAP);
+    }
+}
+
 /*========== Extern Function Implementations ================================*/
 extern uint32_t CANRX_Debug(
     CAN_MESSAGE_PROPERTIES_s message,
@@ -1053,6 +1574,21 @@ extern uint32_t CANRX_Debug(
             case CANRX_DEBUG_MESSAGE_MUX_VALUE_HARDWARE_IDENTIFICATION:
                 CANRX_ProcessIdentifyHardwareMux(messageData, message.endianness);
                 break;
+            case CANRX_DEBUG_MESSAGE_MUX_VALUE_LATENCY_INFO:
+                CANRX_ProcessLatencyInfoMux(messageData, message.endianness);
+                break;
+            case CANRX_DEBUG_MESSAGE_MUX_VALUE_KERNEL_TRACE:
+                CANRX_ProcessKernelTraceMux(messageData, message.endianness);
+                break;
+            case CANRX_DEBUG_MESSAGE_MUX_VALUE_MEMORY_POOL_INFO:
+                CANRX_ProcessMemoryPoolInfoMux(messageData, message.endianness);
+                break;
+            case CANRX_DEBUG_MESSAGE_MUX_VALUE_BUS_INFO:
+                CANRX_ProcessBusInfoMux(messageData, message.endianness);
+                break;
+            case CANRX_DEBUG_MESSAGE_MUX_VALUE_STACK_INFO:
+                CANRX_ProcessStackInfoMux(messageData, message.endianness);
+                break;
             default:
                 CANTX_DebugUnsupportedMultiplexerVal(message.id, (uint32_t)muxValue);
                 break;
@@ -1122,6 +1658,12 @@ extern void TEST_CANRX_TriggerBuildConfigurationMessage(void) {
 extern void TEST_CANRX_TriggerIdentifyHardwareMessage(void) {
     CANRX_TriggerIdentifyHardwareMessage();
 }
+extern void TEST_CANRX_TriggerLatencyStatisticsMessage(void) {
+    CANRX_TriggerLatencyStatisticsMessage();
+}
+extern void TEST_CANRX_TriggerMemoryPoolStatisticsMessage(void) {
+    CANRX_TriggerMemoryPoolStatisticsMessage();
+}
 
 /* export check if functions */
 extern bool TEST_CANRX_CheckIfBmsSoftwareVersionIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
@@ -1160,6 +1702,39 @@ extern bool TEST_CANRX_CheckIfBuildConfigurationIsRequested(uint64_t messageData
 extern bool TEST_CANRX_CheckIfIdentifyHardwareIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
     return CANRX_CheckIfIdentifyHardwareIsRequested(messageData, endianness);
 }
+extern bool TEST_CANRX_CheckIfLatencyStatisticsIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    return CANRX_CheckIfLatencyStatisticsIsRequested(messageData, endianness);
+}
+extern bool TEST_CANRX_CheckIfLatencyStatisticsResetIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    return CANRX_CheckIfLatencyStatisticsResetIsRequested(messageData, endianness);
+}
+extern bool TEST_CANRX_CheckIfKernelTraceSnapshotIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    return CANRX_CheckIfKernelTraceSnapshotIsRequested(messageData, endianness);
+}
+extern bool TEST_CANRX_CheckIfKernelTraceResumeIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    return CANRX_CheckIfKernelTraceResumeIsRequested(messageData, endianness);
+}
+extern bool TEST_CANRX_CheckIfMemoryPoolStatisticsIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    return CANRX_CheckIfMemoryPoolStatisticsIsRequested(messageData, endianness);
+}
+extern bool TEST_CANRX_CheckIfMemoryPoolStatisticsResetIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    return CANRX_CheckIfMemoryPoolStatisticsResetIsRequested(messageData, endianness);
+}
+extern bool TEST_CANRX_CheckIfBusStatisticsIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    return CANRX_CheckIfBusStatisticsIsRequested(messageData, endianness);
+}
+extern bool TEST_CANRX_CheckIfBusStatisticsResetIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    return CANRX_CheckIfBusStatisticsResetIsRequested(messageData, endianness);
+}
+extern uint8_t TEST_CANRX_GetRequestedBus(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    return CANRX_GetRequestedBus(messageData, endianness);
+}
+extern bool TEST_CANRX_CheckIfStackUsageIsRequested(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    return CANRX_CheckIfStackUsageIsRequested(messageData, endianness);
+}
+extern uint8_t TEST_CANRX_GetRequestedTask(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    return CANRX_GetRequestedTask(messageData, endianness);
+}
 
 /* export mux processing functions */
 extern void TEST_CANRX_ProcessVersionInformationMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
@@ -1183,5 +1758,20 @@ extern void TEST_CANRX_ProcessUptimeInfoMux(uint64_t messageData, CAN_ENDIANNESS
 extern void TEST_CANRX_ProcessIdentifyHardwareMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
     CANRX_ProcessIdentifyHardwareMux(messageData, endianness);
 }
+extern void TEST_CANRX_ProcessLatencyInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    CANRX_ProcessLatencyInfoMux(messageData, endianness);
+}
+extern void TEST_CANRX_ProcessKernelTraceMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    CANRX_ProcessKernelTraceMux(messageData, endianness);
+}
+extern void TEST_CANRX_ProcessMemoryPoolInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    CANRX_ProcessMemoryPoolInfoMux(messageData, endianness);
+}
+extern void TEST_CANRX_ProcessBusInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    CANRX_ProcessBusInfoMux(messageData, endianness);
+}
+extern void TEST_CANRX_ProcessStackInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    CANRX_ProcessStackInfoMux(messageData, endianness);
+}
 
 #endif
@@ -43,7 +43,7 @@
  * @file    can_cbs_tx_f_debug-response.c
  * @author  foxBMS Team
  * @date    2019-12-04 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  CANTX
@@ -67,7 +67,11 @@
 #include "foxmath.h"
 #include "fstd_types.h"
 #include "mcu.h"
+#include "mem_pool.h"
 #include "rtc.h"
+#include "sys_mon_bus.h"
+#include "sys_mon_latency.h"
+#include "sys_mon_stack.h"
 #include "utils.h"
 #include "version.h"
 
@@ -91,6 +95,12 @@
 #define CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_COMMIT_HASH_HIGH_7        (0x05u)
 #define CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_COMMIT_HASH_LOW_7         (0x06u)
 #define CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_UPTIME                    (0x07u)
+#define CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_LATENCY_STATISTICS        (0x08u)
+#define CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_MEMORY_POOL_STATISTICS    (0x09u)
+#define CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_BUS_UTILIZATION           (0x0Au)
+#define CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_BUS_CONTENTION            (0x0Bu)
+#define CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_BUS_WAIT_HISTOGRAM        (0x0Cu)
+#define CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_STACK_USAGE               (0x0Du)
 #define CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_BOOT_TIMESTAMP            (0x0Eu)
 #define CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_BOOT_INFORMATION          (0x0Fu)
 
@@ -158,6 +168,87 @@
 #define CANTX_MUX_OS_SIGNAL_DAY_LENGTH                      (5u)
 /** @} */
 
+/** @{
+ * configuration of the latency statistics signals for multiplexer
+ * 'LatencyStatistics' in the 'DebugResponse' message
+ */
+#define CANTX_MUX_LATENCY_SIGNAL_STAGE_START_BIT           (15u)
+#define CANTX_MUX_LATENCY_SIGNAL_STAGE_LENGTH              (4u)
+#define CANTX_MUX_LATENCY_SIGNAL_BUDGET_EXCEEDED_START_BIT (11u)
+#define CANTX_MUX_LATENCY_SIGNAL_BUDGET_EXCEEDED_LENGTH    (1u)
+#define CANTX_MUX_LATENCY_SIGNAL_MINIMUM_START_BIT         (23u)
+#define CANTX_MUX_LATENCY_SIGNAL_MINIMUM_LENGTH            (16u)
+#define CANTX_MUX_LATENCY_SIGNAL_MAXIMUM_START_BIT         (39u)
+#define CANTX_MUX_LATENCY_SIGNAL_MAXIMUM_LENGTH            (16u)
+#define CANTX_MUX_LATENCY_SIGNAL_LAST_START_BIT            (55u)
+#define CANTX_MUX_LATENCY_SIGNAL_LAST_LENGTH               (16u)
+/** @} */
+
+/** resolution of the latency signals (0.1ms) */
+#define CANTX_MUX_LATENCY_SIGNAL_RESOLUTION_us (100u)
+
+/** @{
+ * configuration of the memory pool statistics signals for multiplexer
+ * 'MemoryPoolStatistics' in the 'DebugResponse' message
+ */
+#define CANTX_MUX_MEMORY_POOL_SIGNAL_POOL_START_BIT               (15u)
+#define CANTX_MUX_MEMORY_POOL_SIGNAL_POOL_LENGTH                  (4u)
+#define CANTX_MUX_MEMORY_POOL_SIGNAL_BLOCKS_IN_USE_START_BIT      (23u)
+#define CANTX_MUX_MEMORY_POOL_SIGNAL_BLOCKS_IN_USE_LENGTH         (8u)
+#define CANTX_MUX_MEMORY_POOL_SIGNAL_PEAK_BLOCKS_IN_USE_START_BIT (31u)
+#define CANTX_MUX_MEMORY_POOL_SIGNAL_PEAK_BLOCKS_IN_USE_LENGTH    (8u)
+#define CANTX_MUX_MEMORY_POOL_SIGNAL_NUMBER_OF_BLOCKS_START_BIT   (39u)
+#define CANTX_MUX_MEMORY_POOL_SIGNAL_NUMBER_OF_BLOCKS_LENGTH      (8u)
+#define CANTX_MUX_MEMORY_POOL_SIGNAL_FAILED_ALLOCATIONS_START_BIT (47u)
+#define CANTX_MUX_MEMORY_POOL_SIGNAL_FAILED_ALLOCATIONS_LENGTH    (8u)
+#define CANTX_MUX_MEMORY_POOL_SIGNAL_LARGEST_REQUEST_START_BIT    (55u)
+#define CANTX_MUX_MEMORY_POOL_SIGNAL_LARGEST_REQUEST_LENGTH       (16u)
+/** @} */
+
+/** @{
+ * configuration of the bus statistics signals for the multiplexers
+ * 'BusUtilization', 'BusContention' and 'BusWaitHistogram' in the
+ * 'DebugResponse' message
+ */
+#define CANTX_MUX_BUS_SIGNAL_BUS_START_BIT             (15u)
+#define CANTX_MUX_BUS_SIGNAL_BUS_LENGTH                (4u)
+#define CANTX_MUX_BUS_SIGNAL_UTILIZATION_START_BIT     (23u)
+#define CANTX_MUX_BUS_SIGNAL_UTILIZATION_LENGTH        (16u)
+#define CANTX_MUX_BUS_SIGNAL_TRANSFER_RATE_START_BIT   (39u)
+#define CANTX_MUX_BUS_SIGNAL_TRANSFER_RATE_LENGTH      (16u)
+#define CANTX_MUX_BUS_SIGNAL_WORD_RATE_START_BIT       (55u)
+#define CANTX_MUX_BUS_SIGNAL_WORD_RATE_LENGTH          (16u)
+#define CANTX_MUX_BUS_SIGNAL_LOCK_REJECTIONS_START_BIT (23u)
+#define CANTX_MUX_BUS_SIGNAL_LOCK_REJECTIONS_LENGTH    (16u)
+#define CANTX_MUX_BUS_SIGNAL_BUSY_REJECTIONS_START_BIT (39u)
+#define CANTX_MUX_BUS_SIGNAL_BUSY_REJECTIONS_LENGTH    (16u)
+#define CANTX_MUX_BUS_SIGNAL_MAXIMUM_WAIT_START_BIT    (55u)
+#define CANTX_MUX_BUS_SIGNAL_MAXIMUM_WAIT_LENGTH       (16u)
+#define CANTX_MUX_BUS_SIGNAL_WAIT_BIN_0_START_BIT      (23u)
+#define CANTX_MUX_BUS_SIGNAL_WAIT_BIN_LENGTH           (8u)
+/** @} */
+
+/** @{
+ * configuration of the stack usage signals for multiplexer 'StackUsage' in
+ * the 'DebugResponse' message
+ */
+#define CANTX_MUX_STACK_SIGNAL_TASK_START_BIT           (15u)
+#define CANTX_MUX_STACK_SIGNAL_TASK_LENGTH              (4u)
+#define CANTX_MUX_STACK_SIGNAL_REGISTERED_START_BIT     (11u)
+#define CANTX_MUX_STACK_SIGNAL_REGISTERED_LENGTH        (CAN_BIT)
+#define CANTX_MUX_STACK_SIGNAL_LIMIT_EXCEEDED_START_BIT (10u)
+#define CANTX_MUX_STACK_SIGNAL_LIMIT_EXCEEDED_LENGTH    (CAN_BIT)
+#define CANTX_MUX_STACK_SIGNAL_STACK_SIZE_START_BIT     (23u)
+#define CANTX_MUX_STACK_SIGNAL_STACK_SIZE_LENGTH        (16u)
+#define CANTX_MUX_STACK_SIGNAL_MAXIMUM_USAGE_START_BIT  (39u)
+#define CANTX_MUX_STACK_SIGNAL_MAXIMUM_USAGE_LENGTH     (16u)
+/** @} */
+
+/* all bins of the wait time histogram have to fit into one message */
+FAS_STATIC_ASSERT(
+    ((CANTX_MUX_BUS_SIGNAL_WAIT_BIN_0_START_BIT + ((SYSM_BUS_WAIT_HISTOGRAM_BINS - 1u) * 8u)) < 64u),
+    "Wait time histogram does not fit into the message");
+
 /** maximum distance from release that can be encoded in the boot message */
 #define CANTX_BOOT_MESSAGE_MAXIMUM_RELEASE_DISTANCE (31u)
 #if CANTX_BOOT_MESSAGE_MAXIMUM_RELEASE_DISTANCE > UINT8_MAX
@@ -318,6 +409,92 @@ static uint64_t CANTX_TransmitCommitHashHigh(void);
  */
 static uint64_t CANTX_TransmitCommitHashLow(void);
 
+/**
+ * @brief   Converts a latency into the signal representation
+ * @details The signal has a resolution of 0.1ms and saturates at its maximum.
+ * @param   latency_us  latency in microseconds
+ * @return  signal value of the latency
+ */
+static uint16_t CANTX_ConvertLatencyToSignal(uint32_t latency_us);
+
+/**
+ * @brief   Transmit the latency statistics of one processing stage
+ * @param   stage   processing stage
+ * @return  message data for the can message
+ */
+static uint64_t CANTX_TransmitLatencyStatistics(SYSM_LATENCY_STAGE_e stage);
+
+/**
+ * @brief   Transmit the latency statistics of all processing stages, one
+ *          message per stage
+ * @return  #STD_OK if all messages were queued successfully, otherwise
+ *          #STD_NOT_OK
+ */
+static STD_RETURN_TYPE_e CANTX_TransmitAllLatencyStatistics(void);
+
+/**
+ * @brief   Limits a value to the largest value of an unsigned signal
+ * @param   value   value to be transmitted
+ * @param   length  length of the signal in bits (at most 16)
+ * @return  value, or the largest value of the signal if value is larger
+ */
+static uint64_t CANTX_SaturateToSignalLength(uint32_t value, uint8_t length);
+
+/**
+ * @brief   Transmit the usage statistics of one memory pool
+ * @param   poolId  memory pool
+ * @return  message data for the can message
+ */
+static uint64_t CANTX_TransmitMemoryPoolStatistics(MPOOL_ID_e poolId);
+
+/**
+ * @brief   Transmit the usage statistics of all memory pools, one message per
+ *          pool
+ * @return  #STD_OK if all messages were queued successfully, otherwise
+ *          #STD_NOT_OK
+ */
+static STD_RETURN_TYPE_e CANTX_TransmitAllMemoryPoolStatistics(void);
+
+/**
+ * @brief   Converts a number of events into a rate
+ * @param   count               number of events
+ * @param   observationTime_ms  time in which the events occurred
+ * @return  events per second, saturated at UINT32_MAX
+ */
+static uint32_t CANTX_ConvertToRatePerSecond(uint32_t count, uint32_t observationTime_ms);
+
+/**
+ * @brief   Transmit the utilization and throughput of one bus
+ * @param   bus             bus
+ * @param   pStatistics     statistics of the bus
+ * @return  message data for the can message
+ */
+static uint64_t CANTX_TransmitBusUtilization(SYSM_BUS_e bus, const SYSM_BUS_STATISTICS_s *pStatistics);
+
+/**
+ * @brief   Transmit the rejected accesses and the longest wait of one bus
+ * @param   bus             bus
+ * @param   pStatistics     statistics of the bus
+ * @return  message data for the can message
+ */
+static uint64_t CANTX_TransmitBusContention(SYSM_BUS_e bus, const SYSM_BUS_STATISTICS_s *pStatistics);
+
+/**
+ * @brief   Transmit the wait time histogram of one bus
+ * @param   bus             bus
+ * @param   pStatistics     statistics of the bus
+ * @return  message data for the can message
+ */
+static uint64_t CANTX_TransmitBusWaitHistogram(SYSM_BUS_e bus, const SYSM_BUS_STATISTICS_s *pStatistics);
+
+/**
+ * @brief   Transmit the stack usage of one task
+ * @param   task    task
+ * @param   pUsage  stack usage of the task
+ * @return  message data for the can message
+ */
+static uint64_t CANTX_TransmitStackUsage(SYSM_STACK_TASK_e task, const SYSM_STACK_USAGE_s *pUsage);
+
 /**
  * @brief Sets the can data and sends the message
  * @param messageData Data that will be transmitted with the can message
@@ -750,6 +927,315 @@ static uint64_t CANTX_TransmitCommitHashLow(void) {
     return message;
 }
 
+static uint16_t CANTX_ConvertLatencyToSignal(uint32_t latency_us) {
+    /* AXIVION Routine Generic-MissingParameterAssert: latency_us: parameter accepts whole range */
+    uint32_t signal = latency_us / CANTX_MUX_LATENCY_SIGNAL_RESOLUTION_us;
+    if (signal > UINT16_MAX) {
+        signal = UINT16_MAX;
+    }
+    return (uint16_t)signal;
+}
+
+static uint64_t CANTX_TransmitLatencyStatistics(SYSM_LATENCY_STAGE_e stage) {
+    FAS_ASSERT(stage < SYSM_LATENCY_STAGE_E_MAX);
+
+    SYSM_LATENCY_STATISTICS_s statistics = {0};
+    SYSM_GetLatencyStatistics(stage, &statistics);
+    uint64_t budgetExceeded = 0u;
+    if (SYSM_IsLatencyBudgetExceeded(stage) == true) {
+        budgetExceeded = 1u;
+    }
+
+    uint64_t message = 0u;
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_START_BIT,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_LENGTH,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_LATENCY_STATISTICS,
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_LATENCY_SIGNAL_STAGE_START_BIT,
+        CANTX_MUX_LATENCY_SIGNAL_STAGE_LENGTH,
+        (uint64_t)stage,
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_LATENCY_SIGNAL_BUDGET_EXCEEDED_START_BIT,
+        CANTX_MUX_LATENCY_SIGNAL_BUDGET_EXCEEDED_LENGTH,
+        budgetExceeded,
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_LATENCY_SIGNAL_MINIMUM_START_BIT,
+        CANTX_MUX_LATENCY_SIGNAL_MINIMUM_LENGTH,
+        CANTX_ConvertLatencyToSignal(statistics.minimum_us),
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_LATENCY_SIGNAL_MAXIMUM_START_BIT,
+        CANTX_MUX_LATENCY_SIGNAL_MAXIMUM_LENGTH,
+        CANTX_ConvertLatencyToSignal(statistics.maximum_us),
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_LATENCY_SIGNAL_LAST_START_BIT,
+        CANTX_MUX_LATENCY_SIGNAL_LAST_LENGTH,
+        CANTX_ConvertLatencyToSignal(statistics.last_us),
+        CAN_BIG_ENDIAN);
+
+    return message;
+}
+
+static STD_RETURN_TYPE_e CANTX_TransmitAllLatencyStatistics(void) {
+    STD_RETURN_TYPE_e successfullyQueued = STD_OK;
+    /* send one message per stage and stop at the first message that could not be queued */
+    for (uint8_t stage = 0u; stage < (uint8_t)SYSM_LATENCY_STAGE_E_MAX; stage++) {
+        if (successfullyQueued == STD_OK) {
+            const uint64_t messageData = CANTX_TransmitLatencyStatistics((SYSM_LATENCY_STAGE_e)stage);
+            successfullyQueued         = CANTX_DebugResponseSendMessage(messageData);
+        }
+    }
+    return successfullyQueued;
+}
+
+static uint64_t CANTX_SaturateToSignalLength(uint32_t value, uint8_t length) {
+    /* AXIVION Routine Generic-MissingParameterAssert: value: parameter accepts whole range */
+    FAS_ASSERT((length > 0u) && (length <= 16u));
+    const uint32_t maximum = (1uL << length) - 1u;
+    uint32_t signal        = value;
+    if (signal > maximum) {
+        signal = maximum;
+    }
+    return (uint64_t)signal;
+}
+
+static uint64_t CANTX_TransmitMemoryPoolStatistics(MPOOL_ID_e poolId) {
+    FAS_ASSERT(poolId < MPOOL_ID_E_MAX);
+
+    MPOOL_STATISTICS_s statistics = {0};
+    MPOOL_GetStatistics(poolId, &statistics);
+
+    uint64_t message = 0u;
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_START_BIT,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_LENGTH,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_MEMORY_POOL_STATISTICS,
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_MEMORY_POOL_SIGNAL_POOL_START_BIT,
+        CANTX_MUX_MEMORY_POOL_SIGNAL_POOL_LENGTH,
+        (uint64_t)poolId,
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_MEMORY_POOL_SIGNAL_BLOCKS_IN_USE_START_BIT,
+        CANTX_MUX_MEMORY_POOL_SIGNAL_BLOCKS_IN_USE_LENGTH,
+        CANTX_SaturateToSignalLength(statistics.blocksInUse, CANTX_MUX_MEMORY_POOL_SIGNAL_BLOCKS_IN_USE_LENGTH),
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_MEMORY_POOL_SIGNAL_PEAK_BLOCKS_IN_USE_START_BIT,
+        CANTX_MUX_MEMORY_POOL_SIGNAL_PEAK_BLOCKS_IN_USE_LENGTH,
+        CANTX_SaturateToSignalLength(
+            statistics.peakBlocksInUse, CANTX_MUX_MEMORY_POOL_SIGNAL_PEAK_BLOCKS_IN_USE_LENGTH),
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_MEMORY_POOL_SIGNAL_NUMBER_OF_BLOCKS_START_BIT,
+        CANTX_MUX_MEMORY_POOL_SIGNAL_NUMBER_OF_BLOCKS_LENGTH,
+        CANTX_SaturateToSignalLength(statistics.numberOfBlocks, CANTX_MUX_MEMORY_POOL_SIGNAL_NUMBER_OF_BLOCKS_LENGTH),
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_MEMORY_POOL_SIGNAL_FAILED_ALLOCATIONS_START_BIT,
+        CANTX_MUX_MEMORY_POOL_SIGNAL_FAILED_ALLOCATIONS_LENGTH,
+        CANTX_SaturateToSignalLength(
+            statistics.failedAllocations, CANTX_MUX_MEMORY_POOL_SIGNAL_FAILED_ALLOCATIONS_LENGTH),
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_MEMORY_POOL_SIGNAL_LARGEST_REQUEST_START_BIT,
+        CANTX_MUX_MEMORY_POOL_SIGNAL_LARGEST_REQUEST_LENGTH,
+        CANTX_SaturateToSignalLength(statistics.largestRequest_B, CANTX_MUX_MEMORY_POOL_SIGNAL_LARGEST_REQUEST_LENGTH),
+        CAN_BIG_ENDIAN);
+
+    return message;
+}
+
+static STD_RETURN_TYPE_e CANTX_TransmitAllMemoryPoolStatistics(void) {
+    STD_RETURN_TYPE_e successfullyQueued = STD_OK;
+    /* send one message per pool and stop at the first message that could not be queued */
+    for (uint8_t poolId = 0u; poolId < (uint8_t)MPOOL_ID_E_MAX; poolId++) {
+        if (successfullyQueued == STD_OK) {
+            const uint64_t messageData = CANTX_TransmitMemoryPoolStatistics((MPOOL_ID_e)poolId);
+            successfullyQueued         = CANTX_DebugResponseSendMessage(messageData);
+        }
+    }
+    return successfullyQueued;
+}
+
+static uint32_t CANTX_ConvertToRatePerSecond(uint32_t count, uint32_t observationTime_ms) {
+    /* AXIVION Routine Generic-MissingParameterAssert: count: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: observationTime_ms: parameter accepts whole range */
+    uint64_t rate = 0u;
+    if (observationTime_ms > 0u) {
+        rate = ((uint64_t)count * 1000u) / (uint64_t)observationTime_ms;
+    }
+    if (rate > UINT32_MAX) {
+        rate = UINT32_MAX;
+    }
+    return (uint32_t)rate;
+}
+
+static uint64_t CANTX_TransmitBusUtilization(SYSM_BUS_e bus, const SYSM_BUS_STATISTICS_s *pStatistics) {
+    FAS_ASSERT(bus < SYSM_BUS_E_MAX);
+    FAS_ASSERT(pStatistics != NULL_PTR);
+
+    const uint32_t transferRate =
+        CANTX_ConvertToRatePerSecond(pStatistics->numberOfTransfers, pStatistics->observationTime_ms);
+    const uint32_t wordRate = CANTX_ConvertToRatePerSecond(pStatistics->numberOfWords, pStatistics->observationTime_ms);
+
+    uint64_t message = 0u;
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_START_BIT,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_LENGTH,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_BUS_UTILIZATION,
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message, CANTX_MUX_BUS_SIGNAL_BUS_START_BIT, CANTX_MUX_BUS_SIGNAL_BUS_LENGTH, (uint64_t)bus, CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_BUS_SIGNAL_UTILIZATION_START_BIT,
+        CANTX_MUX_BUS_SIGNAL_UTILIZATION_LENGTH,
+        (uint64_t)pStatistics->utilization_perm,
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_BUS_SIGNAL_TRANSFER_RATE_START_BIT,
+        CANTX_MUX_BUS_SIGNAL_TRANSFER_RATE_LENGTH,
+        CANTX_SaturateToSignalLength(transferRate, CANTX_MUX_BUS_SIGNAL_TRANSFER_RATE_LENGTH),
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_BUS_SIGNAL_WORD_RATE_START_BIT,
+        CANTX_MUX_BUS_SIGNAL_WORD_RATE_LENGTH,
+        CANTX_SaturateToSignalLength(wordRate, CANTX_MUX_BUS_SIGNAL_WORD_RATE_LENGTH),
+        CAN_BIG_ENDIAN);
+
+    return message;
+}
+
+static uint64_t CANTX_TransmitBusContention(SYSM_BUS_e bus, const SYSM_BUS_STATISTICS_s *pStatistics) {
+    FAS_ASSERT(bus < SYSM_BUS_E_MAX);
+    FAS_ASSERT(pStatistics != NULL_PTR);
+
+    uint64_t message = 0u;
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_START_BIT,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_LENGTH,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_BUS_CONTENTION,
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message, CANTX_MUX_BUS_SIGNAL_BUS_START_BIT, CANTX_MUX_BUS_SIGNAL_BUS_LENGTH, (uint64_t)bus, CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_BUS_SIGNAL_LOCK_REJECTIONS_START_BIT,
+        CANTX_MUX_BUS_SIGNAL_LOCK_REJECTIONS_LENGTH,
+        CANTX_SaturateToSignalLength(pStatistics->numberOfLockRejections, CANTX_MUX_BUS_SIGNAL_LOCK_REJECTIONS_LENGTH),
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_BUS_SIGNAL_BUSY_REJECTIONS_START_BIT,
+        CANTX_MUX_BUS_SIGNAL_BUSY_REJECTIONS_LENGTH,
+        CANTX_SaturateToSignalLength(pStatistics->numberOfBusyRejections, CANTX_MUX_BUS_SIGNAL_BUSY_REJECTIONS_LENGTH),
+        CAN_BIG_ENDIAN);
+    /* same resolution as the latency signals */
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_BUS_SIGNAL_MAXIMUM_WAIT_START_BIT,
+        CANTX_MUX_BUS_SIGNAL_MAXIMUM_WAIT_LENGTH,
+        (uint64_t)CANTX_ConvertLatencyToSignal(pStatistics->maximumWaitTime_us),
+        CAN_BIG_ENDIAN);
+
+    return message;
+}
+
+static uint64_t CANTX_TransmitBusWaitHistogram(SYSM_BUS_e bus, const SYSM_BUS_STATISTICS_s *pStatistics) {
+    FAS_ASSERT(bus < SYSM_BUS_E_MAX);
+    FAS_ASSERT(pStatistics != NULL_PTR);
+
+    uint64_t message = 0u;
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_START_BIT,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_LENGTH,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_BUS_WAIT_HISTOGRAM,
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message, CANTX_MUX_BUS_SIGNAL_BUS_START_BIT, CANTX_MUX_BUS_SIGNAL_BUS_LENGTH, (uint64_t)bus, CAN_BIG_ENDIAN);
+    /* one byte per bin, starting with the shortest waits */
+    for (uint8_t bin = 0u; bin < (uint8_t)SYSM_BUS_WAIT_HISTOGRAM_BINS; bin++) {
+        CAN_TxSetMessageDataWithSignalData(
+            &message,
+            CANTX_MUX_BUS_SIGNAL_WAIT_BIN_0_START_BIT + (bin * CANTX_MUX_BUS_SIGNAL_WAIT_BIN_LENGTH),
+            CANTX_MUX_BUS_SIGNAL_WAIT_BIN_LENGTH,
+            CANTX_SaturateToSignalLength(pStatistics->waitHistogram[bin], CANTX_MUX_BUS_SIGNAL_WAIT_BIN_LENGTH),
+            CAN_BIG_ENDIAN);
+    }
+
+    return message;
+}
+
+static uint64_t CANTX_TransmitStackUsage(SYSM_STACK_TASK_e task, const SYSM_STACK_USAGE_s *pUsage) {
+    FAS_ASSERT(task < SYSM_STACK_TASK_E_MAX);
+    FAS_ASSERT(pUsage != NULL_PTR);
+
+    uint64_t message = 0u;
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_START_BIT,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_LENGTH,
+        CANTX_DEBUG_RESPONSE_MESSAGE_MUX_VALUE_STACK_USAGE,
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_STACK_SIGNAL_TASK_START_BIT,
+        CANTX_MUX_STACK_SIGNAL_TASK_LENGTH,
+        (uint64_t)task,
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_STACK_SIGNAL_REGISTERED_START_BIT,
+        CANTX_MUX_STACK_SIGNAL_REGISTERED_LENGTH,
+        (pUsage->isRegistered == true) ? 1u : 0u,
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_STACK_SIGNAL_LIMIT_EXCEEDED_START_BIT,
+        CANTX_MUX_STACK_SIGNAL_LIMIT_EXCEEDED_LENGTH,
+        (pUsage->isLimitExceeded == true) ? 1u : 0u,
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_STACK_SIGNAL_STACK_SIZE_START_BIT,
+        CANTX_MUX_STACK_SIGNAL_STACK_SIZE_LENGTH,
+        CANTX_SaturateToSignalLength(pUsage->stackSize_B, CANTX_MUX_STACK_SIGNAL_STACK_SIZE_LENGTH),
+        CAN_BIG_ENDIAN);
+    CAN_TxSetMessageDataWithSignalData(
+        &message,
+        CANTX_MUX_STACK_SIGNAL_MAXIMUM_USAGE_START_BIT,
+        CANTX_MUX_STACK_SIGNAL_MAXIMUM_USAGE_LENGTH,
+        CANTX_SaturateToSignalLength(pUsage->maximumUsage_B, CANTX_MUX_STACK_SIGNAL_MAXIMUM_USAGE_LENGTH),
+        CAN_BIG_ENDIAN);
+
+    return message;
+}
+
 static STD_RETURN_TYPE_e CANTX_DebugResponseSendMessage(uint64_t messageData) {
     /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accept whole range */
     uint8_t data[] = {GEN_REPEAT_U(0u, GEN_STRIP(CAN_MAX_DLC))};
@@ -796,16 +1282,52 @@ extern STD_RETURN_TYPE_e CANTX_DebugResponse(CANTX_DEBUG_RESPONSE_ACTIONS_e acti
         case CANTX_DEBUG_RESPONSE_TRANSMIT_COMMIT_HASH:
             successfullyQueued = CANTX_TransmitCommitHash();
             break;
+        case CANTX_DEBUG_RESPONSE_TRANSMIT_LATENCY_STATISTICS:
+            successfullyQueued = CANTX_TransmitAllLatencyStatistics();
+            break;
+        case CANTX_DEBUG_RESPONSE_TRANSMIT_MEMORY_POOL_STATISTICS:
+            successfullyQueued = CANTX_TransmitAllMemoryPoolStatistics();
+            break;
         default:
             FAS_ASSERT(FAS_TRAP);
             break; /* LCOV_EXCL_LINE */
     }
-    if (action != CANTX_DEBUG_RESPONSE_TRANSMIT_COMMIT_HASH) {
+    if ((action != CANTX_DEBUG_RESPONSE_TRANSMIT_COMMIT_HASH) &&
+        (action != CANTX_DEBUG_RESPONSE_TRANSMIT_LATENCY_STATISTICS) &&
+        (action != CANTX_DEBUG_RESPONSE_TRANSMIT_MEMORY_POOL_STATISTICS)) {
         successfullyQueued = CANTX_DebugResponseSendMessage(messageData);
     }
     return successfullyQueued;
 }
 
+extern STD_RETURN_TYPE_e CANTX_DebugResponseBusStatistics(SYSM_BUS_e bus) {
+    FAS_ASSERT(bus < SYSM_BUS_E_MAX);
+
+    /* all messages are built from the same snapshot of the statistics */
+    SYSM_BUS_STATISTICS_s statistics = {0};
+    SYSM_GetBusStatistics(bus, &statistics);
+
+    /* stop at the first message that could not be queued */
+    STD_RETURN_TYPE_e successfullyQueued =
+        CANTX_DebugResponseSendMessage(CANTX_TransmitBusUtilization(bus, &statistics));
+    if (successfullyQueued == STD_OK) {
+        successfullyQueued = CANTX_DebugResponseSendMessage(CANTX_TransmitBusContention(bus, &statistics));
+    }
+    if (successfullyQueued == STD_OK) {
+        successfullyQueued = CANTX_DebugResponseSendMessage(CANTX_TransmitBusWaitHistogram(bus, &statistics));
+    }
+    return successfullyQueued;
+}
+
+extern STD_RETURN_TYPE_e CANTX_DebugResponseStackUsage(SYSM_STACK_TASK_e task) {
+    FAS_ASSERT(task < SYSM_STACK_TASK_E_MAX);
+
+    SYSM_STACK_USAGE_s usage = {0};
+    SYSM_GetStackUsage(task, &usage);
+
+    return CANTX_DebugResponseSendMessage(CANTX_TransmitStackUsage(task, &usage));
+}
+
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
 extern uint64_t TEST_CANTX_TransmitBmsVersionInfo(void) {
@@ -850,4 +1372,31 @@ extern uint64_t TEST_CANTX_TransmitCommitHashHigh(void) {
 extern STD_RETURN_TYPE_e TEST_CANTX_DebugResponseSendMessage(uint64_t messageData) {
     return CANTX_DebugResponseSendMessage(messageData);
 }
+extern uint16_t TEST_CANTX_ConvertLatencyToSignal(uint32_t latency_us) {
+    return CANTX_ConvertLatencyToSignal(latency_us);
+}
+extern STD_RETURN_TYPE_e TEST_CANTX_TransmitAllLatencyStatistics(void) {
+    return CANTX_TransmitAllLatencyStatistics();
+}
+extern uint64_t TEST_CANTX_SaturateToSignalLength(uint32_t value, uint8_t length) {
+    return CANTX_SaturateToSignalLength(value, length);
+}
+extern STD_RETURN_TYPE_e TEST_CANTX_TransmitAllMemoryPoolStatistics(void) {
+    return CANTX_TransmitAllMemoryPoolStatistics();
+}
+extern uint32_t TEST_CANTX_ConvertToRatePerSecond(uint32_t count, uint32_t observationTime_ms) {
+    return CANTX_ConvertToRatePerSecond(count, observationTime_ms);
+}
+extern uint64_t TEST_CANTX_TransmitBusUtilization(SYSM_BUS_e bus, const SYSM_BUS_STATISTICS_s *pStatistics) {
+    return CANTX_TransmitBusUtilization(bus, pStatistics);
+}
+extern uint64_t TEST_CANTX_TransmitBusContention(SYSM_BUS_e bus, const SYSM_BUS_STATISTICS_s *pStatistics) {
+    return CANTX_TransmitBusContention(bus, pStatistics);
+}
+extern uint64_t TEST_CANTX_TransmitBusWaitHistogram(SYSM_BUS_e bus, const SYSM_BUS_STATISTICS_s *pStatistics) {
+    return CANTX_TransmitBusWaitHistogram(bus, pStatistics);
+}
+extern uint64_t TEST_CANTX_TransmitStackUsage(SYSM_STACK_TASK_e task, const SYSM_STACK_USAGE_s *pUsage) {
+    return CANTX_TransmitStackUsage(task, pUsage);
+}
 #endif
@@ -43,7 +43,7 @@
  * @file    can_cbs_tx_f_debug-response.h
  * @author  foxBMS Team
  * @date    2022-07-01 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  CANTX
@@ -61,6 +61,9 @@
 
 #include "fstd_types.h"
 
+#include "sys_mon_bus.h"
+#include "sys_mon_stack.h"
+
 /*========== Macros and Definitions =========================================*/
 /** defines which action is performed when #CANTX_DebugResponse is called */
 typedef enum {
@@ -74,6 +77,8 @@ typedef enum {
     CANTX_DEBUG_RESPONSE_TRANSMIT_UPTIME,
     CANTX_DEBUG_RESPONSE_TRANSMIT_COMMIT_HASH,
     CANTX_DEBUG_RESPONSE_TRANSMIT_BOOT_TIMESTAMP,
+    CANTX_DEBUG_RESPONSE_TRANSMIT_LATENCY_STATISTICS,
+    CANTX_DEBUG_RESPONSE_TRANSMIT_MEMORY_POOL_STATISTICS,
 } CANTX_DEBUG_RESPONSE_ACTIONS_e;
 
 /*========== Extern Constant and Variable Declarations ======================*/
@@ -87,6 +92,26 @@ typedef enum {
  */
 extern STD_RETURN_TYPE_e CANTX_DebugResponse(CANTX_DEBUG_RESPONSE_ACTIONS_e action);
 
+/**
+ * @brief   Sends the statistics of one bus as debug response messages
+ * @details The statistics are sent in three messages (utilization,
+ *          contention and wait time histogram). They are requested per bus,
+ *          as the messages of all buses would not fit into the transmit
+ *          queue at once.
+ * @param   bus bus of which the statistics are sent
+ * @return  #STD_OK if all messages were queued successfully, otherwise
+ *          #STD_NOT_OK
+ */
+extern STD_RETURN_TYPE_e CANTX_DebugResponseBusStatistics(SYSM_BUS_e bus);
+
+/**
+ * @brief   Sends the stack usage of one task as debug response message
+ * @param   task    task of which the stack usage is sent
+ * @return  #STD_OK if the message was queued successfully, otherwise
+ *          #STD_NOT_OK
+ */
+extern STD_RETURN_TYPE_e CANTX_DebugResponseStackUsage(SYSM_STACK_TASK_e task);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
 extern uint64_t TEST_CANTX_TransmitBmsVersionInfo(void);
@@ -103,6 +128,15 @@ extern STD_RETURN_TYPE_e TEST_CANTX_TransmitCommitHash(void);
 extern uint64_t TEST_CANTX_TransmitCommitHashLow(void);
 extern uint64_t TEST_CANTX_TransmitCommitHashHigh(void);
 extern uint64_t TEST_CANTX_GetSevenChars(char *string, uint8_t stringLength, uint8_t startChar);
+extern uint16_t TEST_CANTX_ConvertLatencyToSignal(uint32_t latency_us);
+extern STD_RETURN_TYPE_e TEST_CANTX_TransmitAllLatencyStatistics(void);
+extern uint64_t TEST_CANTX_SaturateToSignalLength(uint32_t value, uint8_t length);
+extern STD_RETURN_TYPE_e TEST_CANTX_TransmitAllMemoryPoolStatistics(void);
+extern uint32_t TEST_CANTX_ConvertToRatePerSecond(uint32_t count, uint32_t observationTime_ms);
+extern uint64_t TEST_CANTX_TransmitBusUtilization(SYSM_BUS_e bus, const SYSM_BUS_STATISTICS_s *pStatistics);
+extern uint64_t TEST_CANTX_TransmitBusContention(SYSM_BUS_e bus, const SYSM_BUS_STATISTICS_s *pStatistics);
+extern uint64_t TEST_CANTX_TransmitBusWaitHistogram(SYSM_BUS_e bus, const SYSM_BUS_STATISTICS_s *pStatistics);
+extern uint64_t TEST_CANTX_TransmitStackUsage(SYSM_STACK_TASK_e task, const SYSM_STACK_USAGE_s *pUsage);
 extern STD_RETURN_TYPE_e TEST_CANTX_DebugResponseSendMessage(uint64_t messageData);
 #endif
 
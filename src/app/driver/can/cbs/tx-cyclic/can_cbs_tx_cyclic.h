@@ -60,6 +60,7 @@
 #include "can_cfg.h"
 
 #ifdef UNITY_UNIT_TEST
+#include "can_cfg_tx-cyclic-message-definitions.h"
 #include "can_helper.h"
 #include "sys_mon.h"
 #endif
@@ -107,10 +108,13 @@ extern uint32_t CANTX_BmsStateDetails(
 
 /**
  * @brief   CAN Tx callback function for cell voltages
+ * @details The transmission order depends on #CANTX_CELL_BROADCAST_POLICY.
  * @param[in] message     contains the message ID, DLC and endianness
  * @param[in] pCanData    payload of can frame
  * @param[in] pMuxId      multiplexer for multiplexed CAN messages
  * @param[in] kpkCanShim  shim to the database entries
+ * @return  number of further frames of the current sweep that should be sent
+ *          in the same tick (always 0 for the round-robin policy)
  */
 extern uint32_t CANTX_CellVoltages(
     CAN_MESSAGE_PROPERTIES_s message,
@@ -120,10 +124,13 @@ extern uint32_t CANTX_CellVoltages(
 
 /**
  * @brief   CAN Tx callback function for cell temperatures
+ * @details The transmission order depends on #CANTX_CELL_BROADCAST_POLICY.
  * @param[in] message     contains the message ID, DLC and endianness
  * @param[in] pCanData    payload of can frame
  * @param[in] pMuxId      multiplexer for multiplexed CAN messages
  * @param[in] kpkCanShim  shim to the database entries
+ * @return  number of further frames of the current sweep that should be sent
+ *          in the same tick (always 0 for the round-robin policy)
  */
 extern uint32_t CANTX_CellTemperatures(
     CAN_MESSAGE_PROPERTIES_s message,
@@ -337,6 +344,15 @@ extern void TEST_CANTX_TemperatureSetData(
     CAN_SIGNAL_TYPE_s cellTemperatureInvalidFlagSignal,
     CAN_ENDIANNESS_e endianness,
     const CAN_SHIM_s *const kpkCanShim);
+#if (CANTX_CELL_BROADCAST_POLICY == CANTX_CELL_BROADCAST_POLICY_ADAPTIVE)
+extern bool TEST_CANTX_IsCellTemperaturePrioritized(
+    int16_t temperature_ddegC,
+    int16_t previousTemperature_ddegC,
+    int16_t minimum_ddegC,
+    int16_t maximum_ddegC);
+extern uint8_t TEST_CANTX_PlanCellTemperatureSweep(const CAN_SHIM_s *const kpkCanShim);
+extern uint8_t *TEST_CANTX_GetCellTemperatureSweepOrder(void);
+#endif
 
 /* externalized functions from src/app/driver/can/cbs/tx-cyclic/can_cbs_tx_cell-voltages.c */
 extern void TEST_CANTX_VoltageSetData(
@@ -346,6 +362,15 @@ extern void TEST_CANTX_VoltageSetData(
     CAN_SIGNAL_TYPE_s cellVoltageInvalidFlagSignal,
     CAN_ENDIANNESS_e endianness,
     const CAN_SHIM_s *const kpkCanShim);
+#if (CANTX_CELL_BROADCAST_POLICY == CANTX_CELL_BROADCAST_POLICY_ADAPTIVE)
+extern bool TEST_CANTX_IsCellVoltagePrioritized(
+    int16_t voltage_mV,
+    int16_t previousVoltage_mV,
+    int16_t minimum_mV,
+    int16_t maximum_mV);
+extern uint8_t TEST_CANTX_PlanCellVoltageSweep(const CAN_SHIM_s *const kpkCanShim);
+extern uint8_t *TEST_CANTX_GetCellVoltageSweepOrder(void);
+#endif
 
 /* externalized functions from src/app/driver/can/cbs/tx-cyclic/can_cbs_tx_pack-limits.c */
 extern uint64_t TEST_CANTX_CalculateMaximumDischargeCurrent(const CAN_SHIM_s *const kpkCanShim);
@@ -339,7 +339,6 @@ extern uint32_t CANTX_BmsStateDetails(
     FAS_ASSERT(kpkCanShim != NULL_PTR);
     uint64_t messageData = 0u;
 
-    DATA_READ_DATA(kpkCanShim->pTableErrorState);
     SYSM_TIMING_VIOLATION_RESPONSE_s recordedTimingViolations = {false, false, false, false, false, false};
     SYSM_GetRecordedTimingViolations(&recordedTimingViolations);
 
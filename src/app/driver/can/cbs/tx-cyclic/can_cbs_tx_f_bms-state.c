@@ -438,13 +438,6 @@ extern uint32_t CANTX_BmsState(
     FAS_ASSERT(kpkCanShim != NULL_PTR);
     uint64_t messageData = 0u;
 
-    DATA_READ_DATA(
-        kpkCanShim->pTableErrorState,
-        kpkCanShim->pTableInsulation,
-        kpkCanShim->pTableMsl,
-        kpkCanShim->pTableBalancingControl);
-    DATA_READ_DATA(kpkCanShim->pTablePhy);
-
     CANTX_BuildBmsStateMessage(&messageData, kpkCanShim);
 
     /* now copy data in the buffer that will be use to send data */
@@ -463,6 +456,11 @@ extern STD_RETURN_TYPE_e CANTX_TransmitBmsState(void) {
 
     uint8_t canData[CANTX_BMS_STATE_DLC] = {0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u};
 
+    /* outside of the periodic transmission the database tables have to be read here */
+    DATA_READ_DATA(
+        can_kShim.pTableErrorState, can_kShim.pTableInsulation, can_kShim.pTableMsl, can_kShim.pTableBalancingControl);
+    DATA_READ_DATA(can_kShim.pTablePhy);
+
     CANTX_BmsState(message, canData, NULL_PTR, &can_kShim);
 
     return CAN_DataSend(CAN_NODE_1, message.id, message.idType, canData);
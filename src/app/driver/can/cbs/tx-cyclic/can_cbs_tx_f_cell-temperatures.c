@@ -43,7 +43,7 @@
  * @file    can_cbs_tx_f_cell-temperatures.c
  * @author  foxBMS Team
  * @date    2021-04-20 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  CANTX
@@ -58,9 +58,11 @@
 #include "can_cbs_tx_cyclic.h"
 #include "can_cfg_tx-cyclic-message-definitions.h"
 #include "can_helper.h"
+#include "fbitset.h"
 #include "foxmath.h"
 
 #include <math.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
@@ -198,6 +200,17 @@ static const CAN_SIGNAL_TYPE_s cantx_cell5Temperature_degC = {
     CANTX_MINIMUM_VALUE_TEMPERATURE,
     CANTX_MAXIMUM_VALUE_TEMPERATURE};
 
+#if (CANTX_CELL_BROADCAST_POLICY == CANTX_CELL_BROADCAST_POLICY_ADAPTIVE)
+/** transmission order (multiplexer values) of the frames in the current sweep */
+static uint8_t cantx_cellTemperatureSweepOrder[CANTX_NUMBER_OF_CAN_MESSAGES_FOR_CELL_TEMPERATURES] = {0u};
+/** cell temperatures that have been transmitted in the previous sweep */
+static int16_t cantx_previousCellTemperature_ddegC[BS_NR_OF_TEMP_SENSORS] = {0};
+/** database timestamp of the cell temperatures transmitted in the previous sweep */
+static uint32_t cantx_previousCellTemperatureTimestamp = 0u;
+/** true if the current sweep is transmitted as burst */
+static bool cantx_cellTemperatureBurstActive = false;
+#endif
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
@@ -223,6 +236,37 @@ static void CANTX_TemperatureSetData(
     CAN_ENDIANNESS_e endianness,
     const CAN_SHIM_s *const kpkCanShim);
 
+#if (CANTX_CELL_BROADCAST_POLICY == CANTX_CELL_BROADCAST_POLICY_ADAPTIVE)
+/**
+ * @brief   Checks if a cell temperature needs to be transmitted early in a
+ *          sweep
+ * @param   temperature_ddegC          current cell temperature
+ * @param   previousTemperature_ddegC  cell temperature transmitted in the
+ *                                     previous sweep
+ * @param   minimum_ddegC              minimum of all valid cell temperatures
+ * @param   maximum_ddegC              maximum of all valid cell temperatures
+ * @return  true if the temperature changed by more than
+ *          #CANTX_CELL_TEMPERATURES_DEADBAND_ddegC or is within
+ *          #CANTX_CELL_TEMPERATURES_EXTREMUM_MARGIN_ddegC of the minimum or
+ *          maximum, false otherwise
+ */
+static bool CANTX_IsCellTemperaturePrioritized(
+    int16_t temperature_ddegC,
+    int16_t previousTemperature_ddegC,
+    int16_t minimum_ddegC,
+    int16_t maximum_ddegC);
+
+/**
+ * @brief   Plans the transmission order of the next cell temperature sweep
+ * @details Same ordering as for the cell voltages: frames with at least one
+ *          prioritized temperature (see #CANTX_IsCellTemperaturePrioritized)
+ *          first, then all other frames, both in ascending multiplexer order.
+ * @param[in] kpkCanShim  shim to the database entries
+ * @return  number of prioritized frames at the beginning of the sweep
+ */
+static uint8_t CANTX_PlanCellTemperatureSweep(const CAN_SHIM_s *const kpkCanShim);
+#endif
+
 /*========== Static Function Implementations ================================*/
 
 static void CANTX_TemperatureSetData(
@@ -271,7 +315,9 @@ static void CANTX_TemperatureSetData(
 
     uint32_t signalDataIsValid;
     /* Valid bits data */
-    if (kpkCanShim->pTableCellTemperature->invalidCellTemperature[stringNumber][moduleNumber][sensorNumber] == false) {
+    if (BITSET_IsBitSet(
+            kpkCanShim->pTableCellTemperature->invalidCellTemperature[stringNumber][moduleNumber], sensorNumber) ==
+        false) {
         signalDataIsValid = 1u;
     } else {
         signalDataIsValid = 0u;
@@ -298,6 +344,95 @@ static void CANTX_TemperatureSetData(
         endianness);
 }
 
+#if (CANTX_CELL_BROADCAST_POLICY == CANTX_CELL_BROADCAST_POLICY_ADAPTIVE)
+static bool CANTX_IsCellTemperaturePrioritized(
+    int16_t temperature_ddegC,
+    int16_t previousTemperature_ddegC,
+    int16_t minimum_ddegC,
+    int16_t maximum_ddegC) {
+    /* AXIVION Routine Generic-MissingParameterAssert: temperature_ddegC: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: previousTemperature_ddegC: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: minimum_ddegC: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: maximum_ddegC: parameter accepts whole range */
+    bool isPrioritized         = false;
+    const int32_t change_ddegC = (int32_t)temperature_ddegC - (int32_t)previousTemperature_ddegC;
+    if ((change_ddegC > CANTX_CELL_TEMPERATURES_DEADBAND_ddegC) ||
+        (change_ddegC < -CANTX_CELL_TEMPERATURES_DEADBAND_ddegC)) {
+        isPrioritized = true;
+    }
+    if (((int32_t)temperature_ddegC - (int32_t)minimum_ddegC) <= CANTX_CELL_TEMPERATURES_EXTREMUM_MARGIN_ddegC) {
+        isPrioritized = true;
+    }
+    if (((int32_t)maximum_ddegC - (int32_t)temperature_ddegC) <= CANTX_CELL_TEMPERATURES_EXTREMUM_MARGIN_ddegC) {
+        isPrioritized = true;
+    }
+    return isPrioritized;
+}
+
+static uint8_t CANTX_PlanCellTemperatureSweep(const CAN_SHIM_s *const kpkCanShim) {
+    FAS_ASSERT(kpkCanShim != NULL_PTR);
+    const DATA_BLOCK_CELL_TEMPERATURE_s *const kpkTable = kpkCanShim->pTableCellTemperature;
+
+    /* minimum and maximum of all valid cell temperatures */
+    int16_t minimum_ddegC = INT16_MAX;
+    int16_t maximum_ddegC = INT16_MIN;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
+                if (BITSET_IsBitSet(kpkTable->invalidCellTemperature[s][m], ts) == false) {
+                    if (kpkTable->cellTemperature_ddegC[s][m][ts] < minimum_ddegC) {
+                        minimum_ddegC = kpkTable->cellTemperature_ddegC[s][m][ts];
+                    }
+                    if (kpkTable->cellTemperature_ddegC[s][m][ts] > maximum_ddegC) {
+                        maximum_ddegC = kpkTable->cellTemperature_ddegC[s][m][ts];
+                    }
+                }
+            }
+        }
+    }
+
+    /* the sensor index runs in the same order as in DATA_GetStringNumberFromTemperatureIndex() and friends */
+    bool isFramePrioritized[CANTX_NUMBER_OF_CAN_MESSAGES_FOR_CELL_TEMPERATURES] = {false};
+    uint16_t temperatureSensorId                                                = 0u;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint8_t ts = 0u; (ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE) &&
+                                  (temperatureSensorId < BS_NR_OF_TEMP_SENSORS);
+                 ts++) {
+                const int16_t temperature_ddegC = kpkTable->cellTemperature_ddegC[s][m][ts];
+                if ((BITSET_IsBitSet(kpkTable->invalidCellTemperature[s][m], ts) == false) &&
+                    (CANTX_IsCellTemperaturePrioritized(
+                         temperature_ddegC,
+                         cantx_previousCellTemperature_ddegC[temperatureSensorId],
+                         minimum_ddegC,
+                         maximum_ddegC) == true)) {
+                    isFramePrioritized[temperatureSensorId / CANTX_NUMBER_OF_MUX_TEMPERATURES_PER_MESSAGE] = true;
+                }
+                cantx_previousCellTemperature_ddegC[temperatureSensorId] = temperature_ddegC;
+                temperatureSensorId++;
+            }
+        }
+    }
+
+    /* prioritized frames first, all other frames afterwards */
+    uint8_t position = 0u;
+    for (uint8_t muxValue = 0u; muxValue < CANTX_NUMBER_OF_CAN_MESSAGES_FOR_CELL_TEMPERATURES; muxValue++) {
+        if (isFramePrioritized[muxValue] == true) {
+            cantx_cellTemperatureSweepOrder[position] = muxValue;
+            position++;
+        }
+    }
+    const uint8_t numberOfPrioritizedFrames = position;
+    for (uint8_t muxValue = 0u; muxValue < CANTX_NUMBER_OF_CAN_MESSAGES_FOR_CELL_TEMPERATURES; muxValue++) {
+        if (isFramePrioritized[muxValue] == false) {
+            cantx_cellTemperatureSweepOrder[position] = muxValue;
+            position++;
+        }
+    }
+    return numberOfPrioritizedFrames;
+}
+#endif
+
 /*========== Extern Function Implementations ================================*/
 extern uint32_t CANTX_CellTemperatures(
     CAN_MESSAGE_PROPERTIES_s message,
@@ -311,26 +446,45 @@ extern uint32_t CANTX_CellTemperatures(
     FAS_ASSERT(pCanData != NULL_PTR);
     FAS_ASSERT(pMuxId != NULL_PTR);
     FAS_ASSERT(kpkCanShim != NULL_PTR);
-    uint64_t messageData = 0u;
+    uint64_t messageData     = 0u;
+    uint32_t framesRequested = 0u;
 
+#if (CANTX_CELL_BROADCAST_POLICY == CANTX_CELL_BROADCAST_POLICY_ADAPTIVE)
+    /* pMuxId is the position in the sweep; start a new sweep if the previous one is complete */
+    if ((*pMuxId == 0u) || (*pMuxId >= CANTX_NUMBER_OF_CAN_MESSAGES_FOR_CELL_TEMPERATURES)) {
+        *pMuxId = 0u;
+        DATA_READ_DATA(kpkCanShim->pTableCellTemperature);
+        (void)CANTX_PlanCellTemperatureSweep(kpkCanShim);
+        /* burst the sweep if the database contains a new measurement */
+        if (kpkCanShim->pTableCellTemperature->header.timestamp != cantx_previousCellTemperatureTimestamp) {
+            cantx_cellTemperatureBurstActive = true;
+        } else {
+            cantx_cellTemperatureBurstActive = false;
+        }
+        cantx_previousCellTemperatureTimestamp = kpkCanShim->pTableCellTemperature->header.timestamp;
+    }
+    const uint8_t muxValue = cantx_cellTemperatureSweepOrder[*pMuxId];
+#else
     /* Reset mux if maximum was reached */
     if (*pMuxId >= CANTX_NUMBER_OF_CAN_MESSAGES_FOR_CELL_TEMPERATURES) {
         *pMuxId = 0u;
         /* first signal to transmit cell temperatures: get database values */
         DATA_READ_DATA(kpkCanShim->pTableCellTemperature);
     }
+    const uint8_t muxValue = *pMuxId;
+#endif
 
     /* Set mux signal in CAN frame */
     CAN_TxSetMessageDataWithSignalData(
         &messageData,
         cantx_cellTemperatureMultiplexer.bitStart,
         cantx_cellTemperatureMultiplexer.bitLength,
-        (uint64_t)*pMuxId,
+        (uint64_t)muxValue,
         message.endianness);
 
     /* Set other signals in CAN frame */
     /* Calculate the global temperature sensor ID based on the multiplexer value for the first temperature sensor */
-    uint16_t temperatureSensorId = (*pMuxId * CANTX_NUMBER_OF_MUX_TEMPERATURES_PER_MESSAGE);
+    uint16_t temperatureSensorId = (muxValue * CANTX_NUMBER_OF_MUX_TEMPERATURES_PER_MESSAGE);
     CANTX_TemperatureSetData(
         temperatureSensorId,
         &messageData,
@@ -393,10 +547,17 @@ extern uint32_t CANTX_CellTemperatures(
     /* Increment multiplexer for next cell */
     (*pMuxId)++;
 
+#if (CANTX_CELL_BROADCAST_POLICY == CANTX_CELL_BROADCAST_POLICY_ADAPTIVE)
+    /* request the rest of the sweep in the same tick */
+    if (cantx_cellTemperatureBurstActive == true) {
+        framesRequested = (uint32_t)CANTX_NUMBER_OF_CAN_MESSAGES_FOR_CELL_TEMPERATURES - (uint32_t)*pMuxId;
+    }
+#endif
+
     /* All signal data copied in CAN frame, now copy data in the buffer that will be use to send the frame */
     CAN_TxSetCanDataWithMessageData(messageData, pCanData, message.endianness);
 
-    return 0u;
+    return framesRequested;
 }
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -411,4 +572,20 @@ extern void TEST_CANTX_TemperatureSetData(
     CANTX_TemperatureSetData(
         temperatureSensorId, pMessage, cellTemperatureSignal, cellTemperatureInvalidFlagSignal, endianness, kpkCanShim);
 }
+#if (CANTX_CELL_BROADCAST_POLICY == CANTX_CELL_BROADCAST_POLICY_ADAPTIVE)
+extern bool TEST_CANTX_IsCellTemperaturePrioritized(
+    int16_t temperature_ddegC,
+    int16_t previousTemperature_ddegC,
+    int16_t minimum_ddegC,
+    int16_t maximum_ddegC) {
+    return CANTX_IsCellTemperaturePrioritized(
+        temperature_ddegC, previousTemperature_ddegC, minimum_ddegC, maximum_ddegC);
+}
+extern uint8_t TEST_CANTX_PlanCellTemperatureSweep(const CAN_SHIM_s *const kpkCanShim) {
+    return CANTX_PlanCellTemperatureSweep(kpkCanShim);
+}
+extern uint8_t *TEST_CANTX_GetCellTemperatureSweepOrder(void) {
+    return cantx_cellTemperatureSweepOrder;
+}
+#endif
 #endif
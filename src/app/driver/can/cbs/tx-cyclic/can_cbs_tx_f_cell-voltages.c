@@ -43,7 +43,7 @@
  * @file    can_cbs_tx_f_cell-voltages.c
  * @author  foxBMS Team
  * @date    2021-04-20 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  CANTX
@@ -58,9 +58,12 @@
 #include "can_cbs_tx_cyclic.h"
 #include "can_cfg_tx-cyclic-message-definitions.h"
 #include "can_helper.h"
+#include "fbitset.h"
 #include "foxmath.h"
+#include "sys_mon_latency.h"
 
 #include <math.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
@@ -166,6 +169,17 @@ static const CAN_SIGNAL_TYPE_s cantx_cellVoltage3_mV = {
     CANRX_MINIMUM_VALUE_VOLTAGE,
     CANRX_MAXIMUM_VALUE_VOLTAGE};
 
+#if (CANTX_CELL_BROADCAST_POLICY == CANTX_CELL_BROADCAST_POLICY_ADAPTIVE)
+/** transmission order (multiplexer values) of the frames in the current sweep */
+static uint8_t cantx_cellVoltageSweepOrder[CANTX_NUMBER_OF_CAN_MESSAGES_FOR_CELL_VOLTAGES] = {0u};
+/** cell voltages that have been transmitted in the previous sweep */
+static int16_t cantx_previousCellVoltage_mV[BS_NR_OF_CELL_BLOCKS] = {0};
+/** database timestamp of the cell voltages transmitted in the previous sweep */
+static uint32_t cantx_previousCellVoltageTimestamp = 0u;
+/** true if the current sweep is transmitted as burst */
+static bool cantx_cellVoltageBurstActive = false;
+#endif
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
@@ -190,6 +204,37 @@ static void CANTX_VoltageSetData(
     CAN_ENDIANNESS_e endianness,
     const CAN_SHIM_s *const kpkCanShim);
 
+#if (CANTX_CELL_BROADCAST_POLICY == CANTX_CELL_BROADCAST_POLICY_ADAPTIVE)
+/**
+ * @brief   Checks if a cell voltage needs to be transmitted early in a sweep
+ * @param   voltage_mV          current cell voltage
+ * @param   previousVoltage_mV  cell voltage transmitted in the previous sweep
+ * @param   minimum_mV          minimum of all valid cell voltages
+ * @param   maximum_mV          maximum of all valid cell voltages
+ * @return  true if the voltage changed by more than
+ *          #CANTX_CELL_VOLTAGES_DEADBAND_mV or is within
+ *          #CANTX_CELL_VOLTAGES_EXTREMUM_MARGIN_mV of the minimum or maximum,
+ *          false otherwise
+ */
+static bool CANTX_IsCellVoltagePrioritized(
+    int16_t voltage_mV,
+    int16_t previousVoltage_mV,
+    int16_t minimum_mV,
+    int16_t maximum_mV);
+
+/**
+ * @brief   Plans the transmission order of the next cell voltage sweep
+ * @details Frames that contain at least one prioritized cell voltage (see
+ *          #CANTX_IsCellVoltagePrioritized) are put at the beginning of the
+ *          sweep, all other frames follow. Both groups keep the ascending
+ *          multiplexer order, and every frame is part of every sweep, so the
+ *          DBC layout does not change.
+ * @param[in] kpkCanShim  shim to the database entries
+ * @return  number of prioritized frames at the beginning of the sweep
+ */
+static uint8_t CANTX_PlanCellVoltageSweep(const CAN_SHIM_s *const kpkCanShim);
+#endif
+
 /*========== Static Function Implementations ================================*/
 static void CANTX_VoltageSetData(
     uint16_t cellId,
@@ -211,7 +256,8 @@ static void CANTX_VoltageSetData(
 
     uint32_t signalDataIsValid = 0u;
     /* Valid bits data */
-    if (kpkCanShim->pTableCellVoltage->invalidCellVoltage[stringNumber][moduleNumber][cellBlockNumber] == false) {
+    if (BITSET_IsBitSet(kpkCanShim->pTableCellVoltage->invalidCellVoltage[stringNumber][moduleNumber], cellBlockNumber) ==
+        false) {
         signalDataIsValid = 1u;
     } else {
         signalDataIsValid = 0u;
@@ -234,6 +280,89 @@ static void CANTX_VoltageSetData(
         pMessage, cellVoltageSignal.bitStart, cellVoltageSignal.bitLength, (uint32_t)signalData_mV, endianness);
 }
 
+#if (CANTX_CELL_BROADCAST_POLICY == CANTX_CELL_BROADCAST_POLICY_ADAPTIVE)
+static bool CANTX_IsCellVoltagePrioritized(
+    int16_t voltage_mV,
+    int16_t previousVoltage_mV,
+    int16_t minimum_mV,
+    int16_t maximum_mV) {
+    /* AXIVION Routine Generic-MissingParameterAssert: voltage_mV: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: previousVoltage_mV: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: minimum_mV: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: maximum_mV: parameter accepts whole range */
+    bool isPrioritized      = false;
+    const int32_t change_mV = (int32_t)voltage_mV - (int32_t)previousVoltage_mV;
+    if ((change_mV > CANTX_CELL_VOLTAGES_DEADBAND_mV) || (change_mV < -CANTX_CELL_VOLTAGES_DEADBAND_mV)) {
+        isPrioritized = true;
+    }
+    if (((int32_t)voltage_mV - (int32_t)minimum_mV) <= CANTX_CELL_VOLTAGES_EXTREMUM_MARGIN_mV) {
+        isPrioritized = true;
+    }
+    if (((int32_t)maximum_mV - (int32_t)voltage_mV) <= CANTX_CELL_VOLTAGES_EXTREMUM_MARGIN_mV) {
+        isPrioritized = true;
+    }
+    return isPrioritized;
+}
+
+static uint8_t CANTX_PlanCellVoltageSweep(const CAN_SHIM_s *const kpkCanShim) {
+    FAS_ASSERT(kpkCanShim != NULL_PTR);
+    const DATA_BLOCK_CELL_VOLTAGE_s *const kpkTable = kpkCanShim->pTableCellVoltage;
+
+    /* minimum and maximum of all valid cell voltages */
+    int16_t minimum_mV = INT16_MAX;
+    int16_t maximum_mV = INT16_MIN;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint8_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_MODULE; c++) {
+                if (BITSET_IsBitSet(kpkTable->invalidCellVoltage[s][m], c) == false) {
+                    if (kpkTable->cellVoltage_mV[s][m][c] < minimum_mV) {
+                        minimum_mV = kpkTable->cellVoltage_mV[s][m][c];
+                    }
+                    if (kpkTable->cellVoltage_mV[s][m][c] > maximum_mV) {
+                        maximum_mV = kpkTable->cellVoltage_mV[s][m][c];
+                    }
+                }
+            }
+        }
+    }
+
+    /* the cell index runs in the same order as in DATA_GetStringNumberFromVoltageIndex() and friends */
+    bool isFramePrioritized[CANTX_NUMBER_OF_CAN_MESSAGES_FOR_CELL_VOLTAGES] = {false};
+    uint16_t cellId                                                         = 0u;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint8_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_MODULE; c++) {
+                const int16_t voltage_mV = kpkTable->cellVoltage_mV[s][m][c];
+                if ((BITSET_IsBitSet(kpkTable->invalidCellVoltage[s][m], c) == false) &&
+                    (CANTX_IsCellVoltagePrioritized(
+                         voltage_mV, cantx_previousCellVoltage_mV[cellId], minimum_mV, maximum_mV) == true)) {
+                    isFramePrioritized[cellId / CANTX_NUMBER_OF_MUX_VOLTAGES_PER_MESSAGE] = true;
+                }
+                cantx_previousCellVoltage_mV[cellId] = voltage_mV;
+                cellId++;
+            }
+        }
+    }
+
+    /* prioritized frames first, all other frames afterwards */
+    uint8_t position = 0u;
+    for (uint8_t muxValue = 0u; muxValue < CANTX_NUMBER_OF_CAN_MESSAGES_FOR_CELL_VOLTAGES; muxValue++) {
+        if (isFramePrioritized[muxValue] == true) {
+            cantx_cellVoltageSweepOrder[position] = muxValue;
+            position++;
+        }
+    }
+    const uint8_t numberOfPrioritizedFrames = position;
+    for (uint8_t muxValue = 0u; muxValue < CANTX_NUMBER_OF_CAN_MESSAGES_FOR_CELL_VOLTAGES; muxValue++) {
+        if (isFramePrioritized[muxValue] == false) {
+            cantx_cellVoltageSweepOrder[position] = muxValue;
+            position++;
+        }
+    }
+    return numberOfPrioritizedFrames;
+}
+#endif
+
 /*========== Extern Function Implementations ================================*/
 extern uint32_t CANTX_CellVoltages(
     CAN_MESSAGE_PROPERTIES_s message,
@@ -247,26 +376,45 @@ extern uint32_t CANTX_CellVoltages(
     FAS_ASSERT(pCanData != NULL_PTR);
     FAS_ASSERT(pMuxId != NULL_PTR);
     FAS_ASSERT(kpkCanShim != NULL_PTR);
-    uint64_t messageData = 0u;
+    uint64_t messageData     = 0u;
+    uint32_t framesRequested = 0u;
 
+#if (CANTX_CELL_BROADCAST_POLICY == CANTX_CELL_BROADCAST_POLICY_ADAPTIVE)
+    /* pMuxId is the position in the sweep; start a new sweep if the previous one is complete */
+    if ((*pMuxId == 0u) || (*pMuxId >= CANTX_NUMBER_OF_CAN_MESSAGES_FOR_CELL_VOLTAGES)) {
+        *pMuxId = 0u;
+        DATA_READ_DATA(kpkCanShim->pTableCellVoltage);
+        (void)CANTX_PlanCellVoltageSweep(kpkCanShim);
+        /* burst the sweep if the database contains a new measurement */
+        if (kpkCanShim->pTableCellVoltage->header.timestamp != cantx_previousCellVoltageTimestamp) {
+            cantx_cellVoltageBurstActive = true;
+        } else {
+            cantx_cellVoltageBurstActive = false;
+        }
+        cantx_previousCellVoltageTimestamp = kpkCanShim->pTableCellVoltage->header.timestamp;
+    }
+    const uint8_t muxValue = cantx_cellVoltageSweepOrder[*pMuxId];
+#else
     /* Reset mux if maximum was reached */
     if (*pMuxId >= CANTX_NUMBER_OF_CAN_MESSAGES_FOR_CELL_VOLTAGES) {
         *pMuxId = 0u;
         /* First signal to transmit cell voltages: get database values */
         DATA_READ_DATA(kpkCanShim->pTableCellVoltage);
     }
+    const uint8_t muxValue = *pMuxId;
+#endif
 
     /* Set mux signal in CAN frame */
     CAN_TxSetMessageDataWithSignalData(
         &messageData,
         cantx_cellVoltageMultiplexer.bitStart,
         cantx_cellVoltageMultiplexer.bitLength,
-        (uint64_t)*pMuxId,
+        (uint64_t)muxValue,
         message.endianness);
 
     /* Set other signals in CAN frame */
     /* Calculate the global cell ID based on the multiplexer value for the first cell */
-    uint16_t cellId = (*pMuxId * CANTX_NUMBER_OF_MUX_VOLTAGES_PER_MESSAGE);
+    uint16_t cellId = (muxValue * CANTX_NUMBER_OF_MUX_VOLTAGES_PER_MESSAGE);
     CANTX_VoltageSetData(
         cellId, &messageData, cantx_cellVoltage0_mV, cantx_cellVoltage0InvalidFlag, message.endianness, kpkCanShim);
     cellId++; /* Increment global cell ID */
@@ -298,10 +446,20 @@ extern uint32_t CANTX_CellVoltages(
     /* Increment multiplexer for next cell */
     (*pMuxId)++;
 
+#if (CANTX_CELL_BROADCAST_POLICY == CANTX_CELL_BROADCAST_POLICY_ADAPTIVE)
+    /* request the rest of the sweep in the same tick */
+    if (cantx_cellVoltageBurstActive == true) {
+        framesRequested = (uint32_t)CANTX_NUMBER_OF_CAN_MESSAGES_FOR_CELL_VOLTAGES - (uint32_t)*pMuxId;
+    }
+#endif
+
+    /* Record the age of the measurement that is handed over to the CAN bus */
+    SYSM_RecordLatency(SYSM_LATENCY_STAGE_CAN_TX, kpkCanShim->pTableCellVoltage->header.acquisitionTimestamp);
+
     /* All signal data copied in CAN frame, now copy data in the buffer that will be use to send the frame */
     CAN_TxSetCanDataWithMessageData(messageData, pCanData, message.endianness);
 
-    return 0u;
+    return framesRequested;
 }
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -315,5 +473,20 @@ extern void TEST_CANTX_VoltageSetData(
     const CAN_SHIM_s *const kpkCanShim) {
     CANTX_VoltageSetData(cellId, pMessage, cellVoltageSignal, cellVoltageInvalidFlagSignal, endianness, kpkCanShim);
 }
+#if (CANTX_CELL_BROADCAST_POLICY == CANTX_CELL_BROADCAST_POLICY_ADAPTIVE)
+extern bool TEST_CANTX_IsCellVoltagePrioritized(
+    int16_t voltage_mV,
+    int16_t previousVoltage_mV,
+    int16_t minimum_mV,
+    int16_t maximum_mV) {
+    return CANTX_IsCellVoltagePrioritized(voltage_mV, previousVoltage_mV, minimum_mV, maximum_mV);
+}
+extern uint8_t TEST_CANTX_PlanCellVoltageSweep(const CAN_SHIM_s *const kpkCanShim) {
+    return CANTX_PlanCellVoltageSweep(kpkCanShim);
+}
+extern uint8_t *TEST_CANTX_GetCellVoltageSweepOrder(void) {
+    return cantx_cellVoltageSweepOrder;
+}
+#endif
 
 #endif
@@ -381,8 +381,6 @@ extern uint32_t CANTX_PackLimits(
     FAS_ASSERT(kpkCanShim != NULL_PTR);
     uint64_t messageData = 0u;
 
-    DATA_READ_DATA(kpkCanShim->pTableSof, can_kShim.pTablePackValues);
-
     CANTX_BuildPackLimitsMessage(&messageData, kpkCanShim);
 
     /* now copy data in the buffer that will be used to send data */
@@ -642,8 +642,6 @@ extern uint32_t CANTX_PackMinimumMaximumVoltage(
     FAS_ASSERT(kpkCanShim != NULL_PTR);
     uint64_t messageData = 0u;
 
-    (void)DATA_READ_DATA(kpkCanShim->pTableMinMax);
-
     CANTX_BuildPackMinimumMaximumVoltageMessage(kpkCanShim, &messageData);
 
     /* now copy data in the buffer that will be used to send data */
@@ -666,8 +664,6 @@ extern uint32_t CANTX_PackMinimumMaximumTemp(
     FAS_ASSERT(kpkCanShim != NULL_PTR);
     uint64_t messageData = 0u;
 
-    (void)DATA_READ_DATA(kpkCanShim->pTableMinMax);
-
     CANTX_BuildPackMinimumMaximumTempMessage(kpkCanShim, &messageData);
 
     /* now copy data in the buffer that will be used to send data */
@@ -428,8 +428,6 @@ extern uint32_t CANTX_PackStateEstimation(
     FAS_ASSERT(kpkCanShim != NULL_PTR);
     uint64_t messageData = 0u;
 
-    DATA_READ_DATA(kpkCanShim->pTableSoc, kpkCanShim->pTableSoe);
-
     /* build CAN message */
     CANTX_BuildPackStateEstimationMessage(kpkCanShim, &messageData);
     /* now copy data in the buffer that will be used to send data */
@@ -271,9 +271,6 @@ extern uint32_t CANTX_PackValuesP0(
     FAS_ASSERT(kpkCanShim != NULL_PTR);
     uint64_t messageData = 0u;
 
-    /* Read database entry */
-    DATA_READ_DATA(kpkCanShim->pTablePackValues);
-
     /* build message from data */
     CANTX_BuildP0Message(kpkCanShim, &messageData);
 
@@ -144,9 +144,6 @@ extern uint32_t CANTX_PackValuesP1(
     FAS_ASSERT(kpkCanShim != NULL_PTR);
     uint64_t messageData = 0u;
 
-    /* read database entry */
-    DATA_READ_DATA(kpkCanShim->pTableInsulation);
-
     /* build message from data */
     CANTX_SetInsulationResistance(&messageData, kpkCanShim);
 
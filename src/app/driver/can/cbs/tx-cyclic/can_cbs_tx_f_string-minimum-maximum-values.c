@@ -341,11 +341,6 @@ extern uint32_t CANTX_StringMinimumMaximumVoltage(
     FAS_ASSERT(kpkCanShim != NULL_PTR);
     uint64_t voltageMessageData = 0u;
 
-    (void)DATA_READ_DATA(kpkCanShim->pTableMinMax);
-
-    /** Database entry with minimum and maximum values does not need to be read
-     *  within this callback as it is already read by function
-     *  #CANTX_StringMinimumMaximumTemp */
     const uint8_t stringNumber = *pMuxId;
 
     /* adding data to the messages */
@@ -380,11 +375,6 @@ extern uint32_t CANTX_StringMinimumMaximumTemp(
     FAS_ASSERT(kpkCanShim != NULL_PTR);
     uint64_t temperatureMessageData = 0u;
 
-    (void)DATA_READ_DATA(kpkCanShim->pTableMinMax);
-
-    /** Database entry with minimum and maximum values does not need to be read
-     *  within this callback as it is already read by function
-     *  #CANTX_StringMinimumMaximumVoltage */
     const uint8_t stringNumber = *pMuxId;
 
     /* adding data to the messages */
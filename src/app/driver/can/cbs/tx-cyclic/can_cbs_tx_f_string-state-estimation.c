@@ -390,9 +390,6 @@ extern uint32_t CANTX_StringStateEstimation(
     FAS_ASSERT(kpkCanShim != NULL_PTR);
     uint64_t messageData = 0u;
 
-    /** Database entry with state estimation values does not need to be read
-     *  within this callback as it is already read by function
-     *  #CANTX_PackStateEstimation */
     const uint8_t stringNumber = *pMuxId;
 
     /* build the message */
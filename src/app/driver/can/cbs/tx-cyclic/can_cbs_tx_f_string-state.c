@@ -635,7 +635,7 @@ static void CANTX_SetOtherErrorFlags(const CAN_SHIM_s *const kpkCanShim, uint64_
         data,
         CANTX_STRING_STATE_ENDIANNESS);
 
-    /* Balancing active - database entry read for f_BmsState message */
+    /* Balancing active */
     if (kpkCanShim->pTableBalancingControl->nrBalancedCells[stringNumber] == 0u) {
         data = 0u;
     } else {
@@ -783,13 +783,6 @@ extern uint32_t CANTX_StringState(
 
     const uint8_t stringNumber = *pMuxId;
 
-    /* First signal to transmit cell voltages: get database values */
-    if (stringNumber == 0u) {
-        /* Do not read pTableMsl and pTableErrorState as they already are read
-         * with a higher frequency from CAN_TxState callback */
-        (void)DATA_READ_DATA(kpkCanShim->pTableRsl, kpkCanShim->pTableMol);
-    }
-
     /* Set mux value */
     CAN_TxSetMessageDataWithSignalData(
         &messageData,
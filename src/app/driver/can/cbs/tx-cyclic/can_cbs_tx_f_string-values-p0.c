@@ -246,13 +246,6 @@ extern uint32_t CANTX_StringValuesP0(
 
     const uint8_t stringNumber = *pMuxId;
 
-    /* First signal to transmit cell voltages: get database values */
-    if (stringNumber == 0u) {
-        /* Do not read pTableMsl and pTableErrorState as they already are read
-         * with a higher frequency from CANTX_BmsState callback */
-        DATA_READ_DATA(kpkCanShim->pTablePackValues);
-    }
-
     /* set message data */
     CANTX_BuildString0Message(&messageData, stringNumber, kpkCanShim);
 
@@ -139,13 +139,6 @@ extern uint32_t CANTX_StringValuesP1(
 
     const uint8_t stringNumber = *pMuxId;
 
-    /* First signal to transmit cell voltages: get database values */
-    if (stringNumber == 0u) {
-        /* Do not read pTableMsl and pTableErrorState as they already are read
-         * with a higher frequency from CANTX_BmsState callback */
-        DATA_READ_DATA(kpkCanShim->pTableEnergyCounter);
-    }
-
     signalData = (uint64_t)stringNumber;
     CANTX_SetStringP1Mux(&messageData, signalData);
     CANTX_SetStringEnergyCounter(&messageData, stringNumber, kpkCanShim);
@@ -43,7 +43,7 @@
  * @file    can_cfg.h
  * @author  foxBMS Team
  * @date    2019-12-04 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  CAN
@@ -124,6 +124,40 @@ typedef struct {
 /** An offset of zero for can signal preparation */
 #define CAN_SIGNAL_OFFSET_0 (0.0f)
 
+/** Bit rate of the CAN nodes, used for the TX bus-load accounting; it is
+ *  checked against the bit timing of the HALCoGen configuration in can.c */
+#define CAN_BITRATE_kbps (500u)
+/** Share of the bus bandwidth that the periodic TX messages (including bursts
+ *  requested by TX callbacks) may use */
+#define CAN_TX_BUS_LOAD_BUDGET_perc (40u)
+/** Worst-case length of a standard frame with 8 data bytes, including bit
+ *  stuffing and interframe space */
+#define CAN_TX_FRAME_LENGTH_bit (135u)
+/** Number of TX mailboxes that burst transmissions leave free for the
+ *  regularly scheduled messages */
+#define CAN_TX_BURST_MAILBOX_RESERVE (8u)
+
+/** Local database tables of #CAN_SHIM_s that a periodic TX message needs.
+ *  #CAN_PeriodicTransmit reads the union of the tables of all messages that
+ *  are due in a tick once before the callbacks are called. @{*/
+#define CAN_SHIM_TABLE_NONE              (0x0000u)
+#define CAN_SHIM_TABLE_BALANCING_CONTROL (0x0001u)
+#define CAN_SHIM_TABLE_ENERGY_COUNTER    (0x0002u)
+#define CAN_SHIM_TABLE_ERROR_STATE       (0x0004u)
+#define CAN_SHIM_TABLE_INSULATION        (0x0008u)
+#define CAN_SHIM_TABLE_MIN_MAX           (0x0010u)
+#define CAN_SHIM_TABLE_MOL               (0x0020u)
+#define CAN_SHIM_TABLE_MSL               (0x0040u)
+#define CAN_SHIM_TABLE_PACK_VALUES       (0x0080u)
+#define CAN_SHIM_TABLE_PHY               (0x0100u)
+#define CAN_SHIM_TABLE_RSL               (0x0200u)
+#define CAN_SHIM_TABLE_SOC               (0x0400u)
+#define CAN_SHIM_TABLE_SOE               (0x0800u)
+#define CAN_SHIM_TABLE_SOF               (0x1000u)
+/**@}*/
+/** Number of local database tables that can be selected with CAN_SHIM_TABLE_* */
+#define CAN_SHIM_NR_OF_TABLES (13u)
+
 /* **************************************************************************************
  *  CAN BUFFER OPTIONS
  *****************************************************************************************/
@@ -279,6 +313,7 @@ typedef struct {
     CAN_TxCallbackFunction_f callbackFunction; /*!< CAN message callback after message is sent */
     uint8_t *pMuxId; /*!< for multiplexed signals: callback can use this as pointer to a mux variable, NULL_PTR if
                             unused*/
+    uint16_t databaseTables; /*!< local database tables the callback uses (CAN_SHIM_TABLE_* bit mask) */
 } CAN_TX_MESSAGE_TYPE_s;
 
 /* TODO: timing check not implemented for RX messages! */
@@ -132,6 +132,34 @@
 #define CANTX_CELL_TEMPERATURES_DLC        (CAN_DEFAULT_DLC)
 /**@}*/
 
+/** Transmission policies of the multiplexed cell voltage and cell temperature
+ *  messages:
+ *  - round-robin: one multiplexed frame is sent per message period
+ *  - adaptive: a complete sweep is burst as soon as a new measurement is
+ *    available (as far as free TX mailboxes and the bus-load budget allow);
+ *    frames that contain cells that changed by more than the deadband or that
+ *    are close to the minimum/maximum value are sent first @{*/
+#define CANTX_CELL_BROADCAST_POLICY_ROUND_ROBIN (0u)
+#define CANTX_CELL_BROADCAST_POLICY_ADAPTIVE    (1u)
+/**@}*/
+
+#ifndef CANTX_CELL_BROADCAST_POLICY
+/** selected transmission policy for cell voltages and cell temperatures */
+#define CANTX_CELL_BROADCAST_POLICY (CANTX_CELL_BROADCAST_POLICY_ROUND_ROBIN)
+#endif
+
+/** adaptive policy: change between two sweeps above which a frame is
+ *  prioritized @{*/
+#define CANTX_CELL_VOLTAGES_DEADBAND_mV        (5)
+#define CANTX_CELL_TEMPERATURES_DEADBAND_ddegC (5)
+/**@}*/
+
+/** adaptive policy: distance to the minimum/maximum value below which a frame
+ *  is prioritized @{*/
+#define CANTX_CELL_VOLTAGES_EXTREMUM_MARGIN_mV        (10)
+#define CANTX_CELL_TEMPERATURES_EXTREMUM_MARGIN_ddegC (10)
+/**@}*/
+
 /** CAN message properties for BMS limit values. Required properties are:
  *  - ID
  *  - Identifier type (standard or extended)
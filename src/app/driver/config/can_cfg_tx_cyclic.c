@@ -83,23 +83,23 @@ static uint8_t cantx_stringStateEstimationMux           = 0u;
 /** registry of CAN TX messages */
 const CAN_TX_MESSAGE_TYPE_s can_txMessages[] = {
     /* clang-format off */
-    {CAN_NODE_1, CANTX_BMS_STATE_MESSAGE,                       &CANTX_BmsState,                    NULL_PTR                                    },
-    {CAN_NODE_1, CANTX_BMS_STATE_DETAILS_MESSAGE,               &CANTX_BmsStateDetails,             NULL_PTR                                    },
-    {CAN_NODE_1, CANTX_CELL_VOLTAGES_MESSAGE,                   &CANTX_CellVoltages,                &cantx_cellVoltagesMux                      },
-    {CAN_NODE_1, CANTX_CELL_TEMPERATURES_MESSAGE,               &CANTX_CellTemperatures,            &cantx_cellTemperaturesMux                  },
-    {CAN_NODE_1, CANTX_PACK_LIMITS_MESSAGE,                     &CANTX_PackLimits,                  NULL_PTR                                    },
-    {CAN_NODE_1, CANTX_PACK_MIN_MAX_CELL_VOLTAGE_MESSAGE,       &CANTX_PackMinimumMaximumVoltage,   NULL_PTR                                    },
-    {CAN_NODE_1, CANTX_PACK_MIN_MAX_CELL_TEMPERATURE_MESSAGE,   &CANTX_PackMinimumMaximumTemp,      NULL_PTR                                    },
-    {CAN_NODE_1, CANTX_PACK_STATE_ESTIMATION_MESSAGE,           &CANTX_PackStateEstimation,         NULL_PTR                                    },
-    {CAN_NODE_1, CANTX_PACK_VALUES_P0_MESSAGE,                  &CANTX_PackValuesP0,                NULL_PTR                                    },
-    {CAN_NODE_1, CANTX_PACK_VALUES_P1_MESSAGE,                  &CANTX_PackValuesP1,                NULL_PTR                                    },
-    {CAN_NODE_1, CANTX_STRING_STATE_MESSAGE,                    &CANTX_StringState,                 &cantx_stringStateMux                       },
-    {CAN_NODE_1, CANTX_STRING_MIN_MAX_CELL_TEMPERATURE_MESSAGE, &CANTX_StringMinimumMaximumTemp,    &cantx_stringMinimumMaximumTemperatureMux   },
-    {CAN_NODE_1, CANTX_STRING_MIN_MAX_CELL_VOLTAGE_MESSAGE,     &CANTX_StringMinimumMaximumVoltage, &cantx_stringMinimumMaximumVoltageMux       },
-    {CAN_NODE_1, CANTX_STRING_STATE_ESTIMATION_MESSAGE,         &CANTX_StringStateEstimation,       &cantx_stringStateEstimationMux             },
-    {CAN_NODE_1, CANTX_STRING_VALUES_P0_MESSAGE,                &CANTX_StringValuesP0,              &cantx_stringValuesP0Mux                    },
-    {CAN_NODE_1, CANTX_STRING_VALUES_P1_MESSAGE,                &CANTX_StringValuesP1,              &cantx_stringValuesP1Mux                    },
-    {CAN_NODE_1, CANTX_SYSTEM_STATE_MESSAGE,                    &CANTX_SysState,                    NULL_PTR                                    }
+    {CAN_NODE_1, CANTX_BMS_STATE_MESSAGE,                       &CANTX_BmsState,                    NULL_PTR,                                  CAN_SHIM_TABLE_ERROR_STATE | CAN_SHIM_TABLE_INSULATION | CAN_SHIM_TABLE_MSL | CAN_SHIM_TABLE_BALANCING_CONTROL | CAN_SHIM_TABLE_PHY},
+    {CAN_NODE_1, CANTX_BMS_STATE_DETAILS_MESSAGE,               &CANTX_BmsStateDetails,             NULL_PTR,                                  CAN_SHIM_TABLE_ERROR_STATE},
+    {CAN_NODE_1, CANTX_CELL_VOLTAGES_MESSAGE,                   &CANTX_CellVoltages,                &cantx_cellVoltagesMux,                    CAN_SHIM_TABLE_NONE},
+    {CAN_NODE_1, CANTX_CELL_TEMPERATURES_MESSAGE,               &CANTX_CellTemperatures,            &cantx_cellTemperaturesMux,                CAN_SHIM_TABLE_NONE},
+    {CAN_NODE_1, CANTX_PACK_LIMITS_MESSAGE,                     &CANTX_PackLimits,                  NULL_PTR,                                  CAN_SHIM_TABLE_SOF | CAN_SHIM_TABLE_PACK_VALUES},
+    {CAN_NODE_1, CANTX_PACK_MIN_MAX_CELL_VOLTAGE_MESSAGE,       &CANTX_PackMinimumMaximumVoltage,   NULL_PTR,                                  CAN_SHIM_TABLE_MIN_MAX},
+    {CAN_NODE_1, CANTX_PACK_MIN_MAX_CELL_TEMPERATURE_MESSAGE,   &CANTX_PackMinimumMaximumTemp,      NULL_PTR,                                  CAN_SHIM_TABLE_MIN_MAX},
+    {CAN_NODE_1, CANTX_PACK_STATE_ESTIMATION_MESSAGE,           &CANTX_PackStateEstimation,         NULL_PTR,                                  CAN_SHIM_TABLE_SOC | CAN_SHIM_TABLE_SOE},
+    {CAN_NODE_1, CANTX_PACK_VALUES_P0_MESSAGE,                  &CANTX_PackValuesP0,                NULL_PTR,                                  CAN_SHIM_TABLE_PACK_VALUES},
+    {CAN_NODE_1, CANTX_PACK_VALUES_P1_MESSAGE,                  &CANTX_PackValuesP1,                NULL_PTR,                                  CAN_SHIM_TABLE_INSULATION},
+    {CAN_NODE_1, CANTX_STRING_STATE_MESSAGE,                    &CANTX_StringState,                 &cantx_stringStateMux,                     CAN_SHIM_TABLE_ERROR_STATE | CAN_SHIM_TABLE_MOL | CAN_SHIM_TABLE_MSL | CAN_SHIM_TABLE_RSL | CAN_SHIM_TABLE_BALANCING_CONTROL},
+    {CAN_NODE_1, CANTX_STRING_MIN_MAX_CELL_TEMPERATURE_MESSAGE, &CANTX_StringMinimumMaximumTemp,    &cantx_stringMinimumMaximumTemperatureMux, CAN_SHIM_TABLE_MIN_MAX},
+    {CAN_NODE_1, CANTX_STRING_MIN_MAX_CELL_VOLTAGE_MESSAGE,     &CANTX_StringMinimumMaximumVoltage, &cantx_stringMinimumMaximumVoltageMux,     CAN_SHIM_TABLE_MIN_MAX},
+    {CAN_NODE_1, CANTX_STRING_STATE_ESTIMATION_MESSAGE,         &CANTX_StringStateEstimation,       &cantx_stringStateEstimationMux,           CAN_SHIM_TABLE_SOC | CAN_SHIM_TABLE_SOE},
+    {CAN_NODE_1, CANTX_STRING_VALUES_P0_MESSAGE,                &CANTX_StringValuesP0,              &cantx_stringValuesP0Mux,                  CAN_SHIM_TABLE_PACK_VALUES},
+    {CAN_NODE_1, CANTX_STRING_VALUES_P1_MESSAGE,                &CANTX_StringValuesP1,              &cantx_stringValuesP1Mux,                  CAN_SHIM_TABLE_ENERGY_COUNTER},
+    {CAN_NODE_1, CANTX_SYSTEM_STATE_MESSAGE,                    &CANTX_SysState,                    NULL_PTR,                                  CAN_SHIM_TABLE_NONE}
     /* clang-format on */
 };
 
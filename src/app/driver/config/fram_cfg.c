@@ -43,7 +43,7 @@
  * @file    fram_cfg.c
  * @author  foxBMS Team
  * @date    2020-03-05 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS_CONFIGURATION
  * @prefix  FRAM
@@ -77,6 +77,7 @@ FRAM_SBC_INIT_s fram_sbcInit = {
 FRAM_DEEP_DISCHARGE_FLAG_s fram_deepDischargeFlags = {false};
 FRAM_SYS_MON_RECORD_s fram_sysMonViolationRecord   = {false, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u};
 FRAM_INSULATION_FLAG_s fram_insulationFlags        = {.groundErrorDetected = false};
+FRAM_SOH_s fram_soh                                = {0};
 /**@}*/
 
 /**
@@ -91,6 +92,7 @@ FRAM_BASE_HEADER_s fram_databaseHeader[] = {
     {(void *)(&fram_soe), sizeof(fram_soe), 0},
     {(void *)(&fram_sysMonViolationRecord), sizeof(fram_sysMonViolationRecord), 0},
     {(void *)(&fram_insulationFlags), sizeof(fram_insulationFlags), 0},
+    {(void *)(&fram_soh), sizeof(fram_soh), 0},
 };
 
 /*========== Static Function Prototypes =====================================*/
@@ -43,7 +43,7 @@
  * @file    fram_cfg.h
  * @author  foxBMS Team
  * @date    2020-03-05 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  FRAM
@@ -109,6 +109,7 @@ typedef enum {
     FRAM_BLOCK_ID_SOE,
     FRAM_BLOCK_ID_SYS_MON_RECORD,
     FRAM_BLOCK_ID_INSULATION_FLAG,
+    FRAM_BLOCK_ID_SOH,
     FRAM_BLOCK_MAX, /**< DO NOT CHANGE, MUST BE THE LAST ENTRY */
 } FRAM_BLOCK_ID_e;
 
@@ -160,6 +161,17 @@ typedef struct {
     float_t dischargeEnergyThroughput_Wh[BS_NR_OF_STRINGS]; /*!< outflow of energy */
 } FRAM_SOE_s;
 
+/**
+ * state of health (SOH). The estimated capacity and internal resistance and
+ * their variances are stored for every cell block.
+ */
+typedef struct {
+    float_t cellCapacity_mAh[BS_NR_OF_CELL_BLOCKS];         /*!< estimated capacity */
+    float_t cellCapacityCovariance[BS_NR_OF_CELL_BLOCKS];   /*!< variance of the estimated capacity */
+    float_t cellResistance_mOhm[BS_NR_OF_CELL_BLOCKS];      /*!< estimated internal resistance */
+    float_t cellResistanceCovariance[BS_NR_OF_CELL_BLOCKS]; /*!< variance of the estimated internal resistance */
+} FRAM_SOH_s;
+
 /** flag to indicate if a deep-discharge in a string has been detected */
 typedef struct {
     bool deepDischargeFlag[BS_NR_OF_STRINGS]; /*!< false (0): no error, true (1): deep-discharge detected */
@@ -198,6 +210,23 @@ typedef struct {
     uint32_t task100msAlgorithmEnterTimestamp;
 } FRAM_SYS_MON_RECORD_s;
 
+/**
+ * @brief   buffer that can hold each of the blocks
+ * @details The pending blocks are copied to this buffer before they are
+ *          written, so that the written CRC matches the written data. New
+ *          block types have to be added here.
+ */
+typedef union {
+    FRAM_VERSION_s version;                        /*!< #FRAM_BLOCK_ID_VERSION */
+    FRAM_SOC_s soc;                                /*!< #FRAM_BLOCK_ID_SOC */
+    FRAM_SBC_INIT_s sbcInit;                       /*!< #FRAM_BLOCK_ID_SBC_INIT_STATE */
+    FRAM_DEEP_DISCHARGE_FLAG_s deepDischargeFlags; /*!< #FRAM_BLOCK_ID_DEEP_DISCHARGE_FLAG */
+    FRAM_SOE_s soe;                                /*!< #FRAM_BLOCK_ID_SOE */
+    FRAM_SYS_MON_RECORD_s sysMonRecord;            /*!< #FRAM_BLOCK_ID_SYS_MON_RECORD */
+    FRAM_INSULATION_FLAG_s insulationFlags;        /*!< #FRAM_BLOCK_ID_INSULATION_FLAG */
+    FRAM_SOH_s soh;                                /*!< #FRAM_BLOCK_ID_SOH */
+} FRAM_BLOCK_BUFFER_u;
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 extern FRAM_BASE_HEADER_s fram_databaseHeader[FRAM_BLOCK_MAX];
@@ -213,6 +242,7 @@ extern FRAM_SBC_INIT_s fram_sbcInit;
 extern FRAM_DEEP_DISCHARGE_FLAG_s fram_deepDischargeFlags;
 extern FRAM_SYS_MON_RECORD_s fram_sysMonViolationRecord;
 extern FRAM_INSULATION_FLAG_s fram_insulationFlags;
+extern FRAM_SOH_s fram_soh;
 /**@}*/
 
 /*========== Extern Function Prototypes =====================================*/
@@ -75,6 +75,9 @@
 /** UART_Printf formatting buffer size */
 #define UART_PRINTF_BUFFER_SIZE (128u)
 
+/** period in which the UART task transmits pending log records */
+#define UART_LOG_TRANSMIT_PERIOD_ms (10u)
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
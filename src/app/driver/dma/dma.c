@@ -43,7 +43,7 @@
  * @file    dma.c
  * @author  foxBMS Team
  * @date    2019-12-12 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  DMA
@@ -72,6 +72,8 @@
 #include "ftask.h"
 #include "i2c.h"
 #include "spi.h"
+#include "sys_mon_bus.h"
+#include "trace.h"
 #if defined(FOXBMS_UART_SUPPORT) && FOXBMS_UART_SUPPORT == 1
 #include "uart.h"
 #endif
@@ -321,6 +323,7 @@ void DMA_Initialize(void) {
 void dmaGroupANotification(dmaInterrupt_t inttype, uint32 channel) {
     /* AXIVION Routine Generic-MissingParameterAssert: inttype: unchecked in interrupt */
     /* AXIVION Routine Generic-MissingParameterAssert: channel: unchecked in interrupt */
+    TRC_RecordIsrEnter(TRC_ISR_ID_DMA_GROUP_A);
     if (inttype == (dmaInterrupt_t)BTC) {
         uint16_t timeoutIterations          = 0u;
         uint8_t spiIndex                    = 0u;
@@ -398,6 +401,8 @@ void dmaGroupANotification(dmaInterrupt_t inttype, uint32 channel) {
                 }
 #endif
                 spi_busyFlags[spiIndex] = SPI_IDLE;
+                /* the SPI interface index is used as bus of the bus statistics */
+                SYSM_RecordBusReleaseFromIsr((SYSM_BUS_e)spiIndex);
 
                 break;
 
@@ -500,6 +505,7 @@ void dmaGroupANotification(dmaInterrupt_t inttype, uint32 channel) {
             i2cSetStop(i2cREG2);
         }
     }
+    TRC_RecordIsrExit(TRC_ISR_ID_DMA_GROUP_A);
 }
 #endif
 
@@ -43,30 +43,34 @@
  * @file    fram.c
  * @author  foxBMS Team
  * @date    2020-03-05 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  FRAM
  *
  * @brief   Driver for the FRAM module
- * @details TODO
- *
- *
+ * @details Each block is stored as CRC header followed by the data of the
+ *          block. The CRC of the last block content that has been written to
+ *          (or read from) the FRAM is kept, so that writes of unchanged
+ *          blocks can be skipped.
  */
 
 /*========== Includes =======================================================*/
 #include "fram.h"
 
+#include "bg_jobs.h"
 #include "crc.h"
 #include "diag.h"
 #include "fassert.h"
 #include "fstd_types.h"
 #include "io.h"
 #include "mcu.h"
+#include "os.h"
 #include "spi.h"
 #include "utils.h"
 #include "version.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
@@ -86,14 +90,194 @@
 #define FRAM_ADDRESS_MIDDLE_PART (0x00FF00u) /**< middle part of the FRAM memory address */
 #define FRAM_ADDRESS_LOWER_PART  (0x0000FFu) /**< lower part of the FRAM memory address */
 
+/** conversion factors for the throughput and the bytes written per hour */
+/**@{*/
+#define FRAM_US_PER_S    (1000000u)
+#define FRAM_MS_PER_HOUR (3600000u)
+/**@}*/
+
 /*========== Static Constant and Variable Definitions =======================*/
 
+/** blocks that are requested to be written by #FRAM_WritePendingData() */
+static bool fram_isWritePending[FRAM_BLOCK_MAX] = {0};
+
+/** CRC of the block content that is stored in the FRAM */
+static uint64_t fram_persistedCrc[FRAM_BLOCK_MAX] = {0};
+
+/** indicates that #fram_persistedCrc is valid for the block */
+static bool fram_isPersistedCrcKnown[FRAM_BLOCK_MAX] = {0};
+
+/** copy of the block that is written by #FRAM_WritePendingData() */
+static FRAM_BLOCK_BUFFER_u fram_writeBuffer = {0};
+
+/** statistics of the FRAM write accesses */
+static FRAM_STATISTICS_s fram_statistics = {0};
+
+/** timestamp of the last reset of the statistics in ms */
+static uint32_t fram_statisticsResetTimestamp_ms = 0u;
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
 
+/**
+ * @brief   Checks if the block content with the passed CRC is already stored
+ *          in the FRAM.
+ * @param   blockId ID of the block
+ * @param   crc     CRC of the current block content
+ * @return  true if the block does not need to be written, otherwise false
+ */
+static bool FRAM_IsBlockPersisted(FRAM_BLOCK_ID_e blockId, uint64_t crc);
+
+/**
+ * @brief   Marks a block as pending and requests the write job.
+ * @param   blockId ID of the block
+ * @return  true if the block was already pending, otherwise false
+ */
+static bool FRAM_MarkWritePending(FRAM_BLOCK_ID_e blockId);
+
+/**
+ * @brief   Takes a block from the pending blocks.
+ * @details The content of a pending block is copied to #fram_writeBuffer,
+ *          so that it can not change while it is written.
+ * @param   blockId ID of the block
+ * @return  true if the block was pending, otherwise false
+ */
+static bool FRAM_TakePendingBlock(FRAM_BLOCK_ID_e blockId);
+
+/**
+ * @brief   Enables writing and starts a write command at the passed address.
+ * @details The chip select stays low, so that blocks can be sent with
+ *          #FRAM_SendBlock() until #FRAM_EndWrite() is called. The SPI
+ *          interface has to be locked by the caller.
+ * @param   address address of the first byte to write
+ */
+static void FRAM_StartWrite(uint32_t address);
+
+/**
+ * @brief   Sends the CRC header and the data of a block.
+ * @param   blockId ID of the block
+ * @param   pData   content of the block
+ * @param   crc     CRC of the block content
+ */
+static void FRAM_SendBlock(FRAM_BLOCK_ID_e blockId, const uint8_t *pData, uint64_t crc);
+
+/** @brief  Ends the write command by setting the chip select high. */
+static void FRAM_EndWrite(void);
+
+/**
+ * @brief   Adds a write access to the statistics.
+ * @param   blocks      number of blocks written
+ * @param   bursts      number of write commands sent
+ * @param   bytes       number of bytes written
+ * @param   startCount  free running counter value before the write
+ */
+static void FRAM_AddWriteStatistics(uint32_t blocks, uint32_t bursts, uint32_t bytes, uint32_t startCount);
+
 /*========== Static Function Implementations ================================*/
 
+static bool FRAM_IsBlockPersisted(FRAM_BLOCK_ID_e blockId, uint64_t crc) {
+    FAS_ASSERT(blockId < FRAM_BLOCK_MAX);
+    return (fram_isPersistedCrcKnown[blockId] == true) && (fram_persistedCrc[blockId] == crc);
+}
+
+static bool FRAM_MarkWritePending(FRAM_BLOCK_ID_e blockId) {
+    FAS_ASSERT(blockId < FRAM_BLOCK_MAX);
+    OS_EnterTaskCritical();
+    const bool wasPending        = fram_isWritePending[blockId];
+    fram_isWritePending[blockId] = true;
+    OS_ExitTaskCritical();
+    BGJ_Request(BGJ_JOB_ID_FRAM_WRITE);
+    return wasPending;
+}
+
+static bool FRAM_TakePendingBlock(FRAM_BLOCK_ID_e blockId) {
+    FAS_ASSERT(blockId < FRAM_BLOCK_MAX);
+    OS_EnterTaskCritical();
+    const bool isPending         = fram_isWritePending[blockId];
+    fram_isWritePending[blockId] = false;
+    if (isPending == true) {
+        const uint8_t *pkFrom = (const uint8_t *)(fram_databaseHeader[blockId].blockptr);
+        uint8_t *pTo          = (uint8_t *)(&fram_writeBuffer);
+        for (uint32_t i = 0u; i < (fram_databaseHeader[blockId]).datalength; i++) {
+            pTo[i] = pkFrom[i];
+        }
+    }
+    OS_ExitTaskCritical();
+    return isPending;
+}
+
+static void FRAM_StartWrite(uint32_t address) {
+    uint16_t read = 0u;
+
+    /* send write enable command */
+    IO_PinReset(spi_framInterface.pGioPort, spi_framInterface.csPin);
+    uint16_t write = FRAM_WRITE_ENABLE_COMMAND;
+    SPI_FramTransmitReceiveData(&spi_framInterface, &write, &read, 1u);
+    IO_PinSet(spi_framInterface.pGioPort, spi_framInterface.csPin);
+    MCU_Delay_us(FRAM_DELAY_AFTER_WRITE_ENABLE_US);
+
+    /* send data to write */
+    /* set chip select low to start transmission */
+    IO_PinReset(spi_framInterface.pGioPort, spi_framInterface.csPin);
+
+    /* send write command */
+    write = FRAM_WRITE_COMMAND;
+    SPI_FramTransmitReceiveData(&spi_framInterface, &write, &read, 1u);
+
+    /* send in this order: upper, middle and lower part of address */
+    write = (uint16_t)((address & FRAM_ADDRESS_UPPER_PART) >> UTIL_SHIFT_TWO_BYTES);
+    SPI_FramTransmitReceiveData(&spi_framInterface, &write, &read, 1u);
+    write = (uint16_t)((address & FRAM_ADDRESS_MIDDLE_PART) >> UTIL_SHIFT_ONE_BYTE);
+    SPI_FramTransmitReceiveData(&spi_framInterface, &write, &read, 1u);
+    write = (uint16_t)((address & FRAM_ADDRESS_LOWER_PART) >> UTIL_SHIFT_ZERO_BYTES);
+    SPI_FramTransmitReceiveData(&spi_framInterface, &write, &read, 1u);
+}
+
+static void FRAM_SendBlock(FRAM_BLOCK_ID_e blockId, const uint8_t *pData, uint64_t crc) {
+    FAS_ASSERT(blockId < FRAM_BLOCK_MAX);
+    FAS_ASSERT(pData != NULL_PTR);
+    uint16_t read  = 0u;
+    uint16_t write = 0u;
+    uint32_t size  = (fram_databaseHeader[blockId]).datalength;
+
+    /* send CRC */
+    const uint8_t *pWrite = (const uint8_t *)(&crc);
+    for (uint8_t i = 0u; i < FRAM_CRC_HEADER_SIZE; i++) {
+        write = (uint16_t)(*pWrite);
+        SPI_FramTransmitReceiveData(&spi_framInterface, &write, &read, 1u);
+        pWrite++;
+    }
+
+    pWrite = pData;
+
+    /* send data */
+    while (size > 0u) {
+        write = (uint16_t)(*pWrite);
+        SPI_FramTransmitReceiveData(&spi_framInterface, &write, &read, 1u);
+        pWrite++;
+        size--;
+    }
+
+    fram_persistedCrc[blockId]        = crc;
+    fram_isPersistedCrcKnown[blockId] = true;
+}
+
+static void FRAM_EndWrite(void) {
+    /* set chip select high to start transmission */
+    IO_PinSet(spi_framInterface.pGioPort, spi_framInterface.csPin);
+}
+
+static void FRAM_AddWriteStatistics(uint32_t blocks, uint32_t bursts, uint32_t bytes, uint32_t startCount) {
+    const uint32_t writeTime_us = MCU_ConvertFrcDifferenceToTimespan_us(MCU_GetFreeRunningCount() - startCount);
+    OS_EnterTaskCritical();
+    fram_statistics.blockWrites += blocks;
+    fram_statistics.writeBursts += bursts;
+    fram_statistics.bytesWritten += bytes;
+    fram_statistics.writeTime_us += writeTime_us;
+    OS_ExitTaskCritical();
+}
+
 /*========== Extern Function Implementations ================================*/
 
 extern void FRAM_Initialize(void) {
@@ -105,6 +289,8 @@ extern void FRAM_Initialize(void) {
     for (uint8_t i = 0u; i < (uint8_t)FRAM_BLOCK_MAX; i++) {
         (fram_databaseHeader[i]).address = address;
         address += (fram_databaseHeader[i]).datalength + FRAM_CRC_HEADER_SIZE;
+        /* each block has to fit into the write buffer */
+        FAS_ASSERT((fram_databaseHeader[i]).datalength <= sizeof(FRAM_BLOCK_BUFFER_u));
     }
 
     /* ASSERT that size of variables does not exceed FRAM size */
@@ -119,6 +305,11 @@ extern void FRAM_Initialize(void) {
 extern STD_RETURN_TYPE_e FRAM_ReinitializeAllEntries(void) {
     STD_RETURN_TYPE_e retVal = STD_OK;
 
+    /* the layout may have changed: write all blocks, even if their content is unchanged */
+    for (uint8_t i = 0u; i < (uint8_t)FRAM_BLOCK_MAX; i++) {
+        fram_isPersistedCrcKnown[i] = false;
+    }
+
     /* Reset FRAM version struct information */
     fram_version.project = FRAM_PROJECT_ID_FOXBMS_BASELINE;
     fram_version.major   = ver_versionInformation.major;
@@ -136,7 +327,6 @@ extern STD_RETURN_TYPE_e FRAM_ReinitializeAllEntries(void) {
 extern FRAM_RETURN_TYPE_e FRAM_WriteData(FRAM_BLOCK_ID_e blockId) {
     FAS_ASSERT(blockId < FRAM_BLOCK_MAX);
 
-    uint16_t read             = 0u;
     uint64_t crc              = 0u;
     FRAM_RETURN_TYPE_e retVal = FRAM_ACCESS_OK;
 
@@ -150,61 +340,114 @@ extern FRAM_RETURN_TYPE_e FRAM_WriteData(FRAM_BLOCK_ID_e blockId) {
     STD_RETURN_TYPE_e crcRetVal = CRC_CalculateCrc(&crc, pWrite, size);
 
     if (crcRetVal == STD_OK) {
-        STD_RETURN_TYPE_e spiRetVal = SPI_Lock(SPI_GetSpiIndex(spi_framInterface.pNode));
-
-        if (spiRetVal == STD_OK) {
-            /* send write enable command */
-            IO_PinReset(spi_framInterface.pGioPort, spi_framInterface.csPin);
-            uint16_t write = FRAM_WRITE_ENABLE_COMMAND;
-            SPI_FramTransmitReceiveData(&spi_framInterface, &write, &read, 1u);
-            IO_PinSet(spi_framInterface.pGioPort, spi_framInterface.csPin);
-            MCU_Delay_us(FRAM_DELAY_AFTER_WRITE_ENABLE_US);
+        if (FRAM_IsBlockPersisted(blockId, crc) == true) {
+            OS_EnterTaskCritical();
+            fram_statistics.skippedWrites++;
+            OS_ExitTaskCritical();
+        } else {
+            STD_RETURN_TYPE_e spiRetVal = SPI_Lock(SPI_GetSpiIndex(spi_framInterface.pNode));
+
+            if (spiRetVal == STD_OK) {
+                const uint32_t startCount = MCU_GetFreeRunningCount();
+                FRAM_StartWrite(address);
+                FRAM_SendBlock(blockId, pWrite, crc);
+                FRAM_EndWrite();
+                SPI_Unlock(SPI_GetSpiIndex(spi_framInterface.pNode));
+                FRAM_AddWriteStatistics(1u, 1u, size + FRAM_CRC_HEADER_SIZE, startCount);
+            } else {
+                retVal = FRAM_ACCESS_SPI_BUSY;
+            }
+        }
+    } else {
+        retVal = FRAM_ACCESS_CRC_BUSY;
+    }
 
-            /* send data to write */
-            /* set chip select low to start transmission */
-            IO_PinReset(spi_framInterface.pGioPort, spi_framInterface.csPin);
+    if (retVal != FRAM_ACCESS_OK) {
+        /* write the block as soon as SPI and CRC are available again */
+        (void)FRAM_MarkWritePending(blockId);
+        OS_EnterTaskCritical();
+        fram_statistics.busyRejections++;
+        OS_ExitTaskCritical();
+    }
+    return retVal;
+}
 
-            /* send write command */
-            write = FRAM_WRITE_COMMAND;
-            SPI_FramTransmitReceiveData(&spi_framInterface, &write, &read, 1u);
+extern void FRAM_RequestWrite(FRAM_BLOCK_ID_e blockId) {
+    FAS_ASSERT(blockId < FRAM_BLOCK_MAX);
+    const bool wasPending = FRAM_MarkWritePending(blockId);
+    OS_EnterTaskCritical();
+    fram_statistics.writeRequests++;
+    if (wasPending == true) {
+        fram_statistics.coalescedRequests++;
+    }
+    OS_ExitTaskCritical();
+}
 
-            /* send in this order: upper, middle and lower part of address */
-            write = (uint16_t)((address & FRAM_ADDRESS_UPPER_PART) >> UTIL_SHIFT_TWO_BYTES);
-            SPI_FramTransmitReceiveData(&spi_framInterface, &write, &read, 1u);
-            write = (uint16_t)((address & FRAM_ADDRESS_MIDDLE_PART) >> UTIL_SHIFT_ONE_BYTE);
-            SPI_FramTransmitReceiveData(&spi_framInterface, &write, &read, 1u);
-            write = (uint16_t)((address & FRAM_ADDRESS_LOWER_PART) >> UTIL_SHIFT_ZERO_BYTES);
-            SPI_FramTransmitReceiveData(&spi_framInterface, &write, &read, 1u);
+extern void FRAM_WritePendingData(void) {
+    /* FRAM must use SW Chip Select configuration*/
+    FAS_ASSERT(spi_framInterface.csType == SPI_CHIP_SELECT_SOFTWARE);
 
-            /* send CRC */
-            pWrite = (uint8_t *)(&crc);
-            for (uint8_t i = 0u; i < FRAM_CRC_HEADER_SIZE; i++) {
-                write = (uint16_t)(*pWrite);
-                SPI_FramTransmitReceiveData(&spi_framInterface, &write, &read, 1u);
-                pWrite++;
+    if (SPI_Lock(SPI_GetSpiIndex(spi_framInterface.pNode)) == STD_OK) {
+        const uint32_t startCount = MCU_GetFreeRunningCount();
+        bool isWriteActive        = false;
+        uint32_t blocks           = 0u;
+        uint32_t bursts           = 0u;
+        uint32_t bytes            = 0u;
+        uint32_t skipped          = 0u;
+        uint32_t rejected         = 0u;
+
+        for (uint8_t i = 0u; i < (uint8_t)FRAM_BLOCK_MAX; i++) {
+            const FRAM_BLOCK_ID_e blockId = (FRAM_BLOCK_ID_e)i;
+            bool isBlockSent              = false;
+
+            if (FRAM_TakePendingBlock(blockId) == true) {
+                uint64_t crc   = 0u;
+                uint32_t size  = (fram_databaseHeader[blockId]).datalength;
+                uint8_t *pData = (uint8_t *)(&fram_writeBuffer);
+
+                if (CRC_CalculateCrc(&crc, pData, size) != STD_OK) {
+                    (void)FRAM_MarkWritePending(blockId);
+                    rejected++;
+                } else if (FRAM_IsBlockPersisted(blockId, crc) == true) {
+                    skipped++;
+                } else {
+                    /* blocks are stored contiguously: continue the running write command if possible */
+                    if (isWriteActive == false) {
+                        FRAM_StartWrite((fram_databaseHeader[blockId]).address);
+                        isWriteActive = true;
+                        bursts++;
+                    }
+                    FRAM_SendBlock(blockId, pData, crc);
+                    isBlockSent = true;
+                    blocks++;
+                    bytes += size + FRAM_CRC_HEADER_SIZE;
+                }
             }
 
-            pWrite = (uint8_t *)(fram_databaseHeader[blockId].blockptr);
-
-            /* send data */
-            while (size > 0u) {
-                write = (uint16_t)(*pWrite);
-                SPI_FramTransmitReceiveData(&spi_framInterface, &write, &read, 1u);
-                pWrite++;
-                size--;
+            if ((isBlockSent == false) && (isWriteActive == true)) {
+                FRAM_EndWrite();
+                isWriteActive = false;
             }
+        }
+        if (isWriteActive == true) {
+            FRAM_EndWrite();
+        }
+        SPI_Unlock(SPI_GetSpiIndex(spi_framInterface.pNode));
 
-            /* set chip select high to start transmission */
-            IO_PinSet(spi_framInterface.pGioPort, spi_framInterface.csPin);
-
-            SPI_Unlock(SPI_GetSpiIndex(spi_framInterface.pNode));
-        } else {
-            retVal = FRAM_ACCESS_SPI_BUSY;
+        if (blocks > 0u) {
+            FRAM_AddWriteStatistics(blocks, bursts, bytes, startCount);
         }
+        OS_EnterTaskCritical();
+        fram_statistics.skippedWrites += skipped;
+        fram_statistics.busyRejections += rejected;
+        OS_ExitTaskCritical();
     } else {
-        retVal = FRAM_ACCESS_CRC_BUSY;
+        /* the pending blocks stay pending: try again in the next run */
+        OS_EnterTaskCritical();
+        fram_statistics.busyRejections++;
+        OS_ExitTaskCritical();
+        BGJ_Request(BGJ_JOB_ID_FRAM_WRITE);
     }
-    return retVal;
 }
 
 extern FRAM_RETURN_TYPE_e FRAM_ReadData(FRAM_BLOCK_ID_e blockId) {
@@ -272,10 +515,15 @@ extern FRAM_RETURN_TYPE_e FRAM_ReadData(FRAM_BLOCK_ID_e blockId) {
         uint64_t crcCalculated      = 0u;
         STD_RETURN_TYPE_e crcRetVal = CRC_CalculateCrc(&crcCalculated, pRead, size);
 
+        /* the stored content is only known, if the CRC could be verified */
+        fram_isPersistedCrcKnown[blockId] = false;
         if (crcRetVal == STD_OK) {
             if (crcRead != crcCalculated) {
                 (void)DIAG_Handler(DIAG_ID_FRAM_READ_CRC_ERROR, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, blockId);
                 retVal = FRAM_ACCESS_CRC_ERROR;
+            } else {
+                fram_persistedCrc[blockId]        = crcRead;
+                fram_isPersistedCrcKnown[blockId] = true;
             }
         } else {
             retVal = FRAM_ACCESS_CRC_BUSY;
@@ -287,6 +535,47 @@ extern FRAM_RETURN_TYPE_e FRAM_ReadData(FRAM_BLOCK_ID_e blockId) {
     return retVal;
 }
 
+extern void FRAM_GetStatistics(FRAM_STATISTICS_s *pStatistics) {
+    FAS_ASSERT(pStatistics != NULL_PTR);
+    OS_EnterTaskCritical();
+    *pStatistics                     = fram_statistics;
+    const uint32_t resetTimestamp_ms = fram_statisticsResetTimestamp_ms;
+    OS_ExitTaskCritical();
+
+    pStatistics->throughput_Bps = 0u;
+    if (pStatistics->writeTime_us > 0u) {
+        pStatistics->throughput_Bps =
+            (uint32_t)(((uint64_t)pStatistics->bytesWritten * FRAM_US_PER_S) / pStatistics->writeTime_us);
+    }
+    pStatistics->bytesWrittenPerHour = 0u;
+    const uint32_t elapsed_ms        = OS_GetTickCount() - resetTimestamp_ms;
+    if (elapsed_ms > 0u) {
+        const uint64_t bytesPerHour      = ((uint64_t)pStatistics->bytesWritten * FRAM_MS_PER_HOUR) / elapsed_ms;
+        pStatistics->bytesWrittenPerHour = (bytesPerHour > UINT32_MAX) ? UINT32_MAX : (uint32_t)bytesPerHour;
+    }
+}
+
+extern void FRAM_ResetStatistics(void) {
+    const uint32_t timestamp_ms = OS_GetTickCount();
+    OS_EnterTaskCritical();
+    fram_statistics                  = (FRAM_STATISTICS_s){0};
+    fram_statisticsResetTimestamp_ms = timestamp_ms;
+    OS_ExitTaskCritical();
+}
+
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
+extern void TEST_FRAM_Reset(void) {
+    for (uint8_t i = 0u; i < (uint8_t)FRAM_BLOCK_MAX; i++) {
+        fram_isWritePending[i]      = false;
+        fram_persistedCrc[i]        = 0u;
+        fram_isPersistedCrcKnown[i] = false;
+    }
+    fram_statistics                  = (FRAM_STATISTICS_s){0};
+    fram_statisticsResetTimestamp_ms = 0u;
+}
+extern bool TEST_FRAM_IsWritePending(FRAM_BLOCK_ID_e blockId) {
+    FAS_ASSERT(blockId < FRAM_BLOCK_MAX);
+    return fram_isWritePending[blockId];
+}
 #endif
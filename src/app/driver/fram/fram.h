@@ -43,13 +43,20 @@
  * @file    fram.h
  * @author  foxBMS Team
  * @date    2020-03-05 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  FRAM
  *
  * @brief   Header for the driver for the FRAM module
- * @details TODO
+ * @details Blocks that are updated periodically should be requested with
+ *          #FRAM_RequestWrite(). The requests are collected and written by
+ *          #FRAM_WritePendingData() as a background job: all pending blocks
+ *          are written while the SPI interface is locked once, and adjacent
+ *          blocks are sent with a single write command. Blocks whose content
+ *          did not change since the last write (or read) are not written
+ *          again; this is detected by comparing the CRC of the block with
+ *          the CRC that is stored in the FRAM.
  */
 
 #ifndef FOXBMS__FRAM_H_
@@ -60,10 +67,25 @@
 
 #include "fstd_types.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
 
+/** statistics of the FRAM write accesses */
+typedef struct {
+    uint32_t writeRequests;       /*!< number of calls of #FRAM_RequestWrite() */
+    uint32_t coalescedRequests;   /*!< requests for blocks that were already pending */
+    uint32_t skippedWrites;       /*!< writes that were skipped, as the block did not change */
+    uint32_t blockWrites;         /*!< number of blocks written to the FRAM */
+    uint32_t writeBursts;         /*!< number of write commands sent to the FRAM */
+    uint32_t busyRejections;      /*!< writes that were deferred, as SPI or CRC was busy */
+    uint32_t bytesWritten;        /*!< bytes written to the FRAM including the CRC headers */
+    uint32_t writeTime_us;        /*!< accumulated time the SPI interface was locked for writing */
+    uint32_t throughput_Bps;      /*!< bytes written per second of write time */
+    uint32_t bytesWrittenPerHour; /*!< bytes written per hour since the last reset */
+} FRAM_STATISTICS_s;
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
@@ -86,12 +108,32 @@ extern STD_RETURN_TYPE_e FRAM_ReinitializeAllEntries(void);
 /**
  * @brief   Writes a variable to the FRAM.
  * @details This function stores the variable corresponding to the ID passed as
- *          parameter. Write can fail if SPI interface was locked.
+ *          parameter. Write can fail if SPI interface was locked. In this
+ *          case the block is requested to be written by
+ *          #FRAM_WritePendingData(). The write is skipped if the content of
+ *          the block is already stored in the FRAM.
  * @param   blockId ID of variable to write to FRAM
  * @return  one of the values of the FRAM_RETURN_TYPE_e enum
  */
 extern FRAM_RETURN_TYPE_e FRAM_WriteData(FRAM_BLOCK_ID_e blockId);
 
+/**
+ * @brief   Requests that a variable is written to the FRAM.
+ * @details The block is marked as pending and written by the next run of
+ *          #FRAM_WritePendingData(). Several requests for the same block are
+ *          merged into one write.
+ * @param   blockId ID of variable to write to FRAM
+ */
+extern void FRAM_RequestWrite(FRAM_BLOCK_ID_e blockId);
+
+/**
+ * @brief   Writes all pending variables to the FRAM.
+ * @details Runs as background job. Blocks that can not be written, because
+ *          the SPI interface or the CRC module is busy, stay pending and the
+ *          job is requested again.
+ */
+extern void FRAM_WritePendingData(void);
+
 /* The variable corresponding to the block_ID is written */
 /**
  * @brief   Reads a variable from the FRAM.
@@ -102,8 +144,19 @@ extern FRAM_RETURN_TYPE_e FRAM_WriteData(FRAM_BLOCK_ID_e blockId);
  */
 extern FRAM_RETURN_TYPE_e FRAM_ReadData(FRAM_BLOCK_ID_e blockId);
 
+/**
+ * @brief   Gets the statistics of the FRAM write accesses.
+ * @param   pStatistics pointer where the statistics are copied to
+ */
+extern void FRAM_GetStatistics(FRAM_STATISTICS_s *pStatistics);
+
+/** @brief  Resets the statistics of the FRAM write accesses. */
+extern void FRAM_ResetStatistics(void);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
+extern void TEST_FRAM_Reset(void);
+extern bool TEST_FRAM_IsWritePending(FRAM_BLOCK_ID_e blockId);
 #endif
 
 #endif /* FOXBMS__FRAM_H_ */
@@ -43,7 +43,7 @@
  * @file    i2c.c
  * @author  foxBMS Team
  * @date    2021-07-22 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  I2C
@@ -64,6 +64,7 @@
 #include "fsystem.h"
 #include "mcu.h"
 #include "os.h"
+#include "sys_mon_bus.h"
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -132,6 +133,12 @@ static uint32_t I2C_WaitForRxCompletedNotification(void);
  *
  */
 static void I2C_ClearNotifications(void);
+/**
+ * @brief   Returns the bus that records the statistics of an I2C interface
+ * @param   pI2cInterface I2C interface to use
+ * @return  bus of the bus statistics
+ */
+static SYSM_BUS_e I2C_GetStatisticsBus(i2cBASE_t *pI2cInterface);
 
 /*========== Static Function Implementations ================================*/
 static uint32_t I2C_GetWordTransmitTime(i2cBASE_t *pI2cInterface) {
@@ -218,6 +225,15 @@ static void I2C_ClearNotifications(void) {
     OS_ClearNotificationIndexed(I2C_NOTIFICATION_RX_INDEX);
 }
 
+static SYSM_BUS_e I2C_GetStatisticsBus(i2cBASE_t *pI2cInterface) {
+    FAS_ASSERT(pI2cInterface != NULL_PTR);
+    SYSM_BUS_e bus = SYSM_BUS_I2C1;
+    if (pI2cInterface == i2cREG2) {
+        bus = SYSM_BUS_I2C2;
+    }
+    return bus;
+}
+
 /*========== Extern Function Implementations ================================*/
 extern void I2C_Initialize(void) {
     i2cInit();
@@ -234,7 +250,11 @@ extern STD_RETURN_TYPE_e I2C_Read(
     FAS_ASSERT(slaveAddress < 128u);
     STD_RETURN_TYPE_e retVal = STD_OK;
 
+    const SYSM_BUS_e bus = I2C_GetStatisticsBus(pI2cInterface);
     if ((pI2cInterface->STR & (uint32_t)I2C_BUSBUSY) == 0u) {
+        SYSM_RecordBusAccess(bus);
+        SYSM_RecordBusTransfer(bus, nrBytes);
+
         /* Clear bits */
         pI2cInterface->MDR &= ~((uint32_t)I2C_STOP_COND);
         pI2cInterface->MDR &= ~((uint32_t)I2C_START_COND);
@@ -273,7 +293,9 @@ extern STD_RETURN_TYPE_e I2C_Read(
             i2cSetStop(pI2cInterface);
             retVal = STD_NOT_OK;
         }
+        SYSM_RecordBusRelease(bus);
     } else {
+        SYSM_RecordBusRejection(bus, SYSM_BUS_REJECTION_BUSY);
         retVal = STD_NOT_OK;
     }
 
@@ -291,7 +313,11 @@ extern STD_RETURN_TYPE_e I2C_Write(
     FAS_ASSERT(writeData != NULL_PTR);
     STD_RETURN_TYPE_e retVal = STD_OK;
 
+    const SYSM_BUS_e bus = I2C_GetStatisticsBus(pI2cInterface);
     if ((pI2cInterface->STR & (uint32_t)I2C_BUSBUSY) == 0u) {
+        SYSM_RecordBusAccess(bus);
+        SYSM_RecordBusTransfer(bus, nrBytes);
+
         /* Clear bits */
         pI2cInterface->MDR &= ~((uint32_t)I2C_STOP_COND);
         pI2cInterface->MDR &= ~((uint32_t)I2C_START_COND);
@@ -325,7 +351,9 @@ extern STD_RETURN_TYPE_e I2C_Write(
             i2cSetStop(pI2cInterface);
             retVal = STD_NOT_OK;
         }
+        SYSM_RecordBusRelease(bus);
     } else {
+        SYSM_RecordBusRejection(bus, SYSM_BUS_REJECTION_BUSY);
         retVal = STD_NOT_OK;
     }
 
@@ -347,7 +375,11 @@ extern STD_RETURN_TYPE_e I2C_WriteRead(
     FAS_ASSERT(slaveAddress < 128u);
     STD_RETURN_TYPE_e retVal = STD_OK;
 
+    const SYSM_BUS_e bus = I2C_GetStatisticsBus(pI2cInterface);
     if ((pI2cInterface->STR & (uint32_t)I2C_BUSBUSY) == 0u) {
+        SYSM_RecordBusAccess(bus);
+        SYSM_RecordBusTransfer(bus, nrBytesWrite + nrBytesRead);
+
         /* Clear bits */
         pI2cInterface->MDR &= ~((uint32_t)I2C_STOP_COND);
         pI2cInterface->MDR &= ~((uint32_t)I2C_START_COND);
@@ -405,7 +437,9 @@ extern STD_RETURN_TYPE_e I2C_WriteRead(
             i2cSetStop(pI2cInterface);
             retVal = STD_NOT_OK;
         }
+        SYSM_RecordBusRelease(bus);
     } else {
+        SYSM_RecordBusRejection(bus, SYSM_BUS_REJECTION_BUSY);
         retVal = STD_NOT_OK;
     }
 
@@ -425,7 +459,11 @@ extern STD_RETURN_TYPE_e I2C_ReadDma(
 
     I2C_ClearNotifications();
 
+    const SYSM_BUS_e bus = I2C_GetStatisticsBus(pI2cInterface);
     if ((pI2cInterface->STR & (uint32_t)I2C_BUSBUSY) == 0u) {
+        SYSM_RecordBusAccess(bus);
+        SYSM_RecordBusTransfer(bus, nrBytes);
+
         /* Clear bits */
         pI2cInterface->MDR &= ~((uint32_t)I2C_STOP_COND);
         pI2cInterface->MDR &= ~((uint32_t)I2C_START_COND);
@@ -500,7 +538,9 @@ extern STD_RETURN_TYPE_e I2C_ReadDma(
                 retVal = STD_NOT_OK;
             }
         }
+        SYSM_RecordBusRelease(bus);
     } else {
+        SYSM_RecordBusRejection(bus, SYSM_BUS_REJECTION_BUSY);
         retVal = STD_NOT_OK;
     }
 
@@ -520,7 +560,11 @@ extern STD_RETURN_TYPE_e I2C_WriteDma(
 
     I2C_ClearNotifications();
 
+    const SYSM_BUS_e bus = I2C_GetStatisticsBus(pI2cInterface);
     if ((pI2cInterface->STR & (uint32_t)I2C_BUSBUSY) == 0u) {
+        SYSM_RecordBusAccess(bus);
+        SYSM_RecordBusTransfer(bus, nrBytes);
+
         pI2cInterface->MDR &= ~((uint32_t)I2C_STOP_COND);
         pI2cInterface->MDR &= ~((uint32_t)I2C_START_COND);
         pI2cInterface->MDR &= ~((uint32_t)I2C_REPEATMODE);
@@ -589,7 +633,9 @@ extern STD_RETURN_TYPE_e I2C_WriteDma(
                 retVal = STD_NOT_OK;
             }
         }
+        SYSM_RecordBusRelease(bus);
     } else {
+        SYSM_RecordBusRejection(bus, SYSM_BUS_REJECTION_BUSY);
         retVal = STD_NOT_OK;
     }
 
@@ -615,7 +661,11 @@ extern STD_RETURN_TYPE_e I2C_WriteReadDma(
 
     I2C_ClearNotifications();
 
+    const SYSM_BUS_e bus = I2C_GetStatisticsBus(pI2cInterface);
     if ((pI2cInterface->STR & (uint32_t)I2C_BUSBUSY) == 0u) {
+        SYSM_RecordBusAccess(bus);
+        SYSM_RecordBusTransfer(bus, nrBytesWrite + nrBytesRead);
+
         /* First write bytes */
 
         /* Clear bits */
@@ -756,7 +806,9 @@ extern STD_RETURN_TYPE_e I2C_WriteReadDma(
                 }
             }
         }
+        SYSM_RecordBusRelease(bus);
     } else {
+        SYSM_RecordBusRejection(bus, SYSM_BUS_REJECTION_BUSY);
         retVal = STD_NOT_OK;
     }
 
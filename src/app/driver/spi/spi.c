@@ -43,7 +43,7 @@
  * @file    spi.c
  * @author  foxBMS Team
  * @date    2019-12-12 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  SPI
@@ -70,6 +70,7 @@
 #include "os.h"
 #include "spi_cfg-helper.h"
 #include "spi_cfg_initialization.h"
+#include "sys_mon_bus.h"
 
 #include <stdint.h>
 
@@ -77,6 +78,13 @@
 /** Bit field to check for transmission errors in SPI FLAG register */
 #define SPI_FLAG_REGISTER_TRANSMISSION_ERRORS (0x5Fu)
 
+/* the SPI interface index is used as bus of the bus statistics */
+FAS_STATIC_ASSERT((SPI_SPI1_INDEX == (uint8_t)SYSM_BUS_SPI1), "SPI1 index must match its bus statistics");
+FAS_STATIC_ASSERT((SPI_SPI2_INDEX == (uint8_t)SYSM_BUS_SPI2), "SPI2 index must match its bus statistics");
+FAS_STATIC_ASSERT((SPI_SPI3_INDEX == (uint8_t)SYSM_BUS_SPI3), "SPI3 index must match its bus statistics");
+FAS_STATIC_ASSERT((SPI_SPI4_INDEX == (uint8_t)SYSM_BUS_SPI4), "SPI4 index must match its bus statistics");
+FAS_STATIC_ASSERT((SPI_SPI5_INDEX == (uint8_t)SYSM_BUS_SPI5), "SPI5 index must match its bus statistics");
+
 /*========== Static Constant and Variable Definitions =======================*/
 static uint32_t spi_txLastWord[DMA_NUMBER_SPI_INTERFACES] = {0};
 
@@ -311,6 +319,7 @@ extern STD_RETURN_TYPE_e SPI_TransmitData(SPI_INTERFACE_CONFIG_s *pSpiInterface,
                 }
             }
         }
+        SYSM_RecordBusTransfer((SYSM_BUS_e)SPI_GetSpiIndex(pSpiInterface->pNode), frameLength);
         uint32_t spiRetval = spiTransmitData(pSpiInterface->pNode, pSpiInterface->pConfig, frameLength, pTxBuff);
         /** SW Chip Select */
         if (pSpiInterface->csType == SPI_CHIP_SELECT_SOFTWARE) {
@@ -368,6 +377,7 @@ extern STD_RETURN_TYPE_e SPI_TransmitReceiveData(
                 }
             }
         }
+        SYSM_RecordBusTransfer((SYSM_BUS_e)SPI_GetSpiIndex(pSpiInterface->pNode), frameLength);
         uint32_t spiRetval =
             spiTransmitAndReceiveData(pSpiInterface->pNode, pSpiInterface->pConfig, frameLength, pTxBuff, pRxBuff);
         /** SW Chip Select */
@@ -397,6 +407,8 @@ extern void SPI_FramTransmitReceiveData(
     FAS_ASSERT(pRxBuff != NULL_PTR);
     FAS_ASSERT(frameLength > 0u);
 
+    /* the caller has locked the interface */
+    SYSM_RecordBusTransfer((SYSM_BUS_e)SPI_GetSpiIndex(pSpiInterface->pNode), frameLength);
     (void)spiTransmitAndReceiveData(pSpiInterface->pNode, pSpiInterface->pConfig, frameLength, pTxBuff, pRxBuff);
 }
 
@@ -423,6 +435,9 @@ extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataDma(
 
         /* Check that not SPI transmission over DMA is taking place */
         if ((pSpiInterface->pNode->INT0 & DMA_REQUEST_ENABLE_BIT) == 0x0) {
+            /* the bus is released by the DMA Rx interrupt */
+            SYSM_RecordBusAccess((SYSM_BUS_e)spiIndex);
+            SYSM_RecordBusTransfer((SYSM_BUS_e)spiIndex, frameLength);
             /**
              *  Activate HW Chip Select according to bitmask register CSNR
              *  by setting pins as SPI functional pins
@@ -504,6 +519,8 @@ extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataDma(
 
             retVal = STD_OK;
         }
+    } else {
+        SYSM_RecordBusRejection((SYSM_BUS_e)spiIndex, SYSM_BUS_REJECTION_BUSY);
     }
     OS_ExitTaskCritical();
 
@@ -522,12 +539,19 @@ extern STD_RETURN_TYPE_e SPI_Lock(uint8_t spi) {
     }
     OS_ExitTaskCritical();
 
+    if (retVal == STD_OK) {
+        SYSM_RecordBusAccess((SYSM_BUS_e)spi);
+    } else {
+        SYSM_RecordBusRejection((SYSM_BUS_e)spi, SYSM_BUS_REJECTION_LOCK);
+    }
     return retVal;
 }
 
 extern void SPI_Unlock(uint8_t spi) {
     FAS_ASSERT(spi < spi_nrBusyFlags);
 
+    /* record the release while the interface is still owned by the caller */
+    SYSM_RecordBusRelease((SYSM_BUS_e)spi);
     OS_EnterTaskCritical();
     spi_busyFlags[spi] = SPI_IDLE;
     OS_ExitTaskCritical();
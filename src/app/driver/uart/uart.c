@@ -43,7 +43,7 @@
  * @file    uart.c
  * @author  foxBMS Team
  * @date    2025-08-12 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  UART
@@ -75,9 +75,11 @@
 #include "fstd_types.h"
 #include "fsystem.h"
 #include "ftask.h"
+#include "log.h"
 #include "os.h"
 #include "stdarg.h"
 #include "stdio.h"
+#include "trace.h"
 
 /*========== Macros and Definitions =========================================*/
 
@@ -107,7 +109,7 @@ static volatile bool uart_softwareFlowControlReceiving = true;
 /** variable to hold the byte received via the SCI Rx interrupt (sciReceive) */
 static uint8_t uart_rxData = 0u;
 
-/** buffer to format UART_Printf into */
+/** buffer to format UART_Printf into and to serialize log records into */
 static uint8_t uart_txBuffer[UART_PRINTF_BUFFER_SIZE] = {0};
 
 /*========== Extern Constant and Variable Definitions =======================*/
@@ -318,6 +320,42 @@ extern void UART_Printf(const char *const pcFormatString, ...) {
     }
 }
 
+extern void UART_TransmitLogRecords(void) {
+    /* Only try to get the uart_txSemaphore without waiting, as pending log
+     * records are transmitted again in the next cycle of the UART task */
+    if ((uart_softwareFlowControlSending) && (LOG_GetNumberOfPendingRecords() > 0u) &&
+        (OS_SemaphoreTake(uart_txSemaphore, 0u) == OS_SUCCESS)) {
+        const uint32_t numberOfBytes = LOG_ReadRecords(uart_txBuffer, UART_PRINTF_BUFFER_SIZE);
+
+        if (numberOfBytes > 0u) {
+            UART_Write(UART_REG, uart_txBuffer, (uint16_t)numberOfBytes);
+        } else {
+            /* if UART_Write is not called, the semaphore has to be
+             * returned explicitly */
+            OS_SemaphoreGive(uart_txSemaphore);
+        }
+    }
+}
+
+extern bool UART_TransmitTraceSnapshot(void) {
+    const bool snapshotPending = TRC_IsSnapshotPending();
+    /* Same as for the log records: do not wait for the uart_txSemaphore, the
+     * remaining part of the snapshot is transmitted in the next cycle */
+    if ((snapshotPending == true) && (uart_softwareFlowControlSending) &&
+        (OS_SemaphoreTake(uart_txSemaphore, 0u) == OS_SUCCESS)) {
+        const uint32_t numberOfBytes = TRC_ReadSnapshot(uart_txBuffer, UART_PRINTF_BUFFER_SIZE);
+
+        if (numberOfBytes > 0u) {
+            UART_Write(UART_REG, uart_txBuffer, (uint16_t)numberOfBytes);
+        } else {
+            /* if UART_Write is not called, the semaphore has to be
+             * returned explicitly */
+            OS_SemaphoreGive(uart_txSemaphore);
+        }
+    }
+    return snapshotPending;
+}
+
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
 
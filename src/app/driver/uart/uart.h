@@ -43,7 +43,7 @@
  * @file    uart.h
  * @author  foxBMS Team
  * @date    2025-08-12 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  UART
@@ -62,6 +62,8 @@
 
 #include "os.h"
 
+#include <stdbool.h>
+
 /*========== Macros and Definitions =========================================*/
 
 /** Values of the SW flow control flags */
@@ -109,6 +111,25 @@ extern void UART_HandleFlowControl(void);
  */
 extern void UART_Printf(const char *const pcFormatString, ...);
 
+/**
+ * @brief   Transmits the pending records of the binary log via UART.
+ * @details The records are serialized into the UART transmit buffer and sent
+ *          via DMA. The function does not block: if the uart_txSemaphore is
+ *          not available, the records are transmitted on the next call.
+ * @note    UART_TransmitLogRecords is called cyclically from the UART task.
+ */
+extern void UART_TransmitLogRecords(void);
+
+/**
+ * @brief   Transmits the next part of a frozen kernel trace snapshot via UART.
+ * @details Works like UART_TransmitLogRecords(), but serializes the snapshot
+ *          of the trace recorder (see trace.h) into the UART transmit buffer.
+ * @note    UART_TransmitTraceSnapshot is called cyclically from the UART task.
+ * @return  true if a snapshot is pending, i.e., the caller shall hold back
+ *          other binary output, otherwise false
+ */
+extern bool UART_TransmitTraceSnapshot(void);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
 
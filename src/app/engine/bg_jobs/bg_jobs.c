@@ -0,0 +1,204 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    bg_jobs.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE
+ * @prefix  BGJ
+ *
+ * @brief   Background jobs that are run when the CPU is idle
+ * @details A job is taken inside a task critical section and executed
+ *          outside of it. The running flag prevents that the idle hook and
+ *          the cyclic task execute the same job concurrently.
+ */
+
+/*========== Includes =======================================================*/
+#include "bg_jobs.h"
+
+#include "fassert.h"
+#include "fstd_types.h"
+#include "os.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** state of one background job */
+typedef struct {
+    bool isPending;               /*!< job has been requested and not yet started */
+    bool isRunning;               /*!< job is currently executed */
+    uint32_t requestTimestamp_ms; /*!< time of the first request that is still pending */
+} BGJ_JOB_STATE_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/** state of the background jobs, indexed by #BGJ_JOB_ID_e */
+static BGJ_JOB_STATE_s bgj_state[BGJ_JOB_ID_E_MAX] = {0};
+
+/** execution statistics of the background jobs, indexed by #BGJ_JOB_ID_e */
+static BGJ_STATISTICS_s bgj_statistics[BGJ_JOB_ID_E_MAX] = {0};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/**
+ * @brief   Takes the pending job with the earliest deadline.
+ * @details The job is marked as running and its statistics are updated.
+ * @param   pHasRun     jobs that have already been run in this call and
+ *                      shall not be taken again
+ * @param   onlyOverdue true to only take jobs whose deadline has passed
+ * @return  taken job, #BGJ_JOB_ID_E_MAX if there is none
+ */
+static BGJ_JOB_ID_e BGJ_TakeNextJob(const bool *pHasRun, bool onlyOverdue);
+
+/**
+ * @brief   Runs pending jobs until there is none left to take.
+ * @param   onlyOverdue true to only run jobs whose deadline has passed
+ */
+static void BGJ_RunJobs(bool onlyOverdue);
+
+/*========== Static Function Implementations ================================*/
+static BGJ_JOB_ID_e BGJ_TakeNextJob(const bool *pHasRun, bool onlyOverdue) {
+    FAS_ASSERT(pHasRun != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: onlyOverdue: parameter accepts whole range */
+
+    BGJ_JOB_ID_e nextJob          = BGJ_JOB_ID_E_MAX;
+    uint32_t nextRemainingTime_ms = UINT32_MAX;
+
+    OS_EnterTaskCritical();
+    const uint32_t now_ms = OS_GetTickCount();
+    for (uint8_t jobId = 0u; jobId < (uint8_t)BGJ_JOB_ID_E_MAX; jobId++) {
+        const BGJ_JOB_STATE_s *const pState = &bgj_state[jobId];
+        if ((pState->isPending == true) && (pState->isRunning == false) && (pHasRun[jobId] == false)) {
+            const uint32_t elapsed_ms  = now_ms - pState->requestTimestamp_ms;
+            const uint32_t deadline_ms = bgj_jobConfiguration[jobId].deadline_ms;
+            uint32_t remainingTime_ms  = 0u;
+            if (elapsed_ms < deadline_ms) {
+                remainingTime_ms = deadline_ms - elapsed_ms;
+            }
+            if (((onlyOverdue == false) || (remainingTime_ms == 0u)) && (remainingTime_ms < nextRemainingTime_ms)) {
+                nextJob              = (BGJ_JOB_ID_e)jobId;
+                nextRemainingTime_ms = remainingTime_ms;
+            }
+        }
+    }
+    if (nextJob != BGJ_JOB_ID_E_MAX) {
+        BGJ_JOB_STATE_s *const pState       = &bgj_state[nextJob];
+        BGJ_STATISTICS_s *const pStatistics = &bgj_statistics[nextJob];
+        const uint32_t latency_ms           = now_ms - pState->requestTimestamp_ms;
+        pState->isPending                   = false;
+        pState->isRunning                   = true;
+        pStatistics->executions++;
+        if (latency_ms > bgj_jobConfiguration[nextJob].deadline_ms) {
+            pStatistics->deadlineMisses++;
+        }
+        if (latency_ms > pStatistics->maximumLatency_ms) {
+            pStatistics->maximumLatency_ms = latency_ms;
+        }
+    }
+    OS_ExitTaskCritical();
+    return nextJob;
+}
+
+static void BGJ_RunJobs(bool onlyOverdue) {
+    /* AXIVION Routine Generic-MissingParameterAssert: onlyOverdue: parameter accepts whole range */
+    bool hasRun[BGJ_JOB_ID_E_MAX] = {false};
+
+    /* every job is run at most once, so that a job that requests itself again does not block the caller */
+    for (uint8_t i = 0u; i < (uint8_t)BGJ_JOB_ID_E_MAX; i++) {
+        const BGJ_JOB_ID_e jobId = BGJ_TakeNextJob(hasRun, onlyOverdue);
+        if (jobId == BGJ_JOB_ID_E_MAX) {
+            break;
+        }
+        bgj_jobConfiguration[jobId].job();
+        OS_EnterTaskCritical();
+        bgj_state[jobId].isRunning = false;
+        OS_ExitTaskCritical();
+        hasRun[jobId] = true;
+    }
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void BGJ_Request(BGJ_JOB_ID_e jobId) {
+    FAS_ASSERT(jobId < BGJ_JOB_ID_E_MAX);
+
+    OS_EnterTaskCritical();
+    if (bgj_state[jobId].isPending == true) {
+        bgj_statistics[jobId].coalescedRequests++;
+    } else {
+        bgj_state[jobId].isPending           = true;
+        bgj_state[jobId].requestTimestamp_ms = OS_GetTickCount();
+    }
+    OS_ExitTaskCritical();
+}
+
+extern void BGJ_RunPendingJobs(void) {
+    BGJ_RunJobs(false);
+}
+
+extern void BGJ_RunOverdueJobs(void) {
+    BGJ_RunJobs(true);
+}
+
+extern void BGJ_GetStatistics(BGJ_JOB_ID_e jobId, BGJ_STATISTICS_s *pStatistics) {
+    FAS_ASSERT(jobId < BGJ_JOB_ID_E_MAX);
+    FAS_ASSERT(pStatistics != NULL_PTR);
+
+    OS_EnterTaskCritical();
+    *pStatistics = bgj_statistics[jobId];
+    OS_ExitTaskCritical();
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_BGJ_Reset(void) {
+    (void)memset((void *)bgj_state, 0, sizeof(bgj_state));
+    (void)memset((void *)bgj_statistics, 0, sizeof(bgj_statistics));
+}
+#endif
@@ -0,0 +1,121 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    bg_jobs.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE
+ * @prefix  BGJ
+ *
+ * @brief   Background jobs that are run when the CPU is idle
+ * @details Non-urgent work (e.g., FRAM writes and statistics) is requested
+ *          with #BGJ_Request() and done by #BGJ_RunPendingJobs() from the idle
+ *          hook instead of in the cyclic tasks. Requests for a job that is
+ *          already pending are coalesced into one execution. Pending jobs are
+ *          run in the order of their deadlines; a job that has not been run
+ *          until its deadline is run by #BGJ_RunOverdueJobs() from a cyclic
+ *          task, so that the latency is bounded even if the CPU is never idle.
+ */
+
+#ifndef FOXBMS__BG_JOBS_H_
+#define FOXBMS__BG_JOBS_H_
+
+/*========== Includes =======================================================*/
+#include "bg_jobs_cfg.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** execution statistics of one background job */
+typedef struct {
+    uint32_t executions;        /*!< number of executions */
+    uint32_t coalescedRequests; /*!< number of requests while the job was already pending */
+    uint32_t deadlineMisses;    /*!< number of executions that started after the deadline */
+    uint32_t maximumLatency_ms; /*!< longest time from the request until the start of the job */
+} BGJ_STATISTICS_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/**
+ * @brief   Requests the execution of a background job.
+ * @details If the job is already pending, the request is coalesced with the
+ *          pending one and the deadline of the first request is kept. A
+ *          request during the execution of the job leads to another
+ *          execution. Shall only be called from task context.
+ * @param   jobId   background job
+ */
+extern void BGJ_Request(BGJ_JOB_ID_e jobId);
+
+/**
+ * @brief   Runs the pending background jobs.
+ * @details Every pending job is run at most once per call, the job with the
+ *          earliest deadline first. Intended to be called from the idle hook.
+ */
+extern void BGJ_RunPendingJobs(void);
+
+/**
+ * @brief   Runs the pending background jobs whose deadline has passed.
+ * @details Intended to be called periodically from a cyclic task; it only
+ *          does work if the CPU has not been idle long enough to run the jobs
+ *          in time.
+ */
+extern void BGJ_RunOverdueJobs(void);
+
+/**
+ * @brief   Copies the execution statistics of a background job.
+ * @param   jobId       background job
+ * @param   pStatistics pointer to where the statistics are copied
+ */
+extern void BGJ_GetStatistics(BGJ_JOB_ID_e jobId, BGJ_STATISTICS_s *pStatistics);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_BGJ_Reset(void);
+#endif
+
+#endif /* FOXBMS__BG_JOBS_H_ */
@@ -0,0 +1,108 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    bg_jobs_cfg.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE_CONFIGURATION
+ * @prefix  BGJ
+ *
+ * @brief   Configuration of the background jobs
+ * @details Every job is started at the latest #BGJ_JOB_CONFIG_s::deadline_ms
+ *          after its first pending request. Jobs that are still pending at
+ *          their deadline, because the CPU did not become idle, are run by
+ *          #BGJ_RunOverdueJobs() in the 100 ms task. The deadlines therefore
+ *          should not be shorter than 100 ms.
+ */
+
+#ifndef FOXBMS__BG_JOBS_CFG_H_
+#define FOXBMS__BG_JOBS_CFG_H_
+
+/*========== Includes =======================================================*/
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** deadline for committing the timing violation record of sys_mon to FRAM */
+#define BGJ_SYS_MON_FRAM_UPDATE_DEADLINE_ms (100u)
+
+/** deadline for writing the pending FRAM blocks */
+#define BGJ_FRAM_WRITE_DEADLINE_ms (100u)
+
+/** deadline for updating the stack usage of the tasks (requested every 1 s) */
+#define BGJ_STACK_USAGE_DEADLINE_ms (1000u)
+
+/**
+ * @brief   function of a background job
+ * @details A job that cannot finish its work (e.g., because the FRAM is
+ *          busy) requests itself again with #BGJ_Request().
+ */
+typedef void (*BGJ_JobFunction_f)(void);
+
+/** background jobs */
+typedef enum {
+    BGJ_JOB_ID_SYS_MON_FRAM_UPDATE, /*!< commit the sys_mon timing violation record to FRAM */
+    BGJ_JOB_ID_FRAM_WRITE,          /*!< write the pending FRAM blocks */
+    BGJ_JOB_ID_STACK_USAGE,         /*!< update the maximum stack usage of the tasks */
+    BGJ_JOB_ID_E_MAX,               /*!< number of background jobs */
+} BGJ_JOB_ID_e;
+
+/** configuration of one background job */
+typedef struct {
+    BGJ_JobFunction_f job; /*!< function that does the work */
+    uint32_t deadline_ms;  /*!< time after the request until the job has to be started */
+} BGJ_JOB_CONFIG_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/** configuration of the background jobs, indexed by #BGJ_JOB_ID_e */
+extern const BGJ_JOB_CONFIG_s bgj_jobConfiguration[BGJ_JOB_ID_E_MAX];
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__BG_JOBS_CFG_H_ */
@@ -43,7 +43,7 @@
  * @file    database_cfg.c
  * @author  foxBMS Team
  * @date    2015-08-18 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup ENGINE_CONFIGURATION
  * @prefix  DATA
@@ -55,14 +55,72 @@
 /*========== Includes =======================================================*/
 #include "database_cfg.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
+/** entry of the database table for a data block */
+#define DATA_DATABASE_ENTRY(block) \
+    { (void *)(&(block)), sizeof(block) }
+
+/**
+ * @brief   checks the layout assumptions that the database makes for a data
+ *          block type
+ * @details The database reads the uniqueId through a pointer to the data
+ *          block header, therefore the header has to be the first member.
+ *          Data blocks are copied as a whole on every access, therefore their
+ *          size has to be a multiple of the word size.
+ */
+#define DATA_ASSERT_BLOCK_LAYOUT(type)                                                           \
+    FAS_STATIC_ASSERT(offsetof(type, header) == 0u, "Header is not the first member of " #type); \
+    FAS_STATIC_ASSERT((sizeof(type) % sizeof(uint32_t)) == 0u, "Size of " #type " is not word aligned")
+
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_CELL_VOLTAGE_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_CELL_TEMPERATURE_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_MIN_MAX_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_CURRENT_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_CURRENT_SENSOR_TEMPERATURE_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_POWER_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_CURRENT_COUNTER_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_ENERGY_COUNTER_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_CURRENT_INTEGRATION_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_SYSTEM_VOLTAGE_1_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_SYSTEM_VOLTAGE_2_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_SYSTEM_VOLTAGE_3_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_BALANCING_CONTROL_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_SLAVE_CONTROL_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_BALANCING_FEEDBACK_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_OPEN_WIRE_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_ALL_GPIO_VOLTAGES_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_ERROR_STATE_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_CONTACTOR_FEEDBACK_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_INTERLOCK_FEEDBACK_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_SOF_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_SYSTEM_STATE_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_MSL_FLAG_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_RSL_FLAG_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_MOL_FLAG_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_SOC_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_SOH_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_SOE_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_STATE_REQUEST_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_MOVING_AVERAGE_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_INSULATION_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_PACK_VALUES_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_ADC_VOLTAGE_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_HTSEN_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_DUMMY_FOR_SELF_TEST_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_AEROSOL_SENSOR_s);
+DATA_ASSERT_BLOCK_LAYOUT(DATA_BLOCK_PHY_s);
 
 /*========== Static Constant and Variable Definitions =======================*/
 
 /*========== Extern Constant and Variable Definitions =======================*/
 
+/* All data blocks are placed in a dedicated section, see the linker script
+ * for the memory region they are located in. */
+#pragma SET_DATA_SECTION(".databaseRAM")
+
 /** data block: cell voltage */
 /**@{*/
 static DATA_BLOCK_CELL_VOLTAGE_s data_blockCellVoltage     = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
@@ -94,6 +152,9 @@ static DATA_BLOCK_POWER_s data_blockPower = {.header.uniqueId = DATA_BLOCK_ID_PO
 static DATA_BLOCK_CURRENT_COUNTER_s data_blockCurrentCounter = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_COUNTER};
 /** data block: sensor based energy counting */
 static DATA_BLOCK_ENERGY_COUNTER_s data_blockEnergyCounter = {.header.uniqueId = DATA_BLOCK_ID_ENERGY_COUNTER};
+/** data block: software based charge and energy integration */
+static DATA_BLOCK_CURRENT_INTEGRATION_s data_blockCurrentIntegration = {
+    .header.uniqueId = DATA_BLOCK_ID_CURRENT_INTEGRATION};
 /** data block: system voltage 1 */
 static DATA_BLOCK_SYSTEM_VOLTAGE_1_s data_blockSystemVoltage1 = {.header.uniqueId = DATA_BLOCK_ID_SYSTEM_VOLTAGE_1};
 /** data block: system voltage 2 */
@@ -173,7 +234,7 @@ static DATA_BLOCK_MOVING_AVERAGE_s data_blockMovingAverage = {.header.uniqueId =
 /** data block: insulation monitoring */
 static DATA_BLOCK_INSULATION_s data_blockInsulation = {.header.uniqueId = DATA_BLOCK_ID_INSULATION};
 
-/** data b  lock: pack values */
+/** data block: pack values */
 static DATA_BLOCK_PACK_VALUES_s data_blockPackValues = {.header.uniqueId = DATA_BLOCK_ID_PACK_VALUES};
 
 /** data block: adc temperature */
@@ -191,56 +252,60 @@ static DATA_BLOCK_AEROSOL_SENSOR_s data_blockAerosolSensor = {.header.uniqueId =
 
 /** data block: aerosol sensor */
 static DATA_BLOCK_PHY_s data_blockPhy = {.header.uniqueId = DATA_BLOCK_ID_PHY};
+#pragma SET_DATA_SECTION()
 
 /**
  * @brief   database configuration (i.e., included data blocks)
  * @details all data block managed by database are listed here (i.e., their
- *          address and size)
+ *          address and size). The entries are indexed by their uniqueId, so
+ *          that the database can look up an entry without a translation
+ *          table.
  */
-DATA_BASE_s data_database[] = {
-    {(void *)(&data_blockCellVoltage), sizeof(DATA_BLOCK_CELL_VOLTAGE_s)},
-    {(void *)(&data_blockCellTemperature), sizeof(DATA_BLOCK_CELL_TEMPERATURE_s)},
-    {(void *)(&data_blockMinMax), sizeof(DATA_BLOCK_MIN_MAX_s)},
-    {(void *)(&data_blockCurrent), sizeof(DATA_BLOCK_CURRENT_s)},
-    {(void *)(&data_blockCurrentSensorTemperature), sizeof(DATA_BLOCK_CURRENT_SENSOR_TEMPERATURE_s)},
-    {(void *)(&data_blockPower), sizeof(DATA_BLOCK_POWER_s)},
-    {(void *)(&data_blockCurrentCounter), sizeof(DATA_BLOCK_CURRENT_COUNTER_s)},
-    {(void *)(&data_blockEnergyCounter), sizeof(DATA_BLOCK_ENERGY_COUNTER_s)},
-    {(void *)(&data_blockSystemVoltage1), sizeof(DATA_BLOCK_SYSTEM_VOLTAGE_1_s)},
-    {(void *)(&data_blockSystemVoltage2), sizeof(DATA_BLOCK_SYSTEM_VOLTAGE_2_s)},
-    {(void *)(&data_blockSystemVoltage3), sizeof(DATA_BLOCK_SYSTEM_VOLTAGE_3_s)},
-    {(void *)(&data_blockControlBalancing), sizeof(DATA_BLOCK_BALANCING_CONTROL_s)},
-    {(void *)(&data_blockSlaveControl), sizeof(DATA_BLOCK_SLAVE_CONTROL_s)},
-    {(void *)(&data_blockFeedbackBalancingBase), sizeof(DATA_BLOCK_BALANCING_FEEDBACK_s)},
-    {(void *)(&data_blockOpenWireBase), sizeof(DATA_BLOCK_OPEN_WIRE_s)},
-    {(void *)(&data_blockAllGpioVoltagesBase), sizeof(DATA_BLOCK_ALL_GPIO_VOLTAGES_s)},
-    {(void *)(&data_blockErrors), sizeof(DATA_BLOCK_ERROR_STATE_s)},
-    {(void *)(&data_blockContactorFeedback), sizeof(DATA_BLOCK_CONTACTOR_FEEDBACK_s)},
-    {(void *)(&data_blockInterlockFeedback), sizeof(DATA_BLOCK_INTERLOCK_FEEDBACK_s)},
-    {(void *)(&data_blockSof), sizeof(DATA_BLOCK_SOF_s)},
-    {(void *)(&data_blockSystemState), sizeof(DATA_BLOCK_SYSTEM_STATE_s)},
-    {(void *)(&data_blockMsl), sizeof(DATA_BLOCK_MSL_FLAG_s)},
-    {(void *)(&data_blockRsl), sizeof(DATA_BLOCK_RSL_FLAG_s)},
-    {(void *)(&data_blockMol), sizeof(DATA_BLOCK_MOL_FLAG_s)},
-    {(void *)(&data_blockSoc), sizeof(DATA_BLOCK_SOC_s)},
-    {(void *)(&data_blockSoh), sizeof(DATA_BLOCK_SOH_s)},
-    {(void *)(&data_blockSoe), sizeof(DATA_BLOCK_SOE_s)},
-    {(void *)(&data_blockStateRequest), sizeof(DATA_BLOCK_STATE_REQUEST_s)},
-    {(void *)(&data_blockMovingAverage), sizeof(DATA_BLOCK_MOVING_AVERAGE_s)},
-    {(void *)(&data_blockCellVoltageBase), sizeof(DATA_BLOCK_CELL_VOLTAGE_s)},
-    {(void *)(&data_blockCellTemperatureBase), sizeof(DATA_BLOCK_CELL_TEMPERATURE_s)},
-    {(void *)(&data_blockCellVoltageRedundancy0), sizeof(DATA_BLOCK_CELL_VOLTAGE_s)},
-    {(void *)(&data_blockCellTemperatureRedundancy0), sizeof(DATA_BLOCK_CELL_TEMPERATURE_s)},
-    {(void *)(&data_blockFeedbackBalancingRedundancy0), sizeof(DATA_BLOCK_BALANCING_FEEDBACK_s)},
-    {(void *)(&data_blockAllGpioVoltagesRedundancy0), sizeof(DATA_BLOCK_ALL_GPIO_VOLTAGES_s)},
-    {(void *)(&data_blockOpenWireRedundancy0), sizeof(DATA_BLOCK_OPEN_WIRE_s)},
-    {(void *)(&data_blockInsulation), sizeof(DATA_BLOCK_INSULATION_s)},
-    {(void *)(&data_blockPackValues), sizeof(DATA_BLOCK_PACK_VALUES_s)},
-    {(void *)(&data_blockAdcVoltage), sizeof(DATA_BLOCK_ADC_VOLTAGE_s)},
-    {(void *)(&data_blockHumidityTemperatureSensor), sizeof(DATA_BLOCK_HTSEN_s)},
-    {(void *)(&data_blockDummyForSelfTest), sizeof(DATA_BLOCK_DUMMY_FOR_SELF_TEST_s)},
-    {(void *)(&data_blockAerosolSensor), sizeof(DATA_BLOCK_AEROSOL_SENSOR_s)},
-    {(void *)(&data_blockPhy), sizeof(DATA_BLOCK_PHY_s)},
+DATA_BASE_s data_database[DATA_BLOCK_ID_MAX] = {
+    [DATA_BLOCK_ID_ADC_VOLTAGE]                    = DATA_DATABASE_ENTRY(data_blockAdcVoltage),
+    [DATA_BLOCK_ID_AEROSOL_SENSOR]                 = DATA_DATABASE_ENTRY(data_blockAerosolSensor),
+    [DATA_BLOCK_ID_ALL_GPIO_VOLTAGES_BASE]         = DATA_DATABASE_ENTRY(data_blockAllGpioVoltagesBase),
+    [DATA_BLOCK_ID_ALL_GPIO_VOLTAGES_REDUNDANCY0]  = DATA_DATABASE_ENTRY(data_blockAllGpioVoltagesRedundancy0),
+    [DATA_BLOCK_ID_BALANCING_CONTROL]              = DATA_DATABASE_ENTRY(data_blockControlBalancing),
+    [DATA_BLOCK_ID_BALANCING_FEEDBACK_BASE]        = DATA_DATABASE_ENTRY(data_blockFeedbackBalancingBase),
+    [DATA_BLOCK_ID_BALANCING_FEEDBACK_REDUNDANCY0] = DATA_DATABASE_ENTRY(data_blockFeedbackBalancingRedundancy0),
+    [DATA_BLOCK_ID_CELL_TEMPERATURE]               = DATA_DATABASE_ENTRY(data_blockCellTemperature),
+    [DATA_BLOCK_ID_CELL_TEMPERATURE_BASE]          = DATA_DATABASE_ENTRY(data_blockCellTemperatureBase),
+    [DATA_BLOCK_ID_CELL_TEMPERATURE_REDUNDANCY0]   = DATA_DATABASE_ENTRY(data_blockCellTemperatureRedundancy0),
+    [DATA_BLOCK_ID_CELL_VOLTAGE]                   = DATA_DATABASE_ENTRY(data_blockCellVoltage),
+    [DATA_BLOCK_ID_CELL_VOLTAGE_BASE]              = DATA_DATABASE_ENTRY(data_blockCellVoltageBase),
+    [DATA_BLOCK_ID_CELL_VOLTAGE_REDUNDANCY0]       = DATA_DATABASE_ENTRY(data_blockCellVoltageRedundancy0),
+    [DATA_BLOCK_ID_CONTACTOR_FEEDBACK]             = DATA_DATABASE_ENTRY(data_blockContactorFeedback),
+    [DATA_BLOCK_ID_CURRENT]                        = DATA_DATABASE_ENTRY(data_blockCurrent),
+    [DATA_BLOCK_ID_CURRENT_SENSOR_TEMPERATURE]     = DATA_DATABASE_ENTRY(data_blockCurrentSensorTemperature),
+    [DATA_BLOCK_ID_POWER]                          = DATA_DATABASE_ENTRY(data_blockPower),
+    [DATA_BLOCK_ID_CURRENT_COUNTER]                = DATA_DATABASE_ENTRY(data_blockCurrentCounter),
+    [DATA_BLOCK_ID_ENERGY_COUNTER]                 = DATA_DATABASE_ENTRY(data_blockEnergyCounter),
+    [DATA_BLOCK_ID_SYSTEM_VOLTAGE_1]               = DATA_DATABASE_ENTRY(data_blockSystemVoltage1),
+    [DATA_BLOCK_ID_SYSTEM_VOLTAGE_2]               = DATA_DATABASE_ENTRY(data_blockSystemVoltage2),
+    [DATA_BLOCK_ID_SYSTEM_VOLTAGE_3]               = DATA_DATABASE_ENTRY(data_blockSystemVoltage3),
+    [DATA_BLOCK_ID_DUMMY_FOR_SELF_TEST]            = DATA_DATABASE_ENTRY(data_blockDummyForSelfTest),
+    [DATA_BLOCK_ID_ERROR_STATE]                    = DATA_DATABASE_ENTRY(data_blockErrors),
+    [DATA_BLOCK_ID_HTSEN]                          = DATA_DATABASE_ENTRY(data_blockHumidityTemperatureSensor),
+    [DATA_BLOCK_ID_INSULATION]                     = DATA_DATABASE_ENTRY(data_blockInsulation),
+    [DATA_BLOCK_ID_INTERLOCK_FEEDBACK]             = DATA_DATABASE_ENTRY(data_blockInterlockFeedback),
+    [DATA_BLOCK_ID_MIN_MAX]                        = DATA_DATABASE_ENTRY(data_blockMinMax),
+    [DATA_BLOCK_ID_MOL_FLAG]                       = DATA_DATABASE_ENTRY(data_blockMol),
+    [DATA_BLOCK_ID_MOVING_AVERAGE]                 = DATA_DATABASE_ENTRY(data_blockMovingAverage),
+    [DATA_BLOCK_ID_MSL_FLAG]                       = DATA_DATABASE_ENTRY(data_blockMsl),
+    [DATA_BLOCK_ID_OPEN_WIRE_BASE]                 = DATA_DATABASE_ENTRY(data_blockOpenWireBase),
+    [DATA_BLOCK_ID_OPEN_WIRE_REDUNDANCY0]          = DATA_DATABASE_ENTRY(data_blockOpenWireRedundancy0),
+    [DATA_BLOCK_ID_PACK_VALUES]                    = DATA_DATABASE_ENTRY(data_blockPackValues),
+    [DATA_BLOCK_ID_RSL_FLAG]                       = DATA_DATABASE_ENTRY(data_blockRsl),
+    [DATA_BLOCK_ID_SLAVE_CONTROL]                  = DATA_DATABASE_ENTRY(data_blockSlaveControl),
+    [DATA_BLOCK_ID_SOC]                            = DATA_DATABASE_ENTRY(data_blockSoc),
+    [DATA_BLOCK_ID_SOE]                            = DATA_DATABASE_ENTRY(data_blockSoe),
+    [DATA_BLOCK_ID_SOF]                            = DATA_DATABASE_ENTRY(data_blockSof),
+    [DATA_BLOCK_ID_SOH]                            = DATA_DATABASE_ENTRY(data_blockSoh),
+    [DATA_BLOCK_ID_STATE_REQUEST]                  = DATA_DATABASE_ENTRY(data_blockStateRequest),
+    [DATA_BLOCK_ID_SYSTEM_STATE]                   = DATA_DATABASE_ENTRY(data_blockSystemState),
+    [DATA_BLOCK_ID_PHY]                            = DATA_DATABASE_ENTRY(data_blockPhy),
+    [DATA_BLOCK_ID_CURRENT_INTEGRATION]            = DATA_DATABASE_ENTRY(data_blockCurrentIntegration),
 };
 
 /*========== Static Function Prototypes =====================================*/
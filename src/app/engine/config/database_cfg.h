@@ -43,7 +43,7 @@
  * @file    database_cfg.h
  * @author  foxBMS Team
  * @date    2015-08-18 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup ENGINE_CONFIGURATION
  * @prefix  DATA
@@ -60,6 +60,7 @@
 #include "battery_system_cfg.h"
 #include "bms-slave_cfg.h"
 
+#include "fbitset.h"
 #include "mcu.h"
 
 #include <math.h>
@@ -118,6 +119,7 @@ typedef enum {
     DATA_BLOCK_ID_STATE_REQUEST,
     DATA_BLOCK_ID_SYSTEM_STATE,
     DATA_BLOCK_ID_PHY,
+    DATA_BLOCK_ID_CURRENT_INTEGRATION,
     DATA_BLOCK_ID_MAX, /**< DO NOT CHANGE, MUST BE THE LAST ENTRY */
 } DATA_BLOCK_ID_e;
 
@@ -126,11 +128,22 @@ FAS_STATIC_ASSERT(
     "Maximum number of database entries exceeds UINT8_MAX; adapted length "
     "checking in DATA_Initialize and DATA_IterateOverDatabaseEntries");
 
+/* the per-cell and per-sensor flags of a module are stored in one bitset word */
+FAS_STATIC_ASSERT(
+    (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1u) <= BITSET_BITS_PER_WORD,
+    "The sense wires of a module do not fit into one bitset word.");
+FAS_STATIC_ASSERT(
+    BS_NR_OF_TEMP_SENSORS_PER_MODULE <= BITSET_BITS_PER_WORD,
+    "The temperature sensors of a module do not fit into one bitset word.");
+
 /** data block header */
 typedef struct {
     DATA_BLOCK_ID_e uniqueId;   /*!< uniqueId of database entry */
     uint32_t timestamp;         /*!< timestamp of last database update */
     uint32_t previousTimestamp; /*!< timestamp of previous database update */
+    /** free running counter value (see #MCU_GetFreeRunningCount) at the
+     *  start of the acquisition the data originates from, 0 if unknown */
+    uint32_t acquisitionTimestamp;
 } DATA_BLOCK_HEADER_s;
 
 /** data block struct of cell voltage */
@@ -144,8 +157,8 @@ typedef struct {
     bool invalidStringVoltage[BS_NR_OF_STRINGS]; /*!< false -> valid, true -> invalid */
     int16_t cellVoltage_mV[BS_NR_OF_STRINGS][BS_NR_OF_MODULES_PER_STRING]
                           [BS_NR_OF_CELL_BLOCKS_PER_MODULE]; /*!< cell voltage */
-    bool invalidCellVoltage[BS_NR_OF_STRINGS][BS_NR_OF_MODULES_PER_STRING]
-                           [BS_NR_OF_CELL_BLOCKS_PER_MODULE];                 /*!< false -> valid, true -> invalid */
+    /** bit cb of each module: 0 -> cell voltage valid, 1 -> cell voltage invalid */
+    BITSET_WORD_t invalidCellVoltage[BS_NR_OF_STRINGS][BS_NR_OF_MODULES_PER_STRING];
     uint16_t nrValidCellVoltages[BS_NR_OF_STRINGS];                           /*!< number of valid voltages */
     uint32_t moduleVoltage_mV[BS_NR_OF_STRINGS][BS_NR_OF_MODULES_PER_STRING]; /*!< cumulated cell voltage per module */
     bool invalidModuleVoltage[BS_NR_OF_STRINGS][BS_NR_OF_MODULES_PER_STRING]; /*!< false -> valid, true -> invalid */
@@ -160,9 +173,9 @@ typedef struct {
     uint8_t state;              /*!< for future use */
     int16_t cellTemperature_ddegC[BS_NR_OF_STRINGS][BS_NR_OF_MODULES_PER_STRING]
                                  [BS_NR_OF_TEMP_SENSORS_PER_MODULE]; /*!< unit: deci &deg;C */
-    bool invalidCellTemperature[BS_NR_OF_STRINGS][BS_NR_OF_MODULES_PER_STRING]
-                               [BS_NR_OF_TEMP_SENSORS_PER_MODULE]; /*!< false -> valid, true -> invalid */
-    uint16_t nrValidTemperatures[BS_NR_OF_STRINGS];                /*!< number of valid temperatures in each string */
+    /** bit ts of each module: 0 -> cell temperature valid, 1 -> cell temperature invalid */
+    BITSET_WORD_t invalidCellTemperature[BS_NR_OF_STRINGS][BS_NR_OF_MODULES_PER_STRING];
+    uint16_t nrValidTemperatures[BS_NR_OF_STRINGS]; /*!< number of valid temperatures in each string */
 } DATA_BLOCK_CELL_TEMPERATURE_s;
 
 /** data block struct of minimum and maximum values */
@@ -276,6 +289,22 @@ typedef struct {
     uint32_t timestamp[BS_NR_OF_STRINGS];         /*!< timestamp of EC measurement */
 } DATA_BLOCK_ENERGY_COUNTER_s;
 
+/** data block struct of the software charge and energy integration */
+typedef struct {
+    /* This struct needs to be at the beginning of every database entry. During
+     * the initialization of a database struct, uniqueId must be set to the
+     * respective database entry representation in enum DATA_BLOCK_ID_e. */
+    DATA_BLOCK_HEADER_s header;                   /*!< Data block header */
+    int64_t charge_mAs[BS_NR_OF_STRINGS];         /*!< integrated charge since startup, unit: mA.s */
+    int64_t energy_mWs[BS_NR_OF_STRINGS];         /*!< integrated energy since startup, unit: mW.s */
+    uint32_t numberOfSamples[BS_NR_OF_STRINGS];   /*!< number of integrated current samples */
+    uint32_t numberOfGaps[BS_NR_OF_STRINGS];      /*!< sample intervals skipped because they were too long */
+    uint32_t droppedSamples;                      /*!< samples dropped because the sample buffer was full */
+    uint32_t maximumFillLevel;                    /*!< maximum number of samples pending in the sample buffer */
+    uint32_t previousTimestamp[BS_NR_OF_STRINGS]; /*!< previous timestamp of the integration */
+    uint32_t timestamp[BS_NR_OF_STRINGS];         /*!< timestamp of the last integrated sample */
+} DATA_BLOCK_CURRENT_INTEGRATION_s;
+
 /** data block struct of current sensor voltage U1 measurement */
 typedef struct {
     /* This struct needs to be at the beginning of every database entry. During
@@ -321,8 +350,8 @@ typedef struct {
     bool enableBalancing;       /*!< Switch for enabling/disabling balancing  */
     uint8_t threshold_mV;       /*!< balancing threshold in mV                */
     uint8_t request;            /*!< balancing request per CAN                */
-    bool activateBalancing[BS_NR_OF_STRINGS][BS_NR_OF_MODULES_PER_STRING]
-                          [BS_NR_OF_CELL_BLOCKS_PER_MODULE]; /*!< 0: no balancing, 1: balancing active     */
+    /** balancing plan of each module, bit cb set: balancing of cell block cb active */
+    BITSET_WORD_t balancingPlan[BS_NR_OF_STRINGS][BS_NR_OF_MODULES_PER_STRING];
     uint32_t deltaCharge_mAs[BS_NR_OF_STRINGS][BS_NR_OF_MODULES_PER_STRING]
                             [BS_NR_OF_CELL_BLOCKS_PER_MODULE]; /*!< Difference in Depth-of-Discharge in mAs  */
     uint16_t nrBalancedCells[BS_NR_OF_STRINGS];
@@ -365,9 +394,8 @@ typedef struct {
     DATA_BLOCK_HEADER_s header;             /*!< Data block header */
     uint8_t state;                          /*!< for future use */
     uint16_t nrOpenWires[BS_NR_OF_STRINGS]; /*!< number of open wires */
-    uint8_t openWire[BS_NR_OF_STRINGS]
-                    [BS_NR_OF_MODULES_PER_STRING *
-                     (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1u)]; /*!< 1 -> open wire, 0 -> everything ok */
+    /** bit w of each module (sense wire 0 to #BS_NR_OF_CELL_BLOCKS_PER_MODULE): 1 -> open wire, 0 -> everything ok */
+    BITSET_WORD_t openWire[BS_NR_OF_STRINGS][BS_NR_OF_MODULES_PER_STRING];
 } DATA_BLOCK_OPEN_WIRE_s;
 
 /** data block struct of GPIO voltage */
@@ -493,6 +521,21 @@ typedef struct {
                                                                            current */
     float_t recommendedPeakChargeCurrent_mA[BS_NR_OF_STRINGS];    /*!< recommended peak operating charge current */
     float_t recommendedPeakDischargeCurrent_mA[BS_NR_OF_STRINGS]; /*!< recommended peak operating discharge current */
+    /** predicted pack power for a charge or discharge pulse of 2s, 10s and
+     *  30s, 0 if the selected SOF variant does not predict the power @{ */
+    float_t predictedPackChargePower2s_W;
+    float_t predictedPackChargePower10s_W;
+    float_t predictedPackChargePower30s_W;
+    float_t predictedPackDischargePower2s_W;
+    float_t predictedPackDischargePower10s_W;
+    float_t predictedPackDischargePower30s_W;
+    /**@}*/
+    /** index of the cell block in the string that limits the recommended
+     *  continuous current, 0 if the selected SOF variant does not determine
+     *  the limiting cell block @{ */
+    uint16_t limitingCellBlockCharge[BS_NR_OF_STRINGS];
+    uint16_t limitingCellBlockDischarge[BS_NR_OF_STRINGS];
+    /**@}*/
 } DATA_BLOCK_SOF_s;
 
 /** data block struct of system state */
@@ -0,0 +1,89 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    log_cfg.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE_CONFIGURATION
+ * @prefix  LOG
+ *
+ * @brief   Configuration of the deferred-format log module
+ * @details The format strings use the printf conversion specifiers 'u', 'd',
+ *          'x' and 'f'. Arguments are transmitted as raw 32-bit words; an 'f'
+ *          conversion interprets the word as IEEE 754 single precision value.
+ */
+
+/*========== Includes =======================================================*/
+#include "log_cfg.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/* The host tooling parses this table; keep one entry per line in the form
+ * '{<id>, <number of arguments>u, "<format>"},' */
+/* DOCUMENTATION marker - log message definitions entry */
+const LOG_MESSAGE_DEFINITION_s log_messageDefinitions[LOG_MESSAGE_ID_E_MAX] = {
+    {LOG_MESSAGE_ID_LOG_STARTED, 1u, "log started (ring buffer length: %u records)"},
+    {LOG_MESSAGE_ID_TASK_TIMING, 3u, "task %u violated its timing: entered at %u ms, duration %u ms"},
+    {LOG_MESSAGE_ID_SYS_STATE, 2u, "sys state %u, substate %u"},
+    {LOG_MESSAGE_ID_BMS_STATE, 2u, "bms state %u, substate %u"},
+    {LOG_MESSAGE_ID_STACK_USAGE, 3u, "task %u exceeded its stack usage limit: %u of %u bytes used"},
+    {LOG_MESSAGE_ID_DEBUG_UNSIGNED, 2u, "debug %u: %u"},
+    {LOG_MESSAGE_ID_DEBUG_SIGNED, 2u, "debug %u: %d"},
+    {LOG_MESSAGE_ID_DEBUG_FLOAT, 2u, "debug %u: %f"},
+};
+/* DOCUMENTATION marker - log message definitions exit */
+
+/*========== Static Function Prototypes =====================================*/
+
+/*========== Static Function Implementations ================================*/
+
+/*========== Extern Function Implementations ================================*/
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
@@ -0,0 +1,109 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    log_cfg.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE_CONFIGURATION
+ * @prefix  LOG
+ *
+ * @brief   Configuration of the deferred-format log module
+ * @details The log module stores only a message identifier and the raw
+ *          arguments of a log entry. The format strings that belong to the
+ *          message identifiers are defined in #log_messageDefinitions and are
+ *          evaluated by the host tooling (see 'fox etl decode-log').
+ */
+
+#ifndef FOXBMS__LOG_CFG_H_
+#define FOXBMS__LOG_CFG_H_
+
+/*========== Includes =======================================================*/
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** number of records that can be buffered before new records are dropped */
+#define LOG_RING_BUFFER_LENGTH (64u)
+
+/** maximum number of 32-bit arguments that can be attached to one record */
+#define LOG_MAXIMUM_NUMBER_OF_ARGUMENTS (4u)
+
+/**
+ * @brief   identifiers of the log messages
+ * @details The order of the identifiers has to match the order of the entries
+ *          in #log_messageDefinitions, as the host tooling uses the position
+ *          in that table to look up the format string.
+ */
+typedef enum {
+    LOG_MESSAGE_ID_LOG_STARTED,    /*!< first record after start-up */
+    LOG_MESSAGE_ID_TASK_TIMING,    /*!< task timing violation detected by the system monitoring */
+    LOG_MESSAGE_ID_SYS_STATE,      /*!< system state machine state change */
+    LOG_MESSAGE_ID_BMS_STATE,      /*!< BMS state machine state change */
+    LOG_MESSAGE_ID_STACK_USAGE,    /*!< stack usage of a task exceeded the limit of the system monitoring */
+    LOG_MESSAGE_ID_DEBUG_UNSIGNED, /*!< generic unsigned debug value for temporary debug code */
+    LOG_MESSAGE_ID_DEBUG_SIGNED,   /*!< generic signed debug value for temporary debug code */
+    LOG_MESSAGE_ID_DEBUG_FLOAT,    /*!< generic floating point debug value for temporary debug code */
+    LOG_MESSAGE_ID_E_MAX,          /*!< number of log messages */
+} LOG_MESSAGE_ID_e;
+
+/** definition of a log message */
+typedef struct {
+    LOG_MESSAGE_ID_e id;       /*!< identifier of the message */
+    uint8_t numberOfArguments; /*!< number of arguments that are transmitted */
+    const char *const pFormat; /*!< printf-like format string, used by the host */
+} LOG_MESSAGE_DEFINITION_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/** table of all log messages, indexed by #LOG_MESSAGE_ID_e */
+extern const LOG_MESSAGE_DEFINITION_s log_messageDefinitions[LOG_MESSAGE_ID_E_MAX];
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+#endif
+
+#endif /* FOXBMS__LOG_CFG_H_ */
@@ -0,0 +1,99 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    mem_pool_cfg.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE_CONFIGURATION
+ * @prefix  MPOOL
+ *
+ * @brief   Configuration of the fixed-block memory pools
+ * @details The storage of the pools is defined as uint64_t arrays, so that
+ *          every block is aligned to #MPOOL_BLOCK_ALIGNMENT_B.
+ */
+
+/*========== Includes =======================================================*/
+#include "mem_pool_cfg.h"
+
+#include "fassert.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+FAS_STATIC_ASSERT(
+    (MPOOL_SOCKET_BLOCK_SIZE_B % MPOOL_BLOCK_ALIGNMENT_B) == 0u,
+    "MPOOL_SOCKET_BLOCK_SIZE_B has to be a multiple of the block alignment.");
+FAS_STATIC_ASSERT(
+    (MPOOL_TCP_BUFFER_BLOCK_SIZE_B % MPOOL_BLOCK_ALIGNMENT_B) == 0u,
+    "MPOOL_TCP_BUFFER_BLOCK_SIZE_B has to be a multiple of the block alignment.");
+FAS_STATIC_ASSERT(sizeof(uint64_t) == MPOOL_BLOCK_ALIGNMENT_B, "Storage type does not match the block alignment.");
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/** storage of the socket pool */
+static uint64_t mpool_socketStorage[(MPOOL_SOCKET_BLOCK_SIZE_B * MPOOL_SOCKET_NUMBER_OF_BLOCKS) / sizeof(uint64_t)] =
+    {0};
+
+/** storage of the TCP buffer pool */
+static uint64_t
+    mpool_tcpBufferStorage[(MPOOL_TCP_BUFFER_BLOCK_SIZE_B * MPOOL_TCP_BUFFER_NUMBER_OF_BLOCKS) / sizeof(uint64_t)] = {
+        0};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+const MPOOL_POOL_CONFIG_s mpool_poolConfiguration[MPOOL_ID_E_MAX] = {
+    {MPOOL_SOCKET_BLOCK_SIZE_B, MPOOL_SOCKET_NUMBER_OF_BLOCKS, (uint8_t *)&mpool_socketStorage[0]},
+    {MPOOL_TCP_BUFFER_BLOCK_SIZE_B, MPOOL_TCP_BUFFER_NUMBER_OF_BLOCKS, (uint8_t *)&mpool_tcpBufferStorage[0]},
+};
+
+/*========== Static Function Prototypes =====================================*/
+
+/*========== Static Function Implementations ================================*/
+
+/*========== Extern Function Implementations ================================*/
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
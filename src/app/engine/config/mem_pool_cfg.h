@@ -0,0 +1,130 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    mem_pool_cfg.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE_CONFIGURATION
+ * @prefix  MPOOL
+ *
+ * @brief   Configuration of the fixed-block memory pools
+ * @details Each pool reserves numberOfBlocks * blockSize bytes at build time,
+ *          so that the RAM of the pools is part of the link map and of the
+ *          RAM budget report instead of being hidden in the FreeRTOS heap.
+ *          The sizes are chosen for the FreeRTOS+TCP configuration in
+ *          FreeRTOSIPConfig.h and the ethernet configuration in
+ *          ethernet_cfg.h. They have to be checked with the pool statistics
+ *          (see 'MemoryPoolInfo' in the 'Debug' message) whenever one of
+ *          these configurations is changed.
+ */
+
+#ifndef FOXBMS__MEM_POOL_CFG_H_
+#define FOXBMS__MEM_POOL_CFG_H_
+
+/*========== Includes =======================================================*/
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** alignment of every block in bytes, block sizes have to be a multiple of it */
+#define MPOOL_BLOCK_ALIGNMENT_B (8u)
+
+/**
+ * @brief   size of a block of the socket pool in bytes
+ * @details Has to hold the largest FreeRTOS+TCP socket structure
+ *          (FreeRTOS_Socket_t of a TCP socket).
+ */
+#define MPOOL_SOCKET_BLOCK_SIZE_B (576u)
+
+/**
+ * @brief   number of blocks of the socket pool
+ * @details listening socket, one connected echo server socket
+ *          (ETH_ECHO_SERVER_BACKLOG), telemetry socket and spare blocks for
+ *          sockets that are still closing while a new connection is accepted
+ */
+#define MPOOL_SOCKET_NUMBER_OF_BLOCKS (6u)
+
+/**
+ * @brief   size of a block of the TCP buffer pool in bytes
+ * @details Has to hold a TCP stream buffer (ipconfigTCP_RX_BUFFER_LENGTH or
+ *          ipconfigTCP_TX_BUFFER_LENGTH plus about 24 bytes of management
+ *          data) and the array of ipconfigTCP_WIN_SEG_COUNT window segments.
+ */
+#define MPOOL_TCP_BUFFER_BLOCK_SIZE_B (1152u)
+
+/**
+ * @brief   number of blocks of the TCP buffer pool
+ * @details one receive and one transmit stream per connected socket, the
+ *          window segments and spare blocks for a second connection
+ */
+#define MPOOL_TCP_BUFFER_NUMBER_OF_BLOCKS (6u)
+
+/** identifiers of the memory pools */
+typedef enum {
+    MPOOL_ID_SOCKET,     /*!< FreeRTOS+TCP socket structures */
+    MPOOL_ID_TCP_BUFFER, /*!< FreeRTOS+TCP stream buffers and window segments */
+    MPOOL_ID_E_MAX,      /*!< number of memory pools */
+} MPOOL_ID_e;
+
+/** configuration of one memory pool */
+typedef struct {
+    uint32_t blockSize_B;    /*!< size of one block in bytes */
+    uint16_t numberOfBlocks; /*!< number of blocks in the pool */
+    uint8_t *pStorage;       /*!< storage of blockSize_B * numberOfBlocks bytes */
+} MPOOL_POOL_CONFIG_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/** configuration of the memory pools, indexed by #MPOOL_ID_e */
+extern const MPOOL_POOL_CONFIG_s mpool_poolConfiguration[MPOOL_ID_E_MAX];
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+#endif
+
+#endif /* FOXBMS__MEM_POOL_CFG_H_ */
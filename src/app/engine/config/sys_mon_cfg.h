@@ -43,7 +43,7 @@
  * @file    sys_mon_cfg.h
  * @author  foxBMS Team
  * @date    2019-11-28 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup ENGINE_CONFIGURATION
  * @prefix  SYSM
@@ -104,6 +104,42 @@ typedef struct {
     void (*callbackFunction)(SYSM_TASK_ID_e taskId); /*!< callback in case of error */
 } SYSM_MONITORING_CFG_s;
 
+/** @{
+ * staleness budgets of the measurement processing chain, i.e., the maximum
+ * allowed time between the start of an acquisition and the hand-over of the
+ * data at the respective stage (see #SYSM_LATENCY_STAGE_e)
+ * - AFE: conversion and readout of all strings
+ * - redundancy: AFE budget plus the 50ms validation period and one 10ms task
+ *   cycle of jitter
+ * - CAN TX: redundancy budget plus two round-robin sweeps of the cell voltage
+ *   messages (the database is read at the start of a sweep; 5 frames with a
+ *   period of 100ms for the default battery system configuration)
+ */
+#define SYSM_LATENCY_BUDGET_AFE_us        (50000u)
+#define SYSM_LATENCY_BUDGET_REDUNDANCY_us (SYSM_LATENCY_BUDGET_AFE_us + 60000u)
+#define SYSM_LATENCY_BUDGET_CAN_TX_us     (SYSM_LATENCY_BUDGET_REDUNDANCY_us + 1000000u)
+/** @} */
+
+/**
+ * limit of the observed stack usage of a task in percent of its configured
+ * stack size (see #SYSM_UpdateStackUsage)
+ */
+#define SYSM_STACK_USAGE_LIMIT_perc (90u)
+
+/** @{
+ * upper limits of the bins of the bus wait time histogram (see
+ * #SYSM_BUS_STATISTICS_s); waits that are longer than the last limit are
+ * counted in the last bin
+ * - bins 0 and 1: the owner released the bus within the same task cycle
+ * - bins 2 to 4: the bus was blocked for one or several 1ms/10ms task cycles
+ */
+#define SYSM_BUS_WAIT_BIN_0_LIMIT_us (100u)
+#define SYSM_BUS_WAIT_BIN_1_LIMIT_us (1000u)
+#define SYSM_BUS_WAIT_BIN_2_LIMIT_us (5000u)
+#define SYSM_BUS_WAIT_BIN_3_LIMIT_us (10000u)
+#define SYSM_BUS_WAIT_BIN_4_LIMIT_us (50000u)
+/** @} */
+
 /*========== Extern Constant and Variable Declarations ======================*/
 /** diag system monitoring struct */
 extern SYSM_MONITORING_CFG_s sysm_ch_cfg[];
@@ -0,0 +1,98 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    trace_cfg.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE_CONFIGURATION
+ * @prefix  TRC
+ *
+ * @brief   Configuration of the kernel trace recorder
+ * @details The sizes in this file define the RAM that is reserved for the
+ *          trace recorder. A snapshot consists of the task table and of the
+ *          last #TRC_RING_BUFFER_LENGTH events before the recorder has been
+ *          frozen.
+ */
+
+#ifndef FOXBMS__TRACE_CFG_H_
+#define FOXBMS__TRACE_CFG_H_
+
+/*========== Includes =======================================================*/
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** number of events kept in the ring buffer, has to be a power of two */
+#define TRC_RING_BUFFER_LENGTH (1024u)
+
+/** maximum number of tasks (including the idle and timer task) that can be named in a snapshot */
+#define TRC_MAXIMUM_NUMBER_OF_TASKS (16u)
+
+/** maximum number of queues and semaphores that can be distinguished in the trace */
+#define TRC_MAXIMUM_NUMBER_OF_QUEUES (32u)
+
+/** number of characters of a task name that are stored in the task table */
+#define TRC_TASK_NAME_LENGTH (14u)
+
+/**
+ * @brief   identifiers of the interrupt service routines that are traced
+ * @details The host tooling shows the identifier as 'ISR <n>'; new entries
+ *          have to be added at the end to keep recorded snapshots readable.
+ */
+typedef enum {
+    TRC_ISR_ID_DMA_GROUP_A, /*!< DMA group A notification (SPI and UART transfers) */
+    TRC_ISR_ID_E_MAX,       /*!< number of traced interrupt service routines */
+} TRC_ISR_ID_e;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+#endif
+
+#endif /* FOXBMS__TRACE_CFG_H_ */
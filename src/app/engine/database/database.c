@@ -43,7 +43,7 @@
  * @file    database.c
  * @author  foxBMS Team
  * @date    2015-08-18 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup ENGINE
  * @prefix  DATA
@@ -101,12 +101,12 @@ static const DATA_BASE_HEADER_s data_baseHeader = {
 };
 
 /**
- * @brief   uniqueId to respective database entry selector
- * @details This array is the link between the uniqueId of a database entry and
- *          the actual position of the database entry in data_database[].
- *          The IDs are set to its final value, when Data_Initialize is called.
+ * @brief   number of write accesses per database entry
+ * @details The counters are only written by the database task and wrap
+ *          around. They allow other modules to detect that an entry has been
+ *          updated without reading the entry through the database queue.
  */
-static uint8_t data_uniqueIdToDatabaseEntry[DATA_BLOCK_ID_MAX] = {0};
+static volatile uint32_t data_numberOfWrites[DATA_BLOCK_ID_MAX] = {0};
 
 /*========== Extern Constant and Variable Definitions =======================*/
 
@@ -213,13 +213,16 @@ static void DATA_IterateOverDatabaseEntries(const DATA_QUEUE_MESSAGE_s *kpReceiv
             const DATA_BLOCK_HEADER_s *kpHeader = (DATA_BLOCK_HEADER_s *)kpReceiveMessage->pDatabaseEntry[queueEntry];
             uint8_t uniqueId                    = (uint8_t)(kpHeader->uniqueId);
             FAS_ASSERT(uniqueId < (uint8_t)DATA_BLOCK_ID_MAX);
-            uint8_t entryIndex = data_uniqueIdToDatabaseEntry[uniqueId];
-            /* Pointer to database struct representation of passed struct */
-            void *pDatabaseStruct = (void *)data_baseHeader.pDatabase[entryIndex].pDatabaseEntry;
+            /* Pointer to database struct representation of passed struct (the
+             * database entries are indexed by their uniqueId) */
+            void *pDatabaseStruct = (void *)data_baseHeader.pDatabase[uniqueId].pDatabaseEntry;
             /* Get dataLength of database entry */
-            uint32_t dataLength = data_baseHeader.pDatabase[entryIndex].dataLength;
+            uint32_t dataLength = data_baseHeader.pDatabase[uniqueId].dataLength;
 
             DATA_CopyData(accessType, dataLength, pDatabaseStruct, pPassedDataStruct);
+            if (accessType == DATA_WRITE_ACCESS) {
+                data_numberOfWrites[uniqueId]++;
+            }
         }
     }
 }
@@ -237,32 +240,20 @@ STD_RETURN_TYPE_e DATA_Initialize(void) {
     FAS_STATIC_ASSERT(
         ((sizeof(data_database) / sizeof(DATA_BASE_s)) == (uint8_t)(DATA_BLOCK_ID_MAX)), "Database array length error");
 
-    /* Iterate over database and set respective read/write pointer for each database entry */
-    for (uint16_t i = 0u; i < data_baseHeader.nrDatabaseEntries; i++) {
-        /* Initialize database entry with 0, set write pointer to start of database entry */
-        uint8_t *pStartDatabaseEntryWR = (uint8_t *)data_baseHeader.pDatabase[i].pDatabaseEntry;
-
-        /* Start after uniqueId entry. Set j'th byte to zero in database entry */
-        for (uint32_t j = 0u; j < (data_baseHeader.pDatabase + i)->dataLength; j++) {
-            if (j >= sizeof(DATA_BLOCK_ID_e)) {
-                *pStartDatabaseEntryWR = 0;
-            }
-            pStartDatabaseEntryWR++;
-        }
-    }
-
-    /* Configure link between uniqueId and database entry array position */
+    /* Iterate over database, check that each entry is located at the index of
+       its uniqueId and initialize the entry with 0 (except for the uniqueId) */
     for (uint8_t databaseEntry = 0u; databaseEntry < data_baseHeader.nrDatabaseEntries; databaseEntry++) {
         /* Get pointer to database header entry */
         DATA_BLOCK_HEADER_s *pHeader = (DATA_BLOCK_HEADER_s *)data_baseHeader.pDatabase[databaseEntry].pDatabaseEntry;
         /*  make sure that the database entry is not a null pointer (which would happen if an entry is missing
             despite the ID existing) */
         FAS_ASSERT(pHeader != NULL_PTR);
-        /* Get uniqueId */
-        DATA_BLOCK_ID_e blockId = pHeader->uniqueId;
-        if ((blockId < DATA_BLOCK_ID_MAX) && (databaseEntry < DATA_BLOCK_ID_MAX)) {
-            /* e.g., data_uniqueIdToDatabaseEntry[<some id>] = configured database entry index */
-            data_uniqueIdToDatabaseEntry[blockId] = databaseEntry;
+        const uint32_t dataLength = data_baseHeader.pDatabase[databaseEntry].dataLength;
+        if (((uint8_t)pHeader->uniqueId == databaseEntry) && (dataLength >= sizeof(DATA_BLOCK_HEADER_s))) {
+            uint8_t *pStartDatabaseEntryWR = (uint8_t *)data_baseHeader.pDatabase[databaseEntry].pDatabaseEntry;
+            /* memset has no return value therefore there is nothing to check: casting to void */
+            (void)memset(
+                &pStartDatabaseEntryWR[sizeof(DATA_BLOCK_ID_e)], 0, (size_t)dataLength - sizeof(DATA_BLOCK_ID_e));
         } else {
             /* Configuration error -> set retval to #STD_NOT_OK */
             retval = STD_NOT_OK;
@@ -359,6 +350,13 @@ STD_RETURN_TYPE_e DATA_Write4DataBlocks(
         DATA_WRITE_ACCESS, pDataFromSender0, pDataFromSender1, pDataFromSender2, pDataFromSender3);
 }
 
+extern uint32_t DATA_GetNumberOfWrites(DATA_BLOCK_ID_e uniqueId) {
+    FAS_ASSERT(uniqueId < DATA_BLOCK_ID_MAX);
+    /* the counter is an aligned 32-bit value that is only written by the
+       database task, therefore it can be read without a critical section */
+    return data_numberOfWrites[uniqueId];
+}
+
 extern void DATA_ExecuteDataBist(void) {
     /* compile database entry */
     DATA_BLOCK_DUMMY_FOR_SELF_TEST_s dummyWriteTable = {.header.uniqueId = DATA_BLOCK_ID_DUMMY_FOR_SELF_TEST};
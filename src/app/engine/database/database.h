@@ -43,7 +43,7 @@
  * @file    database.h
  * @author  foxBMS Team
  * @date    2015-08-18 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup ENGINE
  * @prefix  DATA
@@ -263,6 +263,17 @@ extern STD_RETURN_TYPE_e DATA_Read4DataBlocks(
     void *pDataToReceiver2,
     void *pDataToReceiver3);
 
+/**
+ * @brief   Returns the number of write accesses to a database entry
+ * @details The counter is incremented by the database task each time the
+ *          entry is written and wraps around. A changed value indicates that
+ *          the entry has been updated, without the need to read the entry
+ *          itself.
+ * @param   uniqueId    unique ID of the database entry
+ * @return  number of write accesses to the database entry
+ */
+extern uint32_t DATA_GetNumberOfWrites(DATA_BLOCK_ID_e uniqueId);
+
 /**
  * @brief   Executes a built-in self-test for the database module
  * @details This test writes and reads a database entry in order to check that
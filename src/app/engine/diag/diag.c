@@ -43,7 +43,7 @@
  * @file    diag.c
  * @author  foxBMS Team
  * @date    2019-11-28 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup ENGINE
  * @prefix  DIAG
@@ -62,6 +62,7 @@
 #include "fstd_types.h"
 #include "os.h"
 #include "timer.h"
+#include "trace.h"
 
 #include <stdint.h>
 
@@ -150,6 +151,8 @@ static void DIAG_SetFatalErrorById(DIAG_ID_e xEventID) {
     FAS_ASSERT(xEventID < DIAG_ID_MAX);
     if (diag_activeFatalErrors[xEventID] == 0u) {
         CANTX_SendFatalErrorId(xEventID);
+        /* keep the kernel trace that led to the first fatal error */
+        TRC_Freeze(TRC_FREEZE_REASON_FATAL_ERROR, (uint32_t)xEventID);
         diag_activeFatalErrors[xEventID] = 1u;
         if (diag_activeFatalErrorCount == 0u) {
             TIMER_Start(diag_fatalErrorResendTimer, 0u);
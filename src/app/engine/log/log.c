@@ -0,0 +1,324 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    log.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE
+ * @prefix  LOG
+ *
+ * @brief   Deferred-format binary log with bounded write time
+ * @details The ring buffer is written by multiple producers (tasks) and read
+ *          by exactly one consumer. Producers only reserve a slot inside a
+ *          critical section (a few instructions) and fill the slot outside of
+ *          it. A slot is marked as committed as soon as it is completely
+ *          written, the consumer stops at the first slot that is not yet
+ *          committed.
+ */
+
+/*========== Includes =======================================================*/
+#include "log.h"
+
+#include "fassert.h"
+#include "fstd_types.h"
+#include "os.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** maximum value of the 16-bit drop counter that is part of a record */
+#define LOG_MAXIMUM_DROPPED_RECORDS_PER_RECORD (UINT16_MAX)
+
+/** one record in the ring buffer */
+typedef struct {
+    volatile bool isCommitted;                           /*!< record is completely written */
+    uint16_t messageId;                                  /*!< identifier of the message */
+    uint16_t sequence;                                   /*!< sequence number of the record */
+    uint16_t droppedRecords;                             /*!< records dropped before this one */
+    uint32_t timestamp;                                  /*!< time of creation in ms */
+    uint32_t arguments[LOG_MAXIMUM_NUMBER_OF_ARGUMENTS]; /*!< raw arguments */
+} LOG_RECORD_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/** ring buffer of the log records */
+static LOG_RECORD_s log_ringBuffer[LOG_RING_BUFFER_LENGTH] = {0};
+
+/** index of the next slot to be reserved (free running) */
+static volatile uint32_t log_writeIndex = 0u;
+
+/** index of the next slot to be read (free running) */
+static volatile uint32_t log_readIndex = 0u;
+
+/** sequence number of the next record */
+static uint16_t log_sequence = 0u;
+
+/** number of records dropped since the last stored record */
+static uint16_t log_pendingDroppedRecords = 0u;
+
+/** statistics of the log module */
+static LOG_STATISTICS_s log_statistics = {0};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/**
+ * @brief   Writes a 16-bit value in big-endian byte order.
+ * @param   pBuffer pointer to the destination
+ * @param   value   value to be written
+ */
+static void LOG_WriteUint16(uint8_t *const pBuffer, uint16_t value);
+
+/**
+ * @brief   Writes a 32-bit value in big-endian byte order.
+ * @param   pBuffer pointer to the destination
+ * @param   value   value to be written
+ */
+static void LOG_WriteUint32(uint8_t *const pBuffer, uint32_t value);
+
+/**
+ * @brief   Serializes one record.
+ * @details Layout (big-endian, #LOG_SERIALIZED_RECORD_SIZE_IN_BYTES bytes):
+ *          - byte 0: #LOG_RECORD_SYNC_BYTE
+ *          - byte 1: number of arguments
+ *          - bytes 2-3: message identifier
+ *          - bytes 4-5: sequence number
+ *          - bytes 6-7: number of records dropped before this record
+ *          - bytes 8-11: timestamp in ms
+ *          - bytes 12-...: arguments, 4 bytes each
+ * @param   pBuffer         destination of the serialized record
+ * @param   messageId       identifier of the message
+ * @param   sequence        sequence number of the record
+ * @param   droppedRecords  number of records dropped before this record
+ * @param   timestamp       timestamp of the record
+ * @param   pArguments      arguments of the record
+ */
+static void LOG_SerializeRecord(
+    uint8_t *const pBuffer,
+    uint16_t messageId,
+    uint16_t sequence,
+    uint16_t droppedRecords,
+    uint32_t timestamp,
+    const uint32_t *const pArguments);
+
+/*========== Static Function Implementations ================================*/
+static void LOG_WriteUint16(uint8_t *const pBuffer, uint16_t value) {
+    FAS_ASSERT(pBuffer != NULL_PTR);
+    pBuffer[0u] = (uint8_t)(value >> 8u);
+    pBuffer[1u] = (uint8_t)(value & 0xFFu);
+}
+
+static void LOG_WriteUint32(uint8_t *const pBuffer, uint32_t value) {
+    FAS_ASSERT(pBuffer != NULL_PTR);
+    pBuffer[0u] = (uint8_t)(value >> 24u);
+    pBuffer[1u] = (uint8_t)((value >> 16u) & 0xFFu);
+    pBuffer[2u] = (uint8_t)((value >> 8u) & 0xFFu);
+    pBuffer[3u] = (uint8_t)(value & 0xFFu);
+}
+
+static void LOG_SerializeRecord(
+    uint8_t *const pBuffer,
+    uint16_t messageId,
+    uint16_t sequence,
+    uint16_t droppedRecords,
+    uint32_t timestamp,
+    const uint32_t *const pArguments) {
+    FAS_ASSERT(pBuffer != NULL_PTR);
+    FAS_ASSERT(messageId < (uint16_t)LOG_MESSAGE_ID_E_MAX);
+    /* AXIVION Routine Generic-MissingParameterAssert: sequence: accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: droppedRecords: accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp: accepts whole range */
+    FAS_ASSERT(pArguments != NULL_PTR);
+
+    pBuffer[0u] = LOG_RECORD_SYNC_BYTE;
+    pBuffer[1u] = log_messageDefinitions[messageId].numberOfArguments;
+    LOG_WriteUint16(&pBuffer[2u], messageId);
+    LOG_WriteUint16(&pBuffer[4u], sequence);
+    LOG_WriteUint16(&pBuffer[6u], droppedRecords);
+    LOG_WriteUint32(&pBuffer[8u], timestamp);
+    for (uint8_t i = 0u; i < LOG_MAXIMUM_NUMBER_OF_ARGUMENTS; i++) {
+        LOG_WriteUint32(&pBuffer[12u + (4u * i)], pArguments[i]);
+    }
+}
+
+/*========== Extern Function Implementations ================================*/
+extern STD_RETURN_TYPE_e LOG_Write(
+    LOG_MESSAGE_ID_e messageId,
+    uint32_t argument0,
+    uint32_t argument1,
+    uint32_t argument2,
+    uint32_t argument3) {
+    FAS_ASSERT(messageId < LOG_MESSAGE_ID_E_MAX);
+    /* AXIVION Routine Generic-MissingParameterAssert: argument0: accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: argument1: accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: argument2: accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: argument3: accepts whole range */
+
+    STD_RETURN_TYPE_e retval = STD_NOT_OK;
+    bool slotReserved        = false;
+    uint32_t slot            = 0u;
+    uint16_t sequence        = 0u;
+    uint16_t droppedRecords  = 0u;
+    uint32_t timestamp       = 0u;
+
+    /* Reserve a slot; this is the only part that needs to be protected
+     * against other producers. The timestamp is taken together with the
+     * sequence number, so that both are in the same order. */
+    OS_EnterTaskCritical();
+    const uint32_t fillLevel = log_writeIndex - log_readIndex;
+    if (fillLevel < LOG_RING_BUFFER_LENGTH) {
+        slot           = log_writeIndex % LOG_RING_BUFFER_LENGTH;
+        sequence       = log_sequence;
+        droppedRecords = log_pendingDroppedRecords;
+        timestamp      = OS_GetTickCount();
+        log_writeIndex++;
+        log_sequence++;
+        log_pendingDroppedRecords = 0u;
+        log_statistics.writtenRecords++;
+        if ((fillLevel + 1u) > log_statistics.maximumFillLevel) {
+            log_statistics.maximumFillLevel = fillLevel + 1u;
+        }
+        slotReserved = true;
+    } else {
+        if (log_pendingDroppedRecords < LOG_MAXIMUM_DROPPED_RECORDS_PER_RECORD) {
+            log_pendingDroppedRecords++;
+        }
+        log_statistics.droppedRecords++;
+    }
+    OS_ExitTaskCritical();
+
+    if (slotReserved == true) {
+        const uint32_t arguments[LOG_MAXIMUM_NUMBER_OF_ARGUMENTS] = {argument0, argument1, argument2, argument3};
+        const uint8_t numberOfArguments                           = log_messageDefinitions[messageId].numberOfArguments;
+
+        LOG_RECORD_s *const pRecord = &log_ringBuffer[slot];
+
+        pRecord->messageId      = (uint16_t)messageId;
+        pRecord->sequence       = sequence;
+        pRecord->droppedRecords = droppedRecords;
+        pRecord->timestamp      = timestamp;
+        for (uint8_t i = 0u; i < LOG_MAXIMUM_NUMBER_OF_ARGUMENTS; i++) {
+            pRecord->arguments[i] = (i < numberOfArguments) ? arguments[i] : 0u;
+        }
+        /* publish the record to the consumer as last step */
+        pRecord->isCommitted = true;
+        retval               = STD_OK;
+    }
+    return retval;
+}
+
+extern uint32_t LOG_ReadRecords(uint8_t *const pBuffer, uint32_t bufferSize) {
+    FAS_ASSERT(pBuffer != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: bufferSize: accepts whole range */
+
+    uint32_t writtenBytes = 0u;
+    bool continueReading  = true;
+
+    while (continueReading == true) {
+        const uint32_t readIndex    = log_readIndex;
+        LOG_RECORD_s *const pRecord = &log_ringBuffer[readIndex % LOG_RING_BUFFER_LENGTH];
+        if ((readIndex == log_writeIndex) || (pRecord->isCommitted == false) ||
+            ((bufferSize - writtenBytes) < LOG_SERIALIZED_RECORD_SIZE_IN_BYTES)) {
+            continueReading = false;
+        } else {
+            LOG_SerializeRecord(
+                &pBuffer[writtenBytes],
+                pRecord->messageId,
+                pRecord->sequence,
+                pRecord->droppedRecords,
+                pRecord->timestamp,
+                pRecord->arguments);
+            writtenBytes += LOG_SERIALIZED_RECORD_SIZE_IN_BYTES;
+            /* release the slot before it is handed back to the producers */
+            pRecord->isCommitted = false;
+            log_readIndex        = readIndex + 1u;
+        }
+    }
+    return writtenBytes;
+}
+
+extern uint32_t LOG_GetNumberOfPendingRecords(void) {
+    return log_writeIndex - log_readIndex;
+}
+
+extern void LOG_GetStatistics(LOG_STATISTICS_s *const pStatistics) {
+    FAS_ASSERT(pStatistics != NULL_PTR);
+    OS_EnterTaskCritical();
+    *pStatistics = log_statistics;
+    OS_ExitTaskCritical();
+}
+
+extern uint32_t LOG_ConvertFloatToArgument(float_t value) {
+    /* AXIVION Routine Generic-MissingParameterAssert: value: accepts whole range */
+    uint32_t argument = 0u;
+    (void)memcpy((void *)&argument, (const void *)&value, sizeof(argument));
+    return argument;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_LOG_Reset(void) {
+    (void)memset((void *)log_ringBuffer, 0, sizeof(log_ringBuffer));
+    log_writeIndex            = 0u;
+    log_readIndex             = 0u;
+    log_sequence              = 0u;
+    log_pendingDroppedRecords = 0u;
+    log_statistics            = (LOG_STATISTICS_s){0};
+}
+
+extern void TEST_LOG_SerializeRecord(
+    uint8_t *const pBuffer,
+    uint16_t messageId,
+    uint16_t sequence,
+    uint16_t droppedRecords,
+    uint32_t timestamp,
+    const uint32_t *const pArguments) {
+    LOG_SerializeRecord(pBuffer, messageId, sequence, droppedRecords, timestamp, pArguments);
+}
+#endif
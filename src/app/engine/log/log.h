@@ -0,0 +1,164 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    log.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE
+ * @prefix  LOG
+ *
+ * @brief   Deferred-format binary log with bounded write time
+ * @details Tasks add log records with #LOG_Write(). A record consists only of
+ *          a message identifier, a timestamp and up to
+ *          #LOG_MAXIMUM_NUMBER_OF_ARGUMENTS raw 32-bit arguments. No string
+ *          formatting is done on the target; the records are serialized by
+ *          #LOG_ReadRecords() in a low priority context and decoded by the
+ *          host tooling. If the ring buffer is full, records are dropped and
+ *          counted instead of blocking the caller.
+ */
+
+#ifndef FOXBMS__LOG_H_
+#define FOXBMS__LOG_H_
+
+/*========== Includes =======================================================*/
+#include "log_cfg.h"
+
+#include "fstd_types.h"
+
+#include <math.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** first byte of each serialized record, used by the host to synchronize */
+#define LOG_RECORD_SYNC_BYTE (0xA5u)
+
+/** size of a serialized record in bytes */
+#define LOG_SERIALIZED_RECORD_SIZE_IN_BYTES (12u + (4u * LOG_MAXIMUM_NUMBER_OF_ARGUMENTS))
+
+/** statistics of the log module */
+typedef struct {
+    uint32_t writtenRecords;   /*!< number of records that have been accepted */
+    uint32_t droppedRecords;   /*!< number of records dropped due to a full ring buffer */
+    uint32_t maximumFillLevel; /*!< maximum number of records pending at the same time */
+} LOG_STATISTICS_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/**
+ * @brief   Adds a record to the log ring buffer.
+ * @details The function does not wait for the consumer or any other
+ *          resource. The ring buffer slot is reserved in a short task
+ *          critical section (interrupts are disabled for a few
+ *          instructions), the record is filled outside of it. If no
+ *          slot is available, the record is dropped and the drop counter is
+ *          incremented. The number of dropped records is transmitted with the
+ *          next record that could be stored.
+ *          Only the number of arguments defined in #log_messageDefinitions is
+ *          stored, the remaining arguments are transmitted as zero.
+ *          The function uses a task critical section and must not be
+ *          called from interrupt context.
+ * @param   messageId   identifier of the message
+ * @param   argument0   first argument
+ * @param   argument1   second argument
+ * @param   argument2   third argument
+ * @param   argument3   fourth argument
+ * @return  #STD_OK if the record has been stored, #STD_NOT_OK if it has been
+ *          dropped
+ */
+extern STD_RETURN_TYPE_e LOG_Write(
+    LOG_MESSAGE_ID_e messageId,
+    uint32_t argument0,
+    uint32_t argument1,
+    uint32_t argument2,
+    uint32_t argument3);
+
+/**
+ * @brief   Serializes pending records into a buffer and removes them from the
+ *          ring buffer.
+ * @details Only complete records are written; records that are reserved but
+ *          not yet completely written by the producer stay in the ring buffer.
+ *          This function shall only be called from one (low priority) context.
+ * @param   pBuffer     buffer into which the records are serialized
+ * @param   bufferSize  size of the buffer in bytes
+ * @return  number of bytes written into the buffer
+ */
+extern uint32_t LOG_ReadRecords(uint8_t *const pBuffer, uint32_t bufferSize);
+
+/**
+ * @brief   Returns the number of records that wait for serialization.
+ * @return  number of pending records
+ */
+extern uint32_t LOG_GetNumberOfPendingRecords(void);
+
+/**
+ * @brief   Copies the statistics of the log module.
+ * @param   pStatistics pointer into which the statistics are copied
+ */
+extern void LOG_GetStatistics(LOG_STATISTICS_s *const pStatistics);
+
+/**
+ * @brief   Converts a floating point value into a log argument.
+ * @details The bit pattern is kept, so that the host can interpret the
+ *          argument as IEEE 754 single precision value ('%f').
+ * @param   value   floating point value
+ * @return  raw 32-bit representation of the value
+ */
+extern uint32_t LOG_ConvertFloatToArgument(float_t value);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_LOG_Reset(void);
+extern void TEST_LOG_SerializeRecord(
+    uint8_t *const pBuffer,
+    uint16_t messageId,
+    uint16_t sequence,
+    uint16_t droppedRecords,
+    uint32_t timestamp,
+    const uint32_t *const pArguments);
+#endif
+
+#endif /* FOXBMS__LOG_H_ */
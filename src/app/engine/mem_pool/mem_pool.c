@@ -0,0 +1,236 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    mem_pool.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE
+ * @prefix  MPOOL
+ *
+ * @brief   Fixed-block memory pools with constant time allocation
+ * @details Blocks are handed out in two ways: released blocks are kept in a
+ *          singly linked free list that is stored in the blocks themselves,
+ *          blocks that have never been allocated are taken in order from the
+ *          end of the used part of the storage. Therefore the pools do not
+ *          need to be initialized and both allocation and release take
+ *          constant time. The pool state is protected by a task critical
+ *          section.
+ */
+
+/*========== Includes =======================================================*/
+#include "mem_pool.h"
+
+#include "fassert.h"
+#include "fstd_types.h"
+#include "os.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** released block, the link is stored in the first bytes of the block */
+typedef struct MPOOL_FREE_BLOCK {
+    struct MPOOL_FREE_BLOCK *pNext; /*!< next released block, NULL_PTR at the end of the list */
+} MPOOL_FREE_BLOCK_s;
+
+/** state of one memory pool */
+typedef struct {
+    MPOOL_FREE_BLOCK_s *pFreeList; /*!< released blocks */
+    uint16_t nextUnusedBlock;      /*!< index of the first block that has never been allocated */
+    uint16_t blocksInUse;          /*!< number of blocks that are currently allocated */
+    uint16_t peakBlocksInUse;      /*!< largest number of allocated blocks since the last reset */
+    uint16_t failedAllocations;    /*!< number of failed allocations since the last reset */
+    uint32_t largestRequest_B;     /*!< largest requested size since the last reset */
+} MPOOL_STATE_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/** state of the memory pools, indexed by #MPOOL_ID_e */
+static MPOOL_STATE_s mpool_state[MPOOL_ID_E_MAX] = {0};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/**
+ * @brief   Takes a block from a memory pool.
+ * @details Has to be called inside a critical section.
+ * @param   poolId  memory pool
+ * @return  pointer to the block, NULL_PTR if the pool is exhausted
+ */
+static void *MPOOL_TakeBlock(MPOOL_ID_e poolId);
+
+/**
+ * @brief   Checks that a pointer is the start of a block of a memory pool.
+ * @param   poolId  memory pool
+ * @param   pBlock  pointer to be checked
+ * @return  true if the pointer is the start of a block, false otherwise
+ */
+static bool MPOOL_IsBlockOfPool(MPOOL_ID_e poolId, const void *pBlock);
+
+/*========== Static Function Implementations ================================*/
+static void *MPOOL_TakeBlock(MPOOL_ID_e poolId) {
+    FAS_ASSERT(poolId < MPOOL_ID_E_MAX);
+
+    const MPOOL_POOL_CONFIG_s *const pConfig = &mpool_poolConfiguration[poolId];
+    MPOOL_STATE_s *const pState              = &mpool_state[poolId];
+    void *pBlock                             = NULL_PTR;
+
+    if (pState->pFreeList != NULL_PTR) {
+        MPOOL_FREE_BLOCK_s *const pFreeBlock = pState->pFreeList;
+        pState->pFreeList                    = pFreeBlock->pNext;
+        pBlock                               = (void *)pFreeBlock;
+    } else if (pState->nextUnusedBlock < pConfig->numberOfBlocks) {
+        pBlock = (void *)&pConfig->pStorage[(uint32_t)pState->nextUnusedBlock * pConfig->blockSize_B];
+        pState->nextUnusedBlock++;
+    } else {
+        /* pool is exhausted */
+    }
+    return pBlock;
+}
+
+static bool MPOOL_IsBlockOfPool(MPOOL_ID_e poolId, const void *pBlock) {
+    FAS_ASSERT(poolId < MPOOL_ID_E_MAX);
+    FAS_ASSERT(pBlock != NULL_PTR);
+
+    const MPOOL_POOL_CONFIG_s *const pConfig = &mpool_poolConfiguration[poolId];
+    const uintptr_t start                    = (uintptr_t)pConfig->pStorage;
+    const uintptr_t address                  = (uintptr_t)pBlock;
+    bool isBlockOfPool                       = false;
+
+    if (address >= start) {
+        const uintptr_t offset = address - start;
+        if ((offset < ((uintptr_t)pConfig->blockSize_B * pConfig->numberOfBlocks)) &&
+            ((offset % pConfig->blockSize_B) == 0u)) {
+            isBlockOfPool = true;
+        }
+    }
+    return isBlockOfPool;
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void *MPOOL_Allocate(MPOOL_ID_e poolId, uint32_t size_B) {
+    FAS_ASSERT(poolId < MPOOL_ID_E_MAX);
+    /* AXIVION Routine Generic-MissingParameterAssert: size_B: too large requests are reported as failed */
+
+    MPOOL_STATE_s *const pState = &mpool_state[poolId];
+    void *pBlock                = NULL_PTR;
+
+    OS_EnterTaskCritical();
+    if (size_B > pState->largestRequest_B) {
+        pState->largestRequest_B = size_B;
+    }
+    if (size_B <= mpool_poolConfiguration[poolId].blockSize_B) {
+        pBlock = MPOOL_TakeBlock(poolId);
+    }
+    if (pBlock != NULL_PTR) {
+        pState->blocksInUse++;
+        if (pState->blocksInUse > pState->peakBlocksInUse) {
+            pState->peakBlocksInUse = pState->blocksInUse;
+        }
+    } else if (pState->failedAllocations < UINT16_MAX) {
+        pState->failedAllocations++;
+    } else {
+        /* counter saturates */
+    }
+    OS_ExitTaskCritical();
+
+    return pBlock;
+}
+
+extern void MPOOL_Free(MPOOL_ID_e poolId, void *pBlock) {
+    FAS_ASSERT(poolId < MPOOL_ID_E_MAX);
+    /* AXIVION Routine Generic-MissingParameterAssert: pBlock: NULL_PTR is ignored like by free() */
+
+    if (pBlock != NULL_PTR) {
+        /* releasing memory that does not belong to the pool would corrupt it */
+        FAS_ASSERT(MPOOL_IsBlockOfPool(poolId, pBlock) == true);
+
+        MPOOL_STATE_s *const pState          = &mpool_state[poolId];
+        MPOOL_FREE_BLOCK_s *const pFreeBlock = (MPOOL_FREE_BLOCK_s *)pBlock;
+
+        OS_EnterTaskCritical();
+        FAS_ASSERT(pState->blocksInUse > 0u);
+        pFreeBlock->pNext = pState->pFreeList;
+        pState->pFreeList = pFreeBlock;
+        pState->blocksInUse--;
+        OS_ExitTaskCritical();
+    }
+}
+
+extern void MPOOL_GetStatistics(MPOOL_ID_e poolId, MPOOL_STATISTICS_s *pStatistics) {
+    FAS_ASSERT(poolId < MPOOL_ID_E_MAX);
+    FAS_ASSERT(pStatistics != NULL_PTR);
+
+    const MPOOL_STATE_s *const pState = &mpool_state[poolId];
+
+    OS_EnterTaskCritical();
+    pStatistics->blockSize_B       = mpool_poolConfiguration[poolId].blockSize_B;
+    pStatistics->numberOfBlocks    = mpool_poolConfiguration[poolId].numberOfBlocks;
+    pStatistics->blocksInUse       = pState->blocksInUse;
+    pStatistics->peakBlocksInUse   = pState->peakBlocksInUse;
+    pStatistics->failedAllocations = pState->failedAllocations;
+    pStatistics->largestRequest_B  = pState->largestRequest_B;
+    OS_ExitTaskCritical();
+}
+
+extern void MPOOL_ResetStatistics(void) {
+    OS_EnterTaskCritical();
+    for (uint8_t poolId = 0u; poolId < (uint8_t)MPOOL_ID_E_MAX; poolId++) {
+        mpool_state[poolId].peakBlocksInUse   = mpool_state[poolId].blocksInUse;
+        mpool_state[poolId].failedAllocations = 0u;
+        mpool_state[poolId].largestRequest_B  = 0u;
+    }
+    OS_ExitTaskCritical();
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_MPOOL_Reset(void) {
+    (void)memset((void *)mpool_state, 0, sizeof(mpool_state));
+}
+#endif
@@ -0,0 +1,125 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    mem_pool.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE
+ * @prefix  MPOOL
+ *
+ * @brief   Fixed-block memory pools with constant time allocation
+ * @details Every pool hands out blocks of one size from storage that is
+ *          reserved at build time (see mem_pool_cfg.h). Allocation and
+ *          release take constant time and cannot fragment the memory. A
+ *          request that is larger than the block size or that finds the pool
+ *          exhausted fails and is counted in the statistics of the pool.
+ *          The pools are used by FreeRTOS+TCP for its socket structures and
+ *          TCP buffers (see FreeRTOSIPConfig.h).
+ */
+
+#ifndef FOXBMS__MEM_POOL_H_
+#define FOXBMS__MEM_POOL_H_
+
+/*========== Includes =======================================================*/
+#include "mem_pool_cfg.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** usage statistics of one memory pool */
+typedef struct {
+    uint32_t blockSize_B;       /*!< size of one block in bytes */
+    uint16_t numberOfBlocks;    /*!< number of blocks in the pool */
+    uint16_t blocksInUse;       /*!< number of blocks that are currently allocated */
+    uint16_t peakBlocksInUse;   /*!< largest number of allocated blocks since the last reset */
+    uint16_t failedAllocations; /*!< number of failed allocations since the last reset (saturating) */
+    uint32_t largestRequest_B;  /*!< largest requested size in bytes since the last reset */
+} MPOOL_STATISTICS_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/**
+ * @brief   Allocates one block of a memory pool.
+ * @details Shall only be called from task context.
+ * @param   poolId  memory pool from which the block is taken
+ * @param   size_B  requested size in bytes
+ * @return  pointer to the block, NULL_PTR if the requested size is larger
+ *          than the block size or if no block is available
+ */
+extern void *MPOOL_Allocate(MPOOL_ID_e poolId, uint32_t size_B);
+
+/**
+ * @brief   Returns a block to its memory pool.
+ * @details Shall only be called from task context. Releasing NULL_PTR has no
+ *          effect; any other pointer has to be a block of this pool that is
+ *          currently allocated.
+ * @param   poolId  memory pool the block has been taken from
+ * @param   pBlock  pointer to the block
+ */
+extern void MPOOL_Free(MPOOL_ID_e poolId, void *pBlock);
+
+/**
+ * @brief   Copies the usage statistics of a memory pool.
+ * @param   poolId      memory pool
+ * @param   pStatistics pointer to where the statistics are copied
+ */
+extern void MPOOL_GetStatistics(MPOOL_ID_e poolId, MPOOL_STATISTICS_s *pStatistics);
+
+/**
+ * @brief   Resets the peak values of the statistics of all memory pools.
+ * @details The peak number of blocks starts again at the number of blocks
+ *          that are currently in use.
+ */
+extern void MPOOL_ResetStatistics(void);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_MPOOL_Reset(void);
+#endif
+
+#endif /* FOXBMS__MEM_POOL_H_ */
@@ -43,7 +43,7 @@
  * @file    sys.c
  * @author  foxBMS Team
  * @date    2020-02-24 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup ENGINE
  * @prefix  SYS
@@ -67,11 +67,12 @@
 #include "fstd_types.h"
 #include "imd.h"
 #include "interlock.h"
+#include "log.h"
 #include "meas.h"
 #include "os.h"
 #include "rtc.h"
 #include "sbc.h"
-#include "sof_trapezoid.h"
+#include "sof.h"
 #include "state_estimation.h"
 
 #include <stdint.h>
@@ -724,7 +725,17 @@ extern STD_RETURN_TYPE_e SYS_Trigger(SYS_STATE_s *pSystemState) {
     }
 
     if (earlyExit == false) {
+        const SYS_FSM_STATES_e state       = pSystemState->currentState;
+        const SYS_FSM_SUBSTATES_e substate = pSystemState->currentSubstate;
         (void)SYS_RunStateMachine(pSystemState);
+        if ((pSystemState->currentState != state) || (pSystemState->currentSubstate != substate)) {
+            (void)LOG_Write(
+                LOG_MESSAGE_ID_SYS_STATE,
+                (uint32_t)pSystemState->currentState,
+                (uint32_t)pSystemState->currentSubstate,
+                0u,
+                0u);
+        }
         pSystemState->triggerEntry--;
     }
     return returnValue;
@@ -43,7 +43,7 @@
  * @file    sys_mon.c
  * @author  foxBMS Team
  * @date    2019-11-28 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup ENGINE
  * @prefix  SYSM
@@ -55,8 +55,10 @@
 /*========== Includes =======================================================*/
 #include "sys_mon.h"
 
+#include "bg_jobs.h"
 #include "diag.h"
 #include "fram.h"
+#include "log.h"
 #include "os.h"
 
 #include <stdint.h>
@@ -135,6 +137,7 @@ static void SYSM_RecordTimingViolation(SYSM_TASK_ID_e taskId, uint32_t taskDurat
             FAS_ASSERT(FAS_TRAP);
             break;
     }
+    BGJ_Request(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
 }
 
 static bool SYSM_ConvertRecordedTimingsToViolation(uint32_t duration, uint32_t timestampEnter) {
@@ -181,6 +184,12 @@ void SYSM_CheckNotifications(void) {
                 (sysm_notifications[taskId].duration > sysm_ch_cfg[taskId].cycleTime)) {
                 /* module not running within its timed limits */
                 DIAG_Handler(DIAG_ID_SYSTEM_MONITORING, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, (uint32_t)taskId);
+                (void)LOG_Write(
+                    LOG_MESSAGE_ID_TASK_TIMING,
+                    (uint32_t)taskId,
+                    sysm_notifications[taskId].timestampEnter,
+                    sysm_notifications[taskId].duration,
+                    0u);
                 if (sysm_ch_cfg[taskId].enableRecording == SYSM_RECORDING_ENABLED) {
                     SYSM_RecordTimingViolation(
                         taskId, sysm_notifications[taskId].duration, sysm_notifications[taskId].timestampEnter);
@@ -260,8 +269,8 @@ extern void SYSM_ClearAllTimingViolations(void) {
     sysm_localFramCopy.task100msAlgorithmViolatingDuration = 0u;
     sysm_flagFramCopyHasChanges                            = true;
     OS_ExitTaskCritical();
-    /* commit to FRAM */
-    SYSM_UpdateFramData();
+    /* commit to FRAM in the background */
+    BGJ_Request(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
 }
 
 extern void SYSM_UpdateFramData(void) {
@@ -274,7 +283,13 @@ extern void SYSM_UpdateFramData(void) {
         sysm_flagFramCopyHasChanges = false;
         OS_ExitTaskCritical();
 
-        FRAM_WriteData(FRAM_BLOCK_ID_SYS_MON_RECORD);
+        if (FRAM_WriteData(FRAM_BLOCK_ID_SYS_MON_RECORD) != FRAM_ACCESS_OK) {
+            /* FRAM is busy, retry in the next background run */
+            OS_EnterTaskCritical();
+            sysm_flagFramCopyHasChanges = true;
+            OS_ExitTaskCritical();
+            BGJ_Request(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
+        }
     }
 }
 
@@ -43,7 +43,7 @@
  * @file    sys_mon.h
  * @author  foxBMS Team
  * @date    2019-11-28 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup ENGINE
  * @prefix  SYSM
@@ -134,9 +134,11 @@ extern void SYSM_ClearAllTimingViolations(void);
 /**
  * @brief   Commits the stored changes to FRAM if necessary
  * @details Writing to FRAM is costly (in terms of computation time), therefore
- *          it is decoupled from the main task of the sys mon module.
+ *          it is decoupled from the main task of the sys mon module and run as
+ *          background job #BGJ_JOB_ID_SYS_MON_FRAM_UPDATE.
  *          When called, this function checks the flag sysm_flagFramCopyHasChanges
- *          and writes to FRAM if there are changes.
+ *          and writes to FRAM if there are changes. If the FRAM is busy, the
+ *          job is requested again.
  */
 extern void SYSM_UpdateFramData(void);
 
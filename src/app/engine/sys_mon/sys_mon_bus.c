@@ -0,0 +1,299 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    sys_mon_bus.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE
+ * @prefix  SYSM
+ *
+ * @brief   Utilization and contention statistics of the SPI and I2C buses
+ * @details The statistics are updated from several tasks and from the DMA
+ *          interrupt. Tasks access them within a critical section. Interrupts
+ *          are not nested, so the interrupt versions can update them without
+ *          a critical section.
+ */
+
+/*========== Includes =======================================================*/
+#include "sys_mon_bus.h"
+
+#include "sys_mon_cfg.h"
+
+#include "mcu.h"
+#include "os.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** largest utilization in permill */
+#define SYSM_BUS_MAXIMUM_UTILIZATION_perm (1000u)
+
+/** state of an acquisition of and a wait for a bus */
+typedef struct {
+    bool isAcquired;          /*!< true while the bus is acquired */
+    uint32_t accessTimestamp; /*!< free running counter when the bus was acquired */
+    bool isWaiting;           /*!< true from the first rejected access until the bus is acquired */
+    uint32_t waitTimestamp;   /*!< free running counter at the first rejected access */
+} SYSM_BUS_STATE_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** upper limits of the wait time histogram bins, the last bin has no limit */
+static const uint32_t sysm_busWaitBinLimits_us[SYSM_BUS_WAIT_HISTOGRAM_BINS - 1u] = {
+    SYSM_BUS_WAIT_BIN_0_LIMIT_us,
+    SYSM_BUS_WAIT_BIN_1_LIMIT_us,
+    SYSM_BUS_WAIT_BIN_2_LIMIT_us,
+    SYSM_BUS_WAIT_BIN_3_LIMIT_us,
+    SYSM_BUS_WAIT_BIN_4_LIMIT_us,
+};
+
+/** acquisition and wait state per bus */
+static SYSM_BUS_STATE_s sysm_busStates[SYSM_BUS_E_MAX] = {0};
+
+/** statistics per bus */
+static SYSM_BUS_STATISTICS_s sysm_busStatistics[SYSM_BUS_E_MAX] = {0};
+
+/** OS tick count at the start of the observation */
+static uint32_t sysm_busObservationStart_ms = 0u;
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   Adds two counter values and saturates at the largest value
+ * @param   counter     current counter value
+ * @param   increment   value to be added
+ * @return  sum of both values or UINT32_MAX
+ */
+static uint32_t SYSM_AddSaturated(uint32_t counter, uint32_t increment);
+
+/**
+ * @brief   Returns the histogram bin of a wait time
+ * @param   waitTime_us wait time
+ * @return  index of the bin
+ */
+static uint8_t SYSM_GetWaitHistogramBin(uint32_t waitTime_us);
+
+/**
+ * @brief   Ends a pending wait for a bus and adds it to the histogram
+ * @param   bus         bus
+ * @param   timestamp   free running counter at the end of the wait
+ */
+static void SYSM_EndBusWait(SYSM_BUS_e bus, uint32_t timestamp);
+
+/**
+ * @brief   Ends an acquisition of a bus and adds it to the busy time
+ * @param   bus         bus
+ * @param   timestamp   free running counter at the release of the bus
+ */
+static void SYSM_EndBusAccess(SYSM_BUS_e bus, uint32_t timestamp);
+
+/**
+ * @brief   Counts a transfer on a bus
+ * @param   bus             bus
+ * @param   numberOfWords   number of words of the transfer
+ * @param   timestamp       free running counter at the start of the transfer
+ */
+static void SYSM_AddBusTransfer(SYSM_BUS_e bus, uint32_t numberOfWords, uint32_t timestamp);
+
+/*========== Static Function Implementations ================================*/
+static uint32_t SYSM_AddSaturated(uint32_t counter, uint32_t increment) {
+    /* AXIVION Routine Generic-MissingParameterAssert: counter: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: increment: parameter accepts whole range */
+    uint32_t sum = UINT32_MAX;
+    if (increment <= (UINT32_MAX - counter)) {
+        sum = counter + increment;
+    }
+    return sum;
+}
+
+static uint8_t SYSM_GetWaitHistogramBin(uint32_t waitTime_us) {
+    /* AXIVION Routine Generic-MissingParameterAssert: waitTime_us: parameter accepts whole range */
+    uint8_t bin = (uint8_t)(SYSM_BUS_WAIT_HISTOGRAM_BINS - 1u);
+    for (uint8_t i = 0u; i < (uint8_t)(SYSM_BUS_WAIT_HISTOGRAM_BINS - 1u); i++) {
+        if (waitTime_us < sysm_busWaitBinLimits_us[i]) {
+            bin = i;
+            break;
+        }
+    }
+    return bin;
+}
+
+static void SYSM_EndBusWait(SYSM_BUS_e bus, uint32_t timestamp) {
+    FAS_ASSERT(bus < SYSM_BUS_E_MAX);
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp: parameter accepts whole range */
+    SYSM_BUS_STATE_s *pState = &sysm_busStates[bus];
+
+    if (pState->isWaiting == true) {
+        /* unsigned subtraction handles the overflow of the free running counter */
+        const uint32_t waitTime_us = MCU_ConvertFrcDifferenceToTimespan_us(timestamp - pState->waitTimestamp);
+        SYSM_BUS_STATISTICS_s *pStatistics = &sysm_busStatistics[bus];
+        const uint8_t bin                  = SYSM_GetWaitHistogramBin(waitTime_us);
+        pStatistics->waitHistogram[bin]    = SYSM_AddSaturated(pStatistics->waitHistogram[bin], 1u);
+        if (waitTime_us > pStatistics->maximumWaitTime_us) {
+            pStatistics->maximumWaitTime_us = waitTime_us;
+        }
+        pState->isWaiting = false;
+    }
+}
+
+static void SYSM_EndBusAccess(SYSM_BUS_e bus, uint32_t timestamp) {
+    FAS_ASSERT(bus < SYSM_BUS_E_MAX);
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp: parameter accepts whole range */
+    SYSM_BUS_STATE_s *pState = &sysm_busStates[bus];
+
+    if (pState->isAcquired == true) {
+        const uint32_t busyTime_us = MCU_ConvertFrcDifferenceToTimespan_us(timestamp - pState->accessTimestamp);
+        SYSM_BUS_STATISTICS_s *pStatistics = &sysm_busStatistics[bus];
+        pStatistics->busyTime_us += (uint64_t)busyTime_us;
+        if (busyTime_us > pStatistics->maximumBusyTime_us) {
+            pStatistics->maximumBusyTime_us = busyTime_us;
+        }
+        pState->isAcquired = false;
+    }
+}
+
+static void SYSM_AddBusTransfer(SYSM_BUS_e bus, uint32_t numberOfWords, uint32_t timestamp) {
+    FAS_ASSERT(bus < SYSM_BUS_E_MAX);
+    /* AXIVION Routine Generic-MissingParameterAssert: numberOfWords: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp: parameter accepts whole range */
+    SYSM_EndBusWait(bus, timestamp);
+
+    SYSM_BUS_STATISTICS_s *pStatistics = &sysm_busStatistics[bus];
+    pStatistics->numberOfTransfers     = SYSM_AddSaturated(pStatistics->numberOfTransfers, 1u);
+    pStatistics->numberOfWords         = SYSM_AddSaturated(pStatistics->numberOfWords, numberOfWords);
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void SYSM_RecordBusAccess(SYSM_BUS_e bus) {
+    FAS_ASSERT(bus < SYSM_BUS_E_MAX);
+    const uint32_t timestamp = MCU_GetFreeRunningCount();
+
+    OS_EnterTaskCritical();
+    SYSM_EndBusWait(bus, timestamp);
+    sysm_busStates[bus].isAcquired      = true;
+    sysm_busStates[bus].accessTimestamp = timestamp;
+    OS_ExitTaskCritical();
+}
+
+extern void SYSM_RecordBusRelease(SYSM_BUS_e bus) {
+    FAS_ASSERT(bus < SYSM_BUS_E_MAX);
+    const uint32_t timestamp = MCU_GetFreeRunningCount();
+
+    OS_EnterTaskCritical();
+    SYSM_EndBusAccess(bus, timestamp);
+    OS_ExitTaskCritical();
+}
+
+extern void SYSM_RecordBusReleaseFromIsr(SYSM_BUS_e bus) {
+    FAS_ASSERT(bus < SYSM_BUS_E_MAX);
+    SYSM_EndBusAccess(bus, MCU_GetFreeRunningCount());
+}
+
+extern void SYSM_RecordBusTransfer(SYSM_BUS_e bus, uint32_t numberOfWords) {
+    FAS_ASSERT(bus < SYSM_BUS_E_MAX);
+    /* AXIVION Routine Generic-MissingParameterAssert: numberOfWords: parameter accepts whole range */
+    const uint32_t timestamp = MCU_GetFreeRunningCount();
+
+    OS_EnterTaskCritical();
+    SYSM_AddBusTransfer(bus, numberOfWords, timestamp);
+    OS_ExitTaskCritical();
+}
+
+extern void SYSM_RecordBusRejection(SYSM_BUS_e bus, SYSM_BUS_REJECTION_e reason) {
+    FAS_ASSERT(bus < SYSM_BUS_E_MAX);
+    FAS_ASSERT(reason < SYSM_BUS_REJECTION_E_MAX);
+    const uint32_t timestamp = MCU_GetFreeRunningCount();
+
+    OS_EnterTaskCritical();
+    SYSM_BUS_STATISTICS_s *pStatistics = &sysm_busStatistics[bus];
+    if (reason == SYSM_BUS_REJECTION_LOCK) {
+        pStatistics->numberOfLockRejections = SYSM_AddSaturated(pStatistics->numberOfLockRejections, 1u);
+    } else {
+        pStatistics->numberOfBusyRejections = SYSM_AddSaturated(pStatistics->numberOfBusyRejections, 1u);
+    }
+    /* the wait lasts from the first rejection until the bus is acquired */
+    if (sysm_busStates[bus].isWaiting == false) {
+        sysm_busStates[bus].isWaiting     = true;
+        sysm_busStates[bus].waitTimestamp = timestamp;
+    }
+    OS_ExitTaskCritical();
+}
+
+extern void SYSM_GetBusStatistics(SYSM_BUS_e bus, SYSM_BUS_STATISTICS_s *pStatistics) {
+    FAS_ASSERT(bus < SYSM_BUS_E_MAX);
+    FAS_ASSERT(pStatistics != NULL_PTR);
+
+    OS_EnterTaskCritical();
+    *pStatistics                    = sysm_busStatistics[bus];
+    pStatistics->observationTime_ms = OS_GetTickCount() - sysm_busObservationStart_ms;
+    OS_ExitTaskCritical();
+
+    /* busy time in us per observation time in ms is the utilization in permill */
+    uint64_t utilization_perm = 0u;
+    if (pStatistics->observationTime_ms > 0u) {
+        utilization_perm = pStatistics->busyTime_us / (uint64_t)pStatistics->observationTime_ms;
+    }
+    if (utilization_perm > SYSM_BUS_MAXIMUM_UTILIZATION_perm) {
+        utilization_perm = SYSM_BUS_MAXIMUM_UTILIZATION_perm;
+    }
+    pStatistics->utilization_perm = (uint16_t)utilization_perm;
+}
+
+extern void SYSM_ResetBusStatistics(void) {
+    OS_EnterTaskCritical();
+    for (uint8_t bus = 0u; bus < (uint8_t)SYSM_BUS_E_MAX; bus++) {
+        sysm_busStatistics[bus] = (SYSM_BUS_STATISTICS_s){0};
+    }
+    sysm_busObservationStart_ms = OS_GetTickCount();
+    OS_ExitTaskCritical();
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern uint8_t TEST_SYSM_GetWaitHistogramBin(uint32_t waitTime_us) {
+    return SYSM_GetWaitHistogramBin(waitTime_us);
+}
+#endif
@@ -0,0 +1,171 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    sys_mon_bus.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE
+ * @prefix  SYSM
+ *
+ * @brief   Utilization and contention statistics of the SPI and I2C buses
+ * @details The bus drivers report when a bus is acquired and released, every
+ *          transfer and every access that is rejected because the bus is in
+ *          use. Busy and wait times are measured with the free running
+ *          counter. The time from the first rejected access until the bus is
+ *          acquired again is aggregated in a histogram.
+ */
+
+#ifndef FOXBMS__SYS_MON_BUS_H_
+#define FOXBMS__SYS_MON_BUS_H_
+
+/*========== Includes =======================================================*/
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** number of bins of the wait time histogram */
+#define SYSM_BUS_WAIT_HISTOGRAM_BINS (6u)
+
+/**
+ * buses for which statistics are recorded; the SPI buses are ordered like the
+ * SPI interface indexes (SPI_SPI1_INDEX to SPI_SPI5_INDEX)
+ */
+typedef enum {
+    SYSM_BUS_SPI1,  /*!< SPI1 (AFE) */
+    SYSM_BUS_SPI2,  /*!< SPI2 */
+    SYSM_BUS_SPI3,  /*!< SPI3 (FRAM) */
+    SYSM_BUS_SPI4,  /*!< SPI4 */
+    SYSM_BUS_SPI5,  /*!< SPI5 */
+    SYSM_BUS_I2C1,  /*!< I2C1 */
+    SYSM_BUS_I2C2,  /*!< I2C2 */
+    SYSM_BUS_E_MAX, /*!< number of buses */
+} SYSM_BUS_e;
+
+/** reasons for which an access to a bus is rejected */
+typedef enum {
+    SYSM_BUS_REJECTION_LOCK,  /*!< bus could not be locked (e.g., #SPI_Lock) */
+    SYSM_BUS_REJECTION_BUSY,  /*!< transfer found the bus busy (e.g., SPI busy flag, I2C bus busy) */
+    SYSM_BUS_REJECTION_E_MAX, /*!< number of rejection reasons */
+} SYSM_BUS_REJECTION_e;
+
+/** statistics of one bus since the last reset */
+typedef struct {
+    uint32_t numberOfTransfers;                           /*!< number of started transfers */
+    uint32_t numberOfWords;                               /*!< transferred SPI frames or I2C bytes */
+    uint64_t busyTime_us;                                 /*!< accumulated time the bus was acquired */
+    uint32_t maximumBusyTime_us;                          /*!< longest single acquisition of the bus */
+    uint32_t numberOfLockRejections;                      /*!< accesses rejected by the lock */
+    uint32_t numberOfBusyRejections;                      /*!< accesses rejected by the busy state */
+    uint32_t maximumWaitTime_us;                          /*!< longest wait for the bus */
+    uint32_t waitHistogram[SYSM_BUS_WAIT_HISTOGRAM_BINS]; /*!< number of waits per bin */
+    uint32_t observationTime_ms;                          /*!< time since the last reset */
+    uint16_t utilization_perm;                            /*!< busy time per observation time */
+} SYSM_BUS_STATISTICS_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Records that a bus has been acquired
+ * @details Starts the measurement of the busy time and ends a pending wait
+ *          for the bus.
+ * @param   bus bus that has been acquired
+ */
+extern void SYSM_RecordBusAccess(SYSM_BUS_e bus);
+
+/**
+ * @brief   Records that a bus has been released
+ * @details Adds the time since #SYSM_RecordBusAccess to the busy time.
+ * @param   bus bus that has been released
+ */
+extern void SYSM_RecordBusRelease(SYSM_BUS_e bus);
+
+/**
+ * @brief   Interrupt version of #SYSM_RecordBusRelease
+ * @param   bus bus that has been released
+ */
+extern void SYSM_RecordBusReleaseFromIsr(SYSM_BUS_e bus);
+
+/**
+ * @brief   Records a transfer on an acquired bus
+ * @details Ends a pending wait for the bus, as a transfer on a bus that the
+ *          caller has acquired before (e.g., FRAM access after #SPI_Lock)
+ *          does not acquire the bus again.
+ * @param   bus             bus on which the transfer is started
+ * @param   numberOfWords   number of SPI frames or I2C bytes of the transfer
+ */
+extern void SYSM_RecordBusTransfer(SYSM_BUS_e bus, uint32_t numberOfWords);
+
+/**
+ * @brief   Records an access to a bus that has been rejected
+ * @details The first rejection starts a wait for the bus that lasts until the
+ *          bus is acquired or a transfer is started.
+ * @param   bus     bus that has been requested
+ * @param   reason  reason of the rejection
+ */
+extern void SYSM_RecordBusRejection(SYSM_BUS_e bus, SYSM_BUS_REJECTION_e reason);
+
+/**
+ * @brief   Copies the statistics of a bus
+ * @details The observation time and the utilization are calculated at the
+ *          time of the call.
+ * @param       bus             bus
+ * @param[out]  pStatistics     pointer to the statistics to be filled
+ */
+extern void SYSM_GetBusStatistics(SYSM_BUS_e bus, SYSM_BUS_STATISTICS_s *pStatistics);
+
+/**
+ * @brief   Resets the statistics of all buses and restarts the observation
+ * @details Acquisitions and waits that are in progress are kept, they are
+ *          accounted to the new observation period when they end.
+ */
+extern void SYSM_ResetBusStatistics(void);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern uint8_t TEST_SYSM_GetWaitHistogramBin(uint32_t waitTime_us);
+#endif
+
+#endif /* FOXBMS__SYS_MON_BUS_H_ */
@@ -0,0 +1,164 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    sys_mon_latency.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE
+ * @prefix  SYSM
+ *
+ * @brief   Latency statistics of the measurement processing chain
+ * @details The statistics are updated from several tasks and are therefore
+ *          only accessed within a critical section.
+ */
+
+/*========== Includes =======================================================*/
+#include "sys_mon_latency.h"
+
+#include "sys_mon_cfg.h"
+
+#include "mcu.h"
+#include "os.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** staleness budget per processing stage */
+static const uint32_t sysm_latencyBudgets_us[SYSM_LATENCY_STAGE_E_MAX] = {
+    SYSM_LATENCY_BUDGET_AFE_us,
+    SYSM_LATENCY_BUDGET_REDUNDANCY_us,
+    SYSM_LATENCY_BUDGET_CAN_TX_us,
+};
+
+/** latency statistics per processing stage */
+static SYSM_LATENCY_STATISTICS_s sysm_latencyStatistics[SYSM_LATENCY_STAGE_E_MAX] = {0};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/*========== Static Function Implementations ================================*/
+
+/*========== Extern Function Implementations ================================*/
+extern uint32_t SYSM_GetAcquisitionTimestamp(void) {
+    uint32_t timestamp = MCU_GetFreeRunningCount();
+    if (timestamp == 0u) {
+        timestamp = 1u;
+    }
+    return timestamp;
+}
+
+extern void SYSM_RecordLatency(SYSM_LATENCY_STAGE_e stage, uint32_t acquisitionTimestamp) {
+    FAS_ASSERT(stage < SYSM_LATENCY_STAGE_E_MAX);
+    /* AXIVION Routine Generic-MissingParameterAssert: acquisitionTimestamp: parameter accepts whole range */
+
+    if (acquisitionTimestamp != 0u) {
+        /* unsigned subtraction handles the overflow of the free running counter */
+        const uint32_t age_us =
+            MCU_ConvertFrcDifferenceToTimespan_us(MCU_GetFreeRunningCount() - acquisitionTimestamp);
+
+        OS_EnterTaskCritical();
+        SYSM_LATENCY_STATISTICS_s *pStatistics = &sysm_latencyStatistics[stage];
+        if ((pStatistics->numberOfSamples == 0u) || (age_us < pStatistics->minimum_us)) {
+            pStatistics->minimum_us = age_us;
+        }
+        if (age_us > pStatistics->maximum_us) {
+            pStatistics->maximum_us = age_us;
+        }
+        pStatistics->last_us = age_us;
+        if (pStatistics->numberOfSamples < UINT32_MAX) {
+            pStatistics->numberOfSamples++;
+        }
+        if ((age_us > sysm_latencyBudgets_us[stage]) && (pStatistics->numberOfBudgetViolations < UINT32_MAX)) {
+            pStatistics->numberOfBudgetViolations++;
+        }
+        OS_ExitTaskCritical();
+    }
+}
+
+extern void SYSM_GetLatencyStatistics(SYSM_LATENCY_STAGE_e stage, SYSM_LATENCY_STATISTICS_s *pStatistics) {
+    FAS_ASSERT(stage < SYSM_LATENCY_STAGE_E_MAX);
+    FAS_ASSERT(pStatistics != NULL_PTR);
+
+    OS_EnterTaskCritical();
+    *pStatistics = sysm_latencyStatistics[stage];
+    OS_ExitTaskCritical();
+}
+
+extern void SYSM_ResetLatencyStatistics(void) {
+    OS_EnterTaskCritical();
+    for (uint8_t stage = 0u; stage < (uint8_t)SYSM_LATENCY_STAGE_E_MAX; stage++) {
+        sysm_latencyStatistics[stage].minimum_us               = 0u;
+        sysm_latencyStatistics[stage].maximum_us               = 0u;
+        sysm_latencyStatistics[stage].last_us                  = 0u;
+        sysm_latencyStatistics[stage].numberOfSamples          = 0u;
+        sysm_latencyStatistics[stage].numberOfBudgetViolations = 0u;
+    }
+    OS_ExitTaskCritical();
+}
+
+extern bool SYSM_IsLatencyBudgetExceeded(SYSM_LATENCY_STAGE_e stage) {
+    FAS_ASSERT(stage < SYSM_LATENCY_STAGE_E_MAX);
+
+    OS_EnterTaskCritical();
+    const uint32_t maximum_us = sysm_latencyStatistics[stage].maximum_us;
+    OS_ExitTaskCritical();
+
+    bool isExceeded = false;
+    if (maximum_us > sysm_latencyBudgets_us[stage]) {
+        isExceeded = true;
+    }
+    return isExceeded;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern uint32_t TEST_SYSM_GetLatencyBudget(SYSM_LATENCY_STAGE_e stage) {
+    FAS_ASSERT(stage < SYSM_LATENCY_STAGE_E_MAX);
+    return sysm_latencyBudgets_us[stage];
+}
+#endif
@@ -0,0 +1,132 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    sys_mon_latency.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE
+ * @prefix  SYSM
+ *
+ * @brief   Latency statistics of the measurement processing chain
+ * @details Measurements are stamped with the free running counter at the
+ *          start of their acquisition. Each processing stage reports the age
+ *          of the data it hands on, and this module keeps the minimum, maximum
+ *          and last age per stage together with the number of violations of
+ *          the configured staleness budget.
+ */
+
+#ifndef FOXBMS__SYS_MON_LATENCY_H_
+#define FOXBMS__SYS_MON_LATENCY_H_
+
+/*========== Includes =======================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** processing stages at which the age of a measurement is recorded */
+typedef enum {
+    SYSM_LATENCY_STAGE_AFE,        /*!< raw AFE measurement written to the database */
+    SYSM_LATENCY_STAGE_REDUNDANCY, /*!< validated measurement written to the database */
+    SYSM_LATENCY_STAGE_CAN_TX,     /*!< measurement copied into a CAN frame */
+    SYSM_LATENCY_STAGE_E_MAX,      /*!< number of stages */
+} SYSM_LATENCY_STAGE_e;
+
+/** latency statistics of one processing stage */
+typedef struct {
+    uint32_t minimum_us;               /*!< smallest recorded age */
+    uint32_t maximum_us;               /*!< largest recorded age */
+    uint32_t last_us;                  /*!< most recently recorded age */
+    uint32_t numberOfSamples;          /*!< number of recorded ages */
+    uint32_t numberOfBudgetViolations; /*!< number of ages that exceeded the budget of the stage */
+} SYSM_LATENCY_STATISTICS_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Returns a timestamp to mark the start of an acquisition
+ * @details The timestamp is the value of the free running counter. As 0 marks
+ *          an unknown acquisition time in the database header, a counter value
+ *          of 0 is returned as 1.
+ * @return  timestamp to be stored in the database header
+ */
+extern uint32_t SYSM_GetAcquisitionTimestamp(void);
+
+/**
+ * @brief   Records the age of a measurement at a processing stage
+ * @details Timestamps of 0 (i.e., unknown acquisition time) are ignored.
+ * @param   stage                   processing stage that hands on the data
+ * @param   acquisitionTimestamp    timestamp taken with
+ *                                  #SYSM_GetAcquisitionTimestamp at the start
+ *                                  of the acquisition
+ */
+extern void SYSM_RecordLatency(SYSM_LATENCY_STAGE_e stage, uint32_t acquisitionTimestamp);
+
+/**
+ * @brief   Copies the latency statistics of a processing stage
+ * @param       stage           processing stage
+ * @param[out]  pStatistics     pointer to the statistics to be filled
+ */
+extern void SYSM_GetLatencyStatistics(SYSM_LATENCY_STAGE_e stage, SYSM_LATENCY_STATISTICS_s *pStatistics);
+
+/**
+ * @brief   Resets the latency statistics of all processing stages
+ */
+extern void SYSM_ResetLatencyStatistics(void);
+
+/**
+ * @brief   Checks if the worst-case age of a stage exceeded its budget
+ * @param   stage   processing stage
+ * @return  true if the largest recorded age is above the budget, false
+ *          otherwise
+ */
+extern bool SYSM_IsLatencyBudgetExceeded(SYSM_LATENCY_STAGE_e stage);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern uint32_t TEST_SYSM_GetLatencyBudget(SYSM_LATENCY_STAGE_e stage);
+#endif
+
+#endif /* FOXBMS__SYS_MON_LATENCY_H_ */
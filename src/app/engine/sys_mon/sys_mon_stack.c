@@ -0,0 +1,174 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    sys_mon_stack.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE
+ * @prefix  SYSM
+ *
+ * @brief   Stack usage of the tasks
+ * @details The tasks are registered before the scheduler is started. The
+ *          stack usage is read by other tasks than the one that samples it and
+ *          is therefore only accessed within a critical section.
+ */
+
+/*========== Includes =======================================================*/
+#include "sys_mon_stack.h"
+
+#include "sys_mon_cfg.h"
+
+#include "log.h"
+#include "os.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** handles of the registered tasks */
+static OS_TASK_HANDLE sysm_stackTaskHandles[SYSM_STACK_TASK_E_MAX] = {0};
+
+/** stack usage per task */
+static SYSM_STACK_USAGE_s sysm_stackUsage[SYSM_STACK_TASK_E_MAX] = {0};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   Checks if a stack usage exceeds the configured limit
+ *          (#SYSM_STACK_USAGE_LIMIT_perc)
+ * @param   usage_B     stack usage
+ * @param   stackSize_B configured stack size
+ * @return  true if the usage is above the limit, false otherwise
+ */
+static bool SYSM_IsStackUsageLimitExceeded(uint32_t usage_B, uint32_t stackSize_B);
+
+/*========== Static Function Implementations ================================*/
+static bool SYSM_IsStackUsageLimitExceeded(uint32_t usage_B, uint32_t stackSize_B) {
+    /* AXIVION Routine Generic-MissingParameterAssert: usage_B: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: stackSize_B: parameter accepts whole range */
+    bool isExceeded = false;
+    /* compare in 64 bit to avoid an overflow of the multiplication */
+    if (((uint64_t)usage_B * 100u) > ((uint64_t)stackSize_B * SYSM_STACK_USAGE_LIMIT_perc)) {
+        isExceeded = true;
+    }
+    return isExceeded;
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void SYSM_RegisterTaskStack(SYSM_STACK_TASK_e task, OS_TASK_HANDLE taskHandle, uint32_t stackSize_B) {
+    FAS_ASSERT(task < SYSM_STACK_TASK_E_MAX);
+    FAS_ASSERT(taskHandle != NULL_PTR);
+    FAS_ASSERT(stackSize_B > 0u);
+
+    OS_EnterTaskCritical();
+    sysm_stackTaskHandles[task]           = taskHandle;
+    sysm_stackUsage[task].isRegistered    = true;
+    sysm_stackUsage[task].stackSize_B     = stackSize_B;
+    sysm_stackUsage[task].maximumUsage_B  = 0u;
+    sysm_stackUsage[task].isLimitExceeded = false;
+    OS_ExitTaskCritical();
+}
+
+extern void SYSM_UpdateStackUsage(void) {
+    for (uint8_t task = 0u; task < (uint8_t)SYSM_STACK_TASK_E_MAX; task++) {
+        OS_EnterTaskCritical();
+        const OS_TASK_HANDLE taskHandle = sysm_stackTaskHandles[task];
+        const uint32_t stackSize_B      = sysm_stackUsage[task].stackSize_B;
+        OS_ExitTaskCritical();
+
+        if (taskHandle != NULL_PTR) {
+            /* the stack is searched outside of the critical section */
+            const uint32_t unusedStack_B = OS_GetStackHighWaterMark_B(taskHandle);
+            uint32_t usage_B             = 0u;
+            if (unusedStack_B < stackSize_B) {
+                usage_B = stackSize_B - unusedStack_B;
+            }
+
+            /* the flag is latched, so that the exceedance is only logged once */
+            bool isNewlyExceeded = false;
+            OS_EnterTaskCritical();
+            if (usage_B > sysm_stackUsage[task].maximumUsage_B) {
+                sysm_stackUsage[task].maximumUsage_B = usage_B;
+            }
+            if ((sysm_stackUsage[task].isLimitExceeded == false) &&
+                (SYSM_IsStackUsageLimitExceeded(sysm_stackUsage[task].maximumUsage_B, stackSize_B) == true)) {
+                sysm_stackUsage[task].isLimitExceeded = true;
+                isNewlyExceeded                       = true;
+            }
+            OS_ExitTaskCritical();
+
+            if (isNewlyExceeded == true) {
+                (void)LOG_Write(LOG_MESSAGE_ID_STACK_USAGE, (uint32_t)task, usage_B, stackSize_B, 0u);
+            }
+        }
+    }
+}
+
+extern void SYSM_GetStackUsage(SYSM_STACK_TASK_e task, SYSM_STACK_USAGE_s *pUsage) {
+    FAS_ASSERT(task < SYSM_STACK_TASK_E_MAX);
+    FAS_ASSERT(pUsage != NULL_PTR);
+
+    OS_EnterTaskCritical();
+    *pUsage = sysm_stackUsage[task];
+    OS_ExitTaskCritical();
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern bool TEST_SYSM_IsStackUsageLimitExceeded(uint32_t usage_B, uint32_t stackSize_B) {
+    return SYSM_IsStackUsageLimitExceeded(usage_B, stackSize_B);
+}
+extern void TEST_SYSM_ResetStackUsage(void) {
+    for (uint8_t task = 0u; task < (uint8_t)SYSM_STACK_TASK_E_MAX; task++) {
+        sysm_stackTaskHandles[task]           = NULL_PTR;
+        sysm_stackUsage[task].isRegistered    = false;
+        sysm_stackUsage[task].stackSize_B     = 0u;
+        sysm_stackUsage[task].maximumUsage_B  = 0u;
+        sysm_stackUsage[task].isLimitExceeded = false;
+    }
+}
+#endif
@@ -0,0 +1,131 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    sys_mon_stack.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE
+ * @prefix  SYSM
+ *
+ * @brief   Stack usage of the tasks
+ * @details The tasks are registered with their stack size when they are
+ *          created. The stack high-water mark of all registered tasks is
+ *          sampled periodically and the largest stack usage that has been
+ *          observed since startup is kept per task. A task of which the
+ *          usage exceeds #SYSM_STACK_USAGE_LIMIT_perc of its stack is flagged
+ *          and logged once.
+ *          The worst-case stack usage that is derived from the call graph at
+ *          build time is reported by the build (``foxbms.stack-usage.txt``).
+ */
+
+#ifndef FOXBMS__SYS_MON_STACK_H_
+#define FOXBMS__SYS_MON_STACK_H_
+
+/*========== Includes =======================================================*/
+#include "os.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** tasks of which the stack usage is monitored */
+typedef enum {
+    SYSM_STACK_TASK_ENGINE,                 /*!< engine task */
+    SYSM_STACK_TASK_CYCLIC_1MS,             /*!< cyclic 1ms task */
+    SYSM_STACK_TASK_CYCLIC_10MS,            /*!< cyclic 10ms task */
+    SYSM_STACK_TASK_CYCLIC_100MS,           /*!< cyclic 100ms task */
+    SYSM_STACK_TASK_CYCLIC_ALGORITHM_100MS, /*!< cyclic 100ms task for algorithms */
+    SYSM_STACK_TASK_I2C,                    /*!< continuously running I2C task */
+    SYSM_STACK_TASK_AFE,                    /*!< continuously running AFE task */
+    SYSM_STACK_TASK_UART,                   /*!< continuously running UART task */
+    SYSM_STACK_TASK_EMAC,                   /*!< continuously running EMAC task */
+    SYSM_STACK_TASK_E_MAX,                  /*!< number of monitored tasks */
+} SYSM_STACK_TASK_e;
+
+/** stack usage of one task */
+typedef struct {
+    bool isRegistered;       /*!< true if the task has been created and registered */
+    uint32_t stackSize_B;    /*!< configured stack size */
+    uint32_t maximumUsage_B; /*!< largest stack usage observed since startup */
+    bool isLimitExceeded;    /*!< true once the usage has exceeded #SYSM_STACK_USAGE_LIMIT_perc */
+} SYSM_STACK_USAGE_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Registers a task for the stack usage monitoring
+ * @details Has to be called once after the task has been created.
+ * @param   task        monitored task
+ * @param   taskHandle  handle of the created task
+ * @param   stackSize_B configured stack size of the task
+ */
+extern void SYSM_RegisterTaskStack(SYSM_STACK_TASK_e task, OS_TASK_HANDLE taskHandle, uint32_t stackSize_B);
+
+/**
+ * @brief   Samples the stack high-water mark of all registered tasks
+ * @details The high-water mark is determined by searching the unused part of
+ *          the stack, therefore this function should only be called at a low
+ *          rate from a low priority task.
+ *          When the usage of a task exceeds #SYSM_STACK_USAGE_LIMIT_perc of
+ *          its stack for the first time, the task is flagged
+ *          (#SYSM_STACK_USAGE_s::isLimitExceeded) and a
+ *          #LOG_MESSAGE_ID_STACK_USAGE record is written.
+ */
+extern void SYSM_UpdateStackUsage(void);
+
+/**
+ * @brief   Copies the stack usage of a task
+ * @param       task    monitored task
+ * @param[out]  pUsage  pointer to the stack usage to be filled
+ */
+extern void SYSM_GetStackUsage(SYSM_STACK_TASK_e task, SYSM_STACK_USAGE_s *pUsage);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern bool TEST_SYSM_IsStackUsageLimitExceeded(uint32_t usage_B, uint32_t stackSize_B);
+extern void TEST_SYSM_ResetStackUsage(void);
+#endif
+
+#endif /* FOXBMS__SYS_MON_STACK_H_ */
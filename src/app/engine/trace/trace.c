@@ -0,0 +1,501 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    trace.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE
+ * @prefix  TRC
+ *
+ * @brief   RAM ring buffer trace recorder for kernel and OS events
+ * @details Events from interrupt context (context switches, interrupt service
+ *          routines) are stored without locking, as interrupts are not nested
+ *          on this target. Events from task context are stored inside a short
+ *          task critical section. Each event is completely written inside
+ *          this protection, therefore the consumer only has to wait for the
+ *          recorder to be frozen.
+ */
+
+/*========== Includes =======================================================*/
+#include "trace.h"
+
+#include "HL_sys_pmu.h"
+#include "HL_system.h"
+
+#include "fassert.h"
+#include "fstd_types.h"
+#include "os.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** frequency of the CPU cycle counter that is used as timestamp */
+#define TRC_TIMESTAMP_FREQUENCY_Hz ((uint32_t)(GCLK_FREQ * 1000000.0f))
+
+FAS_STATIC_ASSERT(
+    (TRC_RING_BUFFER_LENGTH & (TRC_RING_BUFFER_LENGTH - 1u)) == 0u,
+    "TRC_RING_BUFFER_LENGTH has to be a power of two.");
+FAS_STATIC_ASSERT(TRC_MAXIMUM_NUMBER_OF_QUEUES < TRC_UNKNOWN_OBJECT, "Queue index collides with TRC_UNKNOWN_OBJECT.");
+
+/** one event in the ring buffer */
+typedef struct {
+    uint32_t timestamp; /*!< CPU cycle counter value */
+    uint8_t type;       /*!< type of the event, see #TRC_EVENT_TYPE_e */
+    uint8_t object;     /*!< task, interrupt or OS function the event belongs to */
+    uint16_t argument;  /*!< event specific argument */
+} TRC_EVENT_s;
+
+/** one entry of the task table */
+typedef struct {
+    uint8_t number;                  /*!< task number assigned by the kernel */
+    uint8_t priority;                /*!< priority at creation of the task */
+    char name[TRC_TASK_NAME_LENGTH]; /*!< task name, not necessarily terminated */
+} TRC_TASK_ENTRY_s;
+
+/** parts of a serialized snapshot, in the order of transmission */
+typedef enum {
+    TRC_EXPORT_SECTION_HEADER, /*!< snapshot header */
+    TRC_EXPORT_SECTION_TASKS,  /*!< task table */
+    TRC_EXPORT_SECTION_EVENTS, /*!< events, oldest first */
+    TRC_EXPORT_SECTION_DONE,   /*!< snapshot has been completely read */
+} TRC_EXPORT_SECTION_e;
+
+/** progress of the snapshot export */
+typedef struct {
+    TRC_EXPORT_SECTION_e section; /*!< part of the snapshot that is exported */
+    uint32_t index;               /*!< next entry inside this part */
+} TRC_EXPORT_STATE_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/** ring buffer of the events */
+static TRC_EVENT_s trc_ringBuffer[TRC_RING_BUFFER_LENGTH] = {0};
+
+/** index of the next event to be written (free running) */
+static uint32_t trc_writeIndex = 0u;
+
+/** task that is currently running, as reported by the kernel */
+static uint8_t trc_currentTask = 0u;
+
+/** names of the created tasks */
+static TRC_TASK_ENTRY_s trc_tasks[TRC_MAXIMUM_NUMBER_OF_TASKS] = {0};
+
+/** number of valid entries in #trc_tasks */
+static uint32_t trc_numberOfTasks = 0u;
+
+/** queues (and semaphores) in the order of their creation */
+static const void *trc_queues[TRC_MAXIMUM_NUMBER_OF_QUEUES] = {0};
+
+/** number of valid entries in #trc_queues */
+static uint32_t trc_numberOfQueues = 0u;
+
+/** reason of the freeze, #TRC_FREEZE_REASON_NONE while recording */
+static volatile TRC_FREEZE_REASON_e trc_freezeReason = TRC_FREEZE_REASON_NONE;
+
+/** additional information on the freeze */
+static uint32_t trc_freezeArgument = 0u;
+
+/** progress of the snapshot export */
+static TRC_EXPORT_STATE_s trc_export = {.section = TRC_EXPORT_SECTION_DONE, .index = 0u};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/**
+ * @brief   Stores an event in the ring buffer, if the recorder is not frozen.
+ * @details The caller has to make sure that this function is not interrupted
+ *          by another call.
+ * @param   type        type of the event
+ * @param   object      task, interrupt or OS function the event belongs to
+ * @param   argument    event specific argument
+ */
+static void TRC_StoreEvent(TRC_EVENT_TYPE_e type, uint8_t object, uint16_t argument);
+
+/**
+ * @brief   Stores an event from task context.
+ * @param   type        type of the event
+ * @param   object      task, interrupt or OS function the event belongs to
+ * @param   argument    event specific argument
+ */
+static void TRC_StoreEventFromTask(TRC_EVENT_TYPE_e type, uint8_t object, uint16_t argument);
+
+/**
+ * @brief   Returns the index of a queue in the order of creation.
+ * @param   pQueue  queue handle as used by the kernel
+ * @return  index of the queue or #TRC_UNKNOWN_OBJECT
+ */
+static uint8_t TRC_GetQueueIndex(const void *pQueue);
+
+/**
+ * @brief   Returns the number of valid events in the ring buffer.
+ * @return  number of events
+ */
+static uint32_t TRC_GetNumberOfEvents(void);
+
+/**
+ * @brief   Advances the export to the next entry that has to be serialized.
+ * @return  size of the next entry in bytes, 0 if the snapshot is complete
+ */
+static uint32_t TRC_GetSizeOfNextEntry(void);
+
+/**
+ * @brief   Serializes the next entry of the snapshot and advances the export.
+ * @param   pBuffer destination of the serialized entry
+ */
+static void TRC_SerializeNextEntry(uint8_t *const pBuffer);
+
+/**
+ * @brief   Writes a 16-bit value in big-endian byte order.
+ * @param   pBuffer pointer to the destination
+ * @param   value   value to be written
+ */
+static void TRC_WriteUint16(uint8_t *const pBuffer, uint16_t value);
+
+/**
+ * @brief   Writes a 32-bit value in big-endian byte order.
+ * @param   pBuffer pointer to the destination
+ * @param   value   value to be written
+ */
+static void TRC_WriteUint32(uint8_t *const pBuffer, uint32_t value);
+
+/*========== Static Function Implementations ================================*/
+static void TRC_StoreEvent(TRC_EVENT_TYPE_e type, uint8_t object, uint16_t argument) {
+    FAS_ASSERT(type < TRC_EVENT_TYPE_E_MAX);
+    /* AXIVION Routine Generic-MissingParameterAssert: object: accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: argument: accepts whole range */
+
+    if (trc_freezeReason == TRC_FREEZE_REASON_NONE) {
+        TRC_EVENT_s *const pEvent = &trc_ringBuffer[trc_writeIndex & (TRC_RING_BUFFER_LENGTH - 1u)];
+
+        pEvent->timestamp = _pmuGetCycleCount_();
+        pEvent->type      = (uint8_t)type;
+        pEvent->object    = object;
+        pEvent->argument  = argument;
+        trc_writeIndex++;
+    }
+}
+
+static void TRC_StoreEventFromTask(TRC_EVENT_TYPE_e type, uint8_t object, uint16_t argument) {
+    FAS_ASSERT(type < TRC_EVENT_TYPE_E_MAX);
+    /* AXIVION Routine Generic-MissingParameterAssert: object: accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: argument: accepts whole range */
+
+    OS_EnterTaskCritical();
+    TRC_StoreEvent(type, object, argument);
+    OS_ExitTaskCritical();
+}
+
+static uint8_t TRC_GetQueueIndex(const void *pQueue) {
+    /* AXIVION Routine Generic-MissingParameterAssert: pQueue: unknown queues are reported as such */
+    uint8_t queueIndex = TRC_UNKNOWN_OBJECT;
+    for (uint32_t i = 0u; i < trc_numberOfQueues; i++) {
+        if (trc_queues[i] == pQueue) {
+            queueIndex = (uint8_t)i;
+            break;
+        }
+    }
+    return queueIndex;
+}
+
+static uint32_t TRC_GetNumberOfEvents(void) {
+    uint32_t numberOfEvents = trc_writeIndex;
+    if (numberOfEvents > TRC_RING_BUFFER_LENGTH) {
+        numberOfEvents = TRC_RING_BUFFER_LENGTH;
+    }
+    return numberOfEvents;
+}
+
+static uint32_t TRC_GetSizeOfNextEntry(void) {
+    uint32_t entrySize  = 0u;
+    bool entryAvailable = false;
+
+    while ((trc_export.section != TRC_EXPORT_SECTION_DONE) && (entryAvailable == false)) {
+        switch (trc_export.section) {
+            case TRC_EXPORT_SECTION_HEADER:
+                entryAvailable = (trc_export.index == 0u);
+                entrySize      = TRC_SERIALIZED_HEADER_SIZE_IN_BYTES;
+                break;
+            case TRC_EXPORT_SECTION_TASKS:
+                entryAvailable = (trc_export.index < trc_numberOfTasks);
+                entrySize      = TRC_SERIALIZED_TASK_SIZE_IN_BYTES;
+                break;
+            default:
+                /* TRC_EXPORT_SECTION_EVENTS */
+                entryAvailable = (trc_export.index < TRC_GetNumberOfEvents());
+                entrySize      = TRC_SERIALIZED_EVENT_SIZE_IN_BYTES;
+                break;
+        }
+        if (entryAvailable == false) {
+            trc_export.section = (TRC_EXPORT_SECTION_e)((uint8_t)trc_export.section + 1u);
+            trc_export.index   = 0u;
+            entrySize          = 0u;
+        }
+    }
+    return entrySize;
+}
+
+static void TRC_SerializeNextEntry(uint8_t *const pBuffer) {
+    FAS_ASSERT(pBuffer != NULL_PTR);
+
+    if (trc_export.section == TRC_EXPORT_SECTION_HEADER) {
+        TRC_WriteUint32(&pBuffer[0u], TRC_SNAPSHOT_MAGIC);
+        pBuffer[4u] = TRC_SNAPSHOT_FORMAT_VERSION;
+        pBuffer[5u] = (uint8_t)trc_freezeReason;
+        TRC_WriteUint16(&pBuffer[6u], (uint16_t)trc_numberOfTasks);
+        TRC_WriteUint32(&pBuffer[8u], TRC_GetNumberOfEvents());
+        TRC_WriteUint32(&pBuffer[12u], TRC_TIMESTAMP_FREQUENCY_Hz);
+        TRC_WriteUint32(&pBuffer[16u], trc_freezeArgument);
+    } else if (trc_export.section == TRC_EXPORT_SECTION_TASKS) {
+        const TRC_TASK_ENTRY_s *const pTask = &trc_tasks[trc_export.index];
+        pBuffer[0u]                         = pTask->number;
+        pBuffer[1u]                         = pTask->priority;
+        (void)memcpy((void *)&pBuffer[2u], (const void *)pTask->name, TRC_TASK_NAME_LENGTH);
+    } else {
+        /* TRC_EXPORT_SECTION_EVENTS: start with the oldest event */
+        const uint32_t eventIndex =
+            (trc_writeIndex - TRC_GetNumberOfEvents() + trc_export.index) & (TRC_RING_BUFFER_LENGTH - 1u);
+        const TRC_EVENT_s *const pEvent = &trc_ringBuffer[eventIndex];
+        TRC_WriteUint32(&pBuffer[0u], pEvent->timestamp);
+        pBuffer[4u] = pEvent->type;
+        pBuffer[5u] = pEvent->object;
+        TRC_WriteUint16(&pBuffer[6u], pEvent->argument);
+    }
+    trc_export.index++;
+}
+
+static void TRC_WriteUint16(uint8_t *const pBuffer, uint16_t value) {
+    FAS_ASSERT(pBuffer != NULL_PTR);
+    pBuffer[0u] = (uint8_t)(value >> 8u);
+    pBuffer[1u] = (uint8_t)(value & 0xFFu);
+}
+
+static void TRC_WriteUint32(uint8_t *const pBuffer, uint32_t value) {
+    FAS_ASSERT(pBuffer != NULL_PTR);
+    pBuffer[0u] = (uint8_t)(value >> 24u);
+    pBuffer[1u] = (uint8_t)((value >> 16u) & 0xFFu);
+    pBuffer[2u] = (uint8_t)((value >> 8u) & 0xFFu);
+    pBuffer[3u] = (uint8_t)(value & 0xFFu);
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void TRC_Initialize(void) {
+    _pmuInit_();
+    _pmuEnableCountersGlobal_();
+    _pmuResetCycleCounter_();
+    _pmuStartCounters_(pmuCYCLE_COUNTER);
+}
+
+extern void TRC_RecordIsrEnter(TRC_ISR_ID_e isrId) {
+    FAS_ASSERT(isrId < TRC_ISR_ID_E_MAX);
+    TRC_StoreEvent(TRC_EVENT_ISR_ENTER, (uint8_t)isrId, 0u);
+}
+
+extern void TRC_RecordIsrExit(TRC_ISR_ID_e isrId) {
+    FAS_ASSERT(isrId < TRC_ISR_ID_E_MAX);
+    TRC_StoreEvent(TRC_EVENT_ISR_EXIT, (uint8_t)isrId, 0u);
+}
+
+extern void TRC_RecordOsCall(TRC_OS_CALL_e osCall, uint16_t argument) {
+    FAS_ASSERT(osCall < TRC_OS_CALL_E_MAX);
+    /* AXIVION Routine Generic-MissingParameterAssert: argument: accepts whole range */
+    TRC_StoreEventFromTask(TRC_EVENT_OS_CALL, (uint8_t)osCall, argument);
+}
+
+extern void TRC_RecordOsCallFromIsr(TRC_OS_CALL_e osCall, uint16_t argument) {
+    FAS_ASSERT(osCall < TRC_OS_CALL_E_MAX);
+    /* AXIVION Routine Generic-MissingParameterAssert: argument: accepts whole range */
+    TRC_StoreEvent(TRC_EVENT_OS_CALL, (uint8_t)osCall, argument);
+}
+
+extern void TRC_Freeze(TRC_FREEZE_REASON_e reason, uint32_t argument) {
+    FAS_ASSERT((reason == TRC_FREEZE_REASON_REQUEST) || (reason == TRC_FREEZE_REASON_FATAL_ERROR));
+    /* AXIVION Routine Generic-MissingParameterAssert: argument: accepts whole range */
+
+    OS_EnterTaskCritical();
+    if (trc_freezeReason == TRC_FREEZE_REASON_NONE) {
+        /* the freeze itself is the last event of the snapshot */
+        TRC_StoreEvent(TRC_EVENT_FREEZE, (uint8_t)reason, (uint16_t)(argument & UINT16_MAX));
+        trc_freezeReason   = reason;
+        trc_freezeArgument = argument;
+        trc_export.section = TRC_EXPORT_SECTION_HEADER;
+        trc_export.index   = 0u;
+    } else if (reason == TRC_FREEZE_REASON_REQUEST) {
+        /* export the existing snapshot again */
+        trc_export.section = TRC_EXPORT_SECTION_HEADER;
+        trc_export.index   = 0u;
+    } else {
+        /* further fatal errors do not interrupt the export */
+    }
+    OS_ExitTaskCritical();
+}
+
+extern void TRC_Resume(void) {
+    OS_EnterTaskCritical();
+    trc_writeIndex     = 0u;
+    trc_freezeArgument = 0u;
+    trc_export.section = TRC_EXPORT_SECTION_DONE;
+    trc_export.index   = 0u;
+    trc_freezeReason   = TRC_FREEZE_REASON_NONE;
+    OS_ExitTaskCritical();
+}
+
+extern bool TRC_IsSnapshotPending(void) {
+    bool isPending = false;
+    if ((trc_freezeReason != TRC_FREEZE_REASON_NONE) && (trc_export.section != TRC_EXPORT_SECTION_DONE)) {
+        isPending = true;
+    }
+    return isPending;
+}
+
+extern uint32_t TRC_ReadSnapshot(uint8_t *const pBuffer, uint32_t bufferSize) {
+    FAS_ASSERT(pBuffer != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: bufferSize: accepts whole range */
+
+    uint32_t writtenBytes = 0u;
+    bool continueReading  = (trc_freezeReason != TRC_FREEZE_REASON_NONE);
+
+    while (continueReading == true) {
+        const uint32_t entrySize = TRC_GetSizeOfNextEntry();
+        if ((entrySize == 0u) || ((bufferSize - writtenBytes) < entrySize)) {
+            continueReading = false;
+        } else {
+            TRC_SerializeNextEntry(&pBuffer[writtenBytes]);
+            writtenBytes += entrySize;
+        }
+    }
+    return writtenBytes;
+}
+
+/* Hooks that are called by the kernel through the trace macros in
+ * FreeRTOSConfig.h; they are declared there, as the kernel does not know the
+ * include paths of the application. */
+extern void TRC_KernelTaskCreate(uint32_t taskNumber, const char *pTaskName, uint32_t priority) {
+    /* AXIVION Routine Generic-MissingParameterAssert: taskNumber: accepts whole range */
+    FAS_ASSERT(pTaskName != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: priority: accepts whole range */
+
+    OS_EnterTaskCritical();
+    if (trc_numberOfTasks < TRC_MAXIMUM_NUMBER_OF_TASKS) {
+        TRC_TASK_ENTRY_s *const pTask = &trc_tasks[trc_numberOfTasks];
+        pTask->number                 = (uint8_t)taskNumber;
+        pTask->priority               = (uint8_t)priority;
+        /* the remaining characters stay zero */
+        for (uint8_t i = 0u; i < TRC_TASK_NAME_LENGTH; i++) {
+            if (pTaskName[i] == '\0') {
+                break;
+            }
+            pTask->name[i] = pTaskName[i];
+        }
+        trc_numberOfTasks++;
+    }
+    OS_ExitTaskCritical();
+}
+
+extern void TRC_KernelTaskSwitchedIn(uint32_t taskNumber) {
+    /* AXIVION Routine Generic-MissingParameterAssert: taskNumber: accepts whole range */
+    /* called by the scheduler with interrupts disabled */
+    trc_currentTask = (uint8_t)taskNumber;
+    TRC_StoreEvent(TRC_EVENT_TASK_SWITCHED_IN, trc_currentTask, 0u);
+}
+
+extern void TRC_KernelTaskDelayUntil(uint32_t timeToWake) {
+    /* AXIVION Routine Generic-MissingParameterAssert: timeToWake: accepts whole range */
+    TRC_StoreEventFromTask(TRC_EVENT_TASK_DELAY_UNTIL, trc_currentTask, (uint16_t)(timeToWake & UINT16_MAX));
+}
+
+extern void TRC_KernelQueueCreate(const void *pQueue) {
+    FAS_ASSERT(pQueue != NULL_PTR);
+
+    OS_EnterTaskCritical();
+    if (trc_numberOfQueues < TRC_MAXIMUM_NUMBER_OF_QUEUES) {
+        trc_queues[trc_numberOfQueues] = pQueue;
+        trc_numberOfQueues++;
+    }
+    OS_ExitTaskCritical();
+}
+
+extern void TRC_KernelBlockingOnQueueReceive(const void *pQueue) {
+    /* AXIVION Routine Generic-MissingParameterAssert: pQueue: unknown queues are reported as such */
+    TRC_StoreEventFromTask(TRC_EVENT_QUEUE_BLOCK_RECEIVE, trc_currentTask, TRC_GetQueueIndex(pQueue));
+}
+
+extern void TRC_KernelBlockingOnQueueSend(const void *pQueue) {
+    /* AXIVION Routine Generic-MissingParameterAssert: pQueue: unknown queues are reported as such */
+    TRC_StoreEventFromTask(TRC_EVENT_QUEUE_BLOCK_SEND, trc_currentTask, TRC_GetQueueIndex(pQueue));
+}
+
+extern void TRC_KernelTaskNotifyBlock(uint32_t index) {
+    /* AXIVION Routine Generic-MissingParameterAssert: index: accepts whole range */
+    TRC_StoreEventFromTask(TRC_EVENT_NOTIFY_BLOCK, trc_currentTask, (uint16_t)(index & UINT16_MAX));
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_TRC_Reset(void) {
+    (void)memset((void *)trc_ringBuffer, 0, sizeof(trc_ringBuffer));
+    (void)memset((void *)trc_tasks, 0, sizeof(trc_tasks));
+    (void)memset((void *)trc_queues, 0, sizeof(trc_queues));
+    trc_writeIndex     = 0u;
+    trc_currentTask    = 0u;
+    trc_numberOfTasks  = 0u;
+    trc_numberOfQueues = 0u;
+    trc_freezeReason   = TRC_FREEZE_REASON_NONE;
+    trc_freezeArgument = 0u;
+    trc_export.section = TRC_EXPORT_SECTION_DONE;
+    trc_export.index   = 0u;
+}
+
+extern void TEST_TRC_StoreEvent(TRC_EVENT_TYPE_e type, uint8_t object, uint16_t argument) {
+    TRC_StoreEvent(type, object, argument);
+}
+
+extern uint8_t TEST_TRC_GetQueueIndex(const void *pQueue) {
+    return TRC_GetQueueIndex(pQueue);
+}
+#endif
@@ -0,0 +1,213 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    trace.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup ENGINE
+ * @prefix  TRC
+ *
+ * @brief   RAM ring buffer trace recorder for kernel and OS events
+ * @details The FreeRTOS trace macros (see FreeRTOSConfig.h), the OS wrapper
+ *          and selected interrupt service routines add fixed-size binary
+ *          events with a CPU cycle counter timestamp to a ring buffer. The
+ *          ring buffer is overwritten continuously until the recorder is
+ *          frozen, either on request or when the first fatal error is
+ *          detected by the diag module. The frozen snapshot is serialized with
+ *          #TRC_ReadSnapshot() and decoded by the host tooling
+ *          ('fox etl decode-trace').
+ */
+
+#ifndef FOXBMS__TRACE_H_
+#define FOXBMS__TRACE_H_
+
+/*========== Includes =======================================================*/
+#include "trace_cfg.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** first four bytes of a serialized snapshot ('FTRC') */
+#define TRC_SNAPSHOT_MAGIC (0x46545243u)
+
+/** version of the serialization format, incremented on incompatible changes */
+#define TRC_SNAPSHOT_FORMAT_VERSION (1u)
+
+/** size of the serialized snapshot header in bytes */
+#define TRC_SERIALIZED_HEADER_SIZE_IN_BYTES (20u)
+
+/** size of a serialized task table entry in bytes */
+#define TRC_SERIALIZED_TASK_SIZE_IN_BYTES (2u + TRC_TASK_NAME_LENGTH)
+
+/** size of a serialized event in bytes */
+#define TRC_SERIALIZED_EVENT_SIZE_IN_BYTES (8u)
+
+/** object identifier of a queue that is not known to the recorder */
+#define TRC_UNKNOWN_OBJECT (0xFFu)
+
+/**
+ * @brief   types of the recorded events
+ * @details The values are part of the serialization format and are decoded by
+ *          the host tooling; new types have to be added at the end.
+ */
+typedef enum {
+    TRC_EVENT_TASK_SWITCHED_IN,    /*!< object: task, argument: - */
+    TRC_EVENT_TASK_DELAY_UNTIL,    /*!< object: task, argument: tick to wake up (lower 16 bit) */
+    TRC_EVENT_QUEUE_BLOCK_RECEIVE, /*!< object: task, argument: queue */
+    TRC_EVENT_QUEUE_BLOCK_SEND,    /*!< object: task, argument: queue */
+    TRC_EVENT_NOTIFY_BLOCK,        /*!< object: task, argument: notification index */
+    TRC_EVENT_ISR_ENTER,           /*!< object: #TRC_ISR_ID_e, argument: - */
+    TRC_EVENT_ISR_EXIT,            /*!< object: #TRC_ISR_ID_e, argument: - */
+    TRC_EVENT_OS_CALL,             /*!< object: #TRC_OS_CALL_e, argument: result of the call */
+    TRC_EVENT_FREEZE,              /*!< object: #TRC_FREEZE_REASON_e, argument: lower 16 bit of the reason argument */
+    TRC_EVENT_TYPE_E_MAX,          /*!< number of event types */
+} TRC_EVENT_TYPE_e;
+
+/** OS wrapper functions that are recorded as #TRC_EVENT_OS_CALL */
+typedef enum {
+    TRC_OS_CALL_NOTIFY_FROM_ISR,                /*!< #OS_NotifyFromIsr */
+    TRC_OS_CALL_NOTIFY_INDEXED_FROM_ISR,        /*!< #OS_NotifyIndexedFromIsr */
+    TRC_OS_CALL_NOTIFY_GIVE,                    /*!< #OS_NotifyGive */
+    TRC_OS_CALL_NOTIFY_GIVE_FROM_ISR,           /*!< #OS_NotifyGiveFromIsr */
+    TRC_OS_CALL_SEND_TO_BACK_OF_QUEUE_FROM_ISR, /*!< #OS_SendToBackOfQueueFromIsr */
+    TRC_OS_CALL_SEMAPHORE_GIVE,                 /*!< #OS_SemaphoreGive */
+    TRC_OS_CALL_SEMAPHORE_GIVE_FROM_ISR,        /*!< #OS_SemaphoreGiveFromIsr */
+    TRC_OS_CALL_E_MAX,                          /*!< number of recorded OS wrapper functions */
+} TRC_OS_CALL_e;
+
+/** reason why the recorder has been frozen */
+typedef enum {
+    TRC_FREEZE_REASON_NONE,        /*!< recorder is running */
+    TRC_FREEZE_REASON_REQUEST,     /*!< snapshot has been requested (e.g., via CAN) */
+    TRC_FREEZE_REASON_FATAL_ERROR, /*!< fatal error, argument: diagnosis identifier */
+    TRC_FREEZE_REASON_E_MAX,       /*!< number of freeze reasons */
+} TRC_FREEZE_REASON_e;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/**
+ * @brief   Starts the CPU cycle counter that is used as event timestamp.
+ * @details Has to be called before the operating system objects are created,
+ *          as the task table is filled while the tasks are created.
+ */
+extern void TRC_Initialize(void);
+
+/**
+ * @brief   Records the entry into an interrupt service routine.
+ * @details Shall only be called from interrupt context (interrupts are not
+ *          nested on this target, therefore no locking is done).
+ * @param   isrId   identifier of the interrupt service routine
+ */
+extern void TRC_RecordIsrEnter(TRC_ISR_ID_e isrId);
+
+/**
+ * @brief   Records the exit of an interrupt service routine.
+ * @details Shall only be called from interrupt context.
+ * @param   isrId   identifier of the interrupt service routine
+ */
+extern void TRC_RecordIsrExit(TRC_ISR_ID_e isrId);
+
+/**
+ * @brief   Records a call of an OS wrapper function from task context.
+ * @param   osCall      identifier of the OS wrapper function
+ * @param   argument    result of the call
+ */
+extern void TRC_RecordOsCall(TRC_OS_CALL_e osCall, uint16_t argument);
+
+/**
+ * @brief   Records a call of an OS wrapper function from interrupt context.
+ * @param   osCall      identifier of the OS wrapper function
+ * @param   argument    result of the call
+ */
+extern void TRC_RecordOsCallFromIsr(TRC_OS_CALL_e osCall, uint16_t argument);
+
+/**
+ * @brief   Stops recording and provides the current content of the ring
+ *          buffer as snapshot.
+ * @details If the recorder is already frozen, the reason of the first freeze
+ *          is kept. A further request restarts the export of the snapshot,
+ *          which allows to read a snapshot that has been taken on a fatal
+ *          error again; further fatal errors are ignored.
+ * @param   reason      reason for the freeze
+ * @param   argument    additional information, e.g., the diagnosis identifier
+ */
+extern void TRC_Freeze(TRC_FREEZE_REASON_e reason, uint32_t argument);
+
+/**
+ * @brief   Discards the snapshot and restarts recording.
+ */
+extern void TRC_Resume(void);
+
+/**
+ * @brief   Returns whether a snapshot waits to be exported.
+ * @return  true if the recorder is frozen and the snapshot has not been
+ *          completely read, false otherwise
+ */
+extern bool TRC_IsSnapshotPending(void);
+
+/**
+ * @brief   Serializes the next part of the snapshot into a buffer.
+ * @details Header, task table and events are written in this order, each in
+ *          big-endian byte order and only as complete entries. The events are
+ *          written from the oldest to the newest one. This function shall
+ *          only be called from one context.
+ * @param   pBuffer     buffer into which the snapshot is serialized
+ * @param   bufferSize  size of the buffer in bytes
+ * @return  number of bytes written into the buffer
+ */
+extern uint32_t TRC_ReadSnapshot(uint8_t *const pBuffer, uint32_t bufferSize);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_TRC_Reset(void);
+extern void TEST_TRC_StoreEvent(TRC_EVENT_TYPE_e type, uint8_t object, uint16_t argument);
+extern uint8_t TEST_TRC_GetQueueIndex(const void *pQueue);
+#endif
+
+#endif /* FOXBMS__TRACE_H_ */
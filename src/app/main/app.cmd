@@ -189,6 +189,8 @@ SECTIONS
     .kernelBSS                    : {} > KERNEL_DATA
     .bss                          : {} > RAM
     .data                         : {} > RAM
+    /* database entries (see database_cfg.c) */
+    .databaseRAM        align(32) : {} > RAM
     .sysmem                       : {} > RAM
     .sharedRAM                    : {} > SHARED_RAM
 }
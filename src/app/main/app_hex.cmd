@@ -1,4 +1,4 @@
-/* 19b1c8599be7937c5704987c3a5ee556 */
+/* ecf59688b80ae0354573b1c6ee66b9a1 */
 
 /* Aligned with names in "MEMORY" in the elf-linker script */
 ROMS
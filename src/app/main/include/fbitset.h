@@ -0,0 +1,199 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    fbitset.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup MAIN
+ * @prefix  BITSET
+ *
+ * @brief   Packed bitset type and word-wise helper functions
+ * @details Flags like the validity of cell voltages are stored as one bit per
+ *          element in words of type #BITSET_WORD_t instead of one bool per
+ *          element. Bit n of a word represents element n, the elements of
+ *          word i start at i * #BITSET_BITS_PER_WORD.
+ *          The helpers evaluate a complete word at once, i.e., 32 elements
+ *          per operation.
+ */
+
+#ifndef FOXBMS__FBITSET_H_
+#define FOXBMS__FBITSET_H_
+
+/*========== Includes =======================================================*/
+#include "fassert.h"
+#include "fstd_types.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** one word of a bitset */
+typedef uint32_t BITSET_WORD_t;
+
+/** number of bits in one word of a bitset */
+#define BITSET_BITS_PER_WORD (32u)
+
+/** return value of #BITSET_GetFirstSetBit() if no bit is set */
+#define BITSET_NO_BIT_SET (UINT16_MAX)
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Returns a word with the lowest bits set
+ * @param   nrOfBits    number of bits to be set (0 to #BITSET_BITS_PER_WORD)
+ * @return  word with the bits 0 to nrOfBits - 1 set
+ */
+static inline BITSET_WORD_t BITSET_GetMask(uint8_t nrOfBits) {
+    FAS_ASSERT(nrOfBits <= BITSET_BITS_PER_WORD);
+    BITSET_WORD_t mask = UINT32_MAX;
+    if (nrOfBits < BITSET_BITS_PER_WORD) {
+        mask = ((BITSET_WORD_t)1u << nrOfBits) - 1u;
+    }
+    return mask;
+}
+
+/**
+ * @brief   Checks if a bit of a word is set
+ * @param   word    word of the bitset
+ * @param   bit     bit to be checked
+ * @return  true if the bit is set, false otherwise
+ */
+static inline bool BITSET_IsBitSet(BITSET_WORD_t word, uint8_t bit) {
+    /* AXIVION Routine Generic-MissingParameterAssert: word: parameter accepts whole range */
+    FAS_ASSERT(bit < BITSET_BITS_PER_WORD);
+    return ((word & ((BITSET_WORD_t)1u << bit)) != 0u);
+}
+
+/**
+ * @brief   Sets or clears a bit of a word
+ * @param   pWord   word of the bitset
+ * @param   bit     bit to be written
+ * @param   value   true: set the bit, false: clear the bit
+ */
+static inline void BITSET_WriteBit(BITSET_WORD_t *pWord, uint8_t bit, bool value) {
+    FAS_ASSERT(pWord != NULL_PTR);
+    FAS_ASSERT(bit < BITSET_BITS_PER_WORD);
+    /* AXIVION Routine Generic-MissingParameterAssert: value: parameter accepts whole range */
+    if (value == true) {
+        *pWord |= ((BITSET_WORD_t)1u << bit);
+    } else {
+        *pWord &= ~((BITSET_WORD_t)1u << bit);
+    }
+}
+
+/**
+ * @brief   Counts the set bits of a word
+ * @details Parallel bit count, the number of set bits is summed up in
+ *          2-bit, 4-bit and 8-bit fields without a loop over the bits.
+ * @param   word    word of the bitset
+ * @return  number of set bits
+ */
+static inline uint8_t BITSET_CountSetBitsOfWord(BITSET_WORD_t word) {
+    /* AXIVION Routine Generic-MissingParameterAssert: word: parameter accepts whole range */
+    BITSET_WORD_t count = word - ((word >> 1u) & 0x55555555u);
+    count               = (count & 0x33333333u) + ((count >> 2u) & 0x33333333u);
+    count               = (count + (count >> 4u)) & 0x0F0F0F0Fu;
+    return (uint8_t)((count * 0x01010101u) >> 24u);
+}
+
+/**
+ * @brief   Counts the set bits of a bitset
+ * @param   pkWords     words of the bitset
+ * @param   nrOfWords   number of words of the bitset
+ * @return  number of set bits
+ */
+static inline uint16_t BITSET_CountSetBits(const BITSET_WORD_t *pkWords, uint16_t nrOfWords) {
+    FAS_ASSERT(pkWords != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: nrOfWords: parameter accepts whole range */
+    uint16_t count = 0u;
+    for (uint16_t i = 0u; i < nrOfWords; i++) {
+        count += BITSET_CountSetBitsOfWord(pkWords[i]);
+    }
+    return count;
+}
+
+/**
+ * @brief   Checks if any bit of a bitset is set
+ * @param   pkWords     words of the bitset
+ * @param   nrOfWords   number of words of the bitset
+ * @return  true if at least one bit is set, false otherwise
+ */
+static inline bool BITSET_IsAnyBitSet(const BITSET_WORD_t *pkWords, uint16_t nrOfWords) {
+    FAS_ASSERT(pkWords != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: nrOfWords: parameter accepts whole range */
+    BITSET_WORD_t combined = 0u;
+    for (uint16_t i = 0u; i < nrOfWords; i++) {
+        combined |= pkWords[i];
+    }
+    return (combined != 0u);
+}
+
+/**
+ * @brief   Returns the position of the lowest set bit of a bitset
+ * @param   pkWords     words of the bitset
+ * @param   nrOfWords   number of words of the bitset
+ * @return  position of the first set bit, #BITSET_NO_BIT_SET if no bit is set
+ */
+static inline uint16_t BITSET_GetFirstSetBit(const BITSET_WORD_t *pkWords, uint16_t nrOfWords) {
+    FAS_ASSERT(pkWords != NULL_PTR);
+    FAS_ASSERT(nrOfWords < (BITSET_NO_BIT_SET / BITSET_BITS_PER_WORD));
+    uint16_t position = BITSET_NO_BIT_SET;
+    for (uint16_t i = 0u; (i < nrOfWords) && (position == BITSET_NO_BIT_SET); i++) {
+        const BITSET_WORD_t word = pkWords[i];
+        if (word != 0u) {
+            /* the number of trailing zeros is the number of set bits below the lowest set bit */
+            const BITSET_WORD_t lowestBit = word & (~word + 1u);
+            position                      = (uint16_t)((i * BITSET_BITS_PER_WORD) +
+                                   BITSET_CountSetBitsOfWord(lowestBit - 1u));
+        }
+    }
+    return position;
+}
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+#endif
+
+#endif /* FOXBMS__FBITSET_H_ */
@@ -43,7 +43,7 @@
  * @file    main.c
  * @author  foxBMS Team
  * @date    2019-08-27 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup MAIN
  * @prefix  TODO
@@ -78,6 +78,7 @@
 #include "os.h"
 #include "pwm.h"
 #include "spi.h"
+#include "trace.h"
 #if (defined(FOXBMS_UART_SUPPORT) && (FOXBMS_UART_SUPPORT == 1))
 #include "uart.h"
 #endif
@@ -101,6 +102,7 @@ int unit_test_main(void)
 #endif
 {
     MINFO_SetResetSource(getResetSource()); /* Get reset source and clear respective flags */
+    TRC_Initialize();
     muxInit();
     gioInit();
     SPI_Initialize();
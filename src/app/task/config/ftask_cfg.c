@@ -43,7 +43,7 @@
  * @file    ftask_cfg.c
  * @author  foxBMS Team
  * @date    2019-08-26 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup TASK_CONFIGURATION
  * @prefix  FTSK
@@ -66,6 +66,7 @@
 #include "adc.h"
 #include "algorithm.h"
 #include "bal.h"
+#include "bg_jobs.h"
 #include "bms.h"
 #include "can.h"
 #include "contactor.h"
@@ -78,13 +79,14 @@
 #include "imd.h"
 #include "interlock.h"
 #include "led.h"
+#include "log.h"
 #include "master_info.h"
 #include "meas.h"
 #include "pex.h"
 #include "redundancy.h"
 #include "rtc.h"
 #include "sbc.h"
-#include "sof_trapezoid.h"
+#include "sof.h"
 #include "spi.h"
 #include "sps.h"
 #include "state_estimation.h"
@@ -93,15 +95,13 @@
 #if defined(FOXBMS_UART_SUPPORT) && FOXBMS_UART_SUPPORT == 1
 #include "os.h"
 #include "uart.h"
+#include "uart_cfg.h"
 #endif
 
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
 
-/** counter value for 50ms in 10ms task */
-#define TASK_10MS_COUNTER_FOR_50MS (5u)
-
 /** counter value for 1s in 100ms task */
 #define TASK_100MS_COUNTER_FOR_1S (10u)
 
@@ -215,6 +215,9 @@ extern void FTSK_RunUserCodeEngine(void) {
 }
 
 extern void FTSK_InitializeUserCodePreCyclicTasks(void) {
+    /* first record of the log after start-up */
+    (void)LOG_Write(LOG_MESSAGE_ID_LOG_STARTED, LOG_RING_BUFFER_LENGTH, 0u, 0u, 0u);
+
     /*  Init Sys */
     SYS_RETURN_TYPE_e sys_retVal = SYS_SetStateRequest(SYS_STATE_INITIALIZATION_REQUEST);
 
@@ -256,9 +259,7 @@ extern void FTSK_RunUserCodeCyclic1ms(void) {
 }
 
 extern void FTSK_RunUserCodeCyclic10ms(void) {
-    static uint8_t ftsk_cyclic10msCounter = 0;
     /* user code */
-    SYSM_UpdateFramData();
     SYS_Trigger(&sys_state);
     ILCK_Trigger();
     ADC_Control();
@@ -267,30 +268,29 @@ extern void FTSK_RunUserCodeCyclic10ms(void) {
     SOF_Calculation();
     ALGO_MonitorExecutionTime();
     SBC_Trigger(&sbc_stateMcuSupervisor);
-
-    if (ftsk_cyclic10msCounter == TASK_10MS_COUNTER_FOR_50MS) {
-        MRC_ValidateAfeMeasurement();
-        MRC_ValidatePackMeasurement();
-        ftsk_cyclic10msCounter = 0;
-    }
+    /* validates new AFE and current sensor measurements as soon as they are
+       written to the database */
+    MRC_Trigger();
     /* Call BMS_Trigger function at the end of the 10ms task to allow previously
      * called modules in this task to update respectively evaluate their new.
      * This minimizes the delay between data evaluation and the reaction from
      * the BMS module */
     BMS_Trigger();
-    ftsk_cyclic10msCounter++;
 }
 
 extern void FTSK_RunUserCodeCyclic100ms(void) {
     /* user code */
     static uint8_t ftsk_cyclic100msCounter = 0;
 
-    /** Perform SOC and SOE calculations only every 1s. Not suited if analog
-     *  integration of current sensor is NOT used. Manual integration of current
-     *  requires a higher frequency.
+    /** Perform SOC and SOE calculations only every 1s. If the coulomb and
+     *  energy counting of the current sensor is NOT used, the charge and
+     *  energy are integrated at the rate of the current sensor by the current
+     *  integration module, therefore the accuracy does not depend on this
+     *  period.
      */
     if (ftsk_cyclic100msCounter == TASK_100MS_COUNTER_FOR_1S) {
         SE_RunStateEstimations();
+        BGJ_Request(BGJ_JOB_ID_STACK_USAGE);
         ftsk_cyclic100msCounter = 0;
     }
 
@@ -298,6 +298,8 @@ extern void FTSK_RunUserCodeCyclic100ms(void) {
     IMD_Trigger();
     LED_Trigger();
     MINFO_CheckSupplyVoltageClamp30c();
+    /* run the background jobs that did not find enough idle time */
+    BGJ_RunOverdueJobs();
 
     ftsk_cyclic100msCounter++;
 }
@@ -332,8 +334,15 @@ void FTSK_RunUserCodeUart(void) {
     /* user code */
 
     UART_HandleFlowControl();
+    /* hold back the log records while a kernel trace snapshot is exported,
+     * so that the host receives the snapshot as one contiguous stream */
+    if (UART_TransmitTraceSnapshot() == false) {
+        UART_TransmitLogRecords();
+    }
 
-    (void)OS_NotifyTake(pdTRUE, portMAX_DELAY);
+    /* Wake up on notifications from UART reception, but at least every
+     * UART_LOG_TRANSMIT_PERIOD_ms to transmit pending log records */
+    (void)OS_NotifyTake(pdTRUE, UART_LOG_TRANSMIT_PERIOD_ms);
 }
 #endif
 
@@ -344,7 +353,9 @@ void FTSK_RunUserCodeEmac(void) {
 }
 #endif
 
-extern void FTSK_RunUserCodeIdle(void) { /* user code */
+extern void FTSK_RunUserCodeIdle(void) {
+    /* user code */
+    BGJ_RunPendingJobs();
 }
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
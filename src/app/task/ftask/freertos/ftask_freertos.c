@@ -43,7 +43,7 @@
  * @file    ftask_freertos.c
  * @author  foxBMS Team
  * @date    2019-08-27 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup TASK
  * @prefix  FTSK
@@ -65,6 +65,7 @@
 #include "afe.h"
 #include "database.h"
 #include "ftask.h"
+#include "sys_mon_stack.h"
 
 #include <stdint.h>
 
@@ -356,6 +357,7 @@ extern void FTSK_CreateTasks(void) {
         ftsk_stackEngine,
         &ftsk_taskEngine);
     FAS_ASSERT(ftsk_taskHandleEngine != NULL); /* Trap if initialization failed */
+    SYSM_RegisterTaskStack(SYSM_STACK_TASK_ENGINE, ftsk_taskHandleEngine, ftsk_taskDefinitionEngine.stackSize_B);
 
     /* Cyclic Task 1ms */
     static StaticTask_t ftsk_taskCyclic1ms                                           = {0};
@@ -370,6 +372,8 @@ extern void FTSK_CreateTasks(void) {
         ftsk_stackCyclic1ms,
         &ftsk_taskCyclic1ms);
     FAS_ASSERT(ftsk_taskHandleCyclic1ms != NULL); /* Trap if initialization failed */
+    SYSM_RegisterTaskStack(
+        SYSM_STACK_TASK_CYCLIC_1MS, ftsk_taskHandleCyclic1ms, ftsk_taskDefinitionCyclic1ms.stackSize_B);
 
     /* Cyclic Task 10ms */
     static StaticTask_t ftsk_taskCyclic10ms                                            = {0};
@@ -384,6 +388,8 @@ extern void FTSK_CreateTasks(void) {
         ftsk_stackCyclic10ms,
         &ftsk_taskCyclic10ms);
     FAS_ASSERT(ftsk_taskHandleCyclic10ms != NULL); /* Trap if initialization failed */
+    SYSM_RegisterTaskStack(
+        SYSM_STACK_TASK_CYCLIC_10MS, ftsk_taskHandleCyclic10ms, ftsk_taskDefinitionCyclic10ms.stackSize_B);
 
     /* Cyclic Task 100ms */
     static StaticTask_t ftsk_taskCyclic100ms                                             = {0};
@@ -398,6 +404,8 @@ extern void FTSK_CreateTasks(void) {
         ftsk_stackCyclic100ms,
         &ftsk_taskCyclic100ms);
     FAS_ASSERT(ftsk_taskHandleCyclic100ms != NULL); /* Trap if initialization failed */
+    SYSM_RegisterTaskStack(
+        SYSM_STACK_TASK_CYCLIC_100MS, ftsk_taskHandleCyclic100ms, ftsk_taskDefinitionCyclic100ms.stackSize_B);
 
     /* Cyclic Task 100ms for algorithms */
     static StaticTask_t ftsk_taskCyclicAlgorithm100ms                                                       = {0};
@@ -412,6 +420,10 @@ extern void FTSK_CreateTasks(void) {
         ftsk_stackCyclicAlgorithm100ms,
         &ftsk_taskCyclicAlgorithm100ms);
     FAS_ASSERT(ftsk_taskHandleCyclicAlgorithm100ms != NULL); /* Trap if initialization failed */
+    SYSM_RegisterTaskStack(
+        SYSM_STACK_TASK_CYCLIC_ALGORITHM_100MS,
+        ftsk_taskHandleCyclicAlgorithm100ms,
+        ftsk_taskDefinitionCyclicAlgorithm100ms.stackSize_B);
 
     /* Continuously running Task for I2C */
     static StaticTask_t ftsk_taskI2c                                        = {0};
@@ -426,6 +438,7 @@ extern void FTSK_CreateTasks(void) {
         ftsk_stackSizeI2c,
         &ftsk_taskI2c);
     FAS_ASSERT(ftsk_taskHandleI2c != NULL); /* Trap if initialization failed */
+    SYSM_RegisterTaskStack(SYSM_STACK_TASK_I2C, ftsk_taskHandleI2c, ftsk_taskDefinitionI2c.stackSize_B);
 
 #if (FOXBMS_AFE_DRIVER_TYPE_NO_FSM == 1)
     /* This task is required in the BMS application and therefore declared by
@@ -445,6 +458,7 @@ extern void FTSK_CreateTasks(void) {
         ftsk_stackSizeAfe,
         &ftsk_taskAfe);
     FAS_ASSERT(ftsk_taskHandleAfe != NULL); /* Trap if initialization failed */
+    SYSM_RegisterTaskStack(SYSM_STACK_TASK_AFE, ftsk_taskHandleAfe, ftsk_taskDefinitionAfe.stackSize_B);
 #endif
 
 #if defined(FOXBMS_UART_SUPPORT) && FOXBMS_UART_SUPPORT == 1
@@ -460,6 +474,7 @@ extern void FTSK_CreateTasks(void) {
         ftsk_stackSizeUart,
         &ftsk_taskUart);
     FAS_ASSERT(ftsk_taskHandleUart != NULL); /* Trap if initialization failed */
+    SYSM_RegisterTaskStack(SYSM_STACK_TASK_UART, ftsk_taskHandleUart, ftsk_taskDefinitionUart.stackSize_B);
 #endif
 
 #if (defined(FOXBMS_TCP_SUPPORT) && (FOXBMS_TCP_SUPPORT == 1))
@@ -477,6 +492,7 @@ extern void FTSK_CreateTasks(void) {
         &ftsk_taskEmac);
 
     FAS_ASSERT(ftsk_taskHandleEmac != NULL); /* Trap if initialization failed */
+    SYSM_RegisterTaskStack(SYSM_STACK_TASK_EMAC, ftsk_taskHandleEmac, ftsk_taskDefinitionEmac.stackSize_B);
 #endif
 }
 
@@ -43,7 +43,7 @@
  * @file    os_freertos.c
  * @author  foxBMS Team
  * @date    2021-11-18 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup OS
  * @prefix  OS
@@ -60,6 +60,7 @@
 
 #include "can_cbs_tx_f_crash-dump.h"
 #include "ftask.h"
+#include "trace.h"
 
 #include <stdint.h>
 
@@ -211,6 +212,7 @@ extern OS_STD_RETURN_e OS_NotifyFromIsr(TaskHandle_t taskToNotify, uint32_t noti
     if (xNotification == pdTRUE) {
         notification = OS_SUCCESS;
     }
+    TRC_RecordOsCallFromIsr(TRC_OS_CALL_NOTIFY_FROM_ISR, (uint16_t)notification);
     /* Make the scheduler yield when notification made, so that unblocked tasks is run immediately
     (if priorities allow it, instead of waiting for the next OS tick) */
     portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
@@ -252,6 +254,7 @@ extern OS_STD_RETURN_e OS_NotifyIndexedFromIsr(
     if (xNotification == pdTRUE) {
         notification = OS_SUCCESS;
     }
+    TRC_RecordOsCallFromIsr(TRC_OS_CALL_NOTIFY_INDEXED_FROM_ISR, (uint16_t)notification);
     /* Make the scheduler yield when notification made, so that unblocked tasks is run immediately
     (if priorities allow it, instead of waiting for the next OS tick) */
     portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
@@ -260,7 +263,9 @@ extern OS_STD_RETURN_e OS_NotifyIndexedFromIsr(
 
 extern uint32_t OS_NotifyGive(TaskHandle_t taskToNotify) {
     FAS_ASSERT(taskToNotify != NULL_PTR);
-    return xTaskNotifyGive(taskToNotify);
+    const uint32_t notificationResult = xTaskNotifyGive(taskToNotify);
+    TRC_RecordOsCall(TRC_OS_CALL_NOTIFY_GIVE, (uint16_t)notificationResult);
+    return notificationResult;
 }
 
 extern void OS_NotifyGiveFromIsr(TaskHandle_t taskToNotify, BaseType_t *pHigherPriorityTaskWoken) {
@@ -268,6 +273,7 @@ extern void OS_NotifyGiveFromIsr(TaskHandle_t taskToNotify, BaseType_t *pHigherP
     /* AXIVION Routine Generic-MissingParameterAssert: *pHigherPriorityTaskWoken: parameter accepts whole range */
     /* Just pass the parameters */
     vTaskNotifyGiveFromISR(taskToNotify, pHigherPriorityTaskWoken);
+    TRC_RecordOsCallFromIsr(TRC_OS_CALL_NOTIFY_GIVE_FROM_ISR, 0u);
 }
 
 extern uint32_t OS_NotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait) {
@@ -328,6 +334,7 @@ extern OS_STD_RETURN_e OS_SendToBackOfQueueFromIsr(
     if (xQueueSendSuccess == pdTRUE) {
         queueSendSuccessfully = OS_SUCCESS;
     }
+    TRC_RecordOsCallFromIsr(TRC_OS_CALL_SEND_TO_BACK_OF_QUEUE_FROM_ISR, (uint16_t)queueSendSuccessfully);
     return queueSendSuccessfully;
 }
 
@@ -341,6 +348,12 @@ extern void OS_ResumeTask(TaskHandle_t taskToResume) {
     vTaskResume(taskToResume);
 }
 
+extern uint32_t OS_GetStackHighWaterMark_B(TaskHandle_t task) {
+    FAS_ASSERT(task != NULL_PTR);
+    const UBaseType_t unusedStack_words = uxTaskGetStackHighWaterMark(task);
+    return (uint32_t)unusedStack_words * (uint32_t)sizeof(StackType_t);
+}
+
 extern uint32_t OS_GetNumberOfStoredMessagesInQueue(OS_QUEUE xQueue) {
     long numberOfMessages = uxQueueMessagesWaiting(xQueue);
     return (uint32_t)numberOfMessages;
@@ -348,7 +361,8 @@ extern uint32_t OS_GetNumberOfStoredMessagesInQueue(OS_QUEUE xQueue) {
 
 extern void OS_SemaphoreGive(OS_SEMAPHORE_HANDLE xSemaphore) {
     FAS_ASSERT(xSemaphore != NULL_PTR);
-    (void)xSemaphoreGive(xSemaphore);
+    const BaseType_t xSemaphoreGiveSuccess = xSemaphoreGive(xSemaphore);
+    TRC_RecordOsCall(TRC_OS_CALL_SEMAPHORE_GIVE, (uint16_t)xSemaphoreGiveSuccess);
 }
 
 extern void OS_SemaphoreGiveFromIsr(OS_SEMAPHORE_HANDLE xSemaphore, BaseType_t *const pxHigherPriorityTaskWoken) {
@@ -356,7 +370,8 @@ extern void OS_SemaphoreGiveFromIsr(OS_SEMAPHORE_HANDLE xSemaphore, BaseType_t *
     /* AXIVION Routine Generic-MissingParameterAssert:
      * pxHigherPriorityTaskWoken: pxHigherPriorityTaskWoken is an optional
      * parameter and can therefore be NULL or any valid address */
-    (void)xSemaphoreGiveFromISR(xSemaphore, pxHigherPriorityTaskWoken);
+    const BaseType_t xSemaphoreGiveSuccess = xSemaphoreGiveFromISR(xSemaphore, pxHigherPriorityTaskWoken);
+    TRC_RecordOsCallFromIsr(TRC_OS_CALL_SEMAPHORE_GIVE_FROM_ISR, (uint16_t)xSemaphoreGiveSuccess);
 }
 
 extern OS_STD_RETURN_e OS_SemaphoreTake(OS_SEMAPHORE_HANDLE xSemaphore, TickType_t ticksToWait) {
@@ -43,7 +43,7 @@
  * @file    os.h
  * @author  foxBMS Team
  * @date    2019-08-27 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup OS
  * @prefix  OS
@@ -71,8 +71,9 @@
 #define OS_TASK_HANDLE          TaskHandle_t
 #define OS_QUEUE                QueueHandle_t
 #define OS_SEMAPHORE_HANDLE     SemaphoreHandle_t
-#define OS_IDLE_TASK_STACK_SIZE (configMINIMAL_STACK_SIZE) /**< stack size of the idle task */
-#define OS_TICK_RATE_MS         (portTICK_RATE_MS)         /**< FreeRTOS name of the tick rate */
+/** stack size of the idle task, doubled as the background jobs run in the idle hook */
+#define OS_IDLE_TASK_STACK_SIZE (2u * configMINIMAL_STACK_SIZE)
+#define OS_TICK_RATE_MS         (portTICK_RATE_MS) /**< FreeRTOS name of the tick rate */
 #ifndef OS_ENABLE_CACHE
 #define OS_ENABLE_CACHE (false) /**< true: Enable cache, false: Disable cache */
 #endif
@@ -439,6 +440,15 @@ extern void OS_SuspendTask(TaskHandle_t taskToSuspend);
  */
 extern void OS_ResumeTask(TaskHandle_t taskToResume);
 
+/**
+ * @brief   Returns the stack high-water mark of a task
+ * @details The high-water mark is the minimum amount of stack space that has
+ *          remained unused since the task started.
+ * @param   task    handle of the task
+ * @return  unused stack space in bytes
+ */
+extern uint32_t OS_GetStackHighWaterMark_B(TaskHandle_t task);
+
 /**
  * @brief   Check if messages are waiting for queue
  * @details This function needs to implement the wrapper to OS specific queue
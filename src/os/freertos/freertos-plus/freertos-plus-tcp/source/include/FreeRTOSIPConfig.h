@@ -37,6 +37,7 @@
 
 #include "portmacro.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 #if defined(FOXBMS_UART_SUPPORT) && FOXBMS_UART_SUPPORT == 1
@@ -300,6 +301,19 @@ maximum size.  Define the size of Rx buffer for TCP sockets. */
 /* Define the size of Tx buffer for TCP sockets. */
 #define ipconfigTCP_TX_BUFFER_LENGTH (2 * ipconfigTCP_MSS)
 
+/* Socket structures, TCP stream buffers and the TCP window segments are not
+taken from the FreeRTOS heap, but from fixed-block memory pools that are
+reserved at build time.  The pools are configured in mem_pool_cfg.h, the hooks
+are implemented in ethernet.c. */
+extern void *ETH_AllocateSocket(size_t size);
+extern void ETH_FreeSocket(void *pSocket);
+extern void *ETH_AllocateTcpBuffer(size_t size);
+extern void ETH_FreeTcpBuffer(void *pBuffer);
+#define pvPortMallocSocket(size) ETH_AllocateSocket(size)
+#define vPortFreeSocket(ptr)     ETH_FreeSocket(ptr)
+#define pvPortMallocLarge(size)  ETH_AllocateTcpBuffer(size)
+#define vPortFreeLarge(ptr)      ETH_FreeTcpBuffer(ptr)
+
 /* When using call-back handlers, the driver may check if the handler points to
 real program memory (RAM or flash) or just has a random non-zero value. */
 #define ipconfigIS_VALID_PROG_ADDRESS(x) ((x) != NULL)
@@ -100,7 +100,10 @@ typedef enum
 
 #define configSUPPORT_STATIC_ALLOCATION     ( 1 )
 #define configSUPPORT_DYNAMIC_ALLOCATION    ( 1 )
-#define configTOTAL_HEAP_SIZE               ( ( size_t ) 40 * 1024 )
+/* FreeRTOS+TCP sockets and stream buffers are served from the memory pools
+ * (see mem_pool_cfg.h), the heap only holds event groups, socket sets and DNS
+ * results */
+#define configTOTAL_HEAP_SIZE               ( ( size_t ) 8 * 1024 )
 #define configAPPLICATION_ALLOCATED_HEAP    ( 0 )
 
 /******************************************************************************/
@@ -121,7 +124,37 @@ typedef enum
 /******************************************************************************/
 
 #define configGENERATE_RUN_TIME_STATS    ( 0 )
-#define configUSE_TRACE_FACILITY         ( 0 )
+#define configUSE_TRACE_FACILITY         ( 1 )
+
+/******************************************************************************/
+/* Trace macro definitions (kernel trace recorder, see trace.h). **************/
+/******************************************************************************/
+
+/* The hooks are implemented in src/app/engine/trace/trace.c. They are declared
+ * here, as the kernel is built without the include paths of the application.
+ * configUSE_TRACE_FACILITY is required for the task numbers. */
+#include <stdint.h>
+extern void TRC_KernelTaskCreate( uint32_t taskNumber,
+                                  const char * pTaskName,
+                                  uint32_t priority );
+extern void TRC_KernelTaskSwitchedIn( uint32_t taskNumber );
+extern void TRC_KernelTaskDelayUntil( uint32_t timeToWake );
+extern void TRC_KernelQueueCreate( const void * pQueue );
+extern void TRC_KernelBlockingOnQueueReceive( const void * pQueue );
+extern void TRC_KernelBlockingOnQueueSend( const void * pQueue );
+extern void TRC_KernelTaskNotifyBlock( uint32_t index );
+
+#define traceTASK_CREATE( pxNewTCB )                              \
+    TRC_KernelTaskCreate( ( uint32_t ) ( pxNewTCB )->uxTCBNumber, \
+                          &( ( pxNewTCB )->pcTaskName[ 0 ] ),     \
+                          ( uint32_t ) ( pxNewTCB )->uxPriority )
+#define traceTASK_SWITCHED_IN()                        TRC_KernelTaskSwitchedIn( ( uint32_t ) pxCurrentTCB->uxTCBNumber )
+#define traceTASK_DELAY_UNTIL( xTimeToWake )           TRC_KernelTaskDelayUntil( ( uint32_t ) ( xTimeToWake ) )
+#define traceQUEUE_CREATE( pxNewQueue )                TRC_KernelQueueCreate( ( const void * ) ( pxNewQueue ) )
+#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )      TRC_KernelBlockingOnQueueReceive( ( const void * ) ( pxQueue ) )
+#define traceBLOCKING_ON_QUEUE_SEND( pxQueue )         TRC_KernelBlockingOnQueueSend( ( const void * ) ( pxQueue ) )
+#define traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait )   TRC_KernelTaskNotifyBlock( ( uint32_t ) ( uxIndexToWait ) )
+#define traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait )   TRC_KernelTaskNotifyBlock( ( uint32_t ) ( uxIndexToWait ) )
 
 /******************************************************************************/
 /* Definitions that include or exclude functionality. *************************/
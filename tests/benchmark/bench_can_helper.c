@@ -0,0 +1,159 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    bench_can_helper.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup TESTS
+ * @prefix  BENCH
+ *
+ * @brief   Benchmark of the CAN signal packing and unpacking
+ * @details Measures packing and unpacking of a message with four 16 bit signals
+ *          in both byte orders, as it is done by the CAN callbacks.
+ */
+
+/*========== Includes =======================================================*/
+#include "benchmark.h"
+
+#include "can_cfg.h"
+
+#include "can_helper.h"
+
+#include <math.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** number of signals in the benchmarked message */
+#define BENCH_CAN_NUMBER_OF_SIGNALS (4u)
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** big endian layout of the benchmarked message */
+static const CAN_SIGNAL_TYPE_s bench_canBigEndianSignals[BENCH_CAN_NUMBER_OF_SIGNALS] = {
+    {7u, 16u, 0.1f, 0.0f, 0.0f, 6553.5f},
+    {23u, 16u, 0.1f, 0.0f, 0.0f, 6553.5f},
+    {39u, 16u, 1.0f, 32768.0f, -32768.0f, 32767.0f},
+    {55u, 16u, 1.0f, 32768.0f, -32768.0f, 32767.0f},
+};
+
+/** little endian layout of the benchmarked message */
+static const CAN_SIGNAL_TYPE_s bench_canLittleEndianSignals[BENCH_CAN_NUMBER_OF_SIGNALS] = {
+    {0u, 16u, 0.1f, 0.0f, 0.0f, 6553.5f},
+    {16u, 16u, 0.1f, 0.0f, 0.0f, 6553.5f},
+    {32u, 16u, 1.0f, 32768.0f, -32768.0f, 32767.0f},
+    {48u, 16u, 1.0f, 32768.0f, -32768.0f, 32767.0f},
+};
+
+static float_t bench_canSignalValues[BENCH_CAN_NUMBER_OF_SIGNALS] = {3700.0f, 3650.0f, -125.0f, 250.0f};
+static uint8_t bench_canData[CAN_MAX_DLC]                         = {0u};
+static volatile float_t bench_canUnpackedSignal                   = 0.0f;
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/** packs all signals into #bench_canData */
+static void BENCH_Pack(const CAN_SIGNAL_TYPE_s *pkSignals, CAN_ENDIANNESS_e endianness);
+
+/** unpacks all signals from #bench_canData */
+static void BENCH_Unpack(const CAN_SIGNAL_TYPE_s *pkSignals, CAN_ENDIANNESS_e endianness);
+
+static void BENCH_PackBigEndian(void);
+static void BENCH_UnpackBigEndian(void);
+static void BENCH_PackLittleEndian(void);
+static void BENCH_UnpackLittleEndian(void);
+
+/*========== Static Function Implementations ================================*/
+static void BENCH_Pack(const CAN_SIGNAL_TYPE_s *pkSignals, CAN_ENDIANNESS_e endianness) {
+    uint64_t message = 0u;
+    bench_canSignalValues[0] += 1.0f;
+    for (uint8_t i = 0u; i < BENCH_CAN_NUMBER_OF_SIGNALS; i++) {
+        float_t signal = bench_canSignalValues[i];
+        CAN_TxPrepareSignalData(&signal, pkSignals[i]);
+        CAN_TxSetMessageDataWithSignalData(
+            &message, pkSignals[i].bitStart, pkSignals[i].bitLength, (uint64_t)signal, endianness);
+    }
+    CAN_TxSetCanDataWithMessageData(message, bench_canData, endianness);
+}
+
+static void BENCH_Unpack(const CAN_SIGNAL_TYPE_s *pkSignals, CAN_ENDIANNESS_e endianness) {
+    uint64_t message = 0u;
+    bench_canData[0]++;
+    CAN_RxGetMessageDataFromCanData(&message, bench_canData, endianness);
+    for (uint8_t i = 0u; i < BENCH_CAN_NUMBER_OF_SIGNALS; i++) {
+        uint64_t signalRaw = 0u;
+        float_t signal     = 0.0f;
+        CAN_RxGetSignalDataFromMessageData(
+            message, pkSignals[i].bitStart, pkSignals[i].bitLength, &signalRaw, endianness);
+        CAN_RxConvertRawSignalData(&signal, (float_t)signalRaw, pkSignals[i]);
+        bench_canUnpackedSignal = signal;
+    }
+}
+
+static void BENCH_PackBigEndian(void) {
+    BENCH_Pack(bench_canBigEndianSignals, CAN_BIG_ENDIAN);
+}
+
+static void BENCH_UnpackBigEndian(void) {
+    BENCH_Unpack(bench_canBigEndianSignals, CAN_BIG_ENDIAN);
+}
+
+static void BENCH_PackLittleEndian(void) {
+    BENCH_Pack(bench_canLittleEndianSignals, CAN_LITTLE_ENDIAN);
+}
+
+static void BENCH_UnpackLittleEndian(void) {
+    BENCH_Unpack(bench_canLittleEndianSignals, CAN_LITTLE_ENDIAN);
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void BENCH_RunKernels(void) {
+    BENCH_Measure("CAN_PackBigEndian", BENCH_PackBigEndian, BENCH_DEFAULT_ITERATIONS);
+    BENCH_Measure("CAN_UnpackBigEndian", BENCH_UnpackBigEndian, BENCH_DEFAULT_ITERATIONS);
+    BENCH_Measure("CAN_PackLittleEndian", BENCH_PackLittleEndian, BENCH_DEFAULT_ITERATIONS);
+    BENCH_Measure("CAN_UnpackLittleEndian", BENCH_UnpackLittleEndian, BENCH_DEFAULT_ITERATIONS);
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
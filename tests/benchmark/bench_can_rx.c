@@ -0,0 +1,121 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    bench_can_rx.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup TESTS
+ * @prefix  BENCH
+ *
+ * @brief   Benchmark of the CAN receive path
+ * @details Measures #CAN_ReadRxBuffer for a burst of the eight current sensor
+ *          messages of string 0, i.e., the dispatch to the receive callbacks
+ *          and the decoding of the messages. The receive queue of the
+ *          operating system is replaced by a static buffer.
+ */
+
+/*========== Includes =======================================================*/
+#include "benchmark.h"
+
+#include "can_cfg.h"
+#include "can_cfg_rx-message-definitions.h"
+
+#include "can.h"
+#include "ftask.h"
+#include "os.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/*========== Macros and Definitions =========================================*/
+/** number of messages that are received per kernel call */
+#define BENCH_CAN_RX_BURST_LENGTH (8u)
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** messages of one measurement cycle of the current sensor */
+static const CAN_BUFFER_ELEMENT_s bench_canRxBurst[BENCH_CAN_RX_BURST_LENGTH] = {
+    {CAN_NODE_CURRENT_SENSOR, 0x521u, CAN_STANDARD_IDENTIFIER_11_BIT, {0x00u, 0x00u, 0x00u, 0x00u, 0x27u, 0x10u}},
+    {CAN_NODE_CURRENT_SENSOR, 0x522u, CAN_STANDARD_IDENTIFIER_11_BIT, {0x01u, 0x00u, 0x00u, 0x05u, 0x7Eu, 0x40u}},
+    {CAN_NODE_CURRENT_SENSOR, 0x523u, CAN_STANDARD_IDENTIFIER_11_BIT, {0x02u, 0x00u, 0x00u, 0x05u, 0x7Eu, 0x40u}},
+    {CAN_NODE_CURRENT_SENSOR, 0x524u, CAN_STANDARD_IDENTIFIER_11_BIT, {0x03u, 0x00u, 0x00u, 0x05u, 0x7Eu, 0x40u}},
+    {CAN_NODE_CURRENT_SENSOR, 0x525u, CAN_STANDARD_IDENTIFIER_11_BIT, {0x04u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFAu}},
+    {CAN_NODE_CURRENT_SENSOR, 0x526u, CAN_STANDARD_IDENTIFIER_11_BIT, {0x05u, 0x00u, 0x00u, 0x03u, 0x6Bu, 0x00u}},
+    {CAN_NODE_CURRENT_SENSOR, 0x527u, CAN_STANDARD_IDENTIFIER_11_BIT, {0x06u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u}},
+    {CAN_NODE_CURRENT_SENSOR, 0x528u, CAN_STANDARD_IDENTIFIER_11_BIT, {0x07u, 0x00u, 0x00u, 0x00u, 0x10u, 0x00u}},
+};
+
+/** index of the next message that is returned by the receive queue */
+static uint8_t bench_canRxIndex = 0u;
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+static void BENCH_ReadRxBuffer(void);
+
+/*========== Static Function Implementations ================================*/
+static void BENCH_ReadRxBuffer(void) {
+    bench_canRxIndex = 0u;
+    CAN_ReadRxBuffer();
+}
+
+/*========== Extern Function Implementations ================================*/
+extern OS_STD_RETURN_e OS_ReceiveFromQueue(OS_QUEUE xQueue, void *const pvBuffer, uint32_t ticksToWait) {
+    OS_STD_RETURN_e retval = OS_FAIL;
+    if (bench_canRxIndex < BENCH_CAN_RX_BURST_LENGTH) {
+        (void)memcpy(pvBuffer, &bench_canRxBurst[bench_canRxIndex], sizeof(CAN_BUFFER_ELEMENT_s));
+        bench_canRxIndex++;
+        retval = OS_SUCCESS;
+    }
+    return retval;
+}
+
+extern void BENCH_RunKernels(void) {
+    ftsk_allQueuesCreated = true;
+    BENCH_Measure("CAN_ReadRxBuffer", BENCH_ReadRxBuffer, BENCH_DEFAULT_ITERATIONS);
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
@@ -0,0 +1,124 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    bench_database.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup TESTS
+ * @prefix  BENCH
+ *
+ * @brief   Benchmark of the database copy path
+ * @details Measures the part of the database task that copies the entries of a
+ *          received queue message from and to the database (the queue itself
+ *          is part of the operating system and not measured). The largest
+ *          entries of the default configuration are used.
+ */
+
+/*========== Includes =======================================================*/
+#include "benchmark.h"
+
+#include "database_cfg.h"
+
+#include "database.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+static DATA_BLOCK_CELL_VOLTAGE_s bench_dataCellVoltage = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_BASE};
+static DATA_BLOCK_CELL_TEMPERATURE_s bench_dataCellTemperature = {
+    .header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE_BASE};
+static DATA_BLOCK_MIN_MAX_s bench_dataMinMax   = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+static DATA_BLOCK_CURRENT_s bench_dataCurrent  = {.header.uniqueId = DATA_BLOCK_ID_CURRENT};
+
+/** message of a read access of one entry */
+static const DATA_QUEUE_MESSAGE_s bench_dataRead1Message = {
+    .pDatabaseEntry = {&bench_dataCellVoltage, NULL_PTR, NULL_PTR, NULL_PTR},
+    .accessType     = DATA_READ_ACCESS,
+};
+
+/** message of a write access of one entry */
+static const DATA_QUEUE_MESSAGE_s bench_dataWrite1Message = {
+    .pDatabaseEntry = {&bench_dataCellVoltage, NULL_PTR, NULL_PTR, NULL_PTR},
+    .accessType     = DATA_WRITE_ACCESS,
+};
+
+/** message of a read access of four entries */
+static const DATA_QUEUE_MESSAGE_s bench_dataRead4Message = {
+    .pDatabaseEntry = {&bench_dataCellVoltage, &bench_dataCellTemperature, &bench_dataMinMax, &bench_dataCurrent},
+    .accessType     = DATA_READ_ACCESS,
+};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+static void BENCH_DataRead1(void);
+static void BENCH_DataWrite1(void);
+static void BENCH_DataRead4(void);
+
+/*========== Static Function Implementations ================================*/
+static void BENCH_DataRead1(void) {
+    TEST_DATA_IterateOverDatabaseEntries(&bench_dataRead1Message);
+}
+
+static void BENCH_DataWrite1(void) {
+    TEST_DATA_IterateOverDatabaseEntries(&bench_dataWrite1Message);
+}
+
+static void BENCH_DataRead4(void) {
+    TEST_DATA_IterateOverDatabaseEntries(&bench_dataRead4Message);
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void BENCH_RunKernels(void) {
+    BENCH_Measure("DATA_CopyRead1DataBlock", BENCH_DataRead1, BENCH_DEFAULT_ITERATIONS);
+    BENCH_Measure("DATA_CopyWrite1DataBlock", BENCH_DataWrite1, BENCH_DEFAULT_ITERATIONS);
+    BENCH_Measure("DATA_CopyRead4DataBlocks", BENCH_DataRead4, BENCH_DEFAULT_ITERATIONS);
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
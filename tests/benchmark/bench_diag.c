@@ -0,0 +1,102 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    bench_diag.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup TESTS
+ * @prefix  BENCH
+ *
+ * @brief   Benchmark of the diagnosis handler
+ * @details Measures #DIAG_Handler with the diagnosis configuration of the
+ *          firmware for the steady state (event ok, no error pending) and for
+ *          a debounced error (alternating events below the threshold, i.e.,
+ *          two calls per kernel call).
+ */
+
+/*========== Includes =======================================================*/
+#include "benchmark.h"
+
+#include "diag_cfg.h"
+
+#include "diag.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** diagnosis entry with a debounce threshold larger than one */
+#define BENCH_DIAG_ID (DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_MSL)
+
+/*========== Static Constant and Variable Definitions =======================*/
+static volatile DIAG_RETURNTYPE_e bench_diagReturnValue = DIAG_HANDLER_RETURN_UNKNOWN;
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+static void BENCH_DiagHandlerEventOk(void);
+static void BENCH_DiagHandlerDebounce(void);
+
+/*========== Static Function Implementations ================================*/
+static void BENCH_DiagHandlerEventOk(void) {
+    bench_diagReturnValue = DIAG_Handler(BENCH_DIAG_ID, DIAG_EVENT_OK, DIAG_STRING, 0u);
+}
+
+static void BENCH_DiagHandlerDebounce(void) {
+    bench_diagReturnValue = DIAG_Handler(BENCH_DIAG_ID, DIAG_EVENT_NOT_OK, DIAG_STRING, 0u);
+    bench_diagReturnValue = DIAG_Handler(BENCH_DIAG_ID, DIAG_EVENT_OK, DIAG_STRING, 0u);
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void BENCH_RunKernels(void) {
+    (void)DIAG_Initialize(&diag_device);
+    BENCH_Measure("DIAG_Handler_EventOk", BENCH_DiagHandlerEventOk, BENCH_DEFAULT_ITERATIONS);
+    /* keep the occurrence counter above one so that the error is never cleared */
+    (void)DIAG_Handler(BENCH_DIAG_ID, DIAG_EVENT_NOT_OK, DIAG_STRING, 0u);
+    BENCH_Measure("DIAG_Handler_Debounce", BENCH_DiagHandlerDebounce, BENCH_DEFAULT_ITERATIONS);
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
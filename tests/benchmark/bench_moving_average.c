@@ -0,0 +1,105 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    bench_moving_average.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup TESTS
+ * @prefix  BENCH
+ *
+ * @brief   Benchmark of the moving average of current and power
+ * @details The database read is replaced so that every call of
+ *          #ALGO_MovingAverage sees a new current and power sample, i.e., the
+ *          full update path of all averaging windows is measured.
+ */
+
+/*========== Includes =======================================================*/
+#include "benchmark.h"
+
+#include "battery_system_cfg.h"
+
+#include "database.h"
+#include "fstd_types.h"
+#include "moving_average.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** counter that is used to generate new samples */
+static uint8_t bench_maSampleCounter = 0u;
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+static void BENCH_MovingAverage(void);
+
+/*========== Static Function Implementations ================================*/
+static void BENCH_MovingAverage(void) {
+    ALGO_MovingAverage();
+}
+
+/*========== Extern Function Implementations ================================*/
+extern STD_RETURN_TYPE_e DATA_Read2DataBlocks(void *pDataToReceiver0, void *pDataToReceiver1) {
+    DATA_BLOCK_CURRENT_s *pTableCurrent = (DATA_BLOCK_CURRENT_s *)pDataToReceiver0;
+    DATA_BLOCK_POWER_s *pTablePower     = (DATA_BLOCK_POWER_s *)pDataToReceiver1;
+    bench_maSampleCounter++;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        pTableCurrent->current_mA[s] = (int32_t)bench_maSampleCounter * 100;
+        pTablePower->power_W[s]      = (int32_t)bench_maSampleCounter * 40;
+    }
+    pTableCurrent->newCurrent = bench_maSampleCounter;
+    pTablePower->newPower     = bench_maSampleCounter;
+    return STD_OK;
+}
+
+extern void BENCH_RunKernels(void) {
+    BENCH_Measure("ALGO_MovingAverage", BENCH_MovingAverage, BENCH_DEFAULT_ITERATIONS);
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
@@ -0,0 +1,106 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    bench_pec.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup TESTS
+ * @prefix  BENCH
+ *
+ * @brief   Benchmark of the PEC calculations of the AFE drivers
+ * @details Measures the PEC15 of the LTC driver and the PEC15/PEC10 of the
+ *          ADI driver for a register group frame (6 data bytes).
+ */
+
+/*========== Includes =======================================================*/
+#include "benchmark.h"
+
+#include "adi_ades183x_pec.h"
+#include "ltc_pec.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** size of a register group without PEC */
+#define BENCH_PEC_DATA_LENGTH (6u)
+
+/*========== Static Constant and Variable Definitions =======================*/
+static uint8_t bench_pecData[BENCH_PEC_DATA_LENGTH + 2u] = {0x12u, 0x34u, 0x56u, 0x78u, 0x9Au, 0xBCu, 0u, 0u};
+static volatile uint16_t bench_pecResult                  = 0u;
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+static void BENCH_LtcPec15(void);
+static void BENCH_AdiPec15(void);
+static void BENCH_AdiPec10(void);
+
+/*========== Static Function Implementations ================================*/
+static void BENCH_LtcPec15(void) {
+    bench_pecData[0]++;
+    bench_pecResult = LTC_CalculatePec15(BENCH_PEC_DATA_LENGTH, bench_pecData);
+}
+
+static void BENCH_AdiPec15(void) {
+    bench_pecData[0]++;
+    bench_pecResult = ADI_Pec15(BENCH_PEC_DATA_LENGTH, bench_pecData);
+}
+
+static void BENCH_AdiPec10(void) {
+    bench_pecData[0]++;
+    bench_pecResult = ADI_Pec10(BENCH_PEC_DATA_LENGTH, bench_pecData, false);
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void BENCH_RunKernels(void) {
+    BENCH_Measure("LTC_CalculatePec15", BENCH_LtcPec15, BENCH_DEFAULT_ITERATIONS);
+    BENCH_Measure("ADI_Pec15", BENCH_AdiPec15, BENCH_DEFAULT_ITERATIONS);
+    BENCH_Measure("ADI_Pec10", BENCH_AdiPec10, BENCH_DEFAULT_ITERATIONS);
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
@@ -0,0 +1,117 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    bench_redundancy.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup TESTS
+ * @prefix  BENCH
+ *
+ * @brief   Benchmark of the cell voltage and temperature min/max/average
+ * @details Measures the minimum, maximum and average calculation of the
+ *          redundancy module for all cells of the battery system with all
+ *          measurements valid.
+ */
+
+/*========== Includes =======================================================*/
+#include "benchmark.h"
+
+#include "battery_system_cfg.h"
+
+#include "database.h"
+#include "redundancy.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+static DATA_BLOCK_CELL_VOLTAGE_s bench_mrcCellVoltage = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_BASE};
+static DATA_BLOCK_CELL_TEMPERATURE_s bench_mrcCellTemperature = {
+    .header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE_BASE};
+static DATA_BLOCK_MIN_MAX_s bench_mrcMinMax = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/** fills the measurement tables with distinct values */
+static void BENCH_InitializeMeasurements(void);
+
+static void BENCH_CellVoltageMinMaxAverage(void);
+static void BENCH_CellTemperatureMinMaxAverage(void);
+
+/*========== Static Function Implementations ================================*/
+static void BENCH_InitializeMeasurements(void) {
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                bench_mrcCellVoltage.cellVoltage_mV[s][m][cb] = (int16_t)(3600 + (((m * 7) + (cb * 13)) % 200));
+            }
+            for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
+                bench_mrcCellTemperature.cellTemperature_ddegC[s][m][ts] =
+                    (int16_t)(250 + (((m * 5) + (ts * 11)) % 100));
+            }
+        }
+    }
+}
+
+static void BENCH_CellVoltageMinMaxAverage(void) {
+    (void)TEST_MRC_CalculateCellVoltageMinMaxAverage(&bench_mrcCellVoltage, &bench_mrcMinMax);
+}
+
+static void BENCH_CellTemperatureMinMaxAverage(void) {
+    (void)TEST_MRC_CalculateCellTemperatureMinMaxAverage(&bench_mrcCellTemperature, &bench_mrcMinMax);
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void BENCH_RunKernels(void) {
+    BENCH_InitializeMeasurements();
+    BENCH_Measure("MRC_CalculateCellVoltageMinMaxAverage", BENCH_CellVoltageMinMaxAverage, 10000u);
+    BENCH_Measure("MRC_CalculateCellTemperatureMinMaxAverage", BENCH_CellTemperatureMinMaxAverage, 10000u);
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
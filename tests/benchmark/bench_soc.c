@@ -0,0 +1,101 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    bench_soc.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup TESTS
+ * @prefix  BENCH
+ *
+ * @brief   Benchmark of the state-of-charge look-up from the cell voltage
+ * @details Measures #SE_GetStateOfChargeFromVoltage of the coulomb counting
+ *          state estimation (the default configuration) over a voltage sweep
+ *          that covers the whole look-up table.
+ */
+
+/*========== Includes =======================================================*/
+#include "benchmark.h"
+
+#include "state_estimation.h"
+
+#include <math.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** lower limit of the swept cell voltage */
+#define BENCH_SOC_MINIMUM_VOLTAGE_mV (2500)
+
+/** upper limit of the swept cell voltage */
+#define BENCH_SOC_MAXIMUM_VOLTAGE_mV (4300)
+
+/** step of the swept cell voltage */
+#define BENCH_SOC_VOLTAGE_STEP_mV (3)
+
+/*========== Static Constant and Variable Definitions =======================*/
+static int16_t bench_socVoltage_mV         = BENCH_SOC_MINIMUM_VOLTAGE_mV;
+static volatile float_t bench_socSoc_perc = 0.0f;
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+static void BENCH_GetStateOfChargeFromVoltage(void);
+
+/*========== Static Function Implementations ================================*/
+static void BENCH_GetStateOfChargeFromVoltage(void) {
+    bench_socVoltage_mV += BENCH_SOC_VOLTAGE_STEP_mV;
+    if (bench_socVoltage_mV > BENCH_SOC_MAXIMUM_VOLTAGE_mV) {
+        bench_socVoltage_mV = BENCH_SOC_MINIMUM_VOLTAGE_mV;
+    }
+    bench_socSoc_perc = SE_GetStateOfChargeFromVoltage(bench_socVoltage_mV);
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void BENCH_RunKernels(void) {
+    BENCH_Measure("SE_GetStateOfChargeFromVoltage", BENCH_GetStateOfChargeFromVoltage, BENCH_DEFAULT_ITERATIONS);
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
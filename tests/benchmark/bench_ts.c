@@ -0,0 +1,122 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    bench_ts.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup TESTS
+ * @prefix  BENCH
+ *
+ * @brief   Benchmark of the temperature sensor conversions
+ * @details Measures the look-up table conversion of two NTC sensors, the
+ *          polynomial conversion of the sensor that implements it and the
+ *          beta conversion over the whole measurement range of the resistor
+ *          divider (i.e., every call converts a different voltage).
+ */
+
+/*========== Includes =======================================================*/
+#include "benchmark.h"
+
+#include "beta.h"
+#include "epcos_b57251v5103j060.h"
+#include "vishay_ntcalug01a103g.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** upper limit of the swept input voltage */
+#define BENCH_TS_MAXIMUM_VOLTAGE_mV (3000u)
+
+/** step of the swept input voltage */
+#define BENCH_TS_VOLTAGE_STEP_mV (7u)
+
+/*========== Static Constant and Variable Definitions =======================*/
+static uint16_t bench_tsVoltage_mV               = 0u;
+static volatile int16_t bench_tsTemperature_ddegC = 0;
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/** returns the next input voltage of the sweep */
+static uint16_t BENCH_GetNextVoltage(void);
+
+static void BENCH_Vis00Lut(void);
+static void BENCH_Epc00Lut(void);
+static void BENCH_Epc00Polynomial(void);
+static void BENCH_Beta(void);
+
+/*========== Static Function Implementations ================================*/
+static uint16_t BENCH_GetNextVoltage(void) {
+    bench_tsVoltage_mV = (uint16_t)((bench_tsVoltage_mV + BENCH_TS_VOLTAGE_STEP_mV) % BENCH_TS_MAXIMUM_VOLTAGE_mV);
+    return bench_tsVoltage_mV;
+}
+
+static void BENCH_Vis00Lut(void) {
+    bench_tsTemperature_ddegC = TS_Vis00GetTemperatureFromLut(BENCH_GetNextVoltage());
+}
+
+static void BENCH_Epc00Lut(void) {
+    bench_tsTemperature_ddegC = TS_Epc00GetTemperatureFromLut(BENCH_GetNextVoltage());
+}
+
+static void BENCH_Epc00Polynomial(void) {
+    bench_tsTemperature_ddegC = TS_Epc00GetTemperatureFromPolynomial(BENCH_GetNextVoltage());
+}
+
+static void BENCH_Beta(void) {
+    bench_tsTemperature_ddegC = BETA_GetTemperatureFromBeta(BENCH_GetNextVoltage());
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void BENCH_RunKernels(void) {
+    BENCH_Measure("TS_Vis00GetTemperatureFromLut", BENCH_Vis00Lut, BENCH_DEFAULT_ITERATIONS);
+    BENCH_Measure("TS_Epc00GetTemperatureFromLut", BENCH_Epc00Lut, BENCH_DEFAULT_ITERATIONS);
+    BENCH_Measure("TS_Epc00GetTemperatureFromPolynomial", BENCH_Epc00Polynomial, BENCH_DEFAULT_ITERATIONS);
+    BENCH_Measure("BETA_GetTemperatureFromBeta", BENCH_Beta, BENCH_DEFAULT_ITERATIONS);
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
@@ -0,0 +1,147 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    benchmark.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup TESTS
+ * @prefix  BENCH
+ *
+ * @brief   Host benchmark harness for firmware hot paths
+ * @details Measures with the monotonic clock and, on x86 hosts, with the
+ *          time stamp counter. Cycles are reported as null on other hosts.
+ */
+
+/*========== Includes =======================================================*/
+#include "benchmark.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_CYCLE_COUNTER (true)
+#else
+#define BENCH_HAS_CYCLE_COUNTER (false)
+#endif
+
+/*========== Macros and Definitions =========================================*/
+#define BENCH_NS_PER_S (1000000000ull)
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/** returns the monotonic time in nanoseconds */
+static uint64_t BENCH_GetTime_ns(void);
+
+/** returns the time stamp counter or 0 if the host does not provide one */
+static uint64_t BENCH_GetCycles(void);
+
+/*========== Static Function Implementations ================================*/
+static uint64_t BENCH_GetTime_ns(void) {
+    struct timespec now = {0};
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * BENCH_NS_PER_S) + (uint64_t)now.tv_nsec;
+}
+
+static uint64_t BENCH_GetCycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0u;
+#endif
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void BENCH_Measure(const char *pName, BENCH_KERNEL_f kernel, uint32_t iterations) {
+    uint64_t bestTime_ns = UINT64_MAX;
+    uint64_t bestCycles  = UINT64_MAX;
+
+    kernel();
+    for (uint32_t round = 0u; round < BENCH_REPETITIONS; round++) {
+        const uint64_t startTime_ns = BENCH_GetTime_ns();
+        const uint64_t startCycles  = BENCH_GetCycles();
+        for (uint32_t i = 0u; i < iterations; i++) {
+            kernel();
+        }
+        const uint64_t cycles  = BENCH_GetCycles() - startCycles;
+        const uint64_t time_ns = BENCH_GetTime_ns() - startTime_ns;
+        if (time_ns < bestTime_ns) {
+            bestTime_ns = time_ns;
+        }
+        if (cycles < bestCycles) {
+            bestCycles = cycles;
+        }
+    }
+
+    const double nsPerCall = (double)bestTime_ns / (double)iterations;
+    if (BENCH_HAS_CYCLE_COUNTER == true) {
+        (void)printf(
+            "{\"name\": \"%s\", \"iterations\": %u, \"ns_per_call\": %.3f, \"cycles_per_call\": %.3f}\n",
+            pName,
+            (unsigned int)iterations,
+            nsPerCall,
+            (double)bestCycles / (double)iterations);
+    } else {
+        (void)printf(
+            "{\"name\": \"%s\", \"iterations\": %u, \"ns_per_call\": %.3f, \"cycles_per_call\": null}\n",
+            pName,
+            (unsigned int)iterations,
+            nsPerCall);
+    }
+}
+
+int main(void) {
+    BENCH_RunKernels();
+    return 0;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
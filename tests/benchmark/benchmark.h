@@ -0,0 +1,105 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    benchmark.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup TESTS
+ * @prefix  BENCH
+ *
+ * @brief   Host benchmark harness for firmware hot paths
+ * @details Every benchmark executable links one or more firmware modules, a
+ *          kernel file that implements #BENCH_RunKernels and this harness.
+ *          Each call of #BENCH_Measure prints one JSON line with the
+ *          results of the measured kernel to stdout. The lines are collected
+ *          and compared against the baseline by benchmark.py.
+ */
+
+#ifndef FOXBMS__BENCHMARK_H_
+#define FOXBMS__BENCHMARK_H_
+
+/*========== Includes =======================================================*/
+
+#include <stdint.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+
+/*========== Macros and Definitions =========================================*/
+/** default number of kernel calls per measurement */
+#define BENCH_DEFAULT_ITERATIONS (100000u)
+
+/** number of measurements per kernel; the fastest one is reported */
+#define BENCH_REPETITIONS (5u)
+
+/** function signature of a benchmarked kernel */
+typedef void (*BENCH_KERNEL_f)(void);
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   measures a kernel and prints the result as JSON line
+ * @details The kernel is called once for warm up, then it is called
+ *          iterations times in #BENCH_REPETITIONS rounds. The fastest round
+ *          is reported as nanoseconds and, where the host provides a time
+ *          stamp counter, as cycles per call.
+ * @param   pName       unique name of the kernel in the result file
+ * @param   kernel      kernel that is measured
+ * @param   iterations  number of calls per measurement round
+ */
+extern void BENCH_Measure(const char *pName, BENCH_KERNEL_f kernel, uint32_t iterations);
+
+/**
+ * @brief   registers and measures all kernels of a benchmark executable
+ * @details Implemented once per benchmark executable (i.e., in each
+ *          bench_*.c file).
+ */
+extern void BENCH_RunKernels(void);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+#endif
+
+#endif /* FOXBMS__BENCHMARK_H_ */
@@ -0,0 +1,363 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Build and run the host benchmarks of the firmware hot paths.
+
+Each benchmark executable links the firmware modules under test, the
+benchmark harness (``benchmark.c``) and weak stubs for everything else
+(``benchmark_stubs.c``). The firmware is compiled with the unit test
+configuration (``UNITY_UNIT_TEST``, ``battery_system_cfg_unit_test.h``) and
+the HALCoGen and generated headers of the unit test build, i.e.,
+``fox.py ceedling`` needs to have been run once before.
+
+The results are written to ``build/benchmark/benchmark-results.json`` and
+compared against ``benchmark-baseline.json``. A kernel is reported as
+regression if it is slower than its baseline by more than the tolerance.
+"""
+
+import argparse
+import json
+import logging  # noqa: TID251
+import platform
+import sys
+from pathlib import Path
+from shutil import which
+from subprocess import PIPE, Popen
+
+SCRIPT_DIR = Path(__file__).parent.resolve()
+REPO_ROOT = SCRIPT_DIR.parent.parent
+BUILD_DIR = REPO_ROOT / "build/benchmark"
+UNIT_TEST_BUILD_DIR = REPO_ROOT / "build/app_host_unit_test"
+UNIT_TEST_INCLUDE = [UNIT_TEST_BUILD_DIR, UNIT_TEST_BUILD_DIR / "include"]
+BASELINE_FILE = SCRIPT_DIR / "benchmark-baseline.json"
+RESULTS_FILE = BUILD_DIR / "benchmark-results.json"
+
+DEFAULT_TOLERANCE = 0.5
+DEFAULT_RUNS = 3
+
+DEFINES = [
+    "UNITY_UNIT_TEST",
+    "FAS_ASSERT_LEVEL=2",
+    "FOXBMS_RTOS_FREERTOS=1",
+    "_POSIX_C_SOURCE=200809L",
+]
+
+# kernels whose run time scales with the size of the battery system use a
+# larger system than the default unit test configuration
+BATTERY_SYSTEM_DEFINES = [
+    "TEST_BS_NR_OF_STRINGS=2u",
+    "TEST_BS_NR_OF_MODULES_PER_STRING=4u",
+]
+
+HARNESS = ["tests/benchmark/benchmark.c", "tests/benchmark/benchmark_stubs.c"]
+
+# benchmark executable: firmware sources that are linked into it and the
+# defines the matching unit tests use (see 'conf/unit/app_project_posix.yml')
+BENCHMARKS: dict[str, dict[str, list[str]]] = {
+    "pec": {
+        "sources": [
+            "tests/benchmark/bench_pec.c",
+            "src/app/driver/afe/ltc/common/ltc_pec.c",
+            "src/app/driver/afe/adi/common/ades183x/pec/adi_ades183x_pec.c",
+        ],
+        "defines": [
+            "FOXBMS_AFE_DRIVER_ADI=1u",
+            "FOXBMS_AFE_DRIVER_ADI_ADES1830=1u",
+            "TEST_BS_NR_OF_CELL_BLOCKS_PER_MODULE=16u",
+        ],
+    },
+    "can_rx": {
+        "sources": [
+            "tests/benchmark/bench_can_rx.c",
+            "src/app/application/algorithm/current_integration/current_integration.c",
+            "src/app/driver/can/can.c",
+            "src/app/driver/can/cbs/can_helper.c",
+            "src/app/driver/config/can_cfg.c",
+            "src/app/driver/config/can_cfg_rx.c",
+            "src/app/driver/can/cbs/rx/can_cbs_rx_cs_isabellenhuette-ivt-s.c",
+        ],
+        "defines": ["FOXBMS_CS_ISABELLENHUETTE_IVT_S=1"],
+    },
+    "can_helper": {
+        "sources": [
+            "tests/benchmark/bench_can_helper.c",
+            "src/app/driver/can/cbs/can_helper.c",
+        ],
+    },
+    "database": {
+        "sources": [
+            "tests/benchmark/bench_database.c",
+            "src/app/engine/config/database_cfg.c",
+            "src/app/engine/database/database.c",
+        ],
+        "defines": BATTERY_SYSTEM_DEFINES,
+    },
+    "diag": {
+        "sources": [
+            "tests/benchmark/bench_diag.c",
+            "src/app/engine/config/diag_cfg.c",
+            "src/app/engine/diag/diag.c",
+            *[
+                i.relative_to(REPO_ROOT).as_posix()
+                for i in sorted((REPO_ROOT / "src/app/engine/diag/cbs").glob("*.c"))
+            ],
+        ],
+    },
+    "moving_average": {
+        "sources": [
+            "tests/benchmark/bench_moving_average.c",
+            "src/app/application/algorithm/moving_average/moving_average.c",
+        ],
+    },
+    "redundancy": {
+        "sources": [
+            "tests/benchmark/bench_redundancy.c",
+            "src/app/application/redundancy/redundancy.c",
+        ],
+        "defines": BATTERY_SYSTEM_DEFINES,
+    },
+    "soc": {
+        "sources": [
+            "tests/benchmark/bench_soc.c",
+            "src/app/application/algorithm/state_estimation/soc/counting/"
+            "soc_counting.c",
+            "src/app/application/config/battery_cell_cfg.c",
+            "src/app/driver/foxmath/foxmath.c",
+        ],
+    },
+    "ts": {
+        "sources": [
+            "tests/benchmark/bench_ts.c",
+            "src/app/driver/foxmath/foxmath.c",
+            "src/app/driver/ts/beta.c",
+            "src/app/driver/ts/epcos/b57251v5103j060/epcos_b57251v5103j060.c",
+            "src/app/driver/ts/vishay/ntcalug01a103g/vishay_ntcalug01a103g.c",
+        ],
+    },
+}
+
+
+def get_include_directories(unit_test_include: list[Path]) -> list[Path]:
+    """Include directories in the same order as the unit test build uses."""
+    includes = [SCRIPT_DIR / "include", *unit_test_include]
+    includes.extend(
+        [
+            REPO_ROOT / "src/os/freertos/freertos/include",
+            REPO_ROOT / "src/os/freertos/freertos/portable/ccs/arm_cortex-r5",
+            REPO_ROOT / "tests/unit/app/application/config",
+            REPO_ROOT / "tests/unit/support",
+            SCRIPT_DIR,
+        ]
+    )
+    includes.extend(
+        sorted(i for i in (REPO_ROOT / "src/app").rglob("*") if i.is_dir())
+    )
+    return includes
+
+
+def build(
+    gcc: str, name: str, config: dict[str, list[str]], includes: list[Path]
+) -> Path:
+    """Compile and link one benchmark executable."""
+    out = BUILD_DIR / name
+    cmd = [
+        gcc,
+        "-std=c11",
+        "-O2",
+        "-include",
+        (REPO_ROOT / "src/app/main/include/general.h").as_posix(),
+        *[f"-D{i}" for i in DEFINES + config.get("defines", [])],
+        *[f"-I{i.as_posix()}" for i in includes],
+        *[(REPO_ROOT / i).as_posix() for i in HARNESS + config["sources"]],
+        "-lm",
+        "-o",
+        out.as_posix(),
+    ]
+    logging.debug(" ".join(cmd))
+    with Popen(cmd, cwd=REPO_ROOT, stdout=PIPE, stderr=PIPE) as p:
+        _, err = p.communicate()
+    if p.returncode:
+        logging.error("Could not build benchmark '%s'.", name)
+        logging.error(err.decode("utf-8"))
+        sys.exit(1)
+    return out
+
+
+def run_once(executable: Path) -> dict[str, dict]:
+    """Run one benchmark executable and parse its JSON lines."""
+    with Popen([executable.as_posix()], stdout=PIPE, stderr=PIPE) as p:
+        out, err = p.communicate()
+    if p.returncode:
+        logging.error("Benchmark '%s' failed.", executable.name)
+        logging.error(err.decode("utf-8"))
+        sys.exit(1)
+    results = {}
+    for line in out.decode("utf-8").splitlines():
+        result = json.loads(line)
+        results[result.pop("name")] = result
+    return results
+
+
+def run(executable: Path, runs: int) -> dict[str, dict]:
+    """Run one benchmark executable several times and keep the fastest run of
+    each kernel, as the measurement noise of the host only adds time."""
+    results: dict[str, dict] = {}
+    for _ in range(runs):
+        for name, result in run_once(executable).items():
+            if name not in results or (
+                result["ns_per_call"] < results[name]["ns_per_call"]
+            ):
+                results[name] = result
+    return results
+
+
+def compare(
+    results: dict[str, dict], baseline: dict[str, dict], tolerance: float
+) -> int:
+    """Compare the results against the baseline and return the error count."""
+    errors = 0
+    for name, expected in baseline.items():
+        if name not in results:
+            logging.error("%s: kernel is missing in the results.", name)
+            errors += 1
+            continue
+        limit = expected["ns_per_call"] * (1.0 + tolerance)
+        measured = results[name]["ns_per_call"]
+        if measured > limit:
+            logging.error(
+                "%s: %.3f ns/call exceeds the baseline of %.3f ns/call by more "
+                "than %.0f%%.",
+                name,
+                measured,
+                expected["ns_per_call"],
+                tolerance * 100,
+            )
+            errors += 1
+        else:
+            logging.info(
+                "%s: %.3f ns/call (baseline: %.3f ns/call)",
+                name,
+                measured,
+                expected["ns_per_call"],
+            )
+    for name in sorted(results.keys() - baseline.keys()):
+        logging.warning("%s: kernel has no baseline.", name)
+    return errors
+
+
+def main() -> int:
+    """Build all benchmarks, run them and compare the results."""
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "-v",
+        "--verbosity",
+        dest="verbosity",
+        action="count",
+        default=0,
+        help="set verbosity level",
+    )
+    parser.add_argument(
+        "--unit-test-include",
+        action="append",
+        type=Path,
+        default=[],
+        help="directory with the HALCoGen and generated headers "
+        "(default: unit test build directory)",
+    )
+    parser.add_argument(
+        "--tolerance",
+        type=float,
+        default=None,
+        help="allowed relative slow down (default: value of the baseline file)",
+    )
+    parser.add_argument(
+        "--runs",
+        type=int,
+        default=DEFAULT_RUNS,
+        help="number of runs per benchmark executable",
+    )
+    parser.add_argument(
+        "--update-baseline",
+        action="store_true",
+        help="store the results as new baseline",
+    )
+    args = parser.parse_args()
+
+    if args.verbosity == 1:
+        logging.basicConfig(level=logging.INFO)
+    elif args.verbosity > 1:
+        logging.basicConfig(level=logging.DEBUG)
+    else:
+        logging.basicConfig(level=logging.WARNING)
+
+    gcc = which("gcc")
+    if not gcc:
+        logging.error("Could not find gcc.")
+        return 1
+    includes = get_include_directories(args.unit_test_include or UNIT_TEST_INCLUDE)
+
+    BUILD_DIR.mkdir(parents=True, exist_ok=True)
+    results: dict[str, dict] = {}
+    for name, config in BENCHMARKS.items():
+        results.update(run(build(gcc, name, config, includes), args.runs))
+
+    report = {
+        "host": f"{platform.system()} {platform.machine()}",
+        "tolerance": DEFAULT_TOLERANCE,
+        "results": results,
+    }
+    RESULTS_FILE.write_text(json.dumps(report, indent=2) + "\n", encoding="utf-8")
+    logging.info("Results written to %s.", RESULTS_FILE)
+
+    if args.update_baseline:
+        if BASELINE_FILE.is_file():
+            report["tolerance"] = json.loads(
+                BASELINE_FILE.read_text(encoding="utf-8")
+            )["tolerance"]
+        BASELINE_FILE.write_text(json.dumps(report, indent=2) + "\n", encoding="utf-8")
+        logging.info("Baseline updated.")
+        return 0
+
+    baseline = json.loads(BASELINE_FILE.read_text(encoding="utf-8"))
+    tolerance = args.tolerance if args.tolerance is not None else baseline["tolerance"]
+    return compare(results, baseline["results"], tolerance)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,363 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    benchmark_stubs.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup TESTS
+ * @prefix  BENCH
+ *
+ * @brief   Weak stubs for the dependencies of the benchmarked modules
+ * @details The benchmarked modules are linked without the operating system, the
+ *          database task and the drivers they depend on. The stubs return
+ *          success without side effects so that only the kernel itself is
+ *          measured. A kernel file overrides a stub by implementing the
+ *          function itself, as all stubs are weak symbols.
+ */
+
+/*========== Includes =======================================================*/
+#include "can_cfg.h"
+
+#include "HL_can.h"
+
+#include "bms.h"
+#include "can_cbs_rx.h"
+#include "can_cbs_tx_f_fatal-error.h"
+#include "database.h"
+#include "database_helper.h"
+#include "diag.h"
+#include "fram.h"
+#include "ftask.h"
+#include "fstd_types.h"
+#include "io.h"
+#include "mcu.h"
+#include "os.h"
+#include "pex.h"
+#include "plausibility.h"
+#include "sys_mon_latency.h"
+#include "timer.h"
+#include "trace.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** marks a stub that can be replaced by a benchmark */
+#define BENCH_WEAK __attribute__((weak))
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+BENCH_WEAK volatile bool ftsk_allQueuesCreated                = false;
+BENCH_WEAK OS_QUEUE ftsk_databaseQueue                        = NULL_PTR;
+BENCH_WEAK OS_QUEUE ftsk_canRxQueue                           = NULL_PTR;
+BENCH_WEAK OS_QUEUE ftsk_canTxUnsentMessagesQueue             = NULL_PTR;
+BENCH_WEAK OS_QUEUE ftsk_imdCanDataQueue                      = NULL_PTR;
+BENCH_WEAK const CAN_TX_MESSAGE_TYPE_s can_txMessages[1]      = {0};
+BENCH_WEAK const uint8_t can_txMessagesLength                 = 0u;
+BENCH_WEAK FRAM_SOC_s fram_soc                                = {0};
+BENCH_WEAK FRAM_DEEP_DISCHARGE_FLAG_s fram_deepDischargeFlags = {0};
+
+/*========== Static Function Prototypes =====================================*/
+
+/*========== Static Function Implementations ================================*/
+
+/*========== Extern Function Implementations ================================*/
+BENCH_WEAK void canInit(void) {
+}
+
+BENCH_WEAK uint32 canTransmit(canBASE_t *node, uint32 messageBox, const uint8 *data) {
+    return 1u;
+}
+
+BENCH_WEAK uint32 canGetData(canBASE_t *node, uint32 messageBox, uint8 *const data) {
+    return 0u;
+}
+
+BENCH_WEAK uint32 canIsTxMessagePending(canBASE_t *node, uint32 messageBox) {
+    return 0u;
+}
+
+BENCH_WEAK uint32 canGetID(canBASE_t *node, uint32 messageBox) {
+    return 0u;
+}
+
+BENCH_WEAK void canUpdateID(canBASE_t *node, uint32 messageBox, uint32 msgBoxArbitVal) {
+}
+
+BENCH_WEAK void vPortDisableInterrupts(void) {
+}
+
+BENCH_WEAK void vPortEnableInterrupts(void) {
+}
+
+BENCH_WEAK extern void OS_EnterTaskCritical(void) {
+}
+
+BENCH_WEAK extern void OS_ExitTaskCritical(void) {
+}
+
+BENCH_WEAK extern OS_STD_RETURN_e OS_SendToBackOfQueueFromIsr(
+    OS_QUEUE xQueue,
+    const void *const pvItemToQueue,
+    long *const pxHigherPriorityTaskWoken) {
+    return OS_SUCCESS;
+}
+
+BENCH_WEAK extern uint32_t MCU_GetFreeRunningCount(void) {
+    return 0u;
+}
+
+BENCH_WEAK extern uint32_t MCU_ConvertFrcDifferenceToTimespan_us(uint32_t count) {
+    return count;
+}
+
+BENCH_WEAK extern void IO_SetPinDirectionToOutput(volatile uint32_t *pRegisterAddress, uint32_t pin) {
+}
+
+BENCH_WEAK extern void IO_PinSet(volatile uint32_t *pRegisterAddress, uint32_t pin) {
+}
+
+BENCH_WEAK extern void PEX_SetPin(uint8_t portExpander, uint8_t pin) {
+}
+
+BENCH_WEAK extern void PEX_SetPinDirectionOutput(uint8_t portExpander, uint8_t pin) {
+}
+
+BENCH_WEAK extern uint32_t CANRX_BmsStateRequest(
+    CAN_MESSAGE_PROPERTIES_s message,
+    const uint8_t *const kpkCanData,
+    const CAN_SHIM_s *const kpkCanShim) {
+    return 0u;
+}
+
+BENCH_WEAK extern uint32_t CANRX_Debug(
+    CAN_MESSAGE_PROPERTIES_s message,
+    const uint8_t *const kpkCanData,
+    const CAN_SHIM_s *const kpkCanShim) {
+    return 0u;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e DATA_Read1DataBlock(void *pDataToReceiver0) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e DATA_Read2DataBlocks(void *pDataToReceiver0, void *pDataToReceiver1) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e DATA_Read3DataBlocks(
+    void *pDataToReceiver0,
+    void *pDataToReceiver1,
+    void *pDataToReceiver2) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e DATA_Read4DataBlocks(
+    void *pDataToReceiver0,
+    void *pDataToReceiver1,
+    void *pDataToReceiver2,
+    void *pDataToReceiver3) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e DATA_Write1DataBlock(void *pDataFromSender0) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e DATA_Write2DataBlocks(void *pDataFromSender0, void *pDataFromSender1) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e DATA_Write3DataBlocks(
+    void *pDataFromSender0,
+    void *pDataFromSender1,
+    void *pDataFromSender2) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e DATA_Write4DataBlocks(
+    void *pDataFromSender0,
+    void *pDataFromSender1,
+    void *pDataFromSender2,
+    void *pDataFromSender3) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern uint32_t DATA_GetNumberOfWrites(DATA_BLOCK_ID_e uniqueId) {
+    return 0u;
+}
+
+BENCH_WEAK extern bool DATA_DatabaseEntryUpdatedAtLeastOnce(DATA_BLOCK_HEADER_s dataBlockHeader) {
+    return true;
+}
+
+BENCH_WEAK extern bool DATA_EntryUpdatedWithinInterval(DATA_BLOCK_HEADER_s dataBlockHeader, uint32_t timeInterval) {
+    return true;
+}
+
+BENCH_WEAK extern DIAG_RETURNTYPE_e DIAG_Handler(
+    DIAG_ID_e diagId,
+    DIAG_EVENT_e event,
+    DIAG_IMPACT_LEVEL_e impact,
+    uint32_t data) {
+    return DIAG_HANDLER_RETURN_OK;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e DIAG_CheckEvent(
+    STD_RETURN_TYPE_e cond,
+    DIAG_ID_e diagId,
+    DIAG_IMPACT_LEVEL_e impact,
+    uint32_t data) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern uint32_t OS_GetTickCount(void) {
+    return 0u;
+}
+
+BENCH_WEAK extern OS_STD_RETURN_e OS_ReceiveFromQueue(OS_QUEUE xQueue, void *const pvBuffer, uint32_t ticksToWait) {
+    return OS_FAIL;
+}
+
+BENCH_WEAK extern OS_STD_RETURN_e OS_SendToBackOfQueue(
+    OS_QUEUE xQueue,
+    const void *const pvItemToQueue,
+    uint32_t ticksToWait) {
+    return OS_SUCCESS;
+}
+
+BENCH_WEAK extern TimerHandle_t TIMER_Create(
+    const char *cpxTimerName,
+    uint32_t uxTimerPeriodInMS,
+    const UBaseType_t cuxAutoReload,
+    void *const cpxTimerID,
+    TimerCallbackFunction_t pxCallbackFunction,
+    StaticTimer_t *pxTimerBuffer) {
+    return NULL_PTR;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e TIMER_Start(TimerHandle_t timerHandle, uint32_t ticks2wait) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e TIMER_Stop(TimerHandle_t timerHandle, uint32_t ticks2wait) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern void TRC_Freeze(TRC_FREEZE_REASON_e reason, uint32_t argument) {
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e CANTX_SendFatalErrorId(uint32_t errorId) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern uint8_t BMS_GetNumberOfConnectedStrings(void) {
+    return 0u;
+}
+
+BENCH_WEAK extern BMS_CURRENT_FLOW_STATE_e BMS_GetBatterySystemState(void) {
+    return BMS_AT_REST;
+}
+
+BENCH_WEAK extern BMS_CURRENT_FLOW_STATE_e BMS_GetCurrentFlowDirection(int32_t current_mA) {
+    return BMS_AT_REST;
+}
+
+BENCH_WEAK extern bool BMS_IsStringClosed(uint8_t stringNumber) {
+    return false;
+}
+
+BENCH_WEAK extern bool BMS_IsStringPrecharging(uint8_t stringNumber) {
+    return false;
+}
+
+BENCH_WEAK extern FRAM_RETURN_TYPE_e FRAM_WriteData(FRAM_BLOCK_ID_e blockId) {
+    return FRAM_ACCESS_OK;
+}
+
+BENCH_WEAK extern void FRAM_RequestWrite(FRAM_BLOCK_ID_e blockId) {
+}
+
+BENCH_WEAK extern FRAM_RETURN_TYPE_e FRAM_ReadData(FRAM_BLOCK_ID_e blockId) {
+    return FRAM_ACCESS_OK;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e PL_CheckStringVoltage(int32_t voltageAfe_mV, int32_t voltageCurrentSensor_mV) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e PL_CheckCellVoltage(
+    int16_t baseCellVoltage,
+    int16_t redundancy0CellVoltage,
+    int16_t *pCellVoltage) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e PL_CheckCellTemperature(
+    int16_t baseCellTemperature,
+    int16_t redundancy0CellTemperature,
+    int16_t *pCellTemperature) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e PL_CheckVoltageSpread(
+    DATA_BLOCK_CELL_VOLTAGE_s *pCellVoltages,
+    DATA_BLOCK_MIN_MAX_s *pMinMaxAverageValues) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern STD_RETURN_TYPE_e PL_CheckTemperatureSpread(
+    DATA_BLOCK_CELL_TEMPERATURE_s *pCellTemperatures,
+    DATA_BLOCK_MIN_MAX_s *pMinMaxAverageValues) {
+    return STD_OK;
+}
+
+BENCH_WEAK extern void SYSM_RecordLatency(SYSM_LATENCY_STAGE_e stage, uint32_t acquisitionTimestamp) {
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
@@ -44,14 +44,15 @@ import sys
 import unittest
 from json.decoder import JSONDecodeError
 from pathlib import Path
+from queue import Empty
 from tempfile import TemporaryDirectory
 from unittest.mock import MagicMock, Mock, patch
 
 try:
-    from cli.cmd_com.com_impl import can_main, modbus_main, mqtt_main
+    from cli.cmd_com.com_impl import can_main, modbus_main, mqtt_main, telemetry_main
 except ModuleNotFoundError:
     sys.path.insert(0, str(Path(__file__).parents[3]))
-    from cli.cmd_com.com_impl import can_main, modbus_main, mqtt_main
+    from cli.cmd_com.com_impl import can_main, modbus_main, mqtt_main, telemetry_main
 
 
 class TestCANMain(unittest.TestCase):  # pylint: disable=R0902
@@ -569,5 +570,90 @@ class TestMQTTMain(unittest.TestCase):
         )
 
 
+@patch("cli.cmd_com.com_impl.read_config")
+@patch("cli.cmd_com.com_impl.Telemetry")
+@patch("cli.cmd_com.com_impl.File")
+class TestTelemetryMain(unittest.TestCase):
+    """Unit tests for the 'cli.cmd_com.com_impl.telemetry_main' function."""
+
+    def setUp(self) -> None:
+        self.config_path = Path("config.yaml")
+        self.mock_client = MagicMock()
+        self.mock_file_handler = MagicMock()
+        self.record = {
+            "stream": "pack_values",
+            "sequence": 1,
+            "timestamp": 100,
+            "values": {"pack_current_mA": 1},
+        }
+
+    def test_main_normal_flow(
+        self, mock_file: Mock, mock_telemetry: Mock, mock_read_config: Mock
+    ) -> None:
+        """Received records are written as json lines until Ctrl+C."""
+        mock_read_config.return_value = {"host": "127.0.0.1"}
+        self.mock_client.read.side_effect = [Empty, self.record, KeyboardInterrupt]
+        mock_telemetry.return_value = self.mock_client
+        mock_file.return_value = self.mock_file_handler
+
+        with TemporaryDirectory() as tmp_dir, patch("cli.cmd_com.com_impl.secho"):
+            output_path = Path(tmp_dir) / "out" / "output.txt"
+            telemetry_main(self.config_path, output_path)
+            self.assertTrue(output_path.parent.is_dir())
+
+        self.mock_client.start.assert_called_once()
+        self.mock_file_handler.start.assert_called_once()
+        self.mock_file_handler.write.assert_called_once_with(json.dumps(self.record))
+        self.mock_client.shutdown.assert_called_once_with(block=True, timeout=1)
+        self.mock_file_handler.shutdown.assert_called_once_with(block=True, timeout=1)
+
+    def test_main_process_stopped(
+        self, mock_file: Mock, mock_telemetry: Mock, mock_read_config: Mock
+    ) -> None:
+        """The loop ends when the telemetry process has stopped."""
+        mock_read_config.return_value = {"host": "127.0.0.1"}
+        self.mock_client.read.return_value = None
+        mock_telemetry.return_value = self.mock_client
+        mock_file.return_value = self.mock_file_handler
+
+        with TemporaryDirectory() as tmp_dir, patch("cli.cmd_com.com_impl.secho"):
+            telemetry_main(self.config_path, Path(tmp_dir) / "output.txt")
+
+        self.mock_file_handler.write.assert_not_called()
+        self.mock_client.shutdown.assert_called_once_with(block=True, timeout=1)
+
+    @patch("cli.cmd_com.com_impl.recho")
+    def test_main_invalid_config(
+        self,
+        mock_recho: Mock,
+        mock_file: Mock,
+        mock_telemetry: Mock,
+        mock_read_config: Mock,
+    ) -> None:
+        """An invalid configuration leads to sys.exit."""
+        mock_read_config.return_value = {"host": "127.0.0.1", "unknown": 1}
+        with self.assertRaises(SystemExit):
+            telemetry_main(self.config_path, Path("output.txt"))
+        mock_recho.assert_called_once()
+        mock_telemetry.assert_not_called()
+        mock_file.assert_not_called()
+
+    def test_main_childprocesserror(
+        self, mock_file: Mock, mock_telemetry: Mock, mock_read_config: Mock
+    ) -> None:
+        """Test that ChildProcessError during start leads to sys.exit."""
+        mock_read_config.return_value = {"host": "127.0.0.1"}
+        self.mock_client.start.side_effect = ChildProcessError("Process error")
+        mock_telemetry.return_value = self.mock_client
+        mock_file.return_value = self.mock_file_handler
+
+        with (
+            TemporaryDirectory() as tmp_dir,
+            self.assertRaises(SystemExit),
+            patch("cli.cmd_com.com_impl.recho"),
+        ):
+            telemetry_main(self.config_path, Path(tmp_dir) / "output.txt")
+
+
 if __name__ == "__main__":
     unittest.main()
@@ -46,26 +46,47 @@ import unittest
 from contextlib import redirect_stderr, redirect_stdout
 from io import StringIO
 from pathlib import Path
-from tempfile import mkdtemp, mkstemp
+from tempfile import TemporaryDirectory, mkdtemp, mkstemp
 from unittest.mock import Mock, call, mock_open, patch
 
+from can import Message
+from pyarrow.parquet import read_table
+
 try:
     from cli.cmd_etl.cmds.can_decode_helper import (
         can_decode_setup,
+        collect_can_logs,
         get_cantools_database,
+        read_messages,
         run_decode2file,
+        run_decode2parquet,
         run_decode2stdout,
         validate_decode_config,
     )
+    from cli.cmd_etl.etl.can_columnar import (
+        ColumnarDecoder,
+        MessageLayout,
+        SignalLayout,
+    )
+    from cli.helpers.can_log import CANLogWriter
 except ModuleNotFoundError:
     sys.path.insert(0, str(Path(__file__).parents[4]))
     from cli.cmd_etl.cmds.can_decode_helper import (
         can_decode_setup,
+        collect_can_logs,
         get_cantools_database,
+        read_messages,
         run_decode2file,
+        run_decode2parquet,
         run_decode2stdout,
         validate_decode_config,
     )
+    from cli.cmd_etl.etl.can_columnar import (
+        ColumnarDecoder,
+        MessageLayout,
+        SignalLayout,
+    )
+    from cli.helpers.can_log import CANLogWriter
 
 
 class TestCANDecodeSetup(unittest.TestCase):
@@ -170,6 +191,11 @@ class TestValidateDecodeConfig(unittest.TestCase):
             "data_pos": 5,
         }
         self.assertIsNone(validate_decode_config(test_config))
+        # Case 2: time range on a binary CAN log
+        test_config["_input"] = Path("log.fcl")
+        test_config["start"] = 1
+        test_config["stop"] = 2.5
+        self.assertIsNone(validate_decode_config(test_config))
 
     def test_validate_decode_invalid_config(self) -> None:
         """Tests the validate_decode_config method with all possible
@@ -203,6 +229,27 @@ class TestValidateDecodeConfig(unittest.TestCase):
                 },
                 "echo": "'data_pos' is not an integer.",
             },
+            {
+                "config": {
+                    "dbc": Path("test.dbc"),
+                    "timestamp_pos": 0,
+                    "id_pos": 3,
+                    "data_pos": 5,
+                    "_input": Path("log.fcl"),
+                    "stop": "test",
+                },
+                "echo": "'stop' is not a number.",
+            },
+            {
+                "config": {
+                    "dbc": Path("test.dbc"),
+                    "timestamp_pos": 0,
+                    "id_pos": 3,
+                    "data_pos": 5,
+                    "start": 1,
+                },
+                "echo": "'start' and 'stop' are only supported for binary CAN logs",
+            },
         ]
         for i in test_cases:
             with self.subTest(f"Case: {i['echo']}"):
@@ -217,6 +264,55 @@ class TestValidateDecodeConfig(unittest.TestCase):
                 self.assertEqual(cm.exception.code, 1)
 
 
+class TestReadMessages(unittest.TestCase):
+    """Tests for read_messages method"""
+
+    def setUp(self):
+        """Setup needed Mocks"""
+        self.tmpdir = TemporaryDirectory()  # pylint: disable=consider-using-with
+        self.decode_obj = Mock()
+        self.decode_obj.start = None
+        self.decode_obj.stop = None
+
+    def tearDown(self):
+        self.tmpdir.cleanup()
+
+    def test_read_messages_text_file(self) -> None:
+        """Lines of a text file are passed through"""
+        self.decode_obj.input = Path(self.tmpdir.name) / "log.txt"
+        self.decode_obj.input.write_text("line1\nline2\n", encoding="utf-8")
+        self.assertListEqual(
+            ["line1\n", "line2\n"], list(read_messages(self.decode_obj))
+        )
+
+    def test_read_messages_can_log(self) -> None:
+        """Only messages defined in the DBC file and within the time range are
+        read from a binary CAN log"""
+        self.decode_obj.input = Path(self.tmpdir.name) / "log.fcl"
+        self.decode_obj.frame_ids = [0x35C]
+        self.decode_obj.start = 1
+        writer = CANLogWriter(self.decode_obj.input)
+        for i in range(3):
+            writer(Message(timestamp=i, arbitration_id=0x35C, data=[i]))
+            writer(Message(timestamp=i, arbitration_id=0x12A, data=[i]))
+        writer.stop()
+        messages = list(read_messages(self.decode_obj))
+        self.assertEqual([1.0, 2.0], [i.timestamp for i in messages])
+        self.assertEqual({0x35C}, {i.arbitration_id for i in messages})
+
+    def test_read_messages_directory(self) -> None:
+        """Directories are only supported by the columnar decoder"""
+        self.decode_obj.input = Path(self.tmpdir.name)
+        err = io.StringIO()
+        with redirect_stderr(err), self.assertRaises(SystemExit) as cm:
+            list(read_messages(self.decode_obj))
+        self.assertEqual(
+            "Directories as input require the output format 'parquet'.\n",
+            err.getvalue(),
+        )
+        self.assertEqual(cm.exception.code, 1)
+
+
 @patch("sys.stdout", new_callable=StringIO)
 @patch("sys.stdin", new_callable=StringIO)
 class TestRunDecode2Stdout(unittest.TestCase):
@@ -422,5 +518,108 @@ class TestRunDecode2File(unittest.TestCase):
         self.assertEqual(cm.exception.code, 1)
 
 
+class TestRunDecode2Parquet(unittest.TestCase):
+    """Tests for run_decode2parquet method"""
+
+    def setUp(self):
+        """Setup needed Mocks"""
+        self.tmpdir = TemporaryDirectory()  # pylint: disable=consider-using-with
+        self.input = Path(self.tmpdir.name) / "logs"
+        self.input.mkdir()
+        self.decode_obj = Mock()
+        self.decode_obj.input = self.input
+        self.decode_obj.output_directory = Path(self.tmpdir.name) / "out"
+        self.decode_obj.start = None
+        self.decode_obj.stop = None
+        current = SignalLayout("0x35c_Current_mA", 23, 32, True, True, False, 1, 0)
+        self.decoder = ColumnarDecoder({0x35C: MessageLayout("Current", 6, [current])})
+        # two CAN logs, the second one ends before the first one
+        for name, timestamps in (("a.fcl", (2, 3)), ("b.txt", (0, 1))):
+            msgs = [
+                Message(
+                    timestamp=i,
+                    arbitration_id=0x35C,
+                    is_extended_id=False,
+                    data=bytes.fromhex("0004FFFFF4A4"),
+                )
+                for i in timestamps
+            ]
+            if name.endswith(".fcl"):
+                writer = CANLogWriter(self.input / name)
+                for msg in msgs:
+                    writer(msg)
+                writer.stop()
+            else:
+                (self.input / name).write_text(
+                    "".join(f"{i}\n" for i in msgs), encoding="utf-8"
+                )
+
+    def tearDown(self):
+        self.tmpdir.cleanup()
+
+    def test_collect_can_logs(self) -> None:
+        """Binary and text CAN logs of a directory are collected"""
+        (self.input / "c.json").touch()
+        self.assertEqual(
+            [self.input / "a.fcl", self.input / "b.txt"],
+            collect_can_logs(self.input),
+        )
+        self.assertEqual([self.input / "a.fcl"], collect_can_logs(self.input / "a.fcl"))
+
+    def test_run_decode2parquet(self) -> None:
+        """The tables of all CAN logs are merged and sorted by time"""
+        for jobs in (1, 2):
+            with (
+                self.subTest(jobs=jobs),
+                patch.object(ColumnarDecoder, "from_database") as from_database,
+            ):
+                from_database.return_value = self.decoder
+                out = io.StringIO()
+                with redirect_stdout(out):
+                    run_decode2parquet(self.decode_obj, jobs)
+                self.assertEqual(
+                    "Decoded 2 CAN log(s) to 1 table(s).\n", out.getvalue()
+                )
+                table = read_table(self.decode_obj.output_directory / "Current.parquet")
+                self.assertEqual(
+                    {
+                        "Timestamp": [0.0, 1.0, 2.0, 3.0],
+                        "0x35c_Current_mA": [-2908.0] * 4,
+                    },
+                    table.to_pydict(),
+                )
+
+    def test_run_decode2parquet_nothing_decoded(self) -> None:
+        """No table is written if no CAN message could be decoded"""
+        self.decoder = ColumnarDecoder({})
+        err = io.StringIO()
+        with (
+            redirect_stderr(err),
+            patch.object(ColumnarDecoder, "from_database") as from_database,
+        ):
+            from_database.return_value = self.decoder
+            run_decode2parquet(self.decode_obj)
+        self.assertEqual(
+            "No CAN message was decoded. Check configuration file.\n", err.getvalue()
+        )
+        self.assertEqual([], list(self.decode_obj.output_directory.iterdir()))
+
+    def test_run_decode2parquet_invalid_input(self) -> None:
+        """The columnar decoder can not read from stdin or empty directories"""
+        empty = Path(self.tmpdir.name) / "empty"
+        empty.mkdir()
+        for _input, msg in (
+            (None, "The output format 'parquet' requires an input file or directory."),
+            (empty, f"No CAN logs found in '{empty}'."),
+        ):
+            with self.subTest(msg):
+                self.decode_obj.input = _input
+                err = io.StringIO()
+                with redirect_stderr(err), self.assertRaises(SystemExit) as cm:
+                    run_decode2parquet(self.decode_obj)
+                self.assertEqual(f"{msg}\n", err.getvalue())
+                self.assertEqual(cm.exception.code, 1)
+
+
 if __name__ == "__main__":
     unittest.main()
@@ -45,8 +45,11 @@ import unittest
 from contextlib import redirect_stderr, redirect_stdout
 from io import StringIO
 from pathlib import Path
+from tempfile import TemporaryDirectory
 from unittest.mock import MagicMock, Mock, call, mock_open, patch
 
+from can import Message
+
 try:
     from cli.cmd_etl.cmds.can_filter_helper import (
         _sanitize_args,
@@ -54,6 +57,8 @@ try:
         run_filter,
         validate_filter_config,
     )
+    from cli.cmd_etl.etl.can_filter import CANFilter
+    from cli.helpers.can_log import CANLogReader, CANLogWriter
     from cli.helpers.misc import PROJECT_BUILD_ROOT
 except ModuleNotFoundError:
     sys.path.insert(0, str(Path(__file__).parents[4]))
@@ -63,6 +68,8 @@ except ModuleNotFoundError:
         run_filter,
         validate_filter_config,
     )
+    from cli.cmd_etl.etl.can_filter import CANFilter
+    from cli.helpers.can_log import CANLogReader, CANLogWriter
     from cli.helpers.misc import PROJECT_BUILD_ROOT
 
 
@@ -95,6 +102,17 @@ class TestValidateFilterConfig(unittest.TestCase):
         test_config = {"id_pos": 2, "ids": ["130", "140"]}
         self.assertIsNone(validate_filter_config(test_config))
 
+    def test_validate_filter_config_time_range(self) -> None:
+        """Tests the validate_filter_config with a time range on a binary log."""
+        test_config = {
+            "id_pos": 2,
+            "ids": ["130"],
+            "_input": Path("log.fcl"),
+            "start": 1,
+            "stop": 2.5,
+        }
+        self.assertIsNone(validate_filter_config(test_config))
+
     def test_validate_filter_config_invalid_config(self) -> None:
         """Tests the validate_filter_config with all possible cases of an
         invalid config.
@@ -156,6 +174,24 @@ class TestValidateFilterConfig(unittest.TestCase):
                 },
                 "echo": "Defined sampling is not a subset of the ids.",
             },
+            {
+                "config": {
+                    "id_pos": 2,
+                    "ids": ["130"],
+                    "_input": Path("log.fcl"),
+                    "start": "1",
+                },
+                "echo": "'start' is not a number.",
+            },
+            {
+                "config": {
+                    "id_pos": 2,
+                    "ids": ["130"],
+                    "_input": Path("log.txt"),
+                    "stop": 1,
+                },
+                "echo": "'start' and 'stop' are only supported for binary CAN logs",
+            },
         ]
         for i in test_cases:
             with self.subTest(f"Case: {i['echo']}"):
@@ -412,5 +448,63 @@ class TestRunFilter(unittest.TestCase):
         self.assertEqual(cm.exception.code, 1)
 
 
+class TestRunFilterCanLog(unittest.TestCase):
+    """Tests run_filter method with binary CAN logs as input"""
+
+    def setUp(self) -> None:
+        self.tmpdir = TemporaryDirectory()  # pylint: disable=consider-using-with
+        self.input = Path(self.tmpdir.name) / "input.fcl"
+        writer = CANLogWriter(self.input)
+        for i in range(4):
+            writer(Message(timestamp=i, arbitration_id=0x130, data=[i]))
+            writer(Message(timestamp=i, arbitration_id=0x140, data=[i]))
+        writer.stop()
+
+    def tearDown(self) -> None:
+        self.tmpdir.cleanup()
+
+    @patch("sys.stdout", new_callable=StringIO)
+    def test_run_filter_can_log_to_stdout(self, stdout: StringIO) -> None:
+        """Filtered messages are written as text to stdout"""
+        run_filter(CANFilter(ids=["130"], id_pos=3, _input=self.input, stop=2))
+        self.assertEqual(
+            [
+                str(Message(timestamp=0, arbitration_id=0x130, data=[0])),
+                str(Message(timestamp=1, arbitration_id=0x130, data=[1])),
+            ],
+            stdout.getvalue().splitlines(),
+        )
+
+    @patch("sys.stdout", new_callable=StringIO)
+    def test_run_filter_can_log_writing_to_stdout_fails(self, stdout: StringIO):
+        """Writing to stdout fails"""
+        stdout.write = Mock(side_effect=OSError())
+        err = io.StringIO()
+        with redirect_stderr(err), self.assertRaises(SystemExit) as cm:
+            run_filter(CANFilter(ids=["130"], id_pos=3, _input=self.input))
+        self.assertTrue("Could not write to stdout" in err.getvalue())
+        self.assertEqual(cm.exception.code, 1)
+
+    def test_run_filter_can_log_to_text_file(self) -> None:
+        """Filtered messages are written to a text file"""
+        output = Path(self.tmpdir.name) / "output.txt"
+        run_filter(
+            CANFilter(ids=["140"], id_pos=3, _input=self.input, output=output)
+        )
+        self.assertEqual(4, len(output.read_text(encoding="utf-8").splitlines()))
+
+    def test_run_filter_can_log_to_binary_file(self) -> None:
+        """Filtered messages are written to a binary CAN log"""
+        output = Path(self.tmpdir.name) / "output.fcl"
+        run_filter(
+            CANFilter(
+                ids=["140"], id_pos=3, _input=self.input, output=output, start=1
+            )
+        )
+        with CANLogReader(output) as reader:
+            self.assertEqual([0x140], reader.ids)
+            self.assertEqual(3, len(reader))
+
+
 if __name__ == "__main__":
     unittest.main()
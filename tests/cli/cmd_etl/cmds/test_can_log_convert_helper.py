@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Testing file 'cli/cmd_etl/cmds/can_log_convert_helper.py'."""
+
+import sys
+import tempfile
+import unittest
+from contextlib import redirect_stderr, redirect_stdout
+from io import StringIO
+from pathlib import Path
+
+from can import Message
+
+try:
+    from cli.cmd_etl.cmds.can_log_convert_helper import run_can_log_convert
+    from cli.helpers.can_log import CANLogReader, is_can_log
+except ModuleNotFoundError:
+    sys.path.insert(0, str(Path(__file__).parents[4]))
+    from cli.cmd_etl.cmds.can_log_convert_helper import run_can_log_convert
+    from cli.helpers.can_log import CANLogReader, is_can_log
+
+
+class TestRunCanLogConvert(unittest.TestCase):
+    """Tests run_can_log_convert method"""
+
+    def setUp(self) -> None:
+        self.tmpdir = tempfile.TemporaryDirectory()  # pylint: disable=consider-using-with
+        self.root = Path(self.tmpdir.name)
+
+    def tearDown(self) -> None:
+        self.tmpdir.cleanup()
+
+    def test_run_can_log_convert_round_trip(self) -> None:
+        """Text is converted to binary and back"""
+        text_log = self.root / "log.txt"
+        msgs = [
+            Message(timestamp=0.5, arbitration_id=0x240, data=[1, 2, 3]),
+            Message(timestamp=1.5, arbitration_id=0x250, is_extended_id=False),
+        ]
+        text_log.write_text("".join(f"{i}\n" for i in msgs), encoding="utf-8")
+        out = StringIO()
+        with redirect_stdout(out):
+            run_can_log_convert(text_log, self.root / "out" / "log.fcl")
+            run_can_log_convert(self.root / "out" / "log.fcl", self.root / "log2.txt")
+        self.assertEqual("Converted 2 CAN messages.\n" * 2, out.getvalue())
+        self.assertTrue(is_can_log(self.root / "out" / "log.fcl"))
+        with CANLogReader(self.root / "out" / "log.fcl") as reader:
+            self.assertEqual([0x240, 0x250], reader.ids)
+        self.assertEqual(
+            text_log.read_text(encoding="utf-8"),
+            (self.root / "log2.txt").read_text(encoding="utf-8"),
+        )
+
+    def test_run_can_log_convert_empty(self) -> None:
+        """A text file without CAN messages creates a warning"""
+        text_log = self.root / "log.txt"
+        text_log.write_text("no CAN messages\n", encoding="utf-8")
+        err = StringIO()
+        with redirect_stderr(err):
+            run_can_log_convert(text_log, self.root / "log.fcl")
+        self.assertEqual("No CAN message was converted.\n", err.getvalue())
+
+    def test_run_can_log_convert_invalid_binary(self) -> None:
+        """A binary CAN log with an unsupported version can not be converted"""
+        binary_log = self.root / "log.fcl"
+        binary_log.write_bytes(b"FOXCANLG" + b"\xff" * 24)
+        err = StringIO()
+        with redirect_stderr(err), self.assertRaises(SystemExit) as cm:
+            run_can_log_convert(binary_log, self.root / "log.txt")
+        self.assertEqual(cm.exception.code, 1)
+        self.assertIn("unsupported CAN log version", err.getvalue())
+
+
+if __name__ == "__main__":
+    unittest.main()
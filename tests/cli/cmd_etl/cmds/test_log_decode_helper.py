@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Testing file 'cli/cmd_etl/cmds/log_decode_helper.py'."""
+
+import struct
+import sys
+import tempfile
+import unittest
+from contextlib import redirect_stderr, redirect_stdout
+from io import StringIO
+from pathlib import Path
+from unittest.mock import Mock, patch
+
+try:
+    from cli.cmd_etl.cmds.log_decode_helper import (
+        DEFAULT_LOG_CFG_DIR,
+        log_decode_setup,
+        run_log_decode,
+    )
+    from cli.cmd_etl.etl.log_decode import (
+        RECORD_FORMAT,
+        RECORD_SYNC_BYTE,
+        LogDecoder,
+        LogMessageDefinition,
+    )
+except ModuleNotFoundError:
+    sys.path.insert(0, str(Path(__file__).parents[4]))
+    from cli.cmd_etl.cmds.log_decode_helper import (
+        DEFAULT_LOG_CFG_DIR,
+        log_decode_setup,
+        run_log_decode,
+    )
+    from cli.cmd_etl.etl.log_decode import (
+        RECORD_FORMAT,
+        RECORD_SYNC_BYTE,
+        LogDecoder,
+        LogMessageDefinition,
+    )
+
+
+class TestLogDecodeSetup(unittest.TestCase):
+    """Tests log_decode_setup method"""
+
+    @patch("cli.cmd_etl.cmds.log_decode_helper.read_message_definitions")
+    def test_log_decode_setup_default_directory(
+        self, read_message_definitions_mock: Mock
+    ) -> None:
+        """The embedded configuration is used by default"""
+        read_message_definitions_mock.return_value = []
+        decoder = log_decode_setup()
+        read_message_definitions_mock.assert_called_once_with(
+            DEFAULT_LOG_CFG_DIR / "log_cfg.h", DEFAULT_LOG_CFG_DIR / "log_cfg.c"
+        )
+        self.assertIsInstance(decoder, LogDecoder)
+
+    def test_log_decode_setup_invalid_directory(self) -> None:
+        """A missing configuration leads to an error exit"""
+        buf = StringIO()
+        with redirect_stderr(buf), self.assertRaises(SystemExit) as cm:
+            log_decode_setup(Path("does-not-exist"))
+        self.assertEqual(cm.exception.code, 1)
+        self.assertIn("Could not read the log message definitions", buf.getvalue())
+
+
+class TestRunLogDecode(unittest.TestCase):
+    """Tests run_log_decode method"""
+
+    def setUp(self) -> None:
+        self.decoder = LogDecoder([LogMessageDefinition("LOG_MESSAGE_ID_A", 1, "a %u")])
+        self.data = struct.pack(
+            RECORD_FORMAT, RECORD_SYNC_BYTE, 1, 0, 0, 3, 42, 7, 0, 0, 0
+        )
+
+    def test_run_log_decode_to_stdout(self) -> None:
+        """Decoded records and the drop summary are printed"""
+        with tempfile.TemporaryDirectory() as tmp:
+            _input = Path(tmp) / "log.bin"
+            _input.write_bytes(self.data)
+            out = StringIO()
+            err = StringIO()
+            with redirect_stdout(out), redirect_stderr(err):
+                run_log_decode(self.decoder, _input)
+        self.assertEqual(out.getvalue(), "        42     0 a 7\n")
+        self.assertIn("dropped on target: 3", err.getvalue())
+
+    def test_run_log_decode_to_file(self) -> None:
+        """Decoded records are written to the output file"""
+        with tempfile.TemporaryDirectory() as tmp:
+            _input = Path(tmp) / "log.bin"
+            _input.write_bytes(self.data)
+            output = Path(tmp) / "out" / "log.txt"
+            with redirect_stderr(StringIO()):
+                run_log_decode(self.decoder, _input, output)
+            self.assertEqual(
+                output.read_text(encoding="utf-8"), "        42     0 a 7\n"
+            )
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -320,14 +320,24 @@ class TestRunTable(unittest.TestCase):
 
     def test_run_table_no_data_suffix_and_output_suffix(self) -> None:
         """Tests the run_table method with no data suffix and output suffix"""
-        self.table_obj.join = Mock(return_value="join table")
+        self.table_obj.join_files = Mock()
         data = Mock()
         data.suffix = None
         output = Path("output.txt")
-        data.glob = Mock(return_value=["test_file_1.txt", "test_file_2.txt"])
+        data.glob = Mock(
+            side_effect=lambda pattern: (
+                ["test_file_1.txt", "test_file_2.txt"]
+                if pattern.endswith(".json")
+                else ["test_file_3.parquet"]
+            )
+        )
         run_table(self.table_obj, data, output)
-        self.table_obj.join.assert_called_once_with(tables=["test table", "test table"])
-        self.table_obj.save_data.assert_called_once_with({output: "join table"})
+        self.table_obj.join_files.assert_called_once_with(
+            data_files=["test_file_1.txt", "test_file_2.txt", "test_file_3.parquet"],
+            output=output,
+        )
+        self.table_obj.can_to_table.assert_not_called()
+        self.table_obj.save_data.assert_not_called()
 
     @patch("cli.cmd_etl.cmds.table_helper.Path.mkdir")
     def test_run_table_no_data_suffix_and_no_output_suffix(
@@ -340,7 +350,11 @@ class TestRunTable(unittest.TestCase):
         data = Mock()
         data.suffix = None
         data.glob = Mock(
-            return_value=[Path("test_file_1.txt"), Path("test_file_2.txt")]
+            side_effect=lambda pattern: (
+                [Path("test_file_1.txt")]
+                if pattern.endswith(".json")
+                else [Path("test_file_2.txt")]
+            )
         )
         output = Path("etl_test_table_helper_output")
         self.table_obj.save_data = Mock()
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+"""Testing file 'cli/cmd_etl/cmds/trace_decode_helper.py'."""
+
+import struct
+import sys
+import tempfile
+import unittest
+from contextlib import redirect_stderr, redirect_stdout
+from io import StringIO
+from pathlib import Path
+
+try:
+    from cli.cmd_etl.cmds.trace_decode_helper import (
+        format_snapshot,
+        run_trace_decode,
+    )
+    from cli.cmd_etl.etl.trace_decode import (
+        EVENT_FORMAT,
+        HEADER_FORMAT,
+        SNAPSHOT_MAGIC,
+        TASK_FORMAT,
+        EventType,
+        TraceEvent,
+        TraceSnapshot,
+        TraceTask,
+    )
+except ModuleNotFoundError:
+    sys.path.insert(0, str(Path(__file__).parents[4]))
+    from cli.cmd_etl.cmds.trace_decode_helper import (
+        format_snapshot,
+        run_trace_decode,
+    )
+    from cli.cmd_etl.etl.trace_decode import (
+        EVENT_FORMAT,
+        HEADER_FORMAT,
+        SNAPSHOT_MAGIC,
+        TASK_FORMAT,
+        EventType,
+        TraceEvent,
+        TraceSnapshot,
+        TraceTask,
+    )
+
+EXPECTED = (
+    "Snapshot (request, argument 0, 2 events)\n"
+    "        0.00 us  switched in: IDLE\n"
+    "        2.00 us  frozen (request, argument 0)\n"
+    "CPU load:\n"
+    "  IDLE             100.00 %\n"
+)
+
+
+class TestFormatSnapshot(unittest.TestCase):
+    """Tests format_snapshot method"""
+
+    def test_format_snapshot(self) -> None:
+        """Timeline and CPU load are formatted"""
+        snapshot = TraceSnapshot(1, 0, 300000000, {1: TraceTask(1, 0, "IDLE")})
+        snapshot.events = [
+            TraceEvent(100, EventType.TASK_SWITCHED_IN, 1, 0),
+            TraceEvent(700, EventType.FREEZE, 1, 0),
+        ]
+        self.assertEqual(format_snapshot(snapshot), EXPECTED)
+
+
+class TestRunTraceDecode(unittest.TestCase):
+    """Tests run_trace_decode method"""
+
+    def setUp(self) -> None:
+        self.data = struct.pack(HEADER_FORMAT, SNAPSHOT_MAGIC, 1, 1, 1, 2, 300000000, 0)
+        self.data += struct.pack(TASK_FORMAT, 1, 0, b"IDLE")
+        self.data += struct.pack(EVENT_FORMAT, 100, EventType.TASK_SWITCHED_IN, 1, 0)
+        self.data += struct.pack(EVENT_FORMAT, 700, EventType.FREEZE, 1, 0)
+
+    def test_run_trace_decode_to_stdout(self) -> None:
+        """Decoded snapshots are printed"""
+        with tempfile.TemporaryDirectory() as tmp:
+            _input = Path(tmp) / "uart.bin"
+            _input.write_bytes(self.data)
+            out = StringIO()
+            with redirect_stdout(out):
+                run_trace_decode(_input)
+        self.assertEqual(out.getvalue(), EXPECTED)
+
+    def test_run_trace_decode_to_file(self) -> None:
+        """Decoded snapshots are written to the output file"""
+        with tempfile.TemporaryDirectory() as tmp:
+            _input = Path(tmp) / "uart.bin"
+            _input.write_bytes(self.data)
+            output = Path(tmp) / "out" / "trace.txt"
+            run_trace_decode(_input, output)
+            self.assertEqual(output.read_text(encoding="utf-8"), EXPECTED)
+
+    def test_run_trace_decode_no_snapshot(self) -> None:
+        """A capture without a complete snapshot leads to an error exit"""
+        with tempfile.TemporaryDirectory() as tmp:
+            _input = Path(tmp) / "uart.bin"
+            _input.write_bytes(self.data[:-1])
+            buf = StringIO()
+            with redirect_stderr(buf), self.assertRaises(SystemExit) as cm:
+                run_trace_decode(_input)
+        self.assertEqual(cm.exception.code, 1)
+        self.assertIn("No complete trace snapshot found.", buf.getvalue())
+
+
+if __name__ == "__main__":
+    unittest.main()
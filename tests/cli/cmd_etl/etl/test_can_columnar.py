@@ -0,0 +1,258 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Testing file 'cli/cmd_etl/etl/can_columnar.py'."""
+
+import os
+import struct
+import sys
+import unittest
+from pathlib import Path
+from tempfile import TemporaryDirectory, mkstemp
+
+import numpy as np
+from can import Message
+
+try:
+    from cli.cmd_etl.cmds.can_decode_helper import get_cantools_database
+    from cli.cmd_etl.etl.can_columnar import (
+        ColumnarDecoder,
+        MessageLayout,
+        SignalLayout,
+        layouts_from_database,
+        read_records,
+    )
+    from cli.helpers.can_log import RECORD_DTYPE, CANLogWriter
+except ModuleNotFoundError:
+    sys.path.insert(0, str(Path(__file__).parents[4]))
+    from cli.cmd_etl.cmds.can_decode_helper import get_cantools_database
+    from cli.cmd_etl.etl.can_columnar import (
+        ColumnarDecoder,
+        MessageLayout,
+        SignalLayout,
+        layouts_from_database,
+        read_records,
+    )
+    from cli.helpers.can_log import RECORD_DTYPE, CANLogWriter
+
+# same signals as in 'test_can_decode.py'
+CURRENT = SignalLayout(
+    "0x35c_CurrentSensor_SIG_Current_mA", 23, 32, True, True, False, 1, 0
+)
+MUX = SignalLayout("0x241_Mux_None", 3, 4, True, False, False, 1, 0)
+MAX_VOLTAGE = SignalLayout(
+    "0x241_MaximumCellVoltage_mV", 15, 14, True, True, False, 1, 0
+)
+MIN_TEMPERATURE = SignalLayout(
+    "0x241_MinimumCellTemperature_degC", 42, 9, True, True, False, 0.5, 0
+)
+LAYOUTS = {
+    0x35C: MessageLayout("CurrentSensor_Current", 6, [CURRENT]),
+    0x241: MessageLayout(
+        "f_StringMinimumMaximumValues", 8, [], MUX, {0: [MAX_VOLTAGE, MIN_TEMPERATURE]}
+    ),
+}
+
+
+def _words(data: list[bytes]) -> tuple[np.ndarray, np.ndarray]:
+    """Data of the frames as little and big endian words"""
+    raw = np.frombuffer(b"".join(data), dtype=np.uint8).reshape(len(data), 8)
+    return raw.view("<u8").ravel(), raw.view(">u8").ravel().astype(np.uint64)
+
+
+def _records(frames: list[tuple[float, int, int, int, str]]) -> np.ndarray:
+    """Records from (timestamp, id, dlc, flags, data) tuples"""
+    return np.array(
+        [
+            (time, can_id, dlc, flags, 0, tuple(bytes.fromhex(data.ljust(16, "0"))))
+            for time, can_id, dlc, flags, data in frames
+        ],
+        dtype=RECORD_DTYPE,
+    )
+
+
+class TestSignalLayout(unittest.TestCase):
+    """Tests the SignalLayout class"""
+
+    def test_extract_big_endian(self) -> None:
+        """Big endian (Motorola) signals"""
+        le, be = _words([bytes.fromhex("0004FFFFF4A40000")])
+        self.assertEqual([-2908.0], CURRENT.extract(le, be).tolist())
+        le, be = _words([bytes.fromhex("0007F23F8DFC8FE4")])
+        self.assertEqual([0.0], MUX.extract(le, be).tolist())
+        self.assertEqual([508.0], MAX_VOLTAGE.extract(le, be).tolist())
+        self.assertEqual([-110.5], MIN_TEMPERATURE.extract(le, be).tolist())
+
+    def test_extract_little_endian(self) -> None:
+        """Little endian (Intel) signals"""
+        data = struct.pack("<hHi", -2, 0xFFFF, -70000)
+        le, be = _words([data])
+        layouts = [
+            SignalLayout("a", 0, 16, False, True, False, 1, 0),
+            SignalLayout("b", 16, 16, False, False, False, 0.1, -10),
+            SignalLayout("c", 32, 32, False, True, False, 1, 0),
+            SignalLayout("d", 0, 64, False, False, False, 1, 0),
+        ]
+        values = [i.extract(le, be)[0] for i in layouts]
+        self.assertEqual(-2.0, values[0])
+        self.assertAlmostEqual(6543.5, values[1])
+        self.assertEqual(-70000.0, values[2])
+        self.assertEqual(float(int.from_bytes(data, "little")), values[3])
+
+    def test_extract_float(self) -> None:
+        """IEEE float signals"""
+        le, be = _words([struct.pack("<ff", 1.5, -2.25)])
+        self.assertEqual(
+            [-2.25], SignalLayout("a", 32, 32, False, True, True, 1, 0).extract(le, be)
+        )
+        le, be = _words([struct.pack(">d", 3.25)])
+        self.assertEqual(
+            [3.25], SignalLayout("a", 7, 64, True, True, True, 1, 0).extract(le, be)
+        )
+
+
+class TestColumnarDecoder(unittest.TestCase):
+    """Tests the ColumnarDecoder class"""
+
+    def test_decode(self) -> None:
+        """Frames are decoded to one table per message and multiplexer value"""
+        decoder = ColumnarDecoder(LAYOUTS)
+        records = _records(
+            [
+                (0.1, 0x35C, 6, 0, "0004FFFFF4A4"),
+                (0.2, 0x241, 8, 0, "0007F23F8DFC8FE4"),
+                (0.3, 0x35C, 6, 0, "000000000010"),
+                (0.4, 0x35C, 2, 0, "0000"),  # too short
+                (0.5, 0x35C, 6, 2, ""),  # remote frame
+                (0.6, 0x241, 8, 0, "0800000000000000"),  # unknown mux value
+                (0.7, 0x123, 8, 0, "0000000000000000"),  # unknown id
+            ]
+        )
+        tables = decoder.decode(records)
+        self.assertEqual(
+            {"CurrentSensor_Current", "f_StringMinimumMaximumValues_Mux_0"},
+            set(tables),
+        )
+        self.assertEqual(
+            {
+                "Timestamp": [0.1, 0.3],
+                "0x35c_CurrentSensor_SIG_Current_mA": [-2908.0, 16.0],
+            },
+            tables["CurrentSensor_Current"].to_pydict(),
+        )
+        self.assertEqual(
+            {
+                "Timestamp": [0.2],
+                "0x241_MaximumCellVoltage_mV": [508.0],
+                "0x241_MinimumCellTemperature_degC": [-110.5],
+            },
+            tables["f_StringMinimumMaximumValues_Mux_0"].to_pydict(),
+        )
+        self.assertEqual(2, decoder.undecodable)
+
+    def test_decode_file(self) -> None:
+        """Binary and text CAN logs are decoded alike"""
+        msgs = [
+            Message(
+                timestamp=i,
+                arbitration_id=0x35C,
+                is_extended_id=False,
+                data=bytes.fromhex("0004FFFFF4A4"),
+            )
+            for i in range(4)
+        ]
+        decoder = ColumnarDecoder(LAYOUTS)
+        with TemporaryDirectory() as tmpdir:
+            binary = Path(tmpdir) / "log.fcl"
+            text = Path(tmpdir) / "log.txt"
+            writer = CANLogWriter(binary)
+            for msg in msgs:
+                writer(msg)
+            writer.stop()
+            text.write_text("".join(f"{i}\n" for i in msgs), encoding="utf-8")
+            self.assertEqual(4, len(read_records(text)))
+            for file in (binary, text):
+                with self.subTest(file.name):
+                    tables, undecodable = decoder.decode_file(file, start=1, stop=3)
+                    self.assertEqual(0, undecodable)
+                    self.assertEqual(
+                        [1.0, 2.0],
+                        tables["CurrentSensor_Current"].column("Timestamp").to_pylist(),
+                    )
+
+
+class TestLayoutsFromDatabase(unittest.TestCase):
+    """Tests the layouts_from_database function"""
+
+    def test_layouts_from_database(self) -> None:
+        """The layouts are created from the DBC file"""
+        tf, temp_path = mkstemp()
+        with open(tf, mode="w", encoding="utf-8") as f:
+            f.write("BO_ 860 CurrentSensor_Current: 6 Vector__XXX\n")
+            f.write(
+                "SG_ CurrentSensor_SIG_Current : 23|32@0- (1,0)"
+                ' [-2147483648|2147483647] "mA" Vector__XXX\n'
+            )
+            f.write("BO_ 577 f_StringMinimumMaximumValues: 8 Vector__XXX\n")
+            f.write(
+                "SG_ f_StringMinimumMaximumValues_Mux M : 3|4@0+ "
+                '(1,0) [0|0] "" Vector__XXX\n'
+            )
+            f.write(
+                "SG_ MaximumCellVoltage m0 : 15|14@0- (1,0) [-8192|8191]"
+                ' "mV" Vector__XXX\n'
+            )
+            f.write(
+                "SG_ MinimumCellTemperature m0 : 42|9@0- (0.5,0) "
+                '[-128|127.5] "degC" Vector__XXX\n'
+            )
+        layouts = layouts_from_database(get_cantools_database(Path(temp_path)))
+        self.assertEqual([CURRENT], layouts[0x35C].signals)
+        self.assertEqual(6, layouts[0x35C].length)
+        self.assertEqual([], layouts[0x241].signals)
+        self.assertEqual(
+            [MAX_VOLTAGE, MIN_TEMPERATURE],
+            layouts[0x241].multiplexed[0],
+        )
+        self.assertIsNotNone(layouts[0x241].multiplexer)
+        os.remove(temp_path)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -47,6 +47,8 @@ from pathlib import Path
 from tempfile import mkstemp
 from unittest.mock import Mock
 
+from can import Message
+
 try:
     from cli.cmd_etl.cmds.can_decode_helper import get_cantools_database
     from cli.cmd_etl.etl.can_decode import CANDecode
@@ -67,6 +69,9 @@ class TestInit(unittest.TestCase):
         self.assertEqual(test_obj._id_pos, 2)  # pylint: disable=protected-access
         self.assertEqual(test_obj._data_pos, 6)  # pylint: disable=protected-access
         self.assertEqual(test_obj.output_directory, Path())
+        self.assertEqual(test_obj.input, None)
+        self.assertEqual(test_obj.start, None)
+        self.assertEqual(test_obj.stop, None)
 
 
 class TestDecodeMsg(unittest.TestCase):
@@ -218,6 +223,37 @@ class TestHandleDecoding(unittest.TestCase):
         )
         os.remove(temp_path)
 
+    def test_handle_message(self) -> None:
+        """Tests the handle_message method of the CANDecode class with a CAN
+        message read from a binary CAN log
+        """
+        tf, temp_path = mkstemp()
+        with open(tf, mode="w", encoding="utf-8") as f:
+            f.write("BO_ 860 CurrentSensor_Current: 6 Vector__XXX\n")
+            f.write(
+                "SG_ CurrentSensor_SIG_Current : 23|32@0- (1,0)"
+                ' [-2147483648|2147483647] "mA" Vector__XXX\n'
+            )
+        dbc = get_cantools_database(Path(temp_path))
+        test_obj = CANDecode(
+            dbc=dbc, timestamp_pos=0, id_pos=2, data_pos=6, output=Path()
+        )
+        self.assertEqual([0x35C], test_obj.frame_ids)
+        can_msg = Message(
+            timestamp=925.201998,
+            arbitration_id=0x35C,
+            is_extended_id=False,
+            data=[0x00, 0x04, 0xFF, 0xFF, 0xF4, 0xA4],
+        )
+        msg_name, decoded_msg = test_obj.decode_msg(can_msg)
+        self.assertEqual(msg_name, "CurrentSensor_Current")
+        # the CAN id is written as in the text log of 'fox log'
+        self.assertEqual(
+            decoded_msg,
+            '{"Timestamp": 925.201998,"0x35c_CurrentSensor_SIG_Current_mA":-2908}\n',
+        )
+        os.remove(temp_path)
+
 
 class TestDataFormat(unittest.TestCase):
     """Tests the data_format method of the CANDecode class"""
@@ -42,12 +42,17 @@
 import sys
 import unittest
 from pathlib import Path
+from tempfile import TemporaryDirectory
+
+from can import Message
 
 try:
     from cli.cmd_etl.etl.can_filter import CANFilter
+    from cli.helpers.can_log import CANLogReader, CANLogWriter
 except ModuleNotFoundError:
     sys.path.insert(0, str(Path(__file__).parents[4]))
     from cli.cmd_etl.etl.can_filter import CANFilter
+    from cli.helpers.can_log import CANLogReader, CANLogWriter
 
 
 class TestInit(unittest.TestCase):
@@ -65,6 +70,8 @@ class TestInit(unittest.TestCase):
             "_occurrence": {"23A": 0},
             "input": None,
             "output": None,
+            "start": None,
+            "stop": None,
         }
         self.assertDictEqual(test_obj.__dict__, expected_dict)
         self.assertEqual(
@@ -83,6 +90,8 @@ class TestInit(unittest.TestCase):
             "_sampling": None,
             "input": None,
             "output": None,
+            "start": None,
+            "stop": None,
         }
         self.assertDictEqual(test_obj.__dict__, expected_dict)
         self.assertEqual(
@@ -90,6 +99,14 @@ class TestInit(unittest.TestCase):
             "ID pos: 4, IDs: ['23A', '120'], sampling: None",
         )
 
+    def test_can_filter_init_time_range(self) -> None:
+        """Tests the init method of a CANFilter class with a time range"""
+        test_obj = CANFilter(ids=["23A"], id_pos=4, start=1.5, stop=2)
+        self.assertEqual(
+            str(test_obj),
+            "ID pos: 4, IDs: ['23A'], sampling: None, time range: [1.5, 2)",
+        )
+
 
 class TestFilterMsg(unittest.TestCase):
     """Tests the filter_msg method of the CANFilter class"""
@@ -128,6 +145,47 @@ class TestFilterMsg(unittest.TestCase):
         self.assertEqual(can_filter.filter_msg(msg), None)
 
 
+class TestFilterLog(unittest.TestCase):
+    """Tests the filter_log method of the CANFilter class"""
+
+    def setUp(self) -> None:
+        self.tmpdir = TemporaryDirectory()  # pylint: disable=consider-using-with
+        self.log_file = Path(self.tmpdir.name) / "log.fcl"
+        writer = CANLogWriter(self.log_file)
+        for i in range(10):
+            for msg_id in (0x120, 0x130, 0x23A):
+                writer(Message(timestamp=i, arbitration_id=msg_id, data=[i]))
+        writer.stop()
+
+    def tearDown(self) -> None:
+        self.tmpdir.cleanup()
+
+    def test_filter_log_ids(self) -> None:
+        """Only the requested ids are selected"""
+        can_filter = CANFilter(ids=["120", "23A"], id_pos=2)
+        with CANLogReader(self.log_file) as reader:
+            selection = can_filter.filter_log(reader)
+            msg_ids = set(reader.records(selection)["arbitration_id"])
+        self.assertEqual(20, len(selection))
+        self.assertSetEqual({0x120, 0x23A}, msg_ids)
+
+    def test_filter_log_time_range(self) -> None:
+        """Only messages in the time range [start, stop) are selected"""
+        can_filter = CANFilter(ids=["130"], id_pos=2, start=2, stop=5)
+        with CANLogReader(self.log_file) as reader:
+            timestamps = reader.records(can_filter.filter_log(reader))["timestamp"]
+        self.assertListEqual([2.0, 3.0, 4.0], list(timestamps))
+
+    def test_filter_log_with_sampling(self) -> None:
+        """Every n-th message of a sampled id is selected"""
+        can_filter = CANFilter(ids=["120", "130"], id_pos=2, sampling={"130": 3})
+        with CANLogReader(self.log_file) as reader:
+            records = reader.records(can_filter.filter_log(reader))
+        sampled = records[records["arbitration_id"] == 0x130]["timestamp"]
+        self.assertListEqual([2.0, 5.0, 8.0], list(sampled))
+        self.assertEqual(10, sum(records["arbitration_id"] == 0x120))
+
+
 class TestExtendIds(unittest.TestCase):
     """Tests the extend_ids method of the CANFilter class"""
 
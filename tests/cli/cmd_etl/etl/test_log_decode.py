@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Testing file 'cli/cmd_etl/etl/log_decode.py'."""
+
+import struct
+import sys
+import tempfile
+import unittest
+from pathlib import Path
+
+try:
+    from cli.cmd_etl.etl.log_decode import (
+        RECORD_FORMAT,
+        RECORD_SIZE,
+        RECORD_SYNC_BYTE,
+        LogDecoder,
+        LogMessageDefinition,
+        format_arguments,
+        read_message_definitions,
+    )
+except ModuleNotFoundError:
+    sys.path.insert(0, str(Path(__file__).parents[4]))
+    from cli.cmd_etl.etl.log_decode import (
+        RECORD_FORMAT,
+        RECORD_SIZE,
+        RECORD_SYNC_BYTE,
+        LogDecoder,
+        LogMessageDefinition,
+        format_arguments,
+        read_message_definitions,
+    )
+
+PATH_LOG_CFG = Path(__file__).parents[4] / "src/app/engine/config"
+
+DEFINITIONS = [
+    LogMessageDefinition("LOG_MESSAGE_ID_A", 1, "a %u"),
+    LogMessageDefinition("LOG_MESSAGE_ID_B", 2, "b %d %f"),
+]
+
+
+def _record(  # pylint: disable=too-many-arguments,too-many-positional-arguments
+    message_id: int,
+    number_of_arguments: int,
+    sequence: int,
+    arguments: tuple[int, int, int, int] = (0, 0, 0, 0),
+    dropped: int = 0,
+    timestamp: int = 0,
+) -> bytes:
+    """Serializes a record in the same way as the embedded implementation"""
+    return struct.pack(
+        RECORD_FORMAT,
+        RECORD_SYNC_BYTE,
+        number_of_arguments,
+        message_id,
+        sequence,
+        dropped,
+        timestamp,
+        *arguments,
+    )
+
+
+class TestReadMessageDefinitions(unittest.TestCase):
+    """Test of the 'read_message_definitions' function"""
+
+    def test_read_embedded_configuration(self) -> None:
+        """The definitions of the embedded configuration can be read"""
+        definitions = read_message_definitions(
+            PATH_LOG_CFG / "log_cfg.h", PATH_LOG_CFG / "log_cfg.c"
+        )
+        self.assertEqual(definitions[0].name, "LOG_MESSAGE_ID_LOG_STARTED")
+        self.assertTrue(all(i.number_of_arguments <= 4 for i in definitions))
+
+    def test_missing_definition(self) -> None:
+        """A message identifier without a format is reported"""
+        with tempfile.TemporaryDirectory() as tmp:
+            header = Path(tmp) / "log_cfg.h"
+            source = Path(tmp) / "log_cfg.c"
+            header.write_text(
+                "    LOG_MESSAGE_ID_A,\n    LOG_MESSAGE_ID_B,\n"
+                "    LOG_MESSAGE_ID_E_MAX,\n",
+                encoding="utf-8",
+            )
+            source.write_text('    {LOG_MESSAGE_ID_A, 1u, "a %u"},\n', encoding="utf-8")
+            with self.assertRaises(ValueError):
+                read_message_definitions(header, source)
+
+
+class TestFormatArguments(unittest.TestCase):
+    """Test of the 'format_arguments' function"""
+
+    def test_conversions(self) -> None:
+        """All supported conversions are applied"""
+        raw_float = struct.unpack(">I", struct.pack(">f", 1.5))[0]
+        self.assertEqual(
+            format_arguments("%u %d %x %f", (7, 0xFFFFFFFF, 0xAB, raw_float)),
+            "7 -1 ab 1.500000",
+        )
+
+    def test_missing_arguments(self) -> None:
+        """Conversions without argument are kept as they are"""
+        self.assertEqual(format_arguments("%u %u", (1,)), "1 %u")
+
+
+class TestLogDecoder(unittest.TestCase):
+    """Test of the 'LogDecoder' class"""
+
+    def test_decode(self) -> None:
+        """Consecutive records are decoded"""
+        decoder = LogDecoder(DEFINITIONS)
+        data = _record(0, 1, 0, (3, 0, 0, 0), timestamp=10)
+        data += _record(1, 2, 1, (0xFFFFFFFE, 0x3FC00000, 0, 0))
+        records = decoder.decode(data)
+        self.assertEqual([i.text for i in records], ["a 3", "b -2 1.500000"])
+        self.assertEqual(records[0].timestamp, 10)
+        self.assertEqual(
+            str(decoder),
+            "dropped on target: 0, lost in transfer: 0, invalid bytes: 0",
+        )
+
+    def test_resynchronization(self) -> None:
+        """Invalid bytes are skipped until a valid record is found"""
+        decoder = LogDecoder(DEFINITIONS)
+        data = b"\x00\xa5\x07" + _record(0, 1, 0, (1, 0, 0, 0)) + b"\xa5"
+        records = decoder.decode(data)
+        self.assertEqual(len(records), 1)
+        self.assertEqual(decoder.invalid_bytes, 4)
+
+    def test_dropped_and_lost_records(self) -> None:
+        """Dropped records and sequence gaps are counted"""
+        decoder = LogDecoder(DEFINITIONS)
+        data = _record(0, 1, 0xFFFE) + _record(0, 1, 1, dropped=5)
+        records = decoder.decode(data)
+        self.assertEqual(len(records), 2)
+        self.assertEqual(decoder.dropped_records, 5)
+        self.assertEqual(decoder.lost_records, 2)
+        self.assertEqual(RECORD_SIZE, 28)
+
+
+if __name__ == "__main__":
+    unittest.main()
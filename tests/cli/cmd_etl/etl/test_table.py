@@ -43,29 +43,31 @@ import io
 import logging  # noqa: TID251
 import sys
 import unittest
+from collections.abc import Iterator
 from contextlib import redirect_stderr, redirect_stdout
 from datetime import UTC, datetime
 from pathlib import Path
-from tempfile import mkstemp
+from tempfile import TemporaryDirectory, mkstemp
 from unittest.mock import Mock, patch
 
 import pyarrow as pa
 import pyarrow.compute as pc
 import pytz
+from pyarrow.parquet import read_table, write_table
 
 try:
     from cli.cmd_etl.cmds.table_helper import (
         convert_start_date,
         get_output_format_enum,
     )
-    from cli.cmd_etl.etl.table import Table
+    from cli.cmd_etl.etl.table import Table, _TableStream
 except ModuleNotFoundError:
     sys.path.insert(0, str(Path(__file__).parents[4]))
     from cli.cmd_etl.cmds.table_helper import (
         convert_start_date,
         get_output_format_enum,
     )
-    from cli.cmd_etl.etl.table import Table
+    from cli.cmd_etl.etl.table import Table, _TableStream
 
 
 class TestTable(unittest.TestCase):
@@ -188,6 +190,137 @@ class TestJoin(unittest.TestCase):
         )
 
 
+class TestJoinFiles(unittest.TestCase):
+    """Tests the join_files method of the Table class"""
+
+    def setUp(self):
+        """Creates files with decoded CAN messages in JSON and parquet format"""
+        self.tmpdir = TemporaryDirectory()  # pylint: disable=consider-using-with
+        self.start_date = convert_start_date("2024-01-01T00:00:00")
+        current = Path(self.tmpdir.name) / "current.json"
+        timestamps = [0.01, 0.04, 0.06, 0.11, 0.15]
+        values = [100, 200, 300, 400, 500]
+        current.write_text(
+            "".join(
+                f'{{"Timestamp": {t}, "Current_mA": {v}}}\n'
+                for t, v in zip(timestamps, values, strict=True)
+            ),
+            encoding="utf-8",
+        )
+        voltage = Path(self.tmpdir.name) / "voltage.parquet"
+        write_table(
+            pa.table(
+                {
+                    "Timestamp": [0.02, 0.03, 0.04, 0.08, 0.12],
+                    "Voltage_V": [4.2, 4.3, 4.4, 4.5, 4.6],
+                }
+            ),
+            voltage,
+            row_group_size=2,
+        )
+        self.data_files = [current, voltage]
+        self.output = Path(self.tmpdir.name) / "output.parquet"
+
+    def tearDown(self):
+        self.tmpdir.cleanup()
+
+    def test_join_files_equals_join(self) -> None:
+        """The streamed join creates the same table as the join method"""
+        for join_on, tolerance in (
+            ("Current_mA", -100000),
+            ("Current_mA", 30000),
+            ("Voltage_V", -10000),
+            ("ALL", -100000),
+        ):
+            with self.subTest(join_on=join_on, tolerance=tolerance):
+                table_obj = Table(self.start_date, join_on=join_on, tolerance=tolerance)
+                expected = table_obj.join(
+                    [table_obj.can_to_table(i) for i in self.data_files]
+                )
+                with redirect_stdout(io.StringIO()):
+                    table_obj.join_files(self.data_files, self.output)
+                self.assertEqual(expected, read_table(self.output))
+
+    def test_join_files_csv(self) -> None:
+        """The joined table is written chunk by chunk to a csv file"""
+        table_obj = Table(self.start_date, join_on="Current_mA")
+        with redirect_stdout(io.StringIO()):
+            table_obj.join_files(self.data_files, self.output.with_suffix(".csv"))
+        lines = self.output.with_suffix(".csv").read_text(encoding="utf-8")
+        self.assertEqual(
+            [
+                "Date,Current_mA,Voltage_V",
+                "2024-01-01 00:00:00.010000+0000,100.0,",
+                "2024-01-01 00:00:00.040000+0000,200.0,4.4",
+                "2024-01-01 00:00:00.060000+0000,300.0,4.4",
+                "2024-01-01 00:00:00.110000+0000,400.0,4.5",
+                "2024-01-01 00:00:00.150000+0000,500.0,4.6",
+            ],
+            lines.splitlines(),
+        )
+
+    def test_join_files_bounded_buffers(self) -> None:
+        """Only a few chunks of every table are buffered during the join"""
+        for name, column in (("current", "Current_mA"), ("voltage", "Voltage_V")):
+            write_table(
+                pa.table(
+                    {
+                        "Timestamp": [i / 100 for i in range(1000)],
+                        column: [float(i) for i in range(1000)],
+                    }
+                ),
+                Path(self.tmpdir.name) / f"{name}.parquet",
+                row_group_size=10,
+            )
+        data_files = [
+            Path(self.tmpdir.name) / f"{i}.parquet" for i in ("current", "voltage")
+        ]
+        sizes = []
+        fill = _TableStream.fill
+        read_chunks = Table.read_chunks
+
+        def read_small_chunks(table_obj: Table, data: Path) -> Iterator[pa.Table]:
+            for chunk in read_chunks(table_obj, data):
+                for i in range(0, chunk.num_rows, 10):
+                    yield chunk.slice(i, 10)
+
+        def fill_and_record(stream: _TableStream) -> None:
+            fill(stream)
+            sizes.append(stream.buffer.num_rows)
+
+        for join_on, tolerance in (
+            ("Current_mA", -100000),
+            ("Current_mA", 30000),
+            ("Voltage_V", -10000),
+            ("ALL", -100000),
+        ):
+            with self.subTest(join_on=join_on, tolerance=tolerance):
+                sizes.clear()
+                table_obj = Table(self.start_date, join_on=join_on, tolerance=tolerance)
+                with (
+                    patch.object(Table, "read_chunks", read_small_chunks),
+                    patch.object(_TableStream, "fill", fill_and_record),
+                    redirect_stdout(io.StringIO()),
+                ):
+                    table_obj.join_files(data_files, self.output)
+                self.assertEqual(1000, read_table(self.output).num_rows)
+                self.assertLessEqual(max(sizes), 30)
+
+    def test_join_files_invalid_join_on(self) -> None:
+        """The join_on column must be part of one of the tables"""
+        for join_on, msg in (
+            (None, "Combining several tables without 'join_on' parameter"),
+            ("Temperature", "Column 'Temperature' not found in any table."),
+        ):
+            with self.subTest(join_on=join_on):
+                table_obj = Table(self.start_date, join_on=join_on)
+                buf = io.StringIO()
+                with redirect_stderr(buf), self.assertRaises(SystemExit) as cm:
+                    table_obj.join_files(self.data_files, self.output)
+                self.assertIn(msg, buf.getvalue())
+                self.assertEqual(cm.exception.code, 1)
+
+
 class TestCanToTable(unittest.TestCase):
     """Tests the can_to_table method of the Table class"""
 
@@ -233,6 +366,31 @@ class TestCanToTable(unittest.TestCase):
             table_mock.drop.assert_called_once_with("Timestamp")
             cast_columns_mock.assert_called_once_with(drop_table_mock)
 
+    @patch("cli.cmd_etl.etl.table.Table._cast_columns")
+    @patch("cli.cmd_etl.etl.table.Table._add_date")
+    def test_can_to_table_parquet_input(
+        self, add_date_mock: Mock, cast_columns_mock: Mock
+    ):
+        """Tests the can_to_table method with a parquet file of the columnar
+        decoding
+
+        :param add_date_mock: A mock for the _add_date method
+        :param cast_columns_mock: A mock for the _cast_columns_method
+        """
+        table_mock = Mock()
+        add_date_mock.return_value = table_mock
+        with (
+            patch("cli.cmd_etl.etl.table.read_json") as read_json_mock,
+            patch(
+                "cli.cmd_etl.etl.table.read_table", return_value=table_mock
+            ) as read_table_mock,
+        ):
+            self.table_obj.can_to_table(Path("test.parquet"))
+            read_table_mock.assert_called_once_with(Path("test.parquet"))
+            read_json_mock.assert_not_called()
+            add_date_mock.assert_called_once_with(table_mock)
+            cast_columns_mock.assert_called_once_with(table_mock.drop.return_value)
+
 
 class TestSaveData(unittest.TestCase):
     """Tests the save_data method of the Table class
@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+"""Testing file 'cli/cmd_etl/etl/trace_decode.py'."""
+
+import struct
+import sys
+import unittest
+from pathlib import Path
+
+try:
+    from cli.cmd_etl.etl.trace_decode import (
+        EVENT_FORMAT,
+        EVENT_SIZE,
+        HEADER_FORMAT,
+        HEADER_SIZE,
+        ISR_LABEL,
+        SNAPSHOT_FORMAT_VERSION,
+        SNAPSHOT_MAGIC,
+        TASK_FORMAT,
+        TASK_SIZE,
+        EventType,
+        TraceDecoder,
+        TraceEvent,
+        TraceSnapshot,
+        TraceTask,
+    )
+except ModuleNotFoundError:
+    sys.path.insert(0, str(Path(__file__).parents[4]))
+    from cli.cmd_etl.etl.trace_decode import (
+        EVENT_FORMAT,
+        EVENT_SIZE,
+        HEADER_FORMAT,
+        HEADER_SIZE,
+        ISR_LABEL,
+        SNAPSHOT_FORMAT_VERSION,
+        SNAPSHOT_MAGIC,
+        TASK_FORMAT,
+        TASK_SIZE,
+        EventType,
+        TraceDecoder,
+        TraceEvent,
+        TraceSnapshot,
+        TraceTask,
+    )
+
+#: frequency of the cycle counter of the TMS570LC4357 (300 MHz)
+FREQUENCY = 300000000
+
+
+def _snapshot(
+    tasks: list[tuple[int, int, bytes]],
+    events: list[tuple[int, int, int, int]],
+    version: int = SNAPSHOT_FORMAT_VERSION,
+) -> bytes:
+    """Serializes a snapshot in the same way as the embedded implementation"""
+    data = struct.pack(
+        HEADER_FORMAT,
+        SNAPSHOT_MAGIC,
+        version,
+        2,
+        len(tasks),
+        len(events),
+        FREQUENCY,
+        7,
+    )
+    for task in tasks:
+        data += struct.pack(TASK_FORMAT, *task)
+    for event in events:
+        data += struct.pack(EVENT_FORMAT, *event)
+    return data
+
+
+TASKS = [(1, 0, b"IDLE"), (2, 9, b"TaskEngine")]
+EVENTS = [
+    (1000, EventType.TASK_SWITCHED_IN, 1, 0),
+    (4000, EventType.TASK_SWITCHED_IN, 2, 0),
+    (5000, EventType.ISR_ENTER, 0, 0),
+    (6000, EventType.ISR_EXIT, 0, 0),
+    (7000, EventType.NOTIFY_BLOCK, 2, 0),
+    (7000, EventType.TASK_SWITCHED_IN, 1, 0),
+    (11000, EventType.FREEZE, 2, 7),
+]
+
+
+class TestTraceDecoder(unittest.TestCase):
+    """Test of the 'TraceDecoder' class"""
+
+    def test_sizes(self) -> None:
+        """The sizes match the embedded implementation"""
+        self.assertEqual(HEADER_SIZE, 20)
+        self.assertEqual(TASK_SIZE, 16)
+        self.assertEqual(EVENT_SIZE, 8)
+
+    def test_decode(self) -> None:
+        """A snapshot surrounded by other UART data is decoded"""
+        decoder = TraceDecoder()
+        data = b"\xa5\x00log" + _snapshot(TASKS, EVENTS) + b"\xa5"
+        snapshots = decoder.decode(data)
+        self.assertEqual(len(snapshots), 1)
+        snapshot = snapshots[0]
+        self.assertEqual(snapshot.freeze_reason, 2)
+        self.assertEqual(snapshot.freeze_argument, 7)
+        self.assertEqual(snapshot.tasks[2], TraceTask(2, 9, "TaskEngine"))
+        self.assertEqual(snapshot.events[2], TraceEvent(5000, 5, 0, 0))
+        self.assertEqual(decoder.skipped_bytes, 6)
+        self.assertEqual(str(decoder), "skipped bytes: 6, incomplete snapshots: 0")
+
+    def test_incomplete_snapshot(self) -> None:
+        """A truncated snapshot is counted and skipped"""
+        decoder = TraceDecoder()
+        self.assertEqual(decoder.decode(_snapshot(TASKS, EVENTS)[:-1]), [])
+        self.assertEqual(decoder.incomplete_snapshots, 1)
+
+    def test_unsupported_version(self) -> None:
+        """A snapshot with an unknown format version is skipped"""
+        decoder = TraceDecoder()
+        data = _snapshot(TASKS, EVENTS, version=99) + _snapshot(TASKS, EVENTS)
+        snapshots = decoder.decode(data)
+        self.assertEqual(len(snapshots), 1)
+        self.assertEqual(decoder.incomplete_snapshots, 0)
+
+
+class TestTraceSnapshot(unittest.TestCase):
+    """Test of the 'TraceSnapshot' class"""
+
+    def setUp(self) -> None:
+        self.snapshot = TraceDecoder().decode(_snapshot(TASKS, EVENTS))[0]
+
+    def test_describe(self) -> None:
+        """Events are described with the task names"""
+        self.assertEqual(
+            [self.snapshot.describe(i) for i in self.snapshot.events],
+            [
+                "switched in: IDLE",
+                "switched in: TaskEngine",
+                "enter ISR 0",
+                "exit ISR 0",
+                "TaskEngine waits for notification 0",
+                "switched in: IDLE",
+                "frozen (fatal error, argument 7)",
+            ],
+        )
+        self.assertEqual(
+            self.snapshot.describe(TraceEvent(0, EventType.QUEUE_BLOCK_SEND, 5, 0xFF)),
+            "task 5 blocks on send to unknown queue",
+        )
+        self.assertEqual(
+            self.snapshot.describe(TraceEvent(0, EventType.OS_CALL, 5, 1)),
+            "OS_SemaphoreGive returned 1",
+        )
+
+    def test_cpu_load(self) -> None:
+        """The time between the task switches is accounted to the tasks"""
+        self.assertEqual(
+            self.snapshot.cpu_load(),
+            {"IDLE": 70.0, "TaskEngine": 20.0, ISR_LABEL: 10.0},
+        )
+
+    def test_cpu_load_without_task_switch(self) -> None:
+        """Without task switch no load can be calculated"""
+        snapshot = TraceSnapshot(0, 0, FREQUENCY)
+        snapshot.events.append(TraceEvent(0, EventType.FREEZE, 1, 0))
+        self.assertEqual(snapshot.cpu_load(), {})
+
+    def test_to_microseconds(self) -> None:
+        """Cycle counter differences are converted to microseconds"""
+        self.assertEqual(self.snapshot.to_microseconds(300), 1.0)
+
+
+if __name__ == "__main__":
+    unittest.main()
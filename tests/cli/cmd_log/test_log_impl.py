@@ -335,6 +335,35 @@ class TestLogImpl(unittest.TestCase):
         )
         self.assertEqual(ret, 0)
 
+    @patch("cli.cmd_log.log_impl.sleep")
+    @patch("cli.cmd_log.log_impl.log_can_message")
+    @patch("cli.cmd_log.log_impl.SizedRotatingCANLogWriter")
+    @patch("cli.cmd_log.log_impl.Event")
+    @patch("cli.cmd_log.log_impl.Process")
+    # pylint: disable-next=too-many-arguments,too-many-positional-arguments
+    def test_log_success_binary(
+        self,
+        mock_process: MagicMock,
+        mock_event: MagicMock,
+        mock_writer: MagicMock,
+        mock_log_can_message: MagicMock,
+        mock_sleep: MagicMock,
+    ):
+        """Test successfully logging to binary CAN logs"""
+        mock_instance_process = mock_process.return_value
+        mock_instance_process.is_alive.return_value = 0
+        mock_event.return_value.wait.return_value = True
+        mock_log_can_message.side_effect = KeyboardInterrupt
+        mock_sleep.return_value = 0
+        buf = io.StringIO()
+        with redirect_stdout(buf), TemporaryDirectory() as tmpdir:
+            ret = log(MagicMock(), Path(tmpdir), 1000, "binary")
+            mock_writer.assert_called_once_with(
+                base_filename=Path(tmpdir) / "foxBMS_CAN_log.fcl", max_bytes=1000
+            )
+        self.assertEqual("Use Ctrl+C to stop logging.\nShutdown...\n", buf.getvalue())
+        self.assertEqual(ret, 0)
+
 
 if __name__ == "__main__":
     unittest.main()
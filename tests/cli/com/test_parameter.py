@@ -50,6 +50,7 @@ try:
         FileParameter,
         ModbusParameter,
         MQTTParameter,
+        TelemetryParameter,
     )
 except ModuleNotFoundError:
     sys.path.insert(0, str(Path(__file__).parents[3]))
@@ -59,6 +60,7 @@ except ModuleNotFoundError:
         FileParameter,
         ModbusParameter,
         MQTTParameter,
+        TelemetryParameter,
     )
 
 
@@ -125,6 +127,38 @@ class TestMQTTParameter(unittest.TestCase):
         self.assertIsNone(param.password)
 
 
+class TestTelemetryParameter(unittest.TestCase):
+    """Unit tests for the TelemetryParameter dataclass.
+    Checks default values, validation and immutability.
+    """
+
+    def test_defaults_and_immutability(self):
+        """Defaults should be set and the instance should be frozen."""
+        param = TelemetryParameter(host="127.0.0.1")
+        self.assertEqual(param.port, 5005)
+        self.assertEqual(param.subscriptions, {"pack_values": 100})
+        self.assertEqual(param.keep_alive, 1.0)
+        with self.assertRaises(AttributeError):
+            param.host = "something"
+
+    def test_defaults_are_distinct(self):
+        """Default subscriptions should not be shared between instances."""
+        p1 = TelemetryParameter(host="127.0.0.1")
+        p2 = TelemetryParameter(host="127.0.0.1")
+        self.assertIsNot(p1.subscriptions, p2.subscriptions)
+
+    def test_invalid_subscriptions(self):
+        """Unknown streams and invalid periods should be rejected."""
+        with self.assertRaises(ValueError):
+            TelemetryParameter(host="127.0.0.1", subscriptions={"unknown": 100})
+        with self.assertRaises(ValueError):
+            TelemetryParameter(host="127.0.0.1", subscriptions={"pack_values": -1})
+        with self.assertRaises(ValueError):
+            TelemetryParameter(
+                host="127.0.0.1", subscriptions={"pack_values": 0x10000}
+            )
+
+
 class TestCANLoggerParameter(unittest.TestCase):
     """Unit tests for the CANLoggerParameter dataclass.
     Checks default values and custom initialization.
@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Testing file 'cli/com/telemetry_com.py'."""
+
+import socket
+import struct
+import sys
+import unittest
+from pathlib import Path
+from unittest.mock import MagicMock, Mock, patch
+
+try:
+    from cli.com.parameter import ComControl, TelemetryParameter
+    from cli.com.telemetry_com import (
+        COMMAND_SUBSCRIBE,
+        COMMAND_UNSUBSCRIBE,
+        Telemetry,
+        TelemetryProcess,
+        decode_record,
+        encode_request,
+    )
+except ModuleNotFoundError:
+    sys.path.insert(0, str(Path(__file__).parents[3]))
+    from cli.com.parameter import ComControl, TelemetryParameter
+    from cli.com.telemetry_com import (
+        COMMAND_SUBSCRIBE,
+        COMMAND_UNSUBSCRIBE,
+        Telemetry,
+        TelemetryProcess,
+        decode_record,
+        encode_request,
+    )
+
+
+def build_record(stream: int, value_size: int, sequence: int, values: list) -> bytes:
+    """Builds a telemetry record as it is sent by the BMS."""
+    value_format = {2: "h", 4: "i"}[value_size]
+    return struct.pack(
+        f">BBBBHHI{len(values)}{value_format}",
+        0x5A,
+        1,
+        stream,
+        value_size,
+        sequence,
+        len(values),
+        1234,
+        *values,
+    )
+
+
+class TestEncodeRequest(unittest.TestCase):
+    """Tests encode_request()."""
+
+    def test_encode_request(self) -> None:
+        """The request consists of command, stream and big-endian period."""
+        self.assertEqual(
+            encode_request(COMMAND_SUBSCRIBE, "pack_values", 0x0102),
+            b"\x01\x02\x01\x02",
+        )
+        self.assertEqual(
+            encode_request(COMMAND_UNSUBSCRIBE, "cell_voltage", 0),
+            b"\x02\x00\x00\x00",
+        )
+
+
+class TestDecodeRecord(unittest.TestCase):
+    """Tests decode_record()."""
+
+    def test_cell_voltages(self) -> None:
+        """Cell voltages are decoded, invalid values are returned as None."""
+        record = decode_record(build_record(0, 2, 7, [3700, -32768, 3701]))
+        self.assertEqual(
+            record,
+            {
+                "stream": "cell_voltage",
+                "sequence": 7,
+                "timestamp": 1234,
+                "values": [3700, None, 3701],
+            },
+        )
+
+    def test_pack_values(self) -> None:
+        """Pack values are returned with their names."""
+        record = decode_record(build_record(2, 4, 1, [-2, 400000, 399000, -(2**31)]))
+        self.assertEqual(
+            record["values"],
+            {
+                "pack_current_mA": -2,
+                "battery_voltage_mV": 400000,
+                "high_voltage_bus_voltage_mV": 399000,
+                "pack_power_W": None,
+            },
+        )
+
+    def test_invalid_records(self) -> None:
+        """Malformed records raise a ValueError."""
+        valid = build_record(1, 2, 0, [250, 251])
+        with self.assertRaises(ValueError):
+            decode_record(valid[:5])
+        with self.assertRaises(ValueError):
+            decode_record(b"\x00" + valid[1:])
+        with self.assertRaises(ValueError):
+            decode_record(valid[:1] + b"\x02" + valid[2:])
+        with self.assertRaises(ValueError):
+            decode_record(build_record(3, 2, 0, [250]))
+        with self.assertRaises(ValueError):
+            decode_record(valid[:3] + b"\x03" + valid[4:])
+        with self.assertRaises(ValueError):
+            decode_record(valid[:-1])
+
+
+class TestTelemetryRead(unittest.TestCase):
+    """Tests Telemetry.read()."""
+
+    def setUp(self) -> None:
+        self.telemetry = Telemetry(
+            name="test", parameter=TelemetryParameter(host="127.0.0.1")
+        )
+
+    def test_init_registers_process(self) -> None:
+        """Creating Telemetry should register a TelemetryProcess."""
+        self.assertIn("TelemetryProcess", self.telemetry._processes)  # pylint: disable=protected-access
+
+    def test_returns_item_when_available(self) -> None:
+        """When an item is in the output queue, read() should return it."""
+        expected = {"stream": "pack_values"}
+        self.telemetry.is_alive = MagicMock(return_value=True)
+        self.telemetry.control.output.empty = Mock(return_value=False)
+        self.telemetry.control.output.get = MagicMock(return_value=expected)
+        self.assertEqual(self.telemetry.read(), expected)
+
+    def test_returns_none_when_not_alive_and_empty(self) -> None:
+        """When the process is not alive and the queue is empty, None is returned."""
+        self.telemetry.is_alive = MagicMock(return_value=False)
+        self.telemetry.control.output.empty = Mock(return_value=True)
+        self.assertIsNone(self.telemetry.read(block=True, timeout=1))
+
+
+class TestTelemetryProcess(unittest.TestCase):
+    """Tests TelemetryProcess."""
+
+    def setUp(self) -> None:
+        self.control = ComControl()
+        self.parameter = TelemetryParameter(
+            host="127.0.0.1",
+            port=5005,
+            subscriptions={"cell_voltage": 0, "pack_values": 100},
+            keep_alive=0.0,
+        )
+        self.proc = TelemetryProcess("proc", self.control, self.parameter)
+        self.sock = MagicMock(spec=socket.socket)
+        self.proc._socket = self.sock  # pylint: disable=protected-access
+
+    def test_send_requests(self) -> None:
+        """A request is sent for every configured stream."""
+        self.proc._send_requests(COMMAND_SUBSCRIBE)  # pylint: disable=protected-access
+        self.sock.sendto.assert_any_call(b"\x01\x00\x00\x00", ("127.0.0.1", 5005))
+        self.sock.sendto.assert_any_call(b"\x01\x02\x00\x64", ("127.0.0.1", 5005))
+
+    def test_send_requests_without_socket(self) -> None:
+        """Sending without socket raises a TypeError."""
+        self.proc._socket = None  # pylint: disable=protected-access
+        with self.assertRaises(TypeError):
+            self.proc._send_requests(COMMAND_SUBSCRIBE)  # pylint: disable=protected-access
+
+    @patch("cli.com.telemetry_com.logger")
+    def test_receive(self, mock_logger: Mock) -> None:
+        """Valid records are put on the output queue, lost records are logged."""
+        self.control.output = MagicMock()
+
+        datagrams = iter(
+            [
+                (build_record(2, 4, 1, [1, 2, 3, 4]), ("127.0.0.1", 5005)),
+                (build_record(2, 4, 1, [1, 2, 3, 4]), ("10.0.0.1", 5005)),
+                (b"\x00", ("127.0.0.1", 5005)),
+                (build_record(2, 4, 4, [1, 2, 3, 4]), ("127.0.0.1", 5005)),
+            ]
+        )
+
+        def recvfrom(_: int) -> tuple[bytes, tuple[str, int]]:
+            try:
+                return next(datagrams)
+            except StopIteration:
+                self.control.shutdown.set()
+                raise TimeoutError from None
+
+        self.sock.recvfrom.side_effect = recvfrom
+        self.proc._receive()  # pylint: disable=protected-access
+        self.assertEqual(self.control.output.put.call_count, 2)
+        mock_logger.warning.assert_any_call(
+            "Lost %s record(s) of stream '%s'.", 2, "pack_values"
+        )
+        # the subscriptions are renewed in every loop, as keep_alive is 0
+        self.assertEqual(self.sock.sendto.call_count, 10)
+
+    @patch("cli.com.telemetry_com.add_queue_handler")
+    @patch("cli.com.telemetry_com.signal.signal")
+    @patch("cli.com.telemetry_com.socket.socket")
+    def test_run(self, mock_socket: Mock, _: Mock, __: Mock) -> None:
+        """run() opens the socket, unsubscribes on exit and closes the socket."""
+        self.proc._receive = MagicMock(side_effect=OSError)  # pylint: disable=protected-access
+        with patch("cli.com.telemetry_com.logger"):
+            self.proc.run()
+        self.assertTrue(self.control.ready.is_set())
+        self.assertTrue(self.control.shutdown.is_set())
+        mock_socket.return_value.sendto.assert_any_call(
+            b"\x02\x00\x00\x00", ("127.0.0.1", 5005)
+        )
+        mock_socket.return_value.close.assert_called_once()
+
+    def test_unsubscribe_ignores_errors(self) -> None:
+        """Errors during unsubscribing are ignored."""
+        self.sock.sendto.side_effect = OSError
+        self.proc._unsubscribe()  # pylint: disable=protected-access
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -48,11 +48,11 @@ from click.testing import CliRunner
 
 try:
     from cli.cli import main
-    from cli.commands.c_com import can, client, device, modbus, mqtt
+    from cli.commands.c_com import can, client, device, modbus, mqtt, telemetry
 except ModuleNotFoundError:
     sys.path.insert(0, str(Path(__file__).parents[3]))
     from cli.cli import main
-    from cli.commands.c_com import can, client, device, modbus, mqtt
+    from cli.commands.c_com import can, client, device, modbus, mqtt, telemetry
 
 
 class TestCANCommand(unittest.TestCase):
@@ -174,6 +174,28 @@ class TestMQTTCommand(unittest.TestCase):
             mock_main.assert_called_once_with(config_path, input_path, output_path)
 
 
+class TestTelemetryCommand(unittest.TestCase):
+    """Unit tests for the telemetry Click command."""
+
+    @patch("cli.commands.c_com.telemetry_main")
+    def test_telemetry_command_calls_main_and_exits(self, mock_main: Mock) -> None:
+        """Test that the telemetry command calls main with correct arguments and exits."""
+        runner = CliRunner()
+        config_path = Path("test_config.yaml")
+        output_path = Path("test_output.txt")
+
+        # Create the config file for the exists=True option
+        with runner.isolated_filesystem():
+            # pylint: disable=W1514
+            config_path.write_text("host: 127.0.0.1\n")
+            result = runner.invoke(
+                telemetry,
+                ["--config", str(config_path), "--output", str(output_path), "-v"],
+            )
+            self.assertEqual(result.exit_code, 0)
+            mock_main.assert_called_once_with(config_path, output_path)
+
+
 class TestFoxCliMainCommandCom(unittest.TestCase):
     """Test of the 'com-test' command."""
 
@@ -195,6 +217,12 @@ class TestFoxCliMainCommandCom(unittest.TestCase):
         result = runner.invoke(main, ["com-test", "mqtt", "--help"])
         self.assertEqual(result.exit_code, 0)
 
+    def test_cli_com_test_telemetry(self):
+        """Test 'fox.py com-test telemetry --help' command."""
+        runner = CliRunner()
+        result = runner.invoke(main, ["com-test", "telemetry", "--help"])
+        self.assertEqual(result.exit_code, 0)
+
 
 if __name__ == "__main__":
     unittest.main()
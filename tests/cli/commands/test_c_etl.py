@@ -53,9 +53,12 @@ try:
     from cli.cmd_etl.etl.convert import InputFormats
     from cli.commands.c_etl import (
         cmd_convert,
+        cmd_convert_can_log,
         cmd_convert_gamry,
         cmd_convert_graphtec,
         cmd_decode,
+        cmd_decode_log,
+        cmd_decode_trace,
         cmd_filter,
         cmd_table,
     )
@@ -66,9 +69,12 @@ except ModuleNotFoundError:
     from cli.cmd_etl.etl.convert import InputFormats
     from cli.commands.c_etl import (
         cmd_convert,
+        cmd_convert_can_log,
         cmd_convert_gamry,
         cmd_convert_graphtec,
         cmd_decode,
+        cmd_decode_log,
+        cmd_decode_trace,
         cmd_filter,
         cmd_table,
     )
@@ -275,6 +281,9 @@ class TestDecode(unittest.TestCase):
                     "id_pos": 1,
                     "data_pos": 2,
                     "output": None,
+                    "_input": None,
+                    "start": None,
+                    "stop": None,
                 }
             )
             run_decode2stdout_mock.assert_called_once_with(decode_obj_mock)
@@ -320,6 +329,9 @@ class TestDecode(unittest.TestCase):
                     "id_pos": 1,
                     "data_pos": 2,
                     "output": Path(__file__).parent,
+                    "_input": None,
+                    "start": None,
+                    "stop": None,
                 }
             )
             run_decode2stdout_mock.assert_not_called()
@@ -329,6 +341,128 @@ class TestDecode(unittest.TestCase):
         run_decode2stdout_mock.reset_mock()
         run_decode2file_mock.reset_mock()
 
+    @patch("cli.commands.c_etl.run_decode2file")
+    @patch("cli.commands.c_etl.run_decode2stdout")
+    @patch("cli.commands.c_etl.can_decode_setup")
+    def test_cmd_decode_can_log(
+        self,
+        m_can_decode_setup: Mock,
+        run_decode2stdout_mock: Mock,
+        run_decode2file_mock: Mock,
+    ) -> None:
+        """Tests the decode command line interface with a binary CAN log"""
+        runner = CliRunner()
+        with runner.isolated_filesystem():
+            Path("log.fcl").write_bytes(b"")
+            result = runner.invoke(
+                cmd_decode,
+                ["-d", str(Path(__file__)), "-i", "log.fcl", "--start", "1.5"],
+            )
+            config = m_can_decode_setup.call_args[0][0]
+            self.assertEqual(Path("log.fcl"), config["_input"])
+            self.assertEqual(1.5, config["start"])
+            self.assertIsNone(config["stop"])
+            run_decode2stdout_mock.assert_called_once()
+            run_decode2file_mock.assert_not_called()
+            self.assertEqual(result.exit_code, 0)
+
+    @patch("cli.commands.c_etl.run_decode2parquet")
+    @patch("cli.commands.c_etl.run_decode2file")
+    @patch("cli.commands.c_etl.can_decode_setup")
+    def test_cmd_decode_parquet(
+        self,
+        m_can_decode_setup: Mock,
+        run_decode2file_mock: Mock,
+        run_decode2parquet_mock: Mock,
+    ) -> None:
+        """Tests the decode command line interface with the columnar decoder"""
+        decode_obj_mock = Mock(name="decode")
+        m_can_decode_setup.return_value = decode_obj_mock
+        runner = CliRunner()
+        with runner.isolated_filesystem():
+            Path("logs").mkdir()
+            result = runner.invoke(
+                cmd_decode,
+                [
+                    "-d",
+                    str(Path(__file__)),
+                    "-i",
+                    "logs",
+                    "-o",
+                    "out",
+                    "--output-format",
+                    "parquet",
+                    "-j",
+                    "2",
+                ],
+            )
+            config = m_can_decode_setup.call_args[0][0]
+            self.assertEqual(Path("logs"), config["_input"])
+            run_decode2parquet_mock.assert_called_once_with(decode_obj_mock, 2)
+            run_decode2file_mock.assert_not_called()
+            self.assertEqual(result.exit_code, 0)
+
+
+class TestDecodeLog(unittest.TestCase):
+    """Test 'decode-log' command"""
+
+    def test_cmd_decode_log_help(self) -> None:
+        """Test help option"""
+        runner = CliRunner()
+        result = runner.invoke(cmd_decode_log, ["--help"])
+        self.assertEqual(result.exit_code, 0)
+        self.assertTrue("Usage" in result.output)
+
+    @patch("cli.commands.c_etl.run_log_decode")
+    @patch("cli.commands.c_etl.log_decode_setup")
+    def test_cmd_decode_log(
+        self, log_decode_setup_mock: Mock, run_log_decode_mock: Mock
+    ) -> None:
+        """Tests the decode-log command line interface
+
+        :param log_decode_setup_mock: A mock for the LogDecoder setup
+        :param run_log_decode_mock: A mock for the run_log_decode function
+        """
+        decoder_mock = Mock(name="decoder")
+        log_decode_setup_mock.return_value = decoder_mock
+        runner = CliRunner()
+        with runner.isolated_filesystem():
+            Path("log.bin").write_bytes(b"")
+            result = runner.invoke(
+                cmd_decode_log, ["log.bin", "--cfg-dir", ".", "-o", "log.txt"]
+            )
+            log_decode_setup_mock.assert_called_once_with(Path("."))
+            run_log_decode_mock.assert_called_once_with(
+                decoder_mock, Path("log.bin"), Path("log.txt")
+            )
+            self.assertEqual(result.exit_code, 0)
+
+
+class TestDecodeTrace(unittest.TestCase):
+    """Test 'decode-trace' command"""
+
+    def test_cmd_decode_trace_help(self) -> None:
+        """Test help option"""
+        runner = CliRunner()
+        result = runner.invoke(cmd_decode_trace, ["--help"])
+        self.assertEqual(result.exit_code, 0)
+        self.assertTrue("Usage" in result.output)
+
+    @patch("cli.commands.c_etl.run_trace_decode")
+    def test_cmd_decode_trace(self, run_trace_decode_mock: Mock) -> None:
+        """Tests the decode-trace command line interface
+
+        :param run_trace_decode_mock: A mock for the run_trace_decode function
+        """
+        runner = CliRunner()
+        with runner.isolated_filesystem():
+            Path("uart.bin").write_bytes(b"")
+            result = runner.invoke(cmd_decode_trace, ["uart.bin", "-o", "trace.txt"])
+            run_trace_decode_mock.assert_called_once_with(
+                Path("uart.bin"), Path("trace.txt")
+            )
+            self.assertEqual(result.exit_code, 0)
+
 
 class TestFilter(unittest.TestCase):
     """Test 'filter' command"""
@@ -362,6 +496,8 @@ class TestFilter(unittest.TestCase):
                     "sampling": {},
                     "_input": None,
                     "output": None,
+                    "start": None,
+                    "stop": None,
                 }
             )
             run_filter_mock.assert_called_once_with(filter_obj_mock)
@@ -392,11 +528,61 @@ class TestFilter(unittest.TestCase):
                     "sampling": {"240": 10},
                     "_input": None,
                     "output": None,
+                    "start": None,
+                    "stop": None,
                 }
             )
             run_filter_mock.assert_called_once_with(filter_obj_mock)
             self.assertEqual(result.exit_code, 0)
 
+    @patch("cli.commands.c_etl.run_filter")
+    @patch("cli.commands.c_etl.can_filter_setup")
+    def test_cmd_filter_using_time_range(
+        self, setup_mock: Mock, run_filter_mock: Mock
+    ) -> None:
+        """Tests the filter command line interface with a time range
+
+        :param setup_mock: A mock for the CANFilter class setup
+        :param run_filter_mock: A Mock for the run_filter function, which
+            executes the filtering
+        """
+        runner = CliRunner()
+        with runner.isolated_filesystem():
+            Path("log.fcl").write_bytes(b"")
+            result = runner.invoke(
+                cmd_filter,
+                ["log.fcl", "-i", "240", "--start", "1", "--stop", "2.5"],
+            )
+            setup_mock.assert_called_once_with(
+                {
+                    "id_pos": -1,
+                    "ids": ["240"],
+                    "sampling": {},
+                    "_input": Path("log.fcl"),
+                    "output": None,
+                    "start": 1.0,
+                    "stop": 2.5,
+                }
+            )
+            run_filter_mock.assert_called_once_with(setup_mock.return_value)
+            self.assertEqual(result.exit_code, 0)
+
+
+class TestConvertCanLog(unittest.TestCase):
+    """Test 'convert-can-log' command"""
+
+    @patch("cli.commands.c_etl.run_can_log_convert")
+    def test_cmd_convert_can_log(self, run_can_log_convert_mock: Mock) -> None:
+        """Tests the convert-can-log command line interface"""
+        runner = CliRunner()
+        with runner.isolated_filesystem():
+            Path("log.txt").write_text("", encoding="utf-8")
+            result = runner.invoke(cmd_convert_can_log, ["log.txt", "log.fcl"])
+            run_can_log_convert_mock.assert_called_once_with(
+                Path("log.txt"), Path("log.fcl")
+            )
+            self.assertEqual(result.exit_code, 0)
+
 
 class TestTable(unittest.TestCase):
     """Test 'table' command"""
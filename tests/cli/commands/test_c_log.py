@@ -65,6 +65,16 @@ class TestFoxCliMainCommandLog(unittest.TestCase):
         result = runner.invoke(main, ["log"])
         self.assertEqual(0, result.exit_code)
 
+    @patch("cli.commands.c_log.CanBusConfig", MagicMock())
+    @patch("cli.commands.c_log.log_impl")
+    def test_log_binary(self, mock_log_impl):
+        """Test 'fox.py log --file-format binary' command."""
+        mock_log_impl.log.return_value = 0
+        runner = CliRunner()
+        result = runner.invoke(main, ["log", "--file-format", "binary"])
+        self.assertEqual(0, result.exit_code)
+        self.assertEqual("binary", mock_log_impl.log.call_args.args[3])
+
 
 if __name__ == "__main__":
     unittest.main()
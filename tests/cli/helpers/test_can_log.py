@@ -0,0 +1,273 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Testing file 'cli/helpers/can_log.py'."""
+
+import sys
+import tempfile
+import unittest
+from pathlib import Path
+from unittest.mock import patch
+
+from can import Message
+
+try:
+    from cli.helpers.can_log import (
+        HEADER,
+        RECORD,
+        CANLogReader,
+        CANLogWriter,
+        SizedRotatingCANLogWriter,
+        binary_to_text,
+        has_can_log_suffix,
+        is_can_log,
+        parse_text_line,
+        text_to_binary,
+    )
+except ModuleNotFoundError:
+    sys.path.insert(0, str(Path(__file__).parents[3]))
+    from cli.helpers.can_log import (
+        HEADER,
+        RECORD,
+        CANLogReader,
+        CANLogWriter,
+        SizedRotatingCANLogWriter,
+        binary_to_text,
+        has_can_log_suffix,
+        is_can_log,
+        parse_text_line,
+        text_to_binary,
+    )
+
+
+def _messages() -> list[Message]:
+    """CAN messages with 3 ids, one message every 10ms"""
+    msgs = []
+    for i in range(3000):
+        can_id = (0x240, 0x250, 0x1234567)[i % 3]
+        msgs.append(
+            Message(
+                timestamp=i / 100,
+                arbitration_id=can_id,
+                is_extended_id=can_id > 0x7FF,
+                data=[i % 256, 1, 2, 3, 4, 5, 6, 7],
+            )
+        )
+    return msgs
+
+
+class TestCANLog(unittest.TestCase):
+    """Test writing and reading binary CAN logs"""
+
+    def setUp(self) -> None:
+        self.tmpdir = tempfile.TemporaryDirectory()  # pylint: disable=consider-using-with
+        self.root = Path(self.tmpdir.name)
+        self.file = self.root / "log.fcl"
+        self.msgs = _messages()
+
+    def tearDown(self) -> None:
+        self.tmpdir.cleanup()
+
+    def _write(self, msgs: list[Message]) -> None:
+        writer = CANLogWriter(self.file)
+        for msg in msgs:
+            writer(msg)
+        writer.stop()
+        writer.stop()  # stopping twice is fine
+
+    def test_round_trip(self) -> None:
+        """All messages are read back unchanged"""
+        self._write(self.msgs)
+        self.assertTrue(is_can_log(self.file))
+        self.assertTrue(has_can_log_suffix(self.file))
+        with CANLogReader(self.file) as reader:
+            self.assertEqual(3000, len(reader))
+            self.assertEqual([0x240, 0x250, 0x1234567], reader.ids)
+            self.assertTrue(reader.time_sorted)
+            for read, expected in zip(reader.messages(), self.msgs, strict=True):
+                self.assertTrue(read.equals(expected))
+
+    def test_select(self) -> None:
+        """Records are selected by id and time range"""
+        self._write(self.msgs)
+        with CANLogReader(self.file) as reader:
+            selection = reader.select([0x250, 0x333], start=10.005, stop=20)
+            expected = [
+                i
+                for i, msg in enumerate(self.msgs)
+                if msg.arbitration_id == 0x250 and 10.005 <= msg.timestamp < 20
+            ]
+            self.assertListEqual(expected, selection.tolist())
+            self.assertListEqual(
+                list(range(1001, 2000)), reader.select(start=10.005, stop=20).tolist()
+            )
+            self.assertEqual(0, len(reader.select([0x333])))
+            self.assertEqual(0, len(reader.select(start=100)))
+            self.assertEqual(0, len(reader.select(start=5, stop=1)))
+
+    def test_select_unsorted(self) -> None:
+        """Time ranges also work if the timestamps are not sorted"""
+        msgs = list(reversed(self.msgs))
+        self._write(msgs)
+        with CANLogReader(self.file) as reader:
+            self.assertFalse(reader.time_sorted)
+            timestamps = reader.records(reader.select([0x240], 1, 2))["timestamp"]
+        expected = [
+            i.timestamp
+            for i in msgs
+            if i.arbitration_id == 0x240 and 1 <= i.timestamp < 2
+        ]
+        self.assertListEqual(expected, timestamps.tolist())
+
+    def test_recover_without_index(self) -> None:
+        """Files of a writer that was not stopped are still readable"""
+        writer = CANLogWriter(self.file)
+        for msg in self.msgs[:100]:
+            writer(msg)
+        writer._f.flush()  # pylint: disable=protected-access
+        # simulate an incomplete last record
+        with open(self.file, "ab") as f:
+            f.write(b"\x00" * 5)
+        with CANLogReader(self.file) as reader:
+            self.assertEqual(100, len(reader))
+            self.assertEqual([0x240, 0x250, 0x1234567], reader.ids)
+            self.assertTrue(reader.time_sorted)
+            self.assertListEqual(
+                [i for i in range(100) if not i % 3][10:],
+                reader.select([0x240], start=0.3).tolist(),
+            )
+        writer.stop()
+
+    def test_invalid_files(self) -> None:
+        """Files that are not binary CAN logs are rejected"""
+        self.file.write_bytes(b"FOX")
+        with self.assertRaises(ValueError):
+            CANLogReader(self.file)
+        self.file.write_bytes(b"x" * HEADER.size)
+        with self.assertRaises(ValueError):
+            CANLogReader(self.file)
+        self.assertFalse(is_can_log(self.file))
+        self.file.write_bytes(HEADER.pack(b"FOXCANLG", 2, RECORD.size, 0, 0, 0, 0))
+        with self.assertRaisesRegex(ValueError, "unsupported CAN log version"):
+            CANLogReader(self.file)
+        self.assertFalse(is_can_log(self.root / "does-not-exist.fcl"))
+        self.assertFalse(has_can_log_suffix(self.root / "log.txt"))
+        self.assertFalse(has_can_log_suffix(None))
+
+
+class TestSizedRotatingCANLogWriter(unittest.TestCase):
+    """Test the rotating binary CAN log writer"""
+
+    def test_rollover(self) -> None:
+        """A new file is started when the size threshold is exceeded"""
+        with tempfile.TemporaryDirectory() as tmpdir:
+            base = Path(tmpdir) / "log.fcl"
+            writer = SizedRotatingCANLogWriter(base, max_bytes=1000)
+            for msg in _messages()[:100]:
+                writer(msg)
+            writer.stop()
+            rotated = sorted(Path(tmpdir).glob("log_*_#*.fcl"))
+            self.assertEqual(2, writer.rollover_count)
+            self.assertEqual(2, len(rotated))
+            counts = []
+            for file in [*rotated, base]:
+                with CANLogReader(file) as reader:
+                    counts.append(len(reader))
+            self.assertEqual([41, 41, 18], counts)
+
+    def test_no_rollover(self) -> None:
+        """A size threshold of 0 disables the rollover"""
+        with tempfile.TemporaryDirectory() as tmpdir:
+            base = Path(tmpdir) / "log.fcl"
+            writer = SizedRotatingCANLogWriter(base)
+            for msg in _messages()[:100]:
+                writer(msg)
+            writer.stop()
+            self.assertEqual([base], list(Path(tmpdir).iterdir()))
+        with self.assertRaises(ValueError):
+            SizedRotatingCANLogWriter(base, max_bytes=-1)
+
+
+class TestTextFormat(unittest.TestCase):
+    """Test the conversion from and to the text format of 'fox log'"""
+
+    def test_parse_text_line(self) -> None:
+        """Lines written by 'can.Printer' are parsed"""
+        msgs = [
+            Message(timestamp=1.5, arbitration_id=0x240, data=[0, 8, 0, 0x40]),
+            Message(arbitration_id=0x1234567, dlc=2, is_remote_frame=True),
+            Message(arbitration_id=0x1, is_extended_id=False, data=b"ab"),
+            Message(is_error_frame=True, is_rx=False, is_extended_id=False),
+        ]
+        for msg in msgs:
+            with self.subTest(str(msg)):
+                msg.channel = "PCAN_USBBUS1"
+                parsed = parse_text_line(str(msg))
+                msg.channel = None
+                self.assertIsNotNone(parsed)
+                self.assertEqual(str(msg), str(parsed))
+        self.assertIsNone(parse_text_line("no CAN message"))
+        self.assertIsNone(
+            parse_text_line("Timestamp: x.y    ID: 240    S Rx    DL:  0")
+        )
+
+    def test_text_to_binary_and_back(self) -> None:
+        """Converting text to binary and back keeps the text"""
+        with tempfile.TemporaryDirectory() as tmpdir:
+            root = Path(tmpdir)
+            text = "".join(f"{i}\n" for i in _messages()[:50])
+            (root / "in.txt").write_text("header\n" + text, encoding="utf-8")
+            self.assertEqual(50, text_to_binary(root / "in.txt", root / "log.fcl"))
+            self.assertEqual(50, binary_to_text(root / "log.fcl", root / "out.txt"))
+            self.assertEqual(text, (root / "out.txt").read_text(encoding="utf-8"))
+
+    @patch("cli.helpers.can_log.parse_text_line", side_effect=OSError)
+    def test_text_to_binary_closes_output(self, _) -> None:
+        """The binary CAN log is finalized even if the conversion fails"""
+        with tempfile.TemporaryDirectory() as tmpdir:
+            root = Path(tmpdir)
+            (root / "in.txt").write_text("line\n", encoding="utf-8")
+            with self.assertRaises(OSError):
+                text_to_binary(root / "in.txt", root / "log.fcl")
+            with CANLogReader(root / "log.fcl") as reader:
+                self.assertEqual(0, len(reader))
+
+
+if __name__ == "__main__":
+    unittest.main()
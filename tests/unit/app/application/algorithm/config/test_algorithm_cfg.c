@@ -43,7 +43,7 @@
  * @file    test_algorithm_cfg.c
  * @author  foxBMS Team
  * @date    2020-06-30 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -60,6 +60,7 @@
 
 /*========== Includes =======================================================*/
 #include "unity.h"
+#include "Mockcurrent_integration.h"
 #include "Mockdatabase.h"
 #include "Mockmoving_average.h"
 #include "Mockos.h"
@@ -70,6 +71,7 @@
 
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/config")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/current_integration")
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/moving_average")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
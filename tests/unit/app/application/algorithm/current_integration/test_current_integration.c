@@ -0,0 +1,249 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    test_current_integration.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the software charge and energy integration
+ * @details The free running counter is stubbed with a resolution of 1us per
+ *          count, so that the counter values in the tests are the sample
+ *          times in us.
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockdatabase.h"
+#include "Mockmcu.h"
+#include "Mockos.h"
+
+#include "battery_system_cfg.h"
+#include "database_cfg.h"
+
+#include "current_integration.h"
+#include "test_assert_helper.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("current_integration.c")
+
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/current_integration")
+TEST_INCLUDE_PATH("../../src/app/driver/mcu")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** copy of the last database entry that has been written */
+static DATA_BLOCK_CURRENT_INTEGRATION_s test_tableCurrentIntegration = {
+    .header.uniqueId = DATA_BLOCK_ID_CURRENT_INTEGRATION};
+
+/** number of database writes */
+static uint32_t test_numberOfDatabaseWrites = 0u;
+
+static uint32_t TEST_ConvertFrcDifferenceToTimespan_us(uint32_t count, int cmock_num_calls) {
+    return count;
+}
+
+static STD_RETURN_TYPE_e TEST_DataWrite1DataBlock(void *pDataFromSender, int cmock_num_calls) {
+    TEST_ASSERT_EQUAL(
+        DATA_BLOCK_ID_CURRENT_INTEGRATION, ((DATA_BLOCK_CURRENT_INTEGRATION_s *)pDataFromSender)->header.uniqueId);
+    memcpy(&test_tableCurrentIntegration, pDataFromSender, sizeof(DATA_BLOCK_CURRENT_INTEGRATION_s));
+    test_numberOfDatabaseWrites++;
+    return STD_OK;
+}
+
+static void TEST_AddSample(uint8_t stringNumber, int32_t current_mA, uint32_t time_us) {
+    MCU_GetFreeRunningCount_ExpectAndReturn(time_us);
+    OS_GetTickCount_ExpectAndReturn(time_us / 1000u);
+    TEST_ASSERT_EQUAL(STD_OK, CINT_AddCurrentSample(stringNumber, current_mA));
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    TEST_CINT_Reset();
+    memset(&test_tableCurrentIntegration, 0, sizeof(test_tableCurrentIntegration));
+    test_numberOfDatabaseWrites = 0u;
+    MCU_ConvertFrcDifferenceToTimespan_us_Stub(TEST_ConvertFrcDifferenceToTimespan_us);
+    DATA_Write1DataBlock_Stub(TEST_DataWrite1DataBlock);
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testCINT_SetVoltageInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(CINT_SetVoltage(BS_NR_OF_STRINGS, 0));
+}
+
+void testCINT_AddCurrentSampleInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(CINT_AddCurrentSample(BS_NR_OF_STRINGS, 0));
+}
+
+void testCINT_TriggerWithoutSamplesDoesNotWriteDatabase(void) {
+    CINT_Trigger();
+    TEST_ASSERT_EQUAL_UINT32(0u, test_numberOfDatabaseWrites);
+}
+
+void testCINT_ConstantCurrentIsIntegrated(void) {
+    /* 10A at 400V for 10ms: 100mAs and 40Ws */
+    CINT_SetVoltage(0u, 400000);
+    for (uint32_t i = 0u; i <= 10u; i++) {
+        TEST_AddSample(0u, 10000, i * 1000u);
+    }
+    CINT_Trigger();
+
+    TEST_ASSERT_EQUAL_UINT32(1u, test_numberOfDatabaseWrites);
+    TEST_ASSERT_EQUAL_INT64(100, test_tableCurrentIntegration.charge_mAs[0u]);
+    TEST_ASSERT_EQUAL_INT64(40000, test_tableCurrentIntegration.energy_mWs[0u]);
+    TEST_ASSERT_EQUAL_UINT32(11u, test_tableCurrentIntegration.numberOfSamples[0u]);
+    TEST_ASSERT_EQUAL_UINT32(0u, test_tableCurrentIntegration.numberOfGaps[0u]);
+    TEST_ASSERT_EQUAL_UINT32(10u, test_tableCurrentIntegration.timestamp[0u]);
+    TEST_ASSERT_EQUAL_UINT32(11u, test_tableCurrentIntegration.maximumFillLevel);
+}
+
+void testCINT_CurrentRampIsIntegratedWithTrapezoidalRule(void) {
+    /* linear ramp from 0A to -2A within 500ms: -500mAs */
+    CINT_SetVoltage(0u, 100000);
+    TEST_AddSample(0u, 0, 0u);
+    TEST_AddSample(0u, -2000, 500000u);
+    CINT_Trigger();
+
+    TEST_ASSERT_EQUAL_INT64(-500, test_tableCurrentIntegration.charge_mAs[0u]);
+    TEST_ASSERT_EQUAL_INT64(-50000, test_tableCurrentIntegration.energy_mWs[0u]);
+}
+
+void testCINT_SmallCurrentsAreAccumulatedWithoutLoss(void) {
+    /* 1mA for 1ms (1uAs) per interval, 2000 intervals in 20 triggers: 2mAs */
+    uint32_t time_us = 0u;
+    TEST_AddSample(0u, 1, time_us);
+    for (uint32_t trigger = 0u; trigger < 20u; trigger++) {
+        for (uint32_t i = 0u; i < 100u; i++) {
+            time_us += 1000u;
+            TEST_AddSample(0u, 1, time_us);
+        }
+        CINT_Trigger();
+    }
+
+    TEST_ASSERT_EQUAL_INT64(2, test_tableCurrentIntegration.charge_mAs[0u]);
+    TEST_ASSERT_EQUAL_UINT32(2001u, test_tableCurrentIntegration.numberOfSamples[0u]);
+    TEST_ASSERT_EQUAL_UINT32(20u, test_numberOfDatabaseWrites);
+}
+
+void testCINT_VoltageIsSampledAndHeld(void) {
+    /* 1A for 200ms, the voltage steps from 100V to 200V before the last sample: 10Ws + 15Ws */
+    CINT_SetVoltage(0u, 100000);
+    TEST_AddSample(0u, 1000, 0u);
+    TEST_AddSample(0u, 1000, 100000u);
+    CINT_SetVoltage(0u, 200000);
+    TEST_AddSample(0u, 1000, 200000u);
+    CINT_Trigger();
+
+    TEST_ASSERT_EQUAL_INT64(200, test_tableCurrentIntegration.charge_mAs[0u]);
+    TEST_ASSERT_EQUAL_INT64(25000, test_tableCurrentIntegration.energy_mWs[0u]);
+}
+
+void testCINT_LongIntervalsAreNotIntegrated(void) {
+    TEST_AddSample(0u, 1000, 0u);
+    TEST_AddSample(0u, 1000, CINT_MAXIMUM_SAMPLE_INTERVAL_us + 1000u);
+    TEST_AddSample(0u, 1000, CINT_MAXIMUM_SAMPLE_INTERVAL_us + 2000u);
+    CINT_Trigger();
+
+    TEST_ASSERT_EQUAL_INT64(1, test_tableCurrentIntegration.charge_mAs[0u]);
+    TEST_ASSERT_EQUAL_UINT32(1u, test_tableCurrentIntegration.numberOfGaps[0u]);
+    TEST_ASSERT_EQUAL_UINT32(3u, test_tableCurrentIntegration.numberOfSamples[0u]);
+}
+
+void testCINT_CounterOverflowIsDetectedAsGap(void) {
+    /* the free running counter difference is short, but the OS ticks show a long interval */
+    TEST_AddSample(0u, 1000, 0u);
+    MCU_GetFreeRunningCount_ExpectAndReturn(1000u);
+    OS_GetTickCount_ExpectAndReturn(60000u);
+    TEST_ASSERT_EQUAL(STD_OK, CINT_AddCurrentSample(0u, 1000));
+    CINT_Trigger();
+
+    TEST_ASSERT_EQUAL_INT64(0, test_tableCurrentIntegration.charge_mAs[0u]);
+    TEST_ASSERT_EQUAL_UINT32(1u, test_tableCurrentIntegration.numberOfGaps[0u]);
+    TEST_ASSERT_EQUAL_UINT32(60000u, test_tableCurrentIntegration.timestamp[0u]);
+}
+
+void testCINT_FullBufferDropsSamples(void) {
+    for (uint32_t i = 0u; i < CINT_SAMPLE_BUFFER_LENGTH; i++) {
+        TEST_AddSample(0u, 1000, i * 1000u);
+    }
+    /* buffer is full, sample is dropped without reading the time */
+    TEST_ASSERT_EQUAL(STD_NOT_OK, CINT_AddCurrentSample(0u, 1000));
+    CINT_Trigger();
+
+    TEST_ASSERT_EQUAL_UINT32(1u, test_tableCurrentIntegration.droppedSamples);
+    TEST_ASSERT_EQUAL_UINT32(CINT_SAMPLE_BUFFER_LENGTH, test_tableCurrentIntegration.maximumFillLevel);
+    TEST_ASSERT_EQUAL_UINT32(CINT_SAMPLE_BUFFER_LENGTH, test_tableCurrentIntegration.numberOfSamples[0u]);
+
+    /* the buffer is empty again after the trigger */
+    TEST_AddSample(0u, 1000, CINT_SAMPLE_BUFFER_LENGTH * 1000u);
+    CINT_Trigger();
+    TEST_ASSERT_EQUAL_INT64(CINT_SAMPLE_BUFFER_LENGTH, test_tableCurrentIntegration.charge_mAs[0u]);
+}
+
+void testCINT_InitializeRestartsIntegration(void) {
+    TEST_AddSample(0u, 1000, 0u);
+    TEST_AddSample(0u, 1000, 1000u);
+    CINT_Trigger();
+    TEST_ASSERT_EQUAL_INT64(1, test_tableCurrentIntegration.charge_mAs[0u]);
+
+    /* pending samples are discarded */
+    TEST_AddSample(0u, 1000, 2000u);
+    TEST_ASSERT_EQUAL(STD_OK, CINT_Initialize());
+    CINT_Trigger();
+    TEST_ASSERT_EQUAL_UINT32(1u, test_numberOfDatabaseWrites);
+
+    /* the first sample after the initialization only starts the integration */
+    TEST_AddSample(0u, 1000, 10000u);
+    TEST_AddSample(0u, 1000, 12000u);
+    CINT_Trigger();
+    TEST_ASSERT_EQUAL_INT64(2, test_tableCurrentIntegration.charge_mAs[0u]);
+    TEST_ASSERT_EQUAL_UINT32(2u, test_tableCurrentIntegration.numberOfSamples[0u]);
+}
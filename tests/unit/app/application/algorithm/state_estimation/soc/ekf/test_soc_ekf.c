@@ -0,0 +1,341 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    test_soc_ekf.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the per-cell Kalman filter SOC estimation
+ * @details Tests the open-circuit voltage table, the filter step and the
+ *          state estimation API functions
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockbms.h"
+#include "Mockdatabase.h"
+#include "Mockfram.h"
+
+#include "battery_cell_cfg.h"
+#include "soc_ekf_cfg.h"
+
+#include "foxmath.h"
+#include "state_estimation.h"
+#include "test_assert_helper.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("soc_ekf.c")
+TEST_SOURCE_FILE("soe_none.c")
+TEST_SOURCE_FILE("soh_none.c")
+
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/soc/ekf")
+TEST_INCLUDE_PATH("../../src/app/application/bms")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/contactor")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/driver/sps")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+FRAM_SOC_s fram_soc = {0};
+
+/** number of cell blocks used to test the filter step */
+#define TEST_NUMBER_OF_CELL_BLOCKS (2u)
+
+static DATA_BLOCK_SOC_s test_tableSoc                  = {.header.uniqueId = DATA_BLOCK_ID_SOC};
+static DATA_BLOCK_CURRENT_s test_tableCurrent          = {.header.uniqueId = DATA_BLOCK_ID_CURRENT};
+static DATA_BLOCK_CELL_VOLTAGE_s test_tableCellVoltage = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+
+static float_t test_soc_perc[TEST_NUMBER_OF_CELL_BLOCKS]               = {0.0f};
+static float_t test_polarizationVoltage_mV[TEST_NUMBER_OF_CELL_BLOCKS] = {0.0f};
+static float_t test_covarianceSoc[TEST_NUMBER_OF_CELL_BLOCKS]          = {0.0f};
+static float_t test_covarianceCross[TEST_NUMBER_OF_CELL_BLOCKS]        = {0.0f};
+static float_t test_covariancePolarization[TEST_NUMBER_OF_CELL_BLOCKS] = {0.0f};
+
+static const SOC_EKF_CELLS_s test_cells = {
+    .pSoc_perc               = test_soc_perc,
+    .pPolarizationVoltage_mV = test_polarizationVoltage_mV,
+    .pCovarianceSoc          = test_covarianceSoc,
+    .pCovarianceCross        = test_covarianceCross,
+    .pCovariancePolarization = test_covariancePolarization,
+};
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    TEST_SOC_BuildOpenCircuitVoltageTable();
+    for (uint16_t c = 0u; c < TEST_NUMBER_OF_CELL_BLOCKS; c++) {
+        test_soc_perc[c]               = 50.0f;
+        test_polarizationVoltage_mV[c] = 0.0f;
+        test_covarianceSoc[c]          = SOC_EKF_INITIAL_COVARIANCE_SOC_perc2;
+        test_covarianceCross[c]        = 0.0f;
+        test_covariancePolarization[c] = SOC_EKF_INITIAL_COVARIANCE_POLARIZATION_mV2;
+    }
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testSOC_GetOpenCircuitVoltage(void) {
+    float_t slope_mV = 0.0f;
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOC_GetOpenCircuitVoltage(50.0f, NULL_PTR));
+
+    /* table entries are the voltages of the cell lookup table */
+    TEST_ASSERT_EQUAL_FLOAT(4123.0f, TEST_SOC_GetOpenCircuitVoltage(100.0f, &slope_mV));
+    TEST_ASSERT_EQUAL_FLOAT(35.0f, slope_mV);
+    TEST_ASSERT_EQUAL_FLOAT(3636.0f, TEST_SOC_GetOpenCircuitVoltage(50.0f, &slope_mV));
+    TEST_ASSERT_EQUAL_FLOAT(8.0f, slope_mV);
+    TEST_ASSERT_EQUAL_FLOAT(2716.0f, TEST_SOC_GetOpenCircuitVoltage(1.0f, &slope_mV));
+
+    /* interpolation between two entries */
+    TEST_ASSERT_EQUAL_FLOAT(3640.0f, TEST_SOC_GetOpenCircuitVoltage(50.5f, &slope_mV));
+    TEST_ASSERT_EQUAL_FLOAT(8.0f, slope_mV);
+
+    /* 0% is below the lookup table and is extrapolated */
+    TEST_ASSERT_EQUAL_FLOAT(2607.0f, TEST_SOC_GetOpenCircuitVoltage(0.0f, &slope_mV));
+    TEST_ASSERT_EQUAL_FLOAT(109.0f, slope_mV);
+}
+
+void testSOC_GetStep(void) {
+    SOC_EKF_STEP_s step = {0};
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOC_GetStep(NULL_PTR, 0, 1.0f));
+
+    /* no current: only the process noise is added */
+    TEST_SOC_GetStep(&step, 0, 2.0f);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, step.deltaSoc_perc);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, step.seriesVoltageDrop_mV);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, step.polarizationInput_mV);
+    TEST_ASSERT_EQUAL_FLOAT(expf(-2.0f / SOC_EKF_POLARIZATION_TIME_CONSTANT_s), step.polarizationDecay);
+    TEST_ASSERT_EQUAL_FLOAT(2.0f * SOC_EKF_PROCESS_NOISE_SOC_perc2, step.processNoiseSoc_perc2);
+    TEST_ASSERT_EQUAL_FLOAT(2.0f * SOC_EKF_PROCESS_NOISE_POLARIZATION_mV2, step.processNoisePolarization_mV2);
+
+    /* 1C for 36s is 1% of the capacity */
+    TEST_SOC_GetStep(&step, (int32_t)BC_CAPACITY_mAh, 36.0f);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f * BS_CURRENT_DIRECTION_FLOAT, step.deltaSoc_perc);
+    TEST_ASSERT_EQUAL_FLOAT(
+        (float_t)BC_CAPACITY_mAh * SOC_EKF_SERIES_RESISTANCE_mOhm * BS_CURRENT_DIRECTION_FLOAT / 1000.0f,
+        step.seriesVoltageDrop_mV);
+}
+
+void testSOC_UpdateCells(void) {
+    SOC_EKF_STEP_s step                                = {0};
+    int16_t cellVoltage_mV[TEST_NUMBER_OF_CELL_BLOCKS] = {3840, 3840};
+    /* the second cell block has an invalid measurement */
+    const BITSET_WORD_t invalidCellVoltage = 0x2u;
+
+    TEST_ASSERT_FAIL_ASSERT(
+        TEST_SOC_UpdateCells(NULL_PTR, &test_cells, cellVoltage_mV, invalidCellVoltage, TEST_NUMBER_OF_CELL_BLOCKS));
+    TEST_ASSERT_FAIL_ASSERT(
+        TEST_SOC_UpdateCells(&step, NULL_PTR, cellVoltage_mV, invalidCellVoltage, TEST_NUMBER_OF_CELL_BLOCKS));
+    TEST_ASSERT_FAIL_ASSERT(
+        TEST_SOC_UpdateCells(&step, &test_cells, NULL_PTR, invalidCellVoltage, TEST_NUMBER_OF_CELL_BLOCKS));
+    TEST_ASSERT_FAIL_ASSERT(
+        TEST_SOC_UpdateCells(&step, &test_cells, cellVoltage_mV, invalidCellVoltage, BITSET_BITS_PER_WORD + 1u));
+
+    /* a cell at rest with 3840mV is at 70%: the estimation converges from 50%
+     * towards 70%, the cell with the invalid measurement keeps its SOC */
+    TEST_SOC_GetStep(&step, 0, 1.0f);
+    for (uint16_t i = 0u; i < 100u; i++) {
+        TEST_SOC_UpdateCells(&step, &test_cells, cellVoltage_mV, invalidCellVoltage, TEST_NUMBER_OF_CELL_BLOCKS);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 70.0f, test_soc_perc[0]);
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, test_soc_perc[1]);
+    /* the uncertainty of the corrected cell is reduced */
+    TEST_ASSERT_TRUE(test_covarianceSoc[0] < test_covarianceSoc[1]);
+
+    /* the SOC is limited to 100% */
+    test_soc_perc[0]  = 99.9f;
+    cellVoltage_mV[0] = 4200;
+    TEST_SOC_UpdateCells(&step, &test_cells, cellVoltage_mV, invalidCellVoltage, TEST_NUMBER_OF_CELL_BLOCKS);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, test_soc_perc[0]);
+}
+
+void testSOC_PredictCells(void) {
+    SOC_EKF_STEP_s step = {0};
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOC_PredictCells(NULL_PTR, &test_cells, TEST_NUMBER_OF_CELL_BLOCKS));
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOC_PredictCells(&step, NULL_PTR, TEST_NUMBER_OF_CELL_BLOCKS));
+
+    /* 1C for 36s in discharge direction is 1% of the capacity */
+    TEST_SOC_GetStep(&step, (int32_t)BC_CAPACITY_mAh * (int32_t)BS_CURRENT_DIRECTION_FLOAT, 36.0f);
+    TEST_SOC_PredictCells(&step, &test_cells, TEST_NUMBER_OF_CELL_BLOCKS);
+    for (uint16_t c = 0u; c < TEST_NUMBER_OF_CELL_BLOCKS; c++) {
+        TEST_ASSERT_EQUAL_FLOAT(49.0f, test_soc_perc[c]);
+        TEST_ASSERT_TRUE(test_polarizationVoltage_mV[c] > 0.0f);
+        TEST_ASSERT_TRUE(test_covarianceSoc[c] > SOC_EKF_INITIAL_COVARIANCE_SOC_perc2);
+    }
+
+    /* the SOC is limited to 0% */
+    test_soc_perc[0] = 0.5f;
+    TEST_SOC_PredictCells(&step, &test_cells, TEST_NUMBER_OF_CELL_BLOCKS);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_soc_perc[0]);
+}
+
+void testSOC_UpdateNvmValues(void) {
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOC_UpdateNvmValues(&test_tableSoc, BS_NR_OF_STRINGS));
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOC_UpdateNvmValues(NULL_PTR, 0u));
+
+    test_tableSoc.averageSoc_perc[0u]        = 1.0f;
+    test_tableSoc.minimumSoc_perc[0u]        = 2.0f;
+    test_tableSoc.maximumSoc_perc[0u]        = 3.0f;
+    test_tableSoc.chargeThroughput_As[0u]    = 4.0f;
+    test_tableSoc.dischargeThroughput_As[0u] = 5.0f;
+    TEST_SOC_UpdateNvmValues(&test_tableSoc, 0u);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, fram_soc.averageSoc_perc[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(2.0f, fram_soc.minimumSoc_perc[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, fram_soc.maximumSoc_perc[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(4.0f, fram_soc.chargeThroughput_As[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(5.0f, fram_soc.dischargeThroughput_As[0u]);
+}
+
+void testSE_CalculateStateOfChargeNotInitialized(void) {
+    TEST_ASSERT_FAIL_ASSERT(SE_CalculateStateOfCharge(NULL_PTR));
+    /* nothing is read or written before the initialization */
+    TEST_ASSERT_EQUAL(false, TEST_SOC_GetSocStateInitialized());
+    SE_CalculateStateOfCharge(&test_tableSoc);
+}
+
+void testSE_InitializeStateOfCharge(void) {
+    TEST_ASSERT_FAIL_ASSERT(SE_InitializeStateOfCharge(NULL_PTR, true, 0u));
+    TEST_ASSERT_FAIL_ASSERT(SE_InitializeStateOfCharge(&test_tableSoc, true, BS_NR_OF_STRINGS));
+
+    /* all cell blocks start from the voltage based SOC, only the last cell
+     * block has an invalid measurement and starts from the stored SOC */
+    test_tableCellVoltage.header.timestamp = 10u;
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        for (uint8_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_MODULE; c++) {
+            test_tableCellVoltage.cellVoltage_mV[0u][m][c] = 3636;
+        }
+        test_tableCellVoltage.invalidCellVoltage[0u][m] = 0u;
+    }
+    test_tableCellVoltage.invalidCellVoltage[0u][BS_NR_OF_MODULES_PER_STRING - 1u] =
+        (1u << (BS_NR_OF_CELL_BLOCKS_PER_MODULE - 1u));
+    test_tableCurrent.timestamp[0u]     = 5u;
+    fram_soc.averageSoc_perc[0u]        = 20.0f;
+    fram_soc.chargeThroughput_As[0u]    = 1.0f;
+    fram_soc.dischargeThroughput_As[0u] = 2.0f;
+
+    DATA_Read2DataBlocks_ExpectAndReturn(&test_tableCurrent, &test_tableCellVoltage, STD_OK);
+    DATA_Read2DataBlocks_ReturnThruPtr_pDataToReceiver0(&test_tableCurrent);
+    DATA_Read2DataBlocks_ReturnThruPtr_pDataToReceiver1(&test_tableCellVoltage);
+    FRAM_ReadData_ExpectAndReturn(FRAM_BLOCK_ID_SOC, FRAM_ACCESS_OK);
+    SE_InitializeStateOfCharge(&test_tableSoc, false, 0u);
+
+    TEST_ASSERT_EQUAL(true, TEST_SOC_GetSocStateInitialized());
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, TEST_SOC_GetCellStateOfCharge(0u));
+    TEST_ASSERT_EQUAL_FLOAT(20.0f, TEST_SOC_GetCellStateOfCharge(BS_NR_OF_CELL_BLOCKS_PER_STRING - 1u));
+    TEST_ASSERT_EQUAL_FLOAT(20.0f, test_tableSoc.minimumSoc_perc[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, test_tableSoc.maximumSoc_perc[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, test_tableSoc.chargeThroughput_As[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(2.0f, test_tableSoc.dischargeThroughput_As[0u]);
+}
+
+void testSE_CalculateStateOfCharge(void) {
+    /* no new current measurement: the SOC is not changed */
+    DATA_Read2DataBlocks_ExpectAndReturn(&test_tableCurrent, &test_tableCellVoltage, STD_OK);
+    DATA_Read2DataBlocks_ReturnThruPtr_pDataToReceiver0(&test_tableCurrent);
+    DATA_Read2DataBlocks_ReturnThruPtr_pDataToReceiver1(&test_tableCellVoltage);
+    FRAM_RequestWrite_Expect(FRAM_BLOCK_ID_SOC);
+    SE_CalculateStateOfCharge(&test_tableSoc);
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, TEST_SOC_GetCellStateOfCharge(0u));
+
+    /* new current measurement without new cell voltages: 1C discharge for
+     * 36s reduces the SOC of all cell blocks by 1% */
+    test_tableCurrent.timestamp[0u]  = 36005u;
+    test_tableCurrent.current_mA[0u] = (int32_t)BC_CAPACITY_mAh * (int32_t)BS_CURRENT_DIRECTION_FLOAT;
+    DATA_Read2DataBlocks_ExpectAndReturn(&test_tableCurrent, &test_tableCellVoltage, STD_OK);
+    DATA_Read2DataBlocks_ReturnThruPtr_pDataToReceiver0(&test_tableCurrent);
+    DATA_Read2DataBlocks_ReturnThruPtr_pDataToReceiver1(&test_tableCellVoltage);
+    BMS_GetCurrentFlowDirection_ExpectAndReturn(test_tableCurrent.current_mA[0u], BMS_DISCHARGING);
+    FRAM_RequestWrite_Expect(FRAM_BLOCK_ID_SOC);
+    SE_CalculateStateOfCharge(&test_tableSoc);
+    TEST_ASSERT_EQUAL_FLOAT(49.0f, TEST_SOC_GetCellStateOfCharge(0u));
+    TEST_ASSERT_EQUAL_FLOAT(19.0f, test_tableSoc.minimumSoc_perc[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(49.0f, test_tableSoc.maximumSoc_perc[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(2.0f + (float_t)BC_CAPACITY_mAh * 0.036f, test_tableSoc.dischargeThroughput_As[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(49.0f, fram_soc.maximumSoc_perc[0u]);
+
+    /* new current and cell voltage measurement: the measured cell blocks are
+     * corrected towards the voltage based SOC */
+    test_tableCurrent.timestamp[0u]        = 37005u;
+    test_tableCurrent.current_mA[0u]       = 0;
+    test_tableCellVoltage.header.timestamp = 37000u;
+    DATA_Read2DataBlocks_ExpectAndReturn(&test_tableCurrent, &test_tableCellVoltage, STD_OK);
+    DATA_Read2DataBlocks_ReturnThruPtr_pDataToReceiver0(&test_tableCurrent);
+    DATA_Read2DataBlocks_ReturnThruPtr_pDataToReceiver1(&test_tableCellVoltage);
+    BMS_GetCurrentFlowDirection_ExpectAndReturn(0, BMS_AT_REST);
+    FRAM_RequestWrite_Expect(FRAM_BLOCK_ID_SOC);
+    SE_CalculateStateOfCharge(&test_tableSoc);
+    TEST_ASSERT_TRUE(TEST_SOC_GetCellStateOfCharge(0u) > 49.0f);
+    TEST_ASSERT_EQUAL_FLOAT(19.0f, TEST_SOC_GetCellStateOfCharge(BS_NR_OF_CELL_BLOCKS_PER_STRING - 1u));
+
+    /* invalid current measurement: the SOC is not changed */
+    test_tableCurrent.timestamp[0u]          = 38005u;
+    test_tableCurrent.invalidMeasurement[0u] = 1u;
+    const float_t soc_perc                   = TEST_SOC_GetCellStateOfCharge(0u);
+    DATA_Read2DataBlocks_ExpectAndReturn(&test_tableCurrent, &test_tableCellVoltage, STD_OK);
+    DATA_Read2DataBlocks_ReturnThruPtr_pDataToReceiver0(&test_tableCurrent);
+    DATA_Read2DataBlocks_ReturnThruPtr_pDataToReceiver1(&test_tableCellVoltage);
+    FRAM_RequestWrite_Expect(FRAM_BLOCK_ID_SOC);
+    SE_CalculateStateOfCharge(&test_tableSoc);
+    TEST_ASSERT_EQUAL_FLOAT(soc_perc, TEST_SOC_GetCellStateOfCharge(0u));
+}
+
+void testSE_GetStateOfChargeFromVoltage(void) {
+    /* LUT values*/
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, SE_GetStateOfChargeFromVoltage(4123));
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, SE_GetStateOfChargeFromVoltage(3636));
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, SE_GetStateOfChargeFromVoltage(2716));
+    /* Minimum value */
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, SE_GetStateOfChargeFromVoltage(2700));
+    /* Maximum value */
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, SE_GetStateOfChargeFromVoltage(4200));
+}
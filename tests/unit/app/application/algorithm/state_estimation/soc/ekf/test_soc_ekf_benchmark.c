@@ -0,0 +1,178 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    test_soc_ekf_benchmark.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Host benchmark of the per-cell Kalman filter SOC estimation
+ * @details The test is built with #SOC_EKF_MAXIMUM_NUMBER_OF_CELL_BLOCKS
+ *          cell blocks (see the unit test project configuration) and measures
+ *          the execution time of #SE_CalculateStateOfCharge() on the host.
+ *          The host time is scaled with
+ *          #TEST_SOC_EKF_HOST_TO_TARGET_FACTOR to the target and compared
+ *          against #SOC_EKF_MAXIMUM_EXECUTION_TIME_us.
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockbms.h"
+#include "Mockdatabase.h"
+#include "Mockfram.h"
+
+#include "soc_ekf_cfg.h"
+
+#include "state_estimation.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("soc_ekf.c")
+TEST_SOURCE_FILE("soe_none.c")
+TEST_SOURCE_FILE("soh_none.c")
+
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/soc/ekf")
+TEST_INCLUDE_PATH("../../src/app/application/bms")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/contactor")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/driver/sps")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+#if (BS_NR_OF_CELL_BLOCKS != SOC_EKF_MAXIMUM_NUMBER_OF_CELL_BLOCKS)
+#error "The benchmark has to be built with the maximum number of cell blocks."
+#endif
+
+/**
+ * @brief   Ratio of the execution time on the target (TMS570LC4357, 300MHz)
+ *          to the execution time of the unit test build on the host
+ * @details Estimate for the unoptimized, instrumented unit test build on a
+ *          x86-64 development machine. The filter step needs roughly 100
+ *          cycles per cell block on the target, which is below the scaled
+ *          host time.
+ */
+#define TEST_SOC_EKF_HOST_TO_TARGET_FACTOR (20.0)
+
+/** number of measured estimation steps */
+#define TEST_SOC_EKF_NUMBER_OF_STEPS (200u)
+
+FRAM_SOC_s fram_soc = {0};
+
+static DATA_BLOCK_SOC_s test_tableSoc                  = {.header.uniqueId = DATA_BLOCK_ID_SOC};
+static DATA_BLOCK_CURRENT_s test_tableCurrent          = {.header.uniqueId = DATA_BLOCK_ID_CURRENT};
+static DATA_BLOCK_CELL_VOLTAGE_s test_tableCellVoltage = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+
+/** provides a new current and cell voltage measurement on every call */
+static STD_RETURN_TYPE_e TEST_DATA_Read2DataBlocks(void *pDataToReceiver0, void *pDataToReceiver1, int numCalls) {
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        test_tableCurrent.timestamp[s]  = 1000u * ((uint32_t)numCalls + 1u);
+        test_tableCurrent.current_mA[s] = ((numCalls % 2) == 0) ? 20000 : -20000;
+    }
+    test_tableCellVoltage.header.timestamp = test_tableCurrent.timestamp[0u];
+    (void)memcpy(pDataToReceiver0, &test_tableCurrent, sizeof(test_tableCurrent));
+    (void)memcpy(pDataToReceiver1, &test_tableCellVoltage, sizeof(test_tableCellVoltage));
+    return STD_OK;
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint8_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_MODULE; c++) {
+                test_tableCellVoltage.cellVoltage_mV[s][m][c] = (int16_t)(3600 + c);
+            }
+            test_tableCellVoltage.invalidCellVoltage[s][m] = 0u;
+        }
+    }
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testSE_CalculateStateOfChargeExecutionTime(void) {
+    DATA_Read2DataBlocks_Stub(TEST_DATA_Read2DataBlocks);
+    FRAM_ReadData_IgnoreAndReturn(FRAM_ACCESS_OK);
+    FRAM_RequestWrite_Ignore();
+    BMS_GetCurrentFlowDirection_IgnoreAndReturn(BMS_DISCHARGING);
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        SE_InitializeStateOfCharge(&test_tableSoc, false, s);
+    }
+
+    const clock_t start = clock();
+    for (uint16_t i = 0u; i < TEST_SOC_EKF_NUMBER_OF_STEPS; i++) {
+        SE_CalculateStateOfCharge(&test_tableSoc);
+    }
+    const clock_t stop = clock();
+
+    const double host_us = (((double)(stop - start) * 1000000.0) / (double)CLOCKS_PER_SEC) /
+                           (double)TEST_SOC_EKF_NUMBER_OF_STEPS;
+    const double target_us = host_us * TEST_SOC_EKF_HOST_TO_TARGET_FACTOR;
+    char message[120]      = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "%u cell blocks: %.2fus per step on the host, %.0fus estimated on the target (budget %uus)",
+        (unsigned int)BS_NR_OF_CELL_BLOCKS,
+        host_us,
+        target_us,
+        (unsigned int)SOC_EKF_MAXIMUM_EXECUTION_TIME_us);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE_MESSAGE(target_us <= (double)SOC_EKF_MAXIMUM_EXECUTION_TIME_us, message);
+
+    /* the estimation still yields plausible values at this size */
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        TEST_ASSERT_TRUE(test_tableSoc.minimumSoc_perc[s] >= 0.0f);
+        TEST_ASSERT_TRUE(test_tableSoc.maximumSoc_perc[s] <= 100.0f);
+        TEST_ASSERT_TRUE(test_tableSoc.minimumSoc_perc[s] <= test_tableSoc.maximumSoc_perc[s]);
+    }
+}
@@ -43,7 +43,7 @@
  * @file    test_soc_lookup-table.c
  * @author  foxBMS Team
  * @date    2025-07-07 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -115,7 +115,7 @@ void testSE_CalculateStateOfCharge(void) {
     static DATA_BLOCK_SOC_s tableMinMaxTimestampMismatch = {
         .header.uniqueId = DATA_BLOCK_ID_MIN_MAX, .header.timestamp = 10};
     DATA_Read1DataBlock_ReturnThruPtr_pDataToReceiver0(&tableMinMaxTimestampMismatch);
-    FRAM_WriteData_ExpectAndReturn(FRAM_BLOCK_ID_SOC, FRAM_ACCESS_OK);
+    FRAM_RequestWrite_Expect(FRAM_BLOCK_ID_SOC);
     SE_CalculateStateOfCharge(&cp_pTableSoc);
 }
 void testSE_GetStateOfChargeFromVoltage(void) {
@@ -0,0 +1,342 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    test_sof_prediction.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the per-cell SOF prediction
+ * @details TODO
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockbms.h"
+#include "Mockdatabase.h"
+
+#include "sof_prediction_cfg.h"
+
+#include "sof_prediction.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof/prediction")
+TEST_INCLUDE_PATH("../../src/app/application/bms")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/contactor")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/driver/sps")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** cell voltage far away from both voltage limits */
+#define TEST_CELL_VOLTAGE_mV (2150)
+/** cell temperature without derating */
+#define TEST_CELL_TEMPERATURE_ddegC (250)
+
+static DATA_BLOCK_CELL_VOLTAGE_s test_tableCellVoltage         = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+static DATA_BLOCK_CELL_TEMPERATURE_s test_tableCellTemperature = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+static DATA_BLOCK_CURRENT_s test_tableCurrent                  = {.header.uniqueId = DATA_BLOCK_ID_CURRENT};
+static DATA_BLOCK_SOF_s test_tableSof                          = {.header.uniqueId = DATA_BLOCK_ID_SOF};
+
+static STD_RETURN_TYPE_e TEST_DATA_Write1DataBlock(void *pDataFromSender0, int numCalls) {
+    (void)numCalls;
+    (void)memcpy(&test_tableSof, pDataFromSender0, sizeof(test_tableSof));
+    return STD_OK;
+}
+
+/** provides the test tables to the module under test */
+static void TEST_ReadDatabase(void) {
+    DATA_Read3DataBlocks_ExpectAndReturn(NULL_PTR, NULL_PTR, NULL_PTR, STD_OK);
+    DATA_Read3DataBlocks_IgnoreArg_pDataToReceiver0();
+    DATA_Read3DataBlocks_IgnoreArg_pDataToReceiver1();
+    DATA_Read3DataBlocks_IgnoreArg_pDataToReceiver2();
+    DATA_Read3DataBlocks_ReturnThruPtr_pDataToReceiver0(&test_tableCellVoltage);
+    DATA_Read3DataBlocks_ReturnThruPtr_pDataToReceiver1(&test_tableCellTemperature);
+    DATA_Read3DataBlocks_ReturnThruPtr_pDataToReceiver2(&test_tableCurrent);
+}
+
+/** current of a cell block at a voltage difference to the limit, same integer calculation as the module */
+static int32_t TEST_GetCurrent_mA(int32_t voltageDifference_mV, SOF_HORIZON_e horizon, uint16_t temperatureIndex) {
+    return (voltageDifference_mV * TEST_SOF_GetConductance(horizon, temperatureIndex)) / 256;
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint8_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_MODULE; c++) {
+                test_tableCellVoltage.cellVoltage_mV[s][m][c] = TEST_CELL_VOLTAGE_mV;
+            }
+            test_tableCellVoltage.invalidCellVoltage[s][m] = 0u;
+            for (uint8_t t = 0u; t < BS_NR_OF_TEMP_SENSORS_PER_MODULE; t++) {
+                test_tableCellTemperature.cellTemperature_ddegC[s][m][t] = TEST_CELL_TEMPERATURE_ddegC;
+            }
+            test_tableCellTemperature.invalidCellTemperature[s][m] = 0u;
+        }
+        test_tableCurrent.current_mA[s]         = 0;
+        test_tableCurrent.invalidMeasurement[s] = 0u;
+    }
+    SOF_Init();
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testSOF_GetTemperatureDeratedCurrent(void) {
+    /* below the low limit */
+    TEST_ASSERT_EQUAL_INT32(100, TEST_SOF_GetTemperatureDeratedCurrent(-300, -200, -100, 300, 400, 100, 1000));
+    TEST_ASSERT_EQUAL_INT32(100, TEST_SOF_GetTemperatureDeratedCurrent(-200, -200, -100, 300, 400, 100, 1000));
+    /* linear between the low limit and the low cutoff */
+    TEST_ASSERT_EQUAL_INT32(550, TEST_SOF_GetTemperatureDeratedCurrent(-150, -200, -100, 300, 400, 100, 1000));
+    /* no derating */
+    TEST_ASSERT_EQUAL_INT32(1000, TEST_SOF_GetTemperatureDeratedCurrent(-100, -200, -100, 300, 400, 100, 1000));
+    TEST_ASSERT_EQUAL_INT32(1000, TEST_SOF_GetTemperatureDeratedCurrent(300, -200, -100, 300, 400, 100, 1000));
+    /* linear between the high cutoff and the high limit */
+    TEST_ASSERT_EQUAL_INT32(250, TEST_SOF_GetTemperatureDeratedCurrent(375, -200, -100, 300, 400, 100, 1000));
+    /* above the high limit */
+    TEST_ASSERT_EQUAL_INT32(0, TEST_SOF_GetTemperatureDeratedCurrent(400, -200, -100, 300, 400, 100, 1000));
+    TEST_ASSERT_EQUAL_INT32(0, TEST_SOF_GetTemperatureDeratedCurrent(500, -200, -100, 300, 400, 100, 1000));
+
+    /* invalid limits */
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOF_GetTemperatureDeratedCurrent(0, -100, -200, 300, 400, 100, 1000));
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOF_GetTemperatureDeratedCurrent(0, -200, -100, 300, 300, 100, 1000));
+}
+
+void testSOF_GetResistanceFactor(void) {
+    TEST_ASSERT_EQUAL_FLOAT(4.0f, TEST_SOF_GetResistanceFactor(-300));
+    TEST_ASSERT_EQUAL_FLOAT(4.0f, TEST_SOF_GetResistanceFactor(-200));
+    TEST_ASSERT_EQUAL_FLOAT(3.25f, TEST_SOF_GetResistanceFactor(-150));
+    TEST_ASSERT_EQUAL_FLOAT(1.125f, TEST_SOF_GetResistanceFactor(175));
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, TEST_SOF_GetResistanceFactor(250));
+    TEST_ASSERT_EQUAL_FLOAT(0.9f, TEST_SOF_GetResistanceFactor(550));
+    TEST_ASSERT_EQUAL_FLOAT(0.9f, TEST_SOF_GetResistanceFactor(600));
+}
+
+void testSOF_GetTemperatureIndex(void) {
+    TEST_ASSERT_EQUAL_UINT16(0u, TEST_SOF_GetTemperatureIndex(INT16_MIN));
+    TEST_ASSERT_EQUAL_UINT16(0u, TEST_SOF_GetTemperatureIndex(-200));
+    TEST_ASSERT_EQUAL_UINT16(45u, TEST_SOF_GetTemperatureIndex(250));
+    TEST_ASSERT_EQUAL_UINT16(45u, TEST_SOF_GetTemperatureIndex(254));
+    TEST_ASSERT_EQUAL_UINT16(46u, TEST_SOF_GetTemperatureIndex(255));
+    TEST_ASSERT_EQUAL_UINT16(75u, TEST_SOF_GetTemperatureIndex(550));
+    TEST_ASSERT_EQUAL_UINT16(75u, TEST_SOF_GetTemperatureIndex(INT16_MAX));
+}
+
+void testSOF_InitTables(void) {
+    const uint16_t index = TEST_SOF_GetTemperatureIndex(TEST_CELL_TEMPERATURE_ddegC);
+
+    /* 1 / 1.5mOhm in 1/256 S */
+    TEST_ASSERT_EQUAL_INT32(170666, TEST_SOF_GetConductance(SOF_HORIZON_2s, index));
+    /* 1 / 2.4mOhm in 1/256 S */
+    TEST_ASSERT_EQUAL_INT32(106666, TEST_SOF_GetConductance(SOF_HORIZON_30s, index));
+    /* the conductance decreases with the horizon and at low temperatures */
+    TEST_ASSERT_TRUE(TEST_SOF_GetConductance(SOF_HORIZON_10s, index) < TEST_SOF_GetConductance(SOF_HORIZON_2s, index));
+    TEST_ASSERT_TRUE(TEST_SOF_GetConductance(SOF_HORIZON_2s, 0u) < TEST_SOF_GetConductance(SOF_HORIZON_2s, index));
+
+    TEST_ASSERT_EQUAL_INT32(SOF_CELL_BLOCK_CURRENT_CHARGE_mA, TEST_SOF_GetTemperatureLimitCharge_mA(index));
+    TEST_ASSERT_EQUAL_INT32(SOF_CELL_BLOCK_CURRENT_DISCHARGE_mA, TEST_SOF_GetTemperatureLimitDischarge_mA(index));
+    TEST_ASSERT_EQUAL_INT32(0, TEST_SOF_GetTemperatureLimitCharge_mA(0u));
+    TEST_ASSERT_EQUAL_INT32(SOF_CELL_BLOCK_CURRENT_LIMP_HOME_mA, TEST_SOF_GetTemperatureLimitDischarge_mA(0u));
+    TEST_ASSERT_EQUAL_INT32(0, TEST_SOF_GetTemperatureLimitCharge_mA(SOF_PREDICTION_TEMPERATURE_TABLE_LENGTH - 1u));
+    TEST_ASSERT_EQUAL_INT32(0, TEST_SOF_GetTemperatureLimitDischarge_mA(SOF_PREDICTION_TEMPERATURE_TABLE_LENGTH - 1u));
+}
+
+void testSOF_PredictStringInvalidInput(void) {
+    SOF_STRING_PREDICTION_s prediction = {0};
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOF_PredictString(BS_NR_OF_STRINGS, &prediction));
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOF_PredictString(0u, NULL_PTR));
+}
+
+void testSOF_PredictStringLimitingCellBlocks(void) {
+    const uint16_t index = TEST_SOF_GetTemperatureIndex(TEST_CELL_TEMPERATURE_ddegC);
+    /* cell block 5 is close to the discharge limit and cell block 7 close to the charge limit */
+    test_tableCellVoltage.cellVoltage_mV[0u][0u][5u] = SOF_PREDICTION_VOLTAGE_LIMIT_DISCHARGE_mV + 50;
+    test_tableCellVoltage.cellVoltage_mV[0u][0u][7u] = SOF_PREDICTION_VOLTAGE_LIMIT_CHARGE_mV - 20;
+    /* an invalid measurement does not limit the current */
+    test_tableCellVoltage.cellVoltage_mV[0u][0u][9u] = 1000;
+    BITSET_WriteBit(&test_tableCellVoltage.invalidCellVoltage[0u][0u], 9u, true);
+    TEST_ReadDatabase();
+    DATA_Write1DataBlock_Stub(TEST_DATA_Write1DataBlock);
+    BMS_IsStringClosed_IgnoreAndReturn(true);
+    BMS_IsTransitionToErrorStateActive_IgnoreAndReturn(false);
+    SOF_Calculation();
+
+    SOF_STRING_PREDICTION_s prediction = {0};
+    TEST_SOF_PredictString(0u, &prediction);
+
+    TEST_ASSERT_EQUAL_UINT16(BS_NR_OF_CELL_BLOCKS_PER_STRING - 1u, prediction.numberOfCellBlocks);
+    for (uint8_t h = 0u; h < (uint8_t)SOF_NUMBER_OF_HORIZONS; h++) {
+        TEST_ASSERT_EQUAL_UINT16(5u, prediction.limitingCellBlockDischarge[h]);
+        TEST_ASSERT_EQUAL_UINT16(7u, prediction.limitingCellBlockCharge[h]);
+        TEST_ASSERT_EQUAL_INT32(TEST_GetCurrent_mA(50, (SOF_HORIZON_e)h, index), prediction.dischargeCurrent_mA[h]);
+        TEST_ASSERT_EQUAL_INT32(TEST_GetCurrent_mA(20, (SOF_HORIZON_e)h, index), prediction.chargeCurrent_mA[h]);
+    }
+    /* the longer the pulse the lower the current */
+    TEST_ASSERT_TRUE(prediction.dischargeCurrent_mA[SOF_HORIZON_30s] < prediction.dischargeCurrent_mA[SOF_HORIZON_2s]);
+
+    /* the continuous values are the 30s prediction, the peak values the 2s prediction */
+    TEST_ASSERT_EQUAL_UINT16(5u, test_tableSof.limitingCellBlockDischarge[0u]);
+    TEST_ASSERT_EQUAL_UINT16(7u, test_tableSof.limitingCellBlockCharge[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(
+        (float_t)prediction.dischargeCurrent_mA[SOF_HORIZON_30s],
+        test_tableSof.recommendedContinuousDischargeCurrent_mA[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(
+        (float_t)prediction.dischargeCurrent_mA[SOF_HORIZON_2s], test_tableSof.recommendedPeakDischargeCurrent_mA[0u]);
+}
+
+void testSOF_PredictStringCurrentAndTemperature(void) {
+    /* cell block 5 (temperature sensor 2) is cold, cell block 0 close to the discharge limit */
+    test_tableCellTemperature.cellTemperature_ddegC[0u][0u][2u] = -150;
+    test_tableCellVoltage.cellVoltage_mV[0u][0u][0u]            = SOF_PREDICTION_VOLTAGE_LIMIT_DISCHARGE_mV + 50;
+    /* the discharge current lowers the measured voltage by the ohmic voltage drop (1.5mOhm * 10A = 15mV) */
+    test_tableCurrent.current_mA[0u] = 10000 * (int32_t)BS_CURRENT_DIRECTION_FLOAT;
+    TEST_ReadDatabase();
+    DATA_Write1DataBlock_Stub(TEST_DATA_Write1DataBlock);
+    BMS_IsStringClosed_IgnoreAndReturn(true);
+    BMS_IsTransitionToErrorStateActive_IgnoreAndReturn(false);
+    SOF_Calculation();
+
+    SOF_STRING_PREDICTION_s prediction = {0};
+    TEST_SOF_PredictString(0u, &prediction);
+
+    const uint16_t index = TEST_SOF_GetTemperatureIndex(TEST_CELL_TEMPERATURE_ddegC);
+    TEST_ASSERT_EQUAL_UINT16(0u, prediction.limitingCellBlockDischarge[SOF_HORIZON_2s]);
+    TEST_ASSERT_EQUAL_INT32(TEST_GetCurrent_mA(65, SOF_HORIZON_2s, index), prediction.dischargeCurrent_mA[0u]);
+    /* the cold cell block limits the charge current by the temperature derating */
+    TEST_ASSERT_EQUAL_UINT16(5u, prediction.limitingCellBlockCharge[SOF_HORIZON_2s]);
+    TEST_ASSERT_EQUAL_INT32(
+        TEST_SOF_GetTemperatureLimitCharge_mA(TEST_SOF_GetTemperatureIndex(-150)),
+        prediction.chargeCurrent_mA[SOF_HORIZON_2s]);
+    TEST_ASSERT_TRUE(prediction.chargeCurrent_mA[SOF_HORIZON_2s] < SOF_CELL_BLOCK_CURRENT_CHARGE_mA);
+}
+
+void testSOF_PredictStringNoValidMeasurement(void) {
+    test_tableCellVoltage.invalidCellVoltage[0u][0u] = BITSET_GetMask(BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+    TEST_ReadDatabase();
+    DATA_Write1DataBlock_Stub(TEST_DATA_Write1DataBlock);
+    BMS_IsStringClosed_IgnoreAndReturn(true);
+    BMS_IsTransitionToErrorStateActive_IgnoreAndReturn(false);
+    SOF_Calculation();
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSof.recommendedContinuousChargeCurrent_mA[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSof.recommendedContinuousDischargeCurrent_mA[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSof.recommendedContinuousPackDischargeCurrent_mA);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSof.predictedPackDischargePower2s_W);
+}
+
+void testSOF_CalculationPackValues(void) {
+    TEST_ReadDatabase();
+    DATA_Write1DataBlock_Stub(TEST_DATA_Write1DataBlock);
+    BMS_IsStringClosed_IgnoreAndReturn(true);
+    BMS_IsTransitionToErrorStateActive_IgnoreAndReturn(false);
+    SOF_Calculation();
+
+    /* far away from the voltage limits the cell blocks are only limited by the temperature derating */
+    TEST_ASSERT_EQUAL_FLOAT(
+        (float_t)SOF_CELL_BLOCK_CURRENT_DISCHARGE_mA, test_tableSof.recommendedContinuousDischargeCurrent_mA[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(
+        (float_t)SOF_CELL_BLOCK_CURRENT_CHARGE_mA, test_tableSof.recommendedPeakChargeCurrent_mA[0u]);
+
+    /* the pack current is limited by the maximum string current */
+    const float_t packCurrent_mA = (float_t)BS_NR_OF_STRINGS * (float_t)BS_MAXIMUM_STRING_CURRENT_mA;
+    TEST_ASSERT_EQUAL_FLOAT(packCurrent_mA, test_tableSof.recommendedContinuousPackChargeCurrent_mA);
+    TEST_ASSERT_EQUAL_FLOAT(packCurrent_mA, test_tableSof.recommendedContinuousPackDischargeCurrent_mA);
+    TEST_ASSERT_EQUAL_FLOAT(packCurrent_mA, test_tableSof.recommendedPeakPackChargeCurrent_mA);
+    TEST_ASSERT_EQUAL_FLOAT(packCurrent_mA, test_tableSof.recommendedPeakPackDischargeCurrent_mA);
+
+    /* the string voltage changes by the string current times the sum of the pulse resistances */
+    const float_t openCircuitVoltage_mV = (float_t)(BS_NR_OF_CELL_BLOCKS_PER_STRING * TEST_CELL_VOLTAGE_mV);
+    const float_t voltageChange_mV      = ((float_t)BS_MAXIMUM_STRING_CURRENT_mA *
+                                      (float_t)BS_NR_OF_CELL_BLOCKS_PER_STRING * SOF_CELL_RESISTANCE_30s_mOhm) /
+                                     1000.0f;
+    TEST_ASSERT_FLOAT_WITHIN(
+        0.01f,
+        (packCurrent_mA * (openCircuitVoltage_mV - voltageChange_mV)) / 1000000.0f,
+        test_tableSof.predictedPackDischargePower30s_W);
+    TEST_ASSERT_FLOAT_WITHIN(
+        0.01f,
+        (packCurrent_mA * (openCircuitVoltage_mV + voltageChange_mV)) / 1000000.0f,
+        test_tableSof.predictedPackChargePower30s_W);
+    TEST_ASSERT_TRUE(test_tableSof.predictedPackDischargePower30s_W < test_tableSof.predictedPackDischargePower10s_W);
+    TEST_ASSERT_TRUE(test_tableSof.predictedPackDischargePower10s_W < test_tableSof.predictedPackDischargePower2s_W);
+}
+
+void testSOF_CalculationOpenString(void) {
+    TEST_ReadDatabase();
+    DATA_Write1DataBlock_Stub(TEST_DATA_Write1DataBlock);
+    BMS_IsStringClosed_IgnoreAndReturn(false);
+    BMS_IsTransitionToErrorStateActive_IgnoreAndReturn(false);
+    SOF_Calculation();
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSof.recommendedContinuousChargeCurrent_mA[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSof.recommendedPeakDischargeCurrent_mA[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSof.recommendedContinuousPackChargeCurrent_mA);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSof.predictedPackChargePower2s_W);
+}
+
+void testSOF_CalculationTransitionToErrorState(void) {
+    TEST_ReadDatabase();
+    DATA_Write1DataBlock_Stub(TEST_DATA_Write1DataBlock);
+    BMS_IsStringClosed_IgnoreAndReturn(true);
+    BMS_IsTransitionToErrorStateActive_ExpectAndReturn(true);
+    SOF_Calculation();
+
+    /* the string values are still calculated, the pack values are zero */
+    TEST_ASSERT_TRUE(test_tableSof.recommendedContinuousDischargeCurrent_mA[0u] > 0.0f);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSof.recommendedContinuousPackChargeCurrent_mA);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSof.recommendedContinuousPackDischargeCurrent_mA);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSof.recommendedPeakPackChargeCurrent_mA);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSof.recommendedPeakPackDischargeCurrent_mA);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSof.predictedPackChargePower30s_W);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSof.predictedPackDischargePower30s_W);
+}
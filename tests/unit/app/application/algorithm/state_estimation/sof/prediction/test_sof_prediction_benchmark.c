@@ -0,0 +1,187 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    test_sof_prediction_benchmark.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Host benchmark of the per-cell SOF prediction
+ * @details The test is built with #SOF_PREDICTION_MAXIMUM_NUMBER_OF_CELL_BLOCKS
+ *          cell blocks (see the unit test project configuration) and measures
+ *          the execution time of #SOF_Calculation() on the host. The host
+ *          time is scaled with #TEST_SOF_PREDICTION_HOST_TO_TARGET_FACTOR to
+ *          the target and compared against
+ *          #SOF_PREDICTION_MAXIMUM_EXECUTION_TIME_us.
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockbms.h"
+#include "Mockdatabase.h"
+
+#include "sof_prediction_cfg.h"
+
+#include "sof_prediction.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof/prediction")
+TEST_INCLUDE_PATH("../../src/app/application/bms")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/contactor")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/driver/sps")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+#if (BS_NR_OF_CELL_BLOCKS != SOF_PREDICTION_MAXIMUM_NUMBER_OF_CELL_BLOCKS)
+#error "The benchmark has to be built with the maximum number of cell blocks."
+#endif
+
+/**
+ * @brief   Ratio of the execution time on the target (TMS570LC4357, 300MHz)
+ *          to the execution time of the unit test build on the host
+ * @details Estimate for the unoptimized, instrumented unit test build on a
+ *          x86-64 development machine (see test_soc_ekf_benchmark.c).
+ */
+#define TEST_SOF_PREDICTION_HOST_TO_TARGET_FACTOR (20.0)
+
+/** number of measured prediction steps */
+#define TEST_SOF_PREDICTION_NUMBER_OF_STEPS (200u)
+
+static DATA_BLOCK_CELL_VOLTAGE_s test_tableCellVoltage         = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+static DATA_BLOCK_CELL_TEMPERATURE_s test_tableCellTemperature = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+static DATA_BLOCK_CURRENT_s test_tableCurrent                  = {.header.uniqueId = DATA_BLOCK_ID_CURRENT};
+static DATA_BLOCK_SOF_s test_tableSof                          = {.header.uniqueId = DATA_BLOCK_ID_SOF};
+
+/** provides a new current measurement on every call */
+static STD_RETURN_TYPE_e TEST_DATA_Read3DataBlocks(
+    void *pDataToReceiver0,
+    void *pDataToReceiver1,
+    void *pDataToReceiver2,
+    int numCalls) {
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        test_tableCurrent.current_mA[s] = 20000;
+        if ((numCalls % 2) == 0) {
+            test_tableCurrent.current_mA[s] = -20000;
+        }
+    }
+    (void)memcpy(pDataToReceiver0, &test_tableCellVoltage, sizeof(test_tableCellVoltage));
+    (void)memcpy(pDataToReceiver1, &test_tableCellTemperature, sizeof(test_tableCellTemperature));
+    (void)memcpy(pDataToReceiver2, &test_tableCurrent, sizeof(test_tableCurrent));
+    return STD_OK;
+}
+
+static STD_RETURN_TYPE_e TEST_DATA_Write1DataBlock(void *pDataFromSender0, int numCalls) {
+    (void)numCalls;
+    (void)memcpy(&test_tableSof, pDataFromSender0, sizeof(test_tableSof));
+    return STD_OK;
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint8_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_MODULE; c++) {
+                test_tableCellVoltage.cellVoltage_mV[s][m][c] = (int16_t)(2000 + c);
+            }
+            test_tableCellVoltage.invalidCellVoltage[s][m] = 0u;
+            for (uint8_t t = 0u; t < BS_NR_OF_TEMP_SENSORS_PER_MODULE; t++) {
+                test_tableCellTemperature.cellTemperature_ddegC[s][m][t] = (int16_t)(100 + (10 * t));
+            }
+            test_tableCellTemperature.invalidCellTemperature[s][m] = 0u;
+        }
+    }
+    SOF_Init();
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testSOF_CalculationExecutionTime(void) {
+    DATA_Read3DataBlocks_Stub(TEST_DATA_Read3DataBlocks);
+    DATA_Write1DataBlock_Stub(TEST_DATA_Write1DataBlock);
+    BMS_IsStringClosed_IgnoreAndReturn(true);
+    BMS_IsTransitionToErrorStateActive_IgnoreAndReturn(false);
+
+    const clock_t start = clock();
+    for (uint16_t i = 0u; i < TEST_SOF_PREDICTION_NUMBER_OF_STEPS; i++) {
+        SOF_Calculation();
+    }
+    const clock_t stop = clock();
+
+    const double host_us = (((double)(stop - start) * 1000000.0) / (double)CLOCKS_PER_SEC) /
+                           (double)TEST_SOF_PREDICTION_NUMBER_OF_STEPS;
+    const double target_us = host_us * TEST_SOF_PREDICTION_HOST_TO_TARGET_FACTOR;
+    char message[120]      = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "%u cell blocks: %.2fus per step on the host, %.0fus estimated on the target (budget %uus)",
+        (unsigned int)BS_NR_OF_CELL_BLOCKS,
+        host_us,
+        target_us,
+        (unsigned int)SOF_PREDICTION_MAXIMUM_EXECUTION_TIME_us);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE_MESSAGE(target_us <= (double)SOF_PREDICTION_MAXIMUM_EXECUTION_TIME_us, message);
+
+    /* the prediction still yields plausible values at this size */
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        TEST_ASSERT_TRUE(test_tableSof.recommendedContinuousDischargeCurrent_mA[s] > 0.0f);
+        TEST_ASSERT_TRUE(
+            test_tableSof.recommendedContinuousDischargeCurrent_mA[s] <=
+            test_tableSof.recommendedPeakDischargeCurrent_mA[s]);
+        TEST_ASSERT_TRUE(test_tableSof.limitingCellBlockCharge[s] < BS_NR_OF_CELL_BLOCKS_PER_STRING);
+    }
+    TEST_ASSERT_TRUE(test_tableSof.predictedPackDischargePower30s_W > 0.0f);
+}
@@ -0,0 +1,98 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    test_sof_prediction_cfg.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the configuration of the per-cell SOF prediction
+ * @details TODO
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+
+#include "sof_prediction_cfg.h"
+
+#include <stdint.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof/prediction")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testSofPredictionConfiguration(void) {
+    TEST_ASSERT_TRUE(
+        sof_predictionConfiguration.limitChargeVoltage_mV > sof_predictionConfiguration.limitDischargeVoltage_mV);
+    TEST_ASSERT_TRUE(sof_predictionConfiguration.maximumChargeCurrent_mA > 0);
+    TEST_ASSERT_TRUE(sof_predictionConfiguration.maximumDischargeCurrent_mA > 0);
+}
+
+void testSofCellPulseResistance(void) {
+    /* the resistance increases with the pulse length */
+    TEST_ASSERT_TRUE(sof_cellPulseResistance_mOhm[SOF_HORIZON_2s] > 0.0f);
+    TEST_ASSERT_TRUE(sof_cellPulseResistance_mOhm[SOF_HORIZON_10s] >= sof_cellPulseResistance_mOhm[SOF_HORIZON_2s]);
+    TEST_ASSERT_TRUE(sof_cellPulseResistance_mOhm[SOF_HORIZON_30s] >= sof_cellPulseResistance_mOhm[SOF_HORIZON_10s]);
+}
+
+void testSofResistanceTemperatureDependency(void) {
+    for (uint8_t i = 0u; i < SOF_RESISTANCE_TEMPERATURE_POINTS; i++) {
+        TEST_ASSERT_TRUE(sof_resistanceTemperatureDependency[i].resistanceFactor_perc > 0u);
+        if (i > 0u) {
+            TEST_ASSERT_TRUE(
+                sof_resistanceTemperatureDependency[i].temperature_ddegC >
+                sof_resistanceTemperatureDependency[i - 1u].temperature_ddegC);
+        }
+    }
+}
@@ -43,7 +43,7 @@
  * @file    test_sof_trapezoid.c
  * @author  foxBMS Team
  * @date    2020-10-07 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -66,6 +66,7 @@
 
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof")
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof/trapezoid")
 TEST_INCLUDE_PATH("../../src/app/application/bms")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
@@ -0,0 +1,336 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    test_soh_rls.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the recursive least-squares SOH estimation
+ * @details Tests the estimator update, the SOH calculation of a cell block
+ *          and the state estimation API functions
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockbms.h"
+#include "Mockdatabase.h"
+#include "Mockfram.h"
+
+#include "battery_cell_cfg.h"
+#include "soh_rls_cfg.h"
+
+#include "foxmath.h"
+#include "state_estimation.h"
+#include "test_assert_helper.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("soc_lookup-table.c")
+TEST_SOURCE_FILE("soe_none.c")
+TEST_SOURCE_FILE("soh_rls.c")
+
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/soc/lookup-table")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/soh/rls")
+TEST_INCLUDE_PATH("../../src/app/application/bms")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/contactor")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/driver/sps")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+FRAM_SOC_s fram_soc = {0};
+FRAM_SOH_s fram_soh = {0};
+
+/** index of the last cell block of the first string, it has an invalid voltage measurement */
+#define TEST_LAST_CELL_BLOCK (BS_NR_OF_CELL_BLOCKS_PER_STRING - 1u)
+
+/** open-circuit voltages of the cell lookup table in mV */
+/**@{*/
+#define TEST_OCV_80_PERCENT_mV (3939)
+#define TEST_OCV_40_PERCENT_mV (3568)
+/**@}*/
+
+static DATA_BLOCK_SOH_s test_tableSoh                        = {.header.uniqueId = DATA_BLOCK_ID_SOH};
+static DATA_BLOCK_CURRENT_s test_tableCurrent                = {.header.uniqueId = DATA_BLOCK_ID_CURRENT};
+static DATA_BLOCK_CURRENT_COUNTER_s test_tableCurrentCounter = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_COUNTER};
+static DATA_BLOCK_CELL_VOLTAGE_s test_tableCellVoltage       = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+
+static float_t test_parameter[BS_NR_OF_CELL_BLOCKS]  = {0.0f};
+static float_t test_covariance[BS_NR_OF_CELL_BLOCKS] = {0.0f};
+
+static const SOH_RLS_ESTIMATOR_s test_estimator = {
+    .pParameter  = test_parameter,
+    .pCovariance = test_covariance,
+};
+
+static void TEST_SetCellVoltages(int16_t cellVoltage_mV, uint32_t timestamp) {
+    test_tableCellVoltage.header.timestamp = timestamp;
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        for (uint8_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_MODULE; c++) {
+            test_tableCellVoltage.cellVoltage_mV[0u][m][c] = cellVoltage_mV;
+        }
+        test_tableCellVoltage.invalidCellVoltage[0u][m] = 0u;
+    }
+    test_tableCellVoltage.invalidCellVoltage[0u][BS_NR_OF_MODULES_PER_STRING - 1u] =
+        (1u << (BS_NR_OF_CELL_BLOCKS_PER_MODULE - 1u));
+}
+
+static void TEST_ExpectDatabaseRead(void) {
+    DATA_Read3DataBlocks_ExpectAndReturn(&test_tableCurrent, &test_tableCurrentCounter, &test_tableCellVoltage, STD_OK);
+    DATA_Read3DataBlocks_ReturnThruPtr_pDataToReceiver0(&test_tableCurrent);
+    DATA_Read3DataBlocks_ReturnThruPtr_pDataToReceiver1(&test_tableCurrentCounter);
+    DATA_Read3DataBlocks_ReturnThruPtr_pDataToReceiver2(&test_tableCellVoltage);
+}
+
+static void TEST_InitializeStateOfHealth(FRAM_RETURN_TYPE_e framReturnValue) {
+    TEST_ExpectDatabaseRead();
+    FRAM_ReadData_ExpectAndReturn(FRAM_BLOCK_ID_SOH, framReturnValue);
+    SE_InitializeStateOfHealth(&test_tableSoh, 0u);
+}
+
+static void TEST_CalculateStateOfHealth(BMS_CURRENT_FLOW_STATE_e batterySystemState) {
+    TEST_ExpectDatabaseRead();
+    BMS_GetBatterySystemState_ExpectAndReturn(batterySystemState);
+    SE_CalculateStateOfHealth(&test_tableSoh);
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    test_tableCurrent.timestamp[0u]                = 1000u;
+    test_tableCurrent.current_mA[0u]               = 0;
+    test_tableCurrent.invalidMeasurement[0u]       = 0u;
+    test_tableCurrentCounter.timestamp[0u]         = 0u;
+    test_tableCurrentCounter.currentCounter_As[0u] = 0;
+    TEST_SetCellVoltages(3700, 1000u);
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testSE_CalculateStateOfHealthNotInitialized(void) {
+    TEST_ASSERT_FAIL_ASSERT(SE_CalculateStateOfHealth(NULL_PTR));
+    /* nothing is read or written before the initialization */
+    TEST_ASSERT_EQUAL(false, TEST_SOH_GetSohStateInitialized());
+    SE_CalculateStateOfHealth(&test_tableSoh);
+}
+
+void testSOH_UpdateEstimator(void) {
+    const SOH_RLS_CONFIGURATION_s configuration = {
+        .forgettingFactor  = 0.5f,
+        .measurementNoise  = 1.0f,
+        .maximumCovariance = 100.0f,
+    };
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOH_UpdateEstimator(NULL_PTR, &test_estimator, 0u, 1.0f, 1.0f));
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOH_UpdateEstimator(&configuration, NULL_PTR, 0u, 1.0f, 1.0f));
+    TEST_ASSERT_FAIL_ASSERT(
+        TEST_SOH_UpdateEstimator(&configuration, &test_estimator, BS_NR_OF_CELL_BLOCKS, 1.0f, 1.0f));
+
+    /* a certain measurement moves an uncertain parameter nearly to the solution of y = phi * theta */
+    test_parameter[0u]  = 0.0f;
+    test_covariance[0u] = 100.0f;
+    TEST_SOH_UpdateEstimator(&configuration, &test_estimator, 0u, 2.0f, 50.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 25.0f, test_parameter[0u]);
+    TEST_ASSERT_TRUE(test_covariance[0u] < 1.0f);
+
+    /* without excitation the parameter is kept and the variance grows up to its limit */
+    test_covariance[0u] = 80.0f;
+    TEST_SOH_UpdateEstimator(&configuration, &test_estimator, 0u, 0.0f, 50.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 25.0f, test_parameter[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, test_covariance[0u]);
+}
+
+void testSOH_GetCellStateOfHealth(void) {
+    /* begin of life */
+    TEST_ASSERT_EQUAL_FLOAT(
+        100.0f, TEST_SOH_GetCellStateOfHealth(SOH_CELL_BLOCK_CAPACITY_mAh, SOH_RLS_RESISTANCE_BEGIN_OF_LIFE_mOhm));
+    /* capacity fade */
+    TEST_ASSERT_EQUAL_FLOAT(
+        80.0f,
+        TEST_SOH_GetCellStateOfHealth(0.8f * SOH_CELL_BLOCK_CAPACITY_mAh, SOH_RLS_RESISTANCE_BEGIN_OF_LIFE_mOhm));
+    /* resistance increase half way to the end of life */
+    TEST_ASSERT_EQUAL_FLOAT(
+        50.0f,
+        TEST_SOH_GetCellStateOfHealth(
+            SOH_CELL_BLOCK_CAPACITY_mAh,
+            (SOH_RLS_RESISTANCE_BEGIN_OF_LIFE_mOhm + SOH_RLS_RESISTANCE_END_OF_LIFE_mOhm) / 2.0f));
+    /* limits */
+    TEST_ASSERT_EQUAL_FLOAT(
+        0.0f,
+        TEST_SOH_GetCellStateOfHealth(SOH_CELL_BLOCK_CAPACITY_mAh, 2.0f * SOH_RLS_RESISTANCE_END_OF_LIFE_mOhm));
+    TEST_ASSERT_EQUAL_FLOAT(
+        100.0f,
+        TEST_SOH_GetCellStateOfHealth(
+            1.1f * SOH_CELL_BLOCK_CAPACITY_mAh, 0.5f * SOH_RLS_RESISTANCE_BEGIN_OF_LIFE_mOhm));
+}
+
+void testSE_InitializeStateOfHealth(void) {
+    TEST_ASSERT_FAIL_ASSERT(SE_InitializeStateOfHealth(NULL_PTR, 0u));
+    TEST_ASSERT_FAIL_ASSERT(SE_InitializeStateOfHealth(&test_tableSoh, BS_NR_OF_STRINGS));
+
+    /* the stored values are invalid: start with the begin-of-life values */
+    fram_soh.cellCapacity_mAh[0u] = 1.0f;
+    TEST_InitializeStateOfHealth(FRAM_ACCESS_CRC_ERROR);
+    TEST_ASSERT_EQUAL(true, TEST_SOH_GetSohStateInitialized());
+    TEST_ASSERT_EQUAL_FLOAT(SOH_CELL_BLOCK_CAPACITY_mAh, TEST_SOH_GetCellCapacity_mAh(0u));
+    TEST_ASSERT_EQUAL_FLOAT(SOH_RLS_RESISTANCE_BEGIN_OF_LIFE_mOhm, TEST_SOH_GetCellResistance_mOhm(0u));
+    TEST_ASSERT_EQUAL_FLOAT(SOH_CELL_BLOCK_CAPACITY_mAh, fram_soh.cellCapacity_mAh[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, test_tableSoh.minimumSoh_perc[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, test_tableSoh.maximumSoh_perc[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, test_tableSoh.averageSoh_perc[0u]);
+
+    /* the stored values are valid: continue with them, except for an
+     * implausible value of the last cell block */
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        fram_soh.cellCapacity_mAh[c] = 0.9f * SOH_CELL_BLOCK_CAPACITY_mAh;
+    }
+    fram_soh.cellCapacity_mAh[TEST_LAST_CELL_BLOCK] = 0.0f;
+    TEST_InitializeStateOfHealth(FRAM_ACCESS_OK);
+    TEST_ASSERT_EQUAL_FLOAT(0.9f * SOH_CELL_BLOCK_CAPACITY_mAh, TEST_SOH_GetCellCapacity_mAh(0u));
+    TEST_ASSERT_EQUAL_FLOAT(SOH_CELL_BLOCK_CAPACITY_mAh, TEST_SOH_GetCellCapacity_mAh(TEST_LAST_CELL_BLOCK));
+    TEST_ASSERT_EQUAL_FLOAT(90.0f, test_tableSoh.minimumSoh_perc[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, test_tableSoh.maximumSoh_perc[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(
+        ((90.0f * (float_t)(BS_NR_OF_CELL_BLOCKS_PER_STRING - 1u)) + 100.0f) / (float_t)BS_NR_OF_CELL_BLOCKS_PER_STRING,
+        test_tableSoh.averageSoh_perc[0u]);
+}
+
+void testSE_CalculateStateOfHealthResistance(void) {
+    const float_t resistance_mOhm = 30.0f;
+    const int32_t current_mA      = 20000;
+    TEST_InitializeStateOfHealth(FRAM_ACCESS_CRC_ERROR);
+
+    /* current step without a simultaneous current measurement: no update */
+    test_tableCurrent.timestamp[0u]  = 1300u;
+    test_tableCurrent.current_mA[0u] = current_mA * (int32_t)BS_CURRENT_DIRECTION_FLOAT;
+    TEST_SetCellVoltages((int16_t)(3700.0f - (resistance_mOhm * 20.0f)), 1100u);
+    TEST_CalculateStateOfHealth(BMS_DISCHARGING);
+    TEST_ASSERT_EQUAL_FLOAT(SOH_RLS_RESISTANCE_BEGIN_OF_LIFE_mOhm, TEST_SOH_GetCellResistance_mOhm(0u));
+
+    /* alternating current steps converge to the cell block resistance, the
+     * cell block with the invalid measurement keeps its resistance */
+    uint32_t timestamp = 1300u;
+    for (uint8_t i = 0u; i < 50u; i++) {
+        timestamp += 100u;
+        int32_t stepCurrent_mA = 0;
+        if ((i % 2u) == 1u) {
+            stepCurrent_mA = current_mA;
+        }
+        test_tableCurrent.timestamp[0u]  = timestamp;
+        test_tableCurrent.current_mA[0u] = stepCurrent_mA * (int32_t)BS_CURRENT_DIRECTION_FLOAT;
+        TEST_SetCellVoltages((int16_t)(3700.0f - ((resistance_mOhm * (float_t)stepCurrent_mA) / 1000.0f)), timestamp);
+        TEST_CalculateStateOfHealth(BMS_DISCHARGING);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, resistance_mOhm, TEST_SOH_GetCellResistance_mOhm(0u));
+    TEST_ASSERT_EQUAL_FLOAT(
+        SOH_RLS_RESISTANCE_BEGIN_OF_LIFE_mOhm, TEST_SOH_GetCellResistance_mOhm(TEST_LAST_CELL_BLOCK));
+    TEST_ASSERT_FLOAT_WITHIN(2.5f, 50.0f, test_tableSoh.minimumSoh_perc[0u]);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, test_tableSoh.maximumSoh_perc[0u]);
+
+    /* the changed values are written once the minimum write period has elapsed */
+    TEST_ASSERT_EQUAL(true, TEST_SOH_IsNvmUpdateRequired(0u));
+    TEST_ASSERT_EQUAL_FLOAT(SOH_RLS_RESISTANCE_BEGIN_OF_LIFE_mOhm, fram_soh.cellResistance_mOhm[0u]);
+    timestamp += SOH_RLS_NVM_MINIMUM_WRITE_PERIOD_ms;
+    test_tableCurrent.timestamp[0u] = timestamp;
+    TEST_SetCellVoltages(3700, timestamp);
+    FRAM_RequestWrite_Expect(FRAM_BLOCK_ID_SOH);
+    TEST_CalculateStateOfHealth(BMS_DISCHARGING);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, resistance_mOhm, fram_soh.cellResistance_mOhm[0u]);
+    TEST_ASSERT_EQUAL(false, TEST_SOH_IsNvmUpdateRequired(0u));
+}
+
+void testSE_CalculateStateOfHealthCapacity(void) {
+    const float_t capacity_mAh = 0.9f * SOH_CELL_BLOCK_CAPACITY_mAh;
+    /* 40% of the capacity in mAs */
+    const float_t charge_mAs = 0.4f * capacity_mAh * 3600.0f;
+    TEST_InitializeStateOfHealth(FRAM_ACCESS_CRC_ERROR);
+
+    /* first rest point at 80% */
+    TEST_SetCellVoltages(TEST_OCV_80_PERCENT_mV, 1100u);
+    test_tableCurrent.timestamp[0u] = 1100u;
+    TEST_CalculateStateOfHealth(BMS_AT_REST);
+    TEST_ASSERT_EQUAL_FLOAT(SOH_CELL_BLOCK_CAPACITY_mAh, TEST_SOH_GetCellCapacity_mAh(0u));
+
+    /* discharge of 40% of the capacity in 100s, integrated from the current */
+    test_tableCurrent.timestamp[0u]  = 101100u;
+    test_tableCurrent.current_mA[0u] = (int32_t)(charge_mAs / 100.0f) * (int32_t)BS_CURRENT_DIRECTION_FLOAT;
+    TEST_CalculateStateOfHealth(BMS_DISCHARGING);
+    test_tableCurrent.timestamp[0u]  = 101200u;
+    test_tableCurrent.current_mA[0u] = 0;
+    TEST_CalculateStateOfHealth(BMS_RELAXATION);
+
+    /* second rest point at 40%: the capacity moves close to the real one */
+    TEST_SetCellVoltages(TEST_OCV_40_PERCENT_mV, 101300u);
+    test_tableCurrent.timestamp[0u] = 101300u;
+    TEST_CalculateStateOfHealth(BMS_AT_REST);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f * capacity_mAh, capacity_mAh, TEST_SOH_GetCellCapacity_mAh(0u));
+    TEST_ASSERT_EQUAL_FLOAT(SOH_CELL_BLOCK_CAPACITY_mAh, TEST_SOH_GetCellCapacity_mAh(TEST_LAST_CELL_BLOCK));
+
+    /* charge of 40% taken from the current counter */
+    test_tableCurrentCounter.timestamp[0u]         = 101300u;
+    test_tableCurrentCounter.currentCounter_As[0u] = 1000;
+    TEST_SetCellVoltages(TEST_OCV_40_PERCENT_mV, 101400u);
+    test_tableCurrent.timestamp[0u] = 101400u;
+    TEST_CalculateStateOfHealth(BMS_AT_REST);
+    const float_t capacityAfterDischarge_mAh = TEST_SOH_GetCellCapacity_mAh(0u);
+
+    test_tableCurrentCounter.timestamp[0u] = 201400u;
+    test_tableCurrentCounter.currentCounter_As[0u] =
+        1000 - ((int32_t)(charge_mAs / 1000.0f) * (int32_t)BS_CURRENT_DIRECTION_FLOAT);
+    TEST_SetCellVoltages(TEST_OCV_80_PERCENT_mV, 201400u);
+    test_tableCurrent.timestamp[0u] = 201400u;
+    TEST_CalculateStateOfHealth(BMS_AT_REST);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f * capacity_mAh, capacity_mAh, TEST_SOH_GetCellCapacity_mAh(0u));
+    TEST_ASSERT_TRUE(
+        fabsf(TEST_SOH_GetCellCapacity_mAh(0u) - capacity_mAh) <=
+        fabsf(capacityAfterDischarge_mAh - capacity_mAh));
+}
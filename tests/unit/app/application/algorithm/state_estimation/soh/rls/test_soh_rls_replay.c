@@ -0,0 +1,321 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    test_soh_rls_replay.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Host replay of a load profile through the recursive least-squares
+ *          SOH estimation
+ * @details The current and cell voltage measurements of a string with aged
+ *          cell blocks are replayed cycle by cycle through
+ *          #SE_CalculateStateOfHealth(). The test verifies that the estimated
+ *          capacities and resistances converge to the values of the
+ *          simulated cell blocks, that the FRAM is written rarely and that
+ *          the execution time, scaled with
+ *          #TEST_SOH_RLS_HOST_TO_TARGET_FACTOR to the target, is within
+ *          #SOH_RLS_MAXIMUM_EXECUTION_TIME_us.
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockbms.h"
+#include "Mockdatabase.h"
+#include "Mockfram.h"
+
+#include "battery_cell_cfg.h"
+#include "soh_rls_cfg.h"
+
+#include "state_estimation.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("soc_lookup-table.c")
+TEST_SOURCE_FILE("soe_none.c")
+TEST_SOURCE_FILE("soh_rls.c")
+
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/soc/lookup-table")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/soh/rls")
+TEST_INCLUDE_PATH("../../src/app/application/bms")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/contactor")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/driver/sps")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/**
+ * @brief   Ratio of the execution time on the target (TMS570LC4357, 300MHz)
+ *          to the execution time of the unit test build on the host
+ * @details Same estimate as for the benchmark of the SOC estimation.
+ */
+#define TEST_SOH_RLS_HOST_TO_TARGET_FACTOR (20.0)
+
+/** period of the measurements and of the state estimation in ms */
+#define TEST_REPLAY_TIME_STEP_ms (100u)
+/** number of replayed discharge and charge cycles */
+#define TEST_REPLAY_NUMBER_OF_CYCLES (4u)
+/** duration of a rest phase in ms, the battery is at rest in its second half */
+#define TEST_REPLAY_REST_TIME_ms (60000u)
+/** duration of a current pulse in ms */
+#define TEST_REPLAY_PULSE_TIME_ms (5000u)
+/** maximum amplitude of the measurement noise of the cell voltages in mV */
+#define TEST_REPLAY_VOLTAGE_NOISE_mV (2)
+
+FRAM_SOC_s fram_soc = {0};
+FRAM_SOH_s fram_soh = {0};
+
+static DATA_BLOCK_SOH_s test_tableSoh                        = {.header.uniqueId = DATA_BLOCK_ID_SOH};
+static DATA_BLOCK_CURRENT_s test_tableCurrent                = {.header.uniqueId = DATA_BLOCK_ID_CURRENT};
+static DATA_BLOCK_CURRENT_COUNTER_s test_tableCurrentCounter = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_COUNTER};
+static DATA_BLOCK_CELL_VOLTAGE_s test_tableCellVoltage       = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+
+/** simulated cell blocks */
+/**@{*/
+static float_t test_cellCapacity_mAh[BS_NR_OF_CELL_BLOCKS_PER_STRING]    = {0.0f};
+static float_t test_cellResistance_mOhm[BS_NR_OF_CELL_BLOCKS_PER_STRING] = {0.0f};
+static float_t test_cellSoc_perc[BS_NR_OF_CELL_BLOCKS_PER_STRING]        = {0.0f};
+/**@}*/
+
+/** state of the replay */
+/**@{*/
+static uint32_t test_time_ms                            = 0u;
+static uint32_t test_noise                              = 1u;
+static BMS_CURRENT_FLOW_STATE_e test_batterySystemState = BMS_AT_REST;
+static uint32_t test_numberOfFramWrites                 = 0u;
+static uint32_t test_numberOfCalls[2u]                  = {0u};
+static double test_executionTime_us[2u]                 = {0.0};
+/**@}*/
+
+static STD_RETURN_TYPE_e TEST_DATA_Read3DataBlocks(
+    void *pDataToReceiver0,
+    void *pDataToReceiver1,
+    void *pDataToReceiver2,
+    int numCalls) {
+    (void)numCalls;
+    (void)memcpy(pDataToReceiver0, &test_tableCurrent, sizeof(test_tableCurrent));
+    (void)memcpy(pDataToReceiver1, &test_tableCurrentCounter, sizeof(test_tableCurrentCounter));
+    (void)memcpy(pDataToReceiver2, &test_tableCellVoltage, sizeof(test_tableCellVoltage));
+    return STD_OK;
+}
+
+static BMS_CURRENT_FLOW_STATE_e TEST_BMS_GetBatterySystemState(int numCalls) {
+    (void)numCalls;
+    return test_batterySystemState;
+}
+
+static void TEST_FRAM_RequestWrite(FRAM_BLOCK_ID_e blockId, int numCalls) {
+    (void)numCalls;
+    TEST_ASSERT_EQUAL(FRAM_BLOCK_ID_SOH, blockId);
+    test_numberOfFramWrites++;
+}
+
+/** open-circuit voltage of the cell lookup table, linearly interpolated */
+static float_t TEST_GetOpenCircuitVoltage_mV(float_t soc_perc) {
+    const float_t position = 100.0f - soc_perc;
+    uint16_t index         = (uint16_t)position;
+    if (index >= (bc_stateOfChargeLookupTableLength - 1u)) {
+        index = bc_stateOfChargeLookupTableLength - 2u;
+    }
+    const float_t voltage_mV = (float_t)bc_stateOfChargeLookupTable[index].voltage_mV;
+    const float_t slope_mV   = (float_t)bc_stateOfChargeLookupTable[index + 1u].voltage_mV - voltage_mV;
+    return voltage_mV + (slope_mV * (position - (float_t)index));
+}
+
+/** uniformly distributed measurement noise in mV */
+static int16_t TEST_GetNoise_mV(void) {
+    test_noise = (test_noise * 1103515245u) + 12345u;
+    return (int16_t)((int32_t)((test_noise >> 16u) % ((2u * TEST_REPLAY_VOLTAGE_NOISE_mV) + 1u)) -
+                     TEST_REPLAY_VOLTAGE_NOISE_mV);
+}
+
+static float_t TEST_GetAverageSoc_perc(void) {
+    float_t sum_perc = 0.0f;
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        sum_perc += test_cellSoc_perc[c];
+    }
+    return sum_perc / (float_t)BS_NR_OF_CELL_BLOCKS_PER_STRING;
+}
+
+/** advances the simulated cell blocks by one step and provides the measurements */
+static void TEST_SimulateStep(int32_t current_mA) {
+    test_time_ms += TEST_REPLAY_TIME_STEP_ms;
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        test_cellSoc_perc[c] -= (((float_t)current_mA * ((float_t)TEST_REPLAY_TIME_STEP_ms / 1000.0f)) /
+                                 (test_cellCapacity_mAh[c] * 3600.0f)) *
+                                100.0f;
+        const float_t voltage_mV = TEST_GetOpenCircuitVoltage_mV(test_cellSoc_perc[c]) -
+                                   ((test_cellResistance_mOhm[c] * (float_t)current_mA) / 1000.0f);
+        test_tableCellVoltage.cellVoltage_mV[0u][c / BS_NR_OF_CELL_BLOCKS_PER_MODULE]
+                                            [c % BS_NR_OF_CELL_BLOCKS_PER_MODULE] =
+            (int16_t)lroundf(voltage_mV) + TEST_GetNoise_mV();
+    }
+    test_tableCellVoltage.header.timestamp = test_time_ms;
+    test_tableCurrent.timestamp[0u]        = test_time_ms;
+    test_tableCurrent.current_mA[0u]       = current_mA * (int32_t)BS_CURRENT_DIRECTION_FLOAT;
+}
+
+/** replays one step and measures the execution time of the estimation */
+static void TEST_ReplayStep(int32_t current_mA, BMS_CURRENT_FLOW_STATE_e batterySystemState) {
+    TEST_SimulateStep(current_mA);
+    test_batterySystemState = batterySystemState;
+
+    const clock_t start = clock();
+    SE_CalculateStateOfHealth(&test_tableSoh);
+    const clock_t stop = clock();
+
+    const uint8_t bin = (batterySystemState == BMS_AT_REST) ? 1u : 0u;
+    test_executionTime_us[bin] += ((double)(stop - start) * 1000000.0) / (double)CLOCKS_PER_SEC;
+    test_numberOfCalls[bin]++;
+}
+
+static void TEST_ReplayRest(void) {
+    for (uint32_t t = 0u; t < TEST_REPLAY_REST_TIME_ms; t += TEST_REPLAY_TIME_STEP_ms) {
+        BMS_CURRENT_FLOW_STATE_e batterySystemState = BMS_RELAXATION;
+        if (t >= (TEST_REPLAY_REST_TIME_ms / 2u)) {
+            batterySystemState = BMS_AT_REST;
+        }
+        TEST_ReplayStep(0, batterySystemState);
+    }
+}
+
+/** replays alternating current pulses until the average SOC reaches the target */
+static void TEST_ReplayPulses(int32_t lowCurrent_mA, int32_t highCurrent_mA, float_t targetSoc_perc) {
+    const bool isDischarge = (lowCurrent_mA > 0);
+    uint32_t t             = 0u;
+    while ((isDischarge == true) ? (TEST_GetAverageSoc_perc() > targetSoc_perc)
+                                 : (TEST_GetAverageSoc_perc() < targetSoc_perc)) {
+        int32_t current_mA = lowCurrent_mA;
+        if (((t / TEST_REPLAY_PULSE_TIME_ms) % 2u) == 1u) {
+            current_mA = highCurrent_mA;
+        }
+        TEST_ReplayStep(current_mA, isDischarge ? BMS_DISCHARGING : BMS_CHARGING);
+        t += TEST_REPLAY_TIME_STEP_ms;
+    }
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    /* aged cell blocks with a spread of capacity and resistance */
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        test_cellCapacity_mAh[c]    = (0.85f + (0.02f * (float_t)(c % 5u))) * SOH_CELL_BLOCK_CAPACITY_mAh;
+        test_cellResistance_mOhm[c] = 24.0f + (0.5f * (float_t)(c % 7u));
+        test_cellSoc_perc[c]        = 90.0f;
+    }
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testSE_CalculateStateOfHealthReplay(void) {
+    DATA_Read3DataBlocks_Stub(TEST_DATA_Read3DataBlocks);
+    BMS_GetBatterySystemState_Stub(TEST_BMS_GetBatterySystemState);
+    FRAM_ReadData_IgnoreAndReturn(FRAM_ACCESS_CRC_ERROR);
+    FRAM_RequestWrite_Stub(TEST_FRAM_RequestWrite);
+
+    TEST_SimulateStep(0);
+    SE_InitializeStateOfHealth(&test_tableSoh, 0u);
+
+    for (uint8_t i = 0u; i < TEST_REPLAY_NUMBER_OF_CYCLES; i++) {
+        TEST_ReplayRest();
+        TEST_ReplayPulses(20000, 60000, 30.0f);
+        TEST_ReplayRest();
+        TEST_ReplayPulses(-10000, -40000, 90.0f);
+    }
+    TEST_ReplayRest();
+
+    /* the estimated parameters converge to the simulated cell blocks */
+    float_t minimumSoh_perc = 100.0f;
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        const float_t capacity_mAh    = test_cellCapacity_mAh[c];
+        const float_t resistance_mOhm = test_cellResistance_mOhm[c];
+        TEST_ASSERT_FLOAT_WITHIN(0.02f * capacity_mAh, capacity_mAh, TEST_SOH_GetCellCapacity_mAh(c));
+        TEST_ASSERT_FLOAT_WITHIN(0.5f, resistance_mOhm, TEST_SOH_GetCellResistance_mOhm(c));
+        minimumSoh_perc = fminf(minimumSoh_perc, TEST_SOH_GetCellStateOfHealth(capacity_mAh, resistance_mOhm));
+    }
+    TEST_ASSERT_FLOAT_WITHIN(2.5f, minimumSoh_perc, test_tableSoh.minimumSoh_perc[0u]);
+
+    /* the FRAM is written at most once per minimum write period */
+    const uint32_t maximumNumberOfFramWrites = (test_time_ms / SOH_RLS_NVM_MINIMUM_WRITE_PERIOD_ms) + 1u;
+    TEST_ASSERT_TRUE(test_numberOfFramWrites > 0u);
+    TEST_ASSERT_TRUE(test_numberOfFramWrites <= maximumNumberOfFramWrites);
+
+    /* the execution time of the most expensive calls (at rest) is within the budget */
+    char message[160] = {0};
+    double maximum_us = 0.0;
+    for (uint8_t bin = 0u; bin < 2u; bin++) {
+        const double host_us   = test_executionTime_us[bin] / (double)test_numberOfCalls[bin];
+        const double target_us = host_us * TEST_SOH_RLS_HOST_TO_TARGET_FACTOR;
+        maximum_us             = fmax(maximum_us, target_us);
+        (void)snprintf(
+            message,
+            sizeof(message),
+            "%u cell blocks, %s: %.2fus per call on the host, %.0fus estimated on the target (budget %uus)",
+            (unsigned int)BS_NR_OF_CELL_BLOCKS,
+            (bin == 1u) ? "at rest" : "under load",
+            host_us,
+            target_us,
+            (unsigned int)SOH_RLS_MAXIMUM_EXECUTION_TIME_us);
+        TEST_MESSAGE(message);
+    }
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "%u FRAM writes in %us replayed time",
+        (unsigned int)test_numberOfFramWrites,
+        (unsigned int)(test_time_ms / 1000u));
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(maximum_us <= (double)SOH_RLS_MAXIMUM_EXECUTION_TIME_us);
+}
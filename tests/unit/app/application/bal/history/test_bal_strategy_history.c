@@ -43,13 +43,14 @@
  * @file    test_bal_strategy_history.c
  * @author  foxBMS Team
  * @date    2020-06-05 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
  *
  * @brief   Test of the history based balancing module
- * @details Tests Balancing init, get state and finished
+ * @details Tests Balancing init, get state and finished, the charge lookup
+ *          table and the balancing planner
  *
  */
 
@@ -67,12 +68,15 @@
 #include "Mockspi.h"
 #include "Mockstate_estimation.h"
 
+#include "battery_cell_cfg.h"
 #include "database_cfg.h"
 
 #include "bal.h"
+#include "test_assert_helper.h"
 
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_SOURCE_FILE("bal_strategy_history.c")
+TEST_SOURCE_FILE("battery_cell_cfg.c")
 
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
 TEST_INCLUDE_PATH("../../src/app/application/bal")
@@ -89,8 +93,29 @@ TEST_INCLUDE_PATH("../../src/app/task/config")
 
 static DATA_BLOCK_BALANCING_CONTROL_s bms_tableControl = {.header.uniqueId = DATA_BLOCK_ID_BALANCING_CONTROL};
 
+/** charge of a cell block per mV with the linear SOC stub below */
+#define TEST_CHARGE_PER_mV_mAs (((BC_CAPACITY_mAh * 3600u) / 100u) / 20u)
+
+/** linear SOC stub: 0% at 2700mV, 1% per 20mV */
+static float_t TEST_GetStateOfChargeFromVoltage(int16_t voltage_mV, int cmock_num_calls) {
+    return ((float_t)voltage_mV - 2700.0f) / 20.0f;
+}
+
+/** sets voltage and remaining charge of all cell blocks of the first module */
+static void TEST_SetModule(int16_t voltage_mV) {
+    DATA_BLOCK_BALANCING_CONTROL_s *pBalancing = TEST_BAL_GetBalancingControl();
+    DATA_BLOCK_CELL_VOLTAGE_s *pCellVoltage    = TEST_BAL_GetCellVoltage();
+    for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+        pCellVoltage->cellVoltage_mV[0u][0u][cb] = voltage_mV;
+        pBalancing->deltaCharge_mAs[0u][0u][cb]  = (uint32_t)cb * 1000u;
+    }
+    pCellVoltage->invalidCellVoltage[0u][0u] = 0u;
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    SE_GetStateOfChargeFromVoltage_Stub(TEST_GetStateOfChargeFromVoltage);
+    TEST_BAL_CalculateChargeTable();
 }
 
 void tearDown(void) {
@@ -121,3 +146,144 @@ void testBalancingFinished(void) {
     balancingState->initializationFinished = STD_OK;
     TEST_ASSERT_EQUAL(STD_OK, BAL_GetInitializationState());
 }
+
+void testChargeTableInterpolatesLinearly(void) {
+    /* the stub is linear, therefore interpolation between table entries is exact */
+    TEST_ASSERT_UINT32_WITHIN(1u, 1000u * TEST_CHARGE_PER_mV_mAs, TEST_BAL_GetCharge_mAs(3700));
+    TEST_ASSERT_UINT32_WITHIN(1u, 1007u * TEST_CHARGE_PER_mV_mAs, TEST_BAL_GetCharge_mAs(3707));
+    TEST_ASSERT_UINT32_WITHIN(1u, 1300u * TEST_CHARGE_PER_mV_mAs, TEST_BAL_GetCharge_mAs(4000));
+}
+
+void testChargeTableIsClampedToTableRange(void) {
+    const int16_t minimumVoltage_mV = bc_stateOfChargeLookupTable[bc_stateOfChargeLookupTableLength - 1u].voltage_mV;
+    TEST_ASSERT_EQUAL_UINT32(TEST_BAL_GetCharge_mAs(minimumVoltage_mV), TEST_BAL_GetCharge_mAs(0));
+    TEST_ASSERT_EQUAL_UINT32(TEST_BAL_GetCharge_mAs(minimumVoltage_mV), TEST_BAL_GetCharge_mAs(INT16_MIN));
+    TEST_ASSERT_EQUAL_UINT32(TEST_BAL_GetCharge_mAs(INT16_MAX), TEST_BAL_GetCharge_mAs(6000));
+    TEST_ASSERT_TRUE(TEST_BAL_GetCharge_mAs(INT16_MAX) > TEST_BAL_GetCharge_mAs(4200));
+}
+
+void testBleedCurrent(void) {
+    /* 100 ohm balancing resistor */
+    TEST_ASSERT_UINT32_WITHIN(1u, 37u, TEST_BAL_GetBleedCurrent_mA(3700));
+    TEST_ASSERT_EQUAL_UINT32(0u, TEST_BAL_GetBleedCurrent_mA(0));
+    TEST_ASSERT_EQUAL_UINT32(0u, TEST_BAL_GetBleedCurrent_mA(-100));
+}
+
+void testPlanModuleBalancesLargestChargeFirst(void) {
+    /* low voltage: power budget is not limiting, only the number of channels */
+    TEST_SetModule(2000);
+    const uint32_t plan = TEST_BAL_PlanModule(0u, 0u);
+    /* the eight cell blocks with the largest remaining charge, i.e., 10 to 17 */
+    TEST_ASSERT_EQUAL_HEX32(0x3FC00u, plan);
+}
+
+void testPlanModuleRespectsPowerLimit(void) {
+    /* about 135mW per channel: only seven channels fit into the power budget of the module */
+    TEST_SetModule(3700);
+    const uint32_t plan = TEST_BAL_PlanModule(0u, 0u);
+    TEST_ASSERT_EQUAL_HEX32(0x3F800u, plan);
+}
+
+void testPlanModuleSkipsBalancedCellBlocks(void) {
+    DATA_BLOCK_BALANCING_CONTROL_s *pBalancing = TEST_BAL_GetBalancingControl();
+    TEST_SetModule(2000);
+    for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+        pBalancing->deltaCharge_mAs[0u][0u][cb] = 0u;
+    }
+    pBalancing->deltaCharge_mAs[0u][0u][3u] = 1u;
+    pBalancing->deltaCharge_mAs[0u][0u][7u] = 500u;
+    TEST_ASSERT_EQUAL_HEX32((1u << 3u) | (1u << 7u), TEST_BAL_PlanModule(0u, 0u));
+}
+
+void testPlanModuleInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(TEST_BAL_PlanModule(BS_NR_OF_STRINGS, 0u));
+    TEST_ASSERT_FAIL_ASSERT(TEST_BAL_PlanModule(0u, BS_NR_OF_MODULES_PER_STRING));
+}
+
+void testActivateBalancingReducesRemainingCharge(void) {
+    DATA_BLOCK_BALANCING_CONTROL_s *pBalancing = TEST_BAL_GetBalancingControl();
+    BAL_STATE_s *pBalancingState               = TEST_BAL_GetBalancingState();
+    TEST_SetModule(2000);
+    pBalancingState->balancingAllowed = true;
+    pBalancingState->active           = false;
+
+    DATA_Read2DataBlocks_IgnoreAndReturn(STD_OK);
+    DATA_Write1DataBlock_IgnoreAndReturn(STD_OK);
+    TEST_BAL_ActivateBalancing();
+
+    const uint32_t bleedCharge_mAs = (TEST_BAL_GetBleedCurrent_mA(2000) * BAL_FSM_BALANCING_TIME_100ms) / 10u;
+    TEST_ASSERT_EQUAL_HEX32(0x3FC00u, pBalancing->balancingPlan[0u][0u]);
+    TEST_ASSERT_EQUAL_UINT16(8u, pBalancing->nrBalancedCells[0u]);
+    TEST_ASSERT_TRUE(pBalancingState->active);
+    TEST_ASSERT_EQUAL_UINT32(9000u, pBalancing->deltaCharge_mAs[0u][0u][9u]);
+    TEST_ASSERT_EQUAL_UINT32(10000u - bleedCharge_mAs, pBalancing->deltaCharge_mAs[0u][0u][10u]);
+    TEST_ASSERT_EQUAL_UINT32(17000u - bleedCharge_mAs, pBalancing->deltaCharge_mAs[0u][0u][17u]);
+}
+
+void testActivateBalancingSaturatesRemainingCharge(void) {
+    DATA_BLOCK_BALANCING_CONTROL_s *pBalancing = TEST_BAL_GetBalancingControl();
+    BAL_STATE_s *pBalancingState               = TEST_BAL_GetBalancingState();
+    TEST_SetModule(2000);
+    for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+        pBalancing->deltaCharge_mAs[0u][0u][cb] = 0u;
+    }
+    pBalancing->deltaCharge_mAs[0u][0u][1u] = 1u;
+    pBalancingState->balancingAllowed       = true;
+
+    DATA_Read2DataBlocks_IgnoreAndReturn(STD_OK);
+    DATA_Write1DataBlock_IgnoreAndReturn(STD_OK);
+    TEST_BAL_ActivateBalancing();
+
+    TEST_ASSERT_EQUAL_HEX32((1u << 1u), pBalancing->balancingPlan[0u][0u]);
+    TEST_ASSERT_EQUAL_UINT32(0u, pBalancing->deltaCharge_mAs[0u][0u][1u]);
+}
+
+void testActivateBalancingNotAllowed(void) {
+    DATA_BLOCK_BALANCING_CONTROL_s *pBalancing = TEST_BAL_GetBalancingControl();
+    BAL_STATE_s *pBalancingState               = TEST_BAL_GetBalancingState();
+    TEST_SetModule(2000);
+    pBalancingState->balancingAllowed = false;
+
+    DATA_Read2DataBlocks_IgnoreAndReturn(STD_OK);
+    DATA_Write1DataBlock_IgnoreAndReturn(STD_OK);
+    TEST_BAL_ActivateBalancing();
+
+    TEST_ASSERT_EQUAL_HEX32(0u, pBalancing->balancingPlan[0u][0u]);
+    TEST_ASSERT_EQUAL_UINT16(0u, pBalancing->nrBalancedCells[0u]);
+    TEST_ASSERT_EQUAL_UINT32(17000u, pBalancing->deltaCharge_mAs[0u][0u][17u]);
+}
+
+void testComputeImbalances(void) {
+    DATA_BLOCK_BALANCING_CONTROL_s *pBalancing = TEST_BAL_GetBalancingControl();
+    DATA_BLOCK_CELL_VOLTAGE_s *pCellVoltage    = TEST_BAL_GetCellVoltage();
+    DATA_BLOCK_MIN_MAX_s minMax                = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+    TEST_SetModule(3000);
+    minMax.minimumCellVoltage_mV[0u] = 3000;
+    /* threshold: 100mV + hysteresis */
+    const int16_t threshold_mV = 100 + BAL_HYSTERESIS_mV;
+    /* below threshold */
+    pCellVoltage->cellVoltage_mV[0u][0u][1u] = 3000 + threshold_mV - 1;
+    /* at threshold */
+    pCellVoltage->cellVoltage_mV[0u][0u][2u] = 3000 + threshold_mV;
+    /* above threshold, but invalid */
+    pCellVoltage->cellVoltage_mV[0u][0u][3u] = 3600;
+    BITSET_WriteBit(&pCellVoltage->invalidCellVoltage[0u][0u], 3u, true);
+    /* above threshold */
+    pCellVoltage->cellVoltage_mV[0u][0u][4u] = 3500;
+
+    DATA_Read3DataBlocks_ExpectAndReturn(pBalancing, pCellVoltage, &minMax, STD_OK);
+    DATA_Read3DataBlocks_IgnoreArg_pDataToReceiver0();
+    DATA_Read3DataBlocks_IgnoreArg_pDataToReceiver1();
+    DATA_Read3DataBlocks_IgnoreArg_pDataToReceiver2();
+    DATA_Read3DataBlocks_ReturnThruPtr_pDataToReceiver2(&minMax);
+    BAL_GetBalancingThreshold_mV_ExpectAndReturn(100);
+    DATA_Write1DataBlock_IgnoreAndReturn(STD_OK);
+    TEST_BAL_ComputeImbalances();
+
+    TEST_ASSERT_EQUAL_UINT32(0u, pBalancing->deltaCharge_mAs[0u][0u][0u]);
+    TEST_ASSERT_EQUAL_UINT32(0u, pBalancing->deltaCharge_mAs[0u][0u][1u]);
+    TEST_ASSERT_UINT32_WITHIN(
+        2u, (uint32_t)threshold_mV * TEST_CHARGE_PER_mV_mAs, pBalancing->deltaCharge_mAs[0u][0u][2u]);
+    TEST_ASSERT_EQUAL_UINT32(0u, pBalancing->deltaCharge_mAs[0u][0u][3u]);
+    TEST_ASSERT_UINT32_WITHIN(2u, 500u * TEST_CHARGE_PER_mV_mAs, pBalancing->deltaCharge_mAs[0u][0u][4u]);
+}
@@ -43,7 +43,7 @@
  * @file    test_bms.c
  * @author  foxBMS Team
  * @date    2020-04-01 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -64,6 +64,7 @@
 #include "Mockimd.h"
 #include "Mockinterlock.h"
 #include "Mockled.h"
+#include "Mocklog.h"
 #include "Mockmeas.h"
 #include "Mockos.h"
 #include "Mockplausibility.h"
@@ -99,6 +100,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/led")
 TEST_INCLUDE_PATH("../../src/app/driver/meas")
 TEST_INCLUDE_PATH("../../src/app/driver/sps")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
+TEST_INCLUDE_PATH("../../src/app/engine/log")
 TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
 TEST_INCLUDE_PATH("../../src/app/task/config")
 
@@ -618,7 +620,7 @@ void testBMS_GetClosestString(void) {
     resetStaticVariablesToDefault();
 }
 
-/** check that the asynchronous BmsState message is sent when state or substate change */
+/** check that the asynchronous BmsState message is sent and logged when state or substate change */
 void testBmsStateMessageIsRequested(void) {
     OS_GetTickCount_ExpectAndReturn(0u);
     OS_EnterTaskCritical_Expect();
@@ -638,6 +640,8 @@ void testBmsStateMessageIsRequested(void) {
     OS_EnterTaskCritical_Expect();
     OS_ExitTaskCritical_Expect();
     CANTX_TransmitBmsState_ExpectAndReturn(STD_OK);
+    LOG_Write_ExpectAndReturn(
+        LOG_MESSAGE_ID_BMS_STATE, BMS_FSM_STATE_INITIALIZATION, BMS_FSM_SUBSTATE_ENTRY, 0u, 0u, STD_OK);
     BMS_Trigger();
 
     OS_EnterTaskCritical_Expect();
@@ -661,6 +665,8 @@ void testBmsStateMessageIsRequested(void) {
     DIAG_Handler_ExpectAndReturn(DIAG_ID_ALERT_MODE, DIAG_EVENT_OK, 0, 0, STD_OK);
 
     CANTX_TransmitBmsState_ExpectAndReturn(STD_OK);
+    LOG_Write_ExpectAndReturn(
+        LOG_MESSAGE_ID_BMS_STATE, BMS_FSM_STATE_INITIALIZED, BMS_FSM_SUBSTATE_ENTRY, 0u, 0u, STD_OK);
     BMS_Trigger();
 }
 
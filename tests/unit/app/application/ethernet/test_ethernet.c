@@ -43,7 +43,7 @@
  * @file    test_ethernet.c
  * @author  foxBMS Team
  * @date    2025-07-24 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -69,7 +69,9 @@
 #include "MockNetworkInterface_custom.h"
 #include "Mockethernet_cfg.h"
 #include "Mockethernet_freertos.h"
+#include "Mockethernet_telemetry.h"
 #include "Mockinfinite-loop-helper.h"
+#include "Mockmem_pool.h"
 #include "Mockmpu_prototypes.h"
 #include "Mockos.h"
 #include "Mockutils.h"
@@ -87,6 +89,8 @@ TEST_INCLUDE_PATH("../../src/app/driver/emac")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
 TEST_INCLUDE_PATH("../../src/app/driver/uart")
+TEST_INCLUDE_PATH("../../src/app/engine/config")
+TEST_INCLUDE_PATH("../../src/app/engine/mem_pool")
 TEST_INCLUDE_PATH("../../src/os/freertos/freertos-plus/freertos-plus-tcp/source/include")
 TEST_INCLUDE_PATH("../../src/os/freertos/freertos-plus/freertos-plus-tcp/source/portable/Compiler/CCS")
 TEST_INCLUDE_PATH("../../src/os/freertos/freertos-plus/freertos-plus-tcp/source/portable/NetworkInterface/tms570lc435")
@@ -500,6 +504,7 @@ void testApplicationIPNetworkEventHook_Multi(void) {
         eth_testSocketQueue);
     ETH_CreateListeningTask_ExpectAndReturn(ETH_ListenForConnection_Ptr, &(testEndPoints[0]), 0);
     ETH_CreateEchoServerTask_ExpectAndReturn(ETH_EchoServerInstance_Ptr, 0);
+    ETH_CreateTelemetryTask_ExpectAndReturn(ETH_RunTelemetryServer, 0);
     /* ======= RT1/2: Call function under test */
     vApplicationIPNetworkEventHook_Multi(eNetworkUp, &(testEndPoints[0]));
 
@@ -552,3 +557,37 @@ void testApplicationDNSQueryHook_Multi(void) {
     /* ======= RT1/1: Call function under test */
     xApplicationDNSQueryHook_Multi(&(testEndPoints[0]), testName);
 }
+
+/**
+ * @brief   Testing the FreeRTOS+TCP memory hooks #ETH_AllocateSocket,
+ *          #ETH_FreeSocket, #ETH_AllocateTcpBuffer and #ETH_FreeTcpBuffer
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - none
+ *          - Routine validation:
+ *            - RT1/2: sockets are taken from and returned to the socket pool
+ *            - RT2/2: TCP buffers are taken from and returned to the TCP
+ *                     buffer pool
+ */
+void testETH_MemoryHooks(void) {
+    /* ======= Routine tests =============================================== */
+    uint8_t testBlock[8u] = {0u};
+
+    /* ======= RT1/2: Test implementation */
+    MPOOL_Allocate_ExpectAndReturn(MPOOL_ID_SOCKET, 100u, (void *)testBlock);
+    MPOOL_Free_Expect(MPOOL_ID_SOCKET, (void *)testBlock);
+    /* ======= RT1/2: Call function under test */
+    void *pSocket = ETH_AllocateSocket(100u);
+    ETH_FreeSocket(pSocket);
+    /* ======= RT1/2: Test output verification */
+    TEST_ASSERT_EQUAL_PTR(testBlock, pSocket);
+
+    /* ======= RT2/2: Test implementation */
+    MPOOL_Allocate_ExpectAndReturn(MPOOL_ID_TCP_BUFFER, 1096u, NULL_PTR);
+    MPOOL_Free_Expect(MPOOL_ID_TCP_BUFFER, NULL_PTR);
+    /* ======= RT2/2: Call function under test */
+    void *pBuffer = ETH_AllocateTcpBuffer(1096u);
+    ETH_FreeTcpBuffer(pBuffer);
+    /* ======= RT2/2: Test output verification */
+    TEST_ASSERT_NULL(pBuffer);
+}
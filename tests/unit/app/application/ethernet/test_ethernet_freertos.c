@@ -73,10 +73,12 @@ TEST_INCLUDE_PATH("../../src/os/freertos/freertos-plus/freertos-plus-tcp/source/
 /* Mock handles */
 OS_TASK_HANDLE mock_task_handle_listening   = (OS_TASK_HANDLE)0x12345678;
 OS_TASK_HANDLE mock_task_handle_echo_server = (OS_TASK_HANDLE)0x12347679;
+OS_TASK_HANDLE mock_task_handle_telemetry   = (OS_TASK_HANDLE)0x1234767A;
 
 /* Test variables */
 TaskFunction_t test_task_function  = (TaskFunction_t)0x11111111;
 TaskFunction_t test_task_function2 = (TaskFunction_t)0x11111112;
+TaskFunction_t test_task_function3 = (TaskFunction_t)0x11111113;
 NetworkEndPoint_t test_endpoint;
 Socket_t test_socket = (Socket_t)0x22222222;
 
@@ -169,6 +171,54 @@ void testETH_CreateEchoServerTask(void) {
     TEST_ASSERT_EQUAL(ETH_OK, result);
 }
 
+/**
+ * @brief   Testing externalized function
+ *          #ETH_CreateTelemetryTask
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/1: Invalid taskFunction pointer &rarr; assert
+ *          - Routine validation:
+ *            - RT1/2: Call function the first time
+ *            - RT2/2: Call function a second time &rarr; task is not created again
+ *
+ */
+void testETH_CreateTelemetryTask(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/1 ======= */
+    TEST_ASSERT_FAIL_ASSERT(ETH_CreateTelemetryTask(NULL_PTR));
+
+    /* ======= Routine tests =============================================== */
+    static StackType_t eth_stackTelemetry[2048] = {0};
+    static StaticTask_t eth_taskTelemetry       = {0};
+    /* ======= RT1/2: Test implementation */
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+
+    MPU_xTaskCreateStatic_ExpectAndReturn(
+        test_task_function3,
+        "Telemetry-Task",
+        512, /* Size in words */
+        NULL_PTR,
+        PRIORITY_BELOW_NORMAL,
+        &eth_stackTelemetry[0],
+        &eth_taskTelemetry,
+        mock_task_handle_telemetry);
+
+    /* ======= RT1/2: Call function under test */
+    ETH_RETURN_TYPE_e result = ETH_CreateTelemetryTask(test_task_function3);
+    /* ======= RT1/2: Test output verification */
+    TEST_ASSERT_EQUAL(ETH_OK, result);
+
+    /* ======= RT2/2: Test implementation */
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+
+    /* ======= RT2/2: Call function under test */
+    result = ETH_CreateTelemetryTask(test_task_function3);
+    /* ======= RT2/2: Test output verification */
+    TEST_ASSERT_EQUAL(ETH_TASK_ALREADY_CREATED, result);
+}
+
 /**
  * @brief   Testing externalized function
  *          #ETH_DeleteCurrentTask
@@ -0,0 +1,534 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    test_ethernet_telemetry.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the ethernet telemetry server
+ * @details Test functions:
+ *          - testETH_RunTelemetryServer
+ *          - testETH_ProcessTelemetryRequest
+ *          - testETH_GetTelemetryRecordLength
+ *          - testETH_IsTelemetryStreamDue
+ *          - testETH_SerializeTelemetryRecord
+ *          - testETH_TransmitTelemetryStreams
+ *
+ */
+
+/*========== Includes =======================================================*/
+/* 'FreeRTOS_IP.h' can not be mocked (see test_ethernet.c), therefore dummy
+ * implementations of the zero copy buffer functions are provided below. */
+#include "unity.h"
+#include "MockFreeRTOS_Routing.h"
+#include "MockFreeRTOS_Sockets.h"
+#include "Mockdatabase.h"
+#include "Mockinfinite-loop-helper.h"
+#include "Mockmpu_prototypes.h"
+#include "Mockos.h"
+
+#include "battery_system_cfg.h"
+#include "database_cfg.h"
+#include "ethernet_cfg.h"
+
+#include "FreeRTOS_IP.h"
+
+#include "ethernet_telemetry.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("ethernet_telemetry.c")
+TEST_INCLUDE_PATH("../../src/app/application/ethernet")
+TEST_INCLUDE_PATH("../../src/os/freertos/freertos-plus/freertos-plus-tcp/source/include")
+TEST_INCLUDE_PATH("../../src/os/freertos/freertos-plus/freertos-plus-tcp/source/portable/Compiler/CCS")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+#define TEST_CELL_VOLTAGE_RECORD_LENGTH \
+    (ETH_TELEMETRY_RECORD_HEADER_LENGTH + (2u * BS_NR_OF_STRINGS * BS_NR_OF_CELL_BLOCKS_PER_STRING))
+#define TEST_PACK_VALUES_RECORD_LENGTH (ETH_TELEMETRY_RECORD_HEADER_LENGTH + (4u * 4u))
+
+static Socket_t testSocket = (Socket_t)0x22222222;
+
+static struct freertos_sockaddr testClient      = {.sin_port = 1234u, .sin_address.ulIP_IPv4 = 0x0A000001u};
+static struct freertos_sockaddr testOtherClient = {.sin_port = 1234u, .sin_address.ulIP_IPv4 = 0x0A000002u};
+
+static uint8_t testPayloadBuffer[ipconfigNETWORK_MTU]      = {0u};
+static bool testPayloadBufferAvailable                     = true;
+static uint32_t testReleasedPayloadBuffers                 = 0u;
+static uint32_t testDatabaseTimestamp                      = 0u;
+static int32_t testSendtoReturnValue                       = 0;
+static size_t testSentLength                               = 0u;
+static uint8_t testSentStreams[ETH_TELEMETRY_STREAM_E_MAX] = {0u};
+
+void *FreeRTOS_GetUDPPayloadBuffer_Multi(size_t uxRequestedSizeBytes, TickType_t uxBlockTimeTicks, uint8_t ucIPType) {
+    TEST_ASSERT_TRUE(uxRequestedSizeBytes <= sizeof(testPayloadBuffer));
+    TEST_ASSERT_EQUAL(0u, uxBlockTimeTicks);
+    TEST_ASSERT_EQUAL(ipTYPE_IPv4, ucIPType);
+    void *pBuffer = NULL_PTR;
+    if (testPayloadBufferAvailable == true) {
+        pBuffer = testPayloadBuffer;
+    }
+    return pBuffer;
+}
+
+void FreeRTOS_ReleaseUDPPayloadBuffer(void const *pvBuffer) {
+    TEST_ASSERT_EQUAL_PTR(testPayloadBuffer, pvBuffer);
+    testReleasedPayloadBuffers++;
+}
+
+static int32_t TEST_FreeRTOS_sendto(
+    Socket_t xSocket,
+    const void *pvBuffer,
+    size_t uxTotalDataLength,
+    BaseType_t xFlags,
+    const struct freertos_sockaddr *pxDestinationAddress,
+    socklen_t xDestinationAddressLength,
+    int cmock_num_calls) {
+    TEST_ASSERT_EQUAL_PTR(testSocket, xSocket);
+    TEST_ASSERT_EQUAL_PTR(testPayloadBuffer, pvBuffer);
+    TEST_ASSERT_EQUAL(FREERTOS_ZERO_COPY, xFlags);
+    TEST_ASSERT_EQUAL(testClient.sin_address.ulIP_IPv4, pxDestinationAddress->sin_address.ulIP_IPv4);
+    TEST_ASSERT_EQUAL(sizeof(struct freertos_sockaddr), xDestinationAddressLength);
+    (void)cmock_num_calls;
+    testSentLength = uxTotalDataLength;
+    testSentStreams[testPayloadBuffer[2u]]++;
+    return testSendtoReturnValue;
+}
+
+static STD_RETURN_TYPE_e TEST_DATA_Read1DataBlock(void *pDataToReceiver0, int cmock_num_calls) {
+    (void)cmock_num_calls;
+    DATA_BLOCK_HEADER_s *pHeader = (DATA_BLOCK_HEADER_s *)pDataToReceiver0;
+    pHeader->timestamp           = testDatabaseTimestamp;
+    if (pHeader->uniqueId == DATA_BLOCK_ID_PACK_VALUES) {
+        DATA_BLOCK_PACK_VALUES_s *pPackValues = (DATA_BLOCK_PACK_VALUES_s *)pDataToReceiver0;
+        pPackValues->packCurrent_mA           = -2;
+        pPackValues->invalidPackCurrent       = 0u;
+        pPackValues->batteryVoltage_mV        = 0x01020304;
+        pPackValues->invalidBatteryVoltage    = 0u;
+        pPackValues->highVoltageBusVoltage_mV = 400000;
+        pPackValues->invalidHvBusVoltage      = 0u;
+        pPackValues->packPower_W              = 1000;
+        pPackValues->invalidPackPower         = 1u;
+    } else if (pHeader->uniqueId == DATA_BLOCK_ID_CELL_VOLTAGE) {
+        DATA_BLOCK_CELL_VOLTAGE_s *pCellVoltage = (DATA_BLOCK_CELL_VOLTAGE_s *)pDataToReceiver0;
+        pCellVoltage->cellVoltage_mV[0u][0u][0u] = 3700;
+        pCellVoltage->cellVoltage_mV[0u][0u][1u] = 3701;
+        /* cell block 0 is valid, cell block 1 is invalid */
+        pCellVoltage->invalidCellVoltage[0u][0u] = 0x2u;
+    } else {
+        /* cell temperatures are not checked */
+    }
+    return STD_OK;
+}
+
+/** sends a request of the given client */
+static STD_RETURN_TYPE_e TEST_SendRequest(
+    uint8_t command,
+    uint8_t stream,
+    uint16_t period_ms,
+    const struct freertos_sockaddr *pClient,
+    uint32_t timestamp) {
+    const uint8_t request[ETH_TELEMETRY_REQUEST_LENGTH] = {
+        command, stream, (uint8_t)(period_ms >> 8u), (uint8_t)period_ms};
+    return TEST_ETH_ProcessTelemetryRequest(request, (int32_t)sizeof(request), pClient, timestamp);
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    TEST_ETH_ResetTelemetry();
+    memset(testPayloadBuffer, 0, sizeof(testPayloadBuffer));
+    memset(testSentStreams, 0, sizeof(testSentStreams));
+    testPayloadBufferAvailable = true;
+    testReleasedPayloadBuffers = 0u;
+    testDatabaseTimestamp      = 0u;
+    testSendtoReturnValue      = 0;
+    testSentLength             = 0u;
+    FreeRTOS_sendto_Stub(TEST_FreeRTOS_sendto);
+    DATA_Read1DataBlock_Stub(TEST_DATA_Read1DataBlock);
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+/**
+ * @brief   Testing extern function #ETH_RunTelemetryServer
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/1: pParameters is not NULL_PTR &rarr; assert
+ *          - Routine validation:
+ *            - RT1/1: socket is created and bound to the telemetry port
+ */
+void testETH_RunTelemetryServer(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/1 ======= */
+    TEST_ASSERT_FAIL_ASSERT(ETH_RunTelemetryServer((void *)0x1u));
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/1: Test implementation */
+    FreeRTOS_socket_ExpectAndReturn(FREERTOS_AF_INET, FREERTOS_SOCK_DGRAM, FREERTOS_IPPROTO_UDP, testSocket);
+    FreeRTOS_setsockopt_IgnoreAndReturn(pdFREERTOS_ERRNO_NONE);
+    FreeRTOS_bind_IgnoreAndReturn(pdFREERTOS_ERRNO_NONE);
+    FOREVER_ExpectAndReturn(false);
+    /* ======= RT1/1: Call function under test */
+    ETH_RunTelemetryServer(NULL_PTR);
+}
+
+/**
+ * @brief   Testing static function #ETH_ProcessTelemetryRequest
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/2: pRequest is NULL_PTR &rarr; assert
+ *            - AT2/2: pClient is NULL_PTR &rarr; assert
+ *          - Routine validation:
+ *            - RT1/7: invalid length, command or stream &rarr; request is rejected
+ *            - RT2/7: subscribe &rarr; stream is subscribed
+ *            - RT3/7: unsubscribe &rarr; stream is no longer subscribed
+ *            - RT4/7: request of another client while the current client is
+ *                     active &rarr; request is rejected
+ *            - RT5/7: request of another client after the timeout of the
+ *                     current client &rarr; subscriptions of the previous
+ *                     client are cleared
+ *            - RT6/7: current client cancels all subscriptions &rarr; another
+ *                     client is accepted
+ *            - RT7/7: period below the cycle time &rarr; cycle time is used
+ */
+void testETH_ProcessTelemetryRequest(void) {
+    const uint8_t request[ETH_TELEMETRY_REQUEST_LENGTH] = {0u};
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/2 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_ETH_ProcessTelemetryRequest(NULL_PTR, 4, &testClient, 0u));
+    /* ======= AT2/2 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_ETH_ProcessTelemetryRequest(request, 4, NULL_PTR, 0u));
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/7: Call function under test */
+    TEST_ASSERT_EQUAL(STD_NOT_OK, TEST_ETH_ProcessTelemetryRequest(request, 3, &testClient, 0u));
+    TEST_ASSERT_EQUAL(STD_NOT_OK, TEST_ETH_ProcessTelemetryRequest(request, 5, &testClient, 0u));
+    TEST_ASSERT_EQUAL(STD_NOT_OK, TEST_SendRequest(0u, 0u, 0u, &testClient, 0u));
+    TEST_ASSERT_EQUAL(
+        STD_NOT_OK,
+        TEST_SendRequest(
+            ETH_TELEMETRY_COMMAND_SUBSCRIBE, (uint8_t)ETH_TELEMETRY_STREAM_E_MAX, 100u, &testClient, 0u));
+    /* ======= RT1/7: Test output verification */
+    TEST_ASSERT_FALSE(TEST_ETH_IsTelemetryStreamSubscribed(ETH_TELEMETRY_STREAM_CELL_VOLTAGE));
+
+    /* ======= RT2/7: Call function under test */
+    TEST_ASSERT_EQUAL(
+        STD_OK,
+        TEST_SendRequest(ETH_TELEMETRY_COMMAND_SUBSCRIBE, ETH_TELEMETRY_STREAM_CELL_VOLTAGE, 100u, &testClient, 0u));
+    /* ======= RT2/7: Test output verification */
+    TEST_ASSERT_TRUE(TEST_ETH_IsTelemetryStreamSubscribed(ETH_TELEMETRY_STREAM_CELL_VOLTAGE));
+    TEST_ASSERT_FALSE(TEST_ETH_IsTelemetryStreamSubscribed(ETH_TELEMETRY_STREAM_PACK_VALUES));
+
+    /* ======= RT3/7: Call function under test */
+    TEST_ASSERT_EQUAL(
+        STD_OK,
+        TEST_SendRequest(ETH_TELEMETRY_COMMAND_UNSUBSCRIBE, ETH_TELEMETRY_STREAM_CELL_VOLTAGE, 0u, &testClient, 0u));
+    /* ======= RT3/7: Test output verification */
+    TEST_ASSERT_FALSE(TEST_ETH_IsTelemetryStreamSubscribed(ETH_TELEMETRY_STREAM_CELL_VOLTAGE));
+
+    /* ======= RT4/7: Call function under test */
+    TEST_ASSERT_EQUAL(
+        STD_OK,
+        TEST_SendRequest(ETH_TELEMETRY_COMMAND_SUBSCRIBE, ETH_TELEMETRY_STREAM_CELL_VOLTAGE, 100u, &testClient, 0u));
+    TEST_ASSERT_EQUAL(
+        STD_NOT_OK,
+        TEST_SendRequest(
+            ETH_TELEMETRY_COMMAND_SUBSCRIBE,
+            ETH_TELEMETRY_STREAM_PACK_VALUES,
+            100u,
+            &testOtherClient,
+            ETH_TELEMETRY_SUBSCRIPTION_TIMEOUT_ms - 1u));
+    /* ======= RT4/7: Test output verification */
+    TEST_ASSERT_TRUE(TEST_ETH_IsTelemetryStreamSubscribed(ETH_TELEMETRY_STREAM_CELL_VOLTAGE));
+    TEST_ASSERT_FALSE(TEST_ETH_IsTelemetryStreamSubscribed(ETH_TELEMETRY_STREAM_PACK_VALUES));
+
+    /* ======= RT5/7: Call function under test */
+    TEST_ASSERT_EQUAL(
+        STD_OK,
+        TEST_SendRequest(
+            ETH_TELEMETRY_COMMAND_SUBSCRIBE,
+            ETH_TELEMETRY_STREAM_PACK_VALUES,
+            100u,
+            &testOtherClient,
+            ETH_TELEMETRY_SUBSCRIPTION_TIMEOUT_ms));
+    /* ======= RT5/7: Test output verification */
+    TEST_ASSERT_FALSE(TEST_ETH_IsTelemetryStreamSubscribed(ETH_TELEMETRY_STREAM_CELL_VOLTAGE));
+    TEST_ASSERT_TRUE(TEST_ETH_IsTelemetryStreamSubscribed(ETH_TELEMETRY_STREAM_PACK_VALUES));
+
+    /* ======= RT6/7: Call function under test */
+    TEST_ASSERT_EQUAL(
+        STD_OK,
+        TEST_SendRequest(
+            ETH_TELEMETRY_COMMAND_UNSUBSCRIBE,
+            ETH_TELEMETRY_STREAM_PACK_VALUES,
+            0u,
+            &testOtherClient,
+            ETH_TELEMETRY_SUBSCRIPTION_TIMEOUT_ms));
+    TEST_ASSERT_EQUAL(
+        STD_OK,
+        TEST_SendRequest(
+            ETH_TELEMETRY_COMMAND_SUBSCRIBE,
+            ETH_TELEMETRY_STREAM_CELL_VOLTAGE,
+            100u,
+            &testClient,
+            ETH_TELEMETRY_SUBSCRIPTION_TIMEOUT_ms));
+    /* ======= RT6/7: Test output verification */
+    TEST_ASSERT_TRUE(TEST_ETH_IsTelemetryStreamSubscribed(ETH_TELEMETRY_STREAM_CELL_VOLTAGE));
+    TEST_ASSERT_FALSE(TEST_ETH_IsTelemetryStreamSubscribed(ETH_TELEMETRY_STREAM_PACK_VALUES));
+
+    /* ======= RT7/7: Test implementation */
+    testSendtoReturnValue = 1;
+    /* the current client renews its subscriptions after RT6/7 */
+    const uint32_t timestamp_ms = ETH_TELEMETRY_SUBSCRIPTION_TIMEOUT_ms + 1000u;
+    /* ======= RT7/7: Call function under test */
+    TEST_ASSERT_EQUAL(
+        STD_OK,
+        TEST_SendRequest(
+            ETH_TELEMETRY_COMMAND_SUBSCRIBE, ETH_TELEMETRY_STREAM_CELL_TEMPERATURE, 1u, &testClient, timestamp_ms));
+    /* ======= RT7/7: Test output verification */
+    TEST_ASSERT_TRUE(TEST_ETH_IsTelemetryStreamDue(ETH_TELEMETRY_STREAM_CELL_TEMPERATURE, timestamp_ms));
+    TEST_ETH_TransmitTelemetryStreams(testSocket, timestamp_ms);
+    TEST_ASSERT_FALSE(TEST_ETH_IsTelemetryStreamDue(
+        ETH_TELEMETRY_STREAM_CELL_TEMPERATURE, timestamp_ms + ETH_TELEMETRY_CYCLE_TIME_ms - 1u));
+    TEST_ASSERT_TRUE(TEST_ETH_IsTelemetryStreamDue(
+        ETH_TELEMETRY_STREAM_CELL_TEMPERATURE, timestamp_ms + ETH_TELEMETRY_CYCLE_TIME_ms));
+}
+
+/**
+ * @brief   Testing static function #ETH_GetTelemetryRecordLength
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/1: invalid stream &rarr; assert
+ *          - Routine validation:
+ *            - RT1/1: record length of each stream
+ */
+void testETH_GetTelemetryRecordLength(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/1 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_ETH_GetTelemetryRecordLength(ETH_TELEMETRY_STREAM_E_MAX));
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/1: Call function under test and test output verification */
+    TEST_ASSERT_EQUAL(
+        TEST_CELL_VOLTAGE_RECORD_LENGTH, TEST_ETH_GetTelemetryRecordLength(ETH_TELEMETRY_STREAM_CELL_VOLTAGE));
+    TEST_ASSERT_EQUAL(
+        ETH_TELEMETRY_RECORD_HEADER_LENGTH + (2u * BS_NR_OF_STRINGS * BS_NR_OF_TEMP_SENSORS_PER_STRING),
+        TEST_ETH_GetTelemetryRecordLength(ETH_TELEMETRY_STREAM_CELL_TEMPERATURE));
+    TEST_ASSERT_EQUAL(
+        TEST_PACK_VALUES_RECORD_LENGTH, TEST_ETH_GetTelemetryRecordLength(ETH_TELEMETRY_STREAM_PACK_VALUES));
+}
+
+/**
+ * @brief   Testing static function #ETH_IsTelemetryStreamDue
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/1: invalid stream &rarr; assert
+ *          - Routine validation:
+ *            - RT1/3: stream is not subscribed &rarr; not due
+ *            - RT2/3: periodic stream is due after its period
+ *            - RT3/3: on-update stream is due when the database entry changed
+ */
+void testETH_IsTelemetryStreamDue(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/1 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_ETH_IsTelemetryStreamDue(ETH_TELEMETRY_STREAM_E_MAX, 0u));
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/3: Call function under test and test output verification */
+    TEST_ASSERT_FALSE(TEST_ETH_IsTelemetryStreamDue(ETH_TELEMETRY_STREAM_PACK_VALUES, 1000u));
+
+    /* ======= RT2/3: Test implementation */
+    testSendtoReturnValue = (int32_t)TEST_PACK_VALUES_RECORD_LENGTH;
+    TEST_SendRequest(ETH_TELEMETRY_COMMAND_SUBSCRIBE, ETH_TELEMETRY_STREAM_PACK_VALUES, 100u, &testClient, 1000u);
+    /* ======= RT2/3: Call function under test and test output verification */
+    TEST_ASSERT_TRUE(TEST_ETH_IsTelemetryStreamDue(ETH_TELEMETRY_STREAM_PACK_VALUES, 1000u));
+    TEST_ETH_TransmitTelemetryStreams(testSocket, 1000u);
+    TEST_ASSERT_FALSE(TEST_ETH_IsTelemetryStreamDue(ETH_TELEMETRY_STREAM_PACK_VALUES, 1099u));
+    TEST_ASSERT_TRUE(TEST_ETH_IsTelemetryStreamDue(ETH_TELEMETRY_STREAM_PACK_VALUES, 1100u));
+
+    /* ======= RT3/3: Test implementation */
+    testSendtoReturnValue = (int32_t)TEST_CELL_VOLTAGE_RECORD_LENGTH;
+    testDatabaseTimestamp = 500u;
+    TEST_SendRequest(ETH_TELEMETRY_COMMAND_SUBSCRIBE, ETH_TELEMETRY_STREAM_CELL_VOLTAGE, 0u, &testClient, 1000u);
+    TEST_ETH_TransmitTelemetryStreams(testSocket, 1000u);
+    TEST_ASSERT_EQUAL(1u, testSentStreams[ETH_TELEMETRY_STREAM_CELL_VOLTAGE]);
+    /* ======= RT3/3: Call function under test and test output verification */
+    TEST_ETH_TransmitTelemetryStreams(testSocket, 1010u);
+    TEST_ASSERT_EQUAL(1u, testSentStreams[ETH_TELEMETRY_STREAM_CELL_VOLTAGE]);
+    TEST_ASSERT_FALSE(TEST_ETH_IsTelemetryStreamDue(ETH_TELEMETRY_STREAM_CELL_VOLTAGE, 1010u));
+    testDatabaseTimestamp = 510u;
+    TEST_ETH_TransmitTelemetryStreams(testSocket, 1020u);
+    TEST_ASSERT_EQUAL(2u, testSentStreams[ETH_TELEMETRY_STREAM_CELL_VOLTAGE]);
+}
+
+/**
+ * @brief   Testing static function #ETH_SerializeTelemetryRecord
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/2: pBuffer is NULL_PTR &rarr; assert
+ *            - AT2/2: invalid stream &rarr; assert
+ *          - Routine validation:
+ *            - RT1/2: pack values record with header and invalid value
+ *            - RT2/2: cell voltage record with invalid value
+ */
+void testETH_SerializeTelemetryRecord(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/2 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_ETH_SerializeTelemetryRecord(NULL_PTR, ETH_TELEMETRY_STREAM_PACK_VALUES));
+    /* ======= AT2/2 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_ETH_SerializeTelemetryRecord(testPayloadBuffer, ETH_TELEMETRY_STREAM_E_MAX));
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/2: Test implementation */
+    testSendtoReturnValue = (int32_t)TEST_PACK_VALUES_RECORD_LENGTH;
+    testDatabaseTimestamp = 0x11223344u;
+    TEST_SendRequest(ETH_TELEMETRY_COMMAND_SUBSCRIBE, ETH_TELEMETRY_STREAM_PACK_VALUES, 100u, &testClient, 0u);
+    /* ======= RT1/2: Call function under test */
+    TEST_ETH_TransmitTelemetryStreams(testSocket, 0u);
+    /* ======= RT1/2: Test output verification */
+    const uint8_t expectedPackValues[TEST_PACK_VALUES_RECORD_LENGTH] = {
+        ETH_TELEMETRY_SYNC_BYTE,
+        ETH_TELEMETRY_PROTOCOL_VERSION,
+        (uint8_t)ETH_TELEMETRY_STREAM_PACK_VALUES,
+        4u,
+        0x00u, /* sequence */
+        0x00u,
+        0x00u, /* number of values */
+        0x04u,
+        0x11u, /* timestamp */
+        0x22u,
+        0x33u,
+        0x44u,
+        0xFFu, /* pack current: -2 mA */
+        0xFFu,
+        0xFFu,
+        0xFEu,
+        0x01u, /* battery voltage */
+        0x02u,
+        0x03u,
+        0x04u,
+        0x00u, /* high voltage bus voltage: 400000 mV */
+        0x06u,
+        0x1Au,
+        0x80u,
+        0x80u, /* pack power: invalid */
+        0x00u,
+        0x00u,
+        0x00u,
+    };
+    TEST_ASSERT_EQUAL(TEST_PACK_VALUES_RECORD_LENGTH, testSentLength);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedPackValues, testPayloadBuffer, TEST_PACK_VALUES_RECORD_LENGTH);
+
+    /* ======= RT2/2: Test implementation */
+    testSendtoReturnValue = (int32_t)TEST_CELL_VOLTAGE_RECORD_LENGTH;
+    TEST_SendRequest(ETH_TELEMETRY_COMMAND_SUBSCRIBE, ETH_TELEMETRY_STREAM_CELL_VOLTAGE, 100u, &testClient, 0u);
+    /* ======= RT2/2: Call function under test */
+    TEST_ETH_TransmitTelemetryStreams(testSocket, 0u);
+    /* ======= RT2/2: Test output verification */
+    TEST_ASSERT_EQUAL((uint8_t)ETH_TELEMETRY_STREAM_CELL_VOLTAGE, testPayloadBuffer[2u]);
+    TEST_ASSERT_EQUAL(2u, testPayloadBuffer[3u]);
+    TEST_ASSERT_EQUAL_HEX8(0x0Eu, testPayloadBuffer[ETH_TELEMETRY_RECORD_HEADER_LENGTH]);
+    TEST_ASSERT_EQUAL_HEX8(0x74u, testPayloadBuffer[ETH_TELEMETRY_RECORD_HEADER_LENGTH + 1u]);
+    TEST_ASSERT_EQUAL_HEX8(0x80u, testPayloadBuffer[ETH_TELEMETRY_RECORD_HEADER_LENGTH + 2u]);
+    TEST_ASSERT_EQUAL_HEX8(0x00u, testPayloadBuffer[ETH_TELEMETRY_RECORD_HEADER_LENGTH + 3u]);
+}
+
+/**
+ * @brief   Testing static function #ETH_TransmitTelemetryStreams
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/1: socket is NULL_PTR &rarr; assert
+ *          - Routine validation:
+ *            - RT1/4: no network buffer available &rarr; nothing is sent
+ *            - RT2/4: stack does not accept the buffer &rarr; buffer is released
+ *            - RT3/4: record is sent &rarr; sequence number is incremented
+ *            - RT4/4: subscription is not renewed &rarr; subscription expires
+ */
+void testETH_TransmitTelemetryStreams(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/1 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_ETH_TransmitTelemetryStreams(NULL_PTR, 0u));
+
+    /* ======= Routine tests =============================================== */
+    TEST_SendRequest(ETH_TELEMETRY_COMMAND_SUBSCRIBE, ETH_TELEMETRY_STREAM_PACK_VALUES, 100u, &testClient, 0u);
+
+    /* ======= RT1/4: Test implementation */
+    testPayloadBufferAvailable = false;
+    /* ======= RT1/4: Call function under test */
+    TEST_ETH_TransmitTelemetryStreams(testSocket, 0u);
+    /* ======= RT1/4: Test output verification */
+    TEST_ASSERT_EQUAL(0u, testSentStreams[ETH_TELEMETRY_STREAM_PACK_VALUES]);
+    TEST_ASSERT_TRUE(TEST_ETH_IsTelemetryStreamDue(ETH_TELEMETRY_STREAM_PACK_VALUES, 0u));
+
+    /* ======= RT2/4: Test implementation */
+    testPayloadBufferAvailable = true;
+    testSendtoReturnValue      = 0;
+    /* ======= RT2/4: Call function under test */
+    TEST_ETH_TransmitTelemetryStreams(testSocket, 0u);
+    /* ======= RT2/4: Test output verification */
+    TEST_ASSERT_EQUAL(1u, testReleasedPayloadBuffers);
+    TEST_ASSERT_TRUE(TEST_ETH_IsTelemetryStreamDue(ETH_TELEMETRY_STREAM_PACK_VALUES, 0u));
+
+    /* ======= RT3/4: Test implementation */
+    testSendtoReturnValue = (int32_t)TEST_PACK_VALUES_RECORD_LENGTH;
+    /* ======= RT3/4: Call function under test */
+    TEST_ETH_TransmitTelemetryStreams(testSocket, 0u);
+    TEST_ETH_TransmitTelemetryStreams(testSocket, 100u);
+    /* ======= RT3/4: Test output verification */
+    TEST_ASSERT_EQUAL(1u, testReleasedPayloadBuffers);
+    TEST_ASSERT_EQUAL(0x01u, testPayloadBuffer[5u]);
+
+    /* ======= RT4/4: Call function under test */
+    TEST_ETH_TransmitTelemetryStreams(testSocket, ETH_TELEMETRY_SUBSCRIPTION_TIMEOUT_ms);
+    /* ======= RT4/4: Test output verification */
+    TEST_ASSERT_FALSE(TEST_ETH_IsTelemetryStreamSubscribed(ETH_TELEMETRY_STREAM_PACK_VALUES));
+}
@@ -43,7 +43,7 @@
  * @file    test_redundancy.c
  * @author  foxBMS Team
  * @date    2020-07-31 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -61,6 +61,7 @@
 #include "Mockdiag.h"
 #include "Mockos.h"
 #include "Mockplausibility.h"
+#include "Mocksys_mon_latency.h"
 
 #include "foxmath.h"
 #include "redundancy.h"
@@ -81,6 +82,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
 TEST_INCLUDE_PATH("../../src/app/driver/sps")
 TEST_INCLUDE_PATH("../../src/app/engine/database")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
+TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
 TEST_INCLUDE_PATH("../../src/app/task/config")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
@@ -101,12 +103,39 @@ static inline void injectDatabaseEntries(void) {
         STD_OK);
 }
 
+/**
+ * @brief   Expects the checks of #MRC_ValidateAfeMeasurement for AFE
+ *          measurements that have never been updated
+ */
+static void expectAfeMeasurementNeverUpdated(void) {
+    DATA_DatabaseEntryUpdatedAtLeastOnce_ExpectAndReturn(testCellVoltageRedundancy0.header, false);
+    DATA_EntryUpdatedWithinInterval_ExpectAndReturn(
+        testCellVoltageBase.header, MRC_AFE_MEASUREMENT_PERIOD_TIMEOUT_ms, false);
+    DIAG_Handler_ExpectAndReturn(
+        DIAG_ID_BASE_CELL_VOLTAGE_MEASUREMENT_TIMEOUT, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u, STD_OK);
+    DATA_EntryUpdatedWithinInterval_ExpectAndReturn(
+        testCellVoltageRedundancy0.header, MRC_AFE_MEASUREMENT_PERIOD_TIMEOUT_ms, false);
+    DIAG_Handler_ExpectAndReturn(
+        DIAG_ID_REDUNDANCY0_CELL_VOLTAGE_MEASUREMENT_TIMEOUT, DIAG_EVENT_OK, DIAG_SYSTEM, 0u, STD_OK);
+
+    DATA_DatabaseEntryUpdatedAtLeastOnce_ExpectAndReturn(testCellTemperatureRedundancy0.header, false);
+    DATA_EntryUpdatedWithinInterval_ExpectAndReturn(
+        testCellTemperatureBase.header, MRC_AFE_MEASUREMENT_PERIOD_TIMEOUT_ms, false);
+    DIAG_Handler_ExpectAndReturn(
+        DIAG_ID_BASE_CELL_TEMPERATURE_MEASUREMENT_TIMEOUT, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u, STD_OK);
+    DATA_EntryUpdatedWithinInterval_ExpectAndReturn(
+        testCellTemperatureRedundancy0.header, MRC_AFE_MEASUREMENT_PERIOD_TIMEOUT_ms, false);
+    DIAG_Handler_ExpectAndReturn(
+        DIAG_ID_REDUNDANCY0_CELL_TEMPERATURE_MEASUREMENT_TIMEOUT, DIAG_EVENT_OK, DIAG_SYSTEM, 0u, STD_OK);
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
     testCellVoltageBase.header.timestamp            = 0;
     testCellVoltageRedundancy0.header.timestamp     = 0;
     testCellTemperatureBase.header.timestamp        = 0;
     testCellTemperatureRedundancy0.header.timestamp = 0;
+    SYSM_RecordLatency_Ignore();
 }
 
 void tearDown(void) {
@@ -210,6 +239,19 @@ void testMRC_UpdateCellVoltageValidationNullPointer(void) {
     TEST_ASSERT_FAIL_ASSERT(TEST_MRC_UpdateCellVoltageValidation(&dummy, NULL_PTR));
 }
 
+void testMRC_UpdateCellVoltageValidationKeepsAcquisitionTimestamp(void) {
+    DATA_BLOCK_CELL_VOLTAGE_s measured  = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_BASE};
+    DATA_BLOCK_CELL_VOLTAGE_s validated = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    measured.header.timestamp            = 100u;
+    measured.header.acquisitionTimestamp = 12345u;
+
+    TEST_ASSERT_EQUAL(STD_OK, TEST_MRC_UpdateCellVoltageValidation(&measured, &validated));
+    /* the header identifies the validated entry, only the provenance is taken over */
+    TEST_ASSERT_EQUAL(DATA_BLOCK_ID_CELL_VOLTAGE, validated.header.uniqueId);
+    TEST_ASSERT_EQUAL(0u, validated.header.timestamp);
+    TEST_ASSERT_EQUAL(12345u, validated.header.acquisitionTimestamp);
+}
+
 void testMRC_ValidateCellTemperatureNullPointer(void) {
     DATA_BLOCK_CELL_TEMPERATURE_s dummy = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
     TEST_ASSERT_FAIL_ASSERT(TEST_MRC_ValidateCellTemperature(NULL_PTR, &dummy, &dummy));
@@ -227,29 +269,89 @@ void testMRC_UpdateCellTemperatureValidationNullPointer(void) {
 void testMRC_AfeMeasurementValidationTickZeroNothingToDo(void) {
     /* inject database entries into function */
     injectDatabaseEntries();
+    expectAfeMeasurementNeverUpdated();
 
-    /* database entries never written - */
-    DATA_DatabaseEntryUpdatedAtLeastOnce_ExpectAndReturn(testCellVoltageRedundancy0.header, false);
-    DATA_EntryUpdatedWithinInterval_ExpectAndReturn(
-        testCellVoltageBase.header, MRC_AFE_MEASUREMENT_PERIOD_TIMEOUT_ms, false);
-    DIAG_Handler_ExpectAndReturn(
-        DIAG_ID_BASE_CELL_VOLTAGE_MEASUREMENT_TIMEOUT, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u, STD_OK);
-    DATA_EntryUpdatedWithinInterval_ExpectAndReturn(
-        testCellVoltageRedundancy0.header, MRC_AFE_MEASUREMENT_PERIOD_TIMEOUT_ms, false);
-    DIAG_Handler_ExpectAndReturn(
-        DIAG_ID_REDUNDANCY0_CELL_VOLTAGE_MEASUREMENT_TIMEOUT, DIAG_EVENT_OK, DIAG_SYSTEM, 0u, STD_OK);
+    TEST_ASSERT_PASS_ASSERT(TEST_ASSERT_EQUAL(STD_NOT_OK, MRC_ValidateAfeMeasurement()));
+}
 
-    DATA_DatabaseEntryUpdatedAtLeastOnce_ExpectAndReturn(testCellTemperatureRedundancy0.header, false);
-    DATA_EntryUpdatedWithinInterval_ExpectAndReturn(
-        testCellTemperatureBase.header, MRC_AFE_MEASUREMENT_PERIOD_TIMEOUT_ms, false);
-    DIAG_Handler_ExpectAndReturn(
-        DIAG_ID_BASE_CELL_TEMPERATURE_MEASUREMENT_TIMEOUT, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u, STD_OK);
-    DATA_EntryUpdatedWithinInterval_ExpectAndReturn(
-        testCellTemperatureRedundancy0.header, MRC_AFE_MEASUREMENT_PERIOD_TIMEOUT_ms, false);
-    DIAG_Handler_ExpectAndReturn(
-        DIAG_ID_REDUNDANCY0_CELL_TEMPERATURE_MEASUREMENT_TIMEOUT, DIAG_EVENT_OK, DIAG_SYSTEM, 0u, STD_OK);
+void testMRC_GetNumberOfInputUpdates(void) {
+    const DATA_BLOCK_ID_e testInputs[] = {DATA_BLOCK_ID_CURRENT, DATA_BLOCK_ID_POWER};
+    TEST_ASSERT_FAIL_ASSERT(TEST_MRC_GetNumberOfInputUpdates(NULL_PTR, 2u));
 
-    TEST_ASSERT_PASS_ASSERT(TEST_ASSERT_EQUAL(STD_NOT_OK, MRC_ValidateAfeMeasurement()));
+    DATA_GetNumberOfWrites_ExpectAndReturn(DATA_BLOCK_ID_CURRENT, 3u);
+    DATA_GetNumberOfWrites_ExpectAndReturn(DATA_BLOCK_ID_POWER, 4u);
+    TEST_ASSERT_EQUAL_UINT32(7u, TEST_MRC_GetNumberOfInputUpdates(testInputs, 2u));
+
+    /* sum wraps around */
+    DATA_GetNumberOfWrites_ExpectAndReturn(DATA_BLOCK_ID_CURRENT, UINT32_MAX);
+    DATA_GetNumberOfWrites_ExpectAndReturn(DATA_BLOCK_ID_POWER, 2u);
+    TEST_ASSERT_EQUAL_UINT32(1u, TEST_MRC_GetNumberOfInputUpdates(testInputs, 2u));
+}
+
+void testMRC_IsValidationDue(void) {
+    MRC_VALIDATION_TRIGGER_s testTrigger = {.numberOfInputUpdates = 10u, .lastValidationTimestamp = 1000u};
+    TEST_ASSERT_FAIL_ASSERT(TEST_MRC_IsValidationDue(NULL_PTR, 0u, 0u));
+
+    /* no new input and fallback period not elapsed -> nothing to do */
+    TEST_ASSERT_FALSE(TEST_MRC_IsValidationDue(&testTrigger, 10u, 1000u + MRC_VALIDATION_FALLBACK_PERIOD_ms - 1u));
+    TEST_ASSERT_EQUAL_UINT32(10u, testTrigger.numberOfInputUpdates);
+    TEST_ASSERT_EQUAL_UINT32(1000u, testTrigger.lastValidationTimestamp);
+
+    /* new input -> validate immediately */
+    TEST_ASSERT_TRUE(TEST_MRC_IsValidationDue(&testTrigger, 11u, 1010u));
+    TEST_ASSERT_EQUAL_UINT32(11u, testTrigger.numberOfInputUpdates);
+    TEST_ASSERT_EQUAL_UINT32(1010u, testTrigger.lastValidationTimestamp);
+
+    /* same input is not validated twice */
+    TEST_ASSERT_FALSE(TEST_MRC_IsValidationDue(&testTrigger, 11u, 1020u));
+
+    /* no new input, but fallback period elapsed -> validate to detect stale measurements */
+    TEST_ASSERT_TRUE(TEST_MRC_IsValidationDue(&testTrigger, 11u, 1010u + MRC_VALIDATION_FALLBACK_PERIOD_ms));
+    TEST_ASSERT_EQUAL_UINT32(1010u + MRC_VALIDATION_FALLBACK_PERIOD_ms, testTrigger.lastValidationTimestamp);
+
+    /* fallback period across the overflow of the timer */
+    testTrigger.lastValidationTimestamp = UINT32_MAX - 9u;
+    TEST_ASSERT_FALSE(TEST_MRC_IsValidationDue(&testTrigger, 11u, 10u));
+    TEST_ASSERT_TRUE(TEST_MRC_IsValidationDue(&testTrigger, 11u, MRC_VALIDATION_FALLBACK_PERIOD_ms - 10u));
+}
+
+void testMRC_TriggerNoNewInputs(void) {
+    MRC_STATE_s *pState                            = TEST_MRC_GetState();
+    pState->afeValidation.numberOfInputUpdates     = 4u;
+    pState->afeValidation.lastValidationTimestamp  = 1000u;
+    pState->packValidation.numberOfInputUpdates    = 5u;
+    pState->packValidation.lastValidationTimestamp = 1000u;
+
+    /* every input entry has been written once, which has already been validated */
+    OS_GetTickCount_ExpectAndReturn(1010u);
+    DATA_GetNumberOfWrites_IgnoreAndReturn(1u);
+
+    /* no validation is expected */
+    MRC_Trigger();
+}
+
+void testMRC_TriggerNewAfeInputs(void) {
+    MRC_STATE_s *pState                            = TEST_MRC_GetState();
+    pState->afeValidation.numberOfInputUpdates     = 4u;
+    pState->afeValidation.lastValidationTimestamp  = 1000u;
+    pState->packValidation.numberOfInputUpdates    = 10u;
+    pState->packValidation.lastValidationTimestamp = 1000u;
+
+    /* every input entry has been written twice: the AFE inputs changed since
+       the last validation, the pack inputs did not */
+    OS_GetTickCount_ExpectAndReturn(1010u);
+    DATA_GetNumberOfWrites_IgnoreAndReturn(2u);
+
+    /* only the AFE measurement is validated */
+    injectDatabaseEntries();
+    expectAfeMeasurementNeverUpdated();
+
+    MRC_Trigger();
+
+    TEST_ASSERT_EQUAL_UINT32(8u, pState->afeValidation.numberOfInputUpdates);
+    TEST_ASSERT_EQUAL_UINT32(1010u, pState->afeValidation.lastValidationTimestamp);
+    TEST_ASSERT_EQUAL_UINT32(10u, pState->packValidation.numberOfInputUpdates);
+    TEST_ASSERT_EQUAL_UINT32(1000u, pState->packValidation.lastValidationTimestamp);
 }
 
 void testMRC_ValidateCellVoltageMeasurement(void) {
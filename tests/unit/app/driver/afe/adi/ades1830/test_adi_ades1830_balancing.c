@@ -43,7 +43,7 @@
  * @file    test_adi_ades1830_balancing.c
  * @author  foxBMS Team
  * @date    2019-08-27 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup DRIVERS
  * @prefix  ADI
@@ -189,16 +189,16 @@ void testADI_DetermineBalancingRegisterConfiguration(void) {
                         ADI_GetStoredVoltageIndex_ExpectAndReturn(c, c);
                     }
                     /* Reset balancing control table */
-                    adi_stateBase.data.balancingControl->activateBalancing[s][m][c] = false;
+                    adi_stateBase.data.balancingControl->balancingPlan[s][m] &= ~(1u << c);
                     /* Set balancing control table values for 0xAA pattern */
                     if (data == 0xAAu) {
                         if (c % 2u != 0u) {
-                            adi_stateBase.data.balancingControl->activateBalancing[s][m][c] = true;
+                            adi_stateBase.data.balancingControl->balancingPlan[s][m] |= (1u << c);
                         }
                     } /* Set balancing control table values for 0x55 pattern */
                     if (data == 0x55u) {
                         if (c % 2u == 0u) {
-                            adi_stateBase.data.balancingControl->activateBalancing[s][m][c] = true;
+                            adi_stateBase.data.balancingControl->balancingPlan[s][m] |= (1u << c);
                         }
                     }
                 }
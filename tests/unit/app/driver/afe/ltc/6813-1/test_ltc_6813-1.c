@@ -66,6 +66,7 @@
 #include "Mockos.h"
 #include "Mockpex.h"
 #include "Mockspi.h"
+#include "Mocksys_mon_latency.h"
 #include "Mocktsi.h"
 
 #include "ltc_6813-1_cfg.h"
@@ -91,6 +92,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/pex")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
 TEST_INCLUDE_PATH("../../src/app/driver/ts/api")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
+TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
 /* SPI data configuration struct for LTC communication */
@@ -120,6 +122,8 @@ static const AFE_PLAUSIBILITY_VALUES_s ltc_plausibleCellVoltages681x = {
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    SYSM_GetAcquisitionTimestamp_IgnoreAndReturn(1u);
+    SYSM_RecordLatency_Ignore();
 }
 
 void tearDown(void) {
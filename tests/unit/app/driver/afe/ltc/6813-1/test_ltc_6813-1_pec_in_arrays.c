@@ -66,6 +66,7 @@
 #include "Mockos.h"
 #include "Mockpex.h"
 #include "Mockspi.h"
+#include "Mocksys_mon_latency.h"
 #include "Mocktsi.h"
 
 #include "ltc_6813-1_cfg.h"
@@ -90,6 +91,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/pex")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
 TEST_INCLUDE_PATH("../../src/app/driver/ts/api")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
+TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
 /* SPI data configuration struct for LTC communication */
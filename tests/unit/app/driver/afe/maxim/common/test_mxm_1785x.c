@@ -43,7 +43,7 @@
  * @file    test_mxm_1785x.c
  * @author  foxBMS Team
  * @date    2020-07-02 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  MXM
@@ -310,17 +310,20 @@ void testMXM_ProcessOpenWire1SatelliteAlternatingPattern(void) {
 
     /* check for the injected pattern */
     for (uint8_t i = 0u; i < 8; i = i + 2) {
-        TEST_ASSERT_EQUAL(1, mxm_instance.pOpenWire_table->openWire[0][i]);
+        TEST_ASSERT_TRUE(BITSET_IsBitSet(mxm_instance.pOpenWire_table->openWire[0][0], i));
     }
     for (uint8_t i = 1u; i < 8; i = i + 2) {
-        TEST_ASSERT_EQUAL(0, mxm_instance.pOpenWire_table->openWire[0][i]);
+        TEST_ASSERT_FALSE(BITSET_IsBitSet(mxm_instance.pOpenWire_table->openWire[0][0], i));
     }
     for (uint8_t i = 8u; i < MXM_MAXIMUM_NR_OF_CELLS_PER_MODULE; i = i + 2) {
-        TEST_ASSERT_EQUAL(0, mxm_instance.pOpenWire_table->openWire[0][i]);
+        TEST_ASSERT_FALSE(BITSET_IsBitSet(mxm_instance.pOpenWire_table->openWire[0][0], i));
     }
     for (uint8_t i = 9u; i < MXM_MAXIMUM_NR_OF_CELLS_PER_MODULE; i = i + 2) {
-        TEST_ASSERT_EQUAL(1, mxm_instance.pOpenWire_table->openWire[0][i]);
+        TEST_ASSERT_TRUE(BITSET_IsBitSet(mxm_instance.pOpenWire_table->openWire[0][0], i));
     }
+    /* the bits above the last cell of the module are not set */
+    TEST_ASSERT_EQUAL_HEX32(
+        0xAA55u & BITSET_GetMask(MXM_MAXIMUM_NR_OF_CELLS_PER_MODULE), mxm_instance.pOpenWire_table->openWire[0][0]);
 }
 
 void testMXM_StateMachineNullPointer(void) {
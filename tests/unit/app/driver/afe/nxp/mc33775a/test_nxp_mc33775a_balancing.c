@@ -43,7 +43,7 @@
  * @file    test_nxp_mc33775a_balancing.c
  * @author  foxBMS Team
  * @date    2025-03-20 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -156,7 +156,7 @@ void testN77x_BalanceControl(void) {
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
             for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                n77x_testState.n77xData.balancingControl->activateBalancing[s][m][cb] = true;
+                n77x_testState.n77xData.balancingControl->balancingPlan[s][m] |= (1u << cb);
             }
         }
     }
@@ -165,8 +165,8 @@ void testN77x_BalanceControl(void) {
         uint8_t deviceAddress   = m + 1u;
         uint16_t balancingState = 0u;
         for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-            if (n77x_testState.n77xData.balancingControl->activateBalancing[n77x_testState.currentString][m][cb] ==
-                true) {
+            if ((n77x_testState.n77xData.balancingControl->balancingPlan[n77x_testState.currentString][m] &
+                 (1u << cb)) != 0u) {
                 balancingState |= 1u << cb;
             }
         }
@@ -206,7 +206,7 @@ void testN77x_BalanceControl(void) {
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
             for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                n77x_testState.n77xData.balancingControl->activateBalancing[s][m][cb] = false;
+                n77x_testState.n77xData.balancingControl->balancingPlan[s][m] &= ~(1u << cb);
             }
         }
     }
@@ -215,8 +215,8 @@ void testN77x_BalanceControl(void) {
         uint8_t deviceAddress   = m + 1u;
         uint16_t balancingState = 0u;
         for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-            if (n77x_testState.n77xData.balancingControl->activateBalancing[n77x_testState.currentString][m][cb] ==
-                true) {
+            if ((n77x_testState.n77xData.balancingControl->balancingPlan[n77x_testState.currentString][m] &
+                 (1u << cb)) != 0u) {
                 balancingState |= 1u << cb;
             }
         }
@@ -43,7 +43,7 @@
  * @file    test_nxp_mc33775a_database.c
  * @author  foxBMS Team
  * @date    2025-03-21 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -124,7 +124,7 @@ void testN77x_InitializeDatabase(void) {
     TEST_ASSERT_EQUAL(0, n77xTestState.n77xData.minMax->nrCellMinimumCellVoltage[0]);
     TEST_ASSERT_EQUAL(0, n77xTestState.n77xData.minMax->nrCellMaximumCellVoltage[0]);
     TEST_ASSERT_EQUAL(0, n77xTestState.n77xData.cellVoltage->cellVoltage_mV[0][0][0]);
-    TEST_ASSERT_TRUE(n77xTestState.n77xData.cellVoltage->invalidCellVoltage[0][0][0]);
+    TEST_ASSERT_TRUE(BITSET_IsBitSet(n77xTestState.n77xData.cellVoltage->invalidCellVoltage[0][0], 0u));
 
     TEST_ASSERT_EQUAL(0, n77xTestState.n77xData.cellTemperature->state);
     TEST_ASSERT_EQUAL(0, n77xTestState.n77xData.minMax->minimumCellVoltage_mV[0]);
@@ -134,9 +134,9 @@ void testN77x_InitializeDatabase(void) {
     TEST_ASSERT_EQUAL(0, n77xTestState.n77xData.minMax->nrSensorMinimumTemperature[0]);
     TEST_ASSERT_EQUAL(0, n77xTestState.n77xData.minMax->nrSensorMaximumTemperature[0]);
     TEST_ASSERT_EQUAL(0, n77xTestState.n77xData.cellTemperature->cellTemperature_ddegC[0][0][0]);
-    TEST_ASSERT_TRUE(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0][0]);
+    TEST_ASSERT_TRUE(BITSET_IsBitSet(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0], 0u));
 
-    TEST_ASSERT_FALSE(n77xTestState.n77xData.balancingControl->activateBalancing[0][0][0]);
+    TEST_ASSERT_EQUAL_UINT32(0u, n77xTestState.n77xData.balancingControl->balancingPlan[0][0]);
 
     TEST_ASSERT_FALSE(n77xTestState.n77xData.errorTable->communicationOk[0][0]);
     TEST_ASSERT_FALSE(n77xTestState.n77xData.errorTable->noCommunicationTimeout[0][0]);
@@ -43,7 +43,7 @@
  * @file    test_nxp_mc33775a_measurement.c
  * @author  foxBMS Team
  * @date    2025-04-01 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -292,13 +292,13 @@ void testN77x_RetrieveVoltages(void) {
     /* ======= RT1/4 ======= */
     /* everything ok */
     TEST_ASSERT_PASS_ASSERT(TEST_N77x_RetrieveVoltages(&n77xTestState, 0, primaryRawValues, &gpio03Error));
-    TEST_ASSERT_FALSE(n77xTestState.n77xData.cellVoltage->invalidCellVoltage[0][0][0]);
+    TEST_ASSERT_FALSE(BITSET_IsBitSet(n77xTestState.n77xData.cellVoltage->invalidCellVoltage[0][0], 0u));
 
     /* ======= RT2/4 ======= */
     /* invalid cellVoltage */
     primaryRawValues[1] = N77X_INVALID_REGISTER_VALUE;
     TEST_ASSERT_PASS_ASSERT(TEST_N77x_RetrieveVoltages(&n77xTestState, 0, primaryRawValues, &gpio03Error));
-    TEST_ASSERT_TRUE(n77xTestState.n77xData.cellVoltage->invalidCellVoltage[0][0][0]);
+    TEST_ASSERT_TRUE(BITSET_IsBitSet(n77xTestState.n77xData.cellVoltage->invalidCellVoltage[0][0], 0u));
 
     /* ======= RT3/4 ======= */
     /* gpio03Error */
@@ -338,7 +338,7 @@ void testN77x_RetrieveTemperatures(void) {
     N77x_ConvertVoltagesToTemperatures_ExpectAndReturn(0, 1);
     TEST_N77x_RetrieveTemperatures(&n77xTestState, 0, &gpio03Error, &gpio47Error);
     TEST_ASSERT_EQUAL(1, n77xTestState.n77xData.cellTemperature->cellTemperature_ddegC[0][0][0]);
-    TEST_ASSERT_FALSE(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0][0]);
+    TEST_ASSERT_FALSE(BITSET_IsBitSet(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0], 0u));
 
     /* ======= RT2/5 ======= */
     /* everything ok; Mux1 */
@@ -347,7 +347,7 @@ void testN77x_RetrieveTemperatures(void) {
     N77x_ConvertVoltagesToTemperatures_ExpectAndReturn(0, 1);
     TEST_N77x_RetrieveTemperatures(&n77xTestState, 0, &gpio03Error, &gpio47Error);
     TEST_ASSERT_EQUAL(1, n77xTestState.n77xData.cellTemperature->cellTemperature_ddegC[0][0][8]);
-    TEST_ASSERT_FALSE(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0][8]);
+    TEST_ASSERT_FALSE(BITSET_IsBitSet(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0], 8u));
 
     /* ======= RT3/5 ======= */
     /* everything ok; inactive pin */
@@ -355,7 +355,7 @@ void testN77x_RetrieveTemperatures(void) {
     n77xTestState.pMuxSequence[n77xTestState.currentString]->muxChannel = 4u;
     TEST_N77x_RetrieveTemperatures(&n77xTestState, 0, &gpio03Error, &gpio47Error);
     TEST_ASSERT_EQUAL(1, n77xTestState.n77xData.cellTemperature->cellTemperature_ddegC[0][0][8]);
-    TEST_ASSERT_FALSE(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0][8]);
+    TEST_ASSERT_FALSE(BITSET_IsBitSet(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0], 8u));
 
     /* ======= RT4/5 ======= */
     /* everything ok; Mux in disabled state */
@@ -363,7 +363,7 @@ void testN77x_RetrieveTemperatures(void) {
     n77xTestState.pMuxSequence[n77xTestState.currentString]->muxChannel = 0xFF;
     TEST_N77x_RetrieveTemperatures(&n77xTestState, 0, &gpio03Error, &gpio47Error);
     TEST_ASSERT_EQUAL(1, n77xTestState.n77xData.cellTemperature->cellTemperature_ddegC[0][0][8]);
-    TEST_ASSERT_FALSE(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0][8]);
+    TEST_ASSERT_FALSE(BITSET_IsBitSet(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0], 8u));
 
     /* ======= RT5/5 ======= */
     /* gpio03Error */
@@ -372,7 +372,7 @@ void testN77x_RetrieveTemperatures(void) {
     n77xTestState.pMuxSequence[n77xTestState.currentString]->muxChannel = 0u;
     TEST_N77x_RetrieveTemperatures(&n77xTestState, 0, &gpio03Error, &gpio47Error);
     TEST_ASSERT_EQUAL(0, n77xTestState.n77xData.cellTemperature->cellTemperature_ddegC[0][0][0]);
-    TEST_ASSERT_TRUE(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0][0]);
+    TEST_ASSERT_TRUE(BITSET_IsBitSet(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0], 0u));
 }
 
 void testN77x_RetrieveMeasurement(void) {
@@ -423,8 +423,8 @@ void testN77x_RetrieveMeasurement(void) {
         STD_OK);
 
     TEST_ASSERT_PASS_ASSERT(TEST_N77x_RetrieveMeasurement(&n77xTestState));
-    TEST_ASSERT_FALSE(n77xTestState.n77xData.cellVoltage->invalidCellVoltage[0][0][0]);
-    TEST_ASSERT_FALSE(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0][0]);
+    TEST_ASSERT_FALSE(BITSET_IsBitSet(n77xTestState.n77xData.cellVoltage->invalidCellVoltage[0][0], 0u));
+    TEST_ASSERT_FALSE(BITSET_IsBitSet(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0], 0u));
 
     /* ======= RT2/3 ======= */
     /* Communication error */
@@ -459,8 +459,8 @@ void testN77x_RetrieveMeasurement(void) {
         STD_OK);
 
     TEST_ASSERT_PASS_ASSERT(TEST_N77x_RetrieveMeasurement(&n77xTestState));
-    TEST_ASSERT_TRUE(n77xTestState.n77xData.cellVoltage->invalidCellVoltage[0][0][0]);
-    TEST_ASSERT_TRUE(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0][0]);
+    TEST_ASSERT_TRUE(BITSET_IsBitSet(n77xTestState.n77xData.cellVoltage->invalidCellVoltage[0][0], 0u));
+    TEST_ASSERT_TRUE(BITSET_IsBitSet(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0], 0u));
 
     /* ======= RT3/3 ======= */
     /* gpio47Error */
@@ -497,6 +497,6 @@ void testN77x_RetrieveMeasurement(void) {
         STD_OK);
 
     TEST_ASSERT_PASS_ASSERT(TEST_N77x_RetrieveMeasurement(&n77xTestState));
-    TEST_ASSERT_FALSE(n77xTestState.n77xData.cellVoltage->invalidCellVoltage[0][0][0]);
-    TEST_ASSERT_FALSE(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0][0]);
+    TEST_ASSERT_FALSE(BITSET_IsBitSet(n77xTestState.n77xData.cellVoltage->invalidCellVoltage[0][0], 0u));
+    TEST_ASSERT_FALSE(BITSET_IsBitSet(n77xTestState.n77xData.cellTemperature->invalidCellTemperature[0][0], 0u));
 }
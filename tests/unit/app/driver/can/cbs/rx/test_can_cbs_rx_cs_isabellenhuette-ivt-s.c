@@ -43,7 +43,7 @@
  * @file    test_can_cbs_rx_cs_isabellenhuette-ivt-s.c
  * @author  foxBMS Team
  * @date    2021-04-22 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -57,6 +57,7 @@
 #include "unity.h"
 #include "Mockcan.h"
 #include "Mockcan_helper.h"
+#include "Mockcurrent_integration.h"
 #include "Mockdatabase.h"
 #include "Mockdiag.h"
 #include "Mockfoxmath.h"
@@ -72,6 +73,7 @@
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_SOURCE_FILE("can_cbs_rx_cs_isabellenhuette-ivt-s.c")
 
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/current_integration")
 TEST_INCLUDE_PATH("../../src/app/driver/can")
 TEST_INCLUDE_PATH("../../src/app/driver/can/cbs")
 TEST_INCLUDE_PATH("../../src/app/driver/can/cbs/rx")
@@ -263,12 +265,14 @@ void testCANRX_HandleSensorData(void) {
     testMessageId = CANRX_CS_ISABELLENHUETTE_IVT_STRING0_CURR_ID;
     OS_GetTickCount_ExpectAndReturn(0u);
     DATA_Write1DataBlock_ExpectAndReturn(can_kShim.pTableCurrent, STD_OK);
+    CINT_AddCurrentSample_ExpectAndReturn(validStringNumber, testSignalData, STD_OK);
     TEST_CANRX_HandleSensorData(&can_kShim, testMessageId, validStringNumber, testSignalData);
 
     /* case CANRX_CS_ISABELLENHUETTE_IVT_STRING0_V1_ID */
     testMessageId = CANRX_CS_ISABELLENHUETTE_IVT_STRING0_V1_ID;
     OS_GetTickCount_ExpectAndReturn(0u);
     DATA_Write1DataBlock_ExpectAndReturn(can_kShim.pTableSystemVoltage1, STD_OK);
+    CINT_SetVoltage_Expect(validStringNumber, testSignalData);
     TEST_CANRX_HandleSensorData(&can_kShim, testMessageId, validStringNumber, testSignalData);
 
     /* case CANRX_CS_ISABELLENHUETTE_IVT_STRING0_V2_ID */
@@ -322,6 +326,7 @@ void testCANRX_SetCurrent(void) {
     /* ======= Routine tests =============================================== */
     OS_GetTickCount_ExpectAndReturn(0u);
     DATA_Write1DataBlock_ExpectAndReturn(can_kShim.pTableCurrent, STD_OK);
+    CINT_AddCurrentSample_ExpectAndReturn(validStringNumber, testSignalData, STD_OK);
     TEST_CANRX_SetCurrent(&can_kShim, validStringNumber, testSignalData);
 }
 
@@ -339,6 +344,7 @@ void testCANRX_SetVoltageU1(void) {
     /* ======= Routine tests =============================================== */
     OS_GetTickCount_ExpectAndReturn(0u);
     DATA_Write1DataBlock_ExpectAndReturn(can_kShim.pTableSystemVoltage1, STD_OK);
+    CINT_SetVoltage_Expect(validStringNumber, testSignalData);
     TEST_CANRX_SetVoltageU1(&can_kShim, validStringNumber, testSignalData);
 }
 
@@ -554,6 +560,7 @@ void testCANRX_CsIsabellenhuetteIvtS(void) {
     /* Expects from CANRX_HandleSensorData call */
     OS_GetTickCount_ExpectAndReturn(0u);
     DATA_Write1DataBlock_ExpectAndReturn(can_kShim.pTableCurrent, STD_OK);
+    CINT_AddCurrentSample_ExpectAndReturn(0u, 0, STD_OK);
 
     CANRX_CsIsabellenhuetteIvtS(testMessage, &testCanData, &can_kShim);
 
@@ -603,6 +610,7 @@ void testCANRX_CsIsabellenhuetteIvtS(void) {
     /* Expects from CANRX_HandleSensorData call */
     OS_GetTickCount_ExpectAndReturn(0u);
     DATA_Write1DataBlock_ExpectAndReturn(can_kShim.pTableCurrent, STD_OK);
+    CINT_AddCurrentSample_ExpectAndReturn(0u, (int32_t)testSignalData[3u], STD_OK);
 
     CANRX_CsIsabellenhuetteIvtS(testMessage, &testCanData, &can_kShim);
 }
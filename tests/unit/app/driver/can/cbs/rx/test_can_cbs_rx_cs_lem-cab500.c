@@ -43,7 +43,7 @@
  * @file    test_can_cbs_rx_cs_lem-cab500.c
  * @author  foxBMS Team
  * @date    2025-05-01 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -56,6 +56,7 @@
 #include "unity.h"
 #include "Mockcan.h"
 #include "Mockcan_helper.h"
+#include "Mockcurrent_integration.h"
 #include "Mockdatabase.h"
 #include "Mockdiag.h"
 #include "Mockfoxmath.h"
@@ -71,6 +72,7 @@
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_SOURCE_FILE("can_cbs_rx_cs_lem-cab500.c")
 
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/current_integration")
 TEST_INCLUDE_PATH("../../src/app/driver/can")
 TEST_INCLUDE_PATH("../../src/app/driver/can/cbs")
 TEST_INCLUDE_PATH("../../src/app/driver/can/cbs/rx")
@@ -192,6 +194,7 @@ void testCANRX_LemSetCurrent(void) {
         can_kShim.pTableCurrent->timestamp[s]         = 1234u;
 
         OS_GetTickCount_ExpectAndReturn(2389u);
+        CINT_AddCurrentSample_ExpectAndReturn(s, signalData, STD_OK);
         TEST_CANRX_LemSetCurrent(&can_kShim, s, (uint32_t)(signalData + CANRX_LEM_ZERO_AMPERE_VALUE));
 
         TEST_ASSERT_EQUAL(signalData, can_kShim.pTableCurrent->current_mA[s]);
@@ -218,6 +221,7 @@ void testCANRX_LemHandleSensorData(void) {
     for (; s < BS_NR_OF_STRINGS; s++) {
         can_kShim.pTableCurrent->current_mA[s] = 0u;
         OS_GetTickCount_ExpectAndReturn(2389u);
+        CINT_AddCurrentSample_ExpectAndReturn(s, signalData, STD_OK);
         TEST_CANRX_LemHandleSensorData(
             &can_kShim, CANRX_CS_LEM_CAB500_STRING0_ID, s, (uint32_t)(signalData + CANRX_LEM_ZERO_AMPERE_VALUE));
 
@@ -299,6 +303,7 @@ void testCANRX_CsLemCab500(void) {
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         can_kShim.pTableCurrent->current_mA[s] = 0u;
         OS_GetTickCount_ExpectAndReturn(2389u);
+        CINT_AddCurrentSample_ExpectAnyArgsAndReturn(STD_OK);
 
         TEST_ASSERT_EQUAL(signalData, can_kShim.pTableCurrent->current_mA[s]);
     }
@@ -339,6 +344,7 @@ void testCANRX_CsLemCab500(void) {
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         can_kShim.pTableCurrent->current_mA[s] = 0u;
         OS_GetTickCount_ExpectAndReturn(2389u);
+        CINT_AddCurrentSample_ExpectAnyArgsAndReturn(STD_OK);
 
         TEST_ASSERT_EQUAL(signalData, can_kShim.pTableCurrent->current_mA[s]);
     }
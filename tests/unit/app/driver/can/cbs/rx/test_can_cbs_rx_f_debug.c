@@ -43,7 +43,7 @@
  * @file    test_can_cbs_rx_f_debug.c
  * @author  foxBMS Team
  * @date    2021-04-22 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -71,15 +71,20 @@
 #include "Mockfram.h"
 #include "Mockimd.h"
 #include "Mockinterlock.h"
+#include "Mocklog.h"
 #include "Mockmcu.h"
 #include "Mockmeas.h"
+#include "Mockmem_pool.h"
 #include "Mockos.h"
 #include "Mockreset.h"
 #include "Mockrtc.h"
 #include "Mocksbc.h"
-#include "Mocksof_trapezoid.h"
+#include "Mocksof.h"
 #include "Mockstate_estimation.h"
 #include "Mocksys_cfg.h"
+#include "Mocksys_mon_bus.h"
+#include "Mocksys_mon_latency.h"
+#include "Mocktrace.h"
 
 #include "database_cfg.h"
 #include "fram_cfg.h"
@@ -99,7 +104,7 @@ TEST_SOURCE_FILE("can_cbs_rx_f_debug.c")
 TEST_INCLUDE_PATH("../../src/app/application/algorithm")
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/config")
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
-TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof/trapezoid")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof")
 TEST_INCLUDE_PATH("../../src/app/application/bal")
 TEST_INCLUDE_PATH("../../src/app/application/bms")
 TEST_INCLUDE_PATH("../../src/app/driver/afe/api")
@@ -123,7 +128,11 @@ TEST_INCLUDE_PATH("../../src/app/driver/sbc/fs8x_driver")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
 TEST_INCLUDE_PATH("../../src/app/driver/sps")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
+TEST_INCLUDE_PATH("../../src/app/engine/log")
+TEST_INCLUDE_PATH("../../src/app/engine/mem_pool")
 TEST_INCLUDE_PATH("../../src/app/engine/sys")
+TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
+TEST_INCLUDE_PATH("../../src/app/engine/trace")
 TEST_INCLUDE_PATH("../../src/app/task/config")
 TEST_INCLUDE_PATH("../../src/app/task/ftask")
 
@@ -137,6 +146,11 @@ TEST_INCLUDE_PATH("../../src/app/task/ftask")
 #define MULTIPLEXER_VALUE_UPTIME_INFO             (5u)
 #define MULTIPLEXER_VALUE_BOOT_TIMESTAMP          (6u)
 #define MULTIPLEXER_VALUE_HARDWARE_IDENTIFICATION (7u)
+#define MULTIPLEXER_VALUE_LATENCY_INFO            (8u)
+#define MULTIPLEXER_VALUE_KERNEL_TRACE            (9u)
+#define MULTIPLEXER_VALUE_MEMORY_POOL_INFO        (10u)
+#define MULTIPLEXER_VALUE_BUS_INFO                (11u)
+#define MULTIPLEXER_VALUE_STACK_INFO              (12u)
 #define INVALID_MULTIPLEXER_VALUE                 (99u)
 
 #define SYS_STATE_VALID_CANRX_RETURN_VALUE   (0u)
@@ -362,6 +376,51 @@ void testCANRX_DebugIdentifyHardwareMultiplexerValue(void) {
     TEST_ASSERT_EQUAL(SYS_STATE_VALID_CANRX_RETURN_VALUE, ret);
 }
 
+/* provide a valid multiplexer value (latency information) */
+void testCANRX_DebugLatencyInfoMultiplexerValue(void) {
+    uint8_t testCanData[CAN_MAX_DLC] = {0};
+
+    testCanData[0] = MULTIPLEXER_VALUE_LATENCY_INFO; /* latency information multiplexer message */
+    uint16_t ret   = CANRX_Debug(validRxDebugTestMessage, testCanData, &can_kShim);
+    TEST_ASSERT_EQUAL(SYS_STATE_VALID_CANRX_RETURN_VALUE, ret);
+}
+
+/* provide a valid multiplexer value (kernel trace) */
+void testCANRX_DebugKernelTraceMultiplexerValue(void) {
+    uint8_t testCanData[CAN_MAX_DLC] = {0};
+
+    testCanData[0] = MULTIPLEXER_VALUE_KERNEL_TRACE; /* kernel trace multiplexer message */
+    uint16_t ret   = CANRX_Debug(validRxDebugTestMessage, testCanData, &can_kShim);
+    TEST_ASSERT_EQUAL(SYS_STATE_VALID_CANRX_RETURN_VALUE, ret);
+}
+
+/* provide a valid multiplexer value (memory pool information) */
+void testCANRX_DebugMemoryPoolInfoMultiplexerValue(void) {
+    uint8_t testCanData[CAN_MAX_DLC] = {0};
+
+    testCanData[0] = MULTIPLEXER_VALUE_MEMORY_POOL_INFO; /* memory pool information multiplexer message */
+    uint16_t ret   = CANRX_Debug(validRxDebugTestMessage, testCanData, &can_kShim);
+    TEST_ASSERT_EQUAL(SYS_STATE_VALID_CANRX_RETURN_VALUE, ret);
+}
+
+/* provide a valid multiplexer value (bus information) */
+void testCANRX_DebugBusInfoMultiplexerValue(void) {
+    uint8_t testCanData[CAN_MAX_DLC] = {0};
+
+    testCanData[0] = MULTIPLEXER_VALUE_BUS_INFO; /* bus information multiplexer message */
+    uint16_t ret   = CANRX_Debug(validRxDebugTestMessage, testCanData, &can_kShim);
+    TEST_ASSERT_EQUAL(SYS_STATE_VALID_CANRX_RETURN_VALUE, ret);
+}
+
+/* provide a valid multiplexer value (stack information) */
+void testCANRX_DebugStackInfoMultiplexerValue(void) {
+    uint8_t testCanData[CAN_MAX_DLC] = {0};
+
+    testCanData[0] = MULTIPLEXER_VALUE_STACK_INFO; /* stack information multiplexer message */
+    uint16_t ret   = CANRX_Debug(validRxDebugTestMessage, testCanData, &can_kShim);
+    TEST_ASSERT_EQUAL(SYS_STATE_VALID_CANRX_RETURN_VALUE, ret);
+}
+
 /*********************************************************************************************************************/
 /* test RTC helper functions */
 void testCANRX_GetHundredthOfSeconds(void) {
@@ -513,6 +572,26 @@ void testCANRX_TriggerIdentifyHardwareMessage(void) {
     TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_TriggerIdentifyHardwareMessage());
 }
 
+void testCANRX_TriggerLatencyStatisticsMessage(void) {
+    /* sending response message works as expected */
+    CANTX_DebugResponse_ExpectAndReturn(CANTX_DEBUG_RESPONSE_TRANSMIT_LATENCY_STATISTICS, STD_OK);
+    TEST_CANRX_TriggerLatencyStatisticsMessage();
+
+    /* sending response message does not work as expected */
+    CANTX_DebugResponse_ExpectAndReturn(CANTX_DEBUG_RESPONSE_TRANSMIT_LATENCY_STATISTICS, STD_NOT_OK);
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_TriggerLatencyStatisticsMessage());
+}
+
+void testCANRX_TriggerMemoryPoolStatisticsMessage(void) {
+    /* sending response message works as expected */
+    CANTX_DebugResponse_ExpectAndReturn(CANTX_DEBUG_RESPONSE_TRANSMIT_MEMORY_POOL_STATISTICS, STD_OK);
+    TEST_CANRX_TriggerMemoryPoolStatisticsMessage();
+
+    /* sending response message does not work as expected */
+    CANTX_DebugResponse_ExpectAndReturn(CANTX_DEBUG_RESPONSE_TRANSMIT_MEMORY_POOL_STATISTICS, STD_NOT_OK);
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_TriggerMemoryPoolStatisticsMessage());
+}
+
 /*********************************************************************************************************************/
 void testCANRX_CheckIfBmsSoftwareVersionIsRequested(void) {
     /* test endianness assertion */
@@ -642,6 +721,136 @@ void testCANRX_CheckIfIdentifyHardwareIsRequested(void) {
     TEST_ASSERT_TRUE(isRequested);
 }
 
+void testCANRX_CheckIfLatencyStatisticsIsRequested(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_CheckIfLatencyStatisticsIsRequested(testMessageDataZero, invalidEndianness));
+
+    /* test correct message -> return true */
+    /* set bit to indicate that the latency statistics are requested */
+    uint64_t testMessageData = ((uint64_t)1u) << 55u;
+    bool isRequested         = TEST_CANRX_CheckIfLatencyStatisticsIsRequested(testMessageData, validEndianness);
+    TEST_ASSERT_TRUE(isRequested);
+}
+
+void testCANRX_CheckIfLatencyStatisticsResetIsRequested(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(
+        TEST_CANRX_CheckIfLatencyStatisticsResetIsRequested(testMessageDataZero, invalidEndianness));
+
+    /* test correct message -> return true */
+    /* set bit to indicate that the latency statistics shall be reset */
+    uint64_t testMessageData = ((uint64_t)1u) << 54u;
+    bool isRequested         = TEST_CANRX_CheckIfLatencyStatisticsResetIsRequested(testMessageData, validEndianness);
+    TEST_ASSERT_TRUE(isRequested);
+}
+
+void testCANRX_CheckIfKernelTraceSnapshotIsRequested(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_CheckIfKernelTraceSnapshotIsRequested(testMessageDataZero, invalidEndianness));
+
+    /* test correct message -> return true */
+    /* set bit to indicate that a kernel trace snapshot is requested */
+    uint64_t testMessageData = ((uint64_t)1u) << 55u;
+    bool isRequested         = TEST_CANRX_CheckIfKernelTraceSnapshotIsRequested(testMessageData, validEndianness);
+    TEST_ASSERT_TRUE(isRequested);
+}
+
+void testCANRX_CheckIfKernelTraceResumeIsRequested(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_CheckIfKernelTraceResumeIsRequested(testMessageDataZero, invalidEndianness));
+
+    /* test correct message -> return true */
+    /* set bit to indicate that the kernel trace recording shall be resumed */
+    uint64_t testMessageData = ((uint64_t)1u) << 54u;
+    bool isRequested         = TEST_CANRX_CheckIfKernelTraceResumeIsRequested(testMessageData, validEndianness);
+    TEST_ASSERT_TRUE(isRequested);
+}
+
+void testCANRX_CheckIfMemoryPoolStatisticsIsRequested(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_CheckIfMemoryPoolStatisticsIsRequested(testMessageDataZero, invalidEndianness));
+
+    /* test correct message -> return true */
+    /* set bit to indicate that the memory pool statistics are requested */
+    uint64_t testMessageData = ((uint64_t)1u) << 55u;
+    bool isRequested         = TEST_CANRX_CheckIfMemoryPoolStatisticsIsRequested(testMessageData, validEndianness);
+    TEST_ASSERT_TRUE(isRequested);
+}
+
+void testCANRX_CheckIfMemoryPoolStatisticsResetIsRequested(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(
+        TEST_CANRX_CheckIfMemoryPoolStatisticsResetIsRequested(testMessageDataZero, invalidEndianness));
+
+    /* test correct message -> return true */
+    /* set bit to indicate that the memory pool statistics shall be reset */
+    uint64_t testMessageData = ((uint64_t)1u) << 54u;
+    bool isRequested         = TEST_CANRX_CheckIfMemoryPoolStatisticsResetIsRequested(testMessageData, validEndianness);
+    TEST_ASSERT_TRUE(isRequested);
+}
+
+void testCANRX_CheckIfBusStatisticsIsRequested(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_CheckIfBusStatisticsIsRequested(testMessageDataZero, invalidEndianness));
+
+    /* test correct message -> return true */
+    /* set bit to indicate that the bus statistics are requested */
+    uint64_t testMessageData = ((uint64_t)1u) << 55u;
+    bool isRequested         = TEST_CANRX_CheckIfBusStatisticsIsRequested(testMessageData, validEndianness);
+    TEST_ASSERT_TRUE(isRequested);
+}
+
+void testCANRX_CheckIfBusStatisticsResetIsRequested(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_CheckIfBusStatisticsResetIsRequested(testMessageDataZero, invalidEndianness));
+
+    /* test correct message -> return true */
+    /* set bit to indicate that the bus statistics shall be reset */
+    uint64_t testMessageData = ((uint64_t)1u) << 54u;
+    bool isRequested         = TEST_CANRX_CheckIfBusStatisticsResetIsRequested(testMessageData, validEndianness);
+    TEST_ASSERT_TRUE(isRequested);
+}
+
+void testCANRX_GetRequestedBus(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_GetRequestedBus(testMessageDataZero, invalidEndianness));
+
+    /* the bus is encoded in the lower nibble of the second byte */
+    uint64_t testMessageData = ((uint64_t)SYSM_BUS_I2C2) << 48u;
+    TEST_ASSERT_EQUAL_UINT8(SYSM_BUS_I2C2, TEST_CANRX_GetRequestedBus(testMessageData, validEndianness));
+
+    /* the trigger bits do not change the bus */
+    testMessageData = (((uint64_t)1u) << 55u) | (((uint64_t)1u) << 54u) | (((uint64_t)0xFu) << 48u);
+    TEST_ASSERT_EQUAL_UINT8(0xFu, TEST_CANRX_GetRequestedBus(testMessageData, validEndianness));
+}
+
+void testCANRX_CheckIfStackUsageIsRequested(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_CheckIfStackUsageIsRequested(testMessageDataZero, invalidEndianness));
+
+    /* no bit set -> return false */
+    TEST_ASSERT_FALSE(TEST_CANRX_CheckIfStackUsageIsRequested(testMessageDataZero, validEndianness));
+
+    /* test correct message -> return true */
+    /* set bit to indicate that the stack usage is requested */
+    uint64_t testMessageData = ((uint64_t)1u) << 55u;
+    bool isRequested         = TEST_CANRX_CheckIfStackUsageIsRequested(testMessageData, validEndianness);
+    TEST_ASSERT_TRUE(isRequested);
+}
+
+void testCANRX_GetRequestedTask(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_GetRequestedTask(testMessageDataZero, invalidEndianness));
+
+    /* the task is encoded in the lower nibble of the second byte */
+    uint64_t testMessageData = ((uint64_t)SYSM_STACK_TASK_AFE) << 48u;
+    TEST_ASSERT_EQUAL_UINT8(SYSM_STACK_TASK_AFE, TEST_CANRX_GetRequestedTask(testMessageData, validEndianness));
+
+    /* the trigger bit does not change the task */
+    testMessageData = (((uint64_t)1u) << 55u) | (((uint64_t)0xFu) << 48u);
+    TEST_ASSERT_EQUAL_UINT8(0xFu, TEST_CANRX_GetRequestedTask(testMessageData, validEndianness));
+}
+
 /*********************************************************************************************************************/
 /* test if all functions that process the multiplexer values (pattern: CANRX_Process.*Mux) */
 void testCANRX_ProcessVersionInformationMux(void) {
@@ -743,3 +952,127 @@ void testCANRX_ProcessIdentifyHardwareMux(void) {
     CANTX_DebugIdentifyHardware_ExpectAndReturn(STD_OK);
     TEST_CANRX_ProcessIdentifyHardwareMux(testMessageData, validEndianness);
 }
+
+void testCANRX_ProcessLatencyInfoMux(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_ProcessLatencyInfoMux(testMessageDataZero, invalidEndianness));
+
+    /* set bit to indicate that the latency statistics are requested */
+    uint64_t testMessageData = ((uint64_t)1u) << 55u;
+    CANTX_DebugResponse_ExpectAndReturn(CANTX_DEBUG_RESPONSE_TRANSMIT_LATENCY_STATISTICS, STD_OK);
+    TEST_CANRX_ProcessLatencyInfoMux(testMessageData, validEndianness);
+
+    /* set bit to indicate that the latency statistics shall be reset */
+    testMessageData = ((uint64_t)1u) << 54u;
+    SYSM_ResetLatencyStatistics_Expect();
+    TEST_CANRX_ProcessLatencyInfoMux(testMessageData, validEndianness);
+
+    /* request and reset: the statistics are sent before they are reset */
+    testMessageData = (((uint64_t)1u) << 55u) | (((uint64_t)1u) << 54u);
+    CANTX_DebugResponse_ExpectAndReturn(CANTX_DEBUG_RESPONSE_TRANSMIT_LATENCY_STATISTICS, STD_OK);
+    SYSM_ResetLatencyStatistics_Expect();
+    TEST_CANRX_ProcessLatencyInfoMux(testMessageData, validEndianness);
+}
+
+void testCANRX_ProcessKernelTraceMux(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_ProcessKernelTraceMux(testMessageDataZero, invalidEndianness));
+
+    /* no bit set: nothing to do */
+    TEST_CANRX_ProcessKernelTraceMux(testMessageDataZero, validEndianness);
+
+    /* set bit to indicate that a kernel trace snapshot is requested */
+    uint64_t testMessageData = ((uint64_t)1u) << 55u;
+    TRC_Freeze_Expect(TRC_FREEZE_REASON_REQUEST, 0u);
+    TEST_CANRX_ProcessKernelTraceMux(testMessageData, validEndianness);
+
+    /* set bit to indicate that the kernel trace recording shall be resumed */
+    testMessageData = ((uint64_t)1u) << 54u;
+    TRC_Resume_Expect();
+    TEST_CANRX_ProcessKernelTraceMux(testMessageData, validEndianness);
+
+    /* resume and request: the old snapshot is discarded before a new one is frozen */
+    testMessageData = (((uint64_t)1u) << 55u) | (((uint64_t)1u) << 54u);
+    TRC_Resume_Expect();
+    TRC_Freeze_Expect(TRC_FREEZE_REASON_REQUEST, 0u);
+    TEST_CANRX_ProcessKernelTraceMux(testMessageData, validEndianness);
+}
+
+void testCANRX_ProcessMemoryPoolInfoMux(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_ProcessMemoryPoolInfoMux(testMessageDataZero, invalidEndianness));
+
+    /* no bit set: nothing to do */
+    TEST_CANRX_ProcessMemoryPoolInfoMux(testMessageDataZero, validEndianness);
+
+    /* set bit to indicate that the memory pool statistics are requested */
+    uint64_t testMessageData = ((uint64_t)1u) << 55u;
+    CANTX_DebugResponse_ExpectAndReturn(CANTX_DEBUG_RESPONSE_TRANSMIT_MEMORY_POOL_STATISTICS, STD_OK);
+    TEST_CANRX_ProcessMemoryPoolInfoMux(testMessageData, validEndianness);
+
+    /* set bit to indicate that the memory pool statistics shall be reset */
+    testMessageData = ((uint64_t)1u) << 54u;
+    MPOOL_ResetStatistics_Expect();
+    TEST_CANRX_ProcessMemoryPoolInfoMux(testMessageData, validEndianness);
+
+    /* request and reset: the statistics are sent before they are reset */
+    testMessageData = (((uint64_t)1u) << 55u) | (((uint64_t)1u) << 54u);
+    CANTX_DebugResponse_ExpectAndReturn(CANTX_DEBUG_RESPONSE_TRANSMIT_MEMORY_POOL_STATISTICS, STD_OK);
+    MPOOL_ResetStatistics_Expect();
+    TEST_CANRX_ProcessMemoryPoolInfoMux(testMessageData, validEndianness);
+}
+
+void testCANRX_ProcessBusInfoMux(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_ProcessBusInfoMux(testMessageDataZero, invalidEndianness));
+
+    /* no bit set: nothing to do */
+    TEST_CANRX_ProcessBusInfoMux(testMessageDataZero, validEndianness);
+
+    /* set bit to indicate that the bus statistics of the I2C1 bus are requested */
+    uint64_t testMessageData = (((uint64_t)1u) << 55u) | (((uint64_t)SYSM_BUS_I2C1) << 48u);
+    CANTX_DebugResponseBusStatistics_ExpectAndReturn(SYSM_BUS_I2C1, STD_OK);
+    TEST_CANRX_ProcessBusInfoMux(testMessageData, validEndianness);
+
+    /* statistics of an unknown bus are requested: nothing to do */
+    testMessageData = (((uint64_t)1u) << 55u) | (((uint64_t)SYSM_BUS_E_MAX) << 48u);
+    TEST_CANRX_ProcessBusInfoMux(testMessageData, validEndianness);
+
+    /* sending the response messages does not work as expected */
+    testMessageData = ((uint64_t)1u) << 55u;
+    CANTX_DebugResponseBusStatistics_ExpectAndReturn(SYSM_BUS_SPI1, STD_NOT_OK);
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_ProcessBusInfoMux(testMessageData, validEndianness));
+
+    /* set bit to indicate that the bus statistics shall be reset */
+    testMessageData = ((uint64_t)1u) << 54u;
+    SYSM_ResetBusStatistics_Expect();
+    TEST_CANRX_ProcessBusInfoMux(testMessageData, validEndianness);
+
+    /* request and reset: the statistics are sent before they are reset */
+    testMessageData = (((uint64_t)1u) << 55u) | (((uint64_t)1u) << 54u) | (((uint64_t)SYSM_BUS_SPI4) << 48u);
+    CANTX_DebugResponseBusStatistics_ExpectAndReturn(SYSM_BUS_SPI4, STD_OK);
+    SYSM_ResetBusStatistics_Expect();
+    TEST_CANRX_ProcessBusInfoMux(testMessageData, validEndianness);
+}
+
+void testCANRX_ProcessStackInfoMux(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_ProcessStackInfoMux(testMessageDataZero, invalidEndianness));
+
+    /* no bit set: nothing to do */
+    TEST_CANRX_ProcessStackInfoMux(testMessageDataZero, validEndianness);
+
+    /* set bit to indicate that the stack usage of the AFE task is requested */
+    uint64_t testMessageData = (((uint64_t)1u) << 55u) | (((uint64_t)SYSM_STACK_TASK_AFE) << 48u);
+    CANTX_DebugResponseStackUsage_ExpectAndReturn(SYSM_STACK_TASK_AFE, STD_OK);
+    TEST_CANRX_ProcessStackInfoMux(testMessageData, validEndianness);
+
+    /* stack usage of an unknown task is requested: nothing to do */
+    testMessageData = (((uint64_t)1u) << 55u) | (((uint64_t)SYSM_STACK_TASK_E_MAX) << 48u);
+    TEST_CANRX_ProcessStackInfoMux(testMessageData, validEndianness);
+
+    /* sending the response message does not work as expected */
+    testMessageData = ((uint64_t)1u) << 55u;
+    CANTX_DebugResponseStackUsage_ExpectAndReturn(SYSM_STACK_TASK_ENGINE, STD_NOT_OK);
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_ProcessStackInfoMux(testMessageData, validEndianness));
+}
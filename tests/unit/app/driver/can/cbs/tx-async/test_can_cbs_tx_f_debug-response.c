@@ -43,7 +43,7 @@
  * @file    test_can_cbs_tx_f_debug-response.c
  * @author  foxBMS Team
  * @date    2022-08-17 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -58,8 +58,12 @@
 #include "Mockcan_helper.h"
 #include "Mockfoxmath.h"
 #include "Mockmcu.h"
+#include "Mockmem_pool.h"
 #include "Mockos.h"
 #include "Mockrtc.h"
+#include "Mocksys_mon_bus.h"
+#include "Mocksys_mon_latency.h"
+#include "Mocksys_mon_stack.h"
 #include "Mockutils.h"
 
 #include "database_cfg.h"
@@ -80,6 +84,8 @@ TEST_INCLUDE_PATH("../../src/app/driver/can/cbs/tx-async")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
 TEST_INCLUDE_PATH("../../src/app/driver/rtc")
+TEST_INCLUDE_PATH("../../src/app/engine/mem_pool")
+TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
 TEST_INCLUDE_PATH("../../src/version")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
@@ -91,6 +97,26 @@ uint8_t testCanDataZeroArray[8u] = {0u};
 
 uint8_t testCanDataFilled[8u] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
 
+SYSM_BUS_STATISTICS_s testBusStatistics = {
+    .numberOfTransfers      = 5000u,
+    .numberOfWords          = 200000u,
+    .busyTime_us            = 250000u,
+    .maximumBusyTime_us     = 800u,
+    .numberOfLockRejections = 3u,
+    .numberOfBusyRejections = 70000u,
+    .maximumWaitTime_us     = 1500u,
+    .waitHistogram          = {1u, 2u, 300u, 0u, 4u, 5u},
+    .observationTime_ms     = 1000u,
+    .utilization_perm       = 250u,
+};
+
+SYSM_STACK_USAGE_s testStackUsage = {
+    .isRegistered    = true,
+    .stackSize_B     = 70000u,
+    .maximumUsage_B  = 1800u,
+    .isLimitExceeded = true,
+};
+
 const CAN_NODE_s can_node1 = {
     .canNodeRegister = canREG1,
 };
@@ -610,6 +636,509 @@ void testCANTX_DebugResponseSendMessage(void) {
     TEST_ASSERT_EQUAL(STD_OK, testResult);
 }
 
+/**
+ * @brief   Testing CANTX_ConvertLatencyToSignal
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - None
+ *          - Routine validation:
+ *            - RT1/3: zero latency is encoded as zero
+ *            - RT2/3: latency is truncated to the signal resolution
+ *            - RT3/3: latency that does not fit into the signal saturates
+ */
+void testCANTX_ConvertLatencyToSignal(void) {
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/3: Test implementation */
+    /* ======= RT1/3: Call function under test */
+    uint16_t testResult = TEST_CANTX_ConvertLatencyToSignal(0u);
+    /* ======= RT1/3: Test output verification */
+    TEST_ASSERT_EQUAL_UINT16(0u, testResult);
+
+    /* ======= RT2/3: Test implementation */
+    /* ======= RT2/3: Call function under test */
+    testResult = TEST_CANTX_ConvertLatencyToSignal(150u);
+    /* ======= RT2/3: Test output verification */
+    TEST_ASSERT_EQUAL_UINT16(1u, testResult);
+
+    /* ======= RT3/3: Test implementation */
+    /* ======= RT3/3: Call function under test */
+    testResult = TEST_CANTX_ConvertLatencyToSignal(UINT32_MAX);
+    /* ======= RT3/3: Test output verification */
+    TEST_ASSERT_EQUAL_UINT16(UINT16_MAX, testResult);
+}
+
+/**
+ * @brief   Testing CANTX_TransmitAllLatencyStatistics
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - None
+ *          - Routine validation:
+ *            - RT1/2: statistics of all stages are sent
+ *            - RT2/2: sending stops after the first message that could not
+ *                     be queued
+ */
+void testCANTX_TransmitAllLatencyStatistics(void) {
+    SYSM_LATENCY_STATISTICS_s testStatistics = {
+        .minimum_us               = 12000u,
+        .maximum_us               = 65000u,
+        .last_us                  = 30000u,
+        .numberOfSamples          = 3u,
+        .numberOfBudgetViolations = 1u,
+    };
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/2: Test implementation */
+    for (uint8_t stage = 0u; stage < (uint8_t)SYSM_LATENCY_STAGE_E_MAX; stage++) {
+        SYSM_GetLatencyStatistics_Expect((SYSM_LATENCY_STAGE_e)stage, NULL);
+        SYSM_GetLatencyStatistics_IgnoreArg_pStatistics();
+        SYSM_GetLatencyStatistics_ReturnThruPtr_pStatistics(&testStatistics);
+        SYSM_IsLatencyBudgetExceeded_ExpectAndReturn((SYSM_LATENCY_STAGE_e)stage, true);
+        CAN_TxSetMessageDataWithSignalData_Expect(
+            &testMessageData[0u], 7u, 8u, 0x08u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+        CAN_TxSetMessageDataWithSignalData_Expect(
+            &testMessageData[0u], 15u, 4u, stage, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+        CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 11u, 1u, 1u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+        CAN_TxSetMessageDataWithSignalData_Expect(
+            &testMessageData[0u], 23u, 16u, 120u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+        CAN_TxSetMessageDataWithSignalData_Expect(
+            &testMessageData[0u], 39u, 16u, 650u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+        CAN_TxSetMessageDataWithSignalData_Expect(
+            &testMessageData[0u], 55u, 16u, 300u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+        CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[1u]);
+        CAN_TxSetCanDataWithMessageData_Expect(
+            testMessageData[1u], testCanDataZeroArray, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+        CAN_DataSend_ExpectAndReturn(
+            CAN_NODE_1, CANTX_DEBUG_RESPONSE_ID, CAN_STANDARD_IDENTIFIER_11_BIT, testCanDataZeroArray, STD_OK);
+    }
+    /* ======= RT1/2: Call function under test */
+    STD_RETURN_TYPE_e testResult = TEST_CANTX_TransmitAllLatencyStatistics();
+    /* ======= RT1/2: Test output verification */
+    TEST_ASSERT_EQUAL(STD_OK, testResult);
+
+    /* ======= RT2/2: Test implementation */
+    SYSM_GetLatencyStatistics_Expect(SYSM_LATENCY_STAGE_AFE, NULL);
+    SYSM_GetLatencyStatistics_IgnoreArg_pStatistics();
+    SYSM_GetLatencyStatistics_ReturnThruPtr_pStatistics(&testStatistics);
+    SYSM_IsLatencyBudgetExceeded_ExpectAndReturn(SYSM_LATENCY_STAGE_AFE, false);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 7u, 8u, 0x08u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 15u, 4u, 0u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 11u, 1u, 0u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 23u, 16u, 120u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 39u, 16u, 650u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 55u, 16u, 300u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[1u]);
+    CAN_TxSetCanDataWithMessageData_Expect(testMessageData[1u], testCanDataZeroArray, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_DataSend_ExpectAndReturn(
+        CAN_NODE_1, CANTX_DEBUG_RESPONSE_ID, CAN_STANDARD_IDENTIFIER_11_BIT, testCanDataZeroArray, STD_NOT_OK);
+    /* ======= RT2/2: Call function under test */
+    testResult = TEST_CANTX_TransmitAllLatencyStatistics();
+    /* ======= RT2/2: Test output verification */
+    TEST_ASSERT_EQUAL(STD_NOT_OK, testResult);
+}
+
+/**
+ * @brief   Testing CANTX_SaturateToSignalLength
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/2: length is zero &rarr; assert
+ *            - AT2/2: length is larger than 16 &rarr; assert
+ *          - Routine validation:
+ *            - RT1/2: value that fits into the signal is not changed
+ *            - RT2/2: value that does not fit into the signal saturates
+ */
+void testCANTX_SaturateToSignalLength(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/2 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_SaturateToSignalLength(0u, 0u));
+    /* ======= AT2/2 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_SaturateToSignalLength(0u, 17u));
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/2: Test implementation */
+    /* ======= RT1/2: Call function under test */
+    uint64_t testResult = TEST_CANTX_SaturateToSignalLength(255u, 8u);
+    /* ======= RT1/2: Test output verification */
+    TEST_ASSERT_EQUAL_UINT64(255u, testResult);
+
+    /* ======= RT2/2: Test implementation */
+    /* ======= RT2/2: Call function under test */
+    testResult = TEST_CANTX_SaturateToSignalLength(70000u, 16u);
+    /* ======= RT2/2: Test output verification */
+    TEST_ASSERT_EQUAL_UINT64(UINT16_MAX, testResult);
+}
+
+/**
+ * @brief   Testing CANTX_TransmitAllMemoryPoolStatistics
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - None
+ *          - Routine validation:
+ *            - RT1/2: statistics of all pools are sent, counters saturate
+ *            - RT2/2: sending stops after the first message that could not
+ *                     be queued
+ */
+void testCANTX_TransmitAllMemoryPoolStatistics(void) {
+    MPOOL_STATISTICS_s testStatistics = {
+        .blockSize_B       = 576u,
+        .numberOfBlocks    = 6u,
+        .blocksInUse       = 2u,
+        .peakBlocksInUse   = 5u,
+        .failedAllocations = 300u,
+        .largestRequest_B  = 100000u,
+    };
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/2: Test implementation */
+    for (uint8_t poolId = 0u; poolId < (uint8_t)MPOOL_ID_E_MAX; poolId++) {
+        MPOOL_GetStatistics_Expect((MPOOL_ID_e)poolId, NULL);
+        MPOOL_GetStatistics_IgnoreArg_pStatistics();
+        MPOOL_GetStatistics_ReturnThruPtr_pStatistics(&testStatistics);
+        CAN_TxSetMessageDataWithSignalData_Expect(
+            &testMessageData[0u], 7u, 8u, 0x09u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+        CAN_TxSetMessageDataWithSignalData_Expect(
+            &testMessageData[0u], 15u, 4u, poolId, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+        CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 23u, 8u, 2u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+        CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 31u, 8u, 5u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+        CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 39u, 8u, 6u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+        CAN_TxSetMessageDataWithSignalData_Expect(
+            &testMessageData[0u], 47u, 8u, 255u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+        CAN_TxSetMessageDataWithSignalData_Expect(
+            &testMessageData[0u], 55u, 16u, UINT16_MAX, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+        CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[1u]);
+        CAN_TxSetCanDataWithMessageData_Expect(
+            testMessageData[1u], testCanDataZeroArray, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+        CAN_DataSend_ExpectAndReturn(
+            CAN_NODE_1, CANTX_DEBUG_RESPONSE_ID, CAN_STANDARD_IDENTIFIER_11_BIT, testCanDataZeroArray, STD_OK);
+    }
+    /* ======= RT1/2: Call function under test */
+    STD_RETURN_TYPE_e testResult = TEST_CANTX_TransmitAllMemoryPoolStatistics();
+    /* ======= RT1/2: Test output verification */
+    TEST_ASSERT_EQUAL(STD_OK, testResult);
+
+    /* ======= RT2/2: Test implementation */
+    MPOOL_GetStatistics_Expect(MPOOL_ID_SOCKET, NULL);
+    MPOOL_GetStatistics_IgnoreArg_pStatistics();
+    MPOOL_GetStatistics_ReturnThruPtr_pStatistics(&testStatistics);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 7u, 8u, 0x09u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 15u, 4u, 0u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 23u, 8u, 2u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 31u, 8u, 5u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 39u, 8u, 6u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 47u, 8u, 255u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(
+        &testMessageData[0u], 55u, 16u, UINT16_MAX, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[1u]);
+    CAN_TxSetCanDataWithMessageData_Expect(testMessageData[1u], testCanDataZeroArray, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_DataSend_ExpectAndReturn(
+        CAN_NODE_1, CANTX_DEBUG_RESPONSE_ID, CAN_STANDARD_IDENTIFIER_11_BIT, testCanDataZeroArray, STD_NOT_OK);
+    /* ======= RT2/2: Call function under test */
+    testResult = TEST_CANTX_TransmitAllMemoryPoolStatistics();
+    /* ======= RT2/2: Test output verification */
+    TEST_ASSERT_EQUAL(STD_NOT_OK, testResult);
+}
+
+/**
+ * @brief   Testing CANTX_ConvertToRatePerSecond
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - None
+ *          - Routine validation:
+ *            - RT1/3: no observation time &rarr; rate is zero
+ *            - RT2/3: count is converted into events per second
+ *            - RT3/3: rate saturates at UINT32_MAX
+ */
+void testCANTX_ConvertToRatePerSecond(void) {
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/3: Test implementation */
+    /* ======= RT1/3: Call function under test */
+    uint32_t testResult = TEST_CANTX_ConvertToRatePerSecond(100u, 0u);
+    /* ======= RT1/3: Test output verification */
+    TEST_ASSERT_EQUAL_UINT32(0u, testResult);
+
+    /* ======= RT2/3: Test implementation */
+    /* ======= RT2/3: Call function under test */
+    testResult = TEST_CANTX_ConvertToRatePerSecond(300u, 2000u);
+    /* ======= RT2/3: Test output verification */
+    TEST_ASSERT_EQUAL_UINT32(150u, testResult);
+
+    /* ======= RT3/3: Test implementation */
+    /* ======= RT3/3: Call function under test */
+    testResult = TEST_CANTX_ConvertToRatePerSecond(UINT32_MAX, 1u);
+    /* ======= RT3/3: Test output verification */
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, testResult);
+}
+
+/**
+ * @brief   Testing CANTX_TransmitBusUtilization
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/2: invalid bus &rarr; assert
+ *            - AT2/2: NULL_PTR for pStatistics &rarr; assert
+ *          - Routine validation:
+ *            - RT1/1: utilization and rates are set, rates saturate
+ */
+void testCANTX_TransmitBusUtilization(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/2 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_TransmitBusUtilization(SYSM_BUS_E_MAX, &testBusStatistics));
+    /* ======= AT2/2 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_TransmitBusUtilization(SYSM_BUS_SPI1, NULL_PTR));
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/1: Test implementation */
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 7u, 8u, 0x0Au, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(
+        &testMessageData[0u], 15u, 4u, SYSM_BUS_I2C1, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 23u, 16u, 250u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 39u, 16u, 5000u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(
+        &testMessageData[0u], 55u, 16u, UINT16_MAX, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[1u]);
+    /* ======= RT1/1: Call function under test */
+    uint64_t testResult = TEST_CANTX_TransmitBusUtilization(SYSM_BUS_I2C1, &testBusStatistics);
+    /* ======= RT1/1: Test output verification */
+    TEST_ASSERT_EQUAL_UINT64(testMessageData[1u], testResult);
+}
+
+/**
+ * @brief   Testing CANTX_TransmitBusContention
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/2: invalid bus &rarr; assert
+ *            - AT2/2: NULL_PTR for pStatistics &rarr; assert
+ *          - Routine validation:
+ *            - RT1/1: rejections and maximum wait time are set, rejections
+ *                     saturate
+ */
+void testCANTX_TransmitBusContention(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/2 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_TransmitBusContention(SYSM_BUS_E_MAX, &testBusStatistics));
+    /* ======= AT2/2 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_TransmitBusContention(SYSM_BUS_SPI1, NULL_PTR));
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/1: Test implementation */
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 7u, 8u, 0x0Bu, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(
+        &testMessageData[0u], 15u, 4u, SYSM_BUS_SPI3, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 23u, 16u, 3u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(
+        &testMessageData[0u], 39u, 16u, UINT16_MAX, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 55u, 16u, 15u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[1u]);
+    /* ======= RT1/1: Call function under test */
+    uint64_t testResult = TEST_CANTX_TransmitBusContention(SYSM_BUS_SPI3, &testBusStatistics);
+    /* ======= RT1/1: Test output verification */
+    TEST_ASSERT_EQUAL_UINT64(testMessageData[1u], testResult);
+}
+
+/**
+ * @brief   Testing CANTX_TransmitBusWaitHistogram
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/2: invalid bus &rarr; assert
+ *            - AT2/2: NULL_PTR for pStatistics &rarr; assert
+ *          - Routine validation:
+ *            - RT1/1: all bins are set, bins saturate
+ */
+void testCANTX_TransmitBusWaitHistogram(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/2 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_TransmitBusWaitHistogram(SYSM_BUS_E_MAX, &testBusStatistics));
+    /* ======= AT2/2 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_TransmitBusWaitHistogram(SYSM_BUS_SPI1, NULL_PTR));
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/1: Test implementation */
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 7u, 8u, 0x0Cu, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(
+        &testMessageData[0u], 15u, 4u, SYSM_BUS_SPI4, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 23u, 8u, 1u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 31u, 8u, 2u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 39u, 8u, 255u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 47u, 8u, 0u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 55u, 8u, 4u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 63u, 8u, 5u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[1u]);
+    /* ======= RT1/1: Call function under test */
+    uint64_t testResult = TEST_CANTX_TransmitBusWaitHistogram(SYSM_BUS_SPI4, &testBusStatistics);
+    /* ======= RT1/1: Test output verification */
+    TEST_ASSERT_EQUAL_UINT64(testMessageData[1u], testResult);
+}
+
+/**
+ * @brief   Testing extern function CANTX_DebugResponseBusStatistics
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/1: invalid bus &rarr; assert
+ *          - Routine validation:
+ *            - RT1/2: all three messages are sent
+ *            - RT2/2: sending stops after the first message that could not
+ *                     be queued
+ */
+void testCANTX_DebugResponseBusStatistics(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/1 ======= */
+    TEST_ASSERT_FAIL_ASSERT(CANTX_DebugResponseBusStatistics(SYSM_BUS_E_MAX));
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/2: Test implementation */
+    SYSM_GetBusStatistics_Expect(SYSM_BUS_SPI1, NULL);
+    SYSM_GetBusStatistics_IgnoreArg_pStatistics();
+    SYSM_GetBusStatistics_ReturnThruPtr_pStatistics(&testBusStatistics);
+    /* utilization */
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 7u, 8u, 0x0Au, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 15u, 4u, 0u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 23u, 16u, 250u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 39u, 16u, 5000u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(
+        &testMessageData[0u], 55u, 16u, UINT16_MAX, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[1u]);
+    CAN_TxSetCanDataWithMessageData_Expect(testMessageData[1u], testCanDataZeroArray, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_DataSend_ExpectAndReturn(
+        CAN_NODE_1, CANTX_DEBUG_RESPONSE_ID, CAN_STANDARD_IDENTIFIER_11_BIT, testCanDataZeroArray, STD_OK);
+    /* contention */
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 7u, 8u, 0x0Bu, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 15u, 4u, 0u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 23u, 16u, 3u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(
+        &testMessageData[0u], 39u, 16u, UINT16_MAX, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 55u, 16u, 15u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[2u]);
+    CAN_TxSetCanDataWithMessageData_Expect(testMessageData[2u], testCanDataZeroArray, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_DataSend_ExpectAndReturn(
+        CAN_NODE_1, CANTX_DEBUG_RESPONSE_ID, CAN_STANDARD_IDENTIFIER_11_BIT, testCanDataZeroArray, STD_OK);
+    /* wait time histogram */
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 7u, 8u, 0x0Cu, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 15u, 4u, 0u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 23u, 8u, 1u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 31u, 8u, 2u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 39u, 8u, 255u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 47u, 8u, 0u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 55u, 8u, 4u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 63u, 8u, 5u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[3u]);
+    CAN_TxSetCanDataWithMessageData_Expect(testMessageData[3u], testCanDataZeroArray, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_DataSend_ExpectAndReturn(
+        CAN_NODE_1, CANTX_DEBUG_RESPONSE_ID, CAN_STANDARD_IDENTIFIER_11_BIT, testCanDataZeroArray, STD_OK);
+    /* ======= RT1/2: Call function under test */
+    STD_RETURN_TYPE_e testResult = CANTX_DebugResponseBusStatistics(SYSM_BUS_SPI1);
+    /* ======= RT1/2: Test output verification */
+    TEST_ASSERT_EQUAL(STD_OK, testResult);
+
+    /* ======= RT2/2: Test implementation */
+    SYSM_GetBusStatistics_Expect(SYSM_BUS_SPI1, NULL);
+    SYSM_GetBusStatistics_IgnoreArg_pStatistics();
+    SYSM_GetBusStatistics_ReturnThruPtr_pStatistics(&testBusStatistics);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 7u, 8u, 0x0Au, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 15u, 4u, 0u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 23u, 16u, 250u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 39u, 16u, 5000u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(
+        &testMessageData[0u], 55u, 16u, UINT16_MAX, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[1u]);
+    CAN_TxSetCanDataWithMessageData_Expect(testMessageData[1u], testCanDataZeroArray, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_DataSend_ExpectAndReturn(
+        CAN_NODE_1, CANTX_DEBUG_RESPONSE_ID, CAN_STANDARD_IDENTIFIER_11_BIT, testCanDataZeroArray, STD_NOT_OK);
+    /* ======= RT2/2: Call function under test */
+    testResult = CANTX_DebugResponseBusStatistics(SYSM_BUS_SPI1);
+    /* ======= RT2/2: Test output verification */
+    TEST_ASSERT_EQUAL(STD_NOT_OK, testResult);
+}
+
+/**
+ * @brief   Testing CANTX_TransmitStackUsage
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/2: invalid task &rarr; assert
+ *            - AT2/2: NULL_PTR for pUsage &rarr; assert
+ *          - Routine validation:
+ *            - RT1/1: flags, stack size and maximum usage are set, stack
+ *                     size saturates
+ */
+void testCANTX_TransmitStackUsage(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/2 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_TransmitStackUsage(SYSM_STACK_TASK_E_MAX, &testStackUsage));
+    /* ======= AT2/2 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_TransmitStackUsage(SYSM_STACK_TASK_ENGINE, NULL_PTR));
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/1: Test implementation */
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 7u, 8u, 0x0Du, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(
+        &testMessageData[0u], 15u, 4u, SYSM_STACK_TASK_AFE, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 11u, 1u, 1u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 10u, 1u, 1u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(
+        &testMessageData[0u], 23u, 16u, UINT16_MAX, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 39u, 16u, 1800u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[1u]);
+    /* ======= RT1/1: Call function under test */
+    uint64_t testResult = TEST_CANTX_TransmitStackUsage(SYSM_STACK_TASK_AFE, &testStackUsage);
+    /* ======= RT1/1: Test output verification */
+    TEST_ASSERT_EQUAL_UINT64(testMessageData[1u], testResult);
+}
+
+/**
+ * @brief   Testing extern function CANTX_DebugResponseStackUsage
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/1: invalid task &rarr; assert
+ *          - Routine validation:
+ *            - RT1/2: the message is sent
+ *            - RT2/2: the message could not be queued
+ */
+void testCANTX_DebugResponseStackUsage(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/1 ======= */
+    TEST_ASSERT_FAIL_ASSERT(CANTX_DebugResponseStackUsage(SYSM_STACK_TASK_E_MAX));
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/2: Test implementation */
+    SYSM_GetStackUsage_Expect(SYSM_STACK_TASK_I2C, NULL);
+    SYSM_GetStackUsage_IgnoreArg_pUsage();
+    SYSM_GetStackUsage_ReturnThruPtr_pUsage(&testStackUsage);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 7u, 8u, 0x0Du, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(
+        &testMessageData[0u], 15u, 4u, SYSM_STACK_TASK_I2C, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 11u, 1u, 1u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 10u, 1u, 1u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(
+        &testMessageData[0u], 23u, 16u, UINT16_MAX, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 39u, 16u, 1800u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[1u]);
+    CAN_TxSetCanDataWithMessageData_Expect(testMessageData[1u], testCanDataZeroArray, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_DataSend_ExpectAndReturn(
+        CAN_NODE_1, CANTX_DEBUG_RESPONSE_ID, CAN_STANDARD_IDENTIFIER_11_BIT, testCanDataZeroArray, STD_OK);
+    /* ======= RT1/2: Call function under test */
+    STD_RETURN_TYPE_e testResult = CANTX_DebugResponseStackUsage(SYSM_STACK_TASK_I2C);
+    /* ======= RT1/2: Test output verification */
+    TEST_ASSERT_EQUAL(STD_OK, testResult);
+
+    /* ======= RT2/2: Test implementation */
+    SYSM_GetStackUsage_Expect(SYSM_STACK_TASK_I2C, NULL);
+    SYSM_GetStackUsage_IgnoreArg_pUsage();
+    SYSM_GetStackUsage_ReturnThruPtr_pUsage(&testStackUsage);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 7u, 8u, 0x0Du, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(
+        &testMessageData[0u], 15u, 4u, SYSM_STACK_TASK_I2C, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 11u, 1u, 1u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 10u, 1u, 1u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(
+        &testMessageData[0u], 23u, 16u, UINT16_MAX, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 39u, 16u, 1800u, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[1u]);
+    CAN_TxSetCanDataWithMessageData_Expect(testMessageData[1u], testCanDataZeroArray, CANTX_DEBUG_RESPONSE_ENDIANNESS);
+    CAN_DataSend_ExpectAndReturn(
+        CAN_NODE_1, CANTX_DEBUG_RESPONSE_ID, CAN_STANDARD_IDENTIFIER_11_BIT, testCanDataZeroArray, STD_NOT_OK);
+    /* ======= RT2/2: Call function under test */
+    testResult = CANTX_DebugResponseStackUsage(SYSM_STACK_TASK_I2C);
+    /* ======= RT2/2: Test output verification */
+    TEST_ASSERT_EQUAL(STD_NOT_OK, testResult);
+}
+
 /**
  * @brief   Testing CANTX_DebugResponse
  * @details The following cases need to be tested:
@@ -625,6 +1154,8 @@ void testCANTX_DebugResponseSendMessage(void) {
  *            - RT7/9: RTC_TIME
  *            - RT8/9: UPTIME
  *            - RT8/9: COMMIT_HASH
+ *            - RT10/10: LATENCY_STATISTICS
+ *            - RT11/11: MEMORY_POOL_STATISTICS
  */
 void testCANTX_DebugResponse(void) {
     /* ======= Assertion tests ============================================= */
@@ -835,4 +1366,25 @@ void testCANTX_DebugResponse(void) {
     testResult = CANTX_DebugResponse(CANTX_DEBUG_RESPONSE_TRANSMIT_COMMIT_HASH);
     /* ======= RT9/9: Test output verification */
     TEST_ASSERT_EQUAL(STD_NOT_OK, testResult);
+
+    /* ======= RT10/10: Test implementation */
+    SYSM_GetLatencyStatistics_Ignore();
+    SYSM_IsLatencyBudgetExceeded_IgnoreAndReturn(false);
+    CAN_TxSetMessageDataWithSignalData_Ignore();
+    CAN_TxSetCanDataWithMessageData_Ignore();
+    CAN_DataSend_ExpectAndReturn(
+        CAN_NODE_1, CANTX_DEBUG_RESPONSE_ID, CAN_STANDARD_IDENTIFIER_11_BIT, testCanDataZeroArray, STD_NOT_OK);
+    /* ======= RT10/10: Call function under test */
+    testResult = CANTX_DebugResponse(CANTX_DEBUG_RESPONSE_TRANSMIT_LATENCY_STATISTICS);
+    /* ======= RT10/10: Test output verification */
+    TEST_ASSERT_EQUAL(STD_NOT_OK, testResult);
+
+    /* ======= RT11/11: Test implementation */
+    MPOOL_GetStatistics_Ignore();
+    CAN_DataSend_ExpectAndReturn(
+        CAN_NODE_1, CANTX_DEBUG_RESPONSE_ID, CAN_STANDARD_IDENTIFIER_11_BIT, testCanDataZeroArray, STD_NOT_OK);
+    /* ======= RT11/11: Call function under test */
+    testResult = CANTX_DebugResponse(CANTX_DEBUG_RESPONSE_TRANSMIT_MEMORY_POOL_STATISTICS);
+    /* ======= RT11/11: Test output verification */
+    TEST_ASSERT_EQUAL(STD_NOT_OK, testResult);
 }
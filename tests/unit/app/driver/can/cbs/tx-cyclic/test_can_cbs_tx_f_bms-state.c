@@ -674,13 +674,6 @@ void testCANTX_BmsState(void) {
             .recordedViolation100msAlgo = true,
     };
     /* ======= RT1/1: Test implementation */
-    DATA_Read4DataBlocks_ExpectAndReturn(
-        can_kShim.pTableErrorState,
-        can_kShim.pTableInsulation,
-        can_kShim.pTableMsl,
-        can_kShim.pTableBalancingControl,
-        STD_OK);
-    DATA_Read1DataBlock_ExpectAndReturn(can_kShim.pTablePhy, STD_OK);
     BMS_GetState_ExpectAndReturn(bms_state.state);
     CAN_TxSetMessageDataWithSignalData_Expect(
         &testMessageData[0u], 3u, 4u, bms_state.state, CANTX_BMS_STATE_ENDIANNESS);
@@ -43,7 +43,7 @@
  * @file    test_can_cbs_tx_f_cell-temperatures_3-temp-sensors.c
  * @author  foxBMS Team
  * @date    2021-04-22 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -140,8 +140,8 @@ const CAN_SHIM_s can_kShim = {
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
-    can_kShim.pTableCellTemperature->invalidCellTemperature[0u][0u][0u] = 0u;
-    can_kShim.pTableCellTemperature->invalidCellTemperature[0u][0u][1u] = 1u;
+    /* sensor 0 is valid, sensor 1 is invalid */
+    can_kShim.pTableCellTemperature->invalidCellTemperature[0u][0u] = 0x2u;
 
     can_kShim.pTableCellTemperature->cellTemperature_ddegC[0u][0u][0u] = (int16_t)testCellTemperature0;
     can_kShim.pTableCellTemperature->cellTemperature_ddegC[0u][0u][1u] = (int16_t)testCellTemperature1;
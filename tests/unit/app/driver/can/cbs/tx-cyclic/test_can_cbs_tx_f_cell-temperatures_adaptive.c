@@ -0,0 +1,268 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    test_can_cbs_tx_f_cell-temperatures_adaptive.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the CAN driver callbacks
+ * @details Tests the cell temperature callback with the adaptive transmission
+ *          policy (#CANTX_CELL_BROADCAST_POLICY_ADAPTIVE).
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockcan.h"
+#include "Mockcan_helper.h"
+#include "Mockdatabase.h"
+#include "Mockdatabase_helper.h"
+#include "Mockdiag.h"
+#include "Mockfoxmath.h"
+#include "Mockimd.h"
+#include "Mockos.h"
+
+#include "database_cfg.h"
+
+#include "can_cbs_tx_cyclic.h"
+#include "can_cfg_tx-cyclic-message-definitions.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("can_cbs_tx_f_cell-temperatures.c")
+
+TEST_INCLUDE_PATH("../../src/app/driver/can")
+TEST_INCLUDE_PATH("../../src/app/driver/can/cbs")
+TEST_INCLUDE_PATH("../../src/app/driver/can/cbs/tx-cyclic")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/driver/imd")
+TEST_INCLUDE_PATH("../../src/app/engine/database")
+TEST_INCLUDE_PATH("../../src/app/engine/diag")
+TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** number of multiplexed frames for the 8 temperature sensors of the unit test configuration */
+#define TEST_NUMBER_OF_FRAMES (2u)
+
+/** start bit of the multiplexer signal */
+#define TEST_MUX_START_BIT (7u)
+
+static DATA_BLOCK_CELL_TEMPERATURE_s can_tableTemperatures = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+
+OS_QUEUE imd_canDataQueue = NULL_PTR;
+
+const CAN_SHIM_s can_kShim = {
+    .pQueueImd             = &imd_canDataQueue,
+    .pTableCellTemperature = &can_tableTemperatures,
+};
+
+/** multiplexer values of the frames composed by the callback */
+static uint8_t testTransmittedMuxValues[TEST_NUMBER_OF_FRAMES * 2u] = {0u};
+static uint8_t testNumberOfTransmittedFrames                        = 0u;
+
+static void TEST_CAN_TxSetMessageDataWithSignalData(
+    uint64_t *pMessage,
+    uint64_t bitStart,
+    uint8_t bitLength,
+    uint64_t canSignal,
+    CAN_ENDIANNESS_e endianness,
+    int cmock_num_calls) {
+    if (bitStart == TEST_MUX_START_BIT) {
+        testTransmittedMuxValues[testNumberOfTransmittedFrames] = (uint8_t)canSignal;
+        testNumberOfTransmittedFrames++;
+    }
+}
+
+static void TEST_CAN_TxPrepareSignalData(float_t *pSignal, CAN_SIGNAL_TYPE_s signalProperties, int cmock_num_calls) {
+}
+
+static void TEST_CAN_TxSetCanDataWithMessageData(
+    uint64_t message,
+    uint8_t *pCanData,
+    CAN_ENDIANNESS_e endianness,
+    int cmock_num_calls) {
+}
+
+static uint8_t TEST_DATA_GetStringNumberFromTemperatureIndex(uint16_t sensorIndex, int cmock_num_calls) {
+    return (uint8_t)(sensorIndex / BS_NR_OF_TEMP_SENSORS_PER_STRING);
+}
+
+static uint8_t TEST_DATA_GetModuleNumberFromTemperatureIndex(uint16_t sensorIndex, int cmock_num_calls) {
+    return (uint8_t)((sensorIndex % BS_NR_OF_TEMP_SENSORS_PER_STRING) / BS_NR_OF_TEMP_SENSORS_PER_MODULE);
+}
+
+static uint8_t TEST_DATA_GetSensorNumberFromTemperatureIndex(uint16_t sensorIndex, int cmock_num_calls) {
+    return (uint8_t)(sensorIndex % BS_NR_OF_TEMP_SENSORS_PER_MODULE);
+}
+
+/** sets all temperatures valid to 30 degC, except sensor 6 (20 degC) and sensor 7 (40 degC) */
+static void TEST_SetCellTemperatures(void) {
+    for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
+        can_tableTemperatures.cellTemperature_ddegC[0u][0u][ts] = 300;
+    }
+    can_tableTemperatures.invalidCellTemperature[0u][0u] = 0u;
+    can_tableTemperatures.cellTemperature_ddegC[0u][0u][6u] = 200;
+    can_tableTemperatures.cellTemperature_ddegC[0u][0u][7u] = 400;
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    TEST_SetCellTemperatures();
+    can_tableTemperatures.header.timestamp = 0u;
+    testNumberOfTransmittedFrames          = 0u;
+
+    CAN_TxSetMessageDataWithSignalData_Stub(TEST_CAN_TxSetMessageDataWithSignalData);
+    CAN_TxPrepareSignalData_Stub(TEST_CAN_TxPrepareSignalData);
+    CAN_TxSetCanDataWithMessageData_Stub(TEST_CAN_TxSetCanDataWithMessageData);
+    DATA_GetStringNumberFromTemperatureIndex_Stub(TEST_DATA_GetStringNumberFromTemperatureIndex);
+    DATA_GetModuleNumberFromTemperatureIndex_Stub(TEST_DATA_GetModuleNumberFromTemperatureIndex);
+    DATA_GetSensorNumberFromTemperatureIndex_Stub(TEST_DATA_GetSensorNumberFromTemperatureIndex);
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+/**
+ * @brief   Testing CANTX_IsCellTemperaturePrioritized
+ * @details The following cases need to be tested:
+ *          - Routine validation:
+ *            - RT1/3: unchanged temperature between minimum and maximum
+ *            - RT2/3: change within and beyond the deadband
+ *            - RT3/3: temperature close to the minimum or maximum
+ */
+void testCANTX_IsCellTemperaturePrioritized(void) {
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/3 ======= */
+    TEST_ASSERT_FALSE(TEST_CANTX_IsCellTemperaturePrioritized(300, 300, 200, 400));
+    /* ======= RT2/3 ======= */
+    TEST_ASSERT_FALSE(TEST_CANTX_IsCellTemperaturePrioritized(305, 300, 200, 400));
+    TEST_ASSERT_TRUE(TEST_CANTX_IsCellTemperaturePrioritized(306, 300, 200, 400));
+    TEST_ASSERT_TRUE(TEST_CANTX_IsCellTemperaturePrioritized(294, 300, 200, 400));
+    /* ======= RT3/3 ======= */
+    TEST_ASSERT_TRUE(TEST_CANTX_IsCellTemperaturePrioritized(210, 210, 200, 400));
+    TEST_ASSERT_FALSE(TEST_CANTX_IsCellTemperaturePrioritized(211, 211, 200, 400));
+    TEST_ASSERT_TRUE(TEST_CANTX_IsCellTemperaturePrioritized(390, 390, 200, 400));
+    TEST_ASSERT_FALSE(TEST_CANTX_IsCellTemperaturePrioritized(389, 389, 200, 400));
+}
+
+/**
+ * @brief   Testing CANTX_PlanCellTemperatureSweep
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/1: NULL_PTR for kpkCanShim -> assert
+ *          - Routine validation:
+ *            - RT1/2: unchanged temperatures -> frame with minimum and
+ *                     maximum first
+ *            - RT2/2: temperature changed beyond the deadband -> its frame is
+ *                     prioritized as well
+ */
+void testCANTX_PlanCellTemperatureSweep(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/1 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_PlanCellTemperatureSweep(NULL_PTR));
+
+    /* ======= Routine tests =============================================== */
+    const uint8_t *pSweepOrder = TEST_CANTX_GetCellTemperatureSweepOrder();
+    (void)TEST_CANTX_PlanCellTemperatureSweep(&can_kShim);
+    /* ======= RT1/2 ======= */
+    /* sensors 6 and 7 are in frame 1 */
+    TEST_ASSERT_EQUAL(1u, TEST_CANTX_PlanCellTemperatureSweep(&can_kShim));
+    const uint8_t expectedOrderRt1[TEST_NUMBER_OF_FRAMES] = {1u, 0u};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedOrderRt1, pSweepOrder, TEST_NUMBER_OF_FRAMES);
+
+    /* ======= RT2/2 ======= */
+    can_tableTemperatures.cellTemperature_ddegC[0u][0u][2u] -= 6;
+    TEST_ASSERT_EQUAL(2u, TEST_CANTX_PlanCellTemperatureSweep(&can_kShim));
+    const uint8_t expectedOrderRt2[TEST_NUMBER_OF_FRAMES] = {0u, 1u};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedOrderRt2, pSweepOrder, TEST_NUMBER_OF_FRAMES);
+}
+
+/**
+ * @brief   Testing CANTX_CellTemperatures with the adaptive policy
+ * @details The following cases need to be tested:
+ *          - Routine validation:
+ *            - RT1/2: new measurement -> burst, prioritized frame first
+ *            - RT2/2: no new measurement -> one frame per call
+ */
+void testCANTX_CellTemperaturesAdaptive(void) {
+    CAN_MESSAGE_PROPERTIES_s testMessage = {
+        .id         = CANTX_CELL_TEMPERATURES_ID,
+        .idType     = CANTX_CELL_TEMPERATURES_ID_TYPE,
+        .dlc        = CAN_FOXBMS_MESSAGES_DEFAULT_DLC,
+        .endianness = CANTX_CELL_TEMPERATURES_ENDIANNESS,
+    };
+    uint8_t testCanData[CAN_MAX_DLC] = {0u};
+    uint8_t testMuxId                = 0u;
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/2: Test implementation */
+    /* the previous sweep contained the same temperatures */
+    (void)TEST_CANTX_PlanCellTemperatureSweep(&can_kShim);
+    can_tableTemperatures.header.timestamp = 100u;
+    DATA_Read1DataBlock_ExpectAndReturn(can_kShim.pTableCellTemperature, STD_OK);
+    /* ======= RT1/2: Call function under test */
+    TEST_ASSERT_EQUAL(1u, CANTX_CellTemperatures(testMessage, testCanData, &testMuxId, &can_kShim));
+    TEST_ASSERT_EQUAL(0u, CANTX_CellTemperatures(testMessage, testCanData, &testMuxId, &can_kShim));
+    /* ======= RT1/2: Test output verification */
+    const uint8_t expectedOrderRt1[TEST_NUMBER_OF_FRAMES] = {1u, 0u};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedOrderRt1, testTransmittedMuxValues, TEST_NUMBER_OF_FRAMES);
+
+    /* ======= RT2/2: Test implementation */
+    testNumberOfTransmittedFrames = 0u;
+    DATA_Read1DataBlock_ExpectAndReturn(can_kShim.pTableCellTemperature, STD_OK);
+    /* ======= RT2/2: Call function under test */
+    TEST_ASSERT_EQUAL(0u, CANTX_CellTemperatures(testMessage, testCanData, &testMuxId, &can_kShim));
+    TEST_ASSERT_EQUAL(0u, CANTX_CellTemperatures(testMessage, testCanData, &testMuxId, &can_kShim));
+    /* ======= RT2/2: Test output verification */
+    TEST_ASSERT_EQUAL(TEST_NUMBER_OF_FRAMES, testNumberOfTransmittedFrames);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedOrderRt1, testTransmittedMuxValues, TEST_NUMBER_OF_FRAMES);
+}
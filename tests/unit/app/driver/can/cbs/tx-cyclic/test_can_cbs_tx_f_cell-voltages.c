@@ -43,7 +43,7 @@
  * @file    test_can_cbs_tx_f_cell-voltages.c
  * @author  foxBMS Team
  * @date    2021-04-22 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -63,6 +63,7 @@
 #include "Mockfoxmath.h"
 #include "Mockimd.h"
 #include "Mockos.h"
+#include "Mocksys_mon_latency.h"
 
 #include "can_cbs_tx_cyclic.h"
 #include "can_cfg_tx-cyclic-message-definitions.h"
@@ -146,13 +147,15 @@ const CAN_SHIM_s can_kShim = {
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    SYSM_RecordLatency_Ignore();
     can_tableCellVoltages.cellVoltage_mV[0u][0u][0u]  = (int16_t)testCellVoltage0;
     can_tableCellVoltages.cellVoltage_mV[0u][0u][1u]  = (int16_t)testCellVoltage1;
     can_tableCellVoltages.cellVoltage_mV[0u][0u][17u] = (int16_t)testCellVoltage17;
 
-    can_tableCellVoltages.invalidCellVoltage[0u][0u][0u]  = (bool)testCellVoltage0InvalidFlag;
-    can_tableCellVoltages.invalidCellVoltage[0u][0u][1u]  = (bool)testCellVoltage1InvalidFlag;
-    can_tableCellVoltages.invalidCellVoltage[0u][0u][17u] = (bool)testCellVoltage17InvalidFlag;
+    can_tableCellVoltages.invalidCellVoltage[0u][0u] = 0u;
+    BITSET_WriteBit(&can_tableCellVoltages.invalidCellVoltage[0u][0u], 0u, (bool)testCellVoltage0InvalidFlag);
+    BITSET_WriteBit(&can_tableCellVoltages.invalidCellVoltage[0u][0u], 1u, (bool)testCellVoltage1InvalidFlag);
+    BITSET_WriteBit(&can_tableCellVoltages.invalidCellVoltage[0u][0u], 17u, (bool)testCellVoltage17InvalidFlag);
 }
 
 void tearDown(void) {
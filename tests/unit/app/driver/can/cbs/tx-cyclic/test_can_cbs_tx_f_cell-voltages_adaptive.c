@@ -0,0 +1,325 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    test_can_cbs_tx_f_cell-voltages_adaptive.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the CAN driver callbacks
+ * @details Tests the cell voltage callback with the adaptive transmission
+ *          policy (#CANTX_CELL_BROADCAST_POLICY_ADAPTIVE).
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockcan.h"
+#include "Mockcan_helper.h"
+#include "Mockdatabase.h"
+#include "Mockdatabase_cfg.h"
+#include "Mockdatabase_helper.h"
+#include "Mockdiag.h"
+#include "Mockfoxmath.h"
+#include "Mockimd.h"
+#include "Mockos.h"
+#include "Mocksys_mon_latency.h"
+
+#include "can_cbs_tx_cyclic.h"
+#include "can_cfg_tx-cyclic-message-definitions.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("can_cbs_tx_f_cell-voltages.c")
+
+TEST_INCLUDE_PATH("../../src/app/driver/can")
+TEST_INCLUDE_PATH("../../src/app/driver/can/cbs")
+TEST_INCLUDE_PATH("../../src/app/driver/can/cbs/tx-cyclic")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/driver/imd")
+TEST_INCLUDE_PATH("../../src/app/engine/database")
+TEST_INCLUDE_PATH("../../src/app/engine/diag")
+TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** number of multiplexed frames for the 18 cell blocks of the unit test configuration */
+#define TEST_NUMBER_OF_FRAMES (5u)
+
+/** start bit of the multiplexer signal */
+#define TEST_MUX_START_BIT (7u)
+
+static DATA_BLOCK_CELL_VOLTAGE_s can_tableCellVoltages = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+
+OS_QUEUE imd_canDataQueue = NULL_PTR;
+
+const CAN_SHIM_s can_kShim = {
+    .pQueueImd         = &imd_canDataQueue,
+    .pTableCellVoltage = &can_tableCellVoltages,
+};
+
+/** multiplexer values of the frames composed by the callback */
+static uint8_t testTransmittedMuxValues[TEST_NUMBER_OF_FRAMES * 3u] = {0u};
+static uint8_t testNumberOfTransmittedFrames                        = 0u;
+
+static void TEST_CAN_TxSetMessageDataWithSignalData(
+    uint64_t *pMessage,
+    uint64_t bitStart,
+    uint8_t bitLength,
+    uint64_t canSignal,
+    CAN_ENDIANNESS_e endianness,
+    int cmock_num_calls) {
+    if (bitStart == TEST_MUX_START_BIT) {
+        testTransmittedMuxValues[testNumberOfTransmittedFrames] = (uint8_t)canSignal;
+        testNumberOfTransmittedFrames++;
+    }
+}
+
+static void TEST_CAN_TxPrepareSignalData(float_t *pSignal, CAN_SIGNAL_TYPE_s signalProperties, int cmock_num_calls) {
+}
+
+static void TEST_CAN_TxSetCanDataWithMessageData(
+    uint64_t message,
+    uint8_t *pCanData,
+    CAN_ENDIANNESS_e endianness,
+    int cmock_num_calls) {
+}
+
+static uint8_t TEST_DATA_GetStringNumberFromVoltageIndex(uint16_t cellIndex, int cmock_num_calls) {
+    return (uint8_t)(cellIndex / BS_NR_OF_CELL_BLOCKS_PER_STRING);
+}
+
+static uint8_t TEST_DATA_GetModuleNumberFromVoltageIndex(uint16_t cellIndex, int cmock_num_calls) {
+    return (uint8_t)((cellIndex % BS_NR_OF_CELL_BLOCKS_PER_STRING) / BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+}
+
+static uint8_t TEST_DATA_GetCellNumberFromVoltageIndex(uint16_t cellIndex, int cmock_num_calls) {
+    return (uint8_t)(cellIndex % BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+}
+
+/** sets all cell voltages valid and spread from 3500mV (cell 0) to 3840mV (cell 17) */
+static void TEST_SetSpreadCellVoltages(void) {
+    for (uint8_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_MODULE; c++) {
+        can_tableCellVoltages.cellVoltage_mV[0u][0u][c] = (int16_t)(3500 + (20 * (int16_t)c));
+    }
+    can_tableCellVoltages.invalidCellVoltage[0u][0u] = 0u;
+}
+
+/** calls the callback and checks the number of requested further frames */
+static void TEST_CallCellVoltages(uint8_t *pMuxId, uint32_t expectedFramesRequested) {
+    CAN_MESSAGE_PROPERTIES_s testMessage = {
+        .id         = CANTX_CELL_VOLTAGES_ID,
+        .idType     = CANTX_CELL_VOLTAGES_ID_TYPE,
+        .dlc        = CAN_FOXBMS_MESSAGES_DEFAULT_DLC,
+        .endianness = CANTX_CELL_VOLTAGES_ENDIANNESS,
+    };
+    uint8_t testCanData[CAN_MAX_DLC] = {0u};
+    TEST_ASSERT_EQUAL(expectedFramesRequested, CANTX_CellVoltages(testMessage, testCanData, pMuxId, &can_kShim));
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    SYSM_RecordLatency_Ignore();
+    TEST_SetSpreadCellVoltages();
+    can_tableCellVoltages.header.timestamp = 0u;
+    testNumberOfTransmittedFrames          = 0u;
+
+    CAN_TxSetMessageDataWithSignalData_Stub(TEST_CAN_TxSetMessageDataWithSignalData);
+    CAN_TxPrepareSignalData_Stub(TEST_CAN_TxPrepareSignalData);
+    CAN_TxSetCanDataWithMessageData_Stub(TEST_CAN_TxSetCanDataWithMessageData);
+    DATA_GetStringNumberFromVoltageIndex_Stub(TEST_DATA_GetStringNumberFromVoltageIndex);
+    DATA_GetModuleNumberFromVoltageIndex_Stub(TEST_DATA_GetModuleNumberFromVoltageIndex);
+    DATA_GetCellNumberFromVoltageIndex_Stub(TEST_DATA_GetCellNumberFromVoltageIndex);
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+/**
+ * @brief   Testing CANTX_IsCellVoltagePrioritized
+ * @details The following cases need to be tested:
+ *          - Routine validation:
+ *            - RT1/4: unchanged voltage between minimum and maximum
+ *            - RT2/4: change within and beyond the deadband
+ *            - RT3/4: voltage close to the minimum
+ *            - RT4/4: voltage close to the maximum
+ */
+void testCANTX_IsCellVoltagePrioritized(void) {
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/4 ======= */
+    TEST_ASSERT_FALSE(TEST_CANTX_IsCellVoltagePrioritized(3700, 3700, 3600, 3800));
+    /* ======= RT2/4 ======= */
+    TEST_ASSERT_FALSE(TEST_CANTX_IsCellVoltagePrioritized(3705, 3700, 3600, 3800));
+    TEST_ASSERT_FALSE(TEST_CANTX_IsCellVoltagePrioritized(3695, 3700, 3600, 3800));
+    TEST_ASSERT_TRUE(TEST_CANTX_IsCellVoltagePrioritized(3706, 3700, 3600, 3800));
+    TEST_ASSERT_TRUE(TEST_CANTX_IsCellVoltagePrioritized(3694, 3700, 3600, 3800));
+    /* ======= RT3/4 ======= */
+    TEST_ASSERT_TRUE(TEST_CANTX_IsCellVoltagePrioritized(3610, 3610, 3600, 3800));
+    TEST_ASSERT_FALSE(TEST_CANTX_IsCellVoltagePrioritized(3611, 3611, 3600, 3800));
+    /* ======= RT4/4 ======= */
+    TEST_ASSERT_TRUE(TEST_CANTX_IsCellVoltagePrioritized(3790, 3790, 3600, 3800));
+    TEST_ASSERT_FALSE(TEST_CANTX_IsCellVoltagePrioritized(3789, 3789, 3600, 3800));
+}
+
+/**
+ * @brief   Testing CANTX_PlanCellVoltageSweep
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/1: NULL_PTR for kpkCanShim -> assert
+ *          - Routine validation:
+ *            - RT1/4: first sweep, all voltages changed -> all frames prioritized
+ *            - RT2/4: unchanged voltages -> frames with minimum and maximum first
+ *            - RT3/4: one voltage changed beyond the deadband -> its frame is
+ *                     prioritized as well
+ *            - RT4/4: invalid voltages are ignored for minimum and maximum
+ */
+void testCANTX_PlanCellVoltageSweep(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/1 ======= */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_PlanCellVoltageSweep(NULL_PTR));
+
+    /* ======= Routine tests =============================================== */
+    const uint8_t *pSweepOrder = TEST_CANTX_GetCellVoltageSweepOrder();
+    /* ======= RT1/4 ======= */
+    for (uint8_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_MODULE; c++) {
+        can_tableCellVoltages.cellVoltage_mV[0u][0u][c] = 0;
+    }
+    (void)TEST_CANTX_PlanCellVoltageSweep(&can_kShim);
+    TEST_SetSpreadCellVoltages();
+    TEST_ASSERT_EQUAL(TEST_NUMBER_OF_FRAMES, TEST_CANTX_PlanCellVoltageSweep(&can_kShim));
+    const uint8_t expectedOrderRt1[TEST_NUMBER_OF_FRAMES] = {0u, 1u, 2u, 3u, 4u};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedOrderRt1, pSweepOrder, TEST_NUMBER_OF_FRAMES);
+
+    /* ======= RT2/4 ======= */
+    /* cell 0 (minimum) is in frame 0, cell 17 (maximum) in frame 4 */
+    TEST_ASSERT_EQUAL(2u, TEST_CANTX_PlanCellVoltageSweep(&can_kShim));
+    const uint8_t expectedOrderRt2[TEST_NUMBER_OF_FRAMES] = {0u, 4u, 1u, 2u, 3u};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedOrderRt2, pSweepOrder, TEST_NUMBER_OF_FRAMES);
+
+    /* ======= RT3/4 ======= */
+    /* cell 9 is in frame 2 */
+    can_tableCellVoltages.cellVoltage_mV[0u][0u][9u] += 6;
+    TEST_ASSERT_EQUAL(3u, TEST_CANTX_PlanCellVoltageSweep(&can_kShim));
+    const uint8_t expectedOrderRt3[TEST_NUMBER_OF_FRAMES] = {0u, 2u, 4u, 1u, 3u};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedOrderRt3, pSweepOrder, TEST_NUMBER_OF_FRAMES);
+
+    /* ======= RT4/4 ======= */
+    /* cells 0 to 3 are invalid, the new minimum is cell 4 in frame 1 */
+    can_tableCellVoltages.invalidCellVoltage[0u][0u] = BITSET_GetMask(4u);
+    TEST_ASSERT_EQUAL(2u, TEST_CANTX_PlanCellVoltageSweep(&can_kShim));
+    const uint8_t expectedOrderRt4[TEST_NUMBER_OF_FRAMES] = {1u, 4u, 0u, 2u, 3u};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedOrderRt4, pSweepOrder, TEST_NUMBER_OF_FRAMES);
+}
+
+/**
+ * @brief   Testing CANTX_CellVoltages with the adaptive policy
+ * @details The following cases need to be tested:
+ *          - Routine validation:
+ *            - RT1/3: new measurement -> the complete sweep is requested as
+ *                     burst and every frame is sent once
+ *            - RT2/3: no new measurement -> one frame per call, prioritized
+ *                     frames first
+ *            - RT3/3: new measurement with a changed voltage -> burst with the
+ *                     changed frame after the minimum frame
+ */
+void testCANTX_CellVoltagesAdaptive(void) {
+    uint8_t testMuxId = 0u;
+
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/3: Test implementation */
+    for (uint8_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_MODULE; c++) {
+        can_tableCellVoltages.cellVoltage_mV[0u][0u][c] = 4000;
+    }
+    can_tableCellVoltages.header.timestamp = 100u;
+    DATA_Read1DataBlock_ExpectAndReturn(can_kShim.pTableCellVoltage, STD_OK);
+    /* ======= RT1/3: Call function under test */
+    for (uint8_t frame = 0u; frame < TEST_NUMBER_OF_FRAMES; frame++) {
+        TEST_CallCellVoltages(&testMuxId, (uint32_t)(TEST_NUMBER_OF_FRAMES - 1u - frame));
+    }
+    /* ======= RT1/3: Test output verification */
+    const uint8_t expectedOrderRt1[TEST_NUMBER_OF_FRAMES] = {0u, 1u, 2u, 3u, 4u};
+    TEST_ASSERT_EQUAL(TEST_NUMBER_OF_FRAMES, testNumberOfTransmittedFrames);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedOrderRt1, testTransmittedMuxValues, TEST_NUMBER_OF_FRAMES);
+    TEST_ASSERT_EQUAL(TEST_NUMBER_OF_FRAMES, testMuxId);
+
+    /* ======= RT2/3: Test implementation */
+    TEST_SetSpreadCellVoltages();
+    testNumberOfTransmittedFrames = 0u;
+    DATA_Read1DataBlock_ExpectAndReturn(can_kShim.pTableCellVoltage, STD_OK);
+    /* ======= RT2/3: Call function under test */
+    /* all voltages changed, but there is no new measurement: no burst */
+    for (uint8_t frame = 0u; frame < TEST_NUMBER_OF_FRAMES; frame++) {
+        TEST_CallCellVoltages(&testMuxId, 0u);
+    }
+    /* second sweep without change: minimum and maximum frames first */
+    DATA_Read1DataBlock_ExpectAndReturn(can_kShim.pTableCellVoltage, STD_OK);
+    for (uint8_t frame = 0u; frame < TEST_NUMBER_OF_FRAMES; frame++) {
+        TEST_CallCellVoltages(&testMuxId, 0u);
+    }
+    /* ======= RT2/3: Test output verification */
+    const uint8_t expectedOrderRt2[TEST_NUMBER_OF_FRAMES * 2u] = {0u, 1u, 2u, 3u, 4u, 0u, 4u, 1u, 2u, 3u};
+    TEST_ASSERT_EQUAL(TEST_NUMBER_OF_FRAMES * 2u, testNumberOfTransmittedFrames);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedOrderRt2, testTransmittedMuxValues, TEST_NUMBER_OF_FRAMES * 2u);
+
+    /* ======= RT3/3: Test implementation */
+    /* cell 9 is in frame 2 */
+    can_tableCellVoltages.cellVoltage_mV[0u][0u][9u] += 10;
+    can_tableCellVoltages.header.timestamp = 200u;
+    testNumberOfTransmittedFrames          = 0u;
+    DATA_Read1DataBlock_ExpectAndReturn(can_kShim.pTableCellVoltage, STD_OK);
+    /* ======= RT3/3: Call function under test */
+    for (uint8_t frame = 0u; frame < TEST_NUMBER_OF_FRAMES; frame++) {
+        TEST_CallCellVoltages(&testMuxId, (uint32_t)(TEST_NUMBER_OF_FRAMES - 1u - frame));
+    }
+    /* ======= RT3/3: Test output verification */
+    const uint8_t expectedOrderRt3[TEST_NUMBER_OF_FRAMES] = {0u, 2u, 4u, 1u, 3u};
+    TEST_ASSERT_EQUAL(TEST_NUMBER_OF_FRAMES, testNumberOfTransmittedFrames);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedOrderRt3, testTransmittedMuxValues, TEST_NUMBER_OF_FRAMES);
+}
@@ -456,8 +456,6 @@ void testCANTX_StringMinimumMaximumVoltage(void) {
 
     /* ======= Routine tests =============================================== */
     /* ======= RT1/2: Test implementation */
-    DATA_Read1DataBlock_ExpectAndReturn(can_kShim.pTableMinMax, STD_OK);
-
     CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 3u, 4u, 0u, CAN_BIG_ENDIAN);
     CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[1u]);
 
@@ -480,8 +478,6 @@ void testCANTX_StringMinimumMaximumVoltage(void) {
 
     /* ======= RT2/2: Test implementation */
     testMuxId = 1u;
-    DATA_Read1DataBlock_ExpectAndReturn(can_kShim.pTableMinMax, STD_OK);
-
     CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 3u, 4u, 1u, CAN_BIG_ENDIAN);
 
     CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 31u, 14u, testMaximumCellVoltage1, CAN_BIG_ENDIAN);
@@ -557,8 +553,6 @@ void testCANTX_StringMinimumMaximumTemp(void) {
 
     /* ======= Routine tests =============================================== */
     /* ======= RT1/2: Test implementation */
-    DATA_Read1DataBlock_ExpectAndReturn(can_kShim.pTableMinMax, STD_OK);
-
     CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 3u, 4u, 0u, CAN_BIG_ENDIAN);
     CAN_TxSetMessageDataWithSignalData_ReturnThruPtr_pMessage(&testMessageData[1u]);
 
@@ -583,8 +577,6 @@ void testCANTX_StringMinimumMaximumTemp(void) {
 
     /* ======= RT2/2: Test implementation */
     testMuxId = 1u;
-    DATA_Read1DataBlock_ExpectAndReturn(can_kShim.pTableMinMax, STD_OK);
-
     CAN_TxSetMessageDataWithSignalData_Expect(&testMessageData[0u], 3u, 4u, 1u, CAN_BIG_ENDIAN);
 
     CAN_TxPrepareSignalData_Expect(&testMaximumTemperature1, cantx_testSignalMaximumTemperature);
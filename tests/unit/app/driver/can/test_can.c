@@ -456,6 +456,124 @@ void testCAN_IsMessagePeriodElapsed(void) {
     TEST_ASSERT_EQUAL(true, TEST_CAN_IsMessagePeriodElapsed(0u, 0u));
 }
 
+void testCAN_GetNumberOfFreeTxMessageBoxes(void) {
+    /* invalid node */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CAN_GetNumberOfFreeTxMessageBoxes(NULL_PTR));
+
+    /* every second message box is pending */
+    for (uint8_t messageBox = 1u; messageBox <= CAN_NR_OF_TX_MESSAGE_BOX; messageBox++) {
+        canIsTxMessagePending_ExpectAndReturn(can_node1.canNodeRegister, messageBox, (uint32)(messageBox % 2u));
+    }
+    TEST_ASSERT_EQUAL(CAN_NR_OF_TX_MESSAGE_BOX / 2u, TEST_CAN_GetNumberOfFreeTxMessageBoxes(CAN_NODE_1));
+}
+
+void testCAN_RefillBusLoadBudget(void) {
+    /* 500 kbit/s * 10 ms * 40 % = 2000 bit per tick */
+    canTestState->txBusLoadBudget_bit = 0;
+    TEST_CAN_RefillBusLoadBudget();
+    TEST_ASSERT_EQUAL_INT32(2000, canTestState->txBusLoadBudget_bit);
+
+    /* budget is accumulated over 100 ms at most */
+    canTestState->txBusLoadBudget_bit = 19000;
+    TEST_CAN_RefillBusLoadBudget();
+    TEST_ASSERT_EQUAL_INT32(20000, canTestState->txBusLoadBudget_bit);
+}
+
+void testCAN_TransmitOrStoreMessageChargesBudget(void) {
+    uint8_t data[CAN_MAX_DLC] = {0u};
+    /* invalid arguments */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CAN_TransmitOrStoreMessage(can_txMessagesLength, data));
+    TEST_ASSERT_FAIL_ASSERT(TEST_CAN_TransmitOrStoreMessage(0u, NULL_PTR));
+
+    /* message is sent in the first free message box */
+    canTestState->txBusLoadBudget_bit = 1000;
+    vPortDisableInterrupts_Expect();
+    canIsTxMessagePending_ExpectAndReturn(can_node1.canNodeRegister, 1u, 0u);
+    canUpdateID_Expect(
+        can_node1.canNodeRegister,
+        1u,
+        ((TEST_CANTX_ID_DUMMY << CAN_IF2ARB_STANDARD_IDENTIFIER_SHIFT) | CAN_IF2ARB_SET_TX_DIRECTION |
+         CAN_IF2ARB_USE_STANDARD_IDENTIFIER));
+    canTransmit_ExpectAndReturn(can_node1.canNodeRegister, 1u, data, 0u);
+    vPortEnableInterrupts_Expect();
+    TEST_CAN_TransmitOrStoreMessage(0u, data);
+    TEST_ASSERT_EQUAL_INT32(1000 - (int32_t)CAN_TX_FRAME_LENGTH_bit, canTestState->txBusLoadBudget_bit);
+
+    /* the debt is limited to the budget of 100 ms */
+    canTestState->txBusLoadBudget_bit = -20000;
+    vPortDisableInterrupts_Expect();
+    canIsTxMessagePending_ExpectAndReturn(can_node1.canNodeRegister, 1u, 0u);
+    canUpdateID_Expect(
+        can_node1.canNodeRegister,
+        1u,
+        ((TEST_CANTX_ID_DUMMY << CAN_IF2ARB_STANDARD_IDENTIFIER_SHIFT) | CAN_IF2ARB_SET_TX_DIRECTION |
+         CAN_IF2ARB_USE_STANDARD_IDENTIFIER));
+    canTransmit_ExpectAndReturn(can_node1.canNodeRegister, 1u, data, 0u);
+    vPortEnableInterrupts_Expect();
+    TEST_CAN_TransmitOrStoreMessage(0u, data);
+    TEST_ASSERT_EQUAL_INT32(-20000, canTestState->txBusLoadBudget_bit);
+}
+
+void testCAN_IsBurstFrameAllowed(void) {
+    /* invalid node */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CAN_IsBurstFrameAllowed(NULL_PTR));
+
+    /* budget exhausted: the message boxes are not checked */
+    canTestState->txBusLoadBudget_bit = (int32_t)CAN_TX_FRAME_LENGTH_bit - 1;
+    TEST_ASSERT_FALSE(TEST_CAN_IsBurstFrameAllowed(CAN_NODE_1));
+
+    /* budget available, only the reserved message boxes are free */
+    canTestState->txBusLoadBudget_bit = (int32_t)CAN_TX_FRAME_LENGTH_bit;
+    for (uint8_t messageBox = 1u; messageBox <= CAN_NR_OF_TX_MESSAGE_BOX; messageBox++) {
+        canIsTxMessagePending_ExpectAndReturn(
+            can_node1.canNodeRegister, messageBox, (messageBox > CAN_TX_BURST_MAILBOX_RESERVE) ? 1u : 0u);
+    }
+    TEST_ASSERT_FALSE(TEST_CAN_IsBurstFrameAllowed(CAN_NODE_1));
+
+    /* budget available, one more than the reserved message boxes is free */
+    for (uint8_t messageBox = 1u; messageBox <= CAN_NR_OF_TX_MESSAGE_BOX; messageBox++) {
+        canIsTxMessagePending_ExpectAndReturn(
+            can_node1.canNodeRegister, messageBox, (messageBox > (CAN_TX_BURST_MAILBOX_RESERVE + 1u)) ? 1u : 0u);
+    }
+    TEST_ASSERT_TRUE(TEST_CAN_IsBurstFrameAllowed(CAN_NODE_1));
+}
+
+void testCAN_GetShimTable(void) {
+    /* no table or more than one table */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CAN_GetShimTable(CAN_SHIM_TABLE_NONE));
+    TEST_ASSERT_FAIL_ASSERT(TEST_CAN_GetShimTable(CAN_SHIM_TABLE_MOL | CAN_SHIM_TABLE_MSL));
+
+    TEST_ASSERT_EQUAL_PTR(can_kShim.pTableErrorState, TEST_CAN_GetShimTable(CAN_SHIM_TABLE_ERROR_STATE));
+    TEST_ASSERT_EQUAL_PTR(can_kShim.pTableMinMax, TEST_CAN_GetShimTable(CAN_SHIM_TABLE_MIN_MAX));
+    TEST_ASSERT_EQUAL_PTR(can_kShim.pTableSoe, TEST_CAN_GetShimTable(CAN_SHIM_TABLE_SOE));
+}
+
+void testCAN_ReadDatabaseSnapshot(void) {
+    /* invalid table */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CAN_ReadDatabaseSnapshot((uint16_t)(1u << CAN_SHIM_NR_OF_TABLES)));
+
+    /* no table needed: no database access */
+    TEST_ASSERT_EQUAL(0u, TEST_CAN_ReadDatabaseSnapshot(CAN_SHIM_TABLE_NONE));
+
+    /* one table */
+    DATA_Read1DataBlock_ExpectAndReturn(can_kShim.pTableMinMax, STD_OK);
+    TEST_ASSERT_EQUAL(1u, TEST_CAN_ReadDatabaseSnapshot(CAN_SHIM_TABLE_MIN_MAX));
+
+    /* six tables are read with two database accesses */
+    DATA_Read4DataBlocks_ExpectAndReturn(
+        can_kShim.pTableEnergyCounter,
+        can_kShim.pTableErrorState,
+        can_kShim.pTableInsulation,
+        can_kShim.pTableMinMax,
+        STD_OK);
+    DATA_Read2DataBlocks_ExpectAndReturn(can_kShim.pTableMol, can_kShim.pTableMsl, STD_OK);
+    TEST_ASSERT_EQUAL(
+        2u,
+        TEST_CAN_ReadDatabaseSnapshot(
+            CAN_SHIM_TABLE_ENERGY_COUNTER | CAN_SHIM_TABLE_ERROR_STATE | CAN_SHIM_TABLE_INSULATION |
+            CAN_SHIM_TABLE_MIN_MAX | CAN_SHIM_TABLE_MOL | CAN_SHIM_TABLE_MSL));
+}
+
 void testCAN_CheckCanTiming(void) {
     /* Test case: OK, skip CS timing check */
     DATA_BLOCK_STATE_REQUEST_s stateRequestTest = {.header.uniqueId = DATA_BLOCK_ID_STATE_REQUEST};
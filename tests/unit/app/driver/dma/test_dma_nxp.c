@@ -43,7 +43,7 @@
  * @file    test_dma_nxp.c
  * @author  foxBMS Team
  * @date    2026-02-12 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -64,7 +64,9 @@
 #include "Mocki2c.h"
 #include "Mockio.h"
 #include "Mockspi.h"
+#include "Mocksys_mon_bus.h"
 #include "Mocktask.h"
+#include "Mocktrace.h"
 
 #include "dma.h"
 #include "struct_helper.h"
@@ -79,6 +81,8 @@ TEST_INCLUDE_PATH("../../src/app/driver/i2c")
 TEST_INCLUDE_PATH("../../src/app/driver/io")
 TEST_INCLUDE_PATH("../../src/app/driver/rtc")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
+TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
+TEST_INCLUDE_PATH("../../src/app/engine/trace")
 TEST_INCLUDE_PATH("../../src/app/task/config")
 TEST_INCLUDE_PATH("../../src/app/task/ftask")
 
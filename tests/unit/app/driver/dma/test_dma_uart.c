@@ -43,7 +43,7 @@
  * @file    test_dma_uart.c
  * @author  foxBMS Team
  * @date    2020-11-24 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -64,7 +64,9 @@
 #include "Mocki2c.h"
 #include "Mockio.h"
 #include "Mockspi.h"
+#include "Mocksys_mon_bus.h"
 #include "Mocktask.h"
+#include "Mocktrace.h"
 
 #include "uart_cfg.h"
 
@@ -82,6 +84,8 @@ TEST_INCLUDE_PATH("../../src/app/driver/io")
 TEST_INCLUDE_PATH("../../src/app/driver/rtc")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
 TEST_INCLUDE_PATH("../../src/app/driver/uart")
+TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
+TEST_INCLUDE_PATH("../../src/app/engine/trace")
 TEST_INCLUDE_PATH("../../src/app/task/config")
 TEST_INCLUDE_PATH("../../src/app/task/ftask")
 
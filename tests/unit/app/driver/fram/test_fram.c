@@ -43,7 +43,7 @@
  * @file    test_fram.c
  * @author  foxBMS Team
  * @date    2020-04-01 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -55,11 +55,13 @@
 /*========== Includes =======================================================*/
 #include "unity.h"
 #include "MockHL_spi.h"
+#include "Mockbg_jobs.h"
 #include "Mockcrc.h"
 #include "Mockdiag.h"
 #include "Mockdiag_cfg.h"
 #include "Mockio.h"
 #include "Mockmcu.h"
+#include "Mockos.h"
 #include "Mockspi.h"
 
 #include "fram_cfg.h"
@@ -79,6 +81,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
 TEST_INCLUDE_PATH("../../src/app/driver/fram")
 TEST_INCLUDE_PATH("../../src/app/driver/io")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
+TEST_INCLUDE_PATH("../../src/app/engine/bg_jobs")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
 TEST_INCLUDE_PATH("../../src/version")
 
@@ -103,6 +106,9 @@ VER_VERSION_s ver_versionInformation VER_VERSION_INFORMATION = {
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    TEST_FRAM_Reset();
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
 }
 
 void tearDown(void) {
@@ -171,7 +177,9 @@ void testFRAM_Initialize(void) {
  *          - Argument validation:
  *            - AT1/1: invalid blockId &rarr; assert
  *          - Routine validation:
- *            - RT1/x: TODO
+ *            - RT1/3: CRC busy &rarr; block is queued for the background job
+ *            - RT2/3: block is written
+ *            - RT3/3: unchanged block is not written again
  */
 void testFRAM_WriteData(void) {
     /* ======= Assertion tests ============================================= */
@@ -190,18 +198,22 @@ void testFRAM_WriteData(void) {
     /* ======= Routine tests =============================================== */
     uint16_t read = 0u;
 
-    /* ======= RT1/2: Test implementation */
+    /* ======= RT1/3: Test implementation */
     uint64_t crc           = 0u;
     uint8_t pWrite         = 0u;
     uint32_t lengthInBytes = 6u;
     CRC_CalculateCrc_ExpectAndReturn(&crc, &pWrite, lengthInBytes, STD_NOT_OK);
+    /* the block is written later by the background job */
+    BGJ_Request_Expect(BGJ_JOB_ID_FRAM_WRITE);
     FRAM_RETURN_TYPE_e retFail = FRAM_WriteData(FRAM_BLOCK_ID_VERSION);
     TEST_ASSERT_EQUAL(FRAM_ACCESS_CRC_BUSY, retFail);
+    TEST_ASSERT_TRUE(TEST_FRAM_IsWritePending(FRAM_BLOCK_ID_VERSION));
 
-    /* ======= RT2/2: Test implementation */
+    /* ======= RT2/3: Test implementation */
     CRC_CalculateCrc_ExpectAndReturn(&crc, &pWrite, lengthInBytes, STD_OK);
     SPI_GetSpiIndex_ExpectAndReturn(spi_framInterface.pNode, SPI_SPI1_INDEX);
     SPI_Lock_ExpectAndReturn(0u, STD_OK);
+    MCU_GetFreeRunningCount_ExpectAndReturn(0u);
     IO_PinReset_Expect(spi_framInterface.pGioPort, spi_framInterface.csPin);
 
     uint16_t writeEnable = FRAM_WRITE_ENABLE_COMMAND;
@@ -237,9 +249,26 @@ void testFRAM_WriteData(void) {
     IO_PinSet_Expect(spi_framInterface.pGioPort, spi_framInterface.csPin);
     SPI_GetSpiIndex_ExpectAndReturn(spi_framInterface.pNode, SPI_SPI1_INDEX);
     SPI_Unlock_Expect(0u);
+    MCU_GetFreeRunningCount_ExpectAndReturn(10u);
+    MCU_ConvertFrcDifferenceToTimespan_us_ExpectAndReturn(10u, 5u);
 
     FRAM_RETURN_TYPE_e retSuccess = FRAM_WriteData(FRAM_BLOCK_ID_VERSION);
     TEST_ASSERT_EQUAL(FRAM_ACCESS_OK, retSuccess);
+
+    /* ======= RT3/3: Test implementation */
+    /* the content has not changed since the last write */
+    CRC_CalculateCrc_ExpectAndReturn(&crc, &pWrite, lengthInBytes, STD_OK);
+    retSuccess = FRAM_WriteData(FRAM_BLOCK_ID_VERSION);
+    TEST_ASSERT_EQUAL(FRAM_ACCESS_OK, retSuccess);
+
+    FRAM_STATISTICS_s statistics = {0};
+    OS_GetTickCount_ExpectAndReturn(0u);
+    FRAM_GetStatistics(&statistics);
+    TEST_ASSERT_EQUAL(1u, statistics.blockWrites);
+    TEST_ASSERT_EQUAL(1u, statistics.skippedWrites);
+    TEST_ASSERT_EQUAL(1u, statistics.busyRejections);
+    TEST_ASSERT_EQUAL(FRAM_CRC_HEADER_SIZE + lengthInBytes, statistics.bytesWritten);
+    TEST_ASSERT_EQUAL(5u, statistics.writeTime_us);
 }
 
 /**
@@ -262,8 +291,9 @@ void testFRAM_ReinitializeAllEntries(void) {
         write         = (uint8_t *)(fram_databaseHeader[i]).blockptr;
         lengthInBytes = (fram_databaseHeader[i]).datalength;
         CRC_CalculateCrc_ExpectAndReturn(&crc, write, lengthInBytes, STD_NOT_OK);
+        BGJ_Request_Expect(BGJ_JOB_ID_FRAM_WRITE);
     }
-    FRAM_ReinitializeAllEntries();
+    TEST_ASSERT_EQUAL(STD_NOT_OK, FRAM_ReinitializeAllEntries());
 }
 
 /**
@@ -0,0 +1,453 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+
+/**
+ * @file    test_fram_persistence.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the dirty tracking and the batched writes of the fram
+ *          module
+ * @details The FRAM is emulated on the host: the SPI transfers are decoded
+ *          into write enable, write and read commands on a memory array, so
+ *          that the tests can check what is actually stored in the FRAM.
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "MockHL_spi.h"
+#include "Mockbg_jobs.h"
+#include "Mockcrc.h"
+#include "Mockdiag.h"
+#include "Mockdiag_cfg.h"
+#include "Mockio.h"
+#include "Mockmcu.h"
+#include "Mockos.h"
+#include "Mockspi.h"
+
+#include "fram_cfg.h"
+#include "spi_cfg.h"
+
+#include "fassert.h"
+#include "fram.h"
+#include "test_assert_helper.h"
+#include "version.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/crc")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/driver/io")
+TEST_INCLUDE_PATH("../../src/app/driver/spi")
+TEST_INCLUDE_PATH("../../src/app/engine/bg_jobs")
+TEST_INCLUDE_PATH("../../src/app/engine/diag")
+TEST_INCLUDE_PATH("../../src/version")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+VER_VERSION_s ver_versionInformation VER_VERSION_INFORMATION = {
+    .underVersionControl     = true,
+    .isDirty                 = true,
+    .major                   = 120,
+    .minor                   = 121,
+    .patch                   = 122,
+    .distanceFromLastRelease = 22,
+    .commitHash              = "abcdefgh",
+    .remote                  = "git@remote-repo.de:foxbms-2.git",
+};
+
+#define TEST_FRAM_SIZE_BYTES         (0x040000u)
+#define TEST_FRAM_WRITE_COMMAND      (0x02u)
+#define TEST_FRAM_READ_COMMAND       (0x03u)
+#define TEST_FRAM_WRITE_ENABLE       (0x06u)
+#define TEST_FRAM_NO_COMMAND         (0x00u)
+#define TEST_FRAM_ADDRESS_BYTES      (3u)
+#define TEST_FREE_RUNNING_INCREMENT  (100u)
+#define TEST_CRC_HEADER_AND_SOC_SIZE (FRAM_CRC_HEADER_SIZE + sizeof(FRAM_SOC_s))
+
+/** host stand-in for the FRAM */
+typedef struct {
+    uint8_t memory[TEST_FRAM_SIZE_BYTES]; /*!< content of the FRAM */
+    bool isWriteEnabled;                  /*!< write enable latch */
+    uint8_t command;                      /*!< command of the current transfer */
+    uint8_t receivedAddressBytes;         /*!< address bytes received in the current transfer */
+    uint32_t address;                     /*!< address of the next data byte */
+    uint32_t writeCommands;               /*!< number of write commands */
+    uint32_t writtenBytes;                /*!< number of data bytes written */
+} TEST_FRAM_DEVICE_s;
+
+static TEST_FRAM_DEVICE_s test_fram = {0};
+
+static bool test_isSpiBusy               = false;
+static bool test_isCrcBusy               = false;
+static uint32_t test_numberOfJobRequests = 0u;
+static uint32_t test_freeRunningCount    = 0u;
+static uint32_t test_tickCount_ms        = 0u;
+
+static void TEST_IO_PinReset(volatile uint32_t *pRegisterAddress, uint32_t pin, int numCalls) {
+    (void)pRegisterAddress;
+    (void)pin;
+    (void)numCalls;
+    /* chip select low: a new transfer starts */
+    test_fram.command              = TEST_FRAM_NO_COMMAND;
+    test_fram.receivedAddressBytes = 0u;
+    test_fram.address              = 0u;
+}
+
+static void TEST_IO_PinSet(volatile uint32_t *pRegisterAddress, uint32_t pin, int numCalls) {
+    (void)pRegisterAddress;
+    (void)pin;
+    (void)numCalls;
+    /* the write enable latch is reset at the end of a write command */
+    if (test_fram.command == TEST_FRAM_WRITE_COMMAND) {
+        test_fram.isWriteEnabled = false;
+    }
+    test_fram.command = TEST_FRAM_NO_COMMAND;
+}
+
+static void TEST_SPI_FramTransmitReceiveData(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16 *pTxBuff,
+    uint16 *pRxBuff,
+    uint32 frameLength,
+    int numCalls) {
+    (void)numCalls;
+    TEST_ASSERT_EQUAL_PTR(&spi_framInterface, pSpiInterface);
+    TEST_ASSERT_EQUAL(1u, frameLength);
+    const uint8_t byte = (uint8_t)(*pTxBuff & 0xFFu);
+
+    if (test_fram.command == TEST_FRAM_NO_COMMAND) {
+        test_fram.command = byte;
+        if (byte == TEST_FRAM_WRITE_ENABLE) {
+            test_fram.isWriteEnabled = true;
+        } else if (byte == TEST_FRAM_WRITE_COMMAND) {
+            TEST_ASSERT_TRUE(test_fram.isWriteEnabled);
+            test_fram.writeCommands++;
+        } else {
+            TEST_ASSERT_EQUAL(TEST_FRAM_READ_COMMAND, byte);
+        }
+    } else if (test_fram.receivedAddressBytes < TEST_FRAM_ADDRESS_BYTES) {
+        test_fram.address = (test_fram.address << 8u) | byte;
+        test_fram.receivedAddressBytes++;
+    } else {
+        TEST_ASSERT_TRUE(test_fram.address < TEST_FRAM_SIZE_BYTES);
+        if (test_fram.command == TEST_FRAM_WRITE_COMMAND) {
+            test_fram.memory[test_fram.address] = byte;
+            test_fram.writtenBytes++;
+        } else {
+            *pRxBuff = test_fram.memory[test_fram.address];
+        }
+        test_fram.address++;
+    }
+}
+
+/** software replacement for the CRC hardware (FNV-1a) */
+static STD_RETURN_TYPE_e TEST_CRC_CalculateCrc(uint64_t *pCrc, uint8_t *pData, uint32_t lengthInBytes, int numCalls) {
+    (void)numCalls;
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+    if (test_isCrcBusy == false) {
+        uint64_t crc = 0xCBF29CE484222325u;
+        for (uint32_t i = 0u; i < lengthInBytes; i++) {
+            crc ^= pData[i];
+            crc *= 0x100000001B3u;
+        }
+        *pCrc  = crc;
+        retVal = STD_OK;
+    }
+    return retVal;
+}
+
+static STD_RETURN_TYPE_e TEST_SPI_Lock(uint8_t spi, int numCalls) {
+    (void)spi;
+    (void)numCalls;
+    return (test_isSpiBusy == true) ? STD_NOT_OK : STD_OK;
+}
+
+static void TEST_BGJ_Request(BGJ_JOB_ID_e jobId, int numCalls) {
+    (void)numCalls;
+    TEST_ASSERT_EQUAL(BGJ_JOB_ID_FRAM_WRITE, jobId);
+    test_numberOfJobRequests++;
+}
+
+static uint32_t TEST_MCU_GetFreeRunningCount(int numCalls) {
+    (void)numCalls;
+    const uint32_t count = test_freeRunningCount;
+    test_freeRunningCount += TEST_FREE_RUNNING_INCREMENT;
+    return count;
+}
+
+static uint32_t TEST_MCU_ConvertFrcDifferenceToTimespan_us(uint32_t count, int numCalls) {
+    (void)numCalls;
+    return count;
+}
+
+static uint32_t TEST_OS_GetTickCount(int numCalls) {
+    (void)numCalls;
+    return test_tickCount_ms;
+}
+
+/** compares the stored block (behind its CRC header) with the passed data */
+static void TEST_AssertStoredBlock(FRAM_BLOCK_ID_e blockId, const void *pkExpected) {
+    const uint32_t address = fram_databaseHeader[blockId].address + FRAM_CRC_HEADER_SIZE;
+    TEST_ASSERT_EQUAL_MEMORY(pkExpected, &test_fram.memory[address], fram_databaseHeader[blockId].datalength);
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    (void)memset(&test_fram, 0, sizeof(test_fram));
+    test_isSpiBusy           = false;
+    test_isCrcBusy           = false;
+    test_numberOfJobRequests = 0u;
+    test_freeRunningCount    = 0u;
+    test_tickCount_ms        = 0u;
+    (void)memset(&fram_soc, 0, sizeof(fram_soc));
+    (void)memset(&fram_sbcInit, 0, sizeof(fram_sbcInit));
+    (void)memset(&fram_soh, 0, sizeof(fram_soh));
+
+    IO_PinReset_Stub(TEST_IO_PinReset);
+    IO_PinSet_Stub(TEST_IO_PinSet);
+    SPI_FramTransmitReceiveData_Stub(TEST_SPI_FramTransmitReceiveData);
+    CRC_CalculateCrc_Stub(TEST_CRC_CalculateCrc);
+    SPI_Lock_Stub(TEST_SPI_Lock);
+    SPI_Unlock_Ignore();
+    SPI_GetSpiIndex_IgnoreAndReturn(SPI_SPI1_INDEX);
+    BGJ_Request_Stub(TEST_BGJ_Request);
+    MCU_Delay_us_Ignore();
+    MCU_GetFreeRunningCount_Stub(TEST_MCU_GetFreeRunningCount);
+    MCU_ConvertFrcDifferenceToTimespan_us_Stub(TEST_MCU_ConvertFrcDifferenceToTimespan_us);
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    OS_GetTickCount_Stub(TEST_OS_GetTickCount);
+    DIAG_Handler_IgnoreAndReturn(DIAG_HANDLER_RETURN_OK);
+
+    /* start as after a power cycle with an empty FRAM */
+    TEST_FRAM_Reset();
+    FRAM_Initialize();
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testRequestedBlocksAreWrittenWithOneWriteCommandPerAdjacentRun(void) {
+    fram_soc.averageSoc_perc[0u] = 42.0f;
+    fram_sbcInit.phase           = 3u;
+    fram_soh.cellCapacity_mAh[0] = 3500.0f;
+
+    /* SOC and SBC init state are stored next to each other, SOH is not */
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOH);
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SBC_INIT_STATE);
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+    TEST_ASSERT_EQUAL(3u, test_numberOfJobRequests);
+
+    FRAM_WritePendingData();
+
+    TEST_ASSERT_EQUAL(2u, test_fram.writeCommands);
+    TEST_AssertStoredBlock(FRAM_BLOCK_ID_SOC, &fram_soc);
+    TEST_AssertStoredBlock(FRAM_BLOCK_ID_SBC_INIT_STATE, &fram_sbcInit);
+    TEST_AssertStoredBlock(FRAM_BLOCK_ID_SOH, &fram_soh);
+    TEST_ASSERT_FALSE(TEST_FRAM_IsWritePending(FRAM_BLOCK_ID_SOC));
+
+    FRAM_STATISTICS_s statistics = {0};
+    FRAM_GetStatistics(&statistics);
+    TEST_ASSERT_EQUAL(3u, statistics.writeRequests);
+    TEST_ASSERT_EQUAL(3u, statistics.blockWrites);
+    TEST_ASSERT_EQUAL(2u, statistics.writeBursts);
+    TEST_ASSERT_EQUAL(test_fram.writtenBytes, statistics.bytesWritten);
+
+    /* the stored blocks are read back with a valid CRC */
+    (void)memset(&fram_soc, 0, sizeof(fram_soc));
+    TEST_ASSERT_EQUAL(FRAM_ACCESS_OK, FRAM_ReadData(FRAM_BLOCK_ID_SOC));
+    TEST_ASSERT_EQUAL_FLOAT(42.0f, fram_soc.averageSoc_perc[0u]);
+}
+
+void testRepeatedRequestsAreMergedIntoOneWrite(void) {
+    fram_soc.averageSoc_perc[0u] = 10.0f;
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+    FRAM_WritePendingData();
+
+    TEST_ASSERT_EQUAL(1u, test_fram.writeCommands);
+    TEST_ASSERT_EQUAL(TEST_CRC_HEADER_AND_SOC_SIZE, test_fram.writtenBytes);
+    FRAM_STATISTICS_s statistics = {0};
+    FRAM_GetStatistics(&statistics);
+    TEST_ASSERT_EQUAL(2u, statistics.coalescedRequests);
+    TEST_ASSERT_EQUAL(1u, statistics.blockWrites);
+}
+
+void testUnchangedBlocksAreNotWrittenAgain(void) {
+    fram_soc.averageSoc_perc[0u] = 10.0f;
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+    FRAM_WritePendingData();
+    TEST_ASSERT_EQUAL(1u, test_fram.writeCommands);
+
+    /* same content: neither the background job nor a direct write touches the FRAM */
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+    FRAM_WritePendingData();
+    TEST_ASSERT_EQUAL(FRAM_ACCESS_OK, FRAM_WriteData(FRAM_BLOCK_ID_SOC));
+    TEST_ASSERT_EQUAL(1u, test_fram.writeCommands);
+
+    /* changed content is written */
+    fram_soc.averageSoc_perc[0u] = 11.0f;
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+    FRAM_WritePendingData();
+    TEST_ASSERT_EQUAL(2u, test_fram.writeCommands);
+    TEST_AssertStoredBlock(FRAM_BLOCK_ID_SOC, &fram_soc);
+
+    FRAM_STATISTICS_s statistics = {0};
+    FRAM_GetStatistics(&statistics);
+    TEST_ASSERT_EQUAL(2u, statistics.skippedWrites);
+    TEST_ASSERT_EQUAL(2u, statistics.blockWrites);
+}
+
+void testBlockThatHasBeenReadIsNotWrittenAgain(void) {
+    fram_soc.averageSoc_perc[0u] = 10.0f;
+    TEST_ASSERT_EQUAL(FRAM_ACCESS_OK, FRAM_WriteData(FRAM_BLOCK_ID_SOC));
+    TEST_ASSERT_EQUAL(1u, test_fram.writeCommands);
+
+    /* restart: the driver does not know the content of the FRAM until it is read */
+    TEST_FRAM_Reset();
+    (void)memset(&fram_soc, 0, sizeof(fram_soc));
+    TEST_ASSERT_EQUAL(FRAM_ACCESS_OK, FRAM_ReadData(FRAM_BLOCK_ID_SOC));
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+    FRAM_WritePendingData();
+    TEST_ASSERT_EQUAL(1u, test_fram.writeCommands);
+}
+
+void testBusySpiKeepsBlocksPending(void) {
+    fram_soc.averageSoc_perc[0u] = 10.0f;
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+
+    test_isSpiBusy = true;
+    FRAM_WritePendingData();
+    TEST_ASSERT_EQUAL(0u, test_fram.writeCommands);
+    TEST_ASSERT_TRUE(TEST_FRAM_IsWritePending(FRAM_BLOCK_ID_SOC));
+    /* one request by FRAM_RequestWrite, one to retry */
+    TEST_ASSERT_EQUAL(2u, test_numberOfJobRequests);
+
+    test_isSpiBusy = false;
+    FRAM_WritePendingData();
+    TEST_ASSERT_EQUAL(1u, test_fram.writeCommands);
+    TEST_AssertStoredBlock(FRAM_BLOCK_ID_SOC, &fram_soc);
+
+    FRAM_STATISTICS_s statistics = {0};
+    FRAM_GetStatistics(&statistics);
+    TEST_ASSERT_EQUAL(1u, statistics.busyRejections);
+}
+
+void testBusyCrcKeepsBlockPending(void) {
+    fram_soc.averageSoc_perc[0u] = 10.0f;
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+
+    test_isCrcBusy = true;
+    FRAM_WritePendingData();
+    TEST_ASSERT_EQUAL(0u, test_fram.writeCommands);
+    TEST_ASSERT_TRUE(TEST_FRAM_IsWritePending(FRAM_BLOCK_ID_SOC));
+
+    test_isCrcBusy = false;
+    FRAM_WritePendingData();
+    TEST_ASSERT_EQUAL(1u, test_fram.writeCommands);
+}
+
+void testWriteDataQueuesBlockIfSpiIsBusy(void) {
+    fram_soc.averageSoc_perc[0u] = 10.0f;
+    test_isSpiBusy               = true;
+    TEST_ASSERT_EQUAL(FRAM_ACCESS_SPI_BUSY, FRAM_WriteData(FRAM_BLOCK_ID_SOC));
+    TEST_ASSERT_TRUE(TEST_FRAM_IsWritePending(FRAM_BLOCK_ID_SOC));
+    TEST_ASSERT_EQUAL(1u, test_numberOfJobRequests);
+
+    test_isSpiBusy = false;
+    FRAM_WritePendingData();
+    TEST_AssertStoredBlock(FRAM_BLOCK_ID_SOC, &fram_soc);
+}
+
+void testReinitializeWritesUnchangedBlocks(void) {
+    TEST_ASSERT_EQUAL(STD_OK, FRAM_ReinitializeAllEntries());
+    TEST_ASSERT_EQUAL(FRAM_BLOCK_MAX, test_fram.writeCommands);
+
+    /* a changed layout requires that all blocks are written again */
+    TEST_ASSERT_EQUAL(STD_OK, FRAM_ReinitializeAllEntries());
+    TEST_ASSERT_EQUAL(2u * FRAM_BLOCK_MAX, test_fram.writeCommands);
+    for (uint8_t i = 0u; i < (uint8_t)FRAM_BLOCK_MAX; i++) {
+        TEST_ASSERT_EQUAL(FRAM_ACCESS_OK, FRAM_ReadData((FRAM_BLOCK_ID_e)i));
+    }
+}
+
+void testStatisticsReportThroughputAndBytesPerHour(void) {
+    FRAM_STATISTICS_s statistics = {0};
+    FRAM_ResetStatistics();
+    FRAM_GetStatistics(&statistics);
+    TEST_ASSERT_EQUAL(0u, statistics.throughput_Bps);
+    TEST_ASSERT_EQUAL(0u, statistics.bytesWrittenPerHour);
+
+    fram_soc.averageSoc_perc[0u] = 10.0f;
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+    FRAM_WritePendingData();
+
+    /* one second later */
+    test_tickCount_ms = 1000u;
+    FRAM_GetStatistics(&statistics);
+    TEST_ASSERT_EQUAL(TEST_CRC_HEADER_AND_SOC_SIZE, statistics.bytesWritten);
+    TEST_ASSERT_EQUAL(TEST_FREE_RUNNING_INCREMENT, statistics.writeTime_us);
+    TEST_ASSERT_EQUAL(
+        (TEST_CRC_HEADER_AND_SOC_SIZE * 1000000u) / TEST_FREE_RUNNING_INCREMENT, statistics.throughput_Bps);
+    TEST_ASSERT_EQUAL(TEST_CRC_HEADER_AND_SOC_SIZE * 3600u, statistics.bytesWrittenPerHour);
+
+    FRAM_ResetStatistics();
+    FRAM_GetStatistics(&statistics);
+    TEST_ASSERT_EQUAL(0u, statistics.bytesWritten);
+}
+
+void testInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(FRAM_RequestWrite(FRAM_BLOCK_MAX));
+    TEST_ASSERT_FAIL_ASSERT(FRAM_GetStatistics(NULL_PTR));
+}
@@ -43,7 +43,7 @@
  * @file    test_i2c.c
  * @author  foxBMS Team
  * @date    2021-07-23 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -58,6 +58,7 @@
 #include "MockHL_sys_dma.h"
 #include "Mockmcu.h"
 #include "Mockos.h"
+#include "Mocksys_mon_bus.h"
 
 #include "i2c.h"
 #include "test_assert_helper.h"
@@ -67,6 +68,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/dma")
 TEST_INCLUDE_PATH("../../src/app/driver/i2c")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
+TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
 
@@ -76,6 +78,10 @@ long FSYS_RaisePrivilege(void) {
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    SYSM_RecordBusAccess_Ignore();
+    SYSM_RecordBusRelease_Ignore();
+    SYSM_RecordBusTransfer_Ignore();
+    SYSM_RecordBusRejection_Ignore();
 }
 
 void tearDown(void) {
@@ -43,7 +43,7 @@
  * @file    test_spi.c
  * @author  foxBMS Team
  * @date    2020-04-01 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -62,6 +62,7 @@
 #include "Mockos.h"
 #include "Mockspi_cfg.h"
 #include "Mockspi_cfg_initialization.h"
+#include "Mocksys_mon_bus.h"
 
 #include "spi.h"
 #include "spi_cfg-helper.h"
@@ -77,6 +78,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/dma")
 TEST_INCLUDE_PATH("../../src/app/driver/io")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
+TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
 
@@ -179,6 +181,12 @@ spi_config_reg_t spiMockConfigRegister = {0};
 void setUp(void) {
     /* make sure PC0 of config register is clean */
     spiMockConfigRegister.CONFIG_PC0 = 0;
+
+    SYSM_RecordBusAccess_Ignore();
+    SYSM_RecordBusRelease_Ignore();
+    SYSM_RecordBusTransfer_Ignore();
+    SYSM_RecordBusTransferFromIsr_Ignore();
+    SYSM_RecordBusRejection_Ignore();
 }
 
 void tearDown(void) {
@@ -43,7 +43,7 @@
  * @file    test_uart.c
  * @author  foxBMS Team
  * @date    2025-08-25 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -59,8 +59,10 @@
 #include "MockHL_sci.h"
 #include "MockHL_sys_dma.h"
 #include "Mockftask.h"
+#include "Mocklog.h"
 #include "Mockmpu_prototypes.h"
 #include "Mockos.h"
+#include "Mocktrace.h"
 
 #include "dma_cfg.h"
 #include "uart_cfg.h"
@@ -78,6 +80,9 @@ TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/dma")
 TEST_INCLUDE_PATH("../../src/app/driver/rtc")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
+TEST_INCLUDE_PATH("../../src/app/engine/config")
+TEST_INCLUDE_PATH("../../src/app/engine/log")
+TEST_INCLUDE_PATH("../../src/app/engine/trace")
 TEST_INCLUDE_PATH("../../src/app/task/config")
 TEST_INCLUDE_PATH("../../src/app/task/ftask")
 
@@ -324,3 +329,70 @@ void testUART_Printf(void) {
     UART_Printf("Unit %s %d\n", "Test", 1);
     TEST_ASSERT_EQUAL(0, strcmp(TEST_UART_GetTxBufferString(), "Unit Test 1\n"));
 }
+
+void testUART_TransmitLogRecords(void) {
+    /* Received XOFF previously */
+    TEST_UART_SetSending(false);
+    UART_TransmitLogRecords();
+
+    /* No pending log records */
+    TEST_UART_SetSending(true);
+    LOG_GetNumberOfPendingRecords_ExpectAndReturn(0u);
+    UART_TransmitLogRecords();
+
+    /* Test not getting uart_txSemaphore */
+    LOG_GetNumberOfPendingRecords_ExpectAndReturn(1u);
+    OS_SemaphoreTake_ExpectAndReturn(uart_txSemaphore, 0u, OS_FAIL);
+    UART_TransmitLogRecords();
+
+    /* No complete record could be read */
+    LOG_GetNumberOfPendingRecords_ExpectAndReturn(1u);
+    OS_SemaphoreTake_ExpectAndReturn(uart_txSemaphore, 0u, OS_SUCCESS);
+    LOG_ReadRecords_ExpectAndReturn(NULL_PTR, UART_PRINTF_BUFFER_SIZE, 0u);
+    LOG_ReadRecords_IgnoreArg_pBuffer();
+    OS_SemaphoreGive_Expect(uart_txSemaphore);
+    UART_TransmitLogRecords();
+
+    /* Records are read and transmitted */
+    LOG_GetNumberOfPendingRecords_ExpectAndReturn(2u);
+    OS_SemaphoreTake_ExpectAndReturn(uart_txSemaphore, 0u, OS_SUCCESS);
+    LOG_ReadRecords_ExpectAndReturn(NULL_PTR, UART_PRINTF_BUFFER_SIZE, 2u * LOG_SERIALIZED_RECORD_SIZE_IN_BYTES);
+    LOG_ReadRecords_IgnoreArg_pBuffer();
+    dmaSetChEnable_Expect((dmaChannel_t)DMA_CHANNEL_SCI4_TX, (dmaTriggerType_t)DMA_HW);
+    sciEnableNotification_Expect(UART_REG, (uint32)((uint32_t)1u << UART_SCI_DMA_INTERRUPT));
+    UART_TransmitLogRecords();
+}
+
+void testUART_TransmitTraceSnapshot(void) {
+    /* No snapshot pending */
+    TRC_IsSnapshotPending_ExpectAndReturn(false);
+    TEST_ASSERT_FALSE(UART_TransmitTraceSnapshot());
+
+    /* Received XOFF previously */
+    TEST_UART_SetSending(false);
+    TRC_IsSnapshotPending_ExpectAndReturn(true);
+    TEST_ASSERT_TRUE(UART_TransmitTraceSnapshot());
+
+    /* Test not getting uart_txSemaphore */
+    TEST_UART_SetSending(true);
+    TRC_IsSnapshotPending_ExpectAndReturn(true);
+    OS_SemaphoreTake_ExpectAndReturn(uart_txSemaphore, 0u, OS_FAIL);
+    TEST_ASSERT_TRUE(UART_TransmitTraceSnapshot());
+
+    /* Nothing could be read */
+    TRC_IsSnapshotPending_ExpectAndReturn(true);
+    OS_SemaphoreTake_ExpectAndReturn(uart_txSemaphore, 0u, OS_SUCCESS);
+    TRC_ReadSnapshot_ExpectAndReturn(NULL_PTR, UART_PRINTF_BUFFER_SIZE, 0u);
+    TRC_ReadSnapshot_IgnoreArg_pBuffer();
+    OS_SemaphoreGive_Expect(uart_txSemaphore);
+    TEST_ASSERT_TRUE(UART_TransmitTraceSnapshot());
+
+    /* Part of the snapshot is read and transmitted */
+    TRC_IsSnapshotPending_ExpectAndReturn(true);
+    OS_SemaphoreTake_ExpectAndReturn(uart_txSemaphore, 0u, OS_SUCCESS);
+    TRC_ReadSnapshot_ExpectAndReturn(NULL_PTR, UART_PRINTF_BUFFER_SIZE, TRC_SERIALIZED_HEADER_SIZE_IN_BYTES);
+    TRC_ReadSnapshot_IgnoreArg_pBuffer();
+    dmaSetChEnable_Expect((dmaChannel_t)DMA_CHANNEL_SCI4_TX, (dmaTriggerType_t)DMA_HW);
+    sciEnableNotification_Expect(UART_REG, (uint32)((uint32_t)1u << UART_SCI_DMA_INTERRUPT));
+    TEST_ASSERT_TRUE(UART_TransmitTraceSnapshot());
+}
@@ -43,7 +43,7 @@
  * @file    test_uart_sci_notification.c
  * @author  foxBMS Team
  * @date    2025-09-29 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -58,9 +58,11 @@
 #include "MockHL_reg_sci.h"
 #include "MockHL_sys_dma.h"
 #include "Mockftask.h"
+#include "Mocklog.h"
 #include "Mockmpu_prototypes.h"
 #include "Mockos.h"
 #include "Mockportmacro.h"
+#include "Mocktrace.h"
 
 #include "uart_cfg.h"
 
@@ -82,6 +84,9 @@ TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/dma")
 TEST_INCLUDE_PATH("../../src/app/driver/rtc")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
+TEST_INCLUDE_PATH("../../src/app/engine/config")
+TEST_INCLUDE_PATH("../../src/app/engine/log")
+TEST_INCLUDE_PATH("../../src/app/engine/trace")
 TEST_INCLUDE_PATH("../../src/app/task/config")
 TEST_INCLUDE_PATH("../../src/app/task/ftask")
 TEST_INCLUDE_PATH("../../src/os/freertos/freertos-plus/freertos-plus-tcp/source/include")
@@ -0,0 +1,259 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    test_bg_jobs.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the background jobs
+ * @details TODO
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockos.h"
+#include "Mockfram.h"
+#include "Mocksys_mon.h"
+#include "Mocksys_mon_stack.h"
+
+#include "bg_jobs.h"
+#include "fassert.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("bg_jobs_cfg.c")
+
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/engine/bg_jobs")
+TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** request time that is used in the callbacks */
+static uint32_t test_callbackTimestamp_ms = 0u;
+
+/** FRAM update that requests itself again, e.g., because the FRAM is busy */
+static void TEST_UpdateFramDataAndRequestAgain(int numCalls) {
+    (void)numCalls;
+    OS_GetTickCount_ExpectAndReturn(test_callbackTimestamp_ms);
+    BGJ_Request(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
+    /* the caller looks for the next job after this one */
+    OS_GetTickCount_ExpectAndReturn(test_callbackTimestamp_ms);
+}
+
+/** FRAM update that is preempted by the cyclic task after a new request */
+static void TEST_UpdateFramDataAndGetPreempted(int numCalls) {
+    (void)numCalls;
+    OS_GetTickCount_ExpectAndReturn(test_callbackTimestamp_ms);
+    BGJ_Request(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
+    /* the job is overdue, but it must not be started while it is running */
+    OS_GetTickCount_ExpectAndReturn(test_callbackTimestamp_ms + BGJ_SYS_MON_FRAM_UPDATE_DEADLINE_ms);
+    BGJ_RunOverdueJobs();
+    /* the caller looks for the next job after this one */
+    OS_GetTickCount_ExpectAndReturn(test_callbackTimestamp_ms + BGJ_SYS_MON_FRAM_UPDATE_DEADLINE_ms);
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    TEST_BGJ_Reset();
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testBGJ_InvalidInput(void) {
+    BGJ_STATISTICS_s statistics = {0};
+
+    TEST_ASSERT_FAIL_ASSERT(BGJ_Request(BGJ_JOB_ID_E_MAX));
+    TEST_ASSERT_FAIL_ASSERT(BGJ_GetStatistics(BGJ_JOB_ID_E_MAX, &statistics));
+    TEST_ASSERT_FAIL_ASSERT(BGJ_GetStatistics(BGJ_JOB_ID_STACK_USAGE, NULL_PTR));
+}
+
+void testBGJ_NothingIsRunWithoutRequest(void) {
+    OS_GetTickCount_ExpectAndReturn(0u);
+    BGJ_RunPendingJobs();
+    OS_GetTickCount_ExpectAndReturn(10000u);
+    BGJ_RunOverdueJobs();
+}
+
+void testBGJ_RequestedJobIsRunOnce(void) {
+    OS_GetTickCount_ExpectAndReturn(0u);
+    BGJ_Request(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
+
+    OS_GetTickCount_ExpectAndReturn(10u);
+    SYSM_UpdateFramData_Expect();
+    OS_GetTickCount_ExpectAndReturn(10u);
+    BGJ_RunPendingJobs();
+
+    OS_GetTickCount_ExpectAndReturn(20u);
+    BGJ_RunPendingJobs();
+
+    BGJ_STATISTICS_s statistics = {0};
+    BGJ_GetStatistics(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE, &statistics);
+    TEST_ASSERT_EQUAL(1u, statistics.executions);
+    TEST_ASSERT_EQUAL(0u, statistics.coalescedRequests);
+    TEST_ASSERT_EQUAL(0u, statistics.deadlineMisses);
+    TEST_ASSERT_EQUAL(10u, statistics.maximumLatency_ms);
+}
+
+void testBGJ_PendingRequestsAreCoalesced(void) {
+    /* only the first request is timestamped */
+    OS_GetTickCount_ExpectAndReturn(0u);
+    BGJ_Request(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
+    BGJ_Request(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
+    BGJ_Request(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
+
+    OS_GetTickCount_ExpectAndReturn(5u);
+    SYSM_UpdateFramData_Expect();
+    OS_GetTickCount_ExpectAndReturn(5u);
+    BGJ_RunPendingJobs();
+
+    BGJ_STATISTICS_s statistics = {0};
+    BGJ_GetStatistics(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE, &statistics);
+    TEST_ASSERT_EQUAL(1u, statistics.executions);
+    TEST_ASSERT_EQUAL(2u, statistics.coalescedRequests);
+    TEST_ASSERT_EQUAL(5u, statistics.maximumLatency_ms);
+}
+
+void testBGJ_JobWithEarliestDeadlineIsRunFirst(void) {
+    /* same request time: the job with the shorter deadline comes first */
+    OS_GetTickCount_ExpectAndReturn(0u);
+    BGJ_Request(BGJ_JOB_ID_STACK_USAGE);
+    OS_GetTickCount_ExpectAndReturn(0u);
+    BGJ_Request(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
+
+    OS_GetTickCount_ExpectAndReturn(1u);
+    SYSM_UpdateFramData_Expect();
+    OS_GetTickCount_ExpectAndReturn(1u);
+    SYSM_UpdateStackUsage_Expect();
+    OS_GetTickCount_ExpectAndReturn(1u);
+    BGJ_RunPendingJobs();
+
+    /* the stack usage job has been waiting long enough to be due earlier */
+    OS_GetTickCount_ExpectAndReturn(0u);
+    BGJ_Request(BGJ_JOB_ID_STACK_USAGE);
+    OS_GetTickCount_ExpectAndReturn(950u);
+    BGJ_Request(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
+
+    OS_GetTickCount_ExpectAndReturn(960u);
+    SYSM_UpdateStackUsage_Expect();
+    OS_GetTickCount_ExpectAndReturn(960u);
+    SYSM_UpdateFramData_Expect();
+    OS_GetTickCount_ExpectAndReturn(960u);
+    BGJ_RunPendingJobs();
+}
+
+void testBGJ_RunOverdueJobsOnlyRunsJobsPastTheirDeadline(void) {
+    OS_GetTickCount_ExpectAndReturn(0u);
+    BGJ_Request(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
+    OS_GetTickCount_ExpectAndReturn(0u);
+    BGJ_Request(BGJ_JOB_ID_STACK_USAGE);
+
+    OS_GetTickCount_ExpectAndReturn(BGJ_SYS_MON_FRAM_UPDATE_DEADLINE_ms - 1u);
+    BGJ_RunOverdueJobs();
+
+    OS_GetTickCount_ExpectAndReturn(BGJ_SYS_MON_FRAM_UPDATE_DEADLINE_ms);
+    SYSM_UpdateFramData_Expect();
+    OS_GetTickCount_ExpectAndReturn(BGJ_SYS_MON_FRAM_UPDATE_DEADLINE_ms);
+    BGJ_RunOverdueJobs();
+
+    OS_GetTickCount_ExpectAndReturn(BGJ_STACK_USAGE_DEADLINE_ms + 500u);
+    SYSM_UpdateStackUsage_Expect();
+    OS_GetTickCount_ExpectAndReturn(BGJ_STACK_USAGE_DEADLINE_ms + 500u);
+    BGJ_RunOverdueJobs();
+
+    BGJ_STATISTICS_s statistics = {0};
+    BGJ_GetStatistics(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE, &statistics);
+    TEST_ASSERT_EQUAL(1u, statistics.executions);
+    TEST_ASSERT_EQUAL(0u, statistics.deadlineMisses);
+    BGJ_GetStatistics(BGJ_JOB_ID_STACK_USAGE, &statistics);
+    TEST_ASSERT_EQUAL(1u, statistics.executions);
+    TEST_ASSERT_EQUAL(1u, statistics.deadlineMisses);
+    TEST_ASSERT_EQUAL(BGJ_STACK_USAGE_DEADLINE_ms + 500u, statistics.maximumLatency_ms);
+}
+
+void testBGJ_JobThatRequestsItselfIsRunOncePerCall(void) {
+    SYSM_UpdateFramData_Stub(TEST_UpdateFramDataAndRequestAgain);
+
+    OS_GetTickCount_ExpectAndReturn(0u);
+    BGJ_Request(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
+
+    test_callbackTimestamp_ms = 10u;
+    OS_GetTickCount_ExpectAndReturn(10u);
+    BGJ_RunPendingJobs();
+
+    test_callbackTimestamp_ms = 20u;
+    OS_GetTickCount_ExpectAndReturn(20u);
+    BGJ_RunPendingJobs();
+
+    BGJ_STATISTICS_s statistics = {0};
+    BGJ_GetStatistics(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE, &statistics);
+    TEST_ASSERT_EQUAL(2u, statistics.executions);
+    TEST_ASSERT_EQUAL(0u, statistics.coalescedRequests);
+}
+
+void testBGJ_RunningJobIsNotStartedAgain(void) {
+    SYSM_UpdateFramData_Stub(TEST_UpdateFramDataAndGetPreempted);
+
+    OS_GetTickCount_ExpectAndReturn(0u);
+    BGJ_Request(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
+
+    test_callbackTimestamp_ms = 10u;
+    OS_GetTickCount_ExpectAndReturn(10u);
+    BGJ_RunPendingJobs();
+
+    BGJ_STATISTICS_s statistics = {0};
+    BGJ_GetStatistics(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE, &statistics);
+    TEST_ASSERT_EQUAL(1u, statistics.executions);
+}
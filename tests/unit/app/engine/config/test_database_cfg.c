@@ -43,7 +43,7 @@
  * @file    test_database_cfg.c
  * @author  foxBMS Team
  * @date    2020-04-02 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -58,6 +58,8 @@
 
 #include "database_cfg.h"
 
+#include <stdint.h>
+
 /*========== Unit Testing Framework Directives ==============================*/
 
 /*========== Definitions and Implementations for Unit Test ==================*/
@@ -71,5 +73,17 @@ void tearDown(void) {
 
 /*========== Test Cases =====================================================*/
 
-void testDummy(void) {
+/**
+ * @brief   Testing the database configuration
+ * @details The database looks up an entry by its uniqueId, therefore every
+ *          entry has to be located at the index of its uniqueId.
+ */
+void testDatabaseEntriesAreIndexedByUniqueId(void) {
+    for (uint8_t i = 0u; i < (uint8_t)DATA_BLOCK_ID_MAX; i++) {
+        const DATA_BLOCK_HEADER_s *kpHeader = (DATA_BLOCK_HEADER_s *)data_database[i].pDatabaseEntry;
+        TEST_ASSERT_NOT_NULL(kpHeader);
+        TEST_ASSERT_EQUAL((DATA_BLOCK_ID_e)i, kpHeader->uniqueId);
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(sizeof(DATA_BLOCK_HEADER_s), data_database[i].dataLength);
+    }
+    TEST_ASSERT_EQUAL_UINT32(sizeof(DATA_BLOCK_CELL_VOLTAGE_s), data_database[DATA_BLOCK_ID_CELL_VOLTAGE].dataLength);
 }
@@ -0,0 +1,99 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    test_mem_pool_cfg.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the configuration of the fixed-block memory pools
+ * @details Checks that every pool has storage of its own and that the blocks
+ *          are aligned.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+
+#include "mem_pool_cfg.h"
+
+#include <stdint.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testMemoryPoolConfigurationIsValid(void) {
+    for (uint8_t i = 0u; i < (uint8_t)MPOOL_ID_E_MAX; i++) {
+        TEST_ASSERT_NOT_NULL(mpool_poolConfiguration[i].pStorage);
+        TEST_ASSERT_GREATER_THAN(0u, mpool_poolConfiguration[i].numberOfBlocks);
+        TEST_ASSERT_GREATER_OR_EQUAL(sizeof(void *), mpool_poolConfiguration[i].blockSize_B);
+        TEST_ASSERT_EQUAL(0u, mpool_poolConfiguration[i].blockSize_B % MPOOL_BLOCK_ALIGNMENT_B);
+        TEST_ASSERT_EQUAL(0u, (uintptr_t)mpool_poolConfiguration[i].pStorage % MPOOL_BLOCK_ALIGNMENT_B);
+    }
+}
+
+void testMemoryPoolStoragesDoNotOverlap(void) {
+    for (uint8_t i = 0u; i < (uint8_t)MPOOL_ID_E_MAX; i++) {
+        const uintptr_t start = (uintptr_t)mpool_poolConfiguration[i].pStorage;
+        const uintptr_t end =
+            start + ((uintptr_t)mpool_poolConfiguration[i].blockSize_B * mpool_poolConfiguration[i].numberOfBlocks);
+        for (uint8_t j = 0u; j < (uint8_t)MPOOL_ID_E_MAX; j++) {
+            if (i != j) {
+                const uintptr_t otherStart = (uintptr_t)mpool_poolConfiguration[j].pStorage;
+                TEST_ASSERT_TRUE((otherStart < start) || (otherStart >= end));
+            }
+        }
+    }
+}
@@ -43,7 +43,7 @@
  * @file    test_database.c
  * @author  foxBMS Team
  * @date    2020-04-01 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -317,20 +317,69 @@ void testDATA_IterateOverDatabaseEntries(void) {
     /* nothing to do */
 }
 
+/**
+ * @brief   Testing external function #DATA_GetNumberOfWrites
+ * @details The following cases need to be tested:
+ *          - Argument validation:
+ *            - AT1/1: invalid unique ID &rarr; assert
+ *          - Routine validation:
+ *            - RT1/2: read access does not change the counter
+ *            - RT2/2: write access increments the counter of the entry
+ */
+void testDATA_GetNumberOfWrites(void) {
+    /* ======= Assertion tests ============================================= */
+    /* ======= AT1/1: Assertion test */
+    TEST_ASSERT_FAIL_ASSERT(DATA_GetNumberOfWrites(DATA_BLOCK_ID_MAX));
+
+    /* ======= Routine tests =============================================== */
+    static DATA_BLOCK_CELL_VOLTAGE_s entry_blockCellVoltage = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    DATA_QUEUE_MESSAGE_s message                            = {
+                                   .accessType                   = DATA_READ_ACCESS,
+                                   .pDatabaseEntry[DATA_ENTRY_0] = (void *)&entry_blockCellVoltage,
+    };
+    const uint32_t numberOfWrites = DATA_GetNumberOfWrites(DATA_BLOCK_ID_CELL_VOLTAGE);
+
+    /* ======= RT1/2: Test implementation */
+    /* ======= RT1/2: call function under test */
+    TEST_DATA_IterateOverDatabaseEntries(&message);
+    /* ======= RT1/2: test output verification */
+    TEST_ASSERT_EQUAL_UINT32(numberOfWrites, DATA_GetNumberOfWrites(DATA_BLOCK_ID_CELL_VOLTAGE));
+
+    /* ======= RT2/2: Test implementation */
+    message.accessType = DATA_WRITE_ACCESS;
+    OS_GetTickCount_ExpectAndReturn(10u);
+    /* ======= RT2/2: call function under test */
+    TEST_DATA_IterateOverDatabaseEntries(&message);
+    /* ======= RT2/2: test output verification */
+    TEST_ASSERT_EQUAL_UINT32(numberOfWrites + 1u, DATA_GetNumberOfWrites(DATA_BLOCK_ID_CELL_VOLTAGE));
+    TEST_ASSERT_EQUAL_UINT32(0u, DATA_GetNumberOfWrites(DATA_BLOCK_ID_CELL_TEMPERATURE));
+}
+
 /**
  * @brief   Testing external function #DATA_Initialize
  * @details The following cases need to be tested:
  *          - Argument validation:
- *            - TODO
+ *            - none
  *          - Routine validation:
- *            - TODO
+ *            - RT1/2: queues not created &rarr; assert
+ *            - RT2/2: entries are cleared, except for their uniqueId
  */
 void testDATA_Initialize(void) {
+    /* ======= Routine tests =============================================== */
+    /* ======= RT1/2: Test implementation */
     ftsk_allQueuesCreated = 0;
+    /* ======= RT1/2: call function under test */
     TEST_ASSERT_FAIL_ASSERT(DATA_Initialize());
 
-    ftsk_allQueuesCreated = 1;
+    /* ======= RT2/2: Test implementation */
+    DATA_BLOCK_HEADER_s *pHeader = (DATA_BLOCK_HEADER_s *)data_database[DATA_BLOCK_ID_SOC].pDatabaseEntry;
+    pHeader->timestamp           = 42u;
+    ftsk_allQueuesCreated        = 1;
+    /* ======= RT2/2: call function under test */
     DATA_Initialize();
+    /* ======= RT2/2: test output verification */
+    TEST_ASSERT_EQUAL(DATA_BLOCK_ID_SOC, pHeader->uniqueId);
+    TEST_ASSERT_EQUAL_UINT32(0u, pHeader->timestamp);
 }
 
 /**
@@ -43,7 +43,7 @@
  * @file    test_diag.c
  * @author  foxBMS Team
  * @date    2020-04-02 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -61,6 +61,7 @@
 #include "Mockdatabase.h"
 #include "Mockdiag_cbs.h"
 #include "Mocktimer.h"
+#include "Mocktrace.h"
 
 #include "diag_cfg.h"
 
@@ -70,6 +71,7 @@
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
 TEST_INCLUDE_PATH("../../src/app/engine/diag/cbs")
+TEST_INCLUDE_PATH("../../src/app/engine/trace")
 TEST_INCLUDE_PATH("../../src/app/driver/can/cbs/tx-async")
 TEST_INCLUDE_PATH("../../src/os/freertos")
 TEST_INCLUDE_PATH("../../src/app/task/timer")
@@ -189,6 +191,7 @@ void testDIAG_SetFatalErrorByIdOutOfRange(void) {
 
 void testDIAG_SetFatalErrorByIdOnce(void) {
     CANTX_SendFatalErrorId_ExpectAndReturn(DIAG_ID_SYSTEM_MONITORING, STD_OK);
+    TRC_Freeze_Expect(TRC_FREEZE_REASON_FATAL_ERROR, DIAG_ID_SYSTEM_MONITORING);
     TIMER_Start_ExpectAndReturn(diag_fatalErrorResendTimer, 0u, STD_OK);
     TEST_DIAG_SetFatalErrorById(DIAG_ID_SYSTEM_MONITORING);
     TEST_ASSERT_EQUAL(TEST_DIAG_GetFatalErrorCount(), 1);
@@ -197,6 +200,7 @@ void testDIAG_SetFatalErrorByIdOnce(void) {
 
 void testDIAG_SetFatalErrorByIdDoubled(void) {
     CANTX_SendFatalErrorId_ExpectAndReturn(DIAG_ID_SYSTEM_MONITORING, STD_OK);
+    TRC_Freeze_Expect(TRC_FREEZE_REASON_FATAL_ERROR, DIAG_ID_SYSTEM_MONITORING);
     TIMER_Start_ExpectAndReturn(diag_fatalErrorResendTimer, 0u, STD_OK);
     TEST_DIAG_SetFatalErrorById(DIAG_ID_SYSTEM_MONITORING);
     TEST_ASSERT_EQUAL(TEST_DIAG_GetFatalErrorCount(), 1);
@@ -213,6 +217,7 @@ void testDIAG_ClearFatalErrorByIdOutOfRange(void) {
 
 void testDIAG_ClearFatalErrorByIdOnce(void) {
     CANTX_SendFatalErrorId_ExpectAndReturn(DIAG_ID_SYSTEM_MONITORING, STD_OK);
+    TRC_Freeze_Expect(TRC_FREEZE_REASON_FATAL_ERROR, DIAG_ID_SYSTEM_MONITORING);
     TIMER_Start_ExpectAndReturn(diag_fatalErrorResendTimer, 0u, STD_OK);
     TEST_DIAG_SetFatalErrorById(DIAG_ID_SYSTEM_MONITORING);
     TEST_ASSERT_EQUAL(TEST_DIAG_GetFatalErrorCount(), 1);
@@ -227,6 +232,7 @@ void testDIAG_ClearFatalErrorByIdOnce(void) {
 
 void testDIAG_ClearFatalErrorByIdDoubled(void) {
     CANTX_SendFatalErrorId_ExpectAndReturn(DIAG_ID_SYSTEM_MONITORING, STD_OK);
+    TRC_Freeze_Expect(TRC_FREEZE_REASON_FATAL_ERROR, DIAG_ID_SYSTEM_MONITORING);
     TIMER_Start_ExpectAndReturn(diag_fatalErrorResendTimer, 0u, STD_OK);
     TEST_DIAG_SetFatalErrorById(DIAG_ID_SYSTEM_MONITORING);
     TEST_ASSERT_EQUAL(TEST_DIAG_GetFatalErrorCount(), 1);
@@ -251,13 +257,16 @@ void testDIAG_ClearFatalErrorByIdNotSetBefore(void) {
 
 void test_DIAG_ResendFatalErrorsThree(void) {
     CANTX_SendFatalErrorId_ExpectAndReturn(DIAG_ID_SYSTEM_MONITORING, STD_OK);
+    TRC_Freeze_Expect(TRC_FREEZE_REASON_FATAL_ERROR, DIAG_ID_SYSTEM_MONITORING);
     TIMER_Start_ExpectAndReturn(diag_fatalErrorResendTimer, 0u, STD_OK);
     TEST_DIAG_SetFatalErrorById(DIAG_ID_SYSTEM_MONITORING);
 
     CANTX_SendFatalErrorId_ExpectAndReturn(DIAG_ID_AFE_SPI, STD_OK);
+    TRC_Freeze_Expect(TRC_FREEZE_REASON_FATAL_ERROR, DIAG_ID_AFE_SPI);
     TEST_DIAG_SetFatalErrorById(DIAG_ID_AFE_SPI);
 
     CANTX_SendFatalErrorId_ExpectAndReturn(DIAG_ID_AFE_COMMUNICATION_INTEGRITY, STD_OK);
+    TRC_Freeze_Expect(TRC_FREEZE_REASON_FATAL_ERROR, DIAG_ID_AFE_COMMUNICATION_INTEGRITY);
     TEST_DIAG_SetFatalErrorById(DIAG_ID_AFE_COMMUNICATION_INTEGRITY);
 
     CANTX_SendFatalErrorId_ExpectAndReturn(DIAG_ID_SYSTEM_MONITORING, STD_OK);
@@ -307,6 +316,7 @@ void testDIAG_SendOneFatalError(void) {
     TEST_ASSERT_FALSE(DIAG_IsAnyFatalErrorSet());
 
     CANTX_SendFatalErrorId_ExpectAndReturn(DIAG_ID_SYSTEM_MONITORING, STD_OK);
+    TRC_Freeze_Expect(TRC_FREEZE_REASON_FATAL_ERROR, DIAG_ID_SYSTEM_MONITORING);
     TIMER_Start_Stub(MockTIMER_Start_Callback);
     DIAG_ErrorSystemMonitoring_Expect(DIAG_ID_SYSTEM_MONITORING, DIAG_EVENT_NOT_OK, &diag_kDatabaseShim, 0);
     DIAG_Handler(DIAG_ID_SYSTEM_MONITORING, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0);
@@ -324,11 +334,13 @@ void testDIAG_SendMultipleFatalErrors(void) {
     TEST_ASSERT_FALSE(DIAG_IsAnyFatalErrorSet());
 
     CANTX_SendFatalErrorId_ExpectAndReturn(DIAG_ID_SYSTEM_MONITORING, STD_OK);
+    TRC_Freeze_Expect(TRC_FREEZE_REASON_FATAL_ERROR, DIAG_ID_SYSTEM_MONITORING);
     TIMER_Start_Stub(MockTIMER_Start_Callback);
     DIAG_ErrorSystemMonitoring_Expect(DIAG_ID_SYSTEM_MONITORING, DIAG_EVENT_NOT_OK, &diag_kDatabaseShim, 0);
     DIAG_Handler(DIAG_ID_SYSTEM_MONITORING, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0);
 
     CANTX_SendFatalErrorId_ExpectAndReturn(DIAG_ID_POWER_MEASUREMENT_ERROR, STD_OK);
+    TRC_Freeze_Expect(TRC_FREEZE_REASON_FATAL_ERROR, DIAG_ID_POWER_MEASUREMENT_ERROR);
     DIAG_ErrorPowerMeasurement_Expect(DIAG_ID_POWER_MEASUREMENT_ERROR, DIAG_EVENT_NOT_OK, &diag_kDatabaseShim, 0);
     DIAG_Handler(DIAG_ID_POWER_MEASUREMENT_ERROR, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0);
 
@@ -351,6 +363,7 @@ void testDIAG_CheckEvent(void) {
     /* ======= RT2/2 ======= */
     /* Condition is STD_NOT_OK */
     CANTX_SendFatalErrorId_ExpectAndReturn(DIAG_ID_SYSTEM_MONITORING, STD_NOT_OK);
+    TRC_Freeze_Expect(TRC_FREEZE_REASON_FATAL_ERROR, DIAG_ID_SYSTEM_MONITORING);
     TIMER_Start_Stub(MockTIMER_Start_Callback);
     DIAG_ErrorSystemMonitoring_Expect(DIAG_ID_SYSTEM_MONITORING, DIAG_EVENT_NOT_OK, &diag_kDatabaseShim, 0u);
     DIAG_CheckEvent(STD_NOT_OK, DIAG_ID_SYSTEM_MONITORING, DIAG_SYSTEM, 0u);
@@ -0,0 +1,199 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    test_log.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the deferred-format log module
+ * @details TODO
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockos.h"
+
+#include "log_cfg.h"
+
+#include "fassert.h"
+#include "log.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("log_cfg.c")
+
+TEST_INCLUDE_PATH("../../src/app/engine/config")
+TEST_INCLUDE_PATH("../../src/app/engine/log")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    TEST_LOG_Reset();
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testLOG_WriteInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(LOG_Write(LOG_MESSAGE_ID_E_MAX, 0u, 0u, 0u, 0u));
+}
+
+void testLOG_WriteAndReadOneRecord(void) {
+    uint8_t buffer[LOG_SERIALIZED_RECORD_SIZE_IN_BYTES] = {0u};
+
+    OS_GetTickCount_ExpectAndReturn(0x01020304u);
+    TEST_ASSERT_EQUAL(STD_OK, LOG_Write(LOG_MESSAGE_ID_SYS_STATE, 0x11223344u, 5u, 6u, 7u));
+    TEST_ASSERT_EQUAL(1u, LOG_GetNumberOfPendingRecords());
+
+    TEST_ASSERT_EQUAL(LOG_SERIALIZED_RECORD_SIZE_IN_BYTES, LOG_ReadRecords(buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL(0u, LOG_GetNumberOfPendingRecords());
+
+    TEST_ASSERT_EQUAL_HEX8(LOG_RECORD_SYNC_BYTE, buffer[0u]);
+    /* number of arguments as defined in the configuration */
+    TEST_ASSERT_EQUAL(2u, buffer[1u]);
+    /* message id */
+    TEST_ASSERT_EQUAL(0u, buffer[2u]);
+    TEST_ASSERT_EQUAL((uint8_t)LOG_MESSAGE_ID_SYS_STATE, buffer[3u]);
+    /* sequence and dropped records */
+    TEST_ASSERT_EQUAL(0u, buffer[4u]);
+    TEST_ASSERT_EQUAL(0u, buffer[5u]);
+    TEST_ASSERT_EQUAL(0u, buffer[6u]);
+    TEST_ASSERT_EQUAL(0u, buffer[7u]);
+    /* timestamp */
+    TEST_ASSERT_EQUAL_HEX8(0x01u, buffer[8u]);
+    TEST_ASSERT_EQUAL_HEX8(0x02u, buffer[9u]);
+    TEST_ASSERT_EQUAL_HEX8(0x03u, buffer[10u]);
+    TEST_ASSERT_EQUAL_HEX8(0x04u, buffer[11u]);
+    /* first argument */
+    TEST_ASSERT_EQUAL_HEX8(0x11u, buffer[12u]);
+    TEST_ASSERT_EQUAL_HEX8(0x22u, buffer[13u]);
+    TEST_ASSERT_EQUAL_HEX8(0x33u, buffer[14u]);
+    TEST_ASSERT_EQUAL_HEX8(0x44u, buffer[15u]);
+    /* second argument */
+    TEST_ASSERT_EQUAL(5u, buffer[19u]);
+    /* arguments that are not part of the message definition are zero */
+    TEST_ASSERT_EQUAL(0u, buffer[23u]);
+    TEST_ASSERT_EQUAL(0u, buffer[27u]);
+}
+
+void testLOG_ReadRecordsRespectsBufferSize(void) {
+    uint8_t buffer[(2u * LOG_SERIALIZED_RECORD_SIZE_IN_BYTES) - 1u] = {0u};
+
+    OS_GetTickCount_IgnoreAndReturn(0u);
+    TEST_ASSERT_EQUAL(STD_OK, LOG_Write(LOG_MESSAGE_ID_DEBUG_UNSIGNED, 1u, 2u, 0u, 0u));
+    TEST_ASSERT_EQUAL(STD_OK, LOG_Write(LOG_MESSAGE_ID_DEBUG_UNSIGNED, 3u, 4u, 0u, 0u));
+
+    /* nothing fits into a too small buffer */
+    TEST_ASSERT_EQUAL(0u, LOG_ReadRecords(buffer, LOG_SERIALIZED_RECORD_SIZE_IN_BYTES - 1u));
+    /* only complete records are serialized */
+    TEST_ASSERT_EQUAL(LOG_SERIALIZED_RECORD_SIZE_IN_BYTES, LOG_ReadRecords(buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL(1u, LOG_GetNumberOfPendingRecords());
+    TEST_ASSERT_EQUAL(LOG_SERIALIZED_RECORD_SIZE_IN_BYTES, LOG_ReadRecords(buffer, sizeof(buffer)));
+    /* sequence number of the second record */
+    TEST_ASSERT_EQUAL(1u, buffer[5u]);
+    TEST_ASSERT_EQUAL(0u, LOG_ReadRecords(buffer, sizeof(buffer)));
+}
+
+void testLOG_WriteDropsRecordsWhenFull(void) {
+    uint8_t buffer[LOG_SERIALIZED_RECORD_SIZE_IN_BYTES] = {0u};
+    LOG_STATISTICS_s statistics                         = {0};
+
+    OS_GetTickCount_IgnoreAndReturn(0u);
+    for (uint32_t i = 0u; i < LOG_RING_BUFFER_LENGTH; i++) {
+        TEST_ASSERT_EQUAL(STD_OK, LOG_Write(LOG_MESSAGE_ID_DEBUG_UNSIGNED, i, 0u, 0u, 0u));
+    }
+    /* the ring buffer is full, records are dropped but the caller is not blocked */
+    TEST_ASSERT_EQUAL(STD_NOT_OK, LOG_Write(LOG_MESSAGE_ID_DEBUG_UNSIGNED, 0u, 0u, 0u, 0u));
+    TEST_ASSERT_EQUAL(STD_NOT_OK, LOG_Write(LOG_MESSAGE_ID_DEBUG_UNSIGNED, 0u, 0u, 0u, 0u));
+    TEST_ASSERT_EQUAL(LOG_RING_BUFFER_LENGTH, LOG_GetNumberOfPendingRecords());
+
+    LOG_GetStatistics(&statistics);
+    TEST_ASSERT_EQUAL(LOG_RING_BUFFER_LENGTH, statistics.writtenRecords);
+    TEST_ASSERT_EQUAL(2u, statistics.droppedRecords);
+    TEST_ASSERT_EQUAL(LOG_RING_BUFFER_LENGTH, statistics.maximumFillLevel);
+
+    /* free one slot; the next record reports the dropped records */
+    TEST_ASSERT_EQUAL(LOG_SERIALIZED_RECORD_SIZE_IN_BYTES, LOG_ReadRecords(buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL(STD_OK, LOG_Write(LOG_MESSAGE_ID_DEBUG_UNSIGNED, 0u, 0u, 0u, 0u));
+    for (uint32_t i = 0u; i < LOG_RING_BUFFER_LENGTH; i++) {
+        TEST_ASSERT_EQUAL(LOG_SERIALIZED_RECORD_SIZE_IN_BYTES, LOG_ReadRecords(buffer, sizeof(buffer)));
+    }
+    TEST_ASSERT_EQUAL(0u, buffer[6u]);
+    TEST_ASSERT_EQUAL(2u, buffer[7u]);
+}
+
+void testLOG_ReadRecordsEmptyBuffer(void) {
+    uint8_t buffer[LOG_SERIALIZED_RECORD_SIZE_IN_BYTES] = {0u};
+    TEST_ASSERT_FAIL_ASSERT(LOG_ReadRecords(NULL_PTR, 0u));
+    /* empty buffer */
+    TEST_ASSERT_EQUAL(0u, LOG_ReadRecords(buffer, sizeof(buffer)));
+}
+
+void testLOG_GetStatisticsInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(LOG_GetStatistics(NULL_PTR));
+}
+
+void testLOG_ConvertFloatToArgument(void) {
+    TEST_ASSERT_EQUAL_HEX32(0x3F800000u, LOG_ConvertFloatToArgument(1.0f));
+    TEST_ASSERT_EQUAL_HEX32(0xC0000000u, LOG_ConvertFloatToArgument(-2.0f));
+    TEST_ASSERT_EQUAL_HEX32(0x00000000u, LOG_ConvertFloatToArgument(0.0f));
+}
+
+void testLOG_SerializeRecordInvalidInput(void) {
+    uint8_t buffer[LOG_SERIALIZED_RECORD_SIZE_IN_BYTES]      = {0u};
+    const uint32_t arguments[LOG_MAXIMUM_NUMBER_OF_ARGUMENTS] = {0u};
+    TEST_ASSERT_FAIL_ASSERT(TEST_LOG_SerializeRecord(NULL_PTR, 0u, 0u, 0u, 0u, arguments));
+    TEST_ASSERT_FAIL_ASSERT(TEST_LOG_SerializeRecord(buffer, (uint16_t)LOG_MESSAGE_ID_E_MAX, 0u, 0u, 0u, arguments));
+    TEST_ASSERT_FAIL_ASSERT(TEST_LOG_SerializeRecord(buffer, 0u, 0u, 0u, 0u, NULL_PTR));
+}
@@ -0,0 +1,191 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    test_mem_pool.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the fixed-block memory pools
+ * @details TODO
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockos.h"
+
+#include "fassert.h"
+#include "mem_pool.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("mem_pool_cfg.c")
+
+TEST_INCLUDE_PATH("../../src/app/engine/config")
+TEST_INCLUDE_PATH("../../src/app/engine/mem_pool")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    TEST_MPOOL_Reset();
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testMPOOL_InvalidInput(void) {
+    MPOOL_STATISTICS_s statistics = {0};
+    uint8_t notABlock             = 0u;
+
+    TEST_ASSERT_FAIL_ASSERT(MPOOL_Allocate(MPOOL_ID_E_MAX, 1u));
+    TEST_ASSERT_FAIL_ASSERT(MPOOL_Free(MPOOL_ID_E_MAX, NULL_PTR));
+    TEST_ASSERT_FAIL_ASSERT(MPOOL_Free(MPOOL_ID_SOCKET, (void *)&notABlock));
+    TEST_ASSERT_FAIL_ASSERT(MPOOL_GetStatistics(MPOOL_ID_E_MAX, &statistics));
+    TEST_ASSERT_FAIL_ASSERT(MPOOL_GetStatistics(MPOOL_ID_SOCKET, NULL_PTR));
+}
+
+void testMPOOL_AllocateReturnsDistinctBlocksOfThePool(void) {
+    const MPOOL_POOL_CONFIG_s *const pConfig = &mpool_poolConfiguration[MPOOL_ID_SOCKET];
+
+    for (uint16_t i = 0u; i < pConfig->numberOfBlocks; i++) {
+        uint8_t *pBlock = (uint8_t *)MPOOL_Allocate(MPOOL_ID_SOCKET, pConfig->blockSize_B);
+        TEST_ASSERT_EQUAL_PTR(&pConfig->pStorage[i * pConfig->blockSize_B], pBlock);
+    }
+}
+
+void testMPOOL_AllocateFailsWhenExhausted(void) {
+    const uint16_t numberOfBlocks = mpool_poolConfiguration[MPOOL_ID_TCP_BUFFER].numberOfBlocks;
+
+    for (uint16_t i = 0u; i < numberOfBlocks; i++) {
+        TEST_ASSERT_NOT_NULL(MPOOL_Allocate(MPOOL_ID_TCP_BUFFER, 1u));
+    }
+    TEST_ASSERT_NULL(MPOOL_Allocate(MPOOL_ID_TCP_BUFFER, 1u));
+
+    MPOOL_STATISTICS_s statistics = {0};
+    MPOOL_GetStatistics(MPOOL_ID_TCP_BUFFER, &statistics);
+    TEST_ASSERT_EQUAL(numberOfBlocks, statistics.blocksInUse);
+    TEST_ASSERT_EQUAL(numberOfBlocks, statistics.peakBlocksInUse);
+    TEST_ASSERT_EQUAL(1u, statistics.failedAllocations);
+
+    /* the other pool is not affected */
+    TEST_ASSERT_NOT_NULL(MPOOL_Allocate(MPOOL_ID_SOCKET, 1u));
+}
+
+void testMPOOL_AllocateFailsForTooLargeRequests(void) {
+    const uint32_t blockSize_B = mpool_poolConfiguration[MPOOL_ID_SOCKET].blockSize_B;
+
+    TEST_ASSERT_NULL(MPOOL_Allocate(MPOOL_ID_SOCKET, blockSize_B + 1u));
+
+    MPOOL_STATISTICS_s statistics = {0};
+    MPOOL_GetStatistics(MPOOL_ID_SOCKET, &statistics);
+    TEST_ASSERT_EQUAL(blockSize_B, statistics.blockSize_B);
+    TEST_ASSERT_EQUAL(0u, statistics.blocksInUse);
+    TEST_ASSERT_EQUAL(1u, statistics.failedAllocations);
+    TEST_ASSERT_EQUAL(blockSize_B + 1u, statistics.largestRequest_B);
+}
+
+void testMPOOL_FreedBlocksAreReusedLastInFirstOut(void) {
+    void *pFirst  = MPOOL_Allocate(MPOOL_ID_SOCKET, 1u);
+    void *pSecond = MPOOL_Allocate(MPOOL_ID_SOCKET, 1u);
+    void *pThird  = MPOOL_Allocate(MPOOL_ID_SOCKET, 1u);
+
+    MPOOL_Free(MPOOL_ID_SOCKET, pFirst);
+    MPOOL_Free(MPOOL_ID_SOCKET, pThird);
+    TEST_ASSERT_EQUAL_PTR(pThird, MPOOL_Allocate(MPOOL_ID_SOCKET, 1u));
+    TEST_ASSERT_EQUAL_PTR(pFirst, MPOOL_Allocate(MPOOL_ID_SOCKET, 1u));
+
+    MPOOL_STATISTICS_s statistics = {0};
+    MPOOL_GetStatistics(MPOOL_ID_SOCKET, &statistics);
+    TEST_ASSERT_EQUAL(3u, statistics.blocksInUse);
+    TEST_ASSERT_EQUAL(3u, statistics.peakBlocksInUse);
+    (void)pSecond;
+}
+
+void testMPOOL_FreeOfNullIsIgnored(void) {
+    MPOOL_Free(MPOOL_ID_SOCKET, NULL_PTR);
+
+    MPOOL_STATISTICS_s statistics = {0};
+    MPOOL_GetStatistics(MPOOL_ID_SOCKET, &statistics);
+    TEST_ASSERT_EQUAL(0u, statistics.blocksInUse);
+}
+
+void testMPOOL_FreeChecksTheBlock(void) {
+    uint8_t *pBlock = (uint8_t *)MPOOL_Allocate(MPOOL_ID_SOCKET, 1u);
+
+    /* not the start of a block */
+    TEST_ASSERT_FAIL_ASSERT(MPOOL_Free(MPOOL_ID_SOCKET, (void *)&pBlock[1u]));
+    /* block of another pool */
+    TEST_ASSERT_FAIL_ASSERT(MPOOL_Free(MPOOL_ID_TCP_BUFFER, (void *)pBlock));
+
+    MPOOL_Free(MPOOL_ID_SOCKET, (void *)pBlock);
+    /* more blocks released than allocated */
+    TEST_ASSERT_FAIL_ASSERT(MPOOL_Free(MPOOL_ID_SOCKET, (void *)pBlock));
+}
+
+void testMPOOL_ResetStatistics(void) {
+    void *pFirst = MPOOL_Allocate(MPOOL_ID_SOCKET, 8u);
+    void *pLast  = MPOOL_Allocate(MPOOL_ID_SOCKET, 16u);
+    (void)MPOOL_Allocate(MPOOL_ID_SOCKET, UINT32_MAX);
+    MPOOL_Free(MPOOL_ID_SOCKET, pLast);
+
+    MPOOL_ResetStatistics();
+
+    MPOOL_STATISTICS_s statistics = {0};
+    MPOOL_GetStatistics(MPOOL_ID_SOCKET, &statistics);
+    TEST_ASSERT_EQUAL(1u, statistics.blocksInUse);
+    TEST_ASSERT_EQUAL(1u, statistics.peakBlocksInUse);
+    TEST_ASSERT_EQUAL(0u, statistics.failedAllocations);
+    TEST_ASSERT_EQUAL(0u, statistics.largestRequest_B);
+    (void)pFirst;
+}
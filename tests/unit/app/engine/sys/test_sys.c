@@ -43,7 +43,7 @@
  * @file    test_sys.c
  * @author  foxBMS Team
  * @date    2020-04-02 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -52,6 +52,7 @@
  * @details Test functions:
  *          - testSYS_GeneralMacroBist
  *          - testSYS_Trigger
+ *          - testSYS_TriggerLogsStateChange
  *
  */
 
@@ -69,11 +70,12 @@
 #include "Mockfram.h"
 #include "Mockimd.h"
 #include "Mockinterlock.h"
+#include "Mocklog.h"
 #include "Mockmeas.h"
 #include "Mockos.h"
 #include "Mockrtc.h"
 #include "Mocksbc.h"
-#include "Mocksof_trapezoid.h"
+#include "Mocksof.h"
 #include "Mockstate_estimation.h"
 #include "Mocksys_cfg.h"
 
@@ -88,7 +90,7 @@ TEST_SOURCE_FILE("sys.c")
 TEST_INCLUDE_PATH("../../src/app/application/algorithm")
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/config")
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
-TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof/trapezoid")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof")
 TEST_INCLUDE_PATH("../../src/app/application/bal")
 TEST_INCLUDE_PATH("../../src/app/application/bms")
 TEST_INCLUDE_PATH("../../src/app/driver/afe/api")
@@ -105,6 +107,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/sbc/fs8x_driver")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
 TEST_INCLUDE_PATH("../../src/app/driver/sps")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
+TEST_INCLUDE_PATH("../../src/app/engine/log")
 TEST_INCLUDE_PATH("../../src/app/engine/sys")
 TEST_INCLUDE_PATH("../../src/app/task/config")
 
@@ -860,6 +863,25 @@ void testSYS_Trigger(void) {
     TEST_ASSERT_TRUE(returnValue == STD_OK);
 }
 
+/** a state change of the system state machine is logged */
+void testSYS_TriggerLogsStateChange(void) {
+    SYS_STATE_s sys_state  = {0};
+    sys_state.currentState = SYS_FSM_STATE_UNINITIALIZED;
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    SYS_SetStateRequest(SYS_STATE_INITIALIZATION_REQUEST);
+
+    /* check of multiple calls */
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    /* transfer of the state request */
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    LOG_Write_ExpectAndReturn(
+        LOG_MESSAGE_ID_SYS_STATE, SYS_FSM_STATE_INITIALIZATION, SYS_FSM_SUBSTATE_ENTRY, 0u, 0u, STD_OK);
+    TEST_ASSERT_EQUAL(STD_OK, SYS_Trigger(&sys_state));
+}
+
 void testSYS_UninitTests(void) {
     SYS_STATE_s sys_stateNoReq  = {0};
     sys_stateNoReq.currentState = SYS_FSM_STATE_UNINITIALIZED;
@@ -43,7 +43,7 @@
  * @file    test_sys_mon.c
  * @author  foxBMS Team
  * @date    2020-04-02 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -54,9 +54,11 @@
 
 /*========== Includes =======================================================*/
 #include "unity.h"
+#include "Mockbg_jobs.h"
 #include "Mockdiag.h"
 #include "Mockfram.h"
 #include "Mockfram_cfg.h"
+#include "Mocklog.h"
 #include "Mockos.h"
 #include "Mocksys_mon_cfg.h"
 
@@ -70,7 +72,9 @@
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/engine/bg_jobs")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
+TEST_INCLUDE_PATH("../../src/app/engine/log")
 TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
@@ -151,10 +155,15 @@ void tearDown(void) {
 /*========== Test Cases =====================================================*/
 void testSYSM_RecordTimingViolation(void) {
     TEST_ASSERT_FAIL_ASSERT(TEST_SYSM_RecordTimingViolation(SYSM_TASK_ID_MAX, 0u, 0u));
+    BGJ_Request_Expect(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
     TEST_SYSM_RecordTimingViolation(SYSM_TASK_ID_ENGINE, 0, 0);
+    BGJ_Request_Expect(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
     TEST_SYSM_RecordTimingViolation(SYSM_TASK_ID_CYCLIC_1ms, 0, 0);
+    BGJ_Request_Expect(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
     TEST_SYSM_RecordTimingViolation(SYSM_TASK_ID_CYCLIC_10ms, 0, 0);
+    BGJ_Request_Expect(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
     TEST_SYSM_RecordTimingViolation(SYSM_TASK_ID_CYCLIC_100ms, 0, 0);
+    BGJ_Request_Expect(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
     TEST_SYSM_RecordTimingViolation(SYSM_TASK_ID_CYCLIC_ALGORITHM_100ms, 0, 0);
     TEST_SYSM_RecordTimingViolation(-1, 0, 0);
 }
@@ -199,6 +208,7 @@ void testSYSM_CheckNotificationsProvokeDurationViolation(void) {
     OS_GetTickCount_ExpectAndReturn(100u);
     DIAG_Handler_ExpectAndReturn(
         DIAG_ID_SYSTEM_MONITORING, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, DUMMY_TASK_ID_0, DIAG_HANDLER_RETURN_OK);
+    LOG_Write_ExpectAndReturn(LOG_MESSAGE_ID_TASK_TIMING, DUMMY_TASK_ID_0, 0u, 100u, 0u, STD_OK);
     SYSM_CheckNotifications();
 }
 
@@ -216,6 +226,8 @@ void testSYSM_CheckNotificationsProvokeDurationViolationWithRecording(void) {
     OS_GetTickCount_ExpectAndReturn(100u);
     DIAG_Handler_ExpectAndReturn(
         DIAG_ID_SYSTEM_MONITORING, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, DUMMY_TASK_ID_0, DIAG_HANDLER_RETURN_OK);
+    LOG_Write_ExpectAndReturn(LOG_MESSAGE_ID_TASK_TIMING, DUMMY_TASK_ID_0, 0u, 100u, 0u, STD_OK);
+    BGJ_Request_Expect(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
     OS_EnterTaskCritical_Expect();
     OS_ExitTaskCritical_Expect();
     SYSM_CheckNotifications();
@@ -363,12 +375,8 @@ void testSYSM_ClearAllTimingViolations(void) {
     OS_EnterTaskCritical_Expect(); /* in SYSM_ClearAllTimingViolations */
     OS_ExitTaskCritical_Expect();  /* in SYSM_ClearAllTimingViolations */
 
-    OS_EnterTaskCritical_Expect(); /* in SYSM_UpdateFramData */
-    OS_ExitTaskCritical_Expect();  /* in SYSM_UpdateFramData */
-    OS_EnterTaskCritical_Expect(); /* in SYSM_UpdateFramData: in branch */
-    OS_ExitTaskCritical_Expect();  /* in SYSM_UpdateFramData: in branch */
-
-    FRAM_WriteData_ExpectAndReturn(FRAM_BLOCK_ID_SYS_MON_RECORD, STD_OK);
+    /* the FRAM is written in the background */
+    BGJ_Request_Expect(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
 
     /* the called function alters a module static variable;
      * get the value to restore it */
@@ -378,6 +386,16 @@ void testSYSM_ClearAllTimingViolations(void) {
     SYSM_ClearAllTimingViolations();
 
     /* ======= RT1/1: test output verification */
+    TEST_ASSERT_TRUE(TEST_SYSM_GetStaticVariableFlagFramCopyHasChanges());
+
+    /* commit to FRAM as the background job would do */
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    FRAM_WriteData_ExpectAndReturn(FRAM_BLOCK_ID_SYS_MON_RECORD, FRAM_ACCESS_OK);
+    SYSM_UpdateFramData();
+
     TEST_ASSERT_FALSE(fram_sysMonViolationRecord.anyTimingIssueOccurred);
     TEST_ASSERT_EQUAL_UINT32(fram_sysMonViolationRecord.taskEngineEnterTimestamp, 0u);
     TEST_ASSERT_EQUAL_UINT32(fram_sysMonViolationRecord.taskEngineViolatingDuration, 0u);
@@ -400,9 +418,11 @@ void testSYSM_ClearAllTimingViolations(void) {
  *          - Argument validation:
  *            - none (void function)
  *          - Routine validation:
- *            - RT1/2: no update are required, i.e., nothing to do.
- *            - RT2/2: an update is due, check that the updated values get
+ *            - RT1/3: no update are required, i.e., nothing to do.
+ *            - RT2/3: an update is due, check that the updated values get
  *                     copied.
+ *            - RT3/3: an update is due, but the FRAM is busy &rarr; the
+ *                     update is requested again.
  */
 void testSYSM_UpdateFramData(void) {
     /* ======= Assertion tests ============================================= */
@@ -443,6 +463,27 @@ void testSYSM_UpdateFramData(void) {
     /* ======= RT1/2: test output verification */
     /* values should have been changed */
     /* TODO: check memory */
+    TEST_ASSERT_FALSE(TEST_SYSM_GetStaticVariableFlagFramCopyHasChanges());
+
+    /* restore old value */
+    (void)TEST_SYSM_SetStaticVariableFlagFramCopyHasChanges(oldValue);
+
+    /* ======= RT3/3: Test implementation */
+    oldValue = TEST_SYSM_SetStaticVariableFlagFramCopyHasChanges(true);
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    FRAM_WriteData_ExpectAndReturn(FRAM_BLOCK_ID_SYS_MON_RECORD, FRAM_ACCESS_SPI_BUSY);
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    BGJ_Request_Expect(BGJ_JOB_ID_SYS_MON_FRAM_UPDATE);
+
+    /* ======= RT3/3: call function under test */
+    SYSM_UpdateFramData();
+
+    /* ======= RT3/3: test output verification */
+    TEST_ASSERT_TRUE(TEST_SYSM_GetStaticVariableFlagFramCopyHasChanges());
 
     /* restore old value */
     (void)TEST_SYSM_SetStaticVariableFlagFramCopyHasChanges(oldValue);
@@ -0,0 +1,269 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    test_sys_mon_bus.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the bus statistics of the System Monitoring module
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockmcu.h"
+#include "Mockos.h"
+#include "Mocksys_mon_cfg.h"
+
+#include "fassert.h"
+#include "sys_mon_bus.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("sys_mon_bus.c")
+
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/mcu")
+TEST_INCLUDE_PATH("../../src/app/engine/diag")
+TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** OS tick count at the start of the observation */
+#define TEST_OBSERVATION_START_ms (500u)
+
+/**
+ * @brief   Simulates a transfer on an acquired bus
+ * @details One counter tick per us keeps the simulated accesses readable.
+ * @param   bus             bus
+ * @param   start           free running counter at the acquisition
+ * @param   busyTime_us     time until the bus is released
+ * @param   numberOfWords   number of words of the transfer
+ */
+static void TEST_RecordBusAccess(SYSM_BUS_e bus, uint32_t start, uint32_t busyTime_us, uint32_t numberOfWords) {
+    MCU_GetFreeRunningCount_ExpectAndReturn(start);
+    SYSM_RecordBusAccess(bus);
+    MCU_GetFreeRunningCount_ExpectAndReturn(start);
+    SYSM_RecordBusTransfer(bus, numberOfWords);
+    MCU_GetFreeRunningCount_ExpectAndReturn(start + busyTime_us);
+    MCU_ConvertFrcDifferenceToTimespan_us_ExpectAndReturn(busyTime_us, busyTime_us);
+    SYSM_RecordBusRelease(bus);
+}
+
+/**
+ * @brief   Reads the statistics of a bus at a given OS tick count
+ * @param   bus             bus
+ * @param   tickCount_ms    OS tick count when the statistics are read
+ * @param   pStatistics     statistics of the bus
+ */
+static void TEST_GetBusStatistics(SYSM_BUS_e bus, uint32_t tickCount_ms, SYSM_BUS_STATISTICS_s *pStatistics) {
+    OS_GetTickCount_ExpectAndReturn(tickCount_ms);
+    SYSM_GetBusStatistics(bus, pStatistics);
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    OS_GetTickCount_ExpectAndReturn(TEST_OBSERVATION_START_ms);
+    SYSM_ResetBusStatistics();
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testSYSM_BusAssertions(void) {
+    SYSM_BUS_STATISTICS_s statistics = {0};
+    TEST_ASSERT_FAIL_ASSERT(SYSM_RecordBusAccess(SYSM_BUS_E_MAX));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_RecordBusRelease(SYSM_BUS_E_MAX));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_RecordBusReleaseFromIsr(SYSM_BUS_E_MAX));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_RecordBusTransfer(SYSM_BUS_E_MAX, 1u));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_RecordBusRejection(SYSM_BUS_E_MAX, SYSM_BUS_REJECTION_LOCK));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_RecordBusRejection(SYSM_BUS_SPI1, SYSM_BUS_REJECTION_E_MAX));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_GetBusStatistics(SYSM_BUS_E_MAX, &statistics));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_GetBusStatistics(SYSM_BUS_SPI1, NULL_PTR));
+}
+
+void testSYSM_GetWaitHistogramBin(void) {
+    TEST_ASSERT_EQUAL_UINT8(0u, TEST_SYSM_GetWaitHistogramBin(0u));
+    TEST_ASSERT_EQUAL_UINT8(0u, TEST_SYSM_GetWaitHistogramBin(SYSM_BUS_WAIT_BIN_0_LIMIT_us - 1u));
+    TEST_ASSERT_EQUAL_UINT8(1u, TEST_SYSM_GetWaitHistogramBin(SYSM_BUS_WAIT_BIN_0_LIMIT_us));
+    TEST_ASSERT_EQUAL_UINT8(2u, TEST_SYSM_GetWaitHistogramBin(SYSM_BUS_WAIT_BIN_1_LIMIT_us));
+    TEST_ASSERT_EQUAL_UINT8(3u, TEST_SYSM_GetWaitHistogramBin(SYSM_BUS_WAIT_BIN_2_LIMIT_us));
+    TEST_ASSERT_EQUAL_UINT8(4u, TEST_SYSM_GetWaitHistogramBin(SYSM_BUS_WAIT_BIN_3_LIMIT_us));
+    TEST_ASSERT_EQUAL_UINT8(5u, TEST_SYSM_GetWaitHistogramBin(SYSM_BUS_WAIT_BIN_4_LIMIT_us));
+    TEST_ASSERT_EQUAL_UINT8(5u, TEST_SYSM_GetWaitHistogramBin(UINT32_MAX));
+}
+
+void testSYSM_BusTransfersAndBusyTime(void) {
+    TEST_RecordBusAccess(SYSM_BUS_SPI2, 1000u, 300u, 8u);
+    TEST_RecordBusAccess(SYSM_BUS_SPI2, 5000u, 100u, 4u);
+
+    SYSM_BUS_STATISTICS_s statistics = {0};
+    TEST_GetBusStatistics(SYSM_BUS_SPI2, TEST_OBSERVATION_START_ms + 10u, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(2u, statistics.numberOfTransfers);
+    TEST_ASSERT_EQUAL_UINT32(12u, statistics.numberOfWords);
+    TEST_ASSERT_EQUAL_UINT64(400u, statistics.busyTime_us);
+    TEST_ASSERT_EQUAL_UINT32(300u, statistics.maximumBusyTime_us);
+    TEST_ASSERT_EQUAL_UINT32(10u, statistics.observationTime_ms);
+    /* 400us busy in 10ms */
+    TEST_ASSERT_EQUAL_UINT16(40u, statistics.utilization_perm);
+
+    /* the other buses are not affected */
+    TEST_GetBusStatistics(SYSM_BUS_I2C1, TEST_OBSERVATION_START_ms + 10u, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.numberOfTransfers);
+    TEST_ASSERT_EQUAL_UINT64(0u, statistics.busyTime_us);
+}
+
+void testSYSM_BusReleaseWithoutAccess(void) {
+    /* no conversion is expected as the bus has not been acquired */
+    MCU_GetFreeRunningCount_ExpectAndReturn(1000u);
+    SYSM_RecordBusRelease(SYSM_BUS_SPI1);
+    MCU_GetFreeRunningCount_ExpectAndReturn(1000u);
+    SYSM_RecordBusReleaseFromIsr(SYSM_BUS_SPI1);
+
+    SYSM_BUS_STATISTICS_s statistics = {0};
+    TEST_GetBusStatistics(SYSM_BUS_SPI1, TEST_OBSERVATION_START_ms + 1u, &statistics);
+    TEST_ASSERT_EQUAL_UINT64(0u, statistics.busyTime_us);
+}
+
+void testSYSM_BusReleaseFromIsr(void) {
+    /* two transfers on the acquired bus, the bus is released by the DMA interrupt */
+    MCU_GetFreeRunningCount_ExpectAndReturn(100u);
+    SYSM_RecordBusAccess(SYSM_BUS_SPI3);
+    MCU_GetFreeRunningCount_ExpectAndReturn(100u);
+    SYSM_RecordBusTransfer(SYSM_BUS_SPI3, 10u);
+    MCU_GetFreeRunningCount_ExpectAndReturn(400u);
+    SYSM_RecordBusTransfer(SYSM_BUS_SPI3, UINT32_MAX);
+    MCU_GetFreeRunningCount_ExpectAndReturn(700u);
+    MCU_ConvertFrcDifferenceToTimespan_us_ExpectAndReturn(600u, 600u);
+    SYSM_RecordBusReleaseFromIsr(SYSM_BUS_SPI3);
+
+    SYSM_BUS_STATISTICS_s statistics = {0};
+    TEST_GetBusStatistics(SYSM_BUS_SPI3, TEST_OBSERVATION_START_ms + 1u, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(2u, statistics.numberOfTransfers);
+    /* the number of words saturates */
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, statistics.numberOfWords);
+    TEST_ASSERT_EQUAL_UINT64(600u, statistics.busyTime_us);
+    TEST_ASSERT_EQUAL_UINT16(600u, statistics.utilization_perm);
+}
+
+void testSYSM_BusRejectionsAndWaitTime(void) {
+    /* the first rejection starts the wait, the following ones do not restart it */
+    MCU_GetFreeRunningCount_ExpectAndReturn(1000u);
+    SYSM_RecordBusRejection(SYSM_BUS_SPI4, SYSM_BUS_REJECTION_LOCK);
+    MCU_GetFreeRunningCount_ExpectAndReturn(1500u);
+    SYSM_RecordBusRejection(SYSM_BUS_SPI4, SYSM_BUS_REJECTION_BUSY);
+    MCU_GetFreeRunningCount_ExpectAndReturn(2000u);
+    SYSM_RecordBusRejection(SYSM_BUS_SPI4, SYSM_BUS_REJECTION_LOCK);
+    /* the wait ends when the bus is acquired */
+    MCU_GetFreeRunningCount_ExpectAndReturn(3000u);
+    MCU_ConvertFrcDifferenceToTimespan_us_ExpectAndReturn(2000u, 2000u);
+    SYSM_RecordBusAccess(SYSM_BUS_SPI4);
+    MCU_GetFreeRunningCount_ExpectAndReturn(3100u);
+    MCU_ConvertFrcDifferenceToTimespan_us_ExpectAndReturn(100u, 100u);
+    SYSM_RecordBusRelease(SYSM_BUS_SPI4);
+
+    /* a short wait that ends with a transfer on a bus that has been locked by the caller */
+    MCU_GetFreeRunningCount_ExpectAndReturn(4000u);
+    SYSM_RecordBusRejection(SYSM_BUS_SPI4, SYSM_BUS_REJECTION_BUSY);
+    MCU_GetFreeRunningCount_ExpectAndReturn(4050u);
+    MCU_ConvertFrcDifferenceToTimespan_us_ExpectAndReturn(50u, 50u);
+    SYSM_RecordBusTransfer(SYSM_BUS_SPI4, 1u);
+
+    SYSM_BUS_STATISTICS_s statistics = {0};
+    TEST_GetBusStatistics(SYSM_BUS_SPI4, TEST_OBSERVATION_START_ms + 100u, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(2u, statistics.numberOfLockRejections);
+    TEST_ASSERT_EQUAL_UINT32(2u, statistics.numberOfBusyRejections);
+    TEST_ASSERT_EQUAL_UINT32(2000u, statistics.maximumWaitTime_us);
+    TEST_ASSERT_EQUAL_UINT32(1u, statistics.waitHistogram[0u]);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.waitHistogram[1u]);
+    TEST_ASSERT_EQUAL_UINT32(1u, statistics.waitHistogram[2u]);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.waitHistogram[5u]);
+}
+
+void testSYSM_BusUtilizationSaturates(void) {
+    /* the busy time is longer than the observation time, e.g., after a reset during an access */
+    TEST_RecordBusAccess(SYSM_BUS_I2C2, 0u, 5000u, 2u);
+
+    SYSM_BUS_STATISTICS_s statistics = {0};
+    TEST_GetBusStatistics(SYSM_BUS_I2C2, TEST_OBSERVATION_START_ms + 2u, &statistics);
+    TEST_ASSERT_EQUAL_UINT16(1000u, statistics.utilization_perm);
+
+    /* no observation time */
+    TEST_GetBusStatistics(SYSM_BUS_I2C2, TEST_OBSERVATION_START_ms, &statistics);
+    TEST_ASSERT_EQUAL_UINT16(0u, statistics.utilization_perm);
+}
+
+void testSYSM_ResetBusStatistics(void) {
+    TEST_RecordBusAccess(SYSM_BUS_SPI5, 0u, 200u, 3u);
+    MCU_GetFreeRunningCount_ExpectAndReturn(500u);
+    SYSM_RecordBusRejection(SYSM_BUS_SPI5, SYSM_BUS_REJECTION_LOCK);
+
+    OS_GetTickCount_ExpectAndReturn(TEST_OBSERVATION_START_ms + 1000u);
+    SYSM_ResetBusStatistics();
+
+    SYSM_BUS_STATISTICS_s statistics = {0};
+    TEST_GetBusStatistics(SYSM_BUS_SPI5, TEST_OBSERVATION_START_ms + 1010u, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.numberOfTransfers);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.numberOfWords);
+    TEST_ASSERT_EQUAL_UINT64(0u, statistics.busyTime_us);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.numberOfLockRejections);
+    TEST_ASSERT_EQUAL_UINT32(10u, statistics.observationTime_ms);
+
+    /* a wait that was pending during the reset is still counted */
+    MCU_GetFreeRunningCount_ExpectAndReturn(800u);
+    MCU_ConvertFrcDifferenceToTimespan_us_ExpectAndReturn(300u, 300u);
+    SYSM_RecordBusAccess(SYSM_BUS_SPI5);
+    MCU_GetFreeRunningCount_ExpectAndReturn(900u);
+    MCU_ConvertFrcDifferenceToTimespan_us_ExpectAndReturn(100u, 100u);
+    SYSM_RecordBusRelease(SYSM_BUS_SPI5);
+    TEST_GetBusStatistics(SYSM_BUS_SPI5, TEST_OBSERVATION_START_ms + 1010u, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(1u, statistics.waitHistogram[1u]);
+}
@@ -0,0 +1,208 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    test_sys_mon_latency.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the measurement latency tracing of the System Monitoring
+ *          module
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockmcu.h"
+#include "Mockos.h"
+#include "Mocksys_mon_cfg.h"
+
+#include "fassert.h"
+#include "sys_mon_latency.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("sys_mon_latency.c")
+
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/mcu")
+TEST_INCLUDE_PATH("../../src/app/engine/diag")
+TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** free running counter value at the start of the simulated acquisition */
+#define TEST_ACQUISITION_TIMESTAMP (1000u)
+
+/**
+ * @brief   Simulates that a stage hands on the measurement at a given age
+ * @param   stage   processing stage
+ * @param   age_us  age of the measurement in us
+ */
+static void TEST_RecordLatencyAtAge(SYSM_LATENCY_STAGE_e stage, uint32_t age_us) {
+    /* one counter tick per us keeps the simulated pipeline readable */
+    MCU_GetFreeRunningCount_ExpectAndReturn(TEST_ACQUISITION_TIMESTAMP + age_us);
+    MCU_ConvertFrcDifferenceToTimespan_us_ExpectAndReturn(age_us, age_us);
+    SYSM_RecordLatency(stage, TEST_ACQUISITION_TIMESTAMP);
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    SYSM_ResetLatencyStatistics();
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testSYSM_GetAcquisitionTimestamp(void) {
+    MCU_GetFreeRunningCount_ExpectAndReturn(1234u);
+    TEST_ASSERT_EQUAL_UINT32(1234u, SYSM_GetAcquisitionTimestamp());
+
+    /* 0 marks an unknown acquisition time, therefore it must never be returned */
+    MCU_GetFreeRunningCount_ExpectAndReturn(0u);
+    TEST_ASSERT_EQUAL_UINT32(1u, SYSM_GetAcquisitionTimestamp());
+}
+
+void testSYSM_LatencyAssertions(void) {
+    SYSM_LATENCY_STATISTICS_s statistics = {0};
+    TEST_ASSERT_FAIL_ASSERT(SYSM_RecordLatency(SYSM_LATENCY_STAGE_E_MAX, TEST_ACQUISITION_TIMESTAMP));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_GetLatencyStatistics(SYSM_LATENCY_STAGE_E_MAX, &statistics));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_GetLatencyStatistics(SYSM_LATENCY_STAGE_AFE, NULL_PTR));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_IsLatencyBudgetExceeded(SYSM_LATENCY_STAGE_E_MAX));
+    TEST_ASSERT_FAIL_ASSERT(TEST_SYSM_GetLatencyBudget(SYSM_LATENCY_STAGE_E_MAX));
+}
+
+void testSYSM_RecordLatencyIgnoresUnknownTimestamp(void) {
+    /* no call to the MCU is expected as the acquisition time is unknown */
+    SYSM_RecordLatency(SYSM_LATENCY_STAGE_AFE, 0u);
+
+    SYSM_LATENCY_STATISTICS_s statistics = {0};
+    SYSM_GetLatencyStatistics(SYSM_LATENCY_STAGE_AFE, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.numberOfSamples);
+}
+
+void testSYSM_RecordLatencyHandlesCounterOverflow(void) {
+    /* acquisition shortly before the overflow of the free running counter */
+    MCU_GetFreeRunningCount_ExpectAndReturn(10u);
+    MCU_ConvertFrcDifferenceToTimespan_us_ExpectAndReturn(20u, 20u);
+    SYSM_RecordLatency(SYSM_LATENCY_STAGE_AFE, UINT32_MAX - 9u);
+
+    SYSM_LATENCY_STATISTICS_s statistics = {0};
+    SYSM_GetLatencyStatistics(SYSM_LATENCY_STAGE_AFE, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(20u, statistics.last_us);
+}
+
+void testSYSM_RecordLatencyStatistics(void) {
+    TEST_RecordLatencyAtAge(SYSM_LATENCY_STAGE_AFE, 30000u);
+    TEST_RecordLatencyAtAge(SYSM_LATENCY_STAGE_AFE, 10000u);
+    TEST_RecordLatencyAtAge(SYSM_LATENCY_STAGE_AFE, 20000u);
+
+    SYSM_LATENCY_STATISTICS_s statistics = {0};
+    SYSM_GetLatencyStatistics(SYSM_LATENCY_STAGE_AFE, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(10000u, statistics.minimum_us);
+    TEST_ASSERT_EQUAL_UINT32(30000u, statistics.maximum_us);
+    TEST_ASSERT_EQUAL_UINT32(20000u, statistics.last_us);
+    TEST_ASSERT_EQUAL_UINT32(3u, statistics.numberOfSamples);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.numberOfBudgetViolations);
+
+    /* the other stages are not affected */
+    SYSM_GetLatencyStatistics(SYSM_LATENCY_STAGE_CAN_TX, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.numberOfSamples);
+
+    /* reset clears all statistics */
+    SYSM_ResetLatencyStatistics();
+    SYSM_GetLatencyStatistics(SYSM_LATENCY_STAGE_AFE, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.minimum_us);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.maximum_us);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.last_us);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.numberOfSamples);
+}
+
+void testSYSM_LatencyBudgetsAreOrdered(void) {
+    /* each stage hands on the data of the previous one, so its budget can not be smaller */
+    TEST_ASSERT_TRUE(
+        TEST_SYSM_GetLatencyBudget(SYSM_LATENCY_STAGE_AFE) <=
+        TEST_SYSM_GetLatencyBudget(SYSM_LATENCY_STAGE_REDUNDANCY));
+    TEST_ASSERT_TRUE(
+        TEST_SYSM_GetLatencyBudget(SYSM_LATENCY_STAGE_REDUNDANCY) <=
+        TEST_SYSM_GetLatencyBudget(SYSM_LATENCY_STAGE_CAN_TX));
+}
+
+void testSYSM_PipelineWithinLatencyBudget(void) {
+    /* one measurement that passes all stages exactly at their budget */
+    for (uint8_t stage = 0u; stage < (uint8_t)SYSM_LATENCY_STAGE_E_MAX; stage++) {
+        const uint32_t budget_us = TEST_SYSM_GetLatencyBudget((SYSM_LATENCY_STAGE_e)stage);
+        TEST_RecordLatencyAtAge((SYSM_LATENCY_STAGE_e)stage, budget_us);
+        TEST_ASSERT_FALSE(SYSM_IsLatencyBudgetExceeded((SYSM_LATENCY_STAGE_e)stage));
+    }
+}
+
+void testSYSM_PipelineExceedsLatencyBudget(void) {
+    /* the AFE stage is in time, the measurement gets stale while waiting for the redundancy module */
+    const uint32_t afeAge_us        = TEST_SYSM_GetLatencyBudget(SYSM_LATENCY_STAGE_AFE) / 2u;
+    const uint32_t redundancyAge_us = TEST_SYSM_GetLatencyBudget(SYSM_LATENCY_STAGE_REDUNDANCY) + 1u;
+    TEST_RecordLatencyAtAge(SYSM_LATENCY_STAGE_AFE, afeAge_us);
+    TEST_RecordLatencyAtAge(SYSM_LATENCY_STAGE_REDUNDANCY, redundancyAge_us);
+
+    TEST_ASSERT_FALSE(SYSM_IsLatencyBudgetExceeded(SYSM_LATENCY_STAGE_AFE));
+    TEST_ASSERT_TRUE(SYSM_IsLatencyBudgetExceeded(SYSM_LATENCY_STAGE_REDUNDANCY));
+    TEST_ASSERT_FALSE(SYSM_IsLatencyBudgetExceeded(SYSM_LATENCY_STAGE_CAN_TX));
+
+    SYSM_LATENCY_STATISTICS_s statistics = {0};
+    SYSM_GetLatencyStatistics(SYSM_LATENCY_STAGE_REDUNDANCY, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(1u, statistics.numberOfBudgetViolations);
+
+    /* a following measurement in time does not clear the violation */
+    TEST_RecordLatencyAtAge(SYSM_LATENCY_STAGE_REDUNDANCY, afeAge_us);
+    TEST_ASSERT_TRUE(SYSM_IsLatencyBudgetExceeded(SYSM_LATENCY_STAGE_REDUNDANCY));
+    SYSM_GetLatencyStatistics(SYSM_LATENCY_STAGE_REDUNDANCY, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(1u, statistics.numberOfBudgetViolations);
+    TEST_ASSERT_EQUAL_UINT32(2u, statistics.numberOfSamples);
+}
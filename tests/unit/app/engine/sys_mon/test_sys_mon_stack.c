@@ -0,0 +1,194 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+/**
+ * @file    test_sys_mon_stack.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the stack usage monitoring of the System Monitoring
+ *          module
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mocklog.h"
+#include "Mockos.h"
+#include "Mocksys_mon_cfg.h"
+
+#include "fassert.h"
+#include "sys_mon_stack.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("sys_mon_stack.c")
+
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/engine/diag")
+TEST_INCLUDE_PATH("../../src/app/engine/log")
+TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** stack size of the simulated tasks */
+#define TEST_STACK_SIZE_B (1024u)
+
+/** dummy task handles */
+static int test_taskEngine    = 0;
+static int test_taskCyclic1ms = 0;
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    TEST_SYSM_ResetStackUsage();
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testSYSM_StackAssertions(void) {
+    SYSM_STACK_USAGE_s usage = {0};
+    TEST_ASSERT_FAIL_ASSERT(
+        SYSM_RegisterTaskStack(SYSM_STACK_TASK_E_MAX, (OS_TASK_HANDLE)&test_taskEngine, TEST_STACK_SIZE_B));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_RegisterTaskStack(SYSM_STACK_TASK_ENGINE, NULL_PTR, TEST_STACK_SIZE_B));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_RegisterTaskStack(SYSM_STACK_TASK_ENGINE, (OS_TASK_HANDLE)&test_taskEngine, 0u));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_GetStackUsage(SYSM_STACK_TASK_E_MAX, &usage));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_GetStackUsage(SYSM_STACK_TASK_ENGINE, NULL_PTR));
+}
+
+void testSYSM_UpdateStackUsageWithoutRegisteredTasks(void) {
+    /* no task is registered, therefore no stack is searched */
+    SYSM_UpdateStackUsage();
+
+    SYSM_STACK_USAGE_s usage = {0};
+    SYSM_GetStackUsage(SYSM_STACK_TASK_ENGINE, &usage);
+    TEST_ASSERT_FALSE(usage.isRegistered);
+    TEST_ASSERT_EQUAL_UINT32(0u, usage.maximumUsage_B);
+    TEST_ASSERT_FALSE(usage.isLimitExceeded);
+}
+
+void testSYSM_UpdateStackUsageKeepsMaximum(void) {
+    SYSM_RegisterTaskStack(SYSM_STACK_TASK_ENGINE, (OS_TASK_HANDLE)&test_taskEngine, TEST_STACK_SIZE_B);
+    SYSM_RegisterTaskStack(SYSM_STACK_TASK_CYCLIC_1MS, (OS_TASK_HANDLE)&test_taskCyclic1ms, 2u * TEST_STACK_SIZE_B);
+
+    SYSM_STACK_USAGE_s usage = {0};
+    SYSM_GetStackUsage(SYSM_STACK_TASK_ENGINE, &usage);
+    TEST_ASSERT_TRUE(usage.isRegistered);
+    TEST_ASSERT_EQUAL_UINT32(TEST_STACK_SIZE_B, usage.stackSize_B);
+    TEST_ASSERT_EQUAL_UINT32(0u, usage.maximumUsage_B);
+
+    /* only the registered tasks are sampled */
+    OS_GetStackHighWaterMark_B_ExpectAndReturn((OS_TASK_HANDLE)&test_taskEngine, 600u);
+    OS_GetStackHighWaterMark_B_ExpectAndReturn((OS_TASK_HANDLE)&test_taskCyclic1ms, 2000u);
+    SYSM_UpdateStackUsage();
+
+    SYSM_GetStackUsage(SYSM_STACK_TASK_ENGINE, &usage);
+    TEST_ASSERT_EQUAL_UINT32(TEST_STACK_SIZE_B - 600u, usage.maximumUsage_B);
+    SYSM_GetStackUsage(SYSM_STACK_TASK_CYCLIC_1MS, &usage);
+    TEST_ASSERT_EQUAL_UINT32((2u * TEST_STACK_SIZE_B) - 2000u, usage.maximumUsage_B);
+
+    /* the high-water mark only decreases, but a larger value must not reduce the recorded usage */
+    OS_GetStackHighWaterMark_B_ExpectAndReturn((OS_TASK_HANDLE)&test_taskEngine, 800u);
+    OS_GetStackHighWaterMark_B_ExpectAndReturn((OS_TASK_HANDLE)&test_taskCyclic1ms, 1000u);
+    SYSM_UpdateStackUsage();
+
+    SYSM_GetStackUsage(SYSM_STACK_TASK_ENGINE, &usage);
+    TEST_ASSERT_EQUAL_UINT32(TEST_STACK_SIZE_B - 600u, usage.maximumUsage_B);
+    SYSM_GetStackUsage(SYSM_STACK_TASK_CYCLIC_1MS, &usage);
+    TEST_ASSERT_EQUAL_UINT32((2u * TEST_STACK_SIZE_B) - 1000u, usage.maximumUsage_B);
+
+    /* an implausible high-water mark above the stack size counts as no usage */
+    OS_GetStackHighWaterMark_B_ExpectAndReturn((OS_TASK_HANDLE)&test_taskEngine, TEST_STACK_SIZE_B + 4u);
+    OS_GetStackHighWaterMark_B_ExpectAndReturn((OS_TASK_HANDLE)&test_taskCyclic1ms, 1000u);
+    SYSM_UpdateStackUsage();
+    SYSM_GetStackUsage(SYSM_STACK_TASK_ENGINE, &usage);
+    TEST_ASSERT_EQUAL_UINT32(TEST_STACK_SIZE_B - 600u, usage.maximumUsage_B);
+}
+
+void testSYSM_IsStackUsageLimitExceeded(void) {
+    TEST_ASSERT_FALSE(TEST_SYSM_IsStackUsageLimitExceeded(0u, 1000u));
+    /* usage exactly at the limit */
+    TEST_ASSERT_FALSE(TEST_SYSM_IsStackUsageLimitExceeded(900u, 1000u));
+    TEST_ASSERT_TRUE(TEST_SYSM_IsStackUsageLimitExceeded(901u, 1000u));
+    /* the multiplication must not overflow */
+    TEST_ASSERT_FALSE(TEST_SYSM_IsStackUsageLimitExceeded(UINT32_MAX - 1u, UINT32_MAX));
+    TEST_ASSERT_TRUE(TEST_SYSM_IsStackUsageLimitExceeded(UINT32_MAX, UINT32_MAX - 1u));
+}
+
+void testSYSM_UpdateStackUsageFlagsLimitExceedance(void) {
+    SYSM_RegisterTaskStack(SYSM_STACK_TASK_ENGINE, (OS_TASK_HANDLE)&test_taskEngine, 1000u);
+
+    /* usage exactly at the limit */
+    OS_GetStackHighWaterMark_B_ExpectAndReturn((OS_TASK_HANDLE)&test_taskEngine, 100u);
+    SYSM_UpdateStackUsage();
+    SYSM_STACK_USAGE_s usage = {0};
+    SYSM_GetStackUsage(SYSM_STACK_TASK_ENGINE, &usage);
+    TEST_ASSERT_FALSE(usage.isLimitExceeded);
+
+    /* usage above the limit is flagged and logged */
+    OS_GetStackHighWaterMark_B_ExpectAndReturn((OS_TASK_HANDLE)&test_taskEngine, 96u);
+    LOG_Write_ExpectAndReturn(LOG_MESSAGE_ID_STACK_USAGE, (uint32_t)SYSM_STACK_TASK_ENGINE, 904u, 1000u, 0u, STD_OK);
+    SYSM_UpdateStackUsage();
+    SYSM_GetStackUsage(SYSM_STACK_TASK_ENGINE, &usage);
+    TEST_ASSERT_TRUE(usage.isLimitExceeded);
+    TEST_ASSERT_EQUAL_UINT32(904u, usage.maximumUsage_B);
+
+    /* the flag is kept and the exceedance is only logged once */
+    OS_GetStackHighWaterMark_B_ExpectAndReturn((OS_TASK_HANDLE)&test_taskEngine, 50u);
+    SYSM_UpdateStackUsage();
+    SYSM_GetStackUsage(SYSM_STACK_TASK_ENGINE, &usage);
+    TEST_ASSERT_TRUE(usage.isLimitExceeded);
+    TEST_ASSERT_EQUAL_UINT32(950u, usage.maximumUsage_B);
+
+    /* registering the task again clears the flag */
+    SYSM_RegisterTaskStack(SYSM_STACK_TASK_ENGINE, (OS_TASK_HANDLE)&test_taskEngine, 1000u);
+    SYSM_GetStackUsage(SYSM_STACK_TASK_ENGINE, &usage);
+    TEST_ASSERT_FALSE(usage.isLimitExceeded);
+}
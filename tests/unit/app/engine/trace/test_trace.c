@@ -0,0 +1,332 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    test_trace.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the kernel trace recorder
+ * @details TODO
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "MockHL_sys_pmu.h"
+#include "Mockos.h"
+
+#include "HL_system.h"
+
+#include "fassert.h"
+#include "test_assert_helper.h"
+#include "trace.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_INCLUDE_PATH("../../src/app/engine/trace")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+
+/** buffer that is large enough for any snapshot in these tests */
+static uint8_t testBuffer[TRC_SERIALIZED_HEADER_SIZE_IN_BYTES + (4u * TRC_SERIALIZED_TASK_SIZE_IN_BYTES) +
+                          (TRC_RING_BUFFER_LENGTH * TRC_SERIALIZED_EVENT_SIZE_IN_BYTES)] = {0u};
+
+/** the cycle counter counts the calls, starting at 1 */
+static uint32 TEST_PmuGetCycleCount(int cmock_num_calls) {
+    return (uint32)cmock_num_calls + 1u;
+}
+
+static uint16_t TEST_ReadUint16(const uint8_t *pBuffer) {
+    return (uint16_t)(((uint16_t)pBuffer[0u] << 8u) | (uint16_t)pBuffer[1u]);
+}
+
+static uint32_t TEST_ReadUint32(const uint8_t *pBuffer) {
+    return ((uint32_t)pBuffer[0u] << 24u) | ((uint32_t)pBuffer[1u] << 16u) | ((uint32_t)pBuffer[2u] << 8u) |
+           (uint32_t)pBuffer[3u];
+}
+
+/** checks one serialized event */
+static void TEST_AssertEvent(
+    const uint8_t *pEvent,
+    uint32_t timestamp,
+    TRC_EVENT_TYPE_e type,
+    uint8_t object,
+    uint16_t argument) {
+    TEST_ASSERT_EQUAL_UINT32(timestamp, TEST_ReadUint32(&pEvent[0u]));
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)type, pEvent[4u]);
+    TEST_ASSERT_EQUAL_UINT8(object, pEvent[5u]);
+    TEST_ASSERT_EQUAL_UINT16(argument, TEST_ReadUint16(&pEvent[6u]));
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    TEST_TRC_Reset();
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    _pmuGetCycleCount__Stub(TEST_PmuGetCycleCount);
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testTRC_Initialize(void) {
+    _pmuInit__Expect();
+    _pmuEnableCountersGlobal__Expect();
+    _pmuResetCycleCounter__Expect();
+    _pmuStartCounters__Expect(pmuCYCLE_COUNTER);
+    TRC_Initialize();
+}
+
+void testTRC_InvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(TRC_RecordIsrEnter(TRC_ISR_ID_E_MAX));
+    TEST_ASSERT_FAIL_ASSERT(TRC_RecordIsrExit(TRC_ISR_ID_E_MAX));
+    TEST_ASSERT_FAIL_ASSERT(TRC_RecordOsCall(TRC_OS_CALL_E_MAX, 0u));
+    TEST_ASSERT_FAIL_ASSERT(TRC_RecordOsCallFromIsr(TRC_OS_CALL_E_MAX, 0u));
+    TEST_ASSERT_FAIL_ASSERT(TRC_Freeze(TRC_FREEZE_REASON_NONE, 0u));
+    TEST_ASSERT_FAIL_ASSERT(TRC_Freeze(TRC_FREEZE_REASON_E_MAX, 0u));
+    TEST_ASSERT_FAIL_ASSERT(TRC_ReadSnapshot(NULL_PTR, 0u));
+    TEST_ASSERT_FAIL_ASSERT(TRC_KernelTaskCreate(1u, NULL_PTR, 0u));
+    TEST_ASSERT_FAIL_ASSERT(TRC_KernelQueueCreate(NULL_PTR));
+    TEST_ASSERT_FAIL_ASSERT(TEST_TRC_StoreEvent(TRC_EVENT_TYPE_E_MAX, 0u, 0u));
+}
+
+void testTRC_NoSnapshotWhileRecording(void) {
+    TRC_RecordIsrEnter(TRC_ISR_ID_DMA_GROUP_A);
+    TRC_RecordIsrExit(TRC_ISR_ID_DMA_GROUP_A);
+
+    TEST_ASSERT_FALSE(TRC_IsSnapshotPending());
+    TEST_ASSERT_EQUAL(0u, TRC_ReadSnapshot(testBuffer, sizeof(testBuffer)));
+}
+
+void testTRC_FreezeAndReadSnapshot(void) {
+    const uint8_t queue = 0u;
+    TRC_KernelTaskCreate(3u, "TaskA", 2u);
+    TRC_KernelQueueCreate(&queue);
+
+    TRC_KernelTaskSwitchedIn(3u);                                    /* timestamp 1 */
+    TRC_RecordOsCall(TRC_OS_CALL_SEMAPHORE_GIVE, 1u);                /* timestamp 2 */
+    TRC_KernelBlockingOnQueueReceive(&queue);                        /* timestamp 3 */
+    TRC_RecordIsrEnter(TRC_ISR_ID_DMA_GROUP_A);                      /* timestamp 4 */
+    TRC_RecordOsCallFromIsr(TRC_OS_CALL_NOTIFY_GIVE_FROM_ISR, 0u);   /* timestamp 5 */
+    TRC_RecordIsrExit(TRC_ISR_ID_DMA_GROUP_A);                       /* timestamp 6 */
+    TRC_Freeze(TRC_FREEZE_REASON_FATAL_ERROR, 0x00ABCDEFu);          /* timestamp 7 */
+    TEST_ASSERT_TRUE(TRC_IsSnapshotPending());
+
+    const uint32_t expectedSize = TRC_SERIALIZED_HEADER_SIZE_IN_BYTES + TRC_SERIALIZED_TASK_SIZE_IN_BYTES +
+                                  (7u * TRC_SERIALIZED_EVENT_SIZE_IN_BYTES);
+    TEST_ASSERT_EQUAL(expectedSize, TRC_ReadSnapshot(testBuffer, sizeof(testBuffer)));
+    TEST_ASSERT_FALSE(TRC_IsSnapshotPending());
+
+    /* header */
+    TEST_ASSERT_EQUAL_HEX32(TRC_SNAPSHOT_MAGIC, TEST_ReadUint32(&testBuffer[0u]));
+    TEST_ASSERT_EQUAL(TRC_SNAPSHOT_FORMAT_VERSION, testBuffer[4u]);
+    TEST_ASSERT_EQUAL((uint8_t)TRC_FREEZE_REASON_FATAL_ERROR, testBuffer[5u]);
+    TEST_ASSERT_EQUAL(1u, TEST_ReadUint16(&testBuffer[6u]));
+    TEST_ASSERT_EQUAL(7u, TEST_ReadUint32(&testBuffer[8u]));
+    TEST_ASSERT_EQUAL((uint32_t)(GCLK_FREQ * 1000000.0f), TEST_ReadUint32(&testBuffer[12u]));
+    TEST_ASSERT_EQUAL_HEX32(0x00ABCDEFu, TEST_ReadUint32(&testBuffer[16u]));
+
+    /* task table */
+    const uint8_t *pTask = &testBuffer[TRC_SERIALIZED_HEADER_SIZE_IN_BYTES];
+    TEST_ASSERT_EQUAL(3u, pTask[0u]);
+    TEST_ASSERT_EQUAL(2u, pTask[1u]);
+    TEST_ASSERT_EQUAL_MEMORY("TaskA", &pTask[2u], 5u);
+    TEST_ASSERT_EQUAL(0u, pTask[7u]);
+
+    /* events, oldest first */
+    const uint8_t *pEvent = &pTask[TRC_SERIALIZED_TASK_SIZE_IN_BYTES];
+    TEST_AssertEvent(&pEvent[0u], 1u, TRC_EVENT_TASK_SWITCHED_IN, 3u, 0u);
+    TEST_AssertEvent(&pEvent[8u], 2u, TRC_EVENT_OS_CALL, (uint8_t)TRC_OS_CALL_SEMAPHORE_GIVE, 1u);
+    TEST_AssertEvent(&pEvent[16u], 3u, TRC_EVENT_QUEUE_BLOCK_RECEIVE, 3u, 0u);
+    TEST_AssertEvent(&pEvent[24u], 4u, TRC_EVENT_ISR_ENTER, (uint8_t)TRC_ISR_ID_DMA_GROUP_A, 0u);
+    TEST_AssertEvent(&pEvent[32u], 5u, TRC_EVENT_OS_CALL, (uint8_t)TRC_OS_CALL_NOTIFY_GIVE_FROM_ISR, 0u);
+    TEST_AssertEvent(&pEvent[40u], 6u, TRC_EVENT_ISR_EXIT, (uint8_t)TRC_ISR_ID_DMA_GROUP_A, 0u);
+    TEST_AssertEvent(&pEvent[48u], 7u, TRC_EVENT_FREEZE, (uint8_t)TRC_FREEZE_REASON_FATAL_ERROR, 0xCDEFu);
+}
+
+void testTRC_NoEventsWhileFrozen(void) {
+    TRC_Freeze(TRC_FREEZE_REASON_REQUEST, 0u);
+    TRC_RecordIsrEnter(TRC_ISR_ID_DMA_GROUP_A);
+    TRC_KernelTaskSwitchedIn(1u);
+
+    TEST_ASSERT_EQUAL(
+        TRC_SERIALIZED_HEADER_SIZE_IN_BYTES + TRC_SERIALIZED_EVENT_SIZE_IN_BYTES,
+        TRC_ReadSnapshot(testBuffer, sizeof(testBuffer)));
+    TEST_ASSERT_EQUAL(1u, TEST_ReadUint32(&testBuffer[8u]));
+}
+
+void testTRC_RingBufferKeepsNewestEvents(void) {
+    for (uint32_t i = 0u; i < (TRC_RING_BUFFER_LENGTH + 1u); i++) {
+        TRC_RecordIsrEnter(TRC_ISR_ID_DMA_GROUP_A);
+    }
+    /* the freeze event overwrites the second oldest event */
+    TRC_Freeze(TRC_FREEZE_REASON_REQUEST, 0u);
+
+    const uint32_t expectedSize =
+        TRC_SERIALIZED_HEADER_SIZE_IN_BYTES + (TRC_RING_BUFFER_LENGTH * TRC_SERIALIZED_EVENT_SIZE_IN_BYTES);
+    TEST_ASSERT_EQUAL(expectedSize, TRC_ReadSnapshot(testBuffer, sizeof(testBuffer)));
+    TEST_ASSERT_EQUAL(TRC_RING_BUFFER_LENGTH, TEST_ReadUint32(&testBuffer[8u]));
+
+    const uint8_t *pEvent = &testBuffer[TRC_SERIALIZED_HEADER_SIZE_IN_BYTES];
+    TEST_AssertEvent(&pEvent[0u], 3u, TRC_EVENT_ISR_ENTER, (uint8_t)TRC_ISR_ID_DMA_GROUP_A, 0u);
+    TEST_AssertEvent(
+        &pEvent[(TRC_RING_BUFFER_LENGTH - 1u) * TRC_SERIALIZED_EVENT_SIZE_IN_BYTES],
+        TRC_RING_BUFFER_LENGTH + 2u,
+        TRC_EVENT_FREEZE,
+        (uint8_t)TRC_FREEZE_REASON_REQUEST,
+        0u);
+}
+
+void testTRC_ReadSnapshotOnlyCompleteEntries(void) {
+    TRC_KernelTaskCreate(1u, "A", 1u);
+    TRC_Freeze(TRC_FREEZE_REASON_REQUEST, 0u);
+
+    /* nothing fits into a too small buffer */
+    TEST_ASSERT_EQUAL(0u, TRC_ReadSnapshot(testBuffer, TRC_SERIALIZED_HEADER_SIZE_IN_BYTES - 1u));
+    TEST_ASSERT_TRUE(TRC_IsSnapshotPending());
+
+    /* the snapshot is read entry by entry */
+    TEST_ASSERT_EQUAL(
+        TRC_SERIALIZED_HEADER_SIZE_IN_BYTES,
+        TRC_ReadSnapshot(testBuffer, TRC_SERIALIZED_HEADER_SIZE_IN_BYTES + 1u));
+    TEST_ASSERT_EQUAL_HEX32(TRC_SNAPSHOT_MAGIC, TEST_ReadUint32(&testBuffer[0u]));
+    TEST_ASSERT_EQUAL(
+        TRC_SERIALIZED_TASK_SIZE_IN_BYTES, TRC_ReadSnapshot(testBuffer, TRC_SERIALIZED_TASK_SIZE_IN_BYTES));
+    TEST_ASSERT_EQUAL(1u, testBuffer[0u]);
+    TEST_ASSERT_EQUAL(
+        TRC_SERIALIZED_EVENT_SIZE_IN_BYTES, TRC_ReadSnapshot(testBuffer, (uint32_t)sizeof(testBuffer)));
+    TEST_ASSERT_EQUAL((uint8_t)TRC_EVENT_FREEZE, testBuffer[4u]);
+
+    TEST_ASSERT_FALSE(TRC_IsSnapshotPending());
+    TEST_ASSERT_EQUAL(0u, TRC_ReadSnapshot(testBuffer, sizeof(testBuffer)));
+}
+
+void testTRC_FreezeWhileFrozen(void) {
+    TRC_Freeze(TRC_FREEZE_REASON_FATAL_ERROR, 5u);
+    (void)TRC_ReadSnapshot(testBuffer, sizeof(testBuffer));
+    TEST_ASSERT_FALSE(TRC_IsSnapshotPending());
+
+    /* further fatal errors neither change nor export the snapshot again */
+    TRC_Freeze(TRC_FREEZE_REASON_FATAL_ERROR, 6u);
+    TEST_ASSERT_FALSE(TRC_IsSnapshotPending());
+
+    /* a request exports the kept snapshot again */
+    TRC_Freeze(TRC_FREEZE_REASON_REQUEST, 0u);
+    TEST_ASSERT_TRUE(TRC_IsSnapshotPending());
+    TEST_ASSERT_EQUAL(
+        TRC_SERIALIZED_HEADER_SIZE_IN_BYTES + TRC_SERIALIZED_EVENT_SIZE_IN_BYTES,
+        TRC_ReadSnapshot(testBuffer, sizeof(testBuffer)));
+    TEST_ASSERT_EQUAL((uint8_t)TRC_FREEZE_REASON_FATAL_ERROR, testBuffer[5u]);
+    TEST_ASSERT_EQUAL(5u, TEST_ReadUint32(&testBuffer[16u]));
+}
+
+void testTRC_Resume(void) {
+    TRC_RecordIsrEnter(TRC_ISR_ID_DMA_GROUP_A);
+    TRC_Freeze(TRC_FREEZE_REASON_REQUEST, 0u);
+    TEST_ASSERT_TRUE(TRC_IsSnapshotPending());
+
+    /* the snapshot is discarded and recording starts again */
+    TRC_Resume();
+    TEST_ASSERT_FALSE(TRC_IsSnapshotPending());
+    TEST_ASSERT_EQUAL(0u, TRC_ReadSnapshot(testBuffer, sizeof(testBuffer)));
+
+    TRC_RecordIsrExit(TRC_ISR_ID_DMA_GROUP_A);
+    TRC_Freeze(TRC_FREEZE_REASON_REQUEST, 0u);
+    TEST_ASSERT_EQUAL(2u * TRC_SERIALIZED_EVENT_SIZE_IN_BYTES + TRC_SERIALIZED_HEADER_SIZE_IN_BYTES,
+        TRC_ReadSnapshot(testBuffer, sizeof(testBuffer)));
+    TEST_ASSERT_EQUAL((uint8_t)TRC_EVENT_ISR_EXIT, testBuffer[TRC_SERIALIZED_HEADER_SIZE_IN_BYTES + 4u]);
+}
+
+void testTRC_KernelTaskCreate(void) {
+    /* names are truncated to TRC_TASK_NAME_LENGTH characters */
+    TRC_KernelTaskCreate(1u, "ThisIsAVeryLongTaskName", 7u);
+    for (uint32_t i = 1u; i < TRC_MAXIMUM_NUMBER_OF_TASKS; i++) {
+        TRC_KernelTaskCreate(i + 1u, "Task", 1u);
+    }
+    /* tasks beyond the maximum number of tasks are not part of the table */
+    TRC_KernelTaskCreate(TRC_MAXIMUM_NUMBER_OF_TASKS + 1u, "Ignored", 1u);
+
+    TRC_Freeze(TRC_FREEZE_REASON_REQUEST, 0u);
+    (void)TRC_ReadSnapshot(testBuffer, TRC_SERIALIZED_HEADER_SIZE_IN_BYTES + TRC_SERIALIZED_TASK_SIZE_IN_BYTES);
+    TEST_ASSERT_EQUAL(TRC_MAXIMUM_NUMBER_OF_TASKS, TEST_ReadUint16(&testBuffer[6u]));
+    TEST_ASSERT_EQUAL(7u, testBuffer[TRC_SERIALIZED_HEADER_SIZE_IN_BYTES + 1u]);
+    TEST_ASSERT_EQUAL_MEMORY(
+        "ThisIsAVeryLongTaskName", &testBuffer[TRC_SERIALIZED_HEADER_SIZE_IN_BYTES + 2u], TRC_TASK_NAME_LENGTH);
+}
+
+void testTRC_GetQueueIndex(void) {
+    const uint8_t queues[2u] = {0u};
+    TRC_KernelQueueCreate(&queues[0u]);
+    TRC_KernelQueueCreate(&queues[1u]);
+
+    TEST_ASSERT_EQUAL(0u, TEST_TRC_GetQueueIndex(&queues[0u]));
+    TEST_ASSERT_EQUAL(1u, TEST_TRC_GetQueueIndex(&queues[1u]));
+    TEST_ASSERT_EQUAL(TRC_UNKNOWN_OBJECT, TEST_TRC_GetQueueIndex(&testBuffer[0u]));
+}
+
+void testTRC_KernelBlockingEvents(void) {
+    const uint8_t queues[2u] = {0u};
+    TRC_KernelQueueCreate(&queues[0u]);
+    TRC_KernelQueueCreate(&queues[1u]);
+
+    TRC_KernelTaskSwitchedIn(4u);
+    TRC_KernelBlockingOnQueueSend(&queues[1u]);
+    TRC_KernelTaskNotifyBlock(2u);
+    TRC_KernelTaskDelayUntil(0x00012345u);
+    TRC_Freeze(TRC_FREEZE_REASON_REQUEST, 0u);
+
+    TEST_ASSERT_EQUAL(
+        TRC_SERIALIZED_HEADER_SIZE_IN_BYTES + (5u * TRC_SERIALIZED_EVENT_SIZE_IN_BYTES),
+        TRC_ReadSnapshot(testBuffer, sizeof(testBuffer)));
+    const uint8_t *pEvent = &testBuffer[TRC_SERIALIZED_HEADER_SIZE_IN_BYTES];
+    TEST_AssertEvent(&pEvent[8u], 2u, TRC_EVENT_QUEUE_BLOCK_SEND, 4u, 1u);
+    TEST_AssertEvent(&pEvent[16u], 3u, TRC_EVENT_NOTIFY_BLOCK, 4u, 2u);
+    TEST_AssertEvent(&pEvent[24u], 4u, TRC_EVENT_TASK_DELAY_UNTIL, 4u, 0x2345u);
+}
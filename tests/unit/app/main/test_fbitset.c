@@ -0,0 +1,170 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - "This product uses parts of foxBMS&reg;"
+ * - "This product includes parts of foxBMS&reg;"
+ * - "This product is derived from foxBMS&reg;"
+ *
+ */
+
+
+/**
+ * @file    test_fbitset.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.11.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the bitset helper functions
+ * @details Test functions:
+ *          - testBITSET_GetMask
+ *          - testBITSET_IsBitSet
+ *          - testBITSET_WriteBit
+ *          - testBITSET_CountSetBitsOfWord
+ *          - testBITSET_CountSetBits
+ *          - testBITSET_IsAnyBitSet
+ *          - testBITSET_GetFirstSetBit
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+
+#include "fbitset.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+
+void testBITSET_GetMask(void) {
+    TEST_ASSERT_EQUAL_HEX32(0x0u, BITSET_GetMask(0u));
+    TEST_ASSERT_EQUAL_HEX32(0x1u, BITSET_GetMask(1u));
+    TEST_ASSERT_EQUAL_HEX32(0x3FFFFu, BITSET_GetMask(18u));
+    TEST_ASSERT_EQUAL_HEX32(0x7FFFFFFFu, BITSET_GetMask(31u));
+    TEST_ASSERT_EQUAL_HEX32(0xFFFFFFFFu, BITSET_GetMask(32u));
+    TEST_ASSERT_FAIL_ASSERT(BITSET_GetMask(BITSET_BITS_PER_WORD + 1u));
+}
+
+void testBITSET_IsBitSet(void) {
+    const BITSET_WORD_t word = 0x80000005u;
+    TEST_ASSERT_TRUE(BITSET_IsBitSet(word, 0u));
+    TEST_ASSERT_FALSE(BITSET_IsBitSet(word, 1u));
+    TEST_ASSERT_TRUE(BITSET_IsBitSet(word, 2u));
+    TEST_ASSERT_FALSE(BITSET_IsBitSet(word, 30u));
+    TEST_ASSERT_TRUE(BITSET_IsBitSet(word, 31u));
+    TEST_ASSERT_FAIL_ASSERT(BITSET_IsBitSet(word, BITSET_BITS_PER_WORD));
+}
+
+void testBITSET_WriteBit(void) {
+    BITSET_WORD_t word = 0u;
+    TEST_ASSERT_FAIL_ASSERT(BITSET_WriteBit(NULL_PTR, 0u, true));
+    TEST_ASSERT_FAIL_ASSERT(BITSET_WriteBit(&word, BITSET_BITS_PER_WORD, true));
+
+    BITSET_WriteBit(&word, 3u, true);
+    TEST_ASSERT_EQUAL_HEX32(0x8u, word);
+    BITSET_WriteBit(&word, 31u, true);
+    TEST_ASSERT_EQUAL_HEX32(0x80000008u, word);
+    /* writing a set bit again does not change the word */
+    BITSET_WriteBit(&word, 3u, true);
+    TEST_ASSERT_EQUAL_HEX32(0x80000008u, word);
+    BITSET_WriteBit(&word, 3u, false);
+    TEST_ASSERT_EQUAL_HEX32(0x80000000u, word);
+    /* clearing a cleared bit does not change the word */
+    BITSET_WriteBit(&word, 0u, false);
+    TEST_ASSERT_EQUAL_HEX32(0x80000000u, word);
+}
+
+void testBITSET_CountSetBitsOfWord(void) {
+    TEST_ASSERT_EQUAL_UINT8(0u, BITSET_CountSetBitsOfWord(0x0u));
+    TEST_ASSERT_EQUAL_UINT8(1u, BITSET_CountSetBitsOfWord(0x80000000u));
+    TEST_ASSERT_EQUAL_UINT8(16u, BITSET_CountSetBitsOfWord(0xAAAAAAAAu));
+    TEST_ASSERT_EQUAL_UINT8(18u, BITSET_CountSetBitsOfWord(0x3FFFFu));
+    TEST_ASSERT_EQUAL_UINT8(32u, BITSET_CountSetBitsOfWord(0xFFFFFFFFu));
+
+    /* compare against counting bit by bit */
+    const BITSET_WORD_t words[] = {0x12345678u, 0xF0F0F00Fu, 0x00010001u, 0xDEADBEEFu};
+    for (uint8_t i = 0u; i < (sizeof(words) / sizeof(words[0])); i++) {
+        uint8_t expected = 0u;
+        for (uint8_t bit = 0u; bit < BITSET_BITS_PER_WORD; bit++) {
+            if (BITSET_IsBitSet(words[i], bit) == true) {
+                expected++;
+            }
+        }
+        TEST_ASSERT_EQUAL_UINT8(expected, BITSET_CountSetBitsOfWord(words[i]));
+    }
+}
+
+void testBITSET_CountSetBits(void) {
+    const BITSET_WORD_t words[3u] = {0x1u, 0x0u, 0xF000000Fu};
+    TEST_ASSERT_FAIL_ASSERT(BITSET_CountSetBits(NULL_PTR, 1u));
+    TEST_ASSERT_EQUAL_UINT16(0u, BITSET_CountSetBits(words, 0u));
+    TEST_ASSERT_EQUAL_UINT16(1u, BITSET_CountSetBits(words, 2u));
+    TEST_ASSERT_EQUAL_UINT16(9u, BITSET_CountSetBits(words, 3u));
+}
+
+void testBITSET_IsAnyBitSet(void) {
+    const BITSET_WORD_t words[3u] = {0x0u, 0x0u, 0x40000000u};
+    TEST_ASSERT_FAIL_ASSERT(BITSET_IsAnyBitSet(NULL_PTR, 1u));
+    TEST_ASSERT_FALSE(BITSET_IsAnyBitSet(words, 0u));
+    TEST_ASSERT_FALSE(BITSET_IsAnyBitSet(words, 2u));
+    TEST_ASSERT_TRUE(BITSET_IsAnyBitSet(words, 3u));
+}
+
+void testBITSET_GetFirstSetBit(void) {
+    const BITSET_WORD_t words[3u] = {0x0u, 0x00000C00u, 0x1u};
+    TEST_ASSERT_FAIL_ASSERT(BITSET_GetFirstSetBit(NULL_PTR, 1u));
+    TEST_ASSERT_EQUAL_UINT16(BITSET_NO_BIT_SET, BITSET_GetFirstSetBit(words, 1u));
+    /* bit 10 of the second word */
+    TEST_ASSERT_EQUAL_UINT16(42u, BITSET_GetFirstSetBit(words, 3u));
+    TEST_ASSERT_EQUAL_UINT16(0u, BITSET_GetFirstSetBit(&words[2u], 1u));
+
+    const BITSET_WORD_t highestBit = 0x80000000u;
+    TEST_ASSERT_EQUAL_UINT16(31u, BITSET_GetFirstSetBit(&highestBit, 1u));
+}
@@ -43,7 +43,7 @@
  * @file    test_main.c
  * @author  foxBMS Team
  * @date    2020-04-01 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -74,6 +74,7 @@
 #include "Mockos.h"
 #include "Mockpwm.h"
 #include "Mockspi.h"
+#include "Mocktrace.h"
 
 /* clang-format off */
 #include "general.h"
@@ -94,6 +95,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/pwm")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
 TEST_INCLUDE_PATH("../../src/app/engine/hw_info")
+TEST_INCLUDE_PATH("../../src/app/engine/trace")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
 
@@ -144,6 +146,7 @@ void testMain(void) {
     getResetSource_ExpectAndReturn(POWERON_RESET);
     resetSource_t resetSource = POWERON_RESET;
     MINFO_SetResetSource_Expect(resetSource);
+    TRC_Initialize_Expect();
     muxInit_Expect();
     gioInit_Expect();
     SPI_Initialize_Expect();
@@ -164,6 +167,7 @@ void testMain(void) {
     getResetSource_ExpectAndReturn(POWERON_RESET);
     resetSource = POWERON_RESET;
     MINFO_SetResetSource_Expect(resetSource);
+    TRC_Initialize_Expect();
     muxInit_Expect();
     gioInit_Expect();
     SPI_Initialize_Expect();
@@ -189,6 +193,7 @@ void testMain(void) {
     getResetSource_ExpectAndReturn(POWERON_RESET);
     resetSource = POWERON_RESET;
     MINFO_SetResetSource_Expect(resetSource);
+    TRC_Initialize_Expect();
     muxInit_Expect();
     gioInit_Expect();
     SPI_Initialize_Expect();
@@ -43,7 +43,7 @@
  * @file    test_main_ethernet_uart.c
  * @author  foxBMS Team
  * @date    2025-11-14 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -76,6 +76,7 @@
 #include "Mockpwm.h"
 #include "Mockspi.h"
 #include "Mockuart.h"
+#include "Mocktrace.h"
 
 /* clang-format off */
 #include "general.h"
@@ -98,6 +99,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/spi")
 TEST_INCLUDE_PATH("../../src/app/driver/uart")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
 TEST_INCLUDE_PATH("../../src/app/engine/hw_info")
+TEST_INCLUDE_PATH("../../src/app/engine/trace")
 TEST_INCLUDE_PATH("../../src/os/freertos/freertos-plus/freertos-plus-tcp/source/include")
 TEST_INCLUDE_PATH("../../src/os/freertos/freertos-plus/freertos-plus-tcp/source/portable/Compiler/CCS")
 
@@ -150,6 +152,7 @@ void testMain(void) {
     getResetSource_ExpectAndReturn(POWERON_RESET);
     resetSource_t resetSource = POWERON_RESET;
     MINFO_SetResetSource_Expect(resetSource);
+    TRC_Initialize_Expect();
     muxInit_Expect();
     gioInit_Expect();
     SPI_Initialize_Expect();
@@ -172,6 +175,7 @@ void testMain(void) {
     getResetSource_ExpectAndReturn(POWERON_RESET);
     resetSource = POWERON_RESET;
     MINFO_SetResetSource_Expect(resetSource);
+    TRC_Initialize_Expect();
     muxInit_Expect();
     gioInit_Expect();
     SPI_Initialize_Expect();
@@ -199,6 +203,7 @@ void testMain(void) {
     getResetSource_ExpectAndReturn(POWERON_RESET);
     resetSource = POWERON_RESET;
     MINFO_SetResetSource_Expect(resetSource);
+    TRC_Initialize_Expect();
     muxInit_Expect();
     gioInit_Expect();
     SPI_Initialize_Expect();
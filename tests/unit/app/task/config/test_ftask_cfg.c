@@ -43,7 +43,7 @@
  * @file    test_ftask_cfg.c
  * @author  foxBMS Team
  * @date    2020-04-02 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -61,6 +61,7 @@
 #include "Mockafe.h"
 #include "Mockalgorithm.h"
 #include "Mockbal.h"
+#include "Mockbg_jobs.h"
 #include "Mockbms.h"
 #include "Mockcan.h"
 #include "Mockcontactor.h"
@@ -74,6 +75,7 @@
 #include "Mockinfinite-loop-helper.h"
 #include "Mockinterlock.h"
 #include "Mockled.h"
+#include "Mocklog.h"
 #include "Mockmaster_info.h"
 #include "Mockmeas.h"
 #include "Mockmpu_prototypes.h"
@@ -82,7 +84,7 @@
 #include "Mockredundancy.h"
 #include "Mockrtc.h"
 #include "Mocksbc.h"
-#include "Mocksof_trapezoid.h"
+#include "Mocksof.h"
 #include "Mocksps.h"
 #include "Mockstate_estimation.h"
 #include "Mocksys.h"
@@ -101,7 +103,7 @@
 TEST_INCLUDE_PATH("../../src/app/application/algorithm")
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/config")
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
-TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof/trapezoid")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof")
 TEST_INCLUDE_PATH("../../src/app/application/bal")
 TEST_INCLUDE_PATH("../../src/app/application/bms")
 TEST_INCLUDE_PATH("../../src/app/application/redundancy")
@@ -125,8 +127,10 @@ TEST_INCLUDE_PATH("../../src/app/driver/sbc")
 TEST_INCLUDE_PATH("../../src/app/driver/sbc/fs8x_driver")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
 TEST_INCLUDE_PATH("../../src/app/driver/sps")
+TEST_INCLUDE_PATH("../../src/app/engine/bg_jobs")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
 TEST_INCLUDE_PATH("../../src/app/engine/hw_info")
+TEST_INCLUDE_PATH("../../src/app/engine/log")
 TEST_INCLUDE_PATH("../../src/app/engine/sys")
 TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
 TEST_INCLUDE_PATH("../../src/app/task/config")
@@ -158,6 +162,7 @@ void tearDown(void) {
 
 /*========== Test Cases =====================================================*/
 void testFTSK_RunUserCodeIdle(void) {
+    BGJ_RunPendingJobs_Expect();
     TEST_ASSERT_PASS_ASSERT(FTSK_RunUserCodeIdle());
 }
 
@@ -194,6 +199,7 @@ void testFTSK_RunUserCodeEngine(void) {
 void testFTSK_InitializeUserCodePreCyclicTasks(void) {
     /* ======= Routine tests =============================================== */
     /* ======= RT1/2: Test implementation */
+    LOG_Write_ExpectAndReturn(LOG_MESSAGE_ID_LOG_STARTED, LOG_RING_BUFFER_LENGTH, 0u, 0u, 0u, STD_OK);
     SYS_SetStateRequest_ExpectAndReturn(SYS_STATE_INITIALIZATION_REQUEST, STD_NOT_OK);
     PEX_Initialize_Expect();
     PEX_SetPinDirectionOutput_Expect(PEX_PORT_EXPANDER3, PEX_PORT_0_PIN_0);
@@ -208,6 +214,7 @@ void testFTSK_InitializeUserCodePreCyclicTasks(void) {
     TEST_ASSERT_FAIL_ASSERT(FTSK_InitializeUserCodePreCyclicTasks());
 
     /* ======= RT2/2: Test implementation */
+    LOG_Write_ExpectAndReturn(LOG_MESSAGE_ID_LOG_STARTED, LOG_RING_BUFFER_LENGTH, 0u, 0u, 0u, STD_OK);
     SYS_SetStateRequest_ExpectAndReturn(SYS_STATE_INITIALIZATION_REQUEST, STD_OK);
     PEX_Initialize_Expect();
     PEX_SetPinDirectionOutput_Expect(PEX_PORT_EXPANDER3, PEX_PORT_0_PIN_0);
@@ -230,7 +237,6 @@ void testFTSK_RunUserCodeCyclic1ms(void) {
 }
 
 void testFTSK_RunUserCodeCyclic10ms(void) {
-    SYSM_UpdateFramData_Expect();
     SYS_Trigger_ExpectAndReturn(&sys_state, STD_OK);
 
     ILCK_Trigger_Expect();
@@ -240,43 +246,10 @@ void testFTSK_RunUserCodeCyclic10ms(void) {
     SOF_Calculation_Expect();
     ALGO_MonitorExecutionTime_Expect();
     SBC_Trigger_Expect(&sbc_stateMcuSupervisor);
+    MRC_Trigger_Expect();
 
     BMS_Trigger_Expect();
     FTSK_RunUserCodeCyclic10ms();
-
-    for (uint8_t i = 0u; i < 4u; i++) {
-        SYSM_UpdateFramData_Expect();
-        SYS_Trigger_ExpectAndReturn(&sys_state, STD_OK);
-
-        ILCK_Trigger_Expect();
-        ADC_Control_Expect();
-        SPS_Ctrl_Expect();
-        CAN_MainFunction_Expect();
-        SOF_Calculation_Expect();
-        ALGO_MonitorExecutionTime_Expect();
-        SBC_Trigger_Expect(&sbc_stateMcuSupervisor);
-
-        BMS_Trigger_Expect();
-
-        FTSK_RunUserCodeCyclic10ms();
-    }
-
-    SYSM_UpdateFramData_Expect();
-    SYS_Trigger_ExpectAndReturn(&sys_state, STD_OK);
-
-    ILCK_Trigger_Expect();
-    ADC_Control_Expect();
-    SPS_Ctrl_Expect();
-    CAN_MainFunction_Expect();
-    SOF_Calculation_Expect();
-    ALGO_MonitorExecutionTime_Expect();
-    SBC_Trigger_Expect(&sbc_stateMcuSupervisor);
-
-    MRC_ValidateAfeMeasurement_ExpectAndReturn(STD_OK);
-    MRC_ValidatePackMeasurement_ExpectAndReturn(STD_OK);
-    BMS_Trigger_Expect();
-
-    FTSK_RunUserCodeCyclic10ms();
 }
 
 void testFTSK_RunUserCodeCyclic100ms(void) {
@@ -284,6 +257,7 @@ void testFTSK_RunUserCodeCyclic100ms(void) {
     IMD_Trigger_ExpectAndReturn(STD_OK);
     LED_Trigger_Expect();
     MINFO_CheckSupplyVoltageClamp30c_Expect();
+    BGJ_RunOverdueJobs_Expect();
     FTSK_RunUserCodeCyclic100ms();
 
     for (uint8_t i = 0u; i < 9u; i++) {
@@ -291,13 +265,16 @@ void testFTSK_RunUserCodeCyclic100ms(void) {
         IMD_Trigger_ExpectAndReturn(STD_OK);
         LED_Trigger_Expect();
         MINFO_CheckSupplyVoltageClamp30c_Expect();
+        BGJ_RunOverdueJobs_Expect();
         FTSK_RunUserCodeCyclic100ms();
     }
     SE_RunStateEstimations_Expect();
+    BGJ_Request_Expect(BGJ_JOB_ID_STACK_USAGE);
     BAL_Trigger_Expect();
     IMD_Trigger_ExpectAndReturn(STD_OK);
     LED_Trigger_Expect();
     MINFO_CheckSupplyVoltageClamp30c_Expect();
+    BGJ_RunOverdueJobs_Expect();
     FTSK_RunUserCodeCyclic100ms();
 }
 
@@ -43,7 +43,7 @@
  * @file    test_ftask_cfg_afe.c
  * @author  foxBMS Team
  * @date    2020-11-14 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -61,6 +61,7 @@
 #include "Mockafe.h"
 #include "Mockalgorithm.h"
 #include "Mockbal.h"
+#include "Mockbg_jobs.h"
 #include "Mockbms.h"
 #include "Mockcan.h"
 #include "Mockcontactor.h"
@@ -74,6 +75,7 @@
 #include "Mockinfinite-loop-helper.h"
 #include "Mockinterlock.h"
 #include "Mockled.h"
+#include "Mocklog.h"
 #include "Mockmaster_info.h"
 #include "Mockmeas.h"
 #include "Mockmpu_prototypes.h"
@@ -82,7 +84,7 @@
 #include "Mockredundancy.h"
 #include "Mockrtc.h"
 #include "Mocksbc.h"
-#include "Mocksof_trapezoid.h"
+#include "Mocksof.h"
 #include "Mocksps.h"
 #include "Mockstate_estimation.h"
 #include "Mocksys.h"
@@ -101,7 +103,7 @@
 TEST_INCLUDE_PATH("../../src/app/application/algorithm")
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/config")
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
-TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof/trapezoid")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof")
 TEST_INCLUDE_PATH("../../src/app/application/bal")
 TEST_INCLUDE_PATH("../../src/app/application/bms")
 TEST_INCLUDE_PATH("../../src/app/application/redundancy")
@@ -125,8 +127,10 @@ TEST_INCLUDE_PATH("../../src/app/driver/sbc")
 TEST_INCLUDE_PATH("../../src/app/driver/sbc/fs8x_driver")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
 TEST_INCLUDE_PATH("../../src/app/driver/sps")
+TEST_INCLUDE_PATH("../../src/app/engine/bg_jobs")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
 TEST_INCLUDE_PATH("../../src/app/engine/hw_info")
+TEST_INCLUDE_PATH("../../src/app/engine/log")
 TEST_INCLUDE_PATH("../../src/app/engine/sys")
 TEST_INCLUDE_PATH("../../src/app/engine/sys_mon")
 TEST_INCLUDE_PATH("../../src/app/task/config")
@@ -43,7 +43,7 @@
  * @file    test_ftask_freertos_emac_uart.c
  * @author  foxBMS Team
  * @date    2021-11-26 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -60,6 +60,7 @@
 #include "Mockmpu_prototypes.h"
 #include "Mockos.h"
 #include "Mocksys_mon.h"
+#include "Mocksys_mon_stack.h"
 
 #include "ftask.h"
 #include "test_assert_helper.h"
@@ -157,6 +158,7 @@ uint32_t os_schedulerStartTime = 0u;
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    SYSM_RegisterTaskStack_Ignore();
 }
 
 void tearDown(void) {
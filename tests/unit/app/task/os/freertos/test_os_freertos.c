@@ -43,7 +43,7 @@
  * @file    test_os_freertos.c
  * @author  foxBMS Team
  * @date    2021-11-26 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -53,6 +53,7 @@
  *          - testOS_StartScheduler
  *          - testvApplicationIdleHookCallsUserCodeIdle
  *          - testOS_MarkTaskAsRequiringFpuContext
+ *          - testOS_GetStackHighWaterMark_B
  *          - testOS_GetNumberOfStoredMessagesInQueue
  *          - testOS_SendToBackOfQueueFromIsr
  *          - testOS_SendToBackOfQueue
@@ -71,6 +72,7 @@
 #include "Mockqueue.h"
 #include "Mockrtc.h"
 #include "Mocktask.h"
+#include "Mocktrace.h"
 
 #include "os.h"
 #include "test_assert_helper.h"
@@ -82,6 +84,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/can/cbs")
 TEST_INCLUDE_PATH("../../src/app/driver/can/cbs/tx-async")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/rtc")
+TEST_INCLUDE_PATH("../../src/app/engine/trace")
 TEST_INCLUDE_PATH("../../src/app/task/config")
 TEST_INCLUDE_PATH("../../src/app/task/ftask")
 
@@ -225,6 +228,7 @@ void testOS_NotifyFromIsr(void) {
         NULL,
         &xHigherPriorityTaskWoken,
         pdTRUE);
+    TRC_RecordOsCallFromIsr_Expect(TRC_OS_CALL_NOTIFY_FROM_ISR, (uint16_t)OS_SUCCESS);
     OS_NotifyFromIsr(taskToNotify, notifiedValue);
 
     /* Test function with Notification false */
@@ -236,6 +240,7 @@ void testOS_NotifyFromIsr(void) {
         NULL,
         &xHigherPriorityTaskWoken,
         pdFALSE);
+    TRC_RecordOsCallFromIsr_Expect(TRC_OS_CALL_NOTIFY_FROM_ISR, (uint16_t)OS_FAIL);
     OS_NotifyFromIsr(taskToNotify, notifiedValue);
 }
 
@@ -262,11 +267,13 @@ void testOS_NotifyIndexedFromIsr(void) {
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
     xTaskGenericNotifyFromISR_ExpectAndReturn(
         taskToNotify, 2u, notifiedValue, eSetValueWithOverwrite, NULL, &xHigherPriorityTaskWoken, pdTRUE);
+    TRC_RecordOsCallFromIsr_Expect(TRC_OS_CALL_NOTIFY_INDEXED_FROM_ISR, (uint16_t)OS_SUCCESS);
     OS_NotifyIndexedFromIsr(taskToNotify, 2u, notifiedValue);
 
     /* Test function with Notification false */
     xTaskGenericNotifyFromISR_ExpectAndReturn(
         taskToNotify, 2u, notifiedValue, eSetValueWithOverwrite, NULL, &xHigherPriorityTaskWoken, pdFALSE);
+    TRC_RecordOsCallFromIsr_Expect(TRC_OS_CALL_NOTIFY_INDEXED_FROM_ISR, (uint16_t)OS_FAIL);
     OS_NotifyIndexedFromIsr(taskToNotify, 2u, notifiedValue);
 }
 
@@ -323,6 +330,14 @@ void testOS_ResumeTask(void) {
     OS_ResumeTask(taskToResume);
 }
 
+void testOS_GetStackHighWaterMark_B(void) {
+    TEST_ASSERT_FAIL_ASSERT(OS_GetStackHighWaterMark_B(NULL_PTR));
+
+    TaskHandle_t task = ftsk_testtaskHandle;
+    uxTaskGetStackHighWaterMark_ExpectAndReturn(task, 100u);
+    TEST_ASSERT_EQUAL_UINT32(100u * sizeof(StackType_t), OS_GetStackHighWaterMark_B(task));
+}
+
 void testOS_SendToBackOfQueueFromIsr(void) {
     /* ======= Assertion tests ============================================= */
     OS_QUEUE testQueue0 = {0};
@@ -335,10 +350,12 @@ void testOS_SendToBackOfQueueFromIsr(void) {
     TEST_ASSERT_FAIL_ASSERT(OS_SendToBackOfQueueFromIsr(testQueue, NULL_PTR, NULL_PTR));
 
     xQueueGenericSendFromISR_ExpectAndReturn(testQueue, (void *)&dummyVar, NULL_PTR, queueSEND_TO_BACK, pdTRUE);
+    TRC_RecordOsCallFromIsr_Expect(TRC_OS_CALL_SEND_TO_BACK_OF_QUEUE_FROM_ISR, (uint16_t)OS_SUCCESS);
     TEST_ASSERT_EQUAL(OS_SUCCESS, OS_SendToBackOfQueueFromIsr(testQueue, (void *)&dummyVar, NULL_PTR));
 
     /* ======= RT1/2: Test implementation */
     xQueueGenericSendFromISR_ExpectAndReturn(testQueue, (void *)&dummyVar, NULL_PTR, queueSEND_TO_BACK, pdTRUE);
+    TRC_RecordOsCallFromIsr_Expect(TRC_OS_CALL_SEND_TO_BACK_OF_QUEUE_FROM_ISR, (uint16_t)OS_SUCCESS);
     /* ======= RT1/2: call function under test */
     OS_STD_RETURN_e success = OS_SendToBackOfQueueFromIsr(testQueue, (void *)&dummyVar, NULL_PTR);
     /* ======= RT1/2: test output verification */
@@ -346,6 +363,7 @@ void testOS_SendToBackOfQueueFromIsr(void) {
 
     /* ======= RT2/2: Test implementation */
     xQueueGenericSendFromISR_ExpectAndReturn(testQueue, (void *)&dummyVar, NULL_PTR, queueSEND_TO_BACK, pdFAIL);
+    TRC_RecordOsCallFromIsr_Expect(TRC_OS_CALL_SEND_TO_BACK_OF_QUEUE_FROM_ISR, (uint16_t)OS_FAIL);
     /* ======= RT2/2: call function under test */
     OS_STD_RETURN_e failure = OS_SendToBackOfQueueFromIsr(testQueue, (void *)&dummyVar, NULL_PTR);
     /* ======= RT2/2: test output verification */
@@ -392,6 +410,7 @@ void testOS_NotifyGive(void) {
     /* ======= Routine tests =============================================== */
     TaskHandle_t taskToNotify = ftsk_testtaskHandle;
     xTaskGenericNotify_ExpectAndReturn(ftsk_testtaskHandle, tskDEFAULT_INDEX_TO_NOTIFY, 0, eIncrement, NULL, pdPASS);
+    TRC_RecordOsCall_Expect(TRC_OS_CALL_NOTIFY_GIVE, (uint16_t)pdPASS);
     TEST_ASSERT_EQUAL(pdPASS, OS_NotifyGive(taskToNotify));
 }
 
@@ -402,6 +421,7 @@ void testOS_NotifyGiveFromIsr(void) {
     TaskHandle_t taskToNotify           = ftsk_testtaskHandle;
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
     vTaskGenericNotifyGiveFromISR_Expect(ftsk_testtaskHandle, 0u, &xHigherPriorityTaskWoken);
+    TRC_RecordOsCallFromIsr_Expect(TRC_OS_CALL_NOTIFY_GIVE_FROM_ISR, 0u);
     OS_NotifyGiveFromIsr(taskToNotify, &xHigherPriorityTaskWoken);
 
     TEST_ASSERT_EQUAL(xHigherPriorityTaskWoken, pdFALSE);
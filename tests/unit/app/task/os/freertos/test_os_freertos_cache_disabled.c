@@ -43,7 +43,7 @@
  * @file    test_os_freertos_cache_disabled.c
  * @author  foxBMS Team
  * @date    2025-04-09 (date of creation)
- * @updated 2026-04-20 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.11.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -63,6 +63,7 @@
 #include "Mockqueue.h"
 #include "Mockrtc.h"
 #include "Mocktask.h"
+#include "Mocktrace.h"
 
 #include "os.h"
 #include "test_assert_helper.h"
@@ -74,6 +75,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/can/cbs")
 TEST_INCLUDE_PATH("../../src/app/driver/can/cbs/tx-async")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/rtc")
+TEST_INCLUDE_PATH("../../src/app/engine/trace")
 TEST_INCLUDE_PATH("../../src/app/task/config")
 TEST_INCLUDE_PATH("../../src/app/task/ftask")
 
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+
+"""Testing file 'tools/waf-tools/database_layout.py'."""
+
+import struct
+import sys
+import unittest
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).parents[2] / "tools/waf-tools"))
+
+# pylint: disable-next=wrong-import-position
+from database_layout import (  # noqa:E402
+    ElfSymbol,
+    create_database_layout_report,
+    get_alignment,
+    read_elf_symbols,
+)
+
+
+#: ELF identification of a 32-bit big endian file
+ELF_IDENT = b"\x7fELF\x01\x02\x01"
+
+
+def create_elf32_big_endian(symbols: list[tuple[str, int, int, int]]) -> bytes:
+    """Create a minimal big endian ELF32 file with a data section and a symbol
+    table (name, address, size, type) as it is created for the TMS570"""
+    section_names = b"\x00.databaseRAM\x00.symtab\x00.strtab\x00.shstrtab\x00"
+    strings = b"\x00"
+    symbol_table = bytes(16)  # null symbol
+    for name, address, size, symbol_type in symbols:
+        symbol_table += struct.pack(
+            ">IIIBBH", len(strings), address, size, symbol_type, 0, 1
+        )
+        strings += name.encode("utf-8") + b"\x00"
+    data_offset = 0x34
+    strings_offset = data_offset + len(symbol_table)
+    names_offset = strings_offset + len(strings)
+    sh_offset = names_offset + len(section_names)
+    header = ELF_IDENT + bytes(0x20 - len(ELF_IDENT))
+    header += struct.pack(">I10xHHH", sh_offset, 40, 5, 4)
+    sections = [
+        (0, 0, 0, 0, 0, 0, 0, 0, 0, 0),
+        (1, 8, 3, 0x08000000, 0, 0x100, 0, 0, 32, 0),
+        (14, 2, 0, 0, data_offset, len(symbol_table), 3, 1, 4, 16),
+        (22, 3, 0, 0, strings_offset, len(strings), 0, 0, 1, 0),
+        (30, 3, 0, 0, names_offset, len(section_names), 0, 0, 1, 0),
+    ]
+    section_headers = b"".join(struct.pack(">IIIIIIIIII", *i) for i in sections)
+    return header + symbol_table + strings + section_names + section_headers
+
+
+class TestReadElfSymbols(unittest.TestCase):
+    """Test reading the symbols of an ELF file"""
+
+    def test_invalid_file(self):
+        """Files that are not ELF files are rejected"""
+        with self.assertRaises(ValueError):
+            read_elf_symbols(b"\x00" * 64)
+
+    def test_unsupported_class(self):
+        """Unknown ELF classes are rejected"""
+        with self.assertRaises(ValueError):
+            read_elf_symbols(b"\x7fELF\x03\x02" + bytes(58))
+
+    def test_data_objects(self):
+        """Only data objects are read, including their section"""
+        elf = create_elf32_big_endian(
+            [
+                ("data_blockCellVoltage", 0x08000000, 0x80, 1),
+                ("DATA_Task", 0x00030000, 0x40, 2),
+                ("data_blockSoc", 0x08000080, 0x24, 1),
+            ]
+        )
+        self.assertEqual(
+            read_elf_symbols(elf),
+            [
+                ElfSymbol("data_blockCellVoltage", 0x08000000, 0x80, ".databaseRAM"),
+                ElfSymbol("data_blockSoc", 0x08000080, 0x24, ".databaseRAM"),
+            ],
+        )
+
+
+class TestDatabaseLayoutReport(unittest.TestCase):
+    """Test the creation of the database layout report"""
+
+    def test_get_alignment(self):
+        """The alignment is limited to 32 bytes"""
+        self.assertEqual(get_alignment(0x08000000), 32)
+        self.assertEqual(get_alignment(0x08000024), 4)
+        self.assertEqual(get_alignment(0x08000001), 1)
+
+    def test_report(self):
+        """Only data blocks are reported, sorted by their address"""
+        report = create_database_layout_report(
+            [
+                ElfSymbol("data_blockSoc", 0x08000080, 36, ".databaseRAM"),
+                ElfSymbol("data_blockCellVoltage", 0x08000000, 128, ".databaseRAM"),
+                ElfSymbol("can_rxQueue", 0x08001000, 512, ".bss"),
+            ]
+        ).splitlines()
+        self.assertTrue(report[3].startswith("data_blockCellVoltage"))
+        self.assertTrue(report[3].endswith(" 128"))
+        self.assertTrue(report[4].startswith("data_blockSoc"))
+        self.assertNotIn("can_rxQueue", "".join(report))
+        self.assertIn(
+            "total size of the data blocks in '.databaseRAM': 164 bytes", report
+        )
+        self.assertIn("largest data block: 'data_blockCellVoltage' (128 bytes)", report)
+
+
+if __name__ == "__main__":
+    unittest.main()
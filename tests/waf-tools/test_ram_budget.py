@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+
+"""Testing file 'tools/waf-tools/ram_budget.py'."""
+
+import sys
+import unittest
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).parents[2] / "tools/waf-tools"))
+
+# pylint: disable-next=wrong-import-position
+from database_layout import ElfSymbol  # noqa:E402
+
+# pylint: disable-next=wrong-import-position
+from ram_budget import (  # noqa:E402
+    MemoryArea,
+    create_ram_budget_report,
+    read_memory_areas,
+)
+
+#: excerpt of the XML link information as it is created by the TI linker
+XML_LINK_INFO = """<?xml version="1.0" encoding="ISO-8859-1" ?>
+<link_info>
+   <placement_map>
+      <memory_area>
+         <name>APP_FLASH</name>
+         <page_id>0x0</page_id>
+         <origin>0x20</origin>
+         <length>0x3fffe0</length>
+         <used_space>0x40000</used_space>
+         <unused_space>0x3bffe0</unused_space>
+         <attributes>RX</attributes>
+      </memory_area>
+      <memory_area>
+         <name>KERNEL_DATA</name>
+         <page_id>0x0</page_id>
+         <origin>0x8001800</origin>
+         <length>0xb000</length>
+         <used_space>0x3000</used_space>
+         <unused_space>0x8000</unused_space>
+         <attributes>RW</attributes>
+      </memory_area>
+      <memory_area>
+         <name>RAM</name>
+         <page_id>0x0</page_id>
+         <origin>0x800c800</origin>
+         <length>0x71800</length>
+         <used_space>0x38c00</used_space>
+         <unused_space>0x38c00</unused_space>
+         <attributes>RW</attributes>
+      </memory_area>
+   </placement_map>
+</link_info>
+"""
+
+
+class TestReadMemoryAreas(unittest.TestCase):
+    """Test reading the memory areas of the XML link information"""
+
+    def test_memory_areas(self):
+        """All memory areas are read"""
+        areas = read_memory_areas(XML_LINK_INFO)
+        self.assertEqual(len(areas), 3)
+        self.assertEqual(
+            areas[1], MemoryArea("KERNEL_DATA", 0x08001800, 0xB000, 0x3000, "RW")
+        )
+        self.assertEqual(areas[1].free, 0x8000)
+        self.assertTrue(areas[1].contains(0x08001800))
+        self.assertFalse(areas[1].contains(0x0800C800))
+
+    def test_no_memory_areas(self):
+        """Link information without memory areas is rejected"""
+        with self.assertRaises(ValueError):
+            read_memory_areas("<link_info></link_info>")
+
+
+class TestRamBudgetReport(unittest.TestCase):
+    """Test the creation of the RAM budget report"""
+
+    def test_report(self):
+        """Only writable memory areas are reported, including their largest
+        objects and the statically reserved dynamic memory"""
+        report = create_ram_budget_report(
+            read_memory_areas(XML_LINK_INFO),
+            [
+                ElfSymbol("ucHeap", 0x08001900, 8192, ".kernelBSS"),
+                ElfSymbol("mpool_socketStorage", 0x08010000, 3456, ".bss"),
+                ElfSymbol("can_rxQueueStorage", 0x08011000, 512, ".bss"),
+                ElfSymbol("ver_versionInformation", 0x00000100, 64, ".const"),
+            ]
+        ).splitlines()
+        self.assertTrue(report[3].startswith("KERNEL_DATA"))
+        self.assertTrue(report[3].endswith(" 27.3"))
+        self.assertTrue(report[4].startswith("RAM"))
+        self.assertNotIn("APP_FLASH", "".join(report))
+        self.assertIn("  ucHeap: 8192 bytes at 0x08001900 ('.kernelBSS')", report)
+        self.assertIn("  mpool_tcpBufferStorage: not linked", report)
+        ram = report.index("Largest data objects in 'RAM'")
+        self.assertTrue(report[ram + 1].startswith("  mpool_socketStorage"))
+        self.assertTrue(report[ram + 2].startswith("  can_rxQueueStorage"))
+        self.assertNotIn("ver_versionInformation", "".join(report))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Testing file 'tools/waf-tools/stack_usage.py'."""
+
+import sys
+import tempfile
+import unittest
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).parents[2] / "tools/waf-tools"))
+
+# pylint: disable-next=wrong-import-position
+from stack_usage import (  # noqa:E402
+    TASK_CONTEXT_SIZE_B,
+    create_stack_usage_report,
+    get_worst_case_stack_usage,
+    read_stack_information,
+    read_task_stack_sizes,
+    write_stack_usage_report,
+)
+
+#: stack information as gathered from the .aux files
+STACKS = {
+    "FTSK_CreateTaskCyclic10ms": {
+        "Stack usage": 16,
+        "Called functions": ["FTSK_RunUserCodeCyclic10ms", "SYSM_Notify"],
+        "Indirect calls": False,
+    },
+    "FTSK_RunUserCodeCyclic10ms": {
+        "Stack usage": 8,
+        "Called functions": ["BMS_Trigger", "CAN_MainFunction"],
+        "Indirect calls": False,
+    },
+    "BMS_Trigger": {
+        "Stack usage": 200,
+        "Called functions": ["DATA_Read1DataBlock"],
+        "Indirect calls": False,
+    },
+    "CAN_MainFunction": {
+        "Stack usage": 64,
+        "Called functions": ["CAN_MainFunction"],
+        "Indirect calls": True,
+    },
+    "DATA_Read1DataBlock": {
+        "Stack usage": 40,
+        "Called functions": ["memcpy"],
+        "Indirect calls": False,
+    },
+    "SYSM_Notify": {"Stack usage": 24, "Called functions": [], "Indirect calls": False},
+    "FTSK_RunUserCodeCyclic1ms": {
+        "Stack usage": 8,
+        "Called functions": [],
+        "Indirect calls": False,
+    },
+}
+
+FTASK_CFG = """
+#define FTSK_TASK_CYCLIC_1MS_STACK_SIZE_IN_BYTES (1024u)
+#define FTSK_TASK_CYCLIC_10MS_STACK_SIZE_IN_BYTES (256u)
+"""
+
+
+class TestStackUsage(unittest.TestCase):
+    """Test the worst-case stack usage analysis"""
+
+    def test_read_task_stack_sizes(self):
+        """The stack sizes are read from the configuration header"""
+        self.assertEqual(
+            read_task_stack_sizes(FTASK_CFG),
+            {
+                "FTSK_TASK_CYCLIC_1MS_STACK_SIZE_IN_BYTES": 1024,
+                "FTSK_TASK_CYCLIC_10MS_STACK_SIZE_IN_BYTES": 256,
+            },
+        )
+
+    def test_worst_case(self):
+        """The deepest path is found and incomplete information is reported"""
+        usage = get_worst_case_stack_usage(
+            read_stack_information(STACKS), "FTSK_CreateTaskCyclic10ms"
+        )
+        self.assertEqual(usage.stack_usage, 16 + 8 + 200 + 40)
+        self.assertEqual(
+            usage.path,
+            [
+                "FTSK_CreateTaskCyclic10ms",
+                "FTSK_RunUserCodeCyclic10ms",
+                "BMS_Trigger",
+                "DATA_Read1DataBlock",
+            ],
+        )
+        self.assertEqual(usage.unknown_functions, {"memcpy"})
+        self.assertEqual(usage.indirect_calls, {"CAN_MainFunction"})
+        self.assertEqual(usage.recursive_functions, {"CAN_MainFunction"})
+
+    def test_report(self):
+        """The task function is used as entry if it is available"""
+        report, exceeded = create_stack_usage_report(
+            read_stack_information(STACKS), read_task_stack_sizes(FTASK_CFG)
+        )
+        lines = report.splitlines()
+        self.assertTrue(lines[3].startswith("Cyclic1ms   FTSK_RunUserCodeCyclic1ms"))
+        worst_case = 8 + TASK_CONTEXT_SIZE_B
+        margin = 1024 - worst_case
+        self.assertTrue(
+            lines[3].endswith(f"{worst_case:>10}  {1024:>10}  {margin:>7}  yes")
+        )
+        self.assertTrue(lines[4].startswith("Cyclic10ms  FTSK_CreateTaskCyclic10ms"))
+        self.assertTrue(lines[4].endswith("no"))
+        self.assertEqual(exceeded, ["Cyclic10ms"])
+        self.assertIn("    no stack information for: memcpy", lines)
+
+    def test_write_report(self):
+        """The report is written to the file"""
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            ftask_cfg = Path(tmp_dir) / "ftask_cfg.h"
+            ftask_cfg.write_text(FTASK_CFG, encoding="utf-8")
+            report = Path(tmp_dir) / "foxbms.stack-usage.txt"
+            exceeded = write_stack_usage_report(STACKS, ftask_cfg, report)
+            self.assertEqual(exceeded, ["Cyclic10ms"])
+            self.assertTrue(
+                report.read_text(encoding="utf-8").startswith(
+                    "Worst-case stack usage per task"
+                )
+            )
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -88,16 +88,16 @@ class StateEstimation:
                 val = val.lower()
             setattr(self, f.name, val)
 
-        if self.soc not in ("counting", "debug", "lookup-table", "none"):
+        if self.soc not in ("counting", "debug", "ekf", "lookup-table", "none"):
             err_msg = f"Invalid 'soc' configuration: {self.soc}"
             raise InvalidConfigurationError(err_msg)
         if self.soe not in ("counting", "debug", "none"):
             err_msg = f"Invalid 'soe' configuration: {self.soe}"
             raise InvalidConfigurationError(err_msg)
-        if self.sof not in ("trapezoid",):
+        if self.sof not in ("prediction", "trapezoid"):
             err_msg = f"Invalid 'sof' configuration: {self.sof}"
             raise InvalidConfigurationError(err_msg)
-        if self.soh not in ("debug", "none"):
+        if self.soh not in ("debug", "none", "rls"):
             err_msg = f"Invalid 'soh' configuration: {self.soh}"
             raise InvalidConfigurationError(err_msg)
 
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Report the memory layout of the database entries of an application binary.
+
+The database copies a data block as a whole on every read and write access.
+The report lists every data block together with its location, its size and
+the number of bytes that are copied per access, so that the cost of the
+configured battery system (``BS_NR_OF_*``) becomes visible after linking.
+The information is read from the symbol table of the ELF file.
+"""
+
+import struct
+from dataclasses import dataclass
+from pathlib import Path
+
+#: prefix of the symbols of the data blocks (see ``database_cfg.c``)
+DATA_BLOCK_SYMBOL_PREFIX = "data_block"
+
+ELF_MAGIC = b"\x7fELF"
+ELF_CLASS_32 = 1
+ELF_CLASS_64 = 2
+ELF_DATA_LITTLE_ENDIAN = 1
+ELF_DATA_BIG_ENDIAN = 2
+ELF_SECTION_TYPE_SYMTAB = 2
+ELF_SYMBOL_TYPE_OBJECT = 1
+
+
+@dataclass
+class ElfSymbol:
+    """Symbol of an ELF file"""
+
+    name: str  #: name of the symbol
+    address: int  #: address of the symbol
+    size: int  #: size of the symbol in bytes
+    section: str  #: name of the section the symbol is located in
+
+
+def _get_string(table: bytes, offset: int) -> str:
+    """Get a zero terminated string from a string table"""
+    return table[offset : table.index(b"\x00", offset)].decode("utf-8")
+
+
+def read_elf_symbols(data: bytes) -> list[ElfSymbol]:
+    """Read all data object symbols from the symbol table of an ELF file.
+
+    Args:
+        data: content of the ELF file
+
+    Returns:
+        data object symbols of the ELF file
+
+    Raises:
+        ValueError: if the data is not a supported ELF file
+    """
+    if data[:4] != ELF_MAGIC:
+        raise ValueError("Not an ELF file.")
+    elf_class = data[4]
+    if elf_class not in (ELF_CLASS_32, ELF_CLASS_64):
+        raise ValueError(f"Unsupported ELF class '{elf_class}'.")
+    if data[5] == ELF_DATA_BIG_ENDIAN:
+        endian = ">"
+    elif data[5] == ELF_DATA_LITTLE_ENDIAN:
+        endian = "<"
+    else:
+        raise ValueError(f"Unsupported ELF data encoding '{data[5]}'.")
+
+    if elf_class == ELF_CLASS_32:
+        sh_offset, sh_entry_size, sh_number, sh_string_index = struct.unpack_from(
+            f"{endian}I10xHHH", data, 0x20
+        )
+        section_format = f"{endian}IIIIIIIIII"
+        symbol_format = f"{endian}IIIBBH"
+    else:
+        sh_offset, sh_entry_size, sh_number, sh_string_index = struct.unpack_from(
+            f"{endian}Q10xHHH", data, 0x28
+        )
+        section_format = f"{endian}IIQQQQIIQQ"
+        symbol_format = f"{endian}IBBHQQ"
+
+    sections = [
+        struct.unpack_from(section_format, data, sh_offset + i * sh_entry_size)
+        for i in range(sh_number)
+    ]
+    # index 4: file offset, index 5: size of the section
+    section_string_table = sections[sh_string_index]
+    section_names = data[
+        section_string_table[4] : section_string_table[4] + section_string_table[5]
+    ]
+
+    symbols: list[ElfSymbol] = []
+    for section in sections:
+        if section[1] != ELF_SECTION_TYPE_SYMTAB:
+            continue
+        # index 6: link to the string table of the symbol table
+        string_table = sections[section[6]]
+        strings = data[string_table[4] : string_table[4] + string_table[5]]
+        entry_size = struct.calcsize(symbol_format)
+        for offset in range(section[4], section[4] + section[5], entry_size):
+            if elf_class == ELF_CLASS_32:
+                name, value, size, info, _, index = struct.unpack_from(
+                    symbol_format, data, offset
+                )
+            else:
+                name, info, _, index, value, size = struct.unpack_from(
+                    symbol_format, data, offset
+                )
+            if ((info & 0xF) != ELF_SYMBOL_TYPE_OBJECT) or (index >= sh_number):
+                continue
+            symbols.append(
+                ElfSymbol(
+                    name=_get_string(strings, name),
+                    address=value,
+                    size=size,
+                    section=_get_string(section_names, sections[index][0]),
+                )
+            )
+    return symbols
+
+
+def get_alignment(address: int) -> int:
+    """Get the alignment of an address (limited to 32 bytes)"""
+    alignment = 1
+    while (alignment < 32) and ((address % (alignment * 2)) == 0):
+        alignment *= 2
+    return alignment
+
+
+def create_database_layout_report(symbols: list[ElfSymbol]) -> str:
+    """Create the database layout report from the symbols of an ELF file.
+
+    Args:
+        symbols: data object symbols of the ELF file
+
+    Returns:
+        human-readable report of the data blocks
+    """
+    blocks = sorted(
+        (i for i in symbols if i.name.startswith(DATA_BLOCK_SYMBOL_PREFIX)),
+        key=lambda i: i.address,
+    )
+    name_width = max([len("data block")] + [len(i.name) for i in blocks])
+    section_width = max([len("section")] + [len(i.section) for i in blocks])
+    lines = [
+        "Database layout",
+        "",
+        f"{'data block':<{name_width}}  {'section':<{section_width}}  "
+        f"{'address':>10}  {'alignment':>9}  {'size':>8}  {'copy bytes per access':>21}",
+    ]
+    for i in blocks:
+        lines.append(
+            f"{i.name:<{name_width}}  {i.section:<{section_width}}  "
+            f"0x{i.address:08X}  {get_alignment(i.address):>9}  {i.size:>8}  "
+            f"{i.size:>21}"
+        )
+    lines.append("")
+    lines.append(
+        "Each access copies the whole data block once (plus the database queue "
+        "message)."
+    )
+    for section in sorted({i.section for i in blocks}):
+        total = sum(i.size for i in blocks if i.section == section)
+        lines.append(f"total size of the data blocks in '{section}': {total} bytes")
+    if blocks:
+        largest = max(blocks, key=lambda i: i.size)
+        lines.append(f"largest data block: '{largest.name}' ({largest.size} bytes)")
+    return "\n".join(lines) + "\n"
+
+
+def write_database_layout_report(elf_file: Path, report_file: Path) -> None:
+    """Write the database layout report of an ELF file.
+
+    Args:
+        elf_file: application binary
+        report_file: path of the report
+    """
+    symbols = read_elf_symbols(elf_file.read_bytes())
+    report_file.write_text(
+        create_database_layout_report(symbols), encoding="utf-8"
+    )
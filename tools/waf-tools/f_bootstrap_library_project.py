@@ -71,8 +71,11 @@ def bootstrap_library_project(ctx):
             ctx.path.find_node("tools/waf-tools/create_app_build_cfg.py"),
             ctx.path.find_node("tools/waf-tools/create_version.py"),
             ctx.path.find_node("tools/waf-tools/crc64_ti_impl.py"),
+            ctx.path.find_node("tools/waf-tools/database_layout.py"),
             ctx.path.find_node("tools/waf-tools/f_hcg.py"),
             ctx.path.find_node("tools/waf-tools/misc_helpers.py"),
+            ctx.path.find_node("tools/waf-tools/ram_budget.py"),
+            ctx.path.find_node("tools/waf-tools/stack_usage.py"),
             ctx.path.find_node("tools/waf-tools/vcs.py"),
             ctx.path.find_node("tools/waf-tools/vcs_git.py"),
         ]
@@ -51,9 +51,12 @@ from pathlib import Path
 
 
 import crc_bootloader
+import database_layout
 import f_ti_arm_cgt_cc_options  # noqa: F401 pylint: disable=unused-import
 import f_ti_arm_helper  # noqa: F401 pylint: disable=unused-import
 import f_ti_arm_tools  # noqa: F401 pylint: disable=unused-import
+import ram_budget
+import stack_usage
 import waflib.Tools.asm
 from waflib import Context, Logs, Task, TaskGen, Utils
 from waflib.Build import BuildContext
@@ -640,6 +643,55 @@ class app_crc_gen(Task.Task):
         return f"{self.inputs[0]} -> {self.outputs[0]}"
 
 
+class database_layout_report(Task.Task):
+    """Task to create the database layout report from the linker output"""
+
+    color = "CYAN"
+    after = ["link_task"]
+
+    def run(self):  # noqa: D102
+        try:
+            database_layout.write_database_layout_report(
+                elf_file=Path(self.inputs[0].abspath()),
+                report_file=Path(self.outputs[0].abspath()),
+            )
+        except ValueError as exc:
+            Logs.error(str(exc))
+            return 1
+        return 0
+
+    def keyword(self):  # noqa: D102
+        return "Processing"
+
+    def __str__(self) -> str:
+        return f"{self.inputs[0]} -> {self.outputs[0]}"
+
+
+class ram_budget_report(Task.Task):
+    """Task to create the RAM budget report from the linker output"""
+
+    color = "CYAN"
+    after = ["link_task"]
+
+    def run(self):  # noqa: D102
+        try:
+            ram_budget.write_ram_budget_report(
+                elf_file=Path(self.inputs[0].abspath()),
+                xml_link_info_file=Path(self.inputs[1].abspath()),
+                report_file=Path(self.outputs[0].abspath()),
+            )
+        except ValueError as exc:
+            Logs.error(str(exc))
+            return 1
+        return 0
+
+    def keyword(self):  # noqa: D102
+        return "Processing"
+
+    def __str__(self) -> str:
+        return f"{self.inputs[0]} -> {self.outputs[0]}"
+
+
 class update_lauterbach_script(Task.Task):
     """Task create the CRC file from the .bin file"""
 
@@ -705,6 +757,20 @@ def add_crc_task(self):
         ],
     )
 
+    # report the memory layout of the database entries
+    self.create_task(
+        "database_layout_report",
+        src=self.link_task.outputs[0],
+        tgt=[self.link_task.outputs[0].change_ext(".database-layout.txt")],
+    )
+
+    # report the usage of the RAM memory areas
+    self.create_task(
+        "ram_budget_report",
+        src=self.link_task.outputs[0:2],
+        tgt=[self.link_task.outputs[0].change_ext(".ram-budget.txt")],
+    )
+
     # update the Lauterbach script
     lauterbach_in = self.bld.path.find_node(
         "tools/debugger/lauterbach/update_program_information.cmm.in"
@@ -998,6 +1064,31 @@ class get_stack(Task.Task):
         self.outputs[0].write_json(out)
 
 
+class stack_usage_report(Task.Task):
+    """Task to create the worst-case stack usage report of the tasks"""
+
+    color = "CYAN"
+
+    def run(self):  # noqa: D102
+        exceeded = stack_usage.write_stack_usage_report(
+            stacks=self.inputs[0].read_json(),
+            ftask_cfg_file=Path(self.inputs[1].abspath()),
+            report_file=Path(self.outputs[0].abspath()),
+        )
+        for task in exceeded:
+            Logs.warn(
+                f"The worst-case stack usage of task '{task}' exceeds its "
+                f"configured stack size (see {self.outputs[0]})."
+            )
+        return 0
+
+    def keyword(self):  # noqa: D102
+        return "Processing"
+
+    def __str__(self) -> str:
+        return f"{self.inputs[0]} -> {self.outputs[0]}"
+
+
 @TaskGen.feature("cprogram")
 @TaskGen.after_method("process_source")
 def test_exec_fun(self):
@@ -1005,12 +1096,25 @@ def test_exec_fun(self):
     tgt = os.path.join(
         self.bld.bldnode.abspath(), f"{self.env.APPNAME.lower()}.stacks.json"
     )
-    self.create_task(
+    stack_tsk = self.create_task(
         "get_stack",
         src=self.link_task.inputs,
         tgt=self.path.find_or_declare(tgt),
     )
 
+    # report the worst-case stack usage per task of the application
+    ftask_cfg = self.bld.path.find_node("src/app/task/config/ftask_cfg.h")
+    if not ftask_cfg:
+        return
+    report = os.path.join(
+        self.bld.bldnode.abspath(), f"{self.env.APPNAME.lower()}.stack-usage.txt"
+    )
+    self.create_task(
+        "stack_usage_report",
+        src=[stack_tsk.outputs[0], ftask_cfg],
+        tgt=self.path.find_or_declare(report),
+    )
+
 
 @conf
 def find_armcl(ctx):
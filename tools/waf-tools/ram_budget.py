@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+
+"""Report the RAM budget of an application binary.
+
+The TI linker lists every memory area of the linker command file together with
+the number of bytes that are placed into it (``--xml_link_info``). The report
+shows these numbers for all writable memory areas (internal RAM and any
+external RAM that is added to the linker command file) and lists the largest
+data objects of each area, read from the symbol table of the ELF file, so that
+statically reserved buffers such as the FreeRTOS heap and the memory pools are
+visible after linking.
+"""
+
+import xml.etree.ElementTree as ET
+from dataclasses import dataclass
+from pathlib import Path
+
+from database_layout import ElfSymbol, read_elf_symbols
+
+#: number of data objects that are listed per memory area
+NUMBER_OF_LARGEST_OBJECTS = 10
+
+#: statically reserved dynamic memory that is listed separately (FreeRTOS heap
+#: and storage of the memory pools, see ``mem_pool_cfg.c``)
+DYNAMIC_MEMORY_SYMBOLS = ("ucHeap", "mpool_socketStorage", "mpool_tcpBufferStorage")
+
+
+@dataclass
+class MemoryArea:
+    """Memory area of the linker command file"""
+
+    name: str  #: name of the memory area
+    origin: int  #: start address of the memory area
+    length: int  #: size of the memory area in bytes
+    used: int  #: number of bytes placed into the memory area
+    attributes: str  #: access attributes of the memory area (e.g., 'RW')
+
+    @property
+    def free(self) -> int:
+        """number of unused bytes of the memory area"""
+        return self.length - self.used
+
+    def contains(self, address: int) -> bool:
+        """Check if an address is located in the memory area"""
+        return self.origin <= address < (self.origin + self.length)
+
+
+def read_memory_areas(xml_link_info: str) -> list[MemoryArea]:
+    """Read the memory areas from the XML link information of the TI linker.
+
+    Args:
+        xml_link_info: content of the XML link information file
+
+    Returns:
+        memory areas of the linker command file
+
+    Raises:
+        ValueError: if the link information does not contain any memory area
+    """
+    root = ET.fromstring(xml_link_info)
+    areas: list[MemoryArea] = []
+    for area in root.iterfind("./placement_map/memory_area"):
+        areas.append(
+            MemoryArea(
+                name=area.findtext("name", default="").strip(),
+                origin=int(area.findtext("origin", default="0"), 0),
+                length=int(area.findtext("length", default="0"), 0),
+                used=int(area.findtext("used_space", default="0"), 0),
+                attributes=area.findtext("attributes", default="").strip(),
+            )
+        )
+    if not areas:
+        raise ValueError("The link information does not contain memory areas.")
+    return areas
+
+
+def create_ram_budget_report(areas: list[MemoryArea], symbols: list[ElfSymbol]) -> str:
+    """Create the RAM budget report.
+
+    Args:
+        areas: memory areas of the linker command file
+        symbols: data object symbols of the ELF file
+
+    Returns:
+        human-readable report of the writable memory areas
+    """
+    ram_areas = [i for i in areas if "W" in i.attributes]
+    name_width = max([len("memory area")] + [len(i.name) for i in ram_areas])
+    lines = [
+        "RAM budget",
+        "",
+        f"{'memory area':<{name_width}}  {'origin':>10}  {'length':>8}  "
+        f"{'used':>8}  {'free':>8}  {'used [%]':>8}",
+    ]
+    for i in ram_areas:
+        percentage = (100.0 * i.used / i.length) if i.length else 0.0
+        lines.append(
+            f"{i.name:<{name_width}}  0x{i.origin:08X}  {i.length:>8}  "
+            f"{i.used:>8}  {i.free:>8}  {percentage:>8.1f}"
+        )
+    total_length = sum(i.length for i in ram_areas)
+    total_used = sum(i.used for i in ram_areas)
+    lines.append(
+        f"{'total':<{name_width}}  {'':>10}  {total_length:>8}  "
+        f"{total_used:>8}  {total_length - total_used:>8}"
+    )
+
+    lines.append("")
+    lines.append("Statically reserved dynamic memory")
+    for name in DYNAMIC_MEMORY_SYMBOLS:
+        found = [i for i in symbols if i.name == name]
+        if found:
+            lines.append(
+                f"  {name}: {found[0].size} bytes at 0x{found[0].address:08X} "
+                f"('{found[0].section}')"
+            )
+        else:
+            lines.append(f"  {name}: not linked")
+
+    for area in ram_areas:
+        objects = sorted(
+            (i for i in symbols if area.contains(i.address)),
+            key=lambda i: (-i.size, i.name),
+        )[:NUMBER_OF_LARGEST_OBJECTS]
+        if not objects:
+            continue
+        lines.append("")
+        lines.append(f"Largest data objects in '{area.name}'")
+        object_width = max(len(i.name) for i in objects)
+        for i in objects:
+            lines.append(f"  {i.name:<{object_width}}  0x{i.address:08X}  {i.size:>8}")
+    return "\n".join(lines) + "\n"
+
+
+def write_ram_budget_report(
+    elf_file: Path, xml_link_info_file: Path, report_file: Path
+) -> None:
+    """Write the RAM budget report of an application binary.
+
+    Args:
+        elf_file: application binary
+        xml_link_info_file: XML link information of the TI linker
+        report_file: path of the report
+    """
+    areas = read_memory_areas(xml_link_info_file.read_text(encoding="utf-8"))
+    symbols = read_elf_symbols(elf_file.read_bytes())
+    report_file.write_text(create_ram_budget_report(areas, symbols), encoding="utf-8")
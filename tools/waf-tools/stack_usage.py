@@ -0,0 +1,271 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010 - 2026, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Report the worst-case stack usage of the tasks of an application binary.
+
+The compiler reports the stack frame size of every function together with the
+functions it calls (``.aux`` files, gathered in ``<app>.stacks.json``). The
+worst-case stack usage of a task is the deepest path through this call graph
+starting at the task function, plus the context that the FreeRTOS port saves
+on the task stack. The result is compared against the stack sizes that are
+configured in ``ftask_cfg.h``.
+
+The analysis is an upper bound only for the call graph that is known to the
+compiler: calls through function pointers, recursion and functions without
+stack information (e.g., assembler and library functions) are listed in the
+report, as their stack usage is not included.
+"""
+
+import re
+from dataclasses import dataclass, field
+from pathlib import Path
+
+#: task user code functions and the macro of the stack size of the task (see
+#: ``ftask_cfg.h``)
+TASK_ENTRIES: dict[str, str] = {
+    "FTSK_RunUserCodeEngine": "FTSK_TASK_ENGINE_STACK_SIZE_IN_BYTES",
+    "FTSK_RunUserCodeCyclic1ms": "FTSK_TASK_CYCLIC_1MS_STACK_SIZE_IN_BYTES",
+    "FTSK_RunUserCodeCyclic10ms": "FTSK_TASK_CYCLIC_10MS_STACK_SIZE_IN_BYTES",
+    "FTSK_RunUserCodeCyclic100ms": "FTSK_TASK_CYCLIC_100MS_STACK_SIZE_IN_BYTES",
+    "FTSK_RunUserCodeCyclicAlgorithm100ms": (
+        "FTSK_TASK_CYCLIC_ALGORITHM_100MS_STACK_SIZE_IN_BYTES"
+    ),
+    "FTSK_RunUserCodeI2c": "FTSK_TASK_I2C_STACK_SIZE_IN_BYTES",
+    "FTSK_RunUserCodeAfe": "FTSK_TASK_AFE_STACK_SIZE_IN_BYTES",
+    "FTSK_RunUserCodeUart": "FTSK_TASK_UART_STACK_SIZE_IN_BYTES",
+    "FTSK_RunUserCodeEmac": "FTSK_TASK_EMAC_STACK_SIZE_IN_BYTES",
+}
+
+#: prefix of the user code functions and of the task functions that call them
+USER_CODE_PREFIX = "FTSK_RunUserCode"
+TASK_FUNCTION_PREFIX = "FTSK_CreateTask"
+
+#: task context that the FreeRTOS Cortex-R5 port saves on the task stack
+#: (return address, R0-R14, SPSR, D0-D15, FPSCR, FPU context flag and critical
+#: nesting counter)
+TASK_CONTEXT_SIZE_B = 208
+
+STACK_SIZE_RE = re.compile(
+    r"#define\s+(FTSK_TASK_\w+_STACK_SIZE_IN_BYTES)\s+\((\d+)u\)"
+)
+
+
+@dataclass
+class FunctionStack:
+    """Stack information of a function as reported by the compiler"""
+
+    name: str  #: name of the function
+    stack_usage: int  #: size of the stack frame of the function in bytes
+    called_functions: list[str]  #: functions that are called directly
+    indirect_calls: bool  #: true if the function calls through pointers
+
+
+@dataclass
+class StackUsage:
+    """Worst-case stack usage of a call graph"""
+
+    stack_usage: int  #: stack usage of the deepest path in bytes
+    path: list[str]  #: deepest path through the call graph
+    unknown_functions: set[str] = field(default_factory=set)
+    indirect_calls: set[str] = field(default_factory=set)
+    recursive_functions: set[str] = field(default_factory=set)
+
+
+def read_stack_information(stacks: dict) -> dict[str, FunctionStack]:
+    """Read the stack information as gathered by the ``get_stack`` task.
+
+    Args:
+        stacks: content of ``<app>.stacks.json``
+
+    Returns:
+        stack information per function
+    """
+    return {
+        name: FunctionStack(
+            name=name,
+            stack_usage=max(info.get("Stack usage", 0), 0),
+            called_functions=list(info.get("Called functions", [])),
+            indirect_calls=bool(info.get("Indirect calls", False)),
+        )
+        for name, info in stacks.items()
+    }
+
+
+def read_task_stack_sizes(ftask_cfg: str) -> dict[str, int]:
+    """Read the configured task stack sizes from ``ftask_cfg.h``.
+
+    Args:
+        ftask_cfg: content of ``ftask_cfg.h``
+
+    Returns:
+        stack size in bytes per stack size macro
+    """
+    return {m.group(1): int(m.group(2)) for m in STACK_SIZE_RE.finditer(ftask_cfg)}
+
+
+def get_worst_case_stack_usage(
+    functions: dict[str, FunctionStack], root: str
+) -> StackUsage:
+    """Get the deepest path through the call graph starting at a function.
+
+    Args:
+        functions: stack information per function
+        root: function at which the call graph starts
+
+    Returns:
+        worst-case stack usage of the call graph
+    """
+    result = StackUsage(stack_usage=0, path=[])
+    cache: dict[str, tuple[int, list[str]]] = {}
+
+    def visit(name: str, active: list[str]) -> tuple[int, list[str]]:
+        if name in active:
+            result.recursive_functions.add(name)
+            return 0, []
+        if name in cache:
+            return cache[name]
+        function = functions.get(name)
+        if function is None:
+            result.unknown_functions.add(name)
+            return 0, [name]
+        if function.indirect_calls:
+            result.indirect_calls.add(name)
+        deepest: tuple[int, list[str]] = (0, [])
+        for callee in function.called_functions:
+            callee_usage = visit(callee, [*active, name])
+            if callee_usage[0] > deepest[0]:
+                deepest = callee_usage
+        usage = (function.stack_usage + deepest[0], [name, *deepest[1]])
+        cache[name] = usage
+        return usage
+
+    result.stack_usage, result.path = visit(root, [])
+    return result
+
+
+def create_stack_usage_report(
+    functions: dict[str, FunctionStack], stack_sizes: dict[str, int]
+) -> tuple[str, list[str]]:
+    """Create the stack usage report of all tasks.
+
+    Args:
+        functions: stack information per function
+        stack_sizes: configured stack size per stack size macro
+
+    Returns:
+        human-readable report and the names of the tasks whose worst-case
+        stack usage exceeds the configured stack size
+    """
+    rows = []
+    details = []
+    exceeded = []
+    for user_code, stack_size_macro in TASK_ENTRIES.items():
+        if user_code not in functions:
+            continue
+        task = user_code[len(USER_CODE_PREFIX) :]
+        root = f"{TASK_FUNCTION_PREFIX}{task}"
+        if root not in functions:
+            root = user_code
+        usage = get_worst_case_stack_usage(functions, root)
+        worst_case = usage.stack_usage + TASK_CONTEXT_SIZE_B
+        stack_size = stack_sizes.get(stack_size_macro, 0)
+        margin = stack_size - worst_case
+        if margin < 0:
+            exceeded.append(task)
+        complete = not (
+            usage.unknown_functions or usage.indirect_calls or usage.recursive_functions
+        )
+        rows.append((task, root, worst_case, stack_size, margin, complete))
+        details.append(f"{task}: {' -> '.join(usage.path)}")
+        for text, names in (
+            ("calls through function pointers in", usage.indirect_calls),
+            ("recursion in", usage.recursive_functions),
+            ("no stack information for", usage.unknown_functions),
+        ):
+            if names:
+                details.append(f"    {text}: {', '.join(sorted(names))}")
+
+    task_width = max([len("task")] + [len(i[0]) for i in rows])
+    root_width = max([len("entry")] + [len(i[1]) for i in rows])
+    lines = [
+        "Worst-case stack usage per task",
+        "",
+        f"{'task':<{task_width}}  {'entry':<{root_width}}  {'worst case':>10}  "
+        f"{'stack size':>10}  {'margin':>7}  complete",
+    ]
+    for task, root, worst_case, stack_size, margin, complete in rows:
+        lines.append(
+            f"{task:<{task_width}}  {root:<{root_width}}  {worst_case:>10}  "
+            f"{stack_size:>10}  {margin:>7}  {'yes' if complete else 'no'}"
+        )
+    lines.append("")
+    lines.append(
+        f"The worst case includes {TASK_CONTEXT_SIZE_B} bytes of saved task context."
+    )
+    lines.append(
+        "Tasks that are not 'complete' call functions whose stack usage is not "
+        "included (see below)."
+    )
+    lines.append("")
+    lines.append("Deepest call path per task")
+    lines.append("")
+    lines.extend(details)
+    return "\n".join(lines) + "\n", exceeded
+
+
+def write_stack_usage_report(
+    stacks: dict, ftask_cfg_file: Path, report_file: Path
+) -> list[str]:
+    """Write the stack usage report of an application.
+
+    Args:
+        stacks: content of ``<app>.stacks.json``
+        ftask_cfg_file: path of ``ftask_cfg.h``
+        report_file: path of the report
+
+    Returns:
+        names of the tasks whose worst-case stack usage exceeds the configured
+        stack size
+    """
+    report, exceeded = create_stack_usage_report(
+        read_stack_information(stacks),
+        read_task_stack_sizes(ftask_cfg_file.read_text(encoding="utf-8")),
+    )
+    report_file.write_text(report, encoding="utf-8")
+    return exceeded